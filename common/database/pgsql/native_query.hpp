@@ -0,0 +1,144 @@
+#ifndef PGSQL_NATIVE_QUERY_HPP
+#define PGSQL_NATIVE_QUERY_HPP
+
+/******************************************************************************
+ *
+ * @file       native_query.hpp
+ * @brief      在 ODB pgsql 事务内执行参数化原生 SQL 并读取结果集
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * ODB 的 database::execute() 只返回受影响行数，无法读取结果；而 view /
+ * 新持久化类需要重新运行 odb 编译器。该头文件直接复用当前 ODB 事务持有
+ * 的 libpq 连接，供仓储层编写 JOIN / 聚合 / UPSERT 等单次往返查询。
+ *
+ * 错误统一转换为 odb::pgsql::database_exception，调用方沿用既有的
+ * catch (const odb::exception&) 处理路径。
+ *
+ *****************************************************************************/
+
+#include <libpq-fe.h>
+
+#include <odb/pgsql/connection.hxx>
+#include <odb/pgsql/exceptions.hxx>
+#include <odb/pgsql/transaction.hxx>
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace im::db {
+
+/**
+ * @brief PGresult 的 RAII 封装，只读访问文本格式结果。
+ */
+class NativeResult {
+public:
+    explicit NativeResult(PGresult* result) : result_(result) {}
+    ~NativeResult() {
+        if (result_) {
+            PQclear(result_);
+        }
+    }
+
+    NativeResult(const NativeResult&) = delete;
+    NativeResult& operator=(const NativeResult&) = delete;
+    NativeResult(NativeResult&& other) noexcept
+        : result_(std::exchange(other.result_, nullptr)) {}
+    NativeResult& operator=(NativeResult&& other) noexcept {
+        if (this != &other) {
+            if (result_) {
+                PQclear(result_);
+            }
+            result_ = std::exchange(other.result_, nullptr);
+        }
+        return *this;
+    }
+
+    int rows() const { return result_ ? PQntuples(result_) : 0; }
+
+    /// 受影响行数（INSERT/UPDATE/DELETE），SELECT 时为 0。
+    uint64_t affected() const {
+        if (!result_) {
+            return 0;
+        }
+        const char* n = PQcmdTuples(result_);
+        return (n && *n) ? std::strtoull(n, nullptr, 10) : 0;
+    }
+
+    bool is_null(int row, int col) const {
+        return PQgetisnull(result_, row, col) != 0;
+    }
+
+    std::string text(int row, int col) const {
+        if (is_null(row, col)) {
+            return {};
+        }
+        return std::string(PQgetvalue(result_, row, col),
+                           static_cast<std::size_t>(PQgetlength(result_, row, col)));
+    }
+
+    int64_t int64(int row, int col) const {
+        return is_null(row, col) ? 0 : std::strtoll(PQgetvalue(result_, row, col), nullptr, 10);
+    }
+
+    uint64_t uint64(int row, int col) const {
+        return is_null(row, col) ? 0 : std::strtoull(PQgetvalue(result_, row, col), nullptr, 10);
+    }
+
+private:
+    PGresult* result_ = nullptr;
+};
+
+/**
+ * @brief 在指定 pgsql 连接上执行参数化 SQL（$1, $2 ... 文本参数）。
+ *
+ * 必须在该连接的活动事务内调用，语句与 ODB 操作共享同一事务。
+ *
+ * @throws odb::pgsql::database_exception 执行失败时
+ */
+inline NativeResult native_query(odb::pgsql::connection& conn,
+                                 const std::string& sql,
+                                 const std::vector<std::string>& params = {}) {
+    std::vector<const char*> values;
+    values.reserve(params.size());
+    for (const auto& p : params) {
+        values.push_back(p.c_str());
+    }
+
+    PGresult* raw = PQexecParams(conn.handle(),
+                                 sql.c_str(),
+                                 static_cast<int>(values.size()),
+                                 nullptr,
+                                 values.empty() ? nullptr : values.data(),
+                                 nullptr,
+                                 nullptr,
+                                 0);
+    NativeResult result(raw);
+    if (!raw) {
+        throw odb::pgsql::database_exception("08000", PQerrorMessage(conn.handle()));
+    }
+
+    const ExecStatusType status = PQresultStatus(raw);
+    if (status != PGRES_TUPLES_OK && status != PGRES_COMMAND_OK) {
+        const char* state = PQresultErrorField(raw, PG_DIAG_SQLSTATE);
+        throw odb::pgsql::database_exception(state ? state : "XX000",
+                                             PQresultErrorMessage(raw));
+    }
+    return result;
+}
+
+/**
+ * @brief 在当前 ODB pgsql 事务上执行参数化 SQL。
+ */
+inline NativeResult native_query(const std::string& sql,
+                                 const std::vector<std::string>& params = {}) {
+    return native_query(odb::pgsql::transaction::current().connection(), sql, params);
+}
+
+}  // namespace im::db
+
+#endif  // PGSQL_NATIVE_QUERY_HPP
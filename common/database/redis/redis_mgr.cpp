@@ -1,10 +1,63 @@
 #include "redis_mgr.hpp"
 
-#include <cstdarg>
 #include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cstdarg>
 
 namespace im::db {
 
+namespace {
+
+// CRC16-CCITT (XMODEM)，Redis Cluster 槽位计算使用的校验
+constexpr std::array<uint16_t, 256> make_crc16_table() {
+    std::array<uint16_t, 256> table{};
+    for (uint16_t i = 0; i < 256; ++i) {
+        uint16_t crc = static_cast<uint16_t>(i << 8);
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021)
+                                 : static_cast<uint16_t>(crc << 1);
+        }
+        table[i] = crc;
+    }
+    return table;
+}
+
+constexpr auto kCrc16Table = make_crc16_table();
+
+uint16_t crc16(std::string_view data) {
+    uint16_t crc = 0;
+    for (unsigned char c : data) {
+        crc = static_cast<uint16_t>((crc << 8) ^ kCrc16Table[((crc >> 8) ^ c) & 0xFF]);
+    }
+    return crc;
+}
+
+// "host:port"，按最后一个冒号切分以兼容 IPv6
+std::pair<std::string, int> parse_address(std::string_view address) {
+    auto pos = address.rfind(':');
+    if (pos == std::string_view::npos) {
+        throw std::runtime_error("Invalid Redis node address: " + std::string(address));
+    }
+    int port = 0;
+    auto port_str = address.substr(pos + 1);
+    auto [ptr, ec] = std::from_chars(port_str.data(), port_str.data() + port_str.size(), port);
+    if (ec != std::errc{} || ptr != port_str.data() + port_str.size()) {
+        throw std::runtime_error("Invalid Redis node address: " + std::string(address));
+    }
+    return {std::string(address.substr(0, pos)), port};
+}
+
+bool iequals(std::string_view a, std::string_view b) {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+               return std::tolower(static_cast<unsigned char>(x)) ==
+                      std::tolower(static_cast<unsigned char>(y));
+           });
+}
+
+}  // namespace
+
 RedisConfig RedisConfig::from_file(const std::string& config_path) {
     im::utils::ConfigManager cfg(config_path);
     RedisConfig config;
@@ -16,12 +69,33 @@ RedisConfig RedisConfig::from_file(const std::string& config_path) {
     config.connect_timeout = cfg.get<int>("redis.connect_timeout", 1000);
     config.socket_timeout = cfg.get<int>("redis.socket_timeout", 1000);
     config.pool_wait_timeout = cfg.get<int>("redis.pool_wait_timeout", 5000);
+    config.cluster_nodes = cfg.get_array<std::string>("redis.cluster_nodes");
+    config.cluster_max_redirects = cfg.get<int>("redis.cluster_max_redirects", 5);
     return config;
 }
 
+uint16_t RedisClient::key_slot(std::string_view key) {
+    auto open = key.find('{');
+    if (open != std::string_view::npos) {
+        auto close = key.find('}', open + 1);
+        if (close != std::string_view::npos && close != open + 1) {
+            key = key.substr(open + 1, close - open - 1);
+        }
+    }
+    return crc16(key) % kClusterSlots;
+}
+
 RedisClient::RedisClient(RedisConfig config) : config_(std::move(config)) {
     std::lock_guard<std::mutex> lock(context_mutex_);
-    connect_locked();
+    if (is_cluster()) {
+        for (const auto& address : config_.cluster_nodes) {
+            auto [host, port] = parse_address(address);
+            node_index_locked(host, port);
+        }
+        refresh_slots_locked();
+    } else {
+        connect_locked();
+    }
 }
 
 RedisClient::~RedisClient() {
@@ -30,77 +104,345 @@ RedisClient::~RedisClient() {
         redisFree(context_);
         context_ = nullptr;
     }
-}
-
-void RedisClient::connect_locked() {
-    if (context_) {
-        redisFree(context_);
-        context_ = nullptr;
+    for (auto& node : nodes_) {
+        if (node.context) {
+            redisFree(node.context);
+            node.context = nullptr;
+        }
     }
+}
 
+redisContext* RedisClient::open_context(const std::string& host, int port) const {
     timeval timeout{};
     timeout.tv_sec = config_.connect_timeout / 1000;
     timeout.tv_usec = (config_.connect_timeout % 1000) * 1000;
 
-    context_ = redisConnectWithTimeout(config_.host.c_str(), config_.port, timeout);
-    if (!context_ || context_->err) {
-        std::string err = context_ ? context_->errstr : "allocation failed";
-        throw std::runtime_error("Failed to connect to Redis: " + err);
+    redisContext* context = redisConnectWithTimeout(host.c_str(), port, timeout);
+    if (!context || context->err) {
+        std::string err = context ? context->errstr : "allocation failed";
+        if (context) {
+            redisFree(context);
+        }
+        throw std::runtime_error("Failed to connect to Redis " + host + ":" + std::to_string(port) +
+                                 ": " + err);
     }
 
     timeval socket_timeout{};
     socket_timeout.tv_sec = config_.socket_timeout / 1000;
     socket_timeout.tv_usec = (config_.socket_timeout % 1000) * 1000;
-    redisSetTimeout(context_, socket_timeout);
+    redisSetTimeout(context, socket_timeout);
 
     if (!config_.password.empty()) {
         ReplyPtr reply(static_cast<redisReply*>(
-                               redisCommand(context_, "AUTH %b", config_.password.data(),
+                               redisCommand(context, "AUTH %b", config_.password.data(),
                                             config_.password.size())),
                        freeReplyObject);
         if (!reply || reply->type == REDIS_REPLY_ERROR) {
+            redisFree(context);
             throw std::runtime_error("Redis AUTH failed");
         }
     }
 
-    if (config_.db != 0) {
-        ReplyPtr reply(static_cast<redisReply*>(redisCommand(context_, "SELECT %d", config_.db)),
+    // Cluster 只有 db 0
+    if (!is_cluster() && config_.db != 0) {
+        ReplyPtr reply(static_cast<redisReply*>(redisCommand(context, "SELECT %d", config_.db)),
                        freeReplyObject);
         if (!reply || reply->type == REDIS_REPLY_ERROR) {
+            redisFree(context);
             throw std::runtime_error("Redis SELECT failed");
         }
     }
+    return context;
+}
+
+void RedisClient::connect_locked() {
+    if (context_) {
+        redisFree(context_);
+        context_ = nullptr;
+    }
+    context_ = open_context(config_.host, config_.port);
+}
+
+std::string RedisClient::format_command(const char* format, va_list args) {
+    char* raw = nullptr;
+    int len = redisvFormatCommand(&raw, format, args);
+    if (len < 0 || !raw) {
+        throw std::runtime_error("Failed to format Redis command");
+    }
+    std::string formatted(raw, static_cast<size_t>(len));
+    redisFreeCommand(raw);
+    return formatted;
+}
+
+// 从 RESP 编码的命令中取出 argv[1] 作为路由 key；封装的命令都是单 key 且 key 在第一个参数，
+// EVAL 的 key 在脚本和 numkeys 之后。不带 key 的命令返回空
+std::optional<std::string_view> RedisClient::routing_key(std::string_view formatted) {
+    auto next_arg = [&formatted](size_t& pos) -> std::optional<std::string_view> {
+        if (pos >= formatted.size() || formatted[pos] != '$') {
+            return std::nullopt;
+        }
+        auto crlf = formatted.find("\r\n", pos);
+        if (crlf == std::string_view::npos) {
+            return std::nullopt;
+        }
+        size_t len = 0;
+        auto [ptr, ec] = std::from_chars(formatted.data() + pos + 1, formatted.data() + crlf, len);
+        if (ec != std::errc{} || crlf + 2 + len > formatted.size()) {
+            return std::nullopt;
+        }
+        auto arg = formatted.substr(crlf + 2, len);
+        pos = crlf + 2 + len + 2;
+        return arg;
+    };
+
+    size_t pos = formatted.find("\r\n");
+    if (pos == std::string_view::npos) {
+        return std::nullopt;
+    }
+    pos += 2;
+    auto name = next_arg(pos);
+    if (!name || iequals(*name, "PING") || iequals(*name, "CLIENT") || iequals(*name, "KEYS") ||
+        iequals(*name, "CLUSTER")) {
+        return std::nullopt;
+    }
+    if (iequals(*name, "EVAL")) {
+        if (!next_arg(pos) || !next_arg(pos)) {
+            return std::nullopt;
+        }
+    }
+    return next_arg(pos);
 }
 
 RedisClient::ReplyPtr RedisClient::command(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    std::string formatted;
+    try {
+        formatted = format_command(format, args);
+    } catch (...) {
+        va_end(args);
+        throw;
+    }
+    va_end(args);
+    return command_formatted(formatted);
+}
+
+RedisClient::ReplyPtr RedisClient::command_formatted(const std::string& formatted) {
     std::lock_guard<std::mutex> lock(context_mutex_);
-    if (!context_ || context_->err) {
-        connect_locked();
+    auto reply = is_cluster() ? execute_cluster_locked(formatted) : execute_locked(formatted);
+    if (reply->type == REDIS_REPLY_ERROR) {
+        throw std::runtime_error("Redis error: " + reply_string(reply.get()));
     }
+    return reply;
+}
 
+std::vector<RedisClient::ReplyPtr> RedisClient::command_all(const char* format, ...) {
     va_list args;
     va_start(args, format);
-    auto* raw = static_cast<redisReply*>(redisvCommand(context_, format, args));
+    std::string formatted;
+    try {
+        formatted = format_command(format, args);
+    } catch (...) {
+        va_end(args);
+        throw;
+    }
     va_end(args);
 
-    if (!raw) {
-        std::string err = context_ ? context_->errstr : "unknown";
-        connect_locked();
-        va_start(args, format);
-        raw = static_cast<redisReply*>(redisvCommand(context_, format, args));
-        va_end(args);
-        if (!raw) {
-            throw std::runtime_error("Redis command failed after reconnect: " + err);
+    std::lock_guard<std::mutex> lock(context_mutex_);
+    std::vector<ReplyPtr> replies;
+    if (!is_cluster()) {
+        replies.push_back(execute_locked(formatted));
+    } else {
+        if (std::none_of(slots_.begin(), slots_.end(), [](uint16_t n) { return n != kNoNode; })) {
+            refresh_slots_locked();
+        }
+        std::vector<uint16_t> masters(slots_.begin(), slots_.end());
+        std::sort(masters.begin(), masters.end());
+        masters.erase(std::unique(masters.begin(), masters.end()), masters.end());
+        for (auto index : masters) {
+            if (index == kNoNode) {
+                continue;
+            }
+            replies.push_back(exchange_locked(nodes_[index].context, nodes_[index].host,
+                                              nodes_[index].port, formatted, false));
         }
     }
+    for (const auto& reply : replies) {
+        if (reply->type == REDIS_REPLY_ERROR) {
+            throw std::runtime_error("Redis error: " + reply_string(reply.get()));
+        }
+    }
+    return replies;
+}
 
-    ReplyPtr reply(raw, freeReplyObject);
-    if (reply->type == REDIS_REPLY_ERROR) {
-        throw std::runtime_error("Redis error: " + reply_string(reply.get()));
+RedisClient::ReplyPtr RedisClient::execute_locked(const std::string& formatted) {
+    return exchange_locked(context_, config_.host, config_.port, formatted, false);
+}
+
+// 发送一条已编码的命令并读取回复；连接失效时重连一次。错误回复原样返回，由调用方判断
+RedisClient::ReplyPtr RedisClient::exchange_locked(redisContext*& context, const std::string& host,
+                                                   int port, const std::string& formatted,
+                                                   bool asking) {
+    auto reopen = [&] {
+        if (context) {
+            redisFree(context);
+            context = nullptr;
+        }
+        context = open_context(host, port);
+    };
+    auto roundtrip = [&]() -> ReplyPtr {
+        if (asking) {
+            redisAppendCommand(context, "ASKING");
+        }
+        redisAppendFormattedCommand(context, formatted.data(), formatted.size());
+        void* raw = nullptr;
+        if (asking) {
+            if (redisGetReply(context, &raw) != REDIS_OK) {
+                return ReplyPtr(nullptr, freeReplyObject);
+            }
+            freeReplyObject(raw);
+            raw = nullptr;
+        }
+        if (redisGetReply(context, &raw) != REDIS_OK) {
+            return ReplyPtr(nullptr, freeReplyObject);
+        }
+        return ReplyPtr(static_cast<redisReply*>(raw), freeReplyObject);
+    };
+
+    if (!context || context->err) {
+        reopen();
+    }
+    auto reply = roundtrip();
+    if (!reply) {
+        std::string err = context ? context->errstr : "unknown";
+        reopen();
+        reply = roundtrip();
+        if (!reply) {
+            throw std::runtime_error("Redis command failed after reconnect: " + err);
+        }
     }
     return reply;
 }
 
+// 按槽位路由并跟随重定向：
+// - MOVED：槽位已迁走，刷新整张槽位表后重试；
+// - ASK：槽位迁移中，仅本次请求带 ASKING 发往目标节点，不更新槽位表
+RedisClient::ReplyPtr RedisClient::execute_cluster_locked(const std::string& formatted) {
+    if (slots_.empty()) {
+        refresh_slots_locked();
+    }
+
+    auto key = routing_key(formatted);
+    uint16_t node = key ? slots_[key_slot(*key)] : any_node_locked();
+    if (node == kNoNode) {
+        refresh_slots_locked();
+        node = key ? slots_[key_slot(*key)] : any_node_locked();
+        if (node == kNoNode) {
+            throw std::runtime_error("Redis Cluster slot is not served by any node");
+        }
+    }
+
+    bool asking = false;
+    for (int redirects = 0;; ++redirects) {
+        auto& target = nodes_[node];
+        auto reply = exchange_locked(target.context, target.host, target.port, formatted, asking);
+        if (reply->type != REDIS_REPLY_ERROR) {
+            return reply;
+        }
+
+        // "MOVED 3999 127.0.0.1:6381" / "ASK 3999 127.0.0.1:6381"
+        std::string_view error(reply->str ? reply->str : "", reply->str ? reply->len : 0);
+        const bool moved = error.starts_with("MOVED ");
+        const bool ask = error.starts_with("ASK ");
+        if ((!moved && !ask) || redirects >= config_.cluster_max_redirects) {
+            return reply;
+        }
+        auto slot_begin = error.find(' ') + 1;
+        auto slot_end = error.find(' ', slot_begin);
+        if (slot_end == std::string_view::npos) {
+            return reply;
+        }
+        auto [host, port] = parse_address(error.substr(slot_end + 1));
+        node = node_index_locked(host, port);
+        asking = ask;
+        if (moved) {
+            int slot = 0;
+            std::from_chars(error.data() + slot_begin, error.data() + slot_end, slot);
+            try {
+                refresh_slots_locked();
+            } catch (const std::exception& e) {
+                im::utils::LogManager::GetLogger("redis_manager")
+                        ->warn("Failed to refresh Redis Cluster slots after MOVED: {}", e.what());
+            }
+            if (slot >= 0 && slot < kClusterSlots) {
+                slots_[slot] = node;
+            }
+        }
+    }
+}
+
+// 依次向已知节点请求 CLUSTER SLOTS，第一个成功的结果作为新的槽位表（只记录主节点）
+void RedisClient::refresh_slots_locked() {
+    const std::string formatted = "*2\r\n$7\r\nCLUSTER\r\n$5\r\nSLOTS\r\n";
+    std::string last_error = "no cluster nodes configured";
+    const size_t known = nodes_.size();
+    for (size_t i = 0; i < known; ++i) {
+        const std::string queried_host = nodes_[i].host;
+        ReplyPtr reply(nullptr, freeReplyObject);
+        try {
+            reply = exchange_locked(nodes_[i].context, nodes_[i].host, nodes_[i].port, formatted,
+                                    false);
+        } catch (const std::exception& e) {
+            last_error = e.what();
+            continue;
+        }
+        if (reply->type != REDIS_REPLY_ARRAY) {
+            last_error = "unexpected CLUSTER SLOTS reply: " + reply_string(reply.get());
+            continue;
+        }
+
+        std::vector<uint16_t> slots(kClusterSlots, kNoNode);
+        for (size_t r = 0; r < reply->elements; ++r) {
+            const redisReply* range = reply->element[r];
+            if (range->type != REDIS_REPLY_ARRAY || range->elements < 3 ||
+                range->element[2]->type != REDIS_REPLY_ARRAY ||
+                range->element[2]->elements < 2) {
+                continue;
+            }
+            const redisReply* master = range->element[2];
+            std::string host = reply_string(master->element[0]);
+            if (host.empty() || host == "?") {
+                host = queried_host;
+            }
+            auto index = node_index_locked(host, static_cast<int>(master->element[1]->integer));
+            auto first = std::clamp<long long>(range->element[0]->integer, 0, kClusterSlots - 1);
+            auto last = std::clamp<long long>(range->element[1]->integer, 0, kClusterSlots - 1);
+            std::fill(slots.begin() + first, slots.begin() + last + 1, index);
+        }
+        slots_ = std::move(slots);
+        return;
+    }
+    throw std::runtime_error("Failed to load Redis Cluster slots: " + last_error);
+}
+
+uint16_t RedisClient::node_index_locked(const std::string& host, int port) {
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        if (nodes_[i].port == port && nodes_[i].host == host) {
+            return static_cast<uint16_t>(i);
+        }
+    }
+    if (nodes_.size() >= kNoNode) {
+        throw std::runtime_error("Too many Redis Cluster nodes");
+    }
+    nodes_.push_back(ClusterNode{host, port, nullptr});
+    return static_cast<uint16_t>(nodes_.size() - 1);
+}
+
+uint16_t RedisClient::any_node_locked() {
+    auto it = std::find_if(slots_.begin(), slots_.end(), [](uint16_t n) { return n != kNoNode; });
+    return it == slots_.end() ? kNoNode : *it;
+}
+
 std::string RedisClient::reply_string(const redisReply* reply) {
     if (!reply || !reply->str) {
         return {};
@@ -138,12 +480,19 @@ void RedisClient::hdel(const std::string& key, const std::string& field) {
     command("HDEL %b %b", key.data(), key.size(), field.data(), field.size());
 }
 
-void RedisClient::sadd(const std::string& key, const std::string& member) {
-    command("SADD %b %b", key.data(), key.size(), member.data(), member.size());
+int64_t RedisClient::hlen(const std::string& key) {
+    auto reply = command("HLEN %b", key.data(), key.size());
+    return reply->type == REDIS_REPLY_INTEGER ? reply->integer : 0;
 }
 
-void RedisClient::srem(const std::string& key, const std::string& member) {
-    command("SREM %b %b", key.data(), key.size(), member.data(), member.size());
+int64_t RedisClient::sadd(const std::string& key, const std::string& member) {
+    auto reply = command("SADD %b %b", key.data(), key.size(), member.data(), member.size());
+    return reply->type == REDIS_REPLY_INTEGER ? reply->integer : 0;
+}
+
+int64_t RedisClient::srem(const std::string& key, const std::string& member) {
+    auto reply = command("SREM %b %b", key.data(), key.size(), member.data(), member.size());
+    return reply->type == REDIS_REPLY_INTEGER ? reply->integer : 0;
 }
 
 bool RedisClient::sismember(const std::string& key, const std::string& member) {
@@ -157,6 +506,48 @@ int64_t RedisClient::scard(const std::string& key) {
     return reply->type == REDIS_REPLY_INTEGER ? reply->integer : 0;
 }
 
+void RedisClient::zadd(const std::string& key, double score, const std::string& member) {
+    const std::string score_str = std::to_string(score);
+    command("ZADD %b %b %b", key.data(), key.size(), score_str.data(), score_str.size(),
+            member.data(), member.size());
+}
+
+std::vector<std::string> RedisClient::zrangebyscore(const std::string& key,
+                                                    const std::string& min,
+                                                    const std::string& max,
+                                                    int64_t offset,
+                                                    int64_t count) {
+    auto reply = command("ZRANGEBYSCORE %b %b %b LIMIT %lld %lld", key.data(), key.size(),
+                         min.data(), min.size(), max.data(), max.size(),
+                         static_cast<long long>(offset), static_cast<long long>(count));
+    std::vector<std::string> result;
+    if (reply->type == REDIS_REPLY_ARRAY) {
+        result.reserve(reply->elements);
+        for (size_t i = 0; i < reply->elements; ++i) {
+            result.push_back(reply_string(reply->element[i]));
+        }
+    }
+    return result;
+}
+
+int64_t RedisClient::zremrangebyscore(const std::string& key, const std::string& min,
+                                      const std::string& max) {
+    auto reply = command("ZREMRANGEBYSCORE %b %b %b", key.data(), key.size(), min.data(),
+                         min.size(), max.data(), max.size());
+    return reply->type == REDIS_REPLY_INTEGER ? reply->integer : 0;
+}
+
+int64_t RedisClient::zremrangebyrank(const std::string& key, int64_t start, int64_t stop) {
+    auto reply = command("ZREMRANGEBYRANK %b %lld %lld", key.data(), key.size(),
+                         static_cast<long long>(start), static_cast<long long>(stop));
+    return reply->type == REDIS_REPLY_INTEGER ? reply->integer : 0;
+}
+
+int64_t RedisClient::zcard(const std::string& key) {
+    auto reply = command("ZCARD %b", key.data(), key.size());
+    return reply->type == REDIS_REPLY_INTEGER ? reply->integer : 0;
+}
+
 void RedisClient::set(const std::string& key, const std::string& value) {
     command("SET %b %b", key.data(), key.size(), value.data(), value.size());
 }
@@ -184,10 +575,11 @@ void RedisClient::del(const std::string& key) {
 }
 
 std::vector<std::string> RedisClient::keys(const std::string& pattern) {
-    auto reply = command("KEYS %b", pattern.data(), pattern.size());
     std::vector<std::string> result;
-    if (reply->type == REDIS_REPLY_ARRAY) {
-        result.reserve(reply->elements);
+    for (const auto& reply : command_all("KEYS %b", pattern.data(), pattern.size())) {
+        if (reply->type != REDIS_REPLY_ARRAY) {
+            continue;
+        }
         for (size_t i = 0; i < reply->elements; ++i) {
             result.push_back(reply_string(reply->element[i]));
         }
@@ -199,6 +591,41 @@ void RedisClient::expire(const std::string& key, int seconds) {
     command("EXPIRE %b %d", key.data(), key.size(), seconds);
 }
 
+int64_t RedisClient::eval(const std::string& script, const std::string& key,
+                          const std::vector<std::string>& args) {
+    return eval(script, std::vector<std::string>{key}, args);
+}
+
+int64_t RedisClient::eval(const std::string& script, const std::vector<std::string>& keys,
+                          const std::vector<std::string>& args) {
+    if (keys.empty()) {
+        throw std::invalid_argument("EVAL requires at least one key");
+    }
+    const std::string numkeys = std::to_string(keys.size());
+    std::vector<const char*> argv{"EVAL", script.data(), numkeys.data()};
+    std::vector<size_t> argvlen{4, script.size(), numkeys.size()};
+    for (const auto& key : keys) {
+        argv.push_back(key.data());
+        argvlen.push_back(key.size());
+    }
+    for (const auto& arg : args) {
+        argv.push_back(arg.data());
+        argvlen.push_back(arg.size());
+    }
+
+    char* raw = nullptr;
+    int len = redisFormatCommandArgv(&raw, static_cast<int>(argv.size()), argv.data(),
+                                     argvlen.data());
+    if (len < 0 || !raw) {
+        throw std::runtime_error("Failed to format Redis command");
+    }
+    std::string formatted(raw, static_cast<size_t>(len));
+    redisFreeCommand(raw);
+
+    auto reply = command_formatted(formatted);
+    return reply->type == REDIS_REPLY_INTEGER ? reply->integer : 0;
+}
+
 RedisManager::RedisConnection::~RedisConnection() {
     release();
 }
@@ -6,6 +6,7 @@
 
 #include <chrono>
 #include <condition_variable>
+#include <cstdarg>
 #include <cstdint>
 #include <deque>
 #include <functional>
@@ -15,6 +16,7 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -35,6 +37,10 @@ struct RedisConfig {
     int connect_timeout = 1000;
     int socket_timeout = 1000;
     int pool_wait_timeout = 5000;
+    // 非空时以 Redis Cluster 模式连接，元素为 "host:port" 种子节点；此时 host/port/db 不生效
+    std::vector<std::string> cluster_nodes;
+    // 单条命令最多跟随的 MOVED/ASK 重定向次数
+    int cluster_max_redirects = 5;
 
     static RedisConfig from_file(const std::string& config_path);
 };
@@ -47,6 +53,13 @@ public:
     RedisClient(const RedisClient&) = delete;
     RedisClient& operator=(const RedisClient&) = delete;
 
+    static constexpr uint16_t kClusterSlots = 16384;
+
+    /// Cluster 哈希槽：CRC16(key) % 16384，key 中含非空 {tag} 时只对 tag 计算
+    static uint16_t key_slot(std::string_view key);
+
+    bool is_cluster() const { return !config_.cluster_nodes.empty(); }
+
     std::string ping();
     int64_t client_id();
     void client_kill_id(int64_t client_id);
@@ -56,14 +69,25 @@ public:
     template <typename OutputIt>
     void hgetall(const std::string& key, OutputIt out);
     void hdel(const std::string& key, const std::string& field);
+    int64_t hlen(const std::string& key);
 
-    void sadd(const std::string& key, const std::string& member);
-    void srem(const std::string& key, const std::string& member);
+    int64_t sadd(const std::string& key, const std::string& member);
+    int64_t srem(const std::string& key, const std::string& member);
     bool sismember(const std::string& key, const std::string& member);
     int64_t scard(const std::string& key);
     template <typename OutputIt>
     void smembers(const std::string& key, OutputIt out);
 
+    // Sorted sets. Score bounds use Redis syntax ("-inf", "+inf", "(42").
+    void zadd(const std::string& key, double score, const std::string& member);
+    std::vector<std::string> zrangebyscore(const std::string& key, const std::string& min,
+                                           const std::string& max, int64_t offset,
+                                           int64_t count);
+    int64_t zremrangebyscore(const std::string& key, const std::string& min,
+                             const std::string& max);
+    int64_t zremrangebyrank(const std::string& key, int64_t start, int64_t stop);
+    int64_t zcard(const std::string& key);
+
     void set(const std::string& key, const std::string& value);
     std::optional<std::string> get(const std::string& key);
     bool exists(const std::string& key);
@@ -73,15 +97,52 @@ public:
     std::vector<std::string> keys(const std::string& pattern);
     void expire(const std::string& key, int seconds);
 
+    // 单 key 的 Lua 脚本（EVAL script 1 key args...），多条命令一次往返且原子执行；
+    // Cluster 模式按 key 路由。返回整数回复，其它类型的回复返回 0
+    int64_t eval(const std::string& script, const std::string& key,
+                 const std::vector<std::string>& args);
+    // 多 key 版本（EVAL script N keys... args...）；Cluster 模式按第一个 key 路由，
+    // 调用方需用 hash tag 保证所有 key 落在同一个槽
+    int64_t eval(const std::string& script, const std::vector<std::string>& keys,
+                 const std::vector<std::string>& args);
+
 private:
     using ReplyPtr = std::unique_ptr<redisReply, void (*)(void*)>;
 
+    // Cluster 模式下的一个节点连接；每个 RedisClient 各自持有，
+    // 连接池中的 N 个客户端即每个节点 N 条连接
+    struct ClusterNode {
+        std::string host;
+        int port = 0;
+        redisContext* context = nullptr;
+    };
+
+    static constexpr uint16_t kNoNode = 0xFFFF;
+
+    // 单机模式发往当前连接；Cluster 模式按第一个 key 路由（无 key 的命令发往任一主节点）
     ReplyPtr command(const char* format, ...);
+    ReplyPtr command_formatted(const std::string& formatted);
+    // 在所有主节点上执行（单机模式即当前连接），用于 KEYS 这类无法按 key 路由的命令
+    std::vector<ReplyPtr> command_all(const char* format, ...);
+
+    ReplyPtr execute_locked(const std::string& formatted);
+    ReplyPtr execute_cluster_locked(const std::string& formatted);
+    ReplyPtr exchange_locked(redisContext*& context, const std::string& host, int port,
+                             const std::string& formatted, bool asking);
+    redisContext* open_context(const std::string& host, int port) const;
     void connect_locked();
+    void refresh_slots_locked();
+    uint16_t node_index_locked(const std::string& host, int port);
+    uint16_t any_node_locked();
+
+    static std::string format_command(const char* format, va_list args);
+    static std::optional<std::string_view> routing_key(std::string_view formatted);
     static std::string reply_string(const redisReply* reply);
 
     RedisConfig config_;
     redisContext* context_ = nullptr;
+    std::vector<ClusterNode> nodes_;
+    std::vector<uint16_t> slots_;  // 槽 -> nodes_ 下标，kNoNode 表示未分配
     mutable std::mutex context_mutex_;
 };
 
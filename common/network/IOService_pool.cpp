@@ -1,4 +1,5 @@
 #include <iostream>
+#include <system_error>
 #include "../utils/log_manager.hpp"
 #include "IOService_pool.hpp"
 
@@ -18,8 +19,23 @@ IOServicePool::IOServicePool(std::size_t pool_size)
     
     works_.reserve(pool_size_);
     io_services_.reserve(pool_size_);
+    LogManager::GetLogger("io_service_pool")
+            ->info("IOServicePool starting {} io_context(s), asio backend: {}",
+                   static_cast<std::size_t>(pool_size_), backend_name());
     for (std::size_t i = 0; i < pool_size_; ++i) {
+#ifdef BOOST_ASIO_HAS_IO_URING
+        try {
+            io_services_.emplace_back(std::make_shared<IOService>());
+        } catch (const std::system_error& e) {
+            // io_uring 是编译期选定的，运行期无法退回 epoll（内核过旧或被 sysctl 禁用）
+            LogManager::GetLogger("io_service_pool")
+                    ->error("io_uring setup failed: {}; rebuild without MYCHAT_ASIO_IO_URING",
+                            e.what());
+            throw;
+        }
+#else
         io_services_.emplace_back(std::make_shared<IOService>());
+#endif
         works_.emplace_back(std::make_unique<Work>(boost::asio::make_work_guard(*io_services_[i])));
         threads_.emplace_back([io_service = io_services_[i]]() {
             if (LogManager::IsLoggingEnabled("io_service_pool")) {
@@ -43,6 +43,17 @@ public:
 
     void Stop();
 
+    // 编译期选定的 Asio 事件后端：-DMYCHAT_ASIO_IO_URING=ON 时 socket 走 io_uring
+    static constexpr const char* backend_name() {
+#if defined(BOOST_ASIO_HAS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL)
+        return "io_uring";
+#elif defined(BOOST_ASIO_HAS_IO_URING)
+        return "epoll+io_uring";
+#else
+        return "epoll";
+#endif
+    }
+
     IOServicePool(std::size_t pool_size = std::thread::hardware_concurrency());
 private:
     
@@ -0,0 +1,217 @@
+#ifndef CLIENT_SESSION_HPP
+#define CLIENT_SESSION_HPP
+
+/******************************************************************************
+ *
+ * @file       client_session.hpp
+ * @brief      客户端连接的公共接口：WebSocket 与原生 TCP 会话共用
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * 网关的连接管理、推送和消息处理只依赖这里的接口，不关心连接走的是哪种传输。
+ * 会话 ID、连接身份和帧格式由基类保存；发送、关闭等与传输相关的操作由子类实现，
+ * 都可以从任意线程调用。
+ *
+ *****************************************************************************/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "wire_format.hpp"
+
+namespace im {
+namespace network {
+
+class ClientSession : public std::enable_shared_from_this<ClientSession> {
+public:
+    virtual ~ClientSession() = default;
+
+    ClientSession(const ClientSession&) = delete;
+    ClientSession& operator=(const ClientSession&) = delete;
+
+    virtual void send(const std::string& message) = 0;
+
+    virtual void close() = 0;
+
+    /**
+     * @brief 热重启排空时关闭，建议客户端等待 reconnect_after 后再重连
+     *
+     * 传输不支持携带关闭原因时等同于 close()，客户端按自己的退避重连。
+     */
+    virtual void close_for_restart(std::chrono::milliseconds reconnect_after) {
+        (void)reconnect_after;
+        close();
+    }
+
+    // 已提交但尚未写完的帧数，批量推送据此做流控
+    virtual std::size_t pending_sends() const = 0;
+
+    /**
+     * @brief pending_sends() 降到 window 以下时回调一次
+     *
+     * 已低于 window 时立即回调 true；否则等写完成后回调，会话先关闭则回调 false。
+     * 每个会话只保留一个等待者，新的等待者会让旧的以 false 返回。回调在会话的
+     * I/O 线程执行，不能在里面阻塞。默认实现没有写完成事件，按当前值回调一次。
+     */
+    virtual void when_writable(std::size_t window, std::function<void(bool)> callback) {
+        callback(pending_sends() < window);
+    }
+
+    virtual std::string get_client_ip() const = 0;
+
+    const std::string& get_session_id() const { return session_id_; }
+
+    // 连接认证用的 Token：WebSocket 取自握手请求，原生 TCP 取自 AUTH 帧
+    const std::string& get_token() const { return identity_.token; }
+
+    // 连接的帧格式，开始读帧后不再变化
+    WireVersion wire_version() const { return wire_version_; }
+
+    const ConnectionIdentity& identity() const { return identity_; }
+
+    // 记录 token 验证后的用户身份；只在会话的 I/O 线程读下一帧之前调用
+    void bind_identity(std::string user_id, std::string device_id, std::string platform,
+                       std::chrono::system_clock::time_point expire_time = {},
+                       std::string token_id = {}) {
+        identity_.user_id = std::move(user_id);
+        identity_.device_id = std::move(device_id);
+        identity_.platform = std::move(platform);
+        identity_.expire_time = expire_time;
+        identity_.token_id = std::move(token_id);
+        identity_.revocation_checked_at = std::chrono::steady_clock::now();
+    }
+
+    // 记录一次撤销复查（快速路径把帧交给常规路径验证时调用）；只在会话的 I/O 线程调用
+    void mark_revocation_checked(std::chrono::steady_clock::time_point at) {
+        identity_.revocation_checked_at = at;
+    }
+
+protected:
+    explicit ClientSession(std::string session_id) : session_id_(std::move(session_id)) {}
+
+    /**
+     * @brief 生成会话 ID：prefix + 进程启动时的随机数 + 进程内计数
+     *
+     * 会话 ID 是 Redis 里 session:user:{id} 的键，必须跨进程唯一。热重启时新旧进程
+     * 同时在线，只用进程内计数会让新进程的 session_1 覆盖旧进程的 session_1。
+     */
+    static std::string make_session_id(const char* prefix, std::size_t counter) {
+        return std::string(prefix) + boot_nonce() + "_" + std::to_string(counter);
+    }
+
+    // 以下三个只在会话的 I/O 线程调用，供子类实现 when_writable
+    void wait_writable(std::size_t window, std::function<void(bool)> callback) {
+        release_writable_waiter();
+        if (pending_sends() < window) {
+            callback(true);
+            return;
+        }
+        writable_window_ = window;
+        writable_callback_ = std::move(callback);
+    }
+
+    // 一帧写完、pending_sends 已减少后调用
+    void on_send_completed() {
+        if (writable_callback_ && pending_sends() < writable_window_) {
+            auto callback = std::move(writable_callback_);
+            writable_callback_ = nullptr;
+            callback(true);
+        }
+    }
+
+    // 会话关闭时调用
+    void release_writable_waiter() {
+        if (writable_callback_) {
+            auto callback = std::move(writable_callback_);
+            writable_callback_ = nullptr;
+            callback(false);
+        }
+    }
+
+    std::string session_id_;
+    ConnectionIdentity identity_;
+    WireVersion wire_version_ = WireVersion::V1;
+
+private:
+    static const std::string& boot_nonce() {
+        static const std::string nonce = [] {
+            std::random_device rd;
+            const uint64_t bits =
+                    ((static_cast<uint64_t>(rd()) << 32) | rd()) ^
+                    static_cast<uint64_t>(
+                            std::chrono::system_clock::now().time_since_epoch().count());
+            char buf[17];
+            std::snprintf(buf, sizeof(buf), "%016llx", static_cast<unsigned long long>(bits));
+            return std::string(buf);
+        }();
+        return nonce;
+    }
+
+    std::size_t writable_window_ = 0;
+    std::function<void(bool)> writable_callback_;
+};
+
+using SessionPtr = std::shared_ptr<ClientSession>;
+
+/**
+ * @brief 按会话 ID 查找在线连接
+ *
+ * WebSocketServer、TCPServer 各自实现；ConnectionManager 和 PushService 只依赖它，
+ * 推送不区分用户连在哪个传输上。
+ */
+class SessionLookup {
+public:
+    virtual ~SessionLookup() = default;
+
+    virtual SessionPtr get_session(const std::string& session_id) const = 0;
+
+    /// 当前全部会话的快照（热重启排空用）
+    virtual std::vector<SessionPtr> get_sessions() const = 0;
+};
+
+/// 依次在多个传输里查找；只在启动阶段 add，之后只读
+class CompositeSessionLookup : public SessionLookup {
+public:
+    void add(const SessionLookup* lookup) {
+        if (lookup) {
+            lookups_.push_back(lookup);
+        }
+    }
+
+    SessionPtr get_session(const std::string& session_id) const override {
+        for (const auto* lookup : lookups_) {
+            if (auto session = lookup->get_session(session_id)) {
+                return session;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<SessionPtr> get_sessions() const override {
+        std::vector<SessionPtr> sessions;
+        for (const auto* lookup : lookups_) {
+            auto part = lookup->get_sessions();
+            sessions.insert(sessions.end(), std::make_move_iterator(part.begin()),
+                            std::make_move_iterator(part.end()));
+        }
+        return sessions;
+    }
+
+private:
+    std::vector<const SessionLookup*> lookups_;
+};
+
+} // namespace network
+} // namespace im
+
+#endif  // CLIENT_SESSION_HPP
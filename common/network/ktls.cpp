@@ -0,0 +1,200 @@
+#include "ktls.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include <openssl/crypto.h>
+#include <openssl/evp.h>
+#include <openssl/objects.h>
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#include <openssl/kdf.h>
+#include <openssl/params.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/tls.h>)
+#include <linux/tls.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#define IM_HAVE_KTLS 1
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif
+
+namespace im {
+namespace network {
+
+#if defined(IM_HAVE_KTLS) && OPENSSL_VERSION_NUMBER >= 0x30000000L
+
+namespace {
+
+constexpr size_t kFixedIvSize = 4;  // TLS 1.2 AES-GCM 的隐式 nonce（salt）
+
+// 握手阶段双方各发过一条加密记录（Finished），应用数据从序号 1 开始
+constexpr uint64_t kFirstApplicationSeq = 1;
+
+void store_be64(unsigned char* out, uint64_t value) {
+    for (int i = 7; i >= 0; --i) {
+        out[i] = static_cast<unsigned char>(value & 0xff);
+        value >>= 8;
+    }
+}
+
+// TLS 1.2 key block = PRF(master_secret, "key expansion", server_random + client_random)
+bool derive_key_block(SSL* ssl, const EVP_MD* prf_digest, unsigned char* out, size_t len) {
+    unsigned char master[SSL_MAX_MASTER_KEY_LENGTH];
+    size_t master_len = SSL_SESSION_get_master_key(SSL_get_session(ssl), master, sizeof(master));
+    unsigned char randoms[SSL3_RANDOM_SIZE * 2];
+    if (master_len == 0 ||
+        SSL_get_server_random(ssl, randoms, SSL3_RANDOM_SIZE) != SSL3_RANDOM_SIZE ||
+        SSL_get_client_random(ssl, randoms + SSL3_RANDOM_SIZE, SSL3_RANDOM_SIZE) !=
+                SSL3_RANDOM_SIZE) {
+        OPENSSL_cleanse(master, sizeof(master));
+        return false;
+    }
+
+    EVP_KDF* kdf = EVP_KDF_fetch(nullptr, "TLS1-PRF", nullptr);
+    EVP_KDF_CTX* kctx = kdf ? EVP_KDF_CTX_new(kdf) : nullptr;
+    EVP_KDF_free(kdf);
+    bool ok = false;
+    if (kctx) {
+        static const char kLabel[] = "key expansion";
+        OSSL_PARAM params[] = {
+                OSSL_PARAM_construct_utf8_string(
+                        OSSL_KDF_PARAM_DIGEST, const_cast<char*>(EVP_MD_get0_name(prf_digest)), 0),
+                OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_SECRET, master, master_len),
+                // 多个 SEED 参数按顺序拼接
+                OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_SEED,
+                                                  const_cast<char*>(kLabel), sizeof(kLabel) - 1),
+                OSSL_PARAM_construct_octet_string(OSSL_KDF_PARAM_SEED, randoms, sizeof(randoms)),
+                OSSL_PARAM_construct_end(),
+        };
+        ok = EVP_KDF_derive(kctx, out, len, params) == 1;
+        EVP_KDF_CTX_free(kctx);
+    }
+    OPENSSL_cleanse(master, sizeof(master));
+    return ok;
+}
+
+template <typename CryptoInfo>
+bool install_direction(int fd, int direction, uint16_t cipher_type, const unsigned char* key,
+                       const unsigned char* salt) {
+    CryptoInfo info{};
+    info.info.version = TLS_1_2_VERSION;
+    info.info.cipher_type = cipher_type;
+    std::memcpy(info.key, key, sizeof(info.key));
+    std::memcpy(info.salt, salt, sizeof(info.salt));
+    // 显式 nonce 只要求不重复，直接用记录序号
+    store_be64(info.iv, kFirstApplicationSeq);
+    store_be64(info.rec_seq, kFirstApplicationSeq);
+    int rc = setsockopt(fd, SOL_TLS, direction, &info, sizeof(info));
+    OPENSSL_cleanse(&info, sizeof(info));
+    return rc == 0;
+}
+
+template <typename CryptoInfo>
+KtlsResult install(int fd, uint16_t cipher_type, const unsigned char* key_block, size_t key_size,
+                   std::string& reason) {
+    const unsigned char* client_key = key_block;
+    const unsigned char* server_key = client_key + key_size;
+    const unsigned char* client_salt = server_key + key_size;
+    const unsigned char* server_salt = client_salt + kFixedIvSize;
+
+    if (setsockopt(fd, SOL_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+        reason = "kernel tls ULP unavailable";
+        return KtlsResult::Fallback;
+    }
+    // 先装接收方向：失败时发送方向仍在用户态，连接可以继续用 OpenSSL
+    if (!install_direction<CryptoInfo>(fd, TLS_RX, cipher_type, client_key, client_salt)) {
+        reason = "kernel rejected TLS_RX";
+        return KtlsResult::Fallback;
+    }
+    if (!install_direction<CryptoInfo>(fd, TLS_TX, cipher_type, server_key, server_salt)) {
+        reason = "kernel rejected TLS_TX after TLS_RX";
+        return KtlsResult::Broken;
+    }
+    return KtlsResult::Enabled;
+}
+
+} // anonymous namespace
+
+KtlsResult enable_ktls(SSL* ssl, int fd, std::string& reason) {
+    if (SSL_version(ssl) != TLS1_2_VERSION) {
+        reason = "only TLS 1.2 is supported";
+        return KtlsResult::Fallback;
+    }
+    // OpenSSL 手里还有未交付的数据时序号已经前进，不能切换
+    if (SSL_has_pending(ssl) || BIO_ctrl_pending(SSL_get_rbio(ssl)) > 0 ||
+        BIO_ctrl_wpending(SSL_get_wbio(ssl)) > 0) {
+        reason = "TLS records pending in userspace";
+        return KtlsResult::Fallback;
+    }
+
+    const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+    const EVP_MD* prf_digest = cipher ? SSL_CIPHER_get_handshake_digest(cipher) : nullptr;
+    const int cipher_nid = cipher ? SSL_CIPHER_get_cipher_nid(cipher) : NID_undef;
+    size_t key_size = 0;
+    if (cipher_nid == NID_aes_128_gcm) {
+        key_size = TLS_CIPHER_AES_GCM_128_KEY_SIZE;
+    } else if (cipher_nid == NID_aes_256_gcm) {
+        key_size = TLS_CIPHER_AES_GCM_256_KEY_SIZE;
+    }
+    if (key_size == 0 || !prf_digest) {
+        reason = std::string("unsupported cipher ") + (cipher ? SSL_CIPHER_get_name(cipher) : "none");
+        return KtlsResult::Fallback;
+    }
+
+    unsigned char key_block[2 * TLS_CIPHER_AES_GCM_256_KEY_SIZE + 2 * kFixedIvSize];
+    if (!derive_key_block(ssl, prf_digest, key_block, 2 * key_size + 2 * kFixedIvSize)) {
+        reason = "key block derivation failed";
+        return KtlsResult::Fallback;
+    }
+
+    KtlsResult result =
+            key_size == TLS_CIPHER_AES_GCM_128_KEY_SIZE
+                    ? install<tls12_crypto_info_aes_gcm_128>(fd, TLS_CIPHER_AES_GCM_128, key_block,
+                                                             key_size, reason)
+                    : install<tls12_crypto_info_aes_gcm_256>(fd, TLS_CIPHER_AES_GCM_256, key_block,
+                                                             key_size, reason);
+    OPENSSL_cleanse(key_block, sizeof(key_block));
+    return result;
+}
+
+void send_ktls_close_notify(int fd) {
+    const unsigned char alert[2] = {1 /* warning */, 0 /* close_notify */};
+    char control[CMSG_SPACE(sizeof(unsigned char))] = {};
+    iovec iov{const_cast<unsigned char*>(alert), sizeof(alert)};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_TLS;
+    cmsg->cmsg_type = TLS_SET_RECORD_TYPE;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(unsigned char));
+    *CMSG_DATA(cmsg) = 21;  // alert
+
+    (void)sendmsg(fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+}
+
+#else
+
+KtlsResult enable_ktls(SSL* /*ssl*/, int /*fd*/, std::string& reason) {
+    reason = "kTLS requires Linux and OpenSSL 3";
+    return KtlsResult::Fallback;
+}
+
+void send_ktls_close_notify(int /*fd*/) {}
+
+#endif
+
+} // namespace network
+} // namespace im
@@ -0,0 +1,50 @@
+#ifndef KTLS_HPP
+#define KTLS_HPP
+
+/******************************************************************************
+ *
+ * @file       ktls.hpp
+ * @brief      握手完成后把 TLS 记录加解密交给内核（Linux kTLS）
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * ssl::stream 在内存 BIO 上驱动 OpenSSL，OpenSSL 自带的 kTLS（SSL_OP_ENABLE_KTLS）
+ * 只对 socket BIO 生效，所以这里在握手结束后自行导出密钥：用主密钥和双方随机数
+ * 按 TLS 1.2 PRF 推导 key block，通过 setsockopt(TCP_ULP "tls") + TLS_RX/TLS_TX
+ * 装进内核。之后 socket 上直接读写明文，内核负责封装记录。
+ *
+ * 支持范围：TLS 1.2 + AES-128/256-GCM，需要 OpenSSL 3 和支持 TLS_RX 的内核
+ * （4.17+）。其他情况返回 Fallback，连接继续走用户态加密。
+ *
+ *****************************************************************************/
+
+#include <string>
+
+#include <openssl/ssl.h>
+
+namespace im {
+namespace network {
+
+enum class KtlsResult {
+    Enabled,   // 收发两个方向都已交给内核
+    Fallback,  // 未做任何改动，继续使用 OpenSSL
+    Broken,    // 接收方向已交给内核但发送方向失败，连接只能关闭
+};
+
+/**
+ * @brief 在刚完成握手、尚未收发应用数据的连接上启用 kTLS
+ *
+ * @param ssl    握手完成的 SSL 对象
+ * @param fd     底层 TCP socket
+ * @param reason Fallback / Broken 时填写原因
+ */
+KtlsResult enable_ktls(SSL* ssl, int fd, std::string& reason);
+
+/// kTLS 连接上发送 close_notify 告警；失败忽略
+void send_ktls_close_notify(int fd);
+
+} // namespace network
+} // namespace im
+
+#endif // KTLS_HPP
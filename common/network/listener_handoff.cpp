@@ -0,0 +1,278 @@
+#include "listener_handoff.hpp"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string_view>
+
+namespace im {
+namespace network {
+
+namespace {
+
+constexpr std::size_t kMaxListeners = 8;
+constexpr char kConfirmByte = 'R';
+// 旧进程 accept 后立即发送，正常情况下毫秒级就能收到
+constexpr int kReceiveTimeoutSec = 5;
+
+std::string errno_message(const char* what) {
+    return std::string(what) + ": " + std::strerror(errno);
+}
+
+bool make_address(const std::string& path, sockaddr_un& addr, std::string& error) {
+    if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+        error = "invalid handoff socket path: " + path;
+        return false;
+    }
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+void close_fd(int& fd) {
+    if (fd >= 0) {
+        ::close(fd);
+        fd = -1;
+    }
+}
+
+} // anonymous namespace
+
+ListenerHandoffServer::ListenerHandoffServer(std::string path, std::chrono::seconds confirm_timeout)
+        : path_(std::move(path)), confirm_timeout_(confirm_timeout) {}
+
+ListenerHandoffServer::~ListenerHandoffServer() { stop(); }
+
+bool ListenerHandoffServer::start(ListenersProvider listeners, HandedOffCallback on_handed_off,
+                                  std::string& error) {
+    sockaddr_un addr{};
+    if (!make_address(path_, addr, error)) {
+        return false;
+    }
+    if (::pipe2(wake_fds_, O_CLOEXEC) != 0) {
+        error = errno_message("pipe2");
+        return false;
+    }
+    listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) {
+        error = errno_message("socket");
+        stop();
+        return false;
+    }
+    // 上一个进程交接后不删除路径，由接手的进程删掉重建
+    ::unlink(path_.c_str());
+    if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listen_fd_, 1) != 0) {
+        error = errno_message("bind handoff socket");
+        stop();
+        return false;
+    }
+
+    listeners_ = std::move(listeners);
+    on_handed_off_ = std::move(on_handed_off);
+    thread_ = std::thread([this] { run(); });
+    return true;
+}
+
+void ListenerHandoffServer::stop() {
+    stopping_.store(true, std::memory_order_release);
+    if (wake_fds_[1] >= 0) {
+        const char byte = 0;
+        (void)::write(wake_fds_[1], &byte, 1);
+    }
+    if (thread_.joinable() && thread_.get_id() != std::this_thread::get_id()) {
+        thread_.join();
+    }
+    if (listen_fd_ >= 0) {
+        close_fd(listen_fd_);
+        if (!handed_off()) {
+            ::unlink(path_.c_str());
+        }
+    }
+    close_fd(wake_fds_[0]);
+    close_fd(wake_fds_[1]);
+}
+
+bool ListenerHandoffServer::wait_readable(int fd, int timeout_ms) {
+    pollfd fds[2] = {{fd, POLLIN, 0}, {wake_fds_[0], POLLIN, 0}};
+    for (;;) {
+        const int rc = ::poll(fds, 2, timeout_ms);
+        if (rc < 0 && errno == EINTR) {
+            continue;
+        }
+        return rc > 0 && fds[1].revents == 0 && fds[0].revents != 0 &&
+               !stopping_.load(std::memory_order_acquire);
+    }
+}
+
+void ListenerHandoffServer::run() {
+    while (!stopping_.load(std::memory_order_acquire)) {
+        if (!wait_readable(listen_fd_, -1)) {
+            continue;
+        }
+        int conn_fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (conn_fd < 0) {
+            continue;
+        }
+        const bool done = serve_one(conn_fd);
+        ::close(conn_fd);
+        if (done) {
+            handed_off_.store(true, std::memory_order_release);
+            if (on_handed_off_) {
+                on_handed_off_();
+            }
+            return;
+        }
+    }
+}
+
+bool ListenerHandoffServer::serve_one(int conn_fd) {
+    std::vector<HandoffListener> listeners = listeners_ ? listeners_() : std::vector<HandoffListener>{};
+    if (listeners.empty() || listeners.size() > kMaxListeners) {
+        return false;
+    }
+
+    std::string names;
+    for (const auto& listener : listeners) {
+        names += listener.name;
+        names += '\n';
+    }
+
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * kMaxListeners)] = {};
+    iovec iov{names.data(), names.size()};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = CMSG_SPACE(sizeof(int) * listeners.size());
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(int) * listeners.size());
+    int* fds = reinterpret_cast<int*>(CMSG_DATA(cmsg));
+    for (std::size_t i = 0; i < listeners.size(); ++i) {
+        fds[i] = listeners[i].fd;
+    }
+
+    if (::sendmsg(conn_fd, &msg, MSG_NOSIGNAL) != static_cast<ssize_t>(names.size())) {
+        return false;
+    }
+
+    // 新进程初始化（连数据库、加载配置）可能较慢，确认之前本进程照常 accept
+    const auto timeout_ms = static_cast<int>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(confirm_timeout_).count());
+    if (!wait_readable(conn_fd, timeout_ms)) {
+        return false;
+    }
+    char byte = 0;
+    return ::read(conn_fd, &byte, 1) == 1 && byte == kConfirmByte;
+}
+
+ListenerHandoffClient::~ListenerHandoffClient() { close_all(); }
+
+void ListenerHandoffClient::close_all() {
+    for (auto& listener : listeners_) {
+        close_fd(listener.fd);
+    }
+    listeners_.clear();
+    close_fd(conn_fd_);
+}
+
+bool ListenerHandoffClient::connect(const std::string& path, std::string& error) {
+    error.clear();
+    close_all();
+
+    sockaddr_un addr{};
+    if (!make_address(path, addr, error)) {
+        return false;
+    }
+    conn_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (conn_fd_ < 0) {
+        error = errno_message("socket");
+        return false;
+    }
+    if (::connect(conn_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        // 路径不存在或没有进程在监听：没有可接手的旧进程
+        if (errno != ENOENT && errno != ECONNREFUSED) {
+            error = errno_message("connect handoff socket");
+        }
+        close_fd(conn_fd_);
+        return false;
+    }
+
+    timeval timeout{kReceiveTimeoutSec, 0};
+    ::setsockopt(conn_fd_, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    char names[1024];
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * kMaxListeners)] = {};
+    iovec iov{names, sizeof(names)};
+    msghdr msg{};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    const ssize_t n = ::recvmsg(conn_fd_, &msg, MSG_CMSG_CLOEXEC);
+    std::vector<int> fds;
+    for (cmsghdr* cmsg = n > 0 ? CMSG_FIRSTHDR(&msg) : nullptr; cmsg;
+         cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+            const std::size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            const int* data = reinterpret_cast<const int*>(CMSG_DATA(cmsg));
+            fds.insert(fds.end(), data, data + count);
+        }
+    }
+
+    std::size_t begin = 0;
+    const std::string_view text(names, n > 0 ? static_cast<std::size_t>(n) : 0);
+    for (int fd : fds) {
+        const std::size_t end = text.find('\n', begin);
+        std::string name = end == std::string_view::npos ? std::string{}
+                                                         : std::string(text.substr(begin, end - begin));
+        begin = end == std::string_view::npos ? text.size() : end + 1;
+        listeners_.push_back({std::move(name), fd});
+    }
+
+    if (n <= 0 || (msg.msg_flags & (MSG_CTRUNC | MSG_TRUNC)) != 0 || listeners_.empty() ||
+        listeners_.back().name.empty()) {
+        error = n < 0 ? errno_message("receive listeners") : "malformed listener handoff";
+        close_all();
+        return false;
+    }
+    return true;
+}
+
+int ListenerHandoffClient::take(const std::string& name) {
+    for (auto& listener : listeners_) {
+        if (listener.name == name && listener.fd >= 0) {
+            const int fd = listener.fd;
+            listener.fd = -1;
+            return fd;
+        }
+    }
+    return -1;
+}
+
+bool ListenerHandoffClient::confirm(std::string& error) {
+    if (conn_fd_ < 0) {
+        error = "no handoff in progress";
+        return false;
+    }
+    const char byte = kConfirmByte;
+    const bool ok = ::send(conn_fd_, &byte, 1, MSG_NOSIGNAL) == 1;
+    if (!ok) {
+        error = errno_message("confirm handoff");
+    }
+    close_all();
+    return ok;
+}
+
+} // namespace network
+} // namespace im
@@ -0,0 +1,124 @@
+#ifndef LISTENER_HANDOFF_HPP
+#define LISTENER_HANDOFF_HPP
+
+/******************************************************************************
+ *
+ * @file       listener_handoff.hpp
+ * @brief      热重启：旧进程通过 Unix 域套接字（SCM_RIGHTS）把监听 socket 交给新进程
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * 流程：
+ * 1. 旧进程在约定路径上运行 ListenerHandoffServer。
+ * 2. 新进程启动时用 ListenerHandoffClient 连上该路径，收到监听 socket 的副本
+ *    （名字 + fd），直接在上面 accept，不重新 bind。此时两个进程共用同一个监听
+ *    socket，accept 不会中断。
+ * 3. 新进程启动成功后 confirm()，旧进程收到确认才停止 accept、开始排空连接。
+ *    新进程在确认前退出时连接断开，旧进程照常服务，等待下一次交接。
+ *
+ * 一次交接只有一条消息：正文为以 '\n' 分隔的名字，辅助数据按相同顺序携带 fd。
+ * 确认是一个字节。路径上没有进程监听时 connect() 返回 false 且 error 为空，
+ * 新进程按普通启动处理。
+ *
+ *****************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace im {
+namespace network {
+
+struct HandoffListener {
+    std::string name;  // 如 "ws"、"tcp"
+    int fd = -1;
+};
+
+/**
+ * @brief 旧进程侧：等待新进程来取监听 socket
+ *
+ * 在独立线程里阻塞 accept，同一时间只处理一个新进程。交给对方的是 fd 副本，
+ * 本进程的监听 socket 保持不变，停止 accept 由 on_handed_off 回调负责。
+ */
+class ListenerHandoffServer {
+public:
+    using ListenersProvider = std::function<std::vector<HandoffListener>()>;
+    using HandedOffCallback = std::function<void()>;
+
+    explicit ListenerHandoffServer(std::string path,
+                                   std::chrono::seconds confirm_timeout = std::chrono::seconds(120));
+    ~ListenerHandoffServer();
+
+    ListenerHandoffServer(const ListenerHandoffServer&) = delete;
+    ListenerHandoffServer& operator=(const ListenerHandoffServer&) = delete;
+
+    /**
+     * @brief 绑定路径并开始等待；路径上的旧 socket 文件会先被删除
+     * @param listeners 每次有新进程连上时调用，返回要交出的监听 socket（fd 仍归调用方）
+     * @param on_handed_off 新进程确认后在交接线程上调用一次，之后不再接受交接
+     */
+    bool start(ListenersProvider listeners, HandedOffCallback on_handed_off, std::string& error);
+
+    /// 停止等待；未交接时顺带删除路径
+    void stop();
+
+    bool handed_off() const { return handed_off_.load(std::memory_order_acquire); }
+
+private:
+    void run();
+    bool serve_one(int conn_fd);
+    bool wait_readable(int fd, int timeout_ms);
+
+    std::string path_;
+    std::chrono::seconds confirm_timeout_;
+    ListenersProvider listeners_;
+    HandedOffCallback on_handed_off_;
+    int listen_fd_ = -1;
+    int wake_fds_[2] = {-1, -1};  // stop() 写入，唤醒阻塞中的 poll
+    std::thread thread_;
+    std::atomic<bool> stopping_{false};
+    std::atomic<bool> handed_off_{false};
+};
+
+/**
+ * @brief 新进程侧：从旧进程取监听 socket，启动完成后确认
+ *
+ * 析构时关闭未被 take() 取走的 fd；未 confirm() 就析构等同于放弃交接。
+ */
+class ListenerHandoffClient {
+public:
+    ListenerHandoffClient() = default;
+    ~ListenerHandoffClient();
+
+    ListenerHandoffClient(const ListenerHandoffClient&) = delete;
+    ListenerHandoffClient& operator=(const ListenerHandoffClient&) = delete;
+
+    /**
+     * @brief 连接旧进程并接收监听 socket
+     * @return 收到时返回 true；没有旧进程时返回 false 且 error 为空
+     */
+    bool connect(const std::string& path, std::string& error);
+
+    bool connected() const { return conn_fd_ >= 0; }
+
+    /// 取出指定名字的 fd 并转移所有权，没有时返回 -1
+    int take(const std::string& name);
+
+    /// 通知旧进程停止 accept 并开始排空
+    bool confirm(std::string& error);
+
+private:
+    void close_all();
+
+    int conn_fd_ = -1;
+    std::vector<HandoffListener> listeners_;
+};
+
+} // namespace network
+} // namespace im
+
+#endif  // LISTENER_HANDOFF_HPP
@@ -0,0 +1,105 @@
+#include "message_type_registry.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace im {
+namespace network {
+
+namespace {
+
+template <typename Tuple>
+struct WireTypeIdList;
+
+template <typename... Ts>
+struct WireTypeIdList<std::tuple<Ts...>> {
+    static constexpr std::array<uint32_t, sizeof...(Ts)> value{wire_type_id_v<Ts>...};
+};
+
+template <std::size_t N>
+constexpr bool ids_valid(const std::array<uint32_t, N>& ids) {
+    for (std::size_t i = 0; i < N; ++i) {
+        if (ids[i] == 0) {
+            return false;
+        }
+        for (std::size_t j = i + 1; j < N; ++j) {
+            if (ids[i] == ids[j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(ids_valid(WireTypeIdList<WireMessageTypes>::value),
+              "wire message type ids must be non-zero and unique");
+
+struct WireTypeEntry {
+    uint32_t id = 0;
+    const google::protobuf::Descriptor* descriptor = nullptr;
+    const google::protobuf::Message* prototype = nullptr;
+    std::string_view name;
+};
+
+struct WireTypeTable {
+    std::vector<WireTypeEntry> entries;
+    // 编号都很小，直接按编号下标查
+    std::vector<const WireTypeEntry*> by_id;
+};
+
+template <typename... Ts>
+WireTypeTable build_table(std::tuple<Ts...>*) {
+    WireTypeTable table;
+    table.entries = {WireTypeEntry{wire_type_id_v<Ts>, Ts::descriptor(), &Ts::default_instance(),
+                                   Ts::descriptor()->full_name()}...};
+    const uint32_t max_id = std::max({wire_type_id_v<Ts>...});
+    table.by_id.assign(max_id + 1, nullptr);
+    for (const auto& entry : table.entries) {
+        table.by_id[entry.id] = &entry;
+    }
+    return table;
+}
+
+const WireTypeTable& table() {
+    static const WireTypeTable instance = build_table(static_cast<WireMessageTypes*>(nullptr));
+    return instance;
+}
+
+const WireTypeEntry* find_by_id(uint32_t type_id) {
+    const auto& by_id = table().by_id;
+    return type_id < by_id.size() ? by_id[type_id] : nullptr;
+}
+
+}  // namespace
+
+uint32_t MessageTypeRegistry::id_of(const google::protobuf::Descriptor* descriptor) {
+    for (const auto& entry : table().entries) {
+        if (entry.descriptor == descriptor) {
+            return entry.id;
+        }
+    }
+    return 0;
+}
+
+uint32_t MessageTypeRegistry::id_of(std::string_view type_name) {
+    for (const auto& entry : table().entries) {
+        if (entry.name == type_name) {
+            return entry.id;
+        }
+    }
+    return 0;
+}
+
+std::string_view MessageTypeRegistry::name_of(uint32_t type_id) {
+    const auto* entry = find_by_id(type_id);
+    return entry ? entry->name : std::string_view{};
+}
+
+const google::protobuf::Message* MessageTypeRegistry::prototype(uint32_t type_id) {
+    const auto* entry = find_by_id(type_id);
+    return entry ? entry->prototype : nullptr;
+}
+
+}  // namespace network
+}  // namespace im
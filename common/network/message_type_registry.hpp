@@ -0,0 +1,94 @@
+#ifndef MESSAGE_TYPE_REGISTRY_HPP
+#define MESSAGE_TYPE_REGISTRY_HPP
+
+/******************************************************************************
+ *
+ * @file       message_type_registry.hpp
+ * @brief      v2 帧使用的消息类型编号表
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * 类型编号在编译期登记：IM_WIRE_MESSAGE_TYPE(类型, 编号) 特化 WireTypeId，
+ * 处理器可以直接写 wire_type_id_v<SendMessageRequest> 和解析结果比较整数；
+ * 没有登记的类型取编号时编译失败。编号一旦发布不可复用，0 表示未登记。
+ *
+ * 运行期查询（按编号取类型名/默认实例，按 Descriptor 或类型名取编号）
+ * 由 MessageTypeRegistry 提供，表在首次使用时由 WireMessageTypes 展开生成。
+ *
+ *****************************************************************************/
+
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+
+#include <google/protobuf/message.h>
+
+#include "../proto/base.pb.h"
+#include "../proto/message.pb.h"
+#include "../proto/push.pb.h"
+
+namespace im {
+namespace network {
+
+template <typename T>
+struct WireTypeId;  // 仅声明：未登记的类型无法取得编号
+
+#define IM_WIRE_MESSAGE_TYPE(TYPE, ID)                   \
+    template <>                                          \
+    struct WireTypeId<TYPE> {                            \
+        static constexpr uint32_t value = ID;            \
+    }
+
+// 1 ~ 15：im.base
+IM_WIRE_MESSAGE_TYPE(im::base::BaseRequest, 1);
+IM_WIRE_MESSAGE_TYPE(im::base::BaseResponse, 2);
+IM_WIRE_MESSAGE_TYPE(im::base::FrameBatch, 3);
+// 16 ~ 31：im.message
+IM_WIRE_MESSAGE_TYPE(im::message::SendMessageRequest, 16);
+IM_WIRE_MESSAGE_TYPE(im::message::SendMessageResponse, 17);
+IM_WIRE_MESSAGE_TYPE(im::message::MarkMessageDeliveredRequest, 18);
+IM_WIRE_MESSAGE_TYPE(im::message::MarkMessageDeliveredResponse, 19);
+// 32 ~ 47：im.push
+IM_WIRE_MESSAGE_TYPE(im::push::PushRequest, 32);
+IM_WIRE_MESSAGE_TYPE(im::push::PushResponse, 33);
+IM_WIRE_MESSAGE_TYPE(im::push::PushBatchRequest, 34);
+IM_WIRE_MESSAGE_TYPE(im::push::PresenceNotifyRequest, 35);
+
+#undef IM_WIRE_MESSAGE_TYPE
+
+template <typename T>
+inline constexpr uint32_t wire_type_id_v = WireTypeId<T>::value;
+
+/// 所有登记过的类型，新增类型时同时加到这里
+using WireMessageTypes = std::tuple<im::base::BaseRequest,
+                                    im::base::BaseResponse,
+                                    im::base::FrameBatch,
+                                    im::message::SendMessageRequest,
+                                    im::message::SendMessageResponse,
+                                    im::message::MarkMessageDeliveredRequest,
+                                    im::message::MarkMessageDeliveredResponse,
+                                    im::push::PushRequest,
+                                    im::push::PushResponse,
+                                    im::push::PushBatchRequest,
+                                    im::push::PresenceNotifyRequest>;
+
+class MessageTypeRegistry {
+public:
+    /// 按 Descriptor 查编号（指针比较），未登记返回 0
+    static uint32_t id_of(const google::protobuf::Descriptor* descriptor);
+
+    /// 按类型全名查编号，用于 v1 帧；未登记返回 0
+    static uint32_t id_of(std::string_view type_name);
+
+    /// 编号对应的类型全名，未登记返回空
+    static std::string_view name_of(uint32_t type_id);
+
+    /// 编号对应的默认实例，可用 New(arena) 创建消息；未登记返回 nullptr
+    static const google::protobuf::Message* prototype(uint32_t type_id);
+};
+
+}  // namespace network
+}  // namespace im
+
+#endif  // MESSAGE_TYPE_REGISTRY_HPP
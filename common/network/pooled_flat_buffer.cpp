@@ -0,0 +1,53 @@
+#include "pooled_flat_buffer.hpp"
+
+#include <vector>
+
+namespace im {
+namespace network {
+
+namespace {
+
+// 每个 I/O 线程同时在读帧的会话不多，留几十个足够
+constexpr std::size_t kMaxPooledBuffers = 64;
+// 大帧留下的缓冲不回池，避免把峰值容量长期挂在池里
+constexpr std::size_t kMaxPooledCapacity = 64 * 1024;
+
+std::vector<std::unique_ptr<boost::beast::flat_buffer>>& thread_pool() {
+    thread_local std::vector<std::unique_ptr<boost::beast::flat_buffer>> pool;
+    return pool;
+}
+
+} // anonymous namespace
+
+PooledFlatBuffer::buffer_type& PooledFlatBuffer::get() {
+    if (!buffer_) {
+        auto& pool = thread_pool();
+        if (pool.empty()) {
+            buffer_ = std::make_unique<buffer_type>();
+        } else {
+            buffer_ = std::move(pool.back());
+            pool.pop_back();
+        }
+    }
+    return *buffer_;
+}
+
+void PooledFlatBuffer::release() noexcept {
+    if (!buffer_) {
+        return;
+    }
+    auto& pool = thread_pool();
+    if (buffer_->capacity() > kMaxPooledCapacity || pool.size() >= kMaxPooledBuffers) {
+        buffer_.reset();
+        return;
+    }
+    buffer_->clear();
+    try {
+        pool.push_back(std::move(buffer_));
+    } catch (...) {
+        buffer_.reset();
+    }
+}
+
+} // namespace network
+} // namespace im
@@ -0,0 +1,93 @@
+#ifndef POOLED_FLAT_BUFFER_HPP
+#define POOLED_FLAT_BUFFER_HPP
+
+/******************************************************************************
+ *
+ * @file       pooled_flat_buffer.hpp
+ * @brief      只在一帧读取期间持有内存的读缓冲
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * 满足 DynamicBuffer 要求，可直接交给 websocket::stream::async_read 和
+ * http::async_read。第一次 prepare 时从当前线程的缓冲池借一个 flat_buffer，
+ * 数据被 consume 干净后还回去；空闲连接只剩一个空指针。
+ *
+ * 池按线程划分，会话的读回调总在同一个 io_context 线程上，借还无需加锁。
+ * 池里的缓冲保留容量，下一帧不再重新分配；超过上限的大缓冲直接释放。
+ *
+ *****************************************************************************/
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+
+#include <boost/beast/core/flat_buffer.hpp>
+
+namespace im {
+namespace network {
+
+class PooledFlatBuffer {
+public:
+    using buffer_type = boost::beast::flat_buffer;
+    using const_buffers_type = buffer_type::const_buffers_type;
+    using mutable_buffers_type = buffer_type::mutable_buffers_type;
+
+    PooledFlatBuffer() = default;
+    ~PooledFlatBuffer() { release(); }
+
+    PooledFlatBuffer(const PooledFlatBuffer&) = delete;
+    PooledFlatBuffer& operator=(const PooledFlatBuffer&) = delete;
+
+    std::size_t size() const noexcept { return buffer_ ? buffer_->size() : 0; }
+
+    std::size_t max_size() const noexcept {
+        return buffer_ ? buffer_->max_size() : (std::numeric_limits<std::size_t>::max)();
+    }
+
+    std::size_t capacity() const noexcept { return buffer_ ? buffer_->capacity() : 0; }
+
+    const_buffers_type data() const noexcept {
+        return buffer_ ? buffer_->data() : const_buffers_type{};
+    }
+
+    const_buffers_type cdata() const noexcept { return data(); }
+
+    mutable_buffers_type data() noexcept {
+        return buffer_ ? buffer_->data() : mutable_buffers_type{};
+    }
+
+    mutable_buffers_type prepare(std::size_t n) { return get().prepare(n); }
+
+    void commit(std::size_t n) noexcept {
+        if (buffer_) {
+            buffer_->commit(n);
+        }
+    }
+
+    /// 读空后把缓冲还给线程池
+    void consume(std::size_t n) noexcept {
+        if (!buffer_) {
+            return;
+        }
+        buffer_->consume(n);
+        if (buffer_->size() == 0) {
+            release();
+        }
+    }
+
+    /// 取出底层 flat_buffer（没有时借一个），用于交给按 flat_buffer 声明的回调
+    buffer_type& get();
+
+    bool borrowed() const noexcept { return buffer_ != nullptr; }
+
+    void release() noexcept;
+
+private:
+    std::unique_ptr<buffer_type> buffer_;
+};
+
+} // namespace network
+} // namespace im
+
+#endif // POOLED_FLAT_BUFFER_HPP
@@ -0,0 +1,257 @@
+#include "protobuf_arena_pool.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace im {
+namespace network {
+
+namespace {
+
+google::protobuf::ArenaOptions arena_options(char* block, std::size_t size) {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = size;
+    options.start_block_size = size;
+    return options;
+}
+
+}  // namespace
+
+struct ArenaSlot {
+    explicit ArenaSlot(std::size_t size)
+        : block_size(size),
+          block(new char[size]),
+          arena(arena_options(block.get(), size)) {}
+
+    const std::size_t block_size;
+    std::unique_ptr<char[]> block;
+    google::protobuf::Arena arena;  // 必须在 block 之后声明、之前析构
+};
+
+// ==================== PooledArena ====================
+
+PooledArena::PooledArena() noexcept = default;
+
+PooledArena::PooledArena(ArenaPool* pool, std::unique_ptr<ArenaSlot> slot) noexcept
+    : pool_(pool), slot_(std::move(slot)) {}
+
+PooledArena::~PooledArena() { reset(); }
+
+PooledArena::PooledArena(PooledArena&& other) noexcept
+    : pool_(other.pool_), slot_(std::move(other.slot_)) {
+    other.pool_ = nullptr;
+}
+
+PooledArena& PooledArena::operator=(PooledArena&& other) noexcept {
+    if (this != &other) {
+        reset();
+        pool_ = other.pool_;
+        slot_ = std::move(other.slot_);
+        other.pool_ = nullptr;
+    }
+    return *this;
+}
+
+google::protobuf::Arena* PooledArena::get() const noexcept {
+    return slot_ ? &slot_->arena : nullptr;
+}
+
+void PooledArena::reset() noexcept {
+    if (slot_ && pool_) {
+        pool_->release(std::move(slot_));
+    }
+    slot_.reset();
+    pool_ = nullptr;
+}
+
+// ==================== ArenaPool ====================
+
+struct ArenaPool::Central {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ArenaSlot>> free;
+    std::atomic<std::size_t> pooled{0};     // 中心与各线程缓存里的空闲 arena 总数
+    std::atomic<uint64_t> transfers{0};
+};
+
+namespace {
+
+/// 一个线程为某个池缓存的空闲 arena。
+struct LocalSlots {
+    ArenaPool::Central* key = nullptr;
+    std::weak_ptr<ArenaPool::Central> owner;
+    std::vector<std::unique_ptr<ArenaSlot>> slots;
+};
+
+void spill_to_central(ArenaPool::Central& central,
+                      std::vector<std::unique_ptr<ArenaSlot>>& slots,
+                      std::size_t n,
+                      std::size_t max_pooled) {
+    central.transfers.fetch_add(1, std::memory_order_relaxed);
+    std::size_t dropped = 0;
+    {
+        std::lock_guard<std::mutex> lock(central.mutex);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (central.free.size() < max_pooled) {
+                central.free.push_back(std::move(slots.back()));
+            } else {
+                ++dropped;
+            }
+            slots.pop_back();
+        }
+    }
+    central.pooled.fetch_sub(dropped, std::memory_order_relaxed);
+}
+
+class ThreadCache {
+public:
+    ~ThreadCache();
+
+    /// 取当前线程为 central 准备的缓存；池已销毁的旧条目顺带清掉。
+    std::vector<std::unique_ptr<ArenaSlot>>& slots_for(
+        const std::shared_ptr<ArenaPool::Central>& central) {
+        for (auto& entry : entries_) {
+            if (entry.key == central.get() && !entry.owner.expired()) {
+                return entry.slots;
+            }
+        }
+        std::erase_if(entries_, [](const LocalSlots& entry) { return entry.owner.expired(); });
+        entries_.push_back(LocalSlots{central.get(), central, {}});
+        entries_.back().slots.reserve(ArenaPool::kThreadCacheSlots + 1);
+        return entries_.back().slots;
+    }
+
+private:
+    std::vector<LocalSlots> entries_;
+};
+
+thread_local ThreadCache tls_cache;
+thread_local bool tls_cache_destroyed = false;
+
+ThreadCache::~ThreadCache() {
+    // 线程退出时把缓存全部挂回仍存在的池，不受 max_pooled 限制，避免丢弃刚暖好的 arena。
+    for (auto& entry : entries_) {
+        if (auto central = entry.owner.lock(); central && !entry.slots.empty()) {
+            spill_to_central(*central, entry.slots, entry.slots.size(), SIZE_MAX);
+        }
+    }
+    tls_cache_destroyed = true;
+}
+
+}  // namespace
+
+ArenaPool::ArenaPool() : ArenaPool(Options{}) {}
+
+ArenaPool::ArenaPool(Options options)
+    : options_(options),
+      central_(std::make_shared<Central>()),
+      target_block_(options.min_block) {
+    central_->free.reserve(options_.max_pooled);
+}
+
+ArenaPool::~ArenaPool() = default;
+
+ArenaPool& ArenaPool::global() {
+    // 有意泄漏：静态析构阶段仍可能有 UnifiedMessage 归还 arena。
+    static ArenaPool* pool = new ArenaPool();
+    return *pool;
+}
+
+PooledArena ArenaPool::acquire() {
+    acquired_.fetch_add(1, std::memory_order_relaxed);
+
+    std::unique_ptr<ArenaSlot> slot;
+    if (!tls_cache_destroyed) {
+        auto& local = tls_cache.slots_for(central_);
+        if (local.empty()) {
+            // 本地为空，从中心按批取回半个缓存的量
+            std::lock_guard<std::mutex> lock(central_->mutex);
+            const std::size_t n = std::min(kThreadCacheSlots / 2, central_->free.size());
+            if (n > 0) {
+                central_->transfers.fetch_add(1, std::memory_order_relaxed);
+                for (std::size_t i = 0; i < n; ++i) {
+                    local.push_back(std::move(central_->free.back()));
+                    central_->free.pop_back();
+                }
+            }
+        }
+        if (!local.empty()) {
+            slot = std::move(local.back());
+            local.pop_back();
+        }
+    } else {
+        std::lock_guard<std::mutex> lock(central_->mutex);
+        if (!central_->free.empty()) {
+            slot = std::move(central_->free.back());
+            central_->free.pop_back();
+        }
+    }
+
+    if (slot) {
+        reused_.fetch_add(1, std::memory_order_relaxed);
+        central_->pooled.fetch_sub(1, std::memory_order_relaxed);
+        return PooledArena(this, std::move(slot));
+    }
+    return PooledArena(this, std::make_unique<ArenaSlot>(
+                                 target_block_.load(std::memory_order_relaxed)));
+}
+
+void ArenaPool::release(std::unique_ptr<ArenaSlot> slot) noexcept {
+    // SpaceAllocated 包含初始块；超过说明本次请求让 arena 额外申请了内存。
+    const uint64_t allocated = slot->arena.SpaceAllocated();
+    const uint64_t used = slot->arena.SpaceUsed();
+    slot->arena.Reset();
+
+    // SpaceUsed 不含析构回调链表占用的空间，溢出时改用 SpaceAllocated 估计需求。
+    const bool overflowed = allocated > slot->block_size;
+    if (overflowed) {
+        overflowed_.fetch_add(1, std::memory_order_relaxed);
+    }
+    record_demand(static_cast<std::size_t>(overflowed ? allocated : used));
+
+    // 初始块过小会反复溢出，过大则浪费；都交给下一次 acquire 按新尺寸重建。
+    const std::size_t target = target_block_.load(std::memory_order_relaxed);
+    if (slot->block_size < target || slot->block_size > target * 4) {
+        return;
+    }
+
+    central_->pooled.fetch_add(1, std::memory_order_relaxed);
+    if (tls_cache_destroyed) {
+        std::vector<std::unique_ptr<ArenaSlot>> one;
+        one.push_back(std::move(slot));
+        spill_to_central(*central_, one, 1, options_.max_pooled);
+        return;
+    }
+    auto& local = tls_cache.slots_for(central_);
+    local.push_back(std::move(slot));
+    if (local.size() > kThreadCacheSlots) {
+        spill_to_central(*central_, local, kThreadCacheSlots / 2, options_.max_pooled);
+    }
+}
+
+void ArenaPool::record_demand(std::size_t demand) noexcept {
+    const std::size_t pos = recent_pos_.fetch_add(1, std::memory_order_relaxed);
+    recent_[pos % kWindow].store(demand, std::memory_order_relaxed);
+
+    std::size_t peak = 0;
+    for (const auto& recent : recent_) {
+        peak = std::max(peak, recent.load(std::memory_order_relaxed));
+    }
+    const std::size_t rounded = std::bit_ceil(std::max(peak, options_.min_block));
+    target_block_.store(std::min(rounded, options_.max_block), std::memory_order_relaxed);
+}
+
+ArenaPoolStats ArenaPool::stats() const {
+    ArenaPoolStats s;
+    s.acquired = acquired_.load(std::memory_order_relaxed);
+    s.reused = reused_.load(std::memory_order_relaxed);
+    s.overflowed = overflowed_.load(std::memory_order_relaxed);
+    s.initial_block = target_block_.load(std::memory_order_relaxed);
+    s.pooled = central_->pooled.load(std::memory_order_relaxed);
+    s.central_transfers = central_->transfers.load(std::memory_order_relaxed);
+    return s;
+}
+
+}  // namespace network
+}  // namespace im
@@ -0,0 +1,135 @@
+#ifndef PROTOBUF_ARENA_POOL_HPP
+#define PROTOBUF_ARENA_POOL_HPP
+
+/******************************************************************************
+ *
+ * @file       protobuf_arena_pool.hpp
+ * @brief      按请求复用的 google::protobuf::Arena 池
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * 一次请求里的 protobuf 对象（请求体、响应体、响应 IMHeader）都用
+ * Arena::Create 在同一个 arena 上 bump 分配，请求结束时整体释放。
+ *
+ * 每个池化 arena 自带一块初始内存，大小取最近若干次请求实际用量的最大值
+ * （向上取 2 的幂，限制在 [min_block, max_block]），大多数请求不需要再向
+ * 系统申请。归还时 Reset() 清空，初始块留给下一次请求；初始块明显小于或
+ * 大于当前估计的 arena 直接丢弃，由下一次 acquire 按新尺寸重建。
+ *
+ * 空闲 arena 先放在线程本地缓存里，借还都不加锁；本地缓存满了按批挂回
+ * 池的中心链表，本地为空时再按批取回，和 SlabAllocator 的线程缓存一样。
+ * 消息通常在 I/O 线程借出、在工作线程归还，两边各自按批与中心交换。
+ *
+ *****************************************************************************/
+
+#include <google/protobuf/arena.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace im {
+namespace network {
+
+struct ArenaSlot;
+class ArenaPool;
+
+/**
+ * @brief 从 ArenaPool 借出的 arena，析构时归还。
+ */
+class PooledArena {
+public:
+    PooledArena() noexcept;
+    ~PooledArena();
+
+    PooledArena(const PooledArena&) = delete;
+    PooledArena& operator=(const PooledArena&) = delete;
+    PooledArena(PooledArena&& other) noexcept;
+    PooledArena& operator=(PooledArena&& other) noexcept;
+
+    google::protobuf::Arena* get() const noexcept;
+    explicit operator bool() const noexcept { return slot_ != nullptr; }
+
+    /// 在该 arena 上构造对象，生命周期随 arena 结束。
+    template <typename T, typename... Args>
+    T* create(Args&&... args) const {
+        return google::protobuf::Arena::Create<T>(get(), std::forward<Args>(args)...);
+    }
+
+    /// 提前归还；之后 get() 返回 nullptr。
+    void reset() noexcept;
+
+private:
+    friend class ArenaPool;
+    PooledArena(ArenaPool* pool, std::unique_ptr<ArenaSlot> slot) noexcept;
+
+    ArenaPool* pool_ = nullptr;
+    std::unique_ptr<ArenaSlot> slot_;
+};
+
+struct ArenaPoolStats {
+    uint64_t acquired = 0;        // acquire 总次数
+    uint64_t reused = 0;          // 命中池中已有 arena 的次数
+    uint64_t overflowed = 0;      // 请求用量超过初始块、arena 额外向系统申请的次数
+    std::size_t initial_block = 0;  // 当前估计的初始块大小
+    std::size_t pooled = 0;         // 空闲 arena 数（含各线程缓存）
+    uint64_t central_transfers = 0;  // 线程缓存与中心链表之间的批量搬运次数
+};
+
+class ArenaPool {
+public:
+    struct Options {
+        std::size_t min_block = 1024;
+        std::size_t max_block = 64 * 1024;
+        std::size_t max_pooled = 256;  // 中心链表上限，不含线程缓存
+    };
+
+    ArenaPool();
+    explicit ArenaPool(Options options);
+    ~ArenaPool();
+
+    ArenaPool(const ArenaPool&) = delete;
+    ArenaPool& operator=(const ArenaPool&) = delete;
+
+    /// 网关进程共用的池。
+    static ArenaPool& global();
+
+    PooledArena acquire();
+
+    ArenaPoolStats stats() const;
+
+    /// 每个线程缓存的空闲 arena 上限，超出时把一半挂回中心。
+    static constexpr std::size_t kThreadCacheSlots = 16;
+
+    /// 中心链表，线程缓存通过 weak_ptr 判断池是否还在。
+    struct Central;
+
+private:
+    friend class PooledArena;
+
+    /// 参与初始块估计的最近请求数。
+    static constexpr std::size_t kWindow = 64;
+
+    void release(std::unique_ptr<ArenaSlot> slot) noexcept;
+    void record_demand(std::size_t demand) noexcept;
+
+    const Options options_;
+    std::shared_ptr<Central> central_;
+    std::array<std::atomic<std::size_t>, kWindow> recent_{};
+    std::atomic<std::size_t> recent_pos_{0};
+    std::atomic<std::size_t> target_block_;
+    std::atomic<uint64_t> acquired_{0};
+    std::atomic<uint64_t> reused_{0};
+    std::atomic<uint64_t> overflowed_{0};
+};
+
+}  // namespace network
+}  // namespace im
+
+#endif  // PROTOBUF_ARENA_POOL_HPP
@@ -1,8 +1,10 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/message.h>
+#include <cstdint>
 #include <cstring>
 #include <bit>
 #include "protobuf_codec.hpp"
+#include "message_type_registry.hpp"
 // 包含Protobuf定义
 #include "../proto/base.pb.h"  // 正确的BaseResponse定义路径
 #include "../proto/command.pb.h"
@@ -375,6 +377,237 @@ bool ProtobufCodec::decodeEnvelope(const std::string& input,
     }
 }
 
+namespace {
+
+void put_le16(char* out, uint16_t value) {
+    out[0] = static_cast<char>(value & 0xff);
+    out[1] = static_cast<char>((value >> 8) & 0xff);
+}
+
+void put_le32(char* out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out[i] = static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+}
+
+uint32_t get_le32(const char* in) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(in);
+    return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+           (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+void read_frame_header_v2(const char* in, FrameHeaderV2& header) {
+    header.version = static_cast<uint8_t>(in[0]);
+    header.flags = static_cast<uint8_t>(in[1]);
+    header.cmd_id = get_le32(in + 4);
+    header.seq = get_le32(in + 8);
+    header.type_id = get_le32(in + 12);
+    header.body_length = get_le32(in + 16);
+}
+
+void write_frame_header_v2(const FrameHeaderV2& header, char* out) {
+    out[0] = static_cast<char>(header.version);
+    out[1] = static_cast<char>(header.flags);
+    put_le16(out + 2, 0);
+    put_le32(out + 4, header.cmd_id);
+    put_le32(out + 8, header.seq);
+    put_le32(out + 12, header.type_id);
+    put_le32(out + 16, header.body_length);
+}
+
+}  // namespace
+
+bool ProtobufCodec::encode(const im::base::IMHeader& header,
+                           const google::protobuf::Message& message,
+                           std::string& output,
+                           WireVersion version) {
+    if (version == WireVersion::V1) {
+        return encode(header, message, output);
+    }
+
+    try {
+        const uint32_t type_id = MessageTypeRegistry::id_of(message.GetDescriptor());
+        if (type_id == 0) {
+            LogManager::GetLogger("protobuf_codec")
+                    ->error("Message type {} has no wire type id", message.GetTypeName());
+            return false;
+        }
+
+        const size_t body_size = message.ByteSizeLong();
+        if (body_size > UINT32_MAX) {
+            LogManager::GetLogger("protobuf_codec")->error("Message too large: {}", body_size);
+            return false;
+        }
+
+        FrameHeaderV2 frame_header;
+        frame_header.cmd_id = header.cmd_id();
+        frame_header.seq = header.seq();
+        frame_header.type_id = type_id;
+        frame_header.body_length = static_cast<uint32_t>(body_size);
+
+        output.resize(kFrameHeaderV2Size + body_size);
+        write_frame_header_v2(frame_header, output.data());
+        if (!message.SerializeToArray(output.data() + kFrameHeaderV2Size,
+                                      static_cast<int>(body_size))) {
+            LogManager::GetLogger("protobuf_codec")->error("Failed to serialize message");
+            return false;
+        }
+        return true;
+    } catch (const std::exception& e) {
+        LogManager::GetLogger("protobuf_codec")->error("Encode v2 error: {}", e.what());
+        return false;
+    }
+}
+
+bool ProtobufCodec::decodeFrameV2(const std::string& input,
+                                  FrameHeaderV2& header_out,
+                                  std::string& body_out) {
+    if (input.size() < kFrameHeaderV2Size) {
+        LogManager::GetLogger("protobuf_codec")
+                ->warn("v2 frame too small: {} bytes", input.size());
+        return false;
+    }
+
+    read_frame_header_v2(input.data(), header_out);
+    if (header_out.version != static_cast<uint8_t>(WireVersion::V2)) {
+        LogManager::GetLogger("protobuf_codec")
+                ->error("Unexpected frame version: {}", header_out.version);
+        return false;
+    }
+
+    if (header_out.body_length != input.size() - kFrameHeaderV2Size) {
+        LogManager::GetLogger("protobuf_codec")
+                ->error("v2 body length {} does not match frame payload {}",
+                        header_out.body_length, input.size() - kFrameHeaderV2Size);
+        return false;
+    }
+
+    body_out.assign(input.data() + kFrameHeaderV2Size, header_out.body_length);
+    return true;
+}
+
+bool ProtobufCodec::isBatchFrameV2(const std::string& input) {
+    return input.size() >= kFrameHeaderV2Size &&
+           static_cast<uint8_t>(input[0]) == static_cast<uint8_t>(WireVersion::V2) &&
+           (static_cast<uint8_t>(input[1]) & kFrameFlagBatch) != 0;
+}
+
+bool ProtobufCodec::decodeBatchV2(const std::string& input,
+                                  FrameHeaderV2& header_out,
+                                  std::vector<std::string>& sub_frames_out,
+                                  std::size_t max_items) {
+    sub_frames_out.clear();
+    if (!isBatchFrameV2(input)) {
+        LogManager::GetLogger("protobuf_codec")->warn("Not a v2 batch frame");
+        return false;
+    }
+
+    read_frame_header_v2(input.data(), header_out);
+    if (header_out.body_length != input.size() - kFrameHeaderV2Size) {
+        LogManager::GetLogger("protobuf_codec")
+                ->error("v2 batch body length {} does not match frame payload {}",
+                        header_out.body_length, input.size() - kFrameHeaderV2Size);
+        return false;
+    }
+    if (header_out.type_id != wire_type_id_v<im::base::FrameBatch>) {
+        LogManager::GetLogger("protobuf_codec")
+                ->error("v2 batch frame carries type id {}", header_out.type_id);
+        return false;
+    }
+
+    im::base::FrameBatch batch;
+    if (!batch.ParseFromArray(input.data() + kFrameHeaderV2Size,
+                              static_cast<int>(header_out.body_length))) {
+        LogManager::GetLogger("protobuf_codec")->error("Failed to parse FrameBatch body");
+        return false;
+    }
+    if (static_cast<std::size_t>(batch.frames_size()) > max_items) {
+        LogManager::GetLogger("protobuf_codec")
+                ->warn("v2 batch has {} sub-frames, limit is {}", batch.frames_size(), max_items);
+        return false;
+    }
+
+    // 子帧只校验帧头（版本、不可嵌套、长度自洽），消息体交给 decodeFrameV2
+    sub_frames_out.reserve(batch.frames_size());
+    for (int i = 0; i < batch.frames_size(); ++i) {
+        std::string* frame = batch.mutable_frames(i);
+        FrameHeaderV2 sub_header;
+        if (frame->size() < kFrameHeaderV2Size) {
+            LogManager::GetLogger("protobuf_codec")->error("Truncated v2 sub-frame {}", i);
+            sub_frames_out.clear();
+            return false;
+        }
+        read_frame_header_v2(frame->data(), sub_header);
+        if (sub_header.version != static_cast<uint8_t>(WireVersion::V2) ||
+            (sub_header.flags & kFrameFlagBatch) != 0 ||
+            sub_header.body_length != frame->size() - kFrameHeaderV2Size) {
+            LogManager::GetLogger("protobuf_codec")->error("Invalid v2 sub-frame {}", i);
+            sub_frames_out.clear();
+            return false;
+        }
+        sub_frames_out.push_back(std::move(*frame));
+    }
+    return true;
+}
+
+bool ProtobufCodec::encodeBatchV2(uint32_t seq,
+                                  const std::vector<std::string>& sub_frames,
+                                  std::string& output) {
+    im::base::FrameBatch batch;
+    batch.mutable_frames()->Reserve(static_cast<int>(sub_frames.size()));
+    for (const auto& frame : sub_frames) {
+        batch.add_frames(frame);
+    }
+
+    const size_t body_size = batch.ByteSizeLong();
+    if (body_size > UINT32_MAX) {
+        LogManager::GetLogger("protobuf_codec")->error("Batch too large: {}", body_size);
+        return false;
+    }
+
+    FrameHeaderV2 frame_header;
+    frame_header.flags = kFrameFlagBatch;
+    frame_header.seq = seq;
+    frame_header.type_id = wire_type_id_v<im::base::FrameBatch>;
+    frame_header.body_length = static_cast<uint32_t>(body_size);
+
+    output.resize(kFrameHeaderV2Size + body_size);
+    write_frame_header_v2(frame_header, output.data());
+    if (!batch.SerializeToArray(output.data() + kFrameHeaderV2Size,
+                                static_cast<int>(body_size))) {
+        LogManager::GetLogger("protobuf_codec")->error("Failed to serialize FrameBatch");
+        return false;
+    }
+    return true;
+}
+
+bool ProtobufCodec::transcodeToV2(const std::string& v1_frame, std::string& output) {
+    im::base::IMHeader header;
+    std::string type_name;
+    std::string body;
+    if (!decodeEnvelope(v1_frame, header, type_name, body)) {
+        return false;
+    }
+
+    const uint32_t type_id = MessageTypeRegistry::id_of(type_name);
+    if (type_id == 0) {
+        LogManager::GetLogger("protobuf_codec")
+                ->error("Message type {} has no wire type id", type_name);
+        return false;
+    }
+
+    FrameHeaderV2 frame_header;
+    frame_header.cmd_id = header.cmd_id();
+    frame_header.seq = header.seq();
+    frame_header.type_id = type_id;
+    frame_header.body_length = static_cast<uint32_t>(body.size());
+
+    output.resize(kFrameHeaderV2Size);
+    write_frame_header_v2(frame_header, output.data());
+    output.append(body);
+    return true;
+}
+
 /**
  * @brief 计算数据的CRC32校验值
  *
@@ -399,12 +632,17 @@ uint32_t ProtobufCodec::calculateCRC32(const void* data, size_t size) {
 base::IMHeader ProtobufCodec::returnHeaderBuilder(base::IMHeader header, std::string device_id,
                                                   std::string platform) {
     base::IMHeader returnHeader;
+    fillReturnHeader(header, device_id, platform, &returnHeader);
+    return returnHeader;
+}
 
-    returnHeader.set_version(header.version());
-    returnHeader.set_seq(header.seq());
-    returnHeader.set_cmd_id(command::CommandID::CMD_SERVER_NOTIFY);  // 服务器通知
-    returnHeader.set_from_uid(header.to_uid());
-    returnHeader.set_to_uid(header.from_uid());
+void ProtobufCodec::fillReturnHeader(const base::IMHeader& header, const std::string& device_id,
+                                     const std::string& platform, base::IMHeader* returnHeader) {
+    returnHeader->set_version(header.version());
+    returnHeader->set_seq(header.seq());
+    returnHeader->set_cmd_id(command::CommandID::CMD_SERVER_NOTIFY);  // 服务器通知
+    returnHeader->set_from_uid(header.to_uid());
+    returnHeader->set_to_uid(header.from_uid());
 
     // 1. 获取当前时间点
     auto now = std::chrono::system_clock::now();
@@ -413,27 +651,29 @@ base::IMHeader ProtobufCodec::returnHeaderBuilder(base::IMHeader header, std::st
     // 3. 获取数值
     auto ms_count = milliseconds.count();
 
-    returnHeader.set_timestamp(ms_count);
-    returnHeader.set_token(header.token());
-    returnHeader.set_device_id(device_id);
-    returnHeader.set_platform(platform);
-
-    return returnHeader;
+    returnHeader->set_timestamp(ms_count);
+    returnHeader->set_token(header.token());
+    returnHeader->set_device_id(device_id);
+    returnHeader->set_platform(platform);
 }
 
 std::string ProtobufCodec::buildAuthFailedResponse(const base::IMHeader& request_header, 
-                                                  const std::string& error_message) {
-    return buildErrorResponse(request_header, base::ErrorCode::AUTH_FAILED, error_message);
+                                                  const std::string& error_message,
+                                                  WireVersion version) {
+    return buildErrorResponse(request_header, base::ErrorCode::AUTH_FAILED, error_message,
+                              version);
 }
 
 std::string ProtobufCodec::buildTimeoutResponse(const base::IMHeader& request_header,
-                                               const std::string& error_message) {
-    return buildErrorResponse(request_header, base::ErrorCode::TIMEOUT, error_message);
+                                               const std::string& error_message,
+                                               WireVersion version) {
+    return buildErrorResponse(request_header, base::ErrorCode::TIMEOUT, error_message, version);
 }
 
 std::string ProtobufCodec::buildErrorResponse(const base::IMHeader& request_header,
                                              base::ErrorCode error_code,
-                                             const std::string& error_message) {
+                                             const std::string& error_message,
+                                             WireVersion version) {
     try {
         // 构建响应头
         base::IMHeader response_header = returnHeaderBuilder(request_header, 
@@ -447,7 +687,7 @@ std::string ProtobufCodec::buildErrorResponse(const base::IMHeader& request_head
         
         // 编码为protobuf二进制数据
         std::string encoded_data;
-        if (encode(response_header, response, encoded_data)) {
+        if (encode(response_header, response, encoded_data, version)) {
             return encoded_data;
         } else {
             auto logger = LogManager::GetLogger("protobuf_codec");
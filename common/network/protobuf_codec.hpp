@@ -1,9 +1,13 @@
 #ifndef PROTOBUF_CODEC_HPP
 #define PROTOBUF_CODEC_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 #include <google/protobuf/message.h>
 #include "../proto/base.pb.h"
+#include "wire_format.hpp"
 
 namespace im {
 namespace network {
@@ -94,8 +98,71 @@ public:
                                std::string& type_name_out,
                                std::string& message_bytes_out);
 
+    /**
+     * @brief 按连接协商的帧格式编码
+     *
+     * V1 等价于 encode(header, message, output)。V2 只使用 header 的 cmd_id 和 seq，
+     * 类型编号由 MessageTypeRegistry 查得，未登记的消息类型编码失败。
+     *
+     * @see wire_format.hpp
+     */
+    static bool encode(const im::base::IMHeader& header,
+                       const google::protobuf::Message& message,
+                       std::string& output,
+                       WireVersion version);
+
+    /**
+     * @brief 解析 v2 帧
+     *
+     * @param input 输入的二进制帧
+     * @param header_out 输出固定头
+     * @param body_out 输出消息体原始字节
+     * @return 版本号不为2、长度不足或 body_length 与剩余字节数不一致时返回 false
+     */
+    static bool decodeFrameV2(const std::string& input,
+                              FrameHeaderV2& header_out,
+                              std::string& body_out);
+
+    /// 是否为 v2 批量帧（只看版本和 flags，不校验长度）
+    static bool isBatchFrameV2(const std::string& input);
+
+    /**
+     * @brief 拆分 v2 批量帧
+     *
+     * @param input 完整的批量帧，消息体为 im.base.FrameBatch
+     * @param header_out 外层帧头，seq 为批次序号
+     * @param sub_frames_out 各子帧的完整字节（含子帧头），可直接交给 decodeFrameV2
+     * @param max_items 允许的最大子帧数
+     * @return 外层头或 FrameBatch 非法、子帧头非法或嵌套批量帧、子帧数超过 max_items 时返回 false
+     */
+    static bool decodeBatchV2(const std::string& input,
+                              FrameHeaderV2& header_out,
+                              std::vector<std::string>& sub_frames_out,
+                              std::size_t max_items);
+
+    /**
+     * @brief 把已编码的 v2 子帧装进 FrameBatch，编码成一个批量帧
+     *
+     * @param seq 批次序号，取请求批量帧的 seq
+     * @param sub_frames 各子请求的 v2 响应帧，按请求顺序
+     */
+    static bool encodeBatchV2(uint32_t seq,
+                              const std::vector<std::string>& sub_frames,
+                              std::string& output);
+
+    /**
+     * @brief 将已编码的 v1 帧转换为 v2 帧，消息体字节原样拷贝，不反序列化
+     *
+     * 推送路径按接收者编码一次 v1 帧，投递到协商了 v2 的连接前再转换。
+     */
+    static bool transcodeToV2(const std::string& v1_frame, std::string& output);
+
     // 根据请求header构建返回header
     static base::IMHeader returnHeaderBuilder(base::IMHeader header,std::string device_id,std::string platform);
+
+    // 同上，直接填入调用方提供的 header（例如 arena 上创建的对象），不产生临时拷贝
+    static void fillReturnHeader(const base::IMHeader& header, const std::string& device_id,
+                                 const std::string& platform, base::IMHeader* returnHeader);
     
     /**
      * @brief 构建认证失败的protobuf响应消息
@@ -104,7 +171,8 @@ public:
      * @return 编码后的protobuf二进制数据
      */
     static std::string buildAuthFailedResponse(const base::IMHeader& request_header, 
-                                              const std::string& error_message = "Authentication failed");
+                                              const std::string& error_message = "Authentication failed",
+                                              WireVersion version = WireVersion::V1);
     
     /**
      * @brief 构建超时的protobuf响应消息
@@ -113,18 +181,21 @@ public:
      * @return 编码后的protobuf二进制数据
      */
     static std::string buildTimeoutResponse(const base::IMHeader& request_header,
-                                           const std::string& error_message = "Authentication timeout");
+                                           const std::string& error_message = "Authentication timeout",
+                                           WireVersion version = WireVersion::V1);
     
     /**
      * @brief 构建通用错误的protobuf响应消息
      * @param request_header 请求头（用于构建响应头）
      * @param error_code 错误码
      * @param error_message 错误消息
+     * @param version 接收方连接协商的帧格式
      * @return 编码后的protobuf二进制数据
      */
     static std::string buildErrorResponse(const base::IMHeader& request_header,
                                          base::ErrorCode error_code,
-                                         const std::string& error_message);
+                                         const std::string& error_message,
+                                         WireVersion version = WireVersion::V1);
 private:
     /**
      * @brief 计算数据的CRC32校验值
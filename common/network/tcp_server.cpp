@@ -13,16 +13,35 @@ TCPServer::TCPServer(unsigned short port)
         , signal_set_(io_context_, SIGINT, SIGTERM) {
 }
 
+TCPServer::TCPServer(net::io_context& ioc, unsigned short port, boost::asio::ssl::context* ssl_ctx)
+        : io_context_(ioc)
+        , acceptor_(io_context_, tcp::endpoint(tcp::v4(), port))
+        , signal_set_(io_context_)
+        , handle_signals_(false)
+        , ssl_ctx_(ssl_ctx) {
+}
+
+TCPServer::TCPServer(net::io_context& ioc, tcp::acceptor acceptor,
+                     boost::asio::ssl::context* ssl_ctx)
+        : io_context_(ioc)
+        , acceptor_(std::move(acceptor))
+        , signal_set_(io_context_)
+        , handle_signals_(false)
+        , ssl_ctx_(ssl_ctx) {
+}
+
 TCPServer::~TCPServer() { stop(); }
 
 void TCPServer::start() {
     // 注册信号处理器
-    signal_set_.async_wait([this](boost::system::error_code const&, int) {
-        if (LogManager::IsLoggingEnabled("tcp_server")) {
-            LogManager::GetLogger("tcp_server")->info("Stopping server...");
-        }
-        stop();
-    });
+    if (handle_signals_) {
+        signal_set_.async_wait([this](boost::system::error_code const&, int) {
+            if (LogManager::IsLoggingEnabled("tcp_server")) {
+                LogManager::GetLogger("tcp_server")->info("Stopping server...");
+            }
+            stop();
+        });
+    }
 
     start_accpet();
 }
@@ -72,9 +91,10 @@ void TCPServer::stop() {
                 LogManager::GetLogger("tcp_server")->info("Sessions count: {}", sessions_.size());
             }
             
-            for (const auto& session : sessions_) {
+            // close() 投递到会话线程执行，关闭回调不会在持锁时重入
+            for (const auto& [session_id, session] : sessions_) {
                 if (LogManager::IsLoggingEnabled("tcp_server")) {
-                    LogManager::GetLogger("tcp_server")->info("Closing session...");
+                    LogManager::GetLogger("tcp_server")->info("Closing session {}...", session_id);
                 }
                 session->close();
             }
@@ -91,10 +111,46 @@ void TCPServer::stop() {
     }
 }
 
+void TCPServer::stop_accepting() {
+    accepting_.store(false);
+    net::post(io_context_, [this] {
+        error_code ec;
+        acceptor_.close(ec);
+    });
+}
+
 void TCPServer::set_connection_handler(std::function<void(TCPSession::Ptr)> callback) {
     connection_handler_ = std::move(callback);
 }
 
+void TCPServer::set_disconnect_handler(std::function<void(TCPSession::Ptr)> callback) {
+    disconnect_handler_ = std::move(callback);
+}
+
+SessionPtr TCPServer::get_session(const std::string& session_id) const {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    auto it = sessions_.find(session_id);
+    if (it != sessions_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+std::vector<SessionPtr> TCPServer::get_sessions() const {
+    std::vector<SessionPtr> sessions;
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    sessions.reserve(sessions_.size());
+    for (const auto& [session_id, session] : sessions_) {
+        sessions.push_back(session);
+    }
+    return sessions;
+}
+
+size_t TCPServer::get_session_count() const {
+    std::lock_guard<std::mutex> lock(sessions_mutex_);
+    return sessions_.size();
+}
+
 void TCPServer::start_accpet() {
     // 异步接受新连接
     acceptor_.async_accept(
@@ -107,27 +163,33 @@ void TCPServer::handle_accept(const boost::system::error_code& ec,
                               boost::asio::ip::tcp::socket socket) {
     if (ec) {
         // 忽略操作取消的错误（正常关闭时发生）
-        if (ec != boost::asio::error::operation_aborted) {
-            if (LogManager::IsLoggingEnabled("tcp_server")) {
-                LogManager::GetLogger("tcp_server")
-                        ->error("Error accepting connection: {}", ec.message());
-            }
+        if (ec == boost::asio::error::operation_aborted) {
+            return;
+        }
+        // 其余错误（如 fd 耗尽）只影响这一次 accept，继续接受新连接
+        if (LogManager::IsLoggingEnabled("tcp_server")) {
+            LogManager::GetLogger("tcp_server")
+                    ->error("Error accepting connection: {}", ec.message());
+        }
+        if (!stopped_.load() && accepting_.load()) {
+            start_accpet();
         }
         return;
     }
 
     try {
         // 创建一个新的会话
-        auto session = std::make_shared<TCPSession>(std::move(socket));
+        auto session = std::make_shared<TCPSession>(std::move(socket), ssl_ctx_);
 
         // 添加到会话集合
         {
             std::lock_guard<std::mutex> lock(sessions_mutex_);
-            sessions_.insert(session);
+            sessions_.emplace(session->get_session_id(), session);
         }
 
-        // 设置会话关闭是的清理回调
-        session->set_close_callback([this, session] { remove_session(session); });
+        // 设置会话关闭是的清理回调；只捕获 ID，避免会话持有自己
+        session->set_close_callback(
+                [this, session_id = session->get_session_id()] { remove_session(session_id); });
 
         // 调用新连接回调
         if (connection_handler_) {
@@ -136,30 +198,42 @@ void TCPServer::handle_accept(const boost::system::error_code& ec,
 
         // 启动会话
         session->start();
-    } catch (error_code ec) {
+    } catch (const std::exception& e) {
         if (LogManager::IsLoggingEnabled("tcp_server")) {
-            LogManager::GetLogger("tcp_server")->error("❌Accept session error:{}", ec.message());
+            LogManager::GetLogger("tcp_server")->error("❌Accept session error:{}", e.what());
         }
     }
 
-    // 继续接受新连接，除非服务器已停止
-    if (!stopped_.load()) {
+    // 继续接受新连接，除非服务器已停止或已停止 accept
+    if (!stopped_.load() && accepting_.load()) {
         start_accpet();
     }
 }
 
-void TCPServer::remove_session(TCPSession::Ptr session) {
-    std::lock_guard<std::mutex> lock(sessions_mutex_);
-    // 从会话集合中移除
-    auto it = sessions_.find(session);
-    if (it != sessions_.end()) {
-        sessions_.erase(it);
-        if (LogManager::IsLoggingEnabled("tcp_server")) {
-            LogManager::GetLogger("tcp_server")
-                    ->info("Session Removed:{},({} active sessions) ",
-                           session->remote_endpoint().address().to_string(),
-                           sessions_.size());
+void TCPServer::remove_session(const std::string& session_id) {
+    TCPSession::Ptr session;
+    size_t remaining = 0;
+    {
+        std::lock_guard<std::mutex> lock(sessions_mutex_);
+        // 从会话集合中移除
+        auto it = sessions_.find(session_id);
+        if (it == sessions_.end()) {
+            return;
         }
+        session = std::move(it->second);
+        sessions_.erase(it);
+        remaining = sessions_.size();
+    }
+
+    if (LogManager::IsLoggingEnabled("tcp_server")) {
+        LogManager::GetLogger("tcp_server")
+                ->info("Session Removed:{},({} active sessions) ",
+                       session->remote_endpoint().address().to_string(),
+                       remaining);
+    }
+
+    if (disconnect_handler_) {
+        disconnect_handler_(session);
     }
 }
 
@@ -13,14 +13,17 @@
 
 #include <atomic>
 #include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
 #include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <set>
+#include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 #include "IOService_pool.hpp"
+#include "client_session.hpp"
 #include "tcp_session.hpp"
 
 namespace im {
@@ -38,9 +41,10 @@ using ip::tcp;
  * 2. 管理所有活动会话
  * 3. 多线程支持(基于IOServicePool)
  * 4. 优雅关闭机制
+ * 5. 按会话 ID 查找连接（SessionLookup），供网关推送使用
  */
 
-class TCPServer {
+class TCPServer : public SessionLookup {
 public:
     /**
      * @brief 构造函数
@@ -49,6 +53,22 @@ public:
      */
     TCPServer(unsigned short port);
 
+    /**
+     * @brief 嵌入其他服务使用的构造函数：不注册信号处理，由宿主进程负责
+     * @param ioc 监听与会话使用的 I/O 上下文
+     * @param port 监听端口
+     * @param ssl_ctx 非空时新连接先完成 TLS 握手
+     */
+    TCPServer(net::io_context& ioc, unsigned short port,
+              boost::asio::ssl::context* ssl_ctx = nullptr);
+
+    /**
+     * @brief 使用已在监听的 acceptor（热重启时从旧进程接手），其余同上
+     * @param acceptor 必须建立在 ioc 上
+     */
+    TCPServer(net::io_context& ioc, tcp::acceptor acceptor,
+              boost::asio::ssl::context* ssl_ctx = nullptr);
+
     /**
      * @brief 析构函数，自动停止服务器
      */
@@ -67,12 +87,32 @@ public:
      */
     void stop();
 
+    /**
+     * @brief 只关闭本进程的监听 fd，已建立的会话不受影响
+     */
+    void stop_accepting();
+
+    // 监听 socket，交给热重启的新进程
+    int listener_fd() { return acceptor_.native_handle(); }
+
     /**
      * @brief 设置新连接建立时的回调函数
      * @param callback 回调函数，参数为TCPSession::Ptr
      */
     void set_connection_handler(std::function<void(TCPSession::Ptr)> callback);
 
+    /**
+     * @brief 设置连接关闭后的回调函数（会话已从服务器移除）
+     * @param callback 回调函数，参数为TCPSession::Ptr
+     */
+    void set_disconnect_handler(std::function<void(TCPSession::Ptr)> callback);
+
+    SessionPtr get_session(const std::string& session_id) const override;
+
+    std::vector<SessionPtr> get_sessions() const override;
+
+    size_t get_session_count() const;
+
 private:
     // 开始接收新连接
     void start_accpet();
@@ -81,16 +121,20 @@ private:
     void handle_accept(const error_code& ec,tcp::socket socket);
 
     // 移除session
-    void remove_session(TCPSession::Ptr session);
+    void remove_session(const std::string& session_id);
 
 private:
     net::io_context& io_context_;          // I/O 上下文  使用引用,防止拷贝
     tcp::acceptor acceptor_;              // 连接接受器
     net::signal_set signal_set_;          // 信号处理器（用于捕获Ctrl+C）
-    std::set<TCPSession::Ptr> sessions_;  // 活动会话集合
-    std::mutex sessions_mutex_;           // 会话集合互斥锁
+    bool handle_signals_ = true;          // 嵌入网关时信号由宿主处理
+    boost::asio::ssl::context* ssl_ctx_ = nullptr;  // 为空时为明文连接
+    std::unordered_map<std::string, TCPSession::Ptr> sessions_;  // 活动会话，按会话 ID 索引
+    mutable std::mutex sessions_mutex_;   // 会话集合互斥锁
     std::atomic<bool> stopped_{false};    // 服务器停止标志
-    std::function<void(TCPSession::Ptr)> connection_handler_;  // 新连接回调
+    std::atomic<bool> accepting_{true};   // stop_accepting() 后不再发起 accept
+    std::function<void(TCPSession::Ptr)> connection_handler_;     // 新连接回调
+    std::function<void(TCPSession::Ptr)> disconnect_handler_;     // 连接关闭回调
 };
 
 } // namespace network
@@ -1,3 +1,4 @@
+#include <cstring>
 #include <iostream>
 #include "../utils/log_manager.hpp"
 #include "IOService_pool.hpp"
@@ -9,23 +10,28 @@ namespace network {
 using im::utils::LogManager;
 
 static constexpr size_t max_send_queue_size = 1024;
-TCPSession::TCPSession(tcp::socket socket)
-        : socket_(std::move(socket))
-        , heartbeat_timer_(socket_.get_executor())
-        , read_timeout_timer_(socket_.get_executor())
-        , body_buffer_(max_body_length) {
+// 常见业务帧在几百字节内，不超过该容量的消息体缓冲留着复用，更大的处理完即释放
+static constexpr size_t max_retained_body_capacity = 4 * 1024;
+
+TCPSession::TCPSession(tcp::socket socket, boost::asio::ssl::context* ssl_ctx)
+        : ClientSession(generate_id())
+        , stream_(ssl_ctx ? TlsTransportStream(std::move(socket), *ssl_ctx)
+                          : TlsTransportStream(std::move(socket)))
+        , heartbeat_timer_(stream_.get_executor())
+        , read_timeout_timer_(stream_.get_executor()) {
     // 问题：初始化定时器为max()可能导致异常行为
     // 解决：初始化为最小时间点，表示定时器未启动
     heartbeat_timer_.expires_at(std::chrono::steady_clock::time_point::min());
     read_timeout_timer_.expires_at(std::chrono::steady_clock::time_point::min());
 
+    auto& sock = stream_.socket();
 
     // 启用TCP Keepalive
-    socket_.set_option(net::socket_base::keep_alive(true));
+    sock.set_option(net::socket_base::keep_alive(true));
 
 // 平台特定的参数设置
 #if defined(__linux__)
-    int fd = socket_.native_handle();
+    int fd = sock.native_handle();
     int keepidle = 30;  // 空闲30秒后开始探测
     int keepintvl = 5;  // 每5秒探测一次
     int keepcnt = 3;    // 探测3次
@@ -36,9 +42,9 @@ TCPSession::TCPSession(tcp::socket socket)
 #endif
 
     // 只有在socket已连接的情况下才获取remote_endpoint
-    if (socket_.is_open()) {
+    if (sock.is_open()) {
         try {
-            remote_endpoint_ = socket_.remote_endpoint();
+            remote_endpoint_ = sock.remote_endpoint();
             if (LogManager::IsLoggingEnabled("tcp_session")) {
                 LogManager::GetLogger("tcp_session")
                         ->info("TCPSession created for endpoint: {}",
@@ -57,18 +63,40 @@ TCPSession::TCPSession(tcp::socket socket)
 
 void TCPSession::start() {
     try {
-        if (socket_.is_open()) {
+        if (stream_.socket().is_open()) {
             if (LogManager::IsLoggingEnabled("tcp_session")) {
                 LogManager::GetLogger("tcp_session")
-                        ->info("🚀Session started with remote endpoint: {}",
-                               remote_endpoint_.address().to_string());
+                        ->info("🚀Session started with remote endpoint: {}{}",
+                               remote_endpoint_.address().to_string(),
+                               stream_.plain() ? "" : " (tls)");
             }
 
-            socket_.set_option(tcp::no_delay(true));  // 禁用Nagle算法,减少延迟
+            stream_.socket().set_option(tcp::no_delay(true));  // 禁用Nagle算法,减少延迟
+
+            // TLS 握手同样受读超时约束
+            reset_read_timeout();
+            start_read_deadline();
 
-            start_heartbeat();  // 启动心跳检测
+            if (stream_.plain()) {
+                on_ready();
+                return;
+            }
 
-            do_read_header();  // 开始读取消息头
+            stream_.async_handshake(boost::asio::ssl::stream_base::server,
+                                    [this, self = shared_self()](const error_code& ec) {
+                                        if (ec) {
+                                            if (LogManager::IsLoggingEnabled("tcp_session")) {
+                                                LogManager::GetLogger("tcp_session")
+                                                        ->warn("TLS handshake failed: {} from {}",
+                                                               ec.message(),
+                                                               remote_endpoint_.address()
+                                                                       .to_string());
+                                            }
+                                            do_close();
+                                            return;
+                                        }
+                                        on_ready();
+                                    });
         } else {
             if (LogManager::IsLoggingEnabled("tcp_session")) {
                 LogManager::GetLogger("tcp_session")->warn("Session started with closed socket");
@@ -82,25 +110,50 @@ void TCPSession::start() {
     }
 }
 
+void TCPSession::on_ready() {
+    start_heartbeat();  // 启动心跳检测
+
+    do_read_header();  // 开始读取消息头
+}
+
 
 void TCPSession::close() {
+    net::post(stream_.get_executor(), [self = shared_self()]() { self->do_close(); });
+}
+
+void TCPSession::do_close() {
+    if (closed_) {
+        if (LogManager::IsLoggingEnabled("tcp_session")) {
+            LogManager::GetLogger("tcp_session")
+                    ->info("Socket already closed for endpoint: {}",
+                           remote_endpoint_.address().to_string());
+        }
+        return;
+    }
+    closed_ = true;
+
     if (LogManager::IsLoggingEnabled("tcp_session")) {
         LogManager::GetLogger("tcp_session")
                 ->info("Closing session with remote endpoint: {}",
                        remote_endpoint_.address().to_string());
     }
 
-    if (socket_.is_open()) {
-        error_code ec;
-
-        // 优雅地关闭套接字
-        if (LogManager::IsLoggingEnabled("tcp_session")) {
-            LogManager::GetLogger("tcp_session")
-                    ->info("Shutting down socket with remote endpoint: {}",
-                           remote_endpoint_.address().to_string());
+    // 未发出的消息不再计入在途数；正在写的那一帧也在队列里，完成回调看到 closed_ 直接返回
+    for (const auto& frame : send_queue_) {
+        if (frame.type == HeaderMsgType::NORMAL) {
+            pending_sends_.fetch_sub(1, std::memory_order_acq_rel);
         }
+    }
+    send_queue_.clear();
+    release_writable_waiter();
 
-        socket_.shutdown(tcp::socket::shutdown_both, ec);
+    error_code ec;
+    // TLS 连接尽力发一次 close_notify，不等待对端
+    stream_.shutdown(ec);
+
+    auto& sock = stream_.socket();
+    if (sock.is_open()) {
+        sock.shutdown(tcp::socket::shutdown_both, ec);
         if (ec) {
             if (LogManager::IsLoggingEnabled("tcp_session")) {
                 LogManager::GetLogger("tcp_session")
@@ -108,66 +161,81 @@ void TCPSession::close() {
             }
         }
 
-        socket_.close(ec);
+        sock.close(ec);
         if (ec) {
             if (LogManager::IsLoggingEnabled("tcp_session")) {
                 LogManager::GetLogger("tcp_session")
                         ->warn("Error closing socket: {}", ec.message());
             }
         }
+    }
 
-        // 停止定时器
-        if (LogManager::IsLoggingEnabled("tcp_session")) {
-            LogManager::GetLogger("tcp_session")->info("Canceling timers");
-        }
-
-        heartbeat_timer_.cancel();
-        read_timeout_timer_.cancel();
+    // 停止定时器
+    heartbeat_timer_.cancel();
+    read_timeout_timer_.cancel();
 
-        if (close_callback_) {
-            if (LogManager::IsLoggingEnabled("tcp_session")) {
-                LogManager::GetLogger("tcp_session")->info("Calling close callback");
-            }
-            close_callback_();
-        }
+    if (close_callback_) {
+        // 回调可能持有本会话，调用后即释放
+        auto callback = std::move(close_callback_);
+        close_callback_ = nullptr;
+        callback();
+    }
 
-        if (LogManager::IsLoggingEnabled("tcp_session")) {
-            LogManager::GetLogger("tcp_session")
-                    ->info("🛑Session closed with remote endpoint: {}",
-                           remote_endpoint_.address().to_string());
-        }
-    } else {
-        if (LogManager::IsLoggingEnabled("tcp_session")) {
-            LogManager::GetLogger("tcp_session")
-                    ->info("Socket already closed for endpoint: {}",
-                           remote_endpoint_.address().to_string());
-        }
+    if (LogManager::IsLoggingEnabled("tcp_session")) {
+        LogManager::GetLogger("tcp_session")
+                ->info("🛑Session closed with remote endpoint: {}",
+                       remote_endpoint_.address().to_string());
     }
 }
 
 tcp::endpoint TCPSession::remote_endpoint() const { return remote_endpoint_; }
 
-void TCPSession::send(const std::string& message) {
-    // 将发送操作投递到套接字的执行器中，确保线程安全
-    net::post(socket_.get_executor(),
-              [this, self = shared_from_this(), msg = std::move(message)]() mutable {
-                  if (send_queue_.size() >= max_send_queue_size) {
-                      if (LogManager::IsLoggingEnabled("tcp_session")) {
-                          LogManager::GetLogger("tcp_session")
-                                  ->warn("Message dropped, send queue full:{}",
-                                         remote_endpoint().address().to_string());
-                      }
+void TCPSession::when_writable(std::size_t window, std::function<void(bool)> callback) {
+    net::post(stream_.get_executor(),
+              [self = shared_self(), window, callback = std::move(callback)]() mutable {
+                  if (self->closed_) {
+                      callback(false);
                       return;
                   }
+                  self->wait_writable(window, std::move(callback));
+              });
+}
 
-                  bool write_in_progress = !send_queue_.empty();
-                  send_queue_.emplace_back(std::move(msg));
+void TCPSession::send(const std::string& message) {
+    pending_sends_.fetch_add(1, std::memory_order_acq_rel);
+    // 将发送操作投递到套接字的执行器中，确保线程安全
+    net::post(stream_.get_executor(), [self = shared_self(), msg = message]() mutable {
+        self->enqueue(HeaderMsgType::NORMAL, std::move(msg));
+    });
+}
 
-                  // 如果没有正在写入的数据，则开始写入数据
-                  if (!write_in_progress) {
-                      do_write();
-                  }
-              });
+void TCPSession::enqueue(HeaderMsgType type, std::string body) {
+    const bool counted = type == HeaderMsgType::NORMAL;
+    if (closed_) {
+        if (counted) {
+            pending_sends_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        return;
+    }
+    if (send_queue_.size() >= max_send_queue_size) {
+        if (LogManager::IsLoggingEnabled("tcp_session")) {
+            LogManager::GetLogger("tcp_session")
+                    ->warn("Message dropped, send queue full:{}",
+                           remote_endpoint().address().to_string());
+        }
+        if (counted) {
+            pending_sends_.fetch_sub(1, std::memory_order_acq_rel);
+        }
+        return;
+    }
+
+    bool write_in_progress = !send_queue_.empty();
+    send_queue_.push_back(OutgoingFrame{type, std::move(body)});
+
+    // 如果没有正在写入的数据，则开始写入数据
+    if (!write_in_progress) {
+        do_write();
+    }
 }
 
 void TCPSession::set_close_callback(std::function<void()> callback) {
@@ -178,6 +246,10 @@ void TCPSession::set_message_handler(std::function<void(const std::string&)> cal
     message_handler_ = std::move(callback);
 }
 
+void TCPSession::set_auth_handler(std::function<void()> callback) {
+    auth_handler_ = std::move(callback);
+}
+
 void TCPSession::send_heartbeat(HeaderMsgType type) {
     if (type != HeaderMsgType::PING && type != HeaderMsgType::PONG) {
         if (LogManager::IsLoggingEnabled("tcp_session")) {
@@ -188,23 +260,8 @@ void TCPSession::send_heartbeat(HeaderMsgType type) {
         return;
     }
 
-    uint32_t length = 0;
-    // 问题：虽然变量名为uint8_t，但后续buffer操作使用sizeof(msg_type)仍为1字节
-    // 这里没有实际问题，但为了代码清晰度，明确使用uint8_t类型
-    uint8_t msg_type = static_cast<uint8_t>(type);
-
-    std::vector<net::const_buffer> buffers;
-    buffers.push_back(net::buffer(&length, sizeof(length)));
-    buffers.push_back(net::buffer(&msg_type, sizeof(msg_type)));
-
-    net::async_write(
-            socket_,
-            buffers,
-            [this, self = shared_from_this()](error_code ec, std::size_t bytes_transferred) {
-                if (ec) {
-                    handle_error(ec);
-                }
-            });
+    // 心跳帧只有帧头，与业务消息走同一个发送队列
+    enqueue(type, std::string());
 }
 
 
@@ -212,7 +269,7 @@ void TCPSession::handle_pong() {
     reset_read_timeout();
     if (LogManager::IsLoggingEnabled("tcp_session")) {
         LogManager::GetLogger("tcp_session")
-                ->info("handle_pong from {}", remote_endpoint_.address().to_string());
+                ->debug("handle_pong from {}", remote_endpoint_.address().to_string());
     }
 }
 void TCPSession::start_heartbeat() {
@@ -220,28 +277,18 @@ void TCPSession::start_heartbeat() {
     heartbeat_timer_.expires_after(heartbeat_interval);
 
     // 异步等待心跳定时器
-    heartbeat_timer_.async_wait([this, self = shared_from_this()](const error_code& ec) {
+    heartbeat_timer_.async_wait([this, self = shared_self()](const error_code& ec) {
         if (ec) {
-            if (LogManager::IsLoggingEnabled("tcp_session")) {
-                LogManager::GetLogger("tcp_session")
-                        ->info("Heartbeat timer cancelled: {}", ec.message());
-            }
             return;  // 定时器被取消
         }
 
-        if (!socket_.is_open()) {
+        if (closed_) {
             if (LogManager::IsLoggingEnabled("tcp_session")) {
                 LogManager::GetLogger("tcp_session")->info("Socket closed, stopping heartbeat");
             }
             return;
         }
 
-        // 发送心跳消息
-        if (LogManager::IsLoggingEnabled("tcp_session")) {
-            LogManager::GetLogger("tcp_session")
-                    ->info("Sending heartbeat to: {}", remote_endpoint().address().to_string());
-        }
-
         // 发送ping消息
         send_heartbeat();
 
@@ -250,23 +297,16 @@ void TCPSession::start_heartbeat() {
     });
 }
 
-void TCPSession::reset_read_timeout() {
-    // 设置读超时定时器
-    read_timeout_timer_.expires_after(read_timeout);
-    read_timeout_timer_.async_wait([this, self = shared_from_this()](const error_code& ec) {
-        if (ec) {
-            if (LogManager::IsLoggingEnabled("tcp_session")) {
-                LogManager::GetLogger("tcp_session")
-                        ->info("Read timeout timer cancelled: {}", ec.message());
-            }
-            return;  // 定时器被取消
+void TCPSession::start_read_deadline() {
+    read_timeout_timer_.expires_at(last_read_ + read_timeout);
+    read_timeout_timer_.async_wait([this, self = shared_self()](const error_code& ec) {
+        if (ec || closed_) {
+            return;  // 定时器被取消或连接已关闭
         }
 
-        if (!socket_.is_open()) {
-            if (LogManager::IsLoggingEnabled("tcp_session")) {
-                LogManager::GetLogger("tcp_session")
-                        ->info("Socket closed, stopping read timeout timer");
-            }
+        // 期间读到过数据，按最后一次读取的时间顺延
+        if (std::chrono::steady_clock::now() - last_read_ < read_timeout) {
+            start_read_deadline();
             return;
         }
 
@@ -276,28 +316,20 @@ void TCPSession::reset_read_timeout() {
                     ->warn("Read timeout, closing session with remote endpoint: {}",
                            remote_endpoint_.address().to_string());
         }
-        close();
+        do_close();
     });
 }
 
-
-void TCPSession::do_read_header() {
-    reset_read_timeout();  // 重置读超时定时器
-    if (LogManager::IsLoggingEnabled("tcp_session")) {
-        LogManager::GetLogger("tcp_session")
-                ->info("Starting to read header from: {}", remote_endpoint_.address().to_string());
-    }
+void TCPSession::reset_read_timeout() { last_read_ = std::chrono::steady_clock::now(); }
 
 
-    auto self(shared_from_this());
+void TCPSession::do_read_header() {
+    auto self(shared_self());
 
     // 异步读取消息头
-    net::async_read(socket_,
+    net::async_read(stream_,
                     net::buffer(header_),
-                    [this, self](error_code ec, std::size_t bytes_transferred) {
-                        // 取消读超时定时器
-                        read_timeout_timer_.cancel();
-
+                    [this, self](error_code ec, std::size_t /*bytes_transferred*/) {
                         if (ec) {
                             if (LogManager::IsLoggingEnabled("tcp_session")) {
                                 LogManager::GetLogger("tcp_session")
@@ -308,16 +340,15 @@ void TCPSession::do_read_header() {
                             handle_error(ec);
                             return;
                         }
+                        reset_read_timeout();
 
                         // 字节序转换,将网络字节序转换为本机字节序
-                        // uint32_t body_length =
-                        // ntohl(*reinterpret_cast<uint32_t*>(header_.data()));
                         // 使用memcpy安全解析长度
                         uint32_t body_length;
                         std::memcpy(&body_length, header_.data(), sizeof(body_length));
                         body_length = ntohl(body_length);
 
-                        uint8_t msg_type = *reinterpret_cast<uint8_t*>(&header_[4]);
+                        uint8_t msg_type = static_cast<uint8_t>(header_[4]);
 
                         // 检查消息长度是否合法
                         if (body_length > max_body_length) {
@@ -327,24 +358,32 @@ void TCPSession::do_read_header() {
                                                 body_length,
                                                 remote_endpoint().address().to_string());
                             }
-                            close();
+                            do_close();
                             return;
                         }
 
 
                         switch (msg_type) {
                             case static_cast<uint8_t>(HeaderMsgType::NORMAL):
-                                // 处理消息
                                 // 继续读取消息体
-                                if (LogManager::IsLoggingEnabled("tcp_session")) {
-                                    LogManager::GetLogger("tcp_session")
-                                            ->info("Header read, body length: {} from {}",
-                                                   body_length,
-                                                   remote_endpoint_.address().to_string());
-                                }
                                 do_read_body(body_length);
                                 return;
-                                break;
+
+                            case static_cast<uint8_t>(HeaderMsgType::AUTH):
+                                // token 只在连接开始时给一次
+                                if (!identity_.token.empty() || body_length == 0 ||
+                                    body_length > max_token_length) {
+                                    if (LogManager::IsLoggingEnabled("tcp_session")) {
+                                        LogManager::GetLogger("tcp_session")
+                                                ->warn("Invalid AUTH frame ({} bytes) from {}",
+                                                       body_length,
+                                                       remote_endpoint().address().to_string());
+                                    }
+                                    do_close();
+                                    return;
+                                }
+                                do_read_body(body_length, HeaderMsgType::AUTH);
+                                return;
 
                             case static_cast<uint8_t>(HeaderMsgType::PING):
                                 send_heartbeat(HeaderMsgType::PONG);
@@ -362,7 +401,7 @@ void TCPSession::do_read_header() {
                                                    msg_type,
                                                    remote_endpoint().address().to_string());
                                 }
-                                close();
+                                do_close();
                                 return;
                         }
                         do_read_header();
@@ -370,23 +409,15 @@ void TCPSession::do_read_header() {
 }
 
 
-void TCPSession::do_read_body(uint32_t length) {
-    reset_read_timeout();  // 重置读超时定时器
+void TCPSession::do_read_body(uint32_t length, HeaderMsgType type) {
+    auto self(shared_self());
 
-    auto self(shared_from_this());
-
-    // 问题：每次都重新分配body_buffer_可能导致性能问题
-    // 解决：复用缓冲区，仅在需要更大空间时才重新分配
-    if (length > body_buffer_.size()) {
-        body_buffer_.resize(length);
-    }
-
-    net::async_read(socket_,
-                    net::buffer(body_buffer_.data(), length),
-                    [this, self, length](error_code ec, size_t bytes_transferred) {
-                        // 取消读超时定时器
-                        read_timeout_timer_.cancel();
+    // 复用缓冲区，仅在需要更大空间时才重新分配
+    body_buffer_.resize(length);
 
+    net::async_read(stream_,
+                    net::buffer(body_buffer_),
+                    [this, self, type](error_code ec, size_t /*bytes_transferred*/) {
                         if (ec) {
                             if (LogManager::IsLoggingEnabled("tcp_session")) {
                                 LogManager::GetLogger("tcp_session")
@@ -397,16 +428,29 @@ void TCPSession::do_read_body(uint32_t length) {
                             handle_error(ec);
                             return;
                         }
+                        reset_read_timeout();
 
-                        // 构造消息
-                        std::string message(body_buffer_.data(), length);
-
-                        // 调用消息处理函数
-                        if (message_handler_) {
-                            message_handler_(message);
-                        } else {
+                        if (type == HeaderMsgType::AUTH) {
+                            identity_.token = body_buffer_;
+                            if (auth_handler_) {
+                                auth_handler_();
+                            }
+                        } else if (message_handler_) {
+                            // 调用消息处理函数
+                            message_handler_(body_buffer_);
+                        } else if (LogManager::IsLoggingEnabled("tcp_session")) {
                             LogManager::GetLogger("tcp_session")
-                                    ->warn("🟠Message handler not set,recved message:{}", message);
+                                    ->warn("🟠Message handler not set, dropped {} bytes",
+                                           body_buffer_.size());
+                        }
+
+                        if (body_buffer_.capacity() > max_retained_body_capacity) {
+                            std::string().swap(body_buffer_);
+                        }
+
+                        // 回调里可能已关闭连接
+                        if (closed_) {
+                            return;
                         }
                         // 继续读取下一条消息
                         do_read_header();
@@ -415,35 +459,39 @@ void TCPSession::do_read_body(uint32_t length) {
 
 
 void TCPSession::do_write() {
-    auto self(shared_from_this());
+    auto self(shared_self());
 
     //  从队列中获取一条消息
-    const std::string& message = send_queue_.front();
-
-    // 构造带长度前缀的消息
-    uint32_t length = htonl(static_cast<uint32_t>(message.size()));
-    // 问题：原代码使用static_cast<uint32_t>转换HeaderMsgType::NORMAL，导致msg_type占用4字节
-    // 解决：使用static_cast<uint8_t>确保msg_type字段为1字节
-    uint8_t msg_type = static_cast<uint8_t>(HeaderMsgType::NORMAL);
-    std::vector<net::const_buffer> buffers;
-    buffers.push_back(net::buffer(&length, sizeof(length)));
-    buffers.push_back(net::buffer(&msg_type, sizeof(msg_type)));
-    buffers.push_back(net::buffer(message));
+    const OutgoingFrame& frame = send_queue_.front();
+
+    // 构造带长度前缀的帧头，放在成员里，保证写完成前一直有效
+    uint32_t length = htonl(static_cast<uint32_t>(frame.body.size()));
+    std::memcpy(write_header_.data(), &length, sizeof(length));
+    write_header_[4] = static_cast<char>(frame.type);
+    std::array<net::const_buffer, 2> buffers{net::buffer(write_header_),
+                                             net::buffer(frame.body)};
 
     // 异步发送消息
-    net::async_write(socket_, buffers, [this, self](error_code ec, std::size_t bytes_transferred) {
+    net::async_write(stream_, buffers, [this, self](error_code ec, std::size_t /*bytes*/) {
+        if (closed_) {
+            return;
+        }
         if (ec) {
             handle_error(ec);
             return;
         }
 
         // 消息发送成功，从队列中删除
+        if (send_queue_.front().type == HeaderMsgType::NORMAL) {
+            pending_sends_.fetch_sub(1, std::memory_order_acq_rel);
+        }
         send_queue_.pop_front();
 
         if (!send_queue_.empty()) {
             // 队列中还有消息，继续发送
             do_write();
         }
+        on_send_completed();
     });
 }
 
@@ -451,7 +499,8 @@ void TCPSession::do_write() {
 void TCPSession::handle_error(const error_code& ec) {
     // 处理正常关闭的错误
     if (ec == net::error::eof || ec == net::error::connection_reset ||
-        ec == net::error::operation_aborted) {
+        ec == net::error::operation_aborted ||
+        ec == boost::asio::ssl::error::stream_truncated) {
         if (LogManager::IsLoggingEnabled("tcp_session")) {
             LogManager::GetLogger("tcp_session")->info("Connection closed: {}", ec.message());
         }
@@ -462,7 +511,7 @@ void TCPSession::handle_error(const error_code& ec) {
     }
 
     // 关闭会话
-    close();
+    do_close();
 }
 
 } // namespace network
@@ -12,12 +12,18 @@
  *****************************************************************************/
 
 #include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <deque>
 #include <functional>
 #include <memory>
-#include <vector>
+#include <string>
 #include "../utils/global.hpp"
+#include "client_session.hpp"
+#include "tls_transport_stream.hpp"
 
 namespace im {
 namespace network {
@@ -32,13 +38,15 @@ using error_code = boost::system::error_code;
  * @brief 表示一个TCP连接会话，处理该连接的所有通信
  *
  * 功能包括：
- * 1. 消息格式：4字节长度前缀 + 消息体（解决TCP粘包问题）
+ * 1. 消息格式：4字节长度前缀 + 1字节类型 + 消息体（解决TCP粘包问题）
  * 2. 心跳机制：定期发送心跳包保持连接活跃
  * 3. 超时管理：读操作超时自动断开连接
  * 4. 线程安全的异步消息发送队列
+ * 5. 可选 TLS：传入 ssl::context 时先完成服务端握手再读帧
+ * 6. 连接认证：AUTH 帧的消息体为 access token，作用同 WebSocket 握手里的 token 参数
  */
 
-class TCPSession : public std::enable_shared_from_this<TCPSession> {
+class TCPSession : public ClientSession {
 public:
     using Ptr = std::shared_ptr<TCPSession>;
 
@@ -46,18 +54,19 @@ public:
     /**
      * @brief 构造函数
      * @param socket 已建立的TCP套接字
+     * @param ssl_ctx 非空时走 TLS
      */
-    TCPSession(tcp::socket socket);
+    explicit TCPSession(tcp::socket socket, boost::asio::ssl::context* ssl_ctx = nullptr);
 
-    ~TCPSession() = default;
+    ~TCPSession() override = default;
 
     // 启动会话
     void start();
 
     /**
-     * @brief 关闭连接
+     * @brief 关闭连接（投递到会话的 I/O 线程执行，可从任意线程调用）
      */
-    void close();
+    void close() override;
 
     /**
      * @brief 获取远程端点信息
@@ -65,11 +74,19 @@ public:
      */
     tcp::endpoint remote_endpoint() const;
 
+    std::string get_client_ip() const override { return remote_endpoint_.address().to_string(); }
+
     /**
      * @brief 异步发送消息
      * @param message 要发送的消息内容
      */
-    void send(const std::string& message);
+    void send(const std::string& message) override;
+
+    std::size_t pending_sends() const override {
+        return pending_sends_.load(std::memory_order_acquire);
+    }
+
+    void when_writable(std::size_t window, std::function<void(bool)> callback) override;
 
 
     /**
@@ -84,6 +101,12 @@ public:
      */
     void set_message_handler(std::function<void(const std::string&)> callback);
 
+    /**
+     * @brief 设置收到 AUTH 帧后的回调，此时 get_token() 已是帧里的 token
+     * @param callback 回调函数
+     */
+    void set_auth_handler(std::function<void()> callback);
+
     // 发送ping
     void send_heartbeat(HeaderMsgType type = HeaderMsgType::PING);
 
@@ -91,40 +114,71 @@ public:
     void handle_pong();
 
 private:
+    // 握手完成（或无需握手）后开始收发
+    void on_ready();
+
+    // 关闭连接，只在会话的 I/O 线程上调用
+    void do_close();
+
     // 启动心跳检测
     void start_heartbeat();
 
+    // 启动读超时检测：一个定时器按最后一次读到数据的时间顺延，读帧时只记时间戳
+    void start_read_deadline();
 
-    // 重置读定时器
+    // 记录读到数据的时间
     void reset_read_timeout();
 
     // 读取消息头（4字节长度）
     void do_read_header();
 
     // 读取消息体
-    void do_read_body(uint32_t length);
+    void do_read_body(uint32_t length, HeaderMsgType type = HeaderMsgType::NORMAL);
 
     // 发送消息
     // void do_write(const std::string& message);
     void do_write();
 
+    // 心跳与消息共用发送队列，避免两个写操作交错
+    void enqueue(HeaderMsgType type, std::string body);
+
     void handle_error(const error_code& ec);
 
+    std::shared_ptr<TCPSession> shared_self() {
+        return std::static_pointer_cast<TCPSession>(shared_from_this());
+    }
+
+    static std::string generate_id() {
+        static std::atomic<size_t> counter{0};
+        return make_session_id("tcp_session_", ++counter);
+    }
+
 private:
     static constexpr std::chrono::seconds heartbeat_interval{30};  // 心跳间隔
     static constexpr std::chrono::seconds read_timeout{120};       // 读超时时间
     static constexpr size_t max_body_length = 10 * 1024 * 1024;    // 最大消息体长度
+    static constexpr size_t max_token_length = 4096;              // AUTH 帧最大长度
+
+    struct OutgoingFrame {
+        HeaderMsgType type;
+        std::string body;
+    };
 
-    tcp::socket socket_;                                    // TCP套接字
+    TlsTransportStream stream_;                             // TCP套接字（可选TLS）
     tcp::endpoint remote_endpoint_;                         // 远程端点信息
     net::steady_timer heartbeat_timer_;                     // 心跳定时器
     net::steady_timer read_timeout_timer_;                  // 读超时定时器
+    std::chrono::steady_clock::time_point last_read_;       // 最后一次读到数据的时间
 
-    std::array<char, HEADER_SIZE> header_;  // 消息头缓冲区
-    std::vector<char> body_buffer_;         // 消息体缓冲区
-    std::deque<std::string> send_queue_;    // 发送队列
+    std::array<char, HEADER_SIZE> header_;        // 消息头缓冲区
+    std::array<char, HEADER_SIZE> write_header_;  // 正在发送的帧头，需活到写完成
+    std::string body_buffer_;                     // 消息体缓冲区，一帧处理完即释放
+    std::deque<OutgoingFrame> send_queue_;        // 发送队列
+    std::atomic<std::size_t> pending_sends_{0};
+    bool closed_ = false;
 
     std::function<void(const std::string&)> message_handler_;  // 消息处理回调
+    std::function<void()> auth_handler_;                       // AUTH 帧回调
     std::function<void()> close_callback_;                     // 连接关闭回调
 };
 
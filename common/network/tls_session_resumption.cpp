@@ -0,0 +1,245 @@
+#include "tls_session_resumption.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#include <openssl/ssl.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#else
+#include <openssl/hmac.h>
+#endif
+
+#include "../utils/log_manager.hpp"
+
+namespace im {
+namespace network {
+
+using im::utils::LogManager;
+
+namespace {
+
+constexpr const char kSessionIdContext[] = "im-gateway";
+
+// 每个 SSL_CTX 上挂自己的密钥环，回调里按 SSL 反查
+int key_ring_ex_index() {
+    static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    return index;
+}
+
+TlsTicketKeyRing* key_ring_of(SSL* ssl) {
+    return static_cast<TlsTicketKeyRing*>(
+            SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), key_ring_ex_index()));
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+using TicketHmacCtx = EVP_MAC_CTX;
+
+bool init_ticket_hmac(TicketHmacCtx* hctx, const TlsTicketKeyRing::Key& key) {
+    char digest[] = "SHA256";
+    OSSL_PARAM params[] = {
+            OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+            OSSL_PARAM_construct_end(),
+    };
+    return EVP_MAC_init(hctx, key.hmac_secret.data(), key.hmac_secret.size(), params) == 1;
+}
+#else
+using TicketHmacCtx = HMAC_CTX;
+
+bool init_ticket_hmac(TicketHmacCtx* hctx, const TlsTicketKeyRing::Key& key) {
+    return HMAC_Init_ex(hctx, key.hmac_secret.data(), static_cast<int>(key.hmac_secret.size()),
+                        EVP_sha256(), nullptr) == 1;
+}
+#endif
+
+/**
+ * OpenSSL ticket 回调约定：
+ *   加密：填 key_name / iv，初始化 cipher 与 HMAC，返回 1；
+ *   解密：找不到密钥返回 0（退回完整握手），当前密钥返回 1，旧密钥返回 2
+ *         让 OpenSSL 用当前密钥重新签发 ticket；出错返回 -1。
+ */
+int ticket_key_callback(SSL* ssl, unsigned char* key_name, unsigned char* iv,
+                        EVP_CIPHER_CTX* cctx, TicketHmacCtx* hctx, int enc) {
+    TlsTicketKeyRing* ring = key_ring_of(ssl);
+    if (!ring) {
+        return -1;
+    }
+
+    const EVP_CIPHER* cipher = EVP_aes_256_cbc();
+    if (enc) {
+        TlsTicketKeyRing::Key key = ring->encryption_key();
+        if (RAND_bytes(iv, EVP_CIPHER_iv_length(cipher)) != 1) {
+            return -1;
+        }
+        std::memcpy(key_name, key.name.data(), key.name.size());
+        if (EVP_EncryptInit_ex(cctx, cipher, nullptr, key.aes_secret.data(), iv) != 1 ||
+            !init_ticket_hmac(hctx, key)) {
+            return -1;
+        }
+        return 1;
+    }
+
+    TlsTicketKeyRing::Key key;
+    bool is_current = false;
+    if (!ring->find_decryption_key(key_name, key, is_current)) {
+        return 0;
+    }
+    if (!init_ticket_hmac(hctx, key) ||
+        EVP_DecryptInit_ex(cctx, cipher, nullptr, key.aes_secret.data(), iv) != 1) {
+        return -1;
+    }
+    return is_current ? 1 : 2;
+}
+
+} // anonymous namespace
+
+TlsTicketKeyRing::TlsTicketKeyRing(const TlsSessionOptions& options)
+        : rotation_interval_(std::max<uint32_t>(options.ticket_key_rotation_sec, 60))
+        , key_file_(options.ticket_key_file)
+        // 当前密钥 + 足以覆盖会话有效期的旧密钥
+        , max_keys_(1 + std::max<size_t>(
+                                1, (options.session_timeout_sec + rotation_interval_.count() - 1) /
+                                           rotation_interval_.count())) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (key_file_.empty()) {
+        generate_key_locked();
+    } else {
+        load_file_locked();
+    }
+    next_rotation_ = std::chrono::steady_clock::now() + rotation_interval_;
+}
+
+TlsTicketKeyRing::Key TlsTicketKeyRing::encryption_key() {
+    return encryption_key(std::chrono::steady_clock::now());
+}
+
+TlsTicketKeyRing::Key TlsTicketKeyRing::encryption_key(std::chrono::steady_clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rotate_if_due_locked(now);
+    return keys_.front();
+}
+
+bool TlsTicketKeyRing::find_decryption_key(const unsigned char* name, Key& key,
+                                           bool& is_current) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < keys_.size(); ++i) {
+        if (std::memcmp(keys_[i].name.data(), name, kNameSize) == 0) {
+            key = keys_[i];
+            is_current = i == 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t TlsTicketKeyRing::rotations() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return rotations_;
+}
+
+void TlsTicketKeyRing::rotate_if_due_locked(std::chrono::steady_clock::time_point now) {
+    if (now < next_rotation_) {
+        return;
+    }
+    next_rotation_ = now + rotation_interval_;
+
+    if (key_file_.empty()) {
+        generate_key_locked();
+        ++rotations_;
+        return;
+    }
+
+    // 共享密钥：文件有变化才重新加载；加载失败沿用旧密钥，不影响在线握手
+    std::error_code ec;
+    auto mtime = std::filesystem::last_write_time(key_file_, ec);
+    if (ec || mtime == key_file_mtime_) {
+        return;
+    }
+    try {
+        load_file_locked();
+        ++rotations_;
+    } catch (const std::exception& e) {
+        LogManager::GetLogger("websocket_server")
+                ->warn("Reload TLS ticket key file {} failed: {}", key_file_, e.what());
+    }
+}
+
+void TlsTicketKeyRing::generate_key_locked() {
+    Key key;
+    if (RAND_bytes(key.name.data(), static_cast<int>(key.name.size())) != 1 ||
+        RAND_bytes(key.hmac_secret.data(), static_cast<int>(key.hmac_secret.size())) != 1 ||
+        RAND_bytes(key.aes_secret.data(), static_cast<int>(key.aes_secret.size())) != 1) {
+        throw std::runtime_error("RAND_bytes failed while generating TLS ticket key");
+    }
+    keys_.insert(keys_.begin(), key);
+    if (keys_.size() > max_keys_) {
+        keys_.resize(max_keys_);
+    }
+}
+
+void TlsTicketKeyRing::load_file_locked() {
+    std::ifstream in(key_file_, std::ios::binary);
+    if (!in) {
+        throw std::runtime_error("cannot open TLS ticket key file " + key_file_);
+    }
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (content.empty() || content.size() % kFileKeySize != 0) {
+        throw std::runtime_error("TLS ticket key file " + key_file_ +
+                                 " must contain a non-zero multiple of 80 bytes");
+    }
+
+    std::vector<Key> keys(content.size() / kFileKeySize);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        const char* p = content.data() + i * kFileKeySize;
+        std::memcpy(keys[i].name.data(), p, kNameSize);
+        std::memcpy(keys[i].hmac_secret.data(), p + kNameSize, kSecretSize);
+        std::memcpy(keys[i].aes_secret.data(), p + kNameSize + kSecretSize, kSecretSize);
+    }
+    keys_ = std::move(keys);
+
+    std::error_code ec;
+    key_file_mtime_ = std::filesystem::last_write_time(key_file_, ec);
+}
+
+std::unique_ptr<TlsTicketKeyRing> configure_tls_session_resumption(
+        boost::asio::ssl::context& ctx, const TlsSessionOptions& options) {
+    SSL_CTX* native = ctx.native_handle();
+
+    if (options.session_cache) {
+        SSL_CTX_set_session_cache_mode(native, SSL_SESS_CACHE_SERVER);
+        SSL_CTX_sess_set_cache_size(native, static_cast<long>(options.session_cache_size));
+    } else {
+        SSL_CTX_set_session_cache_mode(native, SSL_SESS_CACHE_OFF);
+    }
+    SSL_CTX_set_timeout(native, static_cast<long>(options.session_timeout_sec));
+    SSL_CTX_set_session_id_context(native,
+                                   reinterpret_cast<const unsigned char*>(kSessionIdContext),
+                                   sizeof(kSessionIdContext) - 1);
+
+    if (!options.session_tickets) {
+        SSL_CTX_set_options(native, SSL_OP_NO_TICKET);
+        return nullptr;
+    }
+
+    auto ring = std::make_unique<TlsTicketKeyRing>(options);
+    if (key_ring_ex_index() < 0 || SSL_CTX_set_ex_data(native, key_ring_ex_index(), ring.get()) != 1) {
+        throw std::runtime_error("failed to attach TLS ticket key ring to SSL_CTX");
+    }
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    if (SSL_CTX_set_tlsext_ticket_key_evp_cb(native, ticket_key_callback) != 1) {
+#else
+    if (SSL_CTX_set_tlsext_ticket_key_cb(native, ticket_key_callback) != 1) {
+#endif
+        throw std::runtime_error("failed to install TLS ticket key callback");
+    }
+    return ring;
+}
+
+} // namespace network
+} // namespace im
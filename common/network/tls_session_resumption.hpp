@@ -0,0 +1,108 @@
+#ifndef TLS_SESSION_RESUMPTION_HPP
+#define TLS_SESSION_RESUMPTION_HPP
+
+/******************************************************************************
+ *
+ * @file       tls_session_resumption.hpp
+ * @brief      TLS 会话复用：服务端 session cache 与 session ticket 密钥轮换
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * 移动端网络抖动后会集中重连，每条连接都做完整握手时 CPU 主要花在证书签名
+ * 和密钥交换上。这里给 ssl::context 配两种复用手段：
+ *
+ *   - 服务端 session cache：按 session id 复用，只在本进程内有效；
+ *   - session ticket：会话状态由服务端加密后交给客户端保存，加解密密钥由
+ *     TlsTicketKeyRing 管理。默认进程内随机生成并按周期轮换；配置了
+ *     ticket_key_file 时从文件加载（每 80 字节一把，格式同 nginx
+ *     ssl_session_ticket_key：16 字节名字 + 32 字节 HMAC 密钥 + 32 字节 AES
+ *     密钥，第一把用于加密），多个 gateway 实例共用同一文件即可互相复用，
+ *     文件由外部轮换，这里按轮换周期检查修改时间后重新加载。
+ *
+ * 轮换后旧密钥继续保留到足以覆盖 session_timeout_sec，用旧密钥解开的 ticket
+ * 会让 OpenSSL 重新签发新 ticket。
+ *
+ *****************************************************************************/
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/asio/ssl.hpp>
+
+namespace im {
+namespace network {
+
+struct TlsSessionOptions {
+    bool session_cache = true;
+    size_t session_cache_size = 20480;       // OpenSSL 内部缓存条目上限
+    uint32_t session_timeout_sec = 3600;     // 会话（含 ticket）有效期
+    bool session_tickets = true;
+    uint32_t ticket_key_rotation_sec = 3600; // 进程内密钥轮换 / 共享文件重新加载周期
+    std::string ticket_key_file;             // 为空时进程内生成密钥
+};
+
+class TlsTicketKeyRing {
+public:
+    static constexpr size_t kNameSize = 16;
+    static constexpr size_t kSecretSize = 32;
+    static constexpr size_t kFileKeySize = kNameSize + kSecretSize * 2;
+
+    struct Key {
+        std::array<unsigned char, kNameSize> name{};
+        std::array<unsigned char, kSecretSize> hmac_secret{};
+        std::array<unsigned char, kSecretSize> aes_secret{};
+    };
+
+    /// 失败时抛 std::runtime_error（随机数不可用、密钥文件缺失或格式错误）
+    explicit TlsTicketKeyRing(const TlsSessionOptions& options);
+
+    TlsTicketKeyRing(const TlsTicketKeyRing&) = delete;
+    TlsTicketKeyRing& operator=(const TlsTicketKeyRing&) = delete;
+
+    /// 当前加密密钥；到期时先轮换
+    Key encryption_key();
+
+    /// 同上，按给定时刻判断是否到期（测试用来跳过轮换周期）
+    Key encryption_key(std::chrono::steady_clock::time_point now);
+
+    /// 按名字查找解密密钥，is_current 表示是否为当前加密密钥
+    bool find_decryption_key(const unsigned char* name, Key& key, bool& is_current);
+
+    uint64_t rotations() const;
+
+private:
+    void rotate_if_due_locked(std::chrono::steady_clock::time_point now);
+    void generate_key_locked();
+    void load_file_locked();
+
+    const std::chrono::seconds rotation_interval_;
+    const std::string key_file_;
+    const size_t max_keys_;
+
+    mutable std::mutex mutex_;
+    std::vector<Key> keys_;  // keys_[0] 为当前加密密钥
+    std::chrono::steady_clock::time_point next_rotation_;
+    std::filesystem::file_time_type key_file_mtime_{};
+    uint64_t rotations_{0};
+};
+
+/**
+ * @brief 在 ctx 上应用 session cache / ticket 配置
+ *
+ * @return 启用 ticket 时返回密钥环，其生命周期必须长于 ctx；未启用时返回 nullptr
+ * @throws std::runtime_error 配置失败
+ */
+std::unique_ptr<TlsTicketKeyRing> configure_tls_session_resumption(
+        boost::asio::ssl::context& ctx, const TlsSessionOptions& options);
+
+} // namespace network
+} // namespace im
+
+#endif // TLS_SESSION_RESUMPTION_HPP
@@ -0,0 +1,229 @@
+#include "tls_transport_stream.hpp"
+
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+
+#include <openssl/err.h>
+
+namespace im {
+namespace network {
+
+namespace {
+
+namespace net = boost::asio;
+
+// 一条 TLS 记录的最大明文长度；拼接多段写缓冲时以此为上限
+constexpr std::size_t kMaxRecordPlaintext = 16 * 1024;
+
+int socket_fd(BIO* bio) {
+    return static_cast<int>(reinterpret_cast<intptr_t>(BIO_get_data(bio)));
+}
+
+bool would_block(int err) {
+    return err == EAGAIN || err == EWOULDBLOCK || err == EINTR;
+}
+
+int socket_bio_write(BIO* bio, const char* data, int len) {
+    BIO_clear_retry_flags(bio);
+    ssize_t n = ::send(socket_fd(bio), data, static_cast<std::size_t>(len), MSG_NOSIGNAL);
+    if (n < 0 && would_block(errno)) {
+        BIO_set_retry_write(bio);
+    }
+    return static_cast<int>(n);
+}
+
+int socket_bio_read(BIO* bio, char* data, int len) {
+    BIO_clear_retry_flags(bio);
+    ssize_t n = ::recv(socket_fd(bio), data, static_cast<std::size_t>(len), 0);
+    if (n < 0 && would_block(errno)) {
+        BIO_set_retry_read(bio);
+    }
+    return static_cast<int>(n);
+}
+
+long socket_bio_ctrl(BIO* /*bio*/, int cmd, long /*num*/, void* /*ptr*/) {
+    return cmd == BIO_CTRL_FLUSH ? 1 : 0;
+}
+
+// OpenSSL 自带的 socket BIO 用 write() 发送，对端已关闭时会触发 SIGPIPE
+const BIO_METHOD* socket_bio_method() {
+    static BIO_METHOD* method = [] {
+        BIO_METHOD* m = BIO_meth_new(BIO_get_new_index() | BIO_TYPE_SOURCE_SINK, "im socket");
+        BIO_meth_set_write(m, socket_bio_write);
+        BIO_meth_set_read(m, socket_bio_read);
+        BIO_meth_set_ctrl(m, socket_bio_ctrl);
+        return m;
+    }();
+    return method;
+}
+
+} // anonymous namespace
+
+TlsTransportStream::TlsTransportStream(boost::asio::ip::tcp::socket socket,
+                                       boost::asio::ssl::context& ctx)
+        : socket_(std::move(socket))
+        , ssl_(SSL_new(ctx.native_handle())) {
+    BIO* bio = ssl_ ? BIO_new(socket_bio_method()) : nullptr;
+    if (!bio) {
+        throw boost::system::system_error(
+                boost::system::error_code(static_cast<int>(ERR_get_error()),
+                                          net::error::get_ssl_category()),
+                "TlsTransportStream");
+    }
+    BIO_set_data(bio, reinterpret_cast<void*>(static_cast<intptr_t>(socket_.native_handle())));
+    BIO_set_init(bio, 1);
+    SSL_set_bio(ssl_.get(), bio, bio);
+
+    // 与 ssl::stream 的引擎一致；RELEASE_BUFFERS 让空闲连接不持有记录缓冲
+    SSL_set_mode(ssl_.get(), SSL_MODE_ENABLE_PARTIAL_WRITE |
+                                     SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER |
+                                     SSL_MODE_RELEASE_BUFFERS);
+    // 未打开的 socket 上的读写本来就会失败，构造时不必报错
+    if (socket_.is_open()) {
+        socket_.native_non_blocking(true);
+    }
+}
+
+void TlsTransportStream::set_handshake_type(handshake_type type) {
+    if (type == boost::asio::ssl::stream_base::client) {
+        SSL_set_connect_state(ssl_.get());
+    } else {
+        SSL_set_accept_state(ssl_.get());
+    }
+}
+
+TlsTransportStream::Step TlsTransportStream::step(Action action, void* data, std::size_t size,
+                                                  std::size_t& bytes,
+                                                  boost::beast::error_code& ec) {
+    bytes = 0;
+    ec = {};
+    if ((action == Action::Read || action == Action::Write) && size == 0) {
+        return Step::Done;
+    }
+
+    ERR_clear_error();
+    errno = 0;
+    int rc = 0;
+    switch (action) {
+        case Action::Handshake:
+            rc = SSL_do_handshake(ssl_.get());
+            break;
+        case Action::Read:
+            rc = SSL_read_ex(ssl_.get(), data, size, &bytes);
+            break;
+        case Action::Write:
+            rc = SSL_write_ex(ssl_.get(), data, size, &bytes);
+            break;
+        case Action::Shutdown:
+            rc = SSL_shutdown(ssl_.get());
+            // 0 表示 close_notify 已发出、尚未收到对端的，不再等待
+            if (rc == 0) {
+                rc = 1;
+            }
+            break;
+    }
+    if (rc == 1) {
+        return Step::Done;
+    }
+
+    const int saved_errno = errno;
+    switch (SSL_get_error(ssl_.get(), rc)) {
+        case SSL_ERROR_WANT_READ:
+            return Step::WantRead;
+        case SSL_ERROR_WANT_WRITE:
+            return Step::WantWrite;
+        case SSL_ERROR_ZERO_RETURN:
+            ec = net::error::eof;
+            break;
+        case SSL_ERROR_SYSCALL:
+            if (ERR_peek_error() == 0) {
+                ec = saved_errno != 0
+                             ? boost::beast::error_code(saved_errno,
+                                                        boost::system::system_category())
+                             : boost::beast::error_code(net::ssl::error::stream_truncated);
+                break;
+            }
+            [[fallthrough]];
+        default: {
+            unsigned long err = ERR_get_error();
+#ifdef SSL_R_UNEXPECTED_EOF_WHILE_READING
+            if (ERR_GET_REASON(err) == SSL_R_UNEXPECTED_EOF_WHILE_READING) {
+                ec = net::ssl::error::stream_truncated;
+                break;
+            }
+#endif
+            ec = boost::beast::error_code(static_cast<int>(err), net::error::get_ssl_category());
+            break;
+        }
+    }
+    return Step::Done;
+}
+
+std::size_t TlsTransportStream::run_sync(Action action, void* data, std::size_t size,
+                                         boost::beast::error_code& ec) {
+    std::size_t bytes = 0;
+    for (;;) {
+        switch (step(action, data, size, bytes, ec)) {
+            case Step::WantRead:
+                socket_.wait(net::socket_base::wait_read, ec);
+                break;
+            case Step::WantWrite:
+                socket_.wait(net::socket_base::wait_write, ec);
+                break;
+            case Step::Done:
+                return bytes;
+        }
+        if (ec) {
+            return 0;
+        }
+    }
+}
+
+void TlsTransportStream::shutdown(boost::beast::error_code& ec) {
+    ec = {};
+    if (!ssl_) {
+        return;
+    }
+    if (ktls_) {
+        send_ktls_close_notify(socket_.native_handle());
+        return;
+    }
+    if (!socket_.is_open() || SSL_is_init_finished(ssl_.get()) != 1) {
+        return;
+    }
+    std::size_t bytes = 0;
+    if (step(Action::Shutdown, nullptr, 0, bytes, ec) != Step::Done) {
+        ec = {};
+    }
+}
+
+boost::asio::const_buffer TlsTransportStream::flatten_into_scratch(
+        const boost::asio::const_buffer* begin, const boost::asio::const_buffer* end) {
+    if (begin->size() >= kMaxRecordPlaintext) {
+        return *begin;
+    }
+    thread_local unsigned char scratch[kMaxRecordPlaintext];
+    std::size_t used = 0;
+    for (auto it = begin; it != end && used < kMaxRecordPlaintext; ++it) {
+        const std::size_t n = std::min(it->size(), kMaxRecordPlaintext - used);
+        std::memcpy(scratch + used, it->data(), n);
+        used += n;
+    }
+    return {scratch, used};
+}
+
+void teardown(boost::beast::role_type /*role*/, TlsTransportStream& stream,
+              boost::beast::error_code& ec) {
+    // 同步关闭发生在 I/O 线程上，不像 TCP teardown 那样读到对端 EOF 再关
+    stream.shutdown(ec);
+    boost::beast::error_code ignored;
+    stream.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_send, ignored);
+    stream.socket().close(ec);
+}
+
+} // namespace network
+} // namespace im
@@ -0,0 +1,311 @@
+#ifndef TLS_TRANSPORT_STREAM_HPP
+#define TLS_TRANSPORT_STREAM_HPP
+
+/******************************************************************************
+ *
+ * @file       tls_transport_stream.hpp
+ * @brief      会话下层传输：用户态 TLS、内核 TLS（kTLS）或明文
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * 不使用 ssl::stream：它为每条连接固定持有两块 17KB 的密文暂存区，内部 BIO pair
+ * 再各占 17KB，连接空闲时也不释放，是空闲连接内存的大头。这里让 OpenSSL 直接
+ * 读写非阻塞 socket（自定义 BIO，send 带 MSG_NOSIGNAL），WANT_READ / WANT_WRITE
+ * 时用 socket.async_wait 等待就绪再重试。记录缓冲由 OpenSSL 按需分配，配合
+ * SSL_MODE_RELEASE_BUFFERS 空闲时归还，连接常驻只剩 SSL 对象本身。
+ *
+ * 启用 kTLS 后记录加解密由内核负责，读写直接走 tcp::socket。模式只在握手之后、
+ * 读写开始之前切换一次，读写接口按标志分派即可。不传 ssl::context 构造的是明文
+ * 流（原生 TCP 端口未开 TLS 时），读写同样直接走 socket，不做握手，shutdown 为空操作。
+ *
+ * next_layer() 返回 tcp::socket，beast::get_lowest_layer 能取到它（超时关闭依赖
+ * 它）。teardown / async_teardown 重载让 websocket::stream 关闭时先发
+ * close_notify 再关 TCP。
+ *
+ *****************************************************************************/
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core/error.hpp>
+#include <boost/beast/core/role.hpp>
+#include <boost/beast/websocket/teardown.hpp>
+
+#include "ktls.hpp"
+
+namespace im {
+namespace network {
+
+class TlsTransportStream {
+public:
+    using next_layer_type = boost::asio::ip::tcp::socket;
+    using executor_type = next_layer_type::executor_type;
+    using handshake_type = boost::asio::ssl::stream_base::handshake_type;
+
+    TlsTransportStream(boost::asio::ip::tcp::socket socket, boost::asio::ssl::context& ctx);
+
+    /// 明文流
+    explicit TlsTransportStream(boost::asio::ip::tcp::socket socket) noexcept
+            : socket_(std::move(socket)) {}
+
+    TlsTransportStream(const TlsTransportStream&) = delete;
+    TlsTransportStream& operator=(const TlsTransportStream&) = delete;
+
+    executor_type get_executor() noexcept { return socket_.get_executor(); }
+
+    next_layer_type& next_layer() noexcept { return socket_; }
+    const next_layer_type& next_layer() const noexcept { return socket_; }
+
+    boost::asio::ip::tcp::socket& socket() noexcept { return socket_; }
+    const boost::asio::ip::tcp::socket& socket() const noexcept { return socket_; }
+
+    SSL* native_handle() noexcept { return ssl_.get(); }
+
+    bool ktls() const noexcept { return ktls_; }
+
+    bool plain() const noexcept { return !ssl_; }
+
+    /// 握手完成后调用；Fallback 时保持用户态 TLS
+    KtlsResult enable_ktls(std::string& reason) {
+        KtlsResult result =
+                ::im::network::enable_ktls(ssl_.get(), socket_.native_handle(), reason);
+        ktls_ = result == KtlsResult::Enabled;
+        return result;
+    }
+
+    /// 尽力发送一次 close_notify，不等待对端回应（不会阻塞 I/O 线程）
+    void shutdown(boost::beast::error_code& ec);
+
+    void handshake(handshake_type type, boost::beast::error_code& ec) {
+        set_handshake_type(type);
+        run_sync(Action::Handshake, nullptr, 0, ec);
+    }
+
+    void handshake(handshake_type type) {
+        boost::beast::error_code ec;
+        handshake(type, ec);
+        if (ec) throw boost::system::system_error(ec);
+    }
+
+    template <class HandshakeToken>
+    auto async_handshake(handshake_type type, HandshakeToken&& token) {
+        set_handshake_type(type);
+        return boost::asio::async_compose<HandshakeToken, void(boost::beast::error_code)>(
+                IoOp<true>{*this, Action::Handshake, nullptr, 0}, token, socket_);
+    }
+
+    template <class MutableBufferSequence>
+    std::size_t read_some(const MutableBufferSequence& buffers, boost::beast::error_code& ec) {
+        if (direct()) {
+            return socket_.read_some(buffers, ec);
+        }
+        boost::asio::mutable_buffer buffer = first_buffer(buffers);
+        return run_sync(Action::Read, buffer.data(), buffer.size(), ec);
+    }
+
+    template <class MutableBufferSequence>
+    std::size_t read_some(const MutableBufferSequence& buffers) {
+        boost::beast::error_code ec;
+        std::size_t n = read_some(buffers, ec);
+        if (ec) throw boost::system::system_error(ec);
+        return n;
+    }
+
+    template <class ConstBufferSequence>
+    std::size_t write_some(const ConstBufferSequence& buffers, boost::beast::error_code& ec) {
+        if (direct()) {
+            return socket_.write_some(buffers, ec);
+        }
+        boost::asio::const_buffer buffer = flatten(buffers);
+        return run_sync(Action::Write, const_cast<void*>(buffer.data()), buffer.size(), ec);
+    }
+
+    template <class ConstBufferSequence>
+    std::size_t write_some(const ConstBufferSequence& buffers) {
+        boost::beast::error_code ec;
+        std::size_t n = write_some(buffers, ec);
+        if (ec) throw boost::system::system_error(ec);
+        return n;
+    }
+
+    template <class MutableBufferSequence, class ReadToken>
+    auto async_read_some(const MutableBufferSequence& buffers, ReadToken&& token) {
+        if (direct()) {
+            return socket_.async_read_some(buffers, std::forward<ReadToken>(token));
+        }
+        boost::asio::mutable_buffer buffer = first_buffer(buffers);
+        return boost::asio::async_compose<ReadToken,
+                                          void(boost::beast::error_code, std::size_t)>(
+                IoOp<false>{*this, Action::Read, buffer.data(), buffer.size()}, token, socket_);
+    }
+
+    template <class ConstBufferSequence, class WriteToken>
+    auto async_write_some(const ConstBufferSequence& buffers, WriteToken&& token) {
+        if (direct()) {
+            return socket_.async_write_some(buffers, std::forward<WriteToken>(token));
+        }
+        // 多段缓冲（帧头 + 负载）在每次重试时重新拼接，拼出的内容不变，满足
+        // OpenSSL 对 WANT_WRITE 后以相同数据重试的要求
+        return boost::asio::async_compose<WriteToken,
+                                          void(boost::beast::error_code, std::size_t)>(
+                WriteOp<ConstBufferSequence>{*this, buffers}, token, socket_);
+    }
+
+private:
+    enum class Action { Handshake, Read, Write, Shutdown };
+
+    /// 读写不经过 OpenSSL：kTLS 或明文
+    bool direct() const noexcept { return ktls_ || !ssl_; }
+    enum class Step { Done, WantRead, WantWrite };
+
+    struct SslDeleter {
+        void operator()(SSL* ssl) const noexcept { SSL_free(ssl); }
+    };
+
+    /// 调一次 OpenSSL；Done 时 ec 为结果，bytes 为读写的字节数
+    Step step(Action action, void* data, std::size_t size, std::size_t& bytes,
+              boost::beast::error_code& ec);
+
+    std::size_t run_sync(Action action, void* data, std::size_t size,
+                         boost::beast::error_code& ec);
+
+    void set_handshake_type(handshake_type type);
+
+    /// 不足一条记录的多段缓冲拼进线程局部暂存区，一次 SSL_write 写出
+    boost::asio::const_buffer flatten_into_scratch(const boost::asio::const_buffer* begin,
+                                                   const boost::asio::const_buffer* end);
+
+    template <class MutableBufferSequence>
+    static boost::asio::mutable_buffer first_buffer(const MutableBufferSequence& buffers) {
+        for (auto it = boost::asio::buffer_sequence_begin(buffers);
+             it != boost::asio::buffer_sequence_end(buffers); ++it) {
+            boost::asio::mutable_buffer buffer(*it);
+            if (buffer.size() != 0) {
+                return buffer;
+            }
+        }
+        return {};
+    }
+
+    template <class ConstBufferSequence>
+    boost::asio::const_buffer flatten(const ConstBufferSequence& buffers) {
+        constexpr std::size_t kMaxSegments = 8;
+        boost::asio::const_buffer segments[kMaxSegments];
+        std::size_t count = 0;
+        for (auto it = boost::asio::buffer_sequence_begin(buffers);
+             it != boost::asio::buffer_sequence_end(buffers); ++it) {
+            boost::asio::const_buffer buffer(*it);
+            if (buffer.size() == 0) {
+                continue;
+            }
+            if (count == kMaxSegments) {
+                break;
+            }
+            segments[count++] = buffer;
+        }
+        if (count <= 1) {
+            return count == 0 ? boost::asio::const_buffer{} : segments[0];
+        }
+        return flatten_into_scratch(segments, segments + count);
+    }
+
+    template <bool Handshake>
+    struct IoOp {
+        TlsTransportStream& stream;
+        Action action;
+        void* data;
+        std::size_t size;
+        enum class State { Starting, Waiting, Posted } state = State::Starting;
+        boost::beast::error_code result{};
+        std::size_t bytes = 0;
+
+        template <class Self>
+        void operator()(Self& self, boost::beast::error_code ec = {}) {
+            if (state == State::Posted) {
+                return finish(self);
+            }
+            if (state == State::Waiting && ec) {
+                result = ec;
+                return finish(self);
+            }
+            switch (stream.step(action, data, size, bytes, result)) {
+                case Step::WantRead:
+                    state = State::Waiting;
+                    stream.socket_.async_wait(boost::asio::socket_base::wait_read,
+                                              std::move(self));
+                    return;
+                case Step::WantWrite:
+                    state = State::Waiting;
+                    stream.socket_.async_wait(boost::asio::socket_base::wait_write,
+                                              std::move(self));
+                    return;
+                case Step::Done:
+                    break;
+            }
+            if (state == State::Starting) {
+                // 不在发起函数里直接回调
+                state = State::Posted;
+                boost::asio::post(stream.get_executor(), std::move(self));
+                return;
+            }
+            finish(self);
+        }
+
+        template <class Self>
+        void finish(Self& self) {
+            if constexpr (Handshake) {
+                self.complete(result);
+            } else {
+                self.complete(result, bytes);
+            }
+        }
+    };
+
+    template <class ConstBufferSequence>
+    struct WriteOp : IoOp<false> {
+        using State = typename IoOp<false>::State;
+
+        ConstBufferSequence buffers;
+
+        WriteOp(TlsTransportStream& s, const ConstBufferSequence& b)
+                : IoOp<false>{s, Action::Write, nullptr, 0}, buffers(b) {}
+
+        template <class Self>
+        void operator()(Self& self, boost::beast::error_code ec = {}) {
+            if (this->state != State::Posted && !(this->state == State::Waiting && ec)) {
+                boost::asio::const_buffer buffer = this->stream.flatten(buffers);
+                this->data = const_cast<void*>(buffer.data());
+                this->size = buffer.size();
+            }
+            IoOp<false>::operator()(self, ec);
+        }
+    };
+
+    boost::asio::ip::tcp::socket socket_;
+    std::unique_ptr<SSL, SslDeleter> ssl_;
+    bool ktls_ = false;
+};
+
+/// 发 close_notify（用户态或 kTLS）后关闭 TCP，不等待对端
+void teardown(boost::beast::role_type role, TlsTransportStream& stream,
+              boost::beast::error_code& ec);
+
+/// 发 close_notify 后按普通 TCP 连接收尾（读到对端 EOF 再关闭）
+template <class TeardownHandler>
+void async_teardown(boost::beast::role_type role, TlsTransportStream& stream,
+                    TeardownHandler&& handler) {
+    boost::beast::error_code ignored;
+    stream.shutdown(ignored);
+    boost::beast::websocket::async_teardown(role, stream.socket(),
+                                            std::forward<TeardownHandler>(handler));
+}
+
+} // namespace network
+} // namespace im
+
+#endif // TLS_TRANSPORT_STREAM_HPP
@@ -3,7 +3,10 @@
 
 #include "../utils/log_manager.hpp"
 
+#include <unistd.h>
+
 #include <algorithm>
+#include <fstream>
 #include <vector>
 
 namespace im {
@@ -11,11 +14,31 @@ namespace network {
 
 using im::utils::LogManager;
 
+namespace {
+
+uint64_t process_rss_bytes() {
+    std::ifstream statm("/proc/self/statm");
+    uint64_t size_pages = 0;
+    uint64_t resident_pages = 0;
+    if (!(statm >> size_pages >> resident_pages)) {
+        return 0;
+    }
+    return resident_pages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+}
+
+} // anonymous namespace
+
 WebSocketServer::WebSocketServer(net::io_context& ioc, ssl::context& ssl_ctx, unsigned short port,
                                  MessageHandler msg_handler)
         : acceptor_(ioc, tcp::endpoint(tcp::v4(), port))
         , ssl_ctx_(ssl_ctx)
-        , message_handler_(msg_handler) {}
+        , session_handlers_{std::move(msg_handler), nullptr, nullptr} {}
+
+WebSocketServer::WebSocketServer(ssl::context& ssl_ctx, tcp::acceptor acceptor,
+                                 MessageHandler msg_handler)
+        : acceptor_(std::move(acceptor))
+        , ssl_ctx_(ssl_ctx)
+        , session_handlers_{std::move(msg_handler), nullptr, nullptr} {}
 
 size_t WebSocketServer::get_session_count() const {
     std::lock_guard<std::mutex> lock(sessions_mutex_);
@@ -26,8 +49,20 @@ WebSocketServerStats WebSocketServer::get_stats() const {
     WebSocketServerStats stats;
     stats.accept_ok = accept_ok_.load(std::memory_order_relaxed);
     stats.accept_fail = accept_fail_.load(std::memory_order_relaxed);
+    stats.admitted = admitted_.load(std::memory_order_relaxed);
+    stats.deferred = deferred_.load(std::memory_order_relaxed);
+    stats.dropped = dropped_.load(std::memory_order_relaxed);
     stats.active_handshakes = active_handshakes_.load(std::memory_order_relaxed);
     stats.current_sessions = get_session_count();
+    stats.tls_full_handshakes = tls_full_handshakes_.load(std::memory_order_relaxed);
+    stats.tls_resumed_handshakes = tls_resumed_handshakes_.load(std::memory_order_relaxed);
+    stats.ktls_sessions = ktls_sessions_.load(std::memory_order_relaxed);
+    stats.ktls_fallbacks = ktls_fallbacks_.load(std::memory_order_relaxed);
+    // 粗略值：包含 start() 之后其他模块的增长，连接数多时由会话主导
+    const uint64_t rss = process_rss_bytes();
+    if (stats.current_sessions > 0 && rss > rss_at_start_) {
+        stats.rss_bytes_per_session = (rss - rss_at_start_) / stats.current_sessions;
+    }
 
     stats.ssl_handshake.count = ssl_handshake_count_.load(std::memory_order_relaxed);
     stats.ssl_handshake.total_ms = ssl_handshake_total_ms_.load(std::memory_order_relaxed);
@@ -69,6 +104,15 @@ void WebSocketServer::record_ssl_handshake(std::chrono::milliseconds duration) {
     record_duration(ssl_handshake_count_, ssl_handshake_total_ms_, ssl_handshake_max_ms_, duration);
 }
 
+void WebSocketServer::record_tls_session(bool resumed) {
+    (resumed ? tls_resumed_handshakes_ : tls_full_handshakes_)
+            .fetch_add(1, std::memory_order_relaxed);
+}
+
+void WebSocketServer::record_ktls(bool enabled) {
+    (enabled ? ktls_sessions_ : ktls_fallbacks_).fetch_add(1, std::memory_order_relaxed);
+}
+
 void WebSocketServer::record_upgrade_read(std::chrono::milliseconds duration) {
     record_duration(upgrade_read_count_, upgrade_read_total_ms_, upgrade_read_max_ms_, duration);
 }
@@ -97,6 +141,37 @@ void WebSocketServer::record_duration(std::atomic<uint64_t>& count,
     }
 }
 
+WebSocketServer::Admission WebSocketServer::admit(std::chrono::steady_clock::time_point now) {
+    if (limits_.max_pending_handshakes > 0 &&
+        active_handshakes_.load(std::memory_order_relaxed) >= limits_.max_pending_handshakes) {
+        return Admission::Drop;
+    }
+    if (limits_.max_accepts_per_sec == 0) {
+        return Admission::Admit;
+    }
+
+    const double rate = limits_.max_accepts_per_sec;
+    if (accept_refill_at_ == std::chrono::steady_clock::time_point{}) {
+        accept_tokens_ = rate;
+    } else {
+        const std::chrono::duration<double> elapsed = now - accept_refill_at_;
+        accept_tokens_ = std::min(rate, accept_tokens_ + elapsed.count() * rate);
+    }
+    accept_refill_at_ = now;
+    if (accept_tokens_ < 1.0) {
+        return Admission::Defer;
+    }
+    accept_tokens_ -= 1.0;
+    return Admission::Admit;
+}
+
+std::chrono::milliseconds WebSocketServer::pick_retry_after() {
+    const auto low = std::max<int64_t>(1, limits_.retry_after_min.count());
+    const auto high = std::max<int64_t>(low, limits_.retry_after_max.count());
+    return std::chrono::milliseconds(
+            std::uniform_int_distribution<int64_t>(low, high)(retry_rng_));
+}
+
 void WebSocketServer::do_accept() {
     acceptor_.async_accept([this](beast::error_code ec, tcp::socket socket) {
         if (ec) {
@@ -107,12 +182,28 @@ void WebSocketServer::do_accept() {
             return;
         }
         record_accept_ok();
-        auto session = std::make_shared<WebSocketSession>(
-                std::move(socket), ssl_ctx_, this, message_handler_);
-        session->start();
-        if (LogManager::IsLoggingEnabled("websocket_server")) {
-            LogManager::GetLogger("websocket_server")
-                    ->info("New WebSocket session created");
+        const Admission admission = admit();
+        if (admission == Admission::Drop) {
+            // 握手已经排满，再做 TLS 只会加重负载；客户端按自身退避重连
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            beast::error_code ignored;
+            socket.close(ignored);
+            do_accept();
+            return;
+        }
+        auto session = std::allocate_shared<WebSocketSession>(
+                im::utils::SlabStlAllocator<WebSocketSession>(),
+                std::move(socket), ssl_ctx_, this, &session_handlers_);
+        if (admission == Admission::Defer) {
+            deferred_.fetch_add(1, std::memory_order_relaxed);
+            session->start(pick_retry_after());
+        } else {
+            admitted_.fetch_add(1, std::memory_order_relaxed);
+            session->start();
+            if (LogManager::IsLoggingEnabled("websocket_server")) {
+                LogManager::GetLogger("websocket_server")
+                        ->info("New WebSocket session created");
+            }
         }
         // 继续接受下一个连接
         do_accept();
@@ -133,6 +224,7 @@ void WebSocketServer::start() {
         LogManager::GetLogger("websocket_server")
                 ->info("WebSocket server started on port {}", acceptor_.local_endpoint().port());
     }
+    rss_at_start_ = process_rss_bytes();
     do_accept();
 }
 
@@ -158,6 +250,23 @@ void WebSocketServer::stop() {
     });
 }
 
+void WebSocketServer::stop_accepting() {
+    net::post(acceptor_.get_executor(), [this] {
+        beast::error_code ignored;
+        acceptor_.close(ignored);
+    });
+}
+
+std::vector<SessionPtr> WebSocketServer::get_sessions() const {
+    std::vector<SessionPtr> sessions;
+    std::lock_guard lock(sessions_mutex_);
+    sessions.reserve(sessions_.size());
+    for (const auto& [id, session] : sessions_) {
+        sessions.push_back(session);
+    }
+    return sessions;
+}
+
 void WebSocketServer::add_session(SessionPtr session) {
     {
         std::lock_guard lock(sessions_mutex_);
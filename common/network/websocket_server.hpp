@@ -22,8 +22,11 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <random>
 #include <unordered_map>
+#include <vector>
 #include "../utils/thread_pool.hpp"
+#include "websocket_session.hpp"
 
 
 namespace im {
@@ -42,9 +45,6 @@ class WebSocketSession;
 class WebSocketServer;
 
 // 类型别名
-using SessionPtr = std::shared_ptr<WebSocketSession>;
-using MessageHandler = std::function<void(SessionPtr, beast::flat_buffer&&)>;
-using ErrorHandler = std::function<void(SessionPtr, beast::error_code)>;
 using ConnectHandler = std::function<void(SessionPtr)>;
 using DisconnectHandler = std::function<void(SessionPtr)>;
 
@@ -54,22 +54,41 @@ struct WebSocketDurationStats {
     uint64_t max_ms{0};
 };
 
+// 连接风暴时的准入控制，0 表示不限制
+struct WebSocketAdmissionLimits {
+    uint32_t max_accepts_per_sec = 0;     // 超出的连接握手后以 1013 关闭，告知重试间隔
+    uint32_t max_pending_handshakes = 0;  // 进行中的握手达到上限时直接断开 TCP
+    std::chrono::milliseconds retry_after_min{1000};
+    std::chrono::milliseconds retry_after_max{5000};
+};
+
 struct WebSocketServerStats {
     uint64_t accept_ok{0};
     uint64_t accept_fail{0};
+    uint64_t admitted{0};                // 通过准入、正常建立会话
+    uint64_t deferred{0};                // 超出速率，握手后以 1013 + retry_after_ms 关闭
+    uint64_t dropped{0};                 // 握手数达到上限，accept 后直接断开
     uint64_t active_handshakes{0};
     uint64_t current_sessions{0};
+    uint64_t tls_full_handshakes{0};     // 完整 TLS 握手
+    uint64_t tls_resumed_handshakes{0};  // session cache / ticket 复用的握手
+    uint64_t ktls_sessions{0};           // 握手后切到内核 TLS 的连接
+    uint64_t ktls_fallbacks{0};          // 开启 kTLS 但内核/套件不支持，退回用户态
+    uint64_t rss_bytes_per_session{0};   // start() 以来进程 RSS 增量 / 当前会话数
     WebSocketDurationStats ssl_handshake;
     WebSocketDurationStats upgrade_read;
     WebSocketDurationStats ws_accept;
     WebSocketDurationStats session_add;
 };
 
-class WebSocketServer {
+class WebSocketServer : public SessionLookup {
 public:
     WebSocketServer(net::io_context& ioc, ssl::context& ssl_ctx, unsigned short port,
                     MessageHandler msg_handler);
 
+    // 使用已在监听的 acceptor（热重启时从旧进程接手）
+    WebSocketServer(ssl::context& ssl_ctx, tcp::acceptor acceptor, MessageHandler msg_handler);
+
 
     void broadcast(const std::string& message);
 
@@ -77,6 +96,12 @@ public:
 
     void stop();
 
+    // 只关闭本进程的监听 fd，已建立的会话不受影响
+    void stop_accepting();
+
+    // 监听 socket，交给热重启的新进程
+    int listener_fd() { return acceptor_.native_handle(); }
+
     void add_session(SessionPtr session);
 
     void remove_session(SessionPtr session);
@@ -91,11 +116,20 @@ public:
     void record_handshake_started();
     void record_handshake_finished();
     void record_ssl_handshake(std::chrono::milliseconds duration);
+    void record_tls_session(bool resumed);
+    void record_ktls(bool enabled);
+
+    // 握手后把记录加解密交给内核，不支持时自动退回用户态；需在 start() 前设置
+    void set_ktls_enabled(bool enabled) { ktls_enabled_ = enabled; }
+    bool ktls_enabled() const { return ktls_enabled_; }
+
+    // 需在 start() 前设置
+    void set_admission_limits(const WebSocketAdmissionLimits& limits) { limits_ = limits; }
     void record_upgrade_read(std::chrono::milliseconds duration);
     void record_ws_accept(std::chrono::milliseconds duration);
     void record_session_add(std::chrono::milliseconds duration);
 
-    SessionPtr get_session(const std::string& session_id) const{
+    SessionPtr get_session(const std::string& session_id) const override {
         std::lock_guard<std::mutex> lock(sessions_mutex_);
         auto it = sessions_.find(session_id);
         if (it != sessions_.end()) {
@@ -104,6 +138,8 @@ public:
         return nullptr;
     }
 
+    std::vector<SessionPtr> get_sessions() const override;
+
     // 设置连接建立回调
     void set_connect_handler(ConnectHandler handler) {
         connect_handler_ = std::move(handler);
@@ -114,8 +150,15 @@ public:
         disconnect_handler_ = std::move(handler);
     }
 
+    enum class Admission { Admit, Defer, Drop };
+
+    // 按准入限制决定新连接的去向并消耗令牌；只在 accept 回调里调用，同一时间只有
+    // 一个 accept 在等待，不需要加锁。now 供测试控制令牌补充
+    Admission admit(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
 private:
     void do_accept();
+    std::chrono::milliseconds pick_retry_after();
     static void record_duration(std::atomic<uint64_t>& count,
                                 std::atomic<uint64_t>& total_ms,
                                 std::atomic<uint64_t>& max_ms,
@@ -126,13 +169,26 @@ private:
     ssl::context& ssl_ctx_;
     std::unordered_map<std::string, SessionPtr> sessions_;
     mutable std::mutex sessions_mutex_;
-    MessageHandler message_handler_;
+    SessionHandlers session_handlers_;  // 所有会话共用，会话只持有指针
+    uint64_t rss_at_start_ = 0;
     ConnectHandler connect_handler_;
     DisconnectHandler disconnect_handler_;
 
     std::atomic<uint64_t> accept_ok_{0};
     std::atomic<uint64_t> accept_fail_{0};
     std::atomic<uint64_t> active_handshakes_{0};
+    std::atomic<uint64_t> tls_full_handshakes_{0};
+    std::atomic<uint64_t> tls_resumed_handshakes_{0};
+    std::atomic<uint64_t> ktls_sessions_{0};
+    std::atomic<uint64_t> ktls_fallbacks_{0};
+    bool ktls_enabled_ = false;
+    WebSocketAdmissionLimits limits_;
+    double accept_tokens_ = 0;  // 令牌桶，容量为一秒的配额
+    std::chrono::steady_clock::time_point accept_refill_at_;
+    std::mt19937 retry_rng_{std::random_device{}()};
+    std::atomic<uint64_t> admitted_{0};
+    std::atomic<uint64_t> deferred_{0};
+    std::atomic<uint64_t> dropped_{0};
     std::atomic<uint64_t> ssl_handshake_count_{0};
     std::atomic<uint64_t> ssl_handshake_total_ms_{0};
     std::atomic<uint64_t> ssl_handshake_max_ms_{0};
@@ -2,6 +2,8 @@
 #include "websocket_session.hpp"
 #include "../utils/log_manager.hpp"
 
+#include <algorithm>
+
 namespace im {
 namespace network {
 
@@ -10,35 +12,53 @@ using im::utils::LogManager;
 static constexpr size_t max_send_queue_size = 1024;
 static constexpr auto websocket_handshake_timeout = std::chrono::seconds(15);
 static constexpr auto websocket_idle_timeout = std::chrono::seconds(30);
+// 被准入控制推迟的连接只等这么久的关闭握手，风暴期间不让它们占着连接
+static constexpr auto websocket_deferred_close_timeout = std::chrono::seconds(2);
 
 WebSocketSession::WebSocketSession(tcp::socket socket, ssl::context& ssl_ctx, WebSocketServer* server,
-                                   MessageHandler messageHandler,
-                                   ErrorHandler errorHandler)
-        : ws_stream_(std::move(socket), ssl_ctx)
+                                   const SessionHandlers* handlers)
+        : ClientSession({})
+        , ws_stream_(std::move(socket), ssl_ctx)
         , server_(server)
-        , message_handler_(messageHandler)
-        , error_handler_(errorHandler) {}
+        , handlers_(handlers) {}
+
+SessionHandlers& WebSocketSession::own_handlers() {
+    if (!own_handlers_) {
+        own_handlers_ = handlers_ ? std::make_unique<SessionHandlers>(*handlers_)
+                                  : std::make_unique<SessionHandlers>();
+        handlers_ = own_handlers_.get();
+    }
+    return *own_handlers_;
+}
 
 
-void WebSocketSession::start() {
+void WebSocketSession::start(std::chrono::milliseconds retry_after) {
+    reject_retry_after_ms_ = static_cast<uint32_t>(std::max<int64_t>(0, retry_after.count()));
+    // 与 TCPSession 一致禁用 Nagle：连续推送的小帧不必等上一帧的 ACK
+    beast::error_code nodelay_ec;
+    beast::get_lowest_layer(ws_stream_).set_option(tcp::no_delay(true), nodelay_ec);
     handshake_active_.store(true, std::memory_order_release);
     if (server_) {
         server_->record_handshake_started();
     }
-    ssl_handshake_start_ = std::chrono::steady_clock::now();
+    handshake_phase_start_ = std::chrono::steady_clock::now();
     ws_stream_.next_layer().async_handshake(
             ssl::stream_base::server,
-            [self = shared_from_this()](beast::error_code ec) {
+            [self = shared_self()](beast::error_code ec) {
                 if (self->server_) {
-                    self->server_->record_ssl_handshake(
-                            std::chrono::duration_cast<std::chrono::milliseconds>(
-                                    std::chrono::steady_clock::now() -
-                                    self->ssl_handshake_start_));
+                    self->server_->record_ssl_handshake(self->handshake_phase_elapsed());
                 }
                 if (ec) {
                     self->fail_and_close(ec, "WebSocket SSL handshake failed");
                     return;
                 }
+                if (self->server_) {
+                    self->server_->record_tls_session(
+                            SSL_session_reused(self->ws_stream_.next_layer().native_handle()) == 1);
+                }
+                if (!self->try_enable_ktls()) {
+                    return;
+                }
                 self->on_ssl_handshake();
             }
 
@@ -48,24 +68,49 @@ void WebSocketSession::start() {
 
 
 void WebSocketSession::close() {
-    net::post(ws_stream_.get_executor(), [self = shared_from_this()]() {
+    net::post(ws_stream_.get_executor(), [self = shared_self()]() {
         self->perform_close(true, {}, "WebSocket close requested");
     });
 }
 
+void WebSocketSession::close_for_restart(std::chrono::milliseconds reconnect_after) {
+    net::post(ws_stream_.get_executor(), [self = shared_self(), reconnect_after]() {
+        websocket::close_reason reason(websocket::close_code::service_restart);
+        reason.reason = "reconnect_after_ms=" + std::to_string(reconnect_after.count());
+        self->perform_close(true, {}, "WebSocket closed for restart", reason);
+    });
+}
+
+void WebSocketSession::when_writable(std::size_t window, std::function<void(bool)> callback) {
+    net::post(ws_stream_.get_executor(),
+              [self = shared_self(), window, callback = std::move(callback)]() mutable {
+                  if (self->closed_.load(std::memory_order_acquire)) {
+                      callback(false);
+                      return;
+                  }
+                  self->wait_writable(window, std::move(callback));
+              });
+}
+
 void WebSocketSession::send(const std::string& message) {
+    pending_sends_.fetch_add(1, std::memory_order_acq_rel);
     net::post(ws_stream_.get_executor(),
-              [self = shared_from_this(), msg = std::move(message)]() mutable {
+              [self = shared_self(), msg = std::move(message)]() mutable {
                   if (self->closed_.load(std::memory_order_acquire)) {
+                      self->pending_sends_.fetch_sub(1, std::memory_order_acq_rel);
                       return;
                   }
-                  if (self->send_queue_.size() >= max_send_queue_size) {
+                  if (self->send_queue_ && self->send_queue_->size() >= max_send_queue_size) {
+                      self->pending_sends_.fetch_sub(1, std::memory_order_acq_rel);
                       self->fail_and_close({}, "Send queue overflow");
                       return;
                   }
                   // 将消息添加到发送队列
-                  self->send_queue_.emplace_back(std::move(msg));
-                  if (self->send_queue_.size() == 1) {
+                  if (!self->send_queue_) {
+                      self->send_queue_.emplace();
+                  }
+                  self->send_queue_->emplace_back(std::move(msg));
+                  if (self->send_queue_->size() == 1) {
                       self->do_write();
                   }
               });
@@ -73,18 +118,40 @@ void WebSocketSession::send(const std::string& message) {
 
 
 
+bool WebSocketSession::try_enable_ktls() {
+    if (!server_ || !server_->ktls_enabled()) {
+        return true;
+    }
+
+    std::string reason;
+    switch (ws_stream_.next_layer().enable_ktls(reason)) {
+        case KtlsResult::Enabled:
+            server_->record_ktls(true);
+            return true;
+        case KtlsResult::Fallback:
+            server_->record_ktls(false);
+            if (LogManager::IsLoggingEnabled("websocket_session")) {
+                LogManager::GetLogger("websocket_session")
+                        ->debug("kTLS not enabled, using userspace TLS: {}", reason);
+            }
+            return true;
+        case KtlsResult::Broken:
+            break;
+    }
+    server_->record_ktls(false);
+    fail_and_close({}, "kTLS setup failed: " + reason);
+    return false;
+}
+
 void WebSocketSession::on_ssl_handshake() {
     // 手动读取HTTP升级请求以便在握手前提取token，然后使用该请求完成WS握手
-    auto self = shared_from_this();
+    auto self = shared_self();
     auto req = std::make_shared<beast::http::request<beast::http::string_body>>();
-    upgrade_read_start_ = std::chrono::steady_clock::now();
+    handshake_phase_start_ = std::chrono::steady_clock::now();
     beast::http::async_read(ws_stream_.next_layer(), buffer_, *req,
         [self, req](beast::error_code ec, std::size_t /*bytes_transferred*/) {
             if (self->server_) {
-                self->server_->record_upgrade_read(
-                        std::chrono::duration_cast<std::chrono::milliseconds>(
-                                std::chrono::steady_clock::now() -
-                                self->upgrade_read_start_));
+                self->server_->record_upgrade_read(self->handshake_phase_elapsed());
             }
             if (ec) {
                 self->fail_and_close(ec, "Read websocket upgrade request failed");
@@ -100,21 +167,39 @@ void WebSocketSession::on_ssl_handshake() {
                 if (end == std::string::npos) {
                     end = target.length();
                 }
-                self->token_ = target.substr(start, end - start);
+                self->identity_.token = target.substr(start, end - start);
             }
             // 也可以从Authorization头部获取Token
             auto auth_it = req->find(beast::http::field::authorization);
             if (auth_it != req->end()) {
                 std::string auth_value = std::string(auth_it->value());
                 if (auth_value.rfind("Bearer ", 0) == 0) {
-                    self->token_ = auth_value.substr(7);
+                    self->identity_.token = auth_value.substr(7);
                 }
             }
 
+            // 客户端在子协议列表中带上 im.v2 即使用 v2 帧格式，响应中回显选中的子协议；
+            // 列表可能分在多个头里，逐项精确匹配
+            bool offers_v2 = false;
+            auto protocols = req->equal_range(beast::http::field::sec_websocket_protocol);
+            for (auto it = protocols.first; it != protocols.second && !offers_v2; ++it) {
+                offers_v2 = offers_subprotocol(
+                        std::string_view(it->value().data(), it->value().size()),
+                        kWireV2Subprotocol);
+            }
+            if (offers_v2) {
+                self->wire_version_ = WireVersion::V2;
+                self->ws_stream_.set_option(websocket::stream_base::decorator(
+                        [](websocket::response_type& res) {
+                            res.set(beast::http::field::sec_websocket_protocol,
+                                    kWireV2Subprotocol);
+                        }));
+            }
+
             if (LogManager::IsLoggingEnabled("websocket_session")) {
                 LogManager::GetLogger("websocket_session")
                         ->debug("Extracted token from handshake: {}",
-                                self->token_.empty() ? "none" : "present");
+                                self->identity_.token.empty() ? "none" : "present");
             }
 
             websocket::stream_base::timeout timeout_opt;
@@ -157,18 +242,28 @@ void WebSocketSession::on_ssl_handshake() {
             });
 
             // 使用解析到的请求完成WebSocket握手
-            self->ws_accept_start_ = std::chrono::steady_clock::now();
+            self->handshake_phase_start_ = std::chrono::steady_clock::now();
             self->ws_stream_.async_accept(*req, [self](beast::error_code ec2) {
                 if (self->server_) {
-                    self->server_->record_ws_accept(
-                            std::chrono::duration_cast<std::chrono::milliseconds>(
-                                    std::chrono::steady_clock::now() -
-                                    self->ws_accept_start_));
+                    self->server_->record_ws_accept(self->handshake_phase_elapsed());
                 }
                 if (ec2) {
                     self->fail_and_close(ec2, "WebSocket handshake failed");
                     return;
                 }
+                if (self->reject_retry_after_ms_ > 0) {
+                    websocket::close_reason reason(websocket::close_code::try_again_later);
+                    reason.reason = "retry_after_ms=" + std::to_string(self->reject_retry_after_ms_);
+                    // 1013 只能在 WebSocket 握手后发出（浏览器看不到 HTTP 503 的 Retry-After）；
+                    // 关闭握手异步进行，超时改短，对端不回关闭帧时尽快断开
+                    websocket::stream_base::timeout close_timeout;
+                    close_timeout.handshake_timeout = websocket_deferred_close_timeout;
+                    close_timeout.idle_timeout = websocket::stream_base::none();
+                    close_timeout.keep_alive_pings = false;
+                    self->ws_stream_.set_option(close_timeout);
+                    self->perform_close(true, {}, "WebSocket deferred by admission control", reason);
+                    return;
+                }
                 // 清空HTTP读取时的缓冲
                 self->buffer_.consume(self->buffer_.size());
                 // 使用二进制帧进行通信（protobuf）
@@ -185,7 +280,7 @@ void WebSocketSession::on_ssl_handshake() {
                 if (LogManager::IsLoggingEnabled("websocket_session")) {
                     LogManager::GetLogger("websocket_session")
                             ->info("Session {} successfully added to server, token: {}",
-                                   self->session_id_, self->token_.empty() ? "none" : "present");
+                                   self->session_id_, self->identity_.token.empty() ? "none" : "present");
                 }
                 self->do_read();
             });
@@ -193,18 +288,20 @@ void WebSocketSession::on_ssl_handshake() {
 }
 
 void WebSocketSession::do_read() {
-    ws_stream_.async_read(buffer_, [self = shared_from_this()](beast::error_code ec,
+    ws_stream_.async_read(buffer_, [self = shared_self()](beast::error_code ec,
                                                                std::size_t bytes_transferred) {
         if (ec) {
             self->fail_and_close(ec, "WebSocket read failed");
             return;
         }
-        if (self->message_handler_) {
-            self->message_handler_(self, std::move(self->buffer_));
+        // 回调拿到的是借来的 flat_buffer，读完即归还线程池
+        beast::flat_buffer& frame = self->buffer_.get();
+        if (self->handlers_ && self->handlers_->on_message) {
+            self->handlers_->on_message(self, std::move(frame));
         } else {
-            self->defaultMessageHandler(self, std::move(self->buffer_));
+            self->defaultMessageHandler(self, std::move(frame));
         }
-        self->buffer_.consume(self->buffer_.size());  // 清空缓冲区
+        self->buffer_.release();
         // 继续读取下一个消息
         self->do_read();
     });
@@ -213,16 +310,20 @@ void WebSocketSession::do_read() {
 
 void WebSocketSession::do_write() {
     ws_stream_.async_write(
-            net::buffer(send_queue_.front()),
-            [self = shared_from_this()](beast::error_code ec, std::size_t bytes_transferred) {
+            net::buffer(send_queue_->front()),
+            [self = shared_self()](beast::error_code ec, std::size_t bytes_transferred) {
                 if (ec) {
                     self->fail_and_close(ec, "WebSocket write failed");
                     return;
                 }
-                self->send_queue_.pop_front();
-                if (!self->send_queue_.empty()) {
+                self->send_queue_->pop_front();
+                self->pending_sends_.fetch_sub(1, std::memory_order_acq_rel);
+                if (!self->send_queue_->empty()) {
                     self->do_write();  // 继续发送下一个消息
+                } else {
+                    self->send_queue_.reset();
                 }
+                self->on_send_completed();
             });
 }
 
@@ -243,13 +344,14 @@ void WebSocketSession::defaultErrorHandler(SessionPtr session, beast::error_code
 }
 
 void WebSocketSession::fail_and_close(beast::error_code ec, const std::string& ec_msg) {
-    net::post(ws_stream_.get_executor(), [self = shared_from_this(), ec, ec_msg]() {
+    net::post(ws_stream_.get_executor(), [self = shared_self(), ec, ec_msg]() {
         self->perform_close(false, ec, ec_msg);
     });
 }
 
 void WebSocketSession::perform_close(bool graceful, beast::error_code ec,
-                                     const std::string& ec_msg) {
+                                     const std::string& ec_msg,
+                                     const websocket::close_reason& reason) {
     bool expected = false;
     if (!closed_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
         return;
@@ -266,20 +368,32 @@ void WebSocketSession::perform_close(bool graceful, beast::error_code ec,
         }
     }
 
-    send_queue_.clear();
-    buffer_.consume(buffer_.size());
+    if (send_queue_) {
+        pending_sends_.fetch_sub(send_queue_->size(), std::memory_order_acq_rel);
+        send_queue_.reset();
+    }
+    release_writable_waiter();
+    // 读缓冲可能仍被挂起的读操作引用，留到会话析构时归还
 
-    beast::error_code ignored_ec;
-    if (graceful) {
-        ws_stream_.close(websocket::close_code::normal, ignored_ec);
-        if (ignored_ec && LogManager::IsLoggingEnabled("websocket_session")) {
+    if (!graceful) {
+        finish_close();
+        return;
+    }
+
+    // 异步关闭握手，受流上的超时选项约束（握手超时同样限制关闭），对端不回关闭帧也不会
+    // 阻塞 I/O 线程；完成前会话保持注册，排空（drain）会等到传输真正断开
+    ws_stream_.async_close(reason, [self = shared_self()](beast::error_code close_ec) {
+        if (close_ec && LogManager::IsLoggingEnabled("websocket_session")) {
             LogManager::GetLogger("websocket_session")
-                    ->warn("WebSocket graceful close failed: {}", ignored_ec.message());
+                    ->warn("WebSocket graceful close failed: {}", close_ec.message());
         }
-    }
+        self->finish_close();
+    });
+}
 
-    auto& ssl_stream = ws_stream_.next_layer();
-    ssl_stream.shutdown(ignored_ec);
+void WebSocketSession::finish_close() {
+    beast::error_code ignored_ec;
+    ws_stream_.next_layer().shutdown(ignored_ec);
     auto& socket = beast::get_lowest_layer(ws_stream_);
     socket.cancel(ignored_ec);
     socket.shutdown(tcp::socket::shutdown_both, ignored_ec);
@@ -289,8 +403,8 @@ void WebSocketSession::perform_close(bool graceful, beast::error_code ec,
         server_->remove_session(shared_from_this());
     }
 
-    if (close_callback_) {
-        close_callback_(shared_from_this());
+    if (handlers_ && handlers_->on_close) {
+        handlers_->on_close(shared_from_this());
     }
 }
 
@@ -302,7 +416,7 @@ void WebSocketSession::finish_handshake_tracking() {
 
 std::string WebSocketSession::get_client_ip() const {
     try {
-        auto remote_endpoint = ws_stream_.next_layer().next_layer().remote_endpoint();
+        auto remote_endpoint = ws_stream_.next_layer().socket().remote_endpoint();
         return remote_endpoint.address().to_string();
     } catch (const std::exception& e) {
         if (LogManager::IsLoggingEnabled("websocket_session")) {
@@ -22,10 +22,16 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 
+#include "../utils/slab_allocator.hpp"
 #include "../utils/thread_pool.hpp"
+#include "client_session.hpp"
+#include "pooled_flat_buffer.hpp"
+#include "tls_transport_stream.hpp"
+#include "wire_format.hpp"
 
 
 namespace im {
@@ -42,46 +48,58 @@ class WebSocketSession;
 class WebSocketServer;
 
 // 类型别名
-using SessionPtr = std::shared_ptr<WebSocketSession>;
 using MessageHandler = std::function<void(SessionPtr, beast::flat_buffer&&)>;
 using ErrorHandler = std::function<void(SessionPtr, beast::error_code)>;
 using CloseHandler = std::function<void(SessionPtr)>;
 
-class WebSocketSession : public std::enable_shared_from_this<WebSocketSession> {
+// 所有会话共用的回调，由 WebSocketServer 持有，会话只保存指针
+struct SessionHandlers {
+    MessageHandler on_message;
+    ErrorHandler on_error;
+    CloseHandler on_close;
+};
+
+class WebSocketSession : public ClientSession {
 public:
     explicit WebSocketSession(tcp::socket socket, ssl::context& ssl_ctx, WebSocketServer* server,
-                              MessageHandler messageHandler = nullptr,
-                              ErrorHandler errorHandler = nullptr);
+                              const SessionHandlers* handlers = nullptr);
+
+    ~WebSocketSession() override = default;
 
-    ~WebSocketSession() = default;
+    // retry_after 非零表示被准入控制推迟：完成握手后立即以 1013（try again later）
+    // 和 "retry_after_ms=N" 关闭，不注册会话，不触发鉴权和连接回调
+    void start(std::chrono::milliseconds retry_after = std::chrono::milliseconds::zero());
 
-    void start();
+    void close() override;
 
-    void close();
+    // 关闭帧带 1012（service restart）和 "reconnect_after_ms=N"
+    void close_for_restart(std::chrono::milliseconds reconnect_after) override;
 
-    void send(const std::string& message);
+    void send(const std::string& message) override;
 
+    // 已提交但尚未写完的帧数（含尚未进入队列的 post），批量推送据此做流控。
+    std::size_t pending_sends() const override {
+        return pending_sends_.load(std::memory_order_acquire);
+    }
 
-    const std::string& get_session_id() const { return session_id_; }
+    void when_writable(std::size_t window, std::function<void(bool)> callback) override;
 
     const WebSocketServer* get_server() const { return server_; }
-    
-    // 获取握手时的Token（从URL查询参数或头部）
-    const std::string& get_token() const { return token_; }
-    
+
     // 获取客户端IP地址
-    std::string get_client_ip() const;
+    std::string get_client_ip() const override;
 
+    // 单个会话改回调时才复制出独立的一份，其余会话继续共用服务器的
     void set_message_handler(MessageHandler &messageHandler) {
-        message_handler_ = std::move(messageHandler);
+        own_handlers().on_message = std::move(messageHandler);
     }
 
     void set_error_handler(ErrorHandler &errorHandler) {
-        error_handler_ = std::move(errorHandler);
+        own_handlers().on_error = std::move(errorHandler);
     }
 
     void set_close_handler(CloseHandler &closeHandler) {
-        close_callback_ = std::move(closeHandler);
+        own_handlers().on_close = std::move(closeHandler);
     }
 
 private:
@@ -91,38 +109,60 @@ private:
 
     void on_ssl_handshake();
 
+    // 握手后按配置尝试切到 kTLS；返回 false 表示连接已不可用
+    bool try_enable_ktls();
+
     void do_read();
 
     void do_write();
 
     void fail_and_close(beast::error_code ec, const std::string& ec_msg);
 
-    void perform_close(bool graceful, beast::error_code ec, const std::string& ec_msg);
+    void perform_close(bool graceful, beast::error_code ec, const std::string& ec_msg,
+                       const websocket::close_reason& reason = websocket::close_code::normal);
+
+    // 断开传输、注销会话并回调 on_close；优雅关闭时在关闭握手结束后调用
+    void finish_close();
 
     void finish_handshake_tracking();
 
+    // 记录握手各阶段耗时；阶段依次进行，共用一个起点
+    std::chrono::milliseconds handshake_phase_elapsed() const {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - handshake_phase_start_);
+    }
+
+    SessionHandlers& own_handlers();
+
+    std::shared_ptr<WebSocketSession> shared_self() {
+        return std::static_pointer_cast<WebSocketSession>(shared_from_this());
+    }
+
     static std::string generate_id() {
         static std::atomic<size_t> counter{0};
-        return "session_" + std::to_string(++counter);
+        return make_session_id("session_", ++counter);
     }
 
 private:
-    websocket::stream<ssl_stream> ws_stream_;
-    beast::flat_buffer buffer_;
-    std::deque<std::string> send_queue_;
+    using SendQueue = std::deque<std::string, im::utils::SlabStlAllocator<std::string>>;
+
+    websocket::stream<TlsTransportStream> ws_stream_;
+    // 只在读帧期间从线程池借缓冲，空闲时不占内存
+    PooledFlatBuffer buffer_;
+    // 队列节点块走 slab 线程缓存；帧内容仍由调用方构造的 std::string 持有。
+    // 空 deque 也会持有一个节点块，所以发完即释放，有数据要发时再建。
+    std::optional<SendQueue> send_queue_;
+    std::atomic<std::size_t> pending_sends_{0};
     WebSocketServer* server_;
-    MessageHandler message_handler_;
-    ErrorHandler error_handler_;
-    CloseHandler close_callback_;
+    const SessionHandlers* handlers_;
+    std::unique_ptr<SessionHandlers> own_handlers_;
 
-    std::string session_id_;
-    std::string token_;  // 从握手请求中提取的Token
+    // 基类的 session_id_ 在 WebSocket 握手完成后生成，identity_.token 取自握手请求
     std::atomic_bool closed_{false};
     std::atomic_bool registered_{false};
     std::atomic_bool handshake_active_{false};
-    std::chrono::steady_clock::time_point ssl_handshake_start_;
-    std::chrono::steady_clock::time_point upgrade_read_start_;
-    std::chrono::steady_clock::time_point ws_accept_start_;
+    uint32_t reject_retry_after_ms_ = 0;
+    std::chrono::steady_clock::time_point handshake_phase_start_;
 };
 
 } // namespace network
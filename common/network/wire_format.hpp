@@ -0,0 +1,124 @@
+#ifndef WIRE_FORMAT_HPP
+#define WIRE_FORMAT_HPP
+
+/******************************************************************************
+ *
+ * @file       wire_format.hpp
+ * @brief      WebSocket 帧格式版本与 v2 固定头
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * v1（默认）：
+ *   [header_size(varint)][type_name_size(varint)][type_name][IMHeader][body][CRC32]
+ *
+ * v2（握手时通过 Sec-WebSocket-Protocol: im.v2 协商）：
+ *   [FrameHeaderV2 20 字节，小端][body]
+ *
+ *   offset  size  field
+ *   0       1     version      固定为 2
+ *   1       1     flags        见 kFrameFlag*，未定义的位编码写 0，解码忽略
+ *   2       2     reserved     写 0
+ *   4       4     cmd_id
+ *   8       4     seq
+ *   12      4     type_id      见 message_type_registry.hpp
+ *   16      4     body_length  必须等于剩余字节数
+ *
+ * v2 不再携带类型全名和 IMHeader：token / device_id / platform / user_id
+ * 在握手和连接认证时绑定到连接上，网关解析时从连接身份补全 IMHeader。
+ * 完整性由 TLS 和 WebSocket 分帧保证，不再追加 CRC32。
+ *
+ * 批量帧（flags 含 kFrameFlagBatch）：
+ *   外层 FrameHeaderV2: cmd_id = 0, seq = 批次序号, type_id = FrameBatch 的编号
+ *   消息体: im.base.FrameBatch，frames 的每一项是一个完整的 v2 子帧
+ *
+ *   子帧不可再嵌套批量帧，个数不超过网关配置的 gateway.ws_max_batch_size。
+ *   网关把整批放进一个任务按顺序处理，各子请求的响应（没有响应的子请求如送达
+ *   回执不占位）按相同格式拼成一个批量帧返回，外层 seq 原样带回；整批被拒绝时
+ *   返回一个 seq 为批次序号的 BaseResponse 帧。
+ *
+ *****************************************************************************/
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace im {
+namespace network {
+
+enum class WireVersion : uint8_t {
+    V1 = 1,
+    V2 = 2,
+};
+
+/// 客户端在 Sec-WebSocket-Protocol 中携带该值即选择 v2 帧格式
+inline constexpr const char* kWireV2Subprotocol = "im.v2";
+
+/**
+ * @brief Sec-WebSocket-Protocol 的取值中是否列出了 protocol
+ *
+ * 该头是逗号分隔的子协议列表，逐项去掉首尾空白后整项比较，
+ * "im.v20"、"x-im.v2" 这类只是包含子串的取值不算。
+ */
+inline bool offers_subprotocol(std::string_view header_value, std::string_view protocol) {
+    constexpr std::string_view kWhitespace = " \t";
+    while (!header_value.empty()) {
+        const std::size_t comma = header_value.find(',');
+        std::string_view item = header_value.substr(0, comma);
+        header_value = comma == std::string_view::npos ? std::string_view{}
+                                                       : header_value.substr(comma + 1);
+        const std::size_t first = item.find_first_not_of(kWhitespace);
+        if (first == std::string_view::npos) {
+            continue;
+        }
+        item = item.substr(first, item.find_last_not_of(kWhitespace) - first + 1);
+        if (item == protocol) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline constexpr std::size_t kFrameHeaderV2Size = 20;
+inline constexpr std::size_t kFrameHeaderV2CmdIdOffset = 4;
+inline constexpr std::size_t kFrameHeaderV2SeqOffset = 8;
+inline constexpr std::size_t kFrameHeaderV2BodyLengthOffset = 16;
+
+/// 批量帧：消息体是若干完整的 v2 子帧
+inline constexpr uint8_t kFrameFlagBatch = 0x01;
+
+struct FrameHeaderV2 {
+    uint8_t version = static_cast<uint8_t>(WireVersion::V2);
+    uint8_t flags = 0;
+    uint32_t cmd_id = 0;
+    uint32_t seq = 0;
+    uint32_t type_id = 0;
+    uint32_t body_length = 0;
+};
+
+/**
+ * @brief 连接级身份，v2 帧据此补全 IMHeader 中省略的字段
+ *
+ * token 在握手时从 URL 参数或 Authorization 头提取；其余字段在 token
+ * 验证并绑定连接后填入。expire_time 为 token 过期时间，未绑定时为纪元零点；
+ * token_id 为 token 的 jti。I/O 线程上的快速路径据此判断连接级认证是否仍然
+ * 有效（未过期且未被撤销）。revocation_checked_at 为上次确认 token 未撤销的
+ * 时间（绑定时的验证即一次确认），快速路径不查 Redis，超过复查间隔后把下一帧
+ * 交给常规路径重新验证；只在会话的 I/O 线程读写。
+ */
+struct ConnectionIdentity {
+    std::string token;
+    std::string user_id;
+    std::string device_id;
+    std::string platform;
+    std::chrono::system_clock::time_point expire_time{};
+    std::string token_id;
+    std::chrono::steady_clock::time_point revocation_checked_at{};
+};
+
+}  // namespace network
+}  // namespace im
+
+#endif  // WIRE_FORMAT_HPP
@@ -1,408 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: codec_service.proto
-#ifndef GRPC_codec_5fservice_2eproto__INCLUDED
-#define GRPC_codec_5fservice_2eproto__INCLUDED
-
-#include "codec_service.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-
-namespace im {
-namespace codec {
-
-// CodecService 提供编解码功能，允许其他语言通过gRPC调用
-class CodecService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "im.codec.CodecService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    // 编码服务：将IMHeader和Protobuf消息编码为二进制数据
-    virtual ::grpc::Status Encode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::im::codec::EncodeResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::EncodeResponse>> AsyncEncode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::EncodeResponse>>(AsyncEncodeRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::EncodeResponse>> PrepareAsyncEncode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::EncodeResponse>>(PrepareAsyncEncodeRaw(context, request, cq));
-    }
-    // 解码服务：将二进制数据解码为IMHeader和Protobuf消息
-    virtual ::grpc::Status Decode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::im::codec::DecodeResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::DecodeResponse>> AsyncDecode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::DecodeResponse>>(AsyncDecodeRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::DecodeResponse>> PrepareAsyncDecode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::DecodeResponse>>(PrepareAsyncDecodeRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      // 编码服务：将IMHeader和Protobuf消息编码为二进制数据
-      virtual void Encode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest* request, ::im::codec::EncodeResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void Encode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest* request, ::im::codec::EncodeResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      // 解码服务：将二进制数据解码为IMHeader和Protobuf消息
-      virtual void Decode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest* request, ::im::codec::DecodeResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void Decode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest* request, ::im::codec::DecodeResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::EncodeResponse>* AsyncEncodeRaw(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::EncodeResponse>* PrepareAsyncEncodeRaw(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::DecodeResponse>* AsyncDecodeRaw(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::codec::DecodeResponse>* PrepareAsyncDecodeRaw(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status Encode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::im::codec::EncodeResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::codec::EncodeResponse>> AsyncEncode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::codec::EncodeResponse>>(AsyncEncodeRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::codec::EncodeResponse>> PrepareAsyncEncode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::codec::EncodeResponse>>(PrepareAsyncEncodeRaw(context, request, cq));
-    }
-    ::grpc::Status Decode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::im::codec::DecodeResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::codec::DecodeResponse>> AsyncDecode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::codec::DecodeResponse>>(AsyncDecodeRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::codec::DecodeResponse>> PrepareAsyncDecode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::codec::DecodeResponse>>(PrepareAsyncDecodeRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void Encode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest* request, ::im::codec::EncodeResponse* response, std::function<void(::grpc::Status)>) override;
-      void Encode(::grpc::ClientContext* context, const ::im::codec::EncodeRequest* request, ::im::codec::EncodeResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void Decode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest* request, ::im::codec::DecodeResponse* response, std::function<void(::grpc::Status)>) override;
-      void Decode(::grpc::ClientContext* context, const ::im::codec::DecodeRequest* request, ::im::codec::DecodeResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::im::codec::EncodeResponse>* AsyncEncodeRaw(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::codec::EncodeResponse>* PrepareAsyncEncodeRaw(::grpc::ClientContext* context, const ::im::codec::EncodeRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::codec::DecodeResponse>* AsyncDecodeRaw(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::codec::DecodeResponse>* PrepareAsyncDecodeRaw(::grpc::ClientContext* context, const ::im::codec::DecodeRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_Encode_;
-    const ::grpc::internal::RpcMethod rpcmethod_Decode_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    // 编码服务：将IMHeader和Protobuf消息编码为二进制数据
-    virtual ::grpc::Status Encode(::grpc::ServerContext* context, const ::im::codec::EncodeRequest* request, ::im::codec::EncodeResponse* response);
-    // 解码服务：将二进制数据解码为IMHeader和Protobuf消息
-    virtual ::grpc::Status Decode(::grpc::ServerContext* context, const ::im::codec::DecodeRequest* request, ::im::codec::DecodeResponse* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_Encode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_Encode() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_Encode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Encode(::grpc::ServerContext* /*context*/, const ::im::codec::EncodeRequest* /*request*/, ::im::codec::EncodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestEncode(::grpc::ServerContext* context, ::im::codec::EncodeRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::codec::EncodeResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_Decode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_Decode() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_Decode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Decode(::grpc::ServerContext* /*context*/, const ::im::codec::DecodeRequest* /*request*/, ::im::codec::DecodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestDecode(::grpc::ServerContext* context, ::im::codec::DecodeRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::codec::DecodeResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_Encode<WithAsyncMethod_Decode<Service > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_Encode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_Encode() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::codec::EncodeRequest, ::im::codec::EncodeResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::codec::EncodeRequest* request, ::im::codec::EncodeResponse* response) { return this->Encode(context, request, response); }));}
-    void SetMessageAllocatorFor_Encode(
-        ::grpc::MessageAllocator< ::im::codec::EncodeRequest, ::im::codec::EncodeResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::codec::EncodeRequest, ::im::codec::EncodeResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_Encode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Encode(::grpc::ServerContext* /*context*/, const ::im::codec::EncodeRequest* /*request*/, ::im::codec::EncodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Encode(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::codec::EncodeRequest* /*request*/, ::im::codec::EncodeResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_Decode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_Decode() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::codec::DecodeRequest, ::im::codec::DecodeResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::codec::DecodeRequest* request, ::im::codec::DecodeResponse* response) { return this->Decode(context, request, response); }));}
-    void SetMessageAllocatorFor_Decode(
-        ::grpc::MessageAllocator< ::im::codec::DecodeRequest, ::im::codec::DecodeResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::codec::DecodeRequest, ::im::codec::DecodeResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_Decode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Decode(::grpc::ServerContext* /*context*/, const ::im::codec::DecodeRequest* /*request*/, ::im::codec::DecodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Decode(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::codec::DecodeRequest* /*request*/, ::im::codec::DecodeResponse* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_Encode<WithCallbackMethod_Decode<Service > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_Encode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_Encode() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_Encode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Encode(::grpc::ServerContext* /*context*/, const ::im::codec::EncodeRequest* /*request*/, ::im::codec::EncodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_Decode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_Decode() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_Decode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Decode(::grpc::ServerContext* /*context*/, const ::im::codec::DecodeRequest* /*request*/, ::im::codec::DecodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_Encode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_Encode() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_Encode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Encode(::grpc::ServerContext* /*context*/, const ::im::codec::EncodeRequest* /*request*/, ::im::codec::EncodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestEncode(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_Decode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_Decode() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_Decode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Decode(::grpc::ServerContext* /*context*/, const ::im::codec::DecodeRequest* /*request*/, ::im::codec::DecodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestDecode(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_Encode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_Encode() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Encode(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_Encode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Encode(::grpc::ServerContext* /*context*/, const ::im::codec::EncodeRequest* /*request*/, ::im::codec::EncodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Encode(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_Decode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_Decode() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Decode(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_Decode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Decode(::grpc::ServerContext* /*context*/, const ::im::codec::DecodeRequest* /*request*/, ::im::codec::DecodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Decode(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_Encode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_Encode() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::codec::EncodeRequest, ::im::codec::EncodeResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::codec::EncodeRequest, ::im::codec::EncodeResponse>* streamer) {
-                       return this->StreamedEncode(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_Encode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status Encode(::grpc::ServerContext* /*context*/, const ::im::codec::EncodeRequest* /*request*/, ::im::codec::EncodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedEncode(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::codec::EncodeRequest,::im::codec::EncodeResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_Decode : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_Decode() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::codec::DecodeRequest, ::im::codec::DecodeResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::codec::DecodeRequest, ::im::codec::DecodeResponse>* streamer) {
-                       return this->StreamedDecode(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_Decode() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status Decode(::grpc::ServerContext* /*context*/, const ::im::codec::DecodeRequest* /*request*/, ::im::codec::DecodeResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedDecode(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::codec::DecodeRequest,::im::codec::DecodeResponse>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_Encode<WithStreamedUnaryMethod_Decode<Service > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Encode<WithStreamedUnaryMethod_Decode<Service > > StreamedService;
-};
-
-}  // namespace codec
-}  // namespace im
-
-
-#include <grpcpp/ports_undef.inc>
-#endif  // GRPC_codec_5fservice_2eproto__INCLUDED
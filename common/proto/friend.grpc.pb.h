@@ -1,718 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: friend.proto
-#ifndef GRPC_friend_2eproto__INCLUDED
-#define GRPC_friend_2eproto__INCLUDED
-
-#include "friend.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-
-namespace im {
-namespace friend_ {
-
-// FriendService is the distributed gRPC boundary for friend request workflows.
-// Gateway can keep using local FriendService while this boundary is staged,
-// then switch to RPC without changing the external HTTP contract.
-class FriendService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "im.friend_.FriendService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status SendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::im::friend_::AddFriendResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::AddFriendResponse>> AsyncSendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::AddFriendResponse>>(AsyncSendRequestRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::AddFriendResponse>> PrepareAsyncSendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::AddFriendResponse>>(PrepareAsyncSendRequestRaw(context, request, cq));
-    }
-    virtual ::grpc::Status RespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::im::friend_::HandleFriendResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::HandleFriendResponse>> AsyncRespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::HandleFriendResponse>>(AsyncRespondToRequestRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::HandleFriendResponse>> PrepareAsyncRespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::HandleFriendResponse>>(PrepareAsyncRespondToRequestRaw(context, request, cq));
-    }
-    virtual ::grpc::Status GetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::im::friend_::GetFriendListResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendListResponse>> AsyncGetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendListResponse>>(AsyncGetFriendsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendListResponse>> PrepareAsyncGetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendListResponse>>(PrepareAsyncGetFriendsRaw(context, request, cq));
-    }
-    virtual ::grpc::Status GetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::im::friend_::GetFriendRequestsResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendRequestsResponse>> AsyncGetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendRequestsResponse>>(AsyncGetPendingRequestsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendRequestsResponse>> PrepareAsyncGetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendRequestsResponse>>(PrepareAsyncGetPendingRequestsRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void SendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest* request, ::im::friend_::AddFriendResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void SendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest* request, ::im::friend_::AddFriendResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void RespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest* request, ::im::friend_::HandleFriendResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void RespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest* request, ::im::friend_::HandleFriendResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void GetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest* request, ::im::friend_::GetFriendListResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void GetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest* request, ::im::friend_::GetFriendListResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void GetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest* request, ::im::friend_::GetFriendRequestsResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void GetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest* request, ::im::friend_::GetFriendRequestsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::AddFriendResponse>* AsyncSendRequestRaw(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::AddFriendResponse>* PrepareAsyncSendRequestRaw(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::HandleFriendResponse>* AsyncRespondToRequestRaw(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::HandleFriendResponse>* PrepareAsyncRespondToRequestRaw(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendListResponse>* AsyncGetFriendsRaw(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendListResponse>* PrepareAsyncGetFriendsRaw(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendRequestsResponse>* AsyncGetPendingRequestsRaw(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::friend_::GetFriendRequestsResponse>* PrepareAsyncGetPendingRequestsRaw(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status SendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::im::friend_::AddFriendResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::AddFriendResponse>> AsyncSendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::AddFriendResponse>>(AsyncSendRequestRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::AddFriendResponse>> PrepareAsyncSendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::AddFriendResponse>>(PrepareAsyncSendRequestRaw(context, request, cq));
-    }
-    ::grpc::Status RespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::im::friend_::HandleFriendResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::HandleFriendResponse>> AsyncRespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::HandleFriendResponse>>(AsyncRespondToRequestRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::HandleFriendResponse>> PrepareAsyncRespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::HandleFriendResponse>>(PrepareAsyncRespondToRequestRaw(context, request, cq));
-    }
-    ::grpc::Status GetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::im::friend_::GetFriendListResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendListResponse>> AsyncGetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendListResponse>>(AsyncGetFriendsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendListResponse>> PrepareAsyncGetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendListResponse>>(PrepareAsyncGetFriendsRaw(context, request, cq));
-    }
-    ::grpc::Status GetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::im::friend_::GetFriendRequestsResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendRequestsResponse>> AsyncGetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendRequestsResponse>>(AsyncGetPendingRequestsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendRequestsResponse>> PrepareAsyncGetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendRequestsResponse>>(PrepareAsyncGetPendingRequestsRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void SendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest* request, ::im::friend_::AddFriendResponse* response, std::function<void(::grpc::Status)>) override;
-      void SendRequest(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest* request, ::im::friend_::AddFriendResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void RespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest* request, ::im::friend_::HandleFriendResponse* response, std::function<void(::grpc::Status)>) override;
-      void RespondToRequest(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest* request, ::im::friend_::HandleFriendResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void GetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest* request, ::im::friend_::GetFriendListResponse* response, std::function<void(::grpc::Status)>) override;
-      void GetFriends(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest* request, ::im::friend_::GetFriendListResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void GetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest* request, ::im::friend_::GetFriendRequestsResponse* response, std::function<void(::grpc::Status)>) override;
-      void GetPendingRequests(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest* request, ::im::friend_::GetFriendRequestsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::im::friend_::AddFriendResponse>* AsyncSendRequestRaw(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::friend_::AddFriendResponse>* PrepareAsyncSendRequestRaw(::grpc::ClientContext* context, const ::im::friend_::AddFriendRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::friend_::HandleFriendResponse>* AsyncRespondToRequestRaw(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::friend_::HandleFriendResponse>* PrepareAsyncRespondToRequestRaw(::grpc::ClientContext* context, const ::im::friend_::HandleFriendRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendListResponse>* AsyncGetFriendsRaw(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendListResponse>* PrepareAsyncGetFriendsRaw(::grpc::ClientContext* context, const ::im::friend_::GetFriendListRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendRequestsResponse>* AsyncGetPendingRequestsRaw(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::friend_::GetFriendRequestsResponse>* PrepareAsyncGetPendingRequestsRaw(::grpc::ClientContext* context, const ::im::friend_::GetFriendRequestsRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_SendRequest_;
-    const ::grpc::internal::RpcMethod rpcmethod_RespondToRequest_;
-    const ::grpc::internal::RpcMethod rpcmethod_GetFriends_;
-    const ::grpc::internal::RpcMethod rpcmethod_GetPendingRequests_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status SendRequest(::grpc::ServerContext* context, const ::im::friend_::AddFriendRequest* request, ::im::friend_::AddFriendResponse* response);
-    virtual ::grpc::Status RespondToRequest(::grpc::ServerContext* context, const ::im::friend_::HandleFriendRequest* request, ::im::friend_::HandleFriendResponse* response);
-    virtual ::grpc::Status GetFriends(::grpc::ServerContext* context, const ::im::friend_::GetFriendListRequest* request, ::im::friend_::GetFriendListResponse* response);
-    virtual ::grpc::Status GetPendingRequests(::grpc::ServerContext* context, const ::im::friend_::GetFriendRequestsRequest* request, ::im::friend_::GetFriendRequestsResponse* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_SendRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_SendRequest() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_SendRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::AddFriendRequest* /*request*/, ::im::friend_::AddFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSendRequest(::grpc::ServerContext* context, ::im::friend_::AddFriendRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::friend_::AddFriendResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_RespondToRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_RespondToRequest() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_RespondToRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RespondToRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::HandleFriendRequest* /*request*/, ::im::friend_::HandleFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestRespondToRequest(::grpc::ServerContext* context, ::im::friend_::HandleFriendRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::friend_::HandleFriendResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_GetFriends : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_GetFriends() {
-      ::grpc::Service::MarkMethodAsync(2);
-    }
-    ~WithAsyncMethod_GetFriends() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetFriends(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendListRequest* /*request*/, ::im::friend_::GetFriendListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetFriends(::grpc::ServerContext* context, ::im::friend_::GetFriendListRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::friend_::GetFriendListResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_GetPendingRequests : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_GetPendingRequests() {
-      ::grpc::Service::MarkMethodAsync(3);
-    }
-    ~WithAsyncMethod_GetPendingRequests() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetPendingRequests(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendRequestsRequest* /*request*/, ::im::friend_::GetFriendRequestsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetPendingRequests(::grpc::ServerContext* context, ::im::friend_::GetFriendRequestsRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::friend_::GetFriendRequestsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_SendRequest<WithAsyncMethod_RespondToRequest<WithAsyncMethod_GetFriends<WithAsyncMethod_GetPendingRequests<Service > > > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_SendRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_SendRequest() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::friend_::AddFriendRequest, ::im::friend_::AddFriendResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::friend_::AddFriendRequest* request, ::im::friend_::AddFriendResponse* response) { return this->SendRequest(context, request, response); }));}
-    void SetMessageAllocatorFor_SendRequest(
-        ::grpc::MessageAllocator< ::im::friend_::AddFriendRequest, ::im::friend_::AddFriendResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::friend_::AddFriendRequest, ::im::friend_::AddFriendResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_SendRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::AddFriendRequest* /*request*/, ::im::friend_::AddFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SendRequest(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::friend_::AddFriendRequest* /*request*/, ::im::friend_::AddFriendResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_RespondToRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_RespondToRequest() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::friend_::HandleFriendRequest, ::im::friend_::HandleFriendResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::friend_::HandleFriendRequest* request, ::im::friend_::HandleFriendResponse* response) { return this->RespondToRequest(context, request, response); }));}
-    void SetMessageAllocatorFor_RespondToRequest(
-        ::grpc::MessageAllocator< ::im::friend_::HandleFriendRequest, ::im::friend_::HandleFriendResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::friend_::HandleFriendRequest, ::im::friend_::HandleFriendResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_RespondToRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RespondToRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::HandleFriendRequest* /*request*/, ::im::friend_::HandleFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* RespondToRequest(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::friend_::HandleFriendRequest* /*request*/, ::im::friend_::HandleFriendResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_GetFriends : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_GetFriends() {
-      ::grpc::Service::MarkMethodCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::friend_::GetFriendListRequest, ::im::friend_::GetFriendListResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::friend_::GetFriendListRequest* request, ::im::friend_::GetFriendListResponse* response) { return this->GetFriends(context, request, response); }));}
-    void SetMessageAllocatorFor_GetFriends(
-        ::grpc::MessageAllocator< ::im::friend_::GetFriendListRequest, ::im::friend_::GetFriendListResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::friend_::GetFriendListRequest, ::im::friend_::GetFriendListResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_GetFriends() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetFriends(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendListRequest* /*request*/, ::im::friend_::GetFriendListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetFriends(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::friend_::GetFriendListRequest* /*request*/, ::im::friend_::GetFriendListResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_GetPendingRequests : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_GetPendingRequests() {
-      ::grpc::Service::MarkMethodCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::friend_::GetFriendRequestsRequest, ::im::friend_::GetFriendRequestsResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::friend_::GetFriendRequestsRequest* request, ::im::friend_::GetFriendRequestsResponse* response) { return this->GetPendingRequests(context, request, response); }));}
-    void SetMessageAllocatorFor_GetPendingRequests(
-        ::grpc::MessageAllocator< ::im::friend_::GetFriendRequestsRequest, ::im::friend_::GetFriendRequestsResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::friend_::GetFriendRequestsRequest, ::im::friend_::GetFriendRequestsResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_GetPendingRequests() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetPendingRequests(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendRequestsRequest* /*request*/, ::im::friend_::GetFriendRequestsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetPendingRequests(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::friend_::GetFriendRequestsRequest* /*request*/, ::im::friend_::GetFriendRequestsResponse* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_SendRequest<WithCallbackMethod_RespondToRequest<WithCallbackMethod_GetFriends<WithCallbackMethod_GetPendingRequests<Service > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_SendRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_SendRequest() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_SendRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::AddFriendRequest* /*request*/, ::im::friend_::AddFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_RespondToRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_RespondToRequest() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_RespondToRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RespondToRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::HandleFriendRequest* /*request*/, ::im::friend_::HandleFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_GetFriends : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_GetFriends() {
-      ::grpc::Service::MarkMethodGeneric(2);
-    }
-    ~WithGenericMethod_GetFriends() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetFriends(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendListRequest* /*request*/, ::im::friend_::GetFriendListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_GetPendingRequests : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_GetPendingRequests() {
-      ::grpc::Service::MarkMethodGeneric(3);
-    }
-    ~WithGenericMethod_GetPendingRequests() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetPendingRequests(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendRequestsRequest* /*request*/, ::im::friend_::GetFriendRequestsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_SendRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_SendRequest() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_SendRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::AddFriendRequest* /*request*/, ::im::friend_::AddFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSendRequest(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_RespondToRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_RespondToRequest() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_RespondToRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RespondToRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::HandleFriendRequest* /*request*/, ::im::friend_::HandleFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestRespondToRequest(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_GetFriends : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_GetFriends() {
-      ::grpc::Service::MarkMethodRaw(2);
-    }
-    ~WithRawMethod_GetFriends() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetFriends(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendListRequest* /*request*/, ::im::friend_::GetFriendListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetFriends(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_GetPendingRequests : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_GetPendingRequests() {
-      ::grpc::Service::MarkMethodRaw(3);
-    }
-    ~WithRawMethod_GetPendingRequests() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetPendingRequests(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendRequestsRequest* /*request*/, ::im::friend_::GetFriendRequestsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetPendingRequests(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_SendRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_SendRequest() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SendRequest(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_SendRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::AddFriendRequest* /*request*/, ::im::friend_::AddFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SendRequest(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_RespondToRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_RespondToRequest() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->RespondToRequest(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_RespondToRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status RespondToRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::HandleFriendRequest* /*request*/, ::im::friend_::HandleFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* RespondToRequest(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_GetFriends : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_GetFriends() {
-      ::grpc::Service::MarkMethodRawCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetFriends(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_GetFriends() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetFriends(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendListRequest* /*request*/, ::im::friend_::GetFriendListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetFriends(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_GetPendingRequests : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_GetPendingRequests() {
-      ::grpc::Service::MarkMethodRawCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetPendingRequests(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_GetPendingRequests() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetPendingRequests(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendRequestsRequest* /*request*/, ::im::friend_::GetFriendRequestsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetPendingRequests(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_SendRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_SendRequest() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::friend_::AddFriendRequest, ::im::friend_::AddFriendResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::friend_::AddFriendRequest, ::im::friend_::AddFriendResponse>* streamer) {
-                       return this->StreamedSendRequest(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_SendRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status SendRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::AddFriendRequest* /*request*/, ::im::friend_::AddFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSendRequest(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::friend_::AddFriendRequest,::im::friend_::AddFriendResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_RespondToRequest : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_RespondToRequest() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::friend_::HandleFriendRequest, ::im::friend_::HandleFriendResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::friend_::HandleFriendRequest, ::im::friend_::HandleFriendResponse>* streamer) {
-                       return this->StreamedRespondToRequest(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_RespondToRequest() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status RespondToRequest(::grpc::ServerContext* /*context*/, const ::im::friend_::HandleFriendRequest* /*request*/, ::im::friend_::HandleFriendResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedRespondToRequest(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::friend_::HandleFriendRequest,::im::friend_::HandleFriendResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_GetFriends : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_GetFriends() {
-      ::grpc::Service::MarkMethodStreamed(2,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::friend_::GetFriendListRequest, ::im::friend_::GetFriendListResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::friend_::GetFriendListRequest, ::im::friend_::GetFriendListResponse>* streamer) {
-                       return this->StreamedGetFriends(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_GetFriends() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status GetFriends(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendListRequest* /*request*/, ::im::friend_::GetFriendListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetFriends(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::friend_::GetFriendListRequest,::im::friend_::GetFriendListResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_GetPendingRequests : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_GetPendingRequests() {
-      ::grpc::Service::MarkMethodStreamed(3,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::friend_::GetFriendRequestsRequest, ::im::friend_::GetFriendRequestsResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::friend_::GetFriendRequestsRequest, ::im::friend_::GetFriendRequestsResponse>* streamer) {
-                       return this->StreamedGetPendingRequests(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_GetPendingRequests() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status GetPendingRequests(::grpc::ServerContext* /*context*/, const ::im::friend_::GetFriendRequestsRequest* /*request*/, ::im::friend_::GetFriendRequestsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetPendingRequests(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::friend_::GetFriendRequestsRequest,::im::friend_::GetFriendRequestsResponse>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_SendRequest<WithStreamedUnaryMethod_RespondToRequest<WithStreamedUnaryMethod_GetFriends<WithStreamedUnaryMethod_GetPendingRequests<Service > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_SendRequest<WithStreamedUnaryMethod_RespondToRequest<WithStreamedUnaryMethod_GetFriends<WithStreamedUnaryMethod_GetPendingRequests<Service > > > > StreamedService;
-};
-
-}  // namespace friend_
-}  // namespace im
-
-
-#include <grpcpp/ports_undef.inc>
-#endif  // GRPC_friend_2eproto__INCLUDED
@@ -1,465 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: group.proto
-
-#include "group.pb.h"
-#include "group.grpc.pb.h"
-
-#include <functional>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/impl/channel_interface.h>
-#include <grpcpp/impl/client_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/rpc_service_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/sync_stream.h>
-namespace im {
-namespace group {
-
-static const char* GroupService_method_names[] = {
-  "/im.group.GroupService/CreateGroup",
-  "/im.group.GroupService/JoinGroup",
-  "/im.group.GroupService/LeaveGroup",
-  "/im.group.GroupService/GetGroupInfo",
-  "/im.group.GroupService/SearchGroups",
-  "/im.group.GroupService/GroupExists",
-  "/im.group.GroupService/ListMyGroups",
-  "/im.group.GroupService/ListMembers",
-  "/im.group.GroupService/SendGroupMessage",
-  "/im.group.GroupService/GetGroupMessages",
-};
-
-std::unique_ptr< GroupService::Stub> GroupService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
-  (void)options;
-  std::unique_ptr< GroupService::Stub> stub(new GroupService::Stub(channel, options));
-  return stub;
-}
-
-GroupService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
-  : channel_(channel), rpcmethod_CreateGroup_(GroupService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_JoinGroup_(GroupService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_LeaveGroup_(GroupService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetGroupInfo_(GroupService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SearchGroups_(GroupService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GroupExists_(GroupService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ListMyGroups_(GroupService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_ListMembers_(GroupService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SendGroupMessage_(GroupService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetGroupMessages_(GroupService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  {}
-
-::grpc::Status GroupService::Stub::CreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::im::group::CreateGroupResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::CreateGroupRequest, ::im::group::CreateGroupResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_CreateGroup_, context, request, response);
-}
-
-void GroupService::Stub::async::CreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest* request, ::im::group::CreateGroupResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::CreateGroupRequest, ::im::group::CreateGroupResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CreateGroup_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::CreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest* request, ::im::group::CreateGroupResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_CreateGroup_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::CreateGroupResponse>* GroupService::Stub::PrepareAsyncCreateGroupRaw(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::CreateGroupResponse, ::im::group::CreateGroupRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_CreateGroup_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::CreateGroupResponse>* GroupService::Stub::AsyncCreateGroupRaw(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncCreateGroupRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status GroupService::Stub::JoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::im::group::GroupActionResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::JoinGroupRequest, ::im::group::GroupActionResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_JoinGroup_, context, request, response);
-}
-
-void GroupService::Stub::async::JoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest* request, ::im::group::GroupActionResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::JoinGroupRequest, ::im::group::GroupActionResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_JoinGroup_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::JoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest* request, ::im::group::GroupActionResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_JoinGroup_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>* GroupService::Stub::PrepareAsyncJoinGroupRaw(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::GroupActionResponse, ::im::group::JoinGroupRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_JoinGroup_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>* GroupService::Stub::AsyncJoinGroupRaw(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncJoinGroupRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status GroupService::Stub::LeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::im::group::GroupActionResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::LeaveGroupRequest, ::im::group::GroupActionResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_LeaveGroup_, context, request, response);
-}
-
-void GroupService::Stub::async::LeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest* request, ::im::group::GroupActionResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::LeaveGroupRequest, ::im::group::GroupActionResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_LeaveGroup_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::LeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest* request, ::im::group::GroupActionResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_LeaveGroup_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>* GroupService::Stub::PrepareAsyncLeaveGroupRaw(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::GroupActionResponse, ::im::group::LeaveGroupRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_LeaveGroup_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>* GroupService::Stub::AsyncLeaveGroupRaw(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncLeaveGroupRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status GroupService::Stub::GetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::im::group::GetGroupInfoResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::GetGroupInfoRequest, ::im::group::GetGroupInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetGroupInfo_, context, request, response);
-}
-
-void GroupService::Stub::async::GetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest* request, ::im::group::GetGroupInfoResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::GetGroupInfoRequest, ::im::group::GetGroupInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetGroupInfo_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::GetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest* request, ::im::group::GetGroupInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetGroupInfo_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GetGroupInfoResponse>* GroupService::Stub::PrepareAsyncGetGroupInfoRaw(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::GetGroupInfoResponse, ::im::group::GetGroupInfoRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetGroupInfo_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GetGroupInfoResponse>* GroupService::Stub::AsyncGetGroupInfoRaw(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncGetGroupInfoRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status GroupService::Stub::SearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::im::group::SearchGroupsResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::SearchGroupsRequest, ::im::group::SearchGroupsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SearchGroups_, context, request, response);
-}
-
-void GroupService::Stub::async::SearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest* request, ::im::group::SearchGroupsResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::SearchGroupsRequest, ::im::group::SearchGroupsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SearchGroups_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::SearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest* request, ::im::group::SearchGroupsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SearchGroups_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::SearchGroupsResponse>* GroupService::Stub::PrepareAsyncSearchGroupsRaw(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::SearchGroupsResponse, ::im::group::SearchGroupsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SearchGroups_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::SearchGroupsResponse>* GroupService::Stub::AsyncSearchGroupsRaw(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncSearchGroupsRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status GroupService::Stub::GroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::im::group::GroupExistsResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::GroupExistsRequest, ::im::group::GroupExistsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GroupExists_, context, request, response);
-}
-
-void GroupService::Stub::async::GroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest* request, ::im::group::GroupExistsResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::GroupExistsRequest, ::im::group::GroupExistsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GroupExists_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::GroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest* request, ::im::group::GroupExistsResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GroupExists_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GroupExistsResponse>* GroupService::Stub::PrepareAsyncGroupExistsRaw(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::GroupExistsResponse, ::im::group::GroupExistsRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GroupExists_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GroupExistsResponse>* GroupService::Stub::AsyncGroupExistsRaw(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncGroupExistsRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status GroupService::Stub::ListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::im::group::GetGroupListResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::GetGroupListRequest, ::im::group::GetGroupListResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ListMyGroups_, context, request, response);
-}
-
-void GroupService::Stub::async::ListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest* request, ::im::group::GetGroupListResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::GetGroupListRequest, ::im::group::GetGroupListResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ListMyGroups_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::ListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest* request, ::im::group::GetGroupListResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ListMyGroups_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GetGroupListResponse>* GroupService::Stub::PrepareAsyncListMyGroupsRaw(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::GetGroupListResponse, ::im::group::GetGroupListRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ListMyGroups_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GetGroupListResponse>* GroupService::Stub::AsyncListMyGroupsRaw(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncListMyGroupsRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status GroupService::Stub::ListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::im::group::GetGroupMembersResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::GetGroupMembersRequest, ::im::group::GetGroupMembersResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ListMembers_, context, request, response);
-}
-
-void GroupService::Stub::async::ListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest* request, ::im::group::GetGroupMembersResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::GetGroupMembersRequest, ::im::group::GetGroupMembersResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ListMembers_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::ListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest* request, ::im::group::GetGroupMembersResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ListMembers_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMembersResponse>* GroupService::Stub::PrepareAsyncListMembersRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::GetGroupMembersResponse, ::im::group::GetGroupMembersRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ListMembers_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMembersResponse>* GroupService::Stub::AsyncListMembersRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncListMembersRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status GroupService::Stub::SendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::im::group::SendGroupMessageResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::SendGroupMessageRequest, ::im::group::SendGroupMessageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SendGroupMessage_, context, request, response);
-}
-
-void GroupService::Stub::async::SendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest* request, ::im::group::SendGroupMessageResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::SendGroupMessageRequest, ::im::group::SendGroupMessageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SendGroupMessage_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::SendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest* request, ::im::group::SendGroupMessageResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SendGroupMessage_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::SendGroupMessageResponse>* GroupService::Stub::PrepareAsyncSendGroupMessageRaw(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::SendGroupMessageResponse, ::im::group::SendGroupMessageRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SendGroupMessage_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::SendGroupMessageResponse>* GroupService::Stub::AsyncSendGroupMessageRaw(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncSendGroupMessageRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status GroupService::Stub::GetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::im::group::GetGroupMessagesResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::group::GetGroupMessagesRequest, ::im::group::GetGroupMessagesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetGroupMessages_, context, request, response);
-}
-
-void GroupService::Stub::async::GetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest* request, ::im::group::GetGroupMessagesResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::group::GetGroupMessagesRequest, ::im::group::GetGroupMessagesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetGroupMessages_, context, request, response, std::move(f));
-}
-
-void GroupService::Stub::async::GetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest* request, ::im::group::GetGroupMessagesResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetGroupMessages_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMessagesResponse>* GroupService::Stub::PrepareAsyncGetGroupMessagesRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::group::GetGroupMessagesResponse, ::im::group::GetGroupMessagesRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetGroupMessages_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMessagesResponse>* GroupService::Stub::AsyncGetGroupMessagesRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncGetGroupMessagesRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-GroupService::Service::Service() {
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[0],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::CreateGroupRequest, ::im::group::CreateGroupResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::CreateGroupRequest* req,
-             ::im::group::CreateGroupResponse* resp) {
-               return service->CreateGroup(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[1],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::JoinGroupRequest, ::im::group::GroupActionResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::JoinGroupRequest* req,
-             ::im::group::GroupActionResponse* resp) {
-               return service->JoinGroup(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[2],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::LeaveGroupRequest, ::im::group::GroupActionResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::LeaveGroupRequest* req,
-             ::im::group::GroupActionResponse* resp) {
-               return service->LeaveGroup(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[3],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::GetGroupInfoRequest, ::im::group::GetGroupInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::GetGroupInfoRequest* req,
-             ::im::group::GetGroupInfoResponse* resp) {
-               return service->GetGroupInfo(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[4],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::SearchGroupsRequest, ::im::group::SearchGroupsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::SearchGroupsRequest* req,
-             ::im::group::SearchGroupsResponse* resp) {
-               return service->SearchGroups(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[5],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::GroupExistsRequest, ::im::group::GroupExistsResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::GroupExistsRequest* req,
-             ::im::group::GroupExistsResponse* resp) {
-               return service->GroupExists(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[6],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::GetGroupListRequest, ::im::group::GetGroupListResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::GetGroupListRequest* req,
-             ::im::group::GetGroupListResponse* resp) {
-               return service->ListMyGroups(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[7],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::GetGroupMembersRequest, ::im::group::GetGroupMembersResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::GetGroupMembersRequest* req,
-             ::im::group::GetGroupMembersResponse* resp) {
-               return service->ListMembers(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[8],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::SendGroupMessageRequest, ::im::group::SendGroupMessageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::SendGroupMessageRequest* req,
-             ::im::group::SendGroupMessageResponse* resp) {
-               return service->SendGroupMessage(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      GroupService_method_names[9],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< GroupService::Service, ::im::group::GetGroupMessagesRequest, ::im::group::GetGroupMessagesResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](GroupService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::group::GetGroupMessagesRequest* req,
-             ::im::group::GetGroupMessagesResponse* resp) {
-               return service->GetGroupMessages(ctx, req, resp);
-             }, this)));
-}
-
-GroupService::Service::~Service() {
-}
-
-::grpc::Status GroupService::Service::CreateGroup(::grpc::ServerContext* context, const ::im::group::CreateGroupRequest* request, ::im::group::CreateGroupResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status GroupService::Service::JoinGroup(::grpc::ServerContext* context, const ::im::group::JoinGroupRequest* request, ::im::group::GroupActionResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status GroupService::Service::LeaveGroup(::grpc::ServerContext* context, const ::im::group::LeaveGroupRequest* request, ::im::group::GroupActionResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status GroupService::Service::GetGroupInfo(::grpc::ServerContext* context, const ::im::group::GetGroupInfoRequest* request, ::im::group::GetGroupInfoResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status GroupService::Service::SearchGroups(::grpc::ServerContext* context, const ::im::group::SearchGroupsRequest* request, ::im::group::SearchGroupsResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status GroupService::Service::GroupExists(::grpc::ServerContext* context, const ::im::group::GroupExistsRequest* request, ::im::group::GroupExistsResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status GroupService::Service::ListMyGroups(::grpc::ServerContext* context, const ::im::group::GetGroupListRequest* request, ::im::group::GetGroupListResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status GroupService::Service::ListMembers(::grpc::ServerContext* context, const ::im::group::GetGroupMembersRequest* request, ::im::group::GetGroupMembersResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status GroupService::Service::SendGroupMessage(::grpc::ServerContext* context, const ::im::group::SendGroupMessageRequest* request, ::im::group::SendGroupMessageResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status GroupService::Service::GetGroupMessages(::grpc::ServerContext* context, const ::im::group::GetGroupMessagesRequest* request, ::im::group::GetGroupMessagesResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-
-}  // namespace im
-}  // namespace group
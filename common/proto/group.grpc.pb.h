@@ -1,1660 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: group.proto
-#ifndef GRPC_group_2eproto__INCLUDED
-#define GRPC_group_2eproto__INCLUDED
-
-#include "group.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-
-namespace im {
-namespace group {
-
-// GroupService is the distributed gRPC boundary for the current Group MVP.
-// It mirrors the existing Gateway HTTP surface: create/join/leave/list,
-// member listing, group message send, and group message history.
-class GroupService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "im.group.GroupService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status CreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::im::group::CreateGroupResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::CreateGroupResponse>> AsyncCreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::CreateGroupResponse>>(AsyncCreateGroupRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::CreateGroupResponse>> PrepareAsyncCreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::CreateGroupResponse>>(PrepareAsyncCreateGroupRaw(context, request, cq));
-    }
-    virtual ::grpc::Status JoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::im::group::GroupActionResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>> AsyncJoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>>(AsyncJoinGroupRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>> PrepareAsyncJoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>>(PrepareAsyncJoinGroupRaw(context, request, cq));
-    }
-    virtual ::grpc::Status LeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::im::group::GroupActionResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>> AsyncLeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>>(AsyncLeaveGroupRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>> PrepareAsyncLeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>>(PrepareAsyncLeaveGroupRaw(context, request, cq));
-    }
-    virtual ::grpc::Status GetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::im::group::GetGroupInfoResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupInfoResponse>> AsyncGetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupInfoResponse>>(AsyncGetGroupInfoRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupInfoResponse>> PrepareAsyncGetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupInfoResponse>>(PrepareAsyncGetGroupInfoRaw(context, request, cq));
-    }
-    virtual ::grpc::Status SearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::im::group::SearchGroupsResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SearchGroupsResponse>> AsyncSearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SearchGroupsResponse>>(AsyncSearchGroupsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SearchGroupsResponse>> PrepareAsyncSearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SearchGroupsResponse>>(PrepareAsyncSearchGroupsRaw(context, request, cq));
-    }
-    virtual ::grpc::Status GroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::im::group::GroupExistsResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupExistsResponse>> AsyncGroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupExistsResponse>>(AsyncGroupExistsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupExistsResponse>> PrepareAsyncGroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupExistsResponse>>(PrepareAsyncGroupExistsRaw(context, request, cq));
-    }
-    virtual ::grpc::Status ListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::im::group::GetGroupListResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupListResponse>> AsyncListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupListResponse>>(AsyncListMyGroupsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupListResponse>> PrepareAsyncListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupListResponse>>(PrepareAsyncListMyGroupsRaw(context, request, cq));
-    }
-    virtual ::grpc::Status ListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::im::group::GetGroupMembersResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMembersResponse>> AsyncListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMembersResponse>>(AsyncListMembersRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMembersResponse>> PrepareAsyncListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMembersResponse>>(PrepareAsyncListMembersRaw(context, request, cq));
-    }
-    virtual ::grpc::Status SendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::im::group::SendGroupMessageResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SendGroupMessageResponse>> AsyncSendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SendGroupMessageResponse>>(AsyncSendGroupMessageRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SendGroupMessageResponse>> PrepareAsyncSendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SendGroupMessageResponse>>(PrepareAsyncSendGroupMessageRaw(context, request, cq));
-    }
-    virtual ::grpc::Status GetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::im::group::GetGroupMessagesResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMessagesResponse>> AsyncGetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMessagesResponse>>(AsyncGetGroupMessagesRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMessagesResponse>> PrepareAsyncGetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMessagesResponse>>(PrepareAsyncGetGroupMessagesRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void CreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest* request, ::im::group::CreateGroupResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void CreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest* request, ::im::group::CreateGroupResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void JoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest* request, ::im::group::GroupActionResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void JoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest* request, ::im::group::GroupActionResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void LeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest* request, ::im::group::GroupActionResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void LeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest* request, ::im::group::GroupActionResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void GetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest* request, ::im::group::GetGroupInfoResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void GetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest* request, ::im::group::GetGroupInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void SearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest* request, ::im::group::SearchGroupsResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void SearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest* request, ::im::group::SearchGroupsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void GroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest* request, ::im::group::GroupExistsResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void GroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest* request, ::im::group::GroupExistsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void ListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest* request, ::im::group::GetGroupListResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void ListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest* request, ::im::group::GetGroupListResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void ListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest* request, ::im::group::GetGroupMembersResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void ListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest* request, ::im::group::GetGroupMembersResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void SendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest* request, ::im::group::SendGroupMessageResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void SendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest* request, ::im::group::SendGroupMessageResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void GetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest* request, ::im::group::GetGroupMessagesResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void GetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest* request, ::im::group::GetGroupMessagesResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::CreateGroupResponse>* AsyncCreateGroupRaw(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::CreateGroupResponse>* PrepareAsyncCreateGroupRaw(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>* AsyncJoinGroupRaw(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>* PrepareAsyncJoinGroupRaw(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>* AsyncLeaveGroupRaw(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupActionResponse>* PrepareAsyncLeaveGroupRaw(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupInfoResponse>* AsyncGetGroupInfoRaw(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupInfoResponse>* PrepareAsyncGetGroupInfoRaw(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SearchGroupsResponse>* AsyncSearchGroupsRaw(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SearchGroupsResponse>* PrepareAsyncSearchGroupsRaw(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupExistsResponse>* AsyncGroupExistsRaw(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GroupExistsResponse>* PrepareAsyncGroupExistsRaw(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupListResponse>* AsyncListMyGroupsRaw(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupListResponse>* PrepareAsyncListMyGroupsRaw(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMembersResponse>* AsyncListMembersRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMembersResponse>* PrepareAsyncListMembersRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SendGroupMessageResponse>* AsyncSendGroupMessageRaw(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::SendGroupMessageResponse>* PrepareAsyncSendGroupMessageRaw(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMessagesResponse>* AsyncGetGroupMessagesRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::group::GetGroupMessagesResponse>* PrepareAsyncGetGroupMessagesRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status CreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::im::group::CreateGroupResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::CreateGroupResponse>> AsyncCreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::CreateGroupResponse>>(AsyncCreateGroupRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::CreateGroupResponse>> PrepareAsyncCreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::CreateGroupResponse>>(PrepareAsyncCreateGroupRaw(context, request, cq));
-    }
-    ::grpc::Status JoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::im::group::GroupActionResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>> AsyncJoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>>(AsyncJoinGroupRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>> PrepareAsyncJoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>>(PrepareAsyncJoinGroupRaw(context, request, cq));
-    }
-    ::grpc::Status LeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::im::group::GroupActionResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>> AsyncLeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>>(AsyncLeaveGroupRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>> PrepareAsyncLeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>>(PrepareAsyncLeaveGroupRaw(context, request, cq));
-    }
-    ::grpc::Status GetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::im::group::GetGroupInfoResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupInfoResponse>> AsyncGetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupInfoResponse>>(AsyncGetGroupInfoRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupInfoResponse>> PrepareAsyncGetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupInfoResponse>>(PrepareAsyncGetGroupInfoRaw(context, request, cq));
-    }
-    ::grpc::Status SearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::im::group::SearchGroupsResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::SearchGroupsResponse>> AsyncSearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::SearchGroupsResponse>>(AsyncSearchGroupsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::SearchGroupsResponse>> PrepareAsyncSearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::SearchGroupsResponse>>(PrepareAsyncSearchGroupsRaw(context, request, cq));
-    }
-    ::grpc::Status GroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::im::group::GroupExistsResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupExistsResponse>> AsyncGroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupExistsResponse>>(AsyncGroupExistsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupExistsResponse>> PrepareAsyncGroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GroupExistsResponse>>(PrepareAsyncGroupExistsRaw(context, request, cq));
-    }
-    ::grpc::Status ListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::im::group::GetGroupListResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupListResponse>> AsyncListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupListResponse>>(AsyncListMyGroupsRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupListResponse>> PrepareAsyncListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupListResponse>>(PrepareAsyncListMyGroupsRaw(context, request, cq));
-    }
-    ::grpc::Status ListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::im::group::GetGroupMembersResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMembersResponse>> AsyncListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMembersResponse>>(AsyncListMembersRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMembersResponse>> PrepareAsyncListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMembersResponse>>(PrepareAsyncListMembersRaw(context, request, cq));
-    }
-    ::grpc::Status SendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::im::group::SendGroupMessageResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::SendGroupMessageResponse>> AsyncSendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::SendGroupMessageResponse>>(AsyncSendGroupMessageRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::SendGroupMessageResponse>> PrepareAsyncSendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::SendGroupMessageResponse>>(PrepareAsyncSendGroupMessageRaw(context, request, cq));
-    }
-    ::grpc::Status GetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::im::group::GetGroupMessagesResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMessagesResponse>> AsyncGetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMessagesResponse>>(AsyncGetGroupMessagesRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMessagesResponse>> PrepareAsyncGetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMessagesResponse>>(PrepareAsyncGetGroupMessagesRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void CreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest* request, ::im::group::CreateGroupResponse* response, std::function<void(::grpc::Status)>) override;
-      void CreateGroup(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest* request, ::im::group::CreateGroupResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void JoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest* request, ::im::group::GroupActionResponse* response, std::function<void(::grpc::Status)>) override;
-      void JoinGroup(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest* request, ::im::group::GroupActionResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void LeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest* request, ::im::group::GroupActionResponse* response, std::function<void(::grpc::Status)>) override;
-      void LeaveGroup(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest* request, ::im::group::GroupActionResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void GetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest* request, ::im::group::GetGroupInfoResponse* response, std::function<void(::grpc::Status)>) override;
-      void GetGroupInfo(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest* request, ::im::group::GetGroupInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void SearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest* request, ::im::group::SearchGroupsResponse* response, std::function<void(::grpc::Status)>) override;
-      void SearchGroups(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest* request, ::im::group::SearchGroupsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void GroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest* request, ::im::group::GroupExistsResponse* response, std::function<void(::grpc::Status)>) override;
-      void GroupExists(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest* request, ::im::group::GroupExistsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void ListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest* request, ::im::group::GetGroupListResponse* response, std::function<void(::grpc::Status)>) override;
-      void ListMyGroups(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest* request, ::im::group::GetGroupListResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void ListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest* request, ::im::group::GetGroupMembersResponse* response, std::function<void(::grpc::Status)>) override;
-      void ListMembers(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest* request, ::im::group::GetGroupMembersResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void SendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest* request, ::im::group::SendGroupMessageResponse* response, std::function<void(::grpc::Status)>) override;
-      void SendGroupMessage(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest* request, ::im::group::SendGroupMessageResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void GetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest* request, ::im::group::GetGroupMessagesResponse* response, std::function<void(::grpc::Status)>) override;
-      void GetGroupMessages(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest* request, ::im::group::GetGroupMessagesResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::im::group::CreateGroupResponse>* AsyncCreateGroupRaw(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::CreateGroupResponse>* PrepareAsyncCreateGroupRaw(::grpc::ClientContext* context, const ::im::group::CreateGroupRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>* AsyncJoinGroupRaw(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>* PrepareAsyncJoinGroupRaw(::grpc::ClientContext* context, const ::im::group::JoinGroupRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>* AsyncLeaveGroupRaw(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GroupActionResponse>* PrepareAsyncLeaveGroupRaw(::grpc::ClientContext* context, const ::im::group::LeaveGroupRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupInfoResponse>* AsyncGetGroupInfoRaw(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupInfoResponse>* PrepareAsyncGetGroupInfoRaw(::grpc::ClientContext* context, const ::im::group::GetGroupInfoRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::SearchGroupsResponse>* AsyncSearchGroupsRaw(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::SearchGroupsResponse>* PrepareAsyncSearchGroupsRaw(::grpc::ClientContext* context, const ::im::group::SearchGroupsRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GroupExistsResponse>* AsyncGroupExistsRaw(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GroupExistsResponse>* PrepareAsyncGroupExistsRaw(::grpc::ClientContext* context, const ::im::group::GroupExistsRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupListResponse>* AsyncListMyGroupsRaw(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupListResponse>* PrepareAsyncListMyGroupsRaw(::grpc::ClientContext* context, const ::im::group::GetGroupListRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMembersResponse>* AsyncListMembersRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMembersResponse>* PrepareAsyncListMembersRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMembersRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::SendGroupMessageResponse>* AsyncSendGroupMessageRaw(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::SendGroupMessageResponse>* PrepareAsyncSendGroupMessageRaw(::grpc::ClientContext* context, const ::im::group::SendGroupMessageRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMessagesResponse>* AsyncGetGroupMessagesRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::group::GetGroupMessagesResponse>* PrepareAsyncGetGroupMessagesRaw(::grpc::ClientContext* context, const ::im::group::GetGroupMessagesRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_CreateGroup_;
-    const ::grpc::internal::RpcMethod rpcmethod_JoinGroup_;
-    const ::grpc::internal::RpcMethod rpcmethod_LeaveGroup_;
-    const ::grpc::internal::RpcMethod rpcmethod_GetGroupInfo_;
-    const ::grpc::internal::RpcMethod rpcmethod_SearchGroups_;
-    const ::grpc::internal::RpcMethod rpcmethod_GroupExists_;
-    const ::grpc::internal::RpcMethod rpcmethod_ListMyGroups_;
-    const ::grpc::internal::RpcMethod rpcmethod_ListMembers_;
-    const ::grpc::internal::RpcMethod rpcmethod_SendGroupMessage_;
-    const ::grpc::internal::RpcMethod rpcmethod_GetGroupMessages_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status CreateGroup(::grpc::ServerContext* context, const ::im::group::CreateGroupRequest* request, ::im::group::CreateGroupResponse* response);
-    virtual ::grpc::Status JoinGroup(::grpc::ServerContext* context, const ::im::group::JoinGroupRequest* request, ::im::group::GroupActionResponse* response);
-    virtual ::grpc::Status LeaveGroup(::grpc::ServerContext* context, const ::im::group::LeaveGroupRequest* request, ::im::group::GroupActionResponse* response);
-    virtual ::grpc::Status GetGroupInfo(::grpc::ServerContext* context, const ::im::group::GetGroupInfoRequest* request, ::im::group::GetGroupInfoResponse* response);
-    virtual ::grpc::Status SearchGroups(::grpc::ServerContext* context, const ::im::group::SearchGroupsRequest* request, ::im::group::SearchGroupsResponse* response);
-    virtual ::grpc::Status GroupExists(::grpc::ServerContext* context, const ::im::group::GroupExistsRequest* request, ::im::group::GroupExistsResponse* response);
-    virtual ::grpc::Status ListMyGroups(::grpc::ServerContext* context, const ::im::group::GetGroupListRequest* request, ::im::group::GetGroupListResponse* response);
-    virtual ::grpc::Status ListMembers(::grpc::ServerContext* context, const ::im::group::GetGroupMembersRequest* request, ::im::group::GetGroupMembersResponse* response);
-    virtual ::grpc::Status SendGroupMessage(::grpc::ServerContext* context, const ::im::group::SendGroupMessageRequest* request, ::im::group::SendGroupMessageResponse* response);
-    virtual ::grpc::Status GetGroupMessages(::grpc::ServerContext* context, const ::im::group::GetGroupMessagesRequest* request, ::im::group::GetGroupMessagesResponse* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_CreateGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_CreateGroup() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_CreateGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status CreateGroup(::grpc::ServerContext* /*context*/, const ::im::group::CreateGroupRequest* /*request*/, ::im::group::CreateGroupResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestCreateGroup(::grpc::ServerContext* context, ::im::group::CreateGroupRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::CreateGroupResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_JoinGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_JoinGroup() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_JoinGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status JoinGroup(::grpc::ServerContext* /*context*/, const ::im::group::JoinGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestJoinGroup(::grpc::ServerContext* context, ::im::group::JoinGroupRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::GroupActionResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_LeaveGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_LeaveGroup() {
-      ::grpc::Service::MarkMethodAsync(2);
-    }
-    ~WithAsyncMethod_LeaveGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status LeaveGroup(::grpc::ServerContext* /*context*/, const ::im::group::LeaveGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestLeaveGroup(::grpc::ServerContext* context, ::im::group::LeaveGroupRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::GroupActionResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_GetGroupInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_GetGroupInfo() {
-      ::grpc::Service::MarkMethodAsync(3);
-    }
-    ~WithAsyncMethod_GetGroupInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupInfo(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupInfoRequest* /*request*/, ::im::group::GetGroupInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetGroupInfo(::grpc::ServerContext* context, ::im::group::GetGroupInfoRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::GetGroupInfoResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_SearchGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_SearchGroups() {
-      ::grpc::Service::MarkMethodAsync(4);
-    }
-    ~WithAsyncMethod_SearchGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchGroups(::grpc::ServerContext* /*context*/, const ::im::group::SearchGroupsRequest* /*request*/, ::im::group::SearchGroupsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSearchGroups(::grpc::ServerContext* context, ::im::group::SearchGroupsRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::SearchGroupsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_GroupExists : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_GroupExists() {
-      ::grpc::Service::MarkMethodAsync(5);
-    }
-    ~WithAsyncMethod_GroupExists() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GroupExists(::grpc::ServerContext* /*context*/, const ::im::group::GroupExistsRequest* /*request*/, ::im::group::GroupExistsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGroupExists(::grpc::ServerContext* context, ::im::group::GroupExistsRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::GroupExistsResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_ListMyGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_ListMyGroups() {
-      ::grpc::Service::MarkMethodAsync(6);
-    }
-    ~WithAsyncMethod_ListMyGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMyGroups(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupListRequest* /*request*/, ::im::group::GetGroupListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestListMyGroups(::grpc::ServerContext* context, ::im::group::GetGroupListRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::GetGroupListResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_ListMembers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_ListMembers() {
-      ::grpc::Service::MarkMethodAsync(7);
-    }
-    ~WithAsyncMethod_ListMembers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMembers(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMembersRequest* /*request*/, ::im::group::GetGroupMembersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestListMembers(::grpc::ServerContext* context, ::im::group::GetGroupMembersRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::GetGroupMembersResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_SendGroupMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_SendGroupMessage() {
-      ::grpc::Service::MarkMethodAsync(8);
-    }
-    ~WithAsyncMethod_SendGroupMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendGroupMessage(::grpc::ServerContext* /*context*/, const ::im::group::SendGroupMessageRequest* /*request*/, ::im::group::SendGroupMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSendGroupMessage(::grpc::ServerContext* context, ::im::group::SendGroupMessageRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::SendGroupMessageResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_GetGroupMessages : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_GetGroupMessages() {
-      ::grpc::Service::MarkMethodAsync(9);
-    }
-    ~WithAsyncMethod_GetGroupMessages() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupMessages(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMessagesRequest* /*request*/, ::im::group::GetGroupMessagesResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetGroupMessages(::grpc::ServerContext* context, ::im::group::GetGroupMessagesRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::group::GetGroupMessagesResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_CreateGroup<WithAsyncMethod_JoinGroup<WithAsyncMethod_LeaveGroup<WithAsyncMethod_GetGroupInfo<WithAsyncMethod_SearchGroups<WithAsyncMethod_GroupExists<WithAsyncMethod_ListMyGroups<WithAsyncMethod_ListMembers<WithAsyncMethod_SendGroupMessage<WithAsyncMethod_GetGroupMessages<Service > > > > > > > > > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_CreateGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_CreateGroup() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::CreateGroupRequest, ::im::group::CreateGroupResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::CreateGroupRequest* request, ::im::group::CreateGroupResponse* response) { return this->CreateGroup(context, request, response); }));}
-    void SetMessageAllocatorFor_CreateGroup(
-        ::grpc::MessageAllocator< ::im::group::CreateGroupRequest, ::im::group::CreateGroupResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::CreateGroupRequest, ::im::group::CreateGroupResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_CreateGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status CreateGroup(::grpc::ServerContext* /*context*/, const ::im::group::CreateGroupRequest* /*request*/, ::im::group::CreateGroupResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* CreateGroup(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::CreateGroupRequest* /*request*/, ::im::group::CreateGroupResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_JoinGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_JoinGroup() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::JoinGroupRequest, ::im::group::GroupActionResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::JoinGroupRequest* request, ::im::group::GroupActionResponse* response) { return this->JoinGroup(context, request, response); }));}
-    void SetMessageAllocatorFor_JoinGroup(
-        ::grpc::MessageAllocator< ::im::group::JoinGroupRequest, ::im::group::GroupActionResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::JoinGroupRequest, ::im::group::GroupActionResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_JoinGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status JoinGroup(::grpc::ServerContext* /*context*/, const ::im::group::JoinGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* JoinGroup(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::JoinGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_LeaveGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_LeaveGroup() {
-      ::grpc::Service::MarkMethodCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::LeaveGroupRequest, ::im::group::GroupActionResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::LeaveGroupRequest* request, ::im::group::GroupActionResponse* response) { return this->LeaveGroup(context, request, response); }));}
-    void SetMessageAllocatorFor_LeaveGroup(
-        ::grpc::MessageAllocator< ::im::group::LeaveGroupRequest, ::im::group::GroupActionResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::LeaveGroupRequest, ::im::group::GroupActionResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_LeaveGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status LeaveGroup(::grpc::ServerContext* /*context*/, const ::im::group::LeaveGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* LeaveGroup(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::LeaveGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_GetGroupInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_GetGroupInfo() {
-      ::grpc::Service::MarkMethodCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::GetGroupInfoRequest, ::im::group::GetGroupInfoResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::GetGroupInfoRequest* request, ::im::group::GetGroupInfoResponse* response) { return this->GetGroupInfo(context, request, response); }));}
-    void SetMessageAllocatorFor_GetGroupInfo(
-        ::grpc::MessageAllocator< ::im::group::GetGroupInfoRequest, ::im::group::GetGroupInfoResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::GetGroupInfoRequest, ::im::group::GetGroupInfoResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_GetGroupInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupInfo(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupInfoRequest* /*request*/, ::im::group::GetGroupInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetGroupInfo(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::GetGroupInfoRequest* /*request*/, ::im::group::GetGroupInfoResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_SearchGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_SearchGroups() {
-      ::grpc::Service::MarkMethodCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::SearchGroupsRequest, ::im::group::SearchGroupsResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::SearchGroupsRequest* request, ::im::group::SearchGroupsResponse* response) { return this->SearchGroups(context, request, response); }));}
-    void SetMessageAllocatorFor_SearchGroups(
-        ::grpc::MessageAllocator< ::im::group::SearchGroupsRequest, ::im::group::SearchGroupsResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::SearchGroupsRequest, ::im::group::SearchGroupsResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_SearchGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchGroups(::grpc::ServerContext* /*context*/, const ::im::group::SearchGroupsRequest* /*request*/, ::im::group::SearchGroupsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SearchGroups(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::SearchGroupsRequest* /*request*/, ::im::group::SearchGroupsResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_GroupExists : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_GroupExists() {
-      ::grpc::Service::MarkMethodCallback(5,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::GroupExistsRequest, ::im::group::GroupExistsResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::GroupExistsRequest* request, ::im::group::GroupExistsResponse* response) { return this->GroupExists(context, request, response); }));}
-    void SetMessageAllocatorFor_GroupExists(
-        ::grpc::MessageAllocator< ::im::group::GroupExistsRequest, ::im::group::GroupExistsResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::GroupExistsRequest, ::im::group::GroupExistsResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_GroupExists() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GroupExists(::grpc::ServerContext* /*context*/, const ::im::group::GroupExistsRequest* /*request*/, ::im::group::GroupExistsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GroupExists(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::GroupExistsRequest* /*request*/, ::im::group::GroupExistsResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_ListMyGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_ListMyGroups() {
-      ::grpc::Service::MarkMethodCallback(6,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::GetGroupListRequest, ::im::group::GetGroupListResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::GetGroupListRequest* request, ::im::group::GetGroupListResponse* response) { return this->ListMyGroups(context, request, response); }));}
-    void SetMessageAllocatorFor_ListMyGroups(
-        ::grpc::MessageAllocator< ::im::group::GetGroupListRequest, ::im::group::GetGroupListResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::GetGroupListRequest, ::im::group::GetGroupListResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_ListMyGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMyGroups(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupListRequest* /*request*/, ::im::group::GetGroupListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ListMyGroups(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::GetGroupListRequest* /*request*/, ::im::group::GetGroupListResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_ListMembers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_ListMembers() {
-      ::grpc::Service::MarkMethodCallback(7,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::GetGroupMembersRequest, ::im::group::GetGroupMembersResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::GetGroupMembersRequest* request, ::im::group::GetGroupMembersResponse* response) { return this->ListMembers(context, request, response); }));}
-    void SetMessageAllocatorFor_ListMembers(
-        ::grpc::MessageAllocator< ::im::group::GetGroupMembersRequest, ::im::group::GetGroupMembersResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::GetGroupMembersRequest, ::im::group::GetGroupMembersResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_ListMembers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMembers(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMembersRequest* /*request*/, ::im::group::GetGroupMembersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ListMembers(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::GetGroupMembersRequest* /*request*/, ::im::group::GetGroupMembersResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_SendGroupMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_SendGroupMessage() {
-      ::grpc::Service::MarkMethodCallback(8,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::SendGroupMessageRequest, ::im::group::SendGroupMessageResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::SendGroupMessageRequest* request, ::im::group::SendGroupMessageResponse* response) { return this->SendGroupMessage(context, request, response); }));}
-    void SetMessageAllocatorFor_SendGroupMessage(
-        ::grpc::MessageAllocator< ::im::group::SendGroupMessageRequest, ::im::group::SendGroupMessageResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::SendGroupMessageRequest, ::im::group::SendGroupMessageResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_SendGroupMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendGroupMessage(::grpc::ServerContext* /*context*/, const ::im::group::SendGroupMessageRequest* /*request*/, ::im::group::SendGroupMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SendGroupMessage(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::SendGroupMessageRequest* /*request*/, ::im::group::SendGroupMessageResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_GetGroupMessages : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_GetGroupMessages() {
-      ::grpc::Service::MarkMethodCallback(9,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::group::GetGroupMessagesRequest, ::im::group::GetGroupMessagesResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::group::GetGroupMessagesRequest* request, ::im::group::GetGroupMessagesResponse* response) { return this->GetGroupMessages(context, request, response); }));}
-    void SetMessageAllocatorFor_GetGroupMessages(
-        ::grpc::MessageAllocator< ::im::group::GetGroupMessagesRequest, ::im::group::GetGroupMessagesResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::group::GetGroupMessagesRequest, ::im::group::GetGroupMessagesResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_GetGroupMessages() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupMessages(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMessagesRequest* /*request*/, ::im::group::GetGroupMessagesResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetGroupMessages(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::group::GetGroupMessagesRequest* /*request*/, ::im::group::GetGroupMessagesResponse* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_CreateGroup<WithCallbackMethod_JoinGroup<WithCallbackMethod_LeaveGroup<WithCallbackMethod_GetGroupInfo<WithCallbackMethod_SearchGroups<WithCallbackMethod_GroupExists<WithCallbackMethod_ListMyGroups<WithCallbackMethod_ListMembers<WithCallbackMethod_SendGroupMessage<WithCallbackMethod_GetGroupMessages<Service > > > > > > > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_CreateGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_CreateGroup() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_CreateGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status CreateGroup(::grpc::ServerContext* /*context*/, const ::im::group::CreateGroupRequest* /*request*/, ::im::group::CreateGroupResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_JoinGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_JoinGroup() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_JoinGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status JoinGroup(::grpc::ServerContext* /*context*/, const ::im::group::JoinGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_LeaveGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_LeaveGroup() {
-      ::grpc::Service::MarkMethodGeneric(2);
-    }
-    ~WithGenericMethod_LeaveGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status LeaveGroup(::grpc::ServerContext* /*context*/, const ::im::group::LeaveGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_GetGroupInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_GetGroupInfo() {
-      ::grpc::Service::MarkMethodGeneric(3);
-    }
-    ~WithGenericMethod_GetGroupInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupInfo(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupInfoRequest* /*request*/, ::im::group::GetGroupInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_SearchGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_SearchGroups() {
-      ::grpc::Service::MarkMethodGeneric(4);
-    }
-    ~WithGenericMethod_SearchGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchGroups(::grpc::ServerContext* /*context*/, const ::im::group::SearchGroupsRequest* /*request*/, ::im::group::SearchGroupsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_GroupExists : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_GroupExists() {
-      ::grpc::Service::MarkMethodGeneric(5);
-    }
-    ~WithGenericMethod_GroupExists() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GroupExists(::grpc::ServerContext* /*context*/, const ::im::group::GroupExistsRequest* /*request*/, ::im::group::GroupExistsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_ListMyGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_ListMyGroups() {
-      ::grpc::Service::MarkMethodGeneric(6);
-    }
-    ~WithGenericMethod_ListMyGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMyGroups(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupListRequest* /*request*/, ::im::group::GetGroupListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_ListMembers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_ListMembers() {
-      ::grpc::Service::MarkMethodGeneric(7);
-    }
-    ~WithGenericMethod_ListMembers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMembers(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMembersRequest* /*request*/, ::im::group::GetGroupMembersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_SendGroupMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_SendGroupMessage() {
-      ::grpc::Service::MarkMethodGeneric(8);
-    }
-    ~WithGenericMethod_SendGroupMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendGroupMessage(::grpc::ServerContext* /*context*/, const ::im::group::SendGroupMessageRequest* /*request*/, ::im::group::SendGroupMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_GetGroupMessages : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_GetGroupMessages() {
-      ::grpc::Service::MarkMethodGeneric(9);
-    }
-    ~WithGenericMethod_GetGroupMessages() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupMessages(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMessagesRequest* /*request*/, ::im::group::GetGroupMessagesResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_CreateGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_CreateGroup() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_CreateGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status CreateGroup(::grpc::ServerContext* /*context*/, const ::im::group::CreateGroupRequest* /*request*/, ::im::group::CreateGroupResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestCreateGroup(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_JoinGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_JoinGroup() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_JoinGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status JoinGroup(::grpc::ServerContext* /*context*/, const ::im::group::JoinGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestJoinGroup(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_LeaveGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_LeaveGroup() {
-      ::grpc::Service::MarkMethodRaw(2);
-    }
-    ~WithRawMethod_LeaveGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status LeaveGroup(::grpc::ServerContext* /*context*/, const ::im::group::LeaveGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestLeaveGroup(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_GetGroupInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_GetGroupInfo() {
-      ::grpc::Service::MarkMethodRaw(3);
-    }
-    ~WithRawMethod_GetGroupInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupInfo(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupInfoRequest* /*request*/, ::im::group::GetGroupInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetGroupInfo(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_SearchGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_SearchGroups() {
-      ::grpc::Service::MarkMethodRaw(4);
-    }
-    ~WithRawMethod_SearchGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchGroups(::grpc::ServerContext* /*context*/, const ::im::group::SearchGroupsRequest* /*request*/, ::im::group::SearchGroupsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSearchGroups(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_GroupExists : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_GroupExists() {
-      ::grpc::Service::MarkMethodRaw(5);
-    }
-    ~WithRawMethod_GroupExists() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GroupExists(::grpc::ServerContext* /*context*/, const ::im::group::GroupExistsRequest* /*request*/, ::im::group::GroupExistsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGroupExists(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_ListMyGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_ListMyGroups() {
-      ::grpc::Service::MarkMethodRaw(6);
-    }
-    ~WithRawMethod_ListMyGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMyGroups(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupListRequest* /*request*/, ::im::group::GetGroupListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestListMyGroups(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_ListMembers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_ListMembers() {
-      ::grpc::Service::MarkMethodRaw(7);
-    }
-    ~WithRawMethod_ListMembers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMembers(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMembersRequest* /*request*/, ::im::group::GetGroupMembersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestListMembers(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_SendGroupMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_SendGroupMessage() {
-      ::grpc::Service::MarkMethodRaw(8);
-    }
-    ~WithRawMethod_SendGroupMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendGroupMessage(::grpc::ServerContext* /*context*/, const ::im::group::SendGroupMessageRequest* /*request*/, ::im::group::SendGroupMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSendGroupMessage(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_GetGroupMessages : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_GetGroupMessages() {
-      ::grpc::Service::MarkMethodRaw(9);
-    }
-    ~WithRawMethod_GetGroupMessages() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupMessages(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMessagesRequest* /*request*/, ::im::group::GetGroupMessagesResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetGroupMessages(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_CreateGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_CreateGroup() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->CreateGroup(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_CreateGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status CreateGroup(::grpc::ServerContext* /*context*/, const ::im::group::CreateGroupRequest* /*request*/, ::im::group::CreateGroupResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* CreateGroup(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_JoinGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_JoinGroup() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->JoinGroup(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_JoinGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status JoinGroup(::grpc::ServerContext* /*context*/, const ::im::group::JoinGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* JoinGroup(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_LeaveGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_LeaveGroup() {
-      ::grpc::Service::MarkMethodRawCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->LeaveGroup(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_LeaveGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status LeaveGroup(::grpc::ServerContext* /*context*/, const ::im::group::LeaveGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* LeaveGroup(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_GetGroupInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_GetGroupInfo() {
-      ::grpc::Service::MarkMethodRawCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetGroupInfo(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_GetGroupInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupInfo(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupInfoRequest* /*request*/, ::im::group::GetGroupInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetGroupInfo(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_SearchGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_SearchGroups() {
-      ::grpc::Service::MarkMethodRawCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SearchGroups(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_SearchGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchGroups(::grpc::ServerContext* /*context*/, const ::im::group::SearchGroupsRequest* /*request*/, ::im::group::SearchGroupsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SearchGroups(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_GroupExists : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_GroupExists() {
-      ::grpc::Service::MarkMethodRawCallback(5,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GroupExists(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_GroupExists() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GroupExists(::grpc::ServerContext* /*context*/, const ::im::group::GroupExistsRequest* /*request*/, ::im::group::GroupExistsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GroupExists(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_ListMyGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_ListMyGroups() {
-      ::grpc::Service::MarkMethodRawCallback(6,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ListMyGroups(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_ListMyGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMyGroups(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupListRequest* /*request*/, ::im::group::GetGroupListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ListMyGroups(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_ListMembers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_ListMembers() {
-      ::grpc::Service::MarkMethodRawCallback(7,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ListMembers(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_ListMembers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status ListMembers(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMembersRequest* /*request*/, ::im::group::GetGroupMembersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* ListMembers(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_SendGroupMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_SendGroupMessage() {
-      ::grpc::Service::MarkMethodRawCallback(8,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SendGroupMessage(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_SendGroupMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendGroupMessage(::grpc::ServerContext* /*context*/, const ::im::group::SendGroupMessageRequest* /*request*/, ::im::group::SendGroupMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SendGroupMessage(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_GetGroupMessages : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_GetGroupMessages() {
-      ::grpc::Service::MarkMethodRawCallback(9,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetGroupMessages(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_GetGroupMessages() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetGroupMessages(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMessagesRequest* /*request*/, ::im::group::GetGroupMessagesResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetGroupMessages(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_CreateGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_CreateGroup() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::CreateGroupRequest, ::im::group::CreateGroupResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::CreateGroupRequest, ::im::group::CreateGroupResponse>* streamer) {
-                       return this->StreamedCreateGroup(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_CreateGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status CreateGroup(::grpc::ServerContext* /*context*/, const ::im::group::CreateGroupRequest* /*request*/, ::im::group::CreateGroupResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedCreateGroup(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::CreateGroupRequest,::im::group::CreateGroupResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_JoinGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_JoinGroup() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::JoinGroupRequest, ::im::group::GroupActionResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::JoinGroupRequest, ::im::group::GroupActionResponse>* streamer) {
-                       return this->StreamedJoinGroup(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_JoinGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status JoinGroup(::grpc::ServerContext* /*context*/, const ::im::group::JoinGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedJoinGroup(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::JoinGroupRequest,::im::group::GroupActionResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_LeaveGroup : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_LeaveGroup() {
-      ::grpc::Service::MarkMethodStreamed(2,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::LeaveGroupRequest, ::im::group::GroupActionResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::LeaveGroupRequest, ::im::group::GroupActionResponse>* streamer) {
-                       return this->StreamedLeaveGroup(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_LeaveGroup() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status LeaveGroup(::grpc::ServerContext* /*context*/, const ::im::group::LeaveGroupRequest* /*request*/, ::im::group::GroupActionResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedLeaveGroup(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::LeaveGroupRequest,::im::group::GroupActionResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_GetGroupInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_GetGroupInfo() {
-      ::grpc::Service::MarkMethodStreamed(3,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::GetGroupInfoRequest, ::im::group::GetGroupInfoResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::GetGroupInfoRequest, ::im::group::GetGroupInfoResponse>* streamer) {
-                       return this->StreamedGetGroupInfo(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_GetGroupInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status GetGroupInfo(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupInfoRequest* /*request*/, ::im::group::GetGroupInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetGroupInfo(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::GetGroupInfoRequest,::im::group::GetGroupInfoResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_SearchGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_SearchGroups() {
-      ::grpc::Service::MarkMethodStreamed(4,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::SearchGroupsRequest, ::im::group::SearchGroupsResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::SearchGroupsRequest, ::im::group::SearchGroupsResponse>* streamer) {
-                       return this->StreamedSearchGroups(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_SearchGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status SearchGroups(::grpc::ServerContext* /*context*/, const ::im::group::SearchGroupsRequest* /*request*/, ::im::group::SearchGroupsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSearchGroups(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::SearchGroupsRequest,::im::group::SearchGroupsResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_GroupExists : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_GroupExists() {
-      ::grpc::Service::MarkMethodStreamed(5,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::GroupExistsRequest, ::im::group::GroupExistsResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::GroupExistsRequest, ::im::group::GroupExistsResponse>* streamer) {
-                       return this->StreamedGroupExists(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_GroupExists() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status GroupExists(::grpc::ServerContext* /*context*/, const ::im::group::GroupExistsRequest* /*request*/, ::im::group::GroupExistsResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGroupExists(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::GroupExistsRequest,::im::group::GroupExistsResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_ListMyGroups : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_ListMyGroups() {
-      ::grpc::Service::MarkMethodStreamed(6,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::GetGroupListRequest, ::im::group::GetGroupListResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::GetGroupListRequest, ::im::group::GetGroupListResponse>* streamer) {
-                       return this->StreamedListMyGroups(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_ListMyGroups() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status ListMyGroups(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupListRequest* /*request*/, ::im::group::GetGroupListResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedListMyGroups(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::GetGroupListRequest,::im::group::GetGroupListResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_ListMembers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_ListMembers() {
-      ::grpc::Service::MarkMethodStreamed(7,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::GetGroupMembersRequest, ::im::group::GetGroupMembersResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::GetGroupMembersRequest, ::im::group::GetGroupMembersResponse>* streamer) {
-                       return this->StreamedListMembers(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_ListMembers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status ListMembers(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMembersRequest* /*request*/, ::im::group::GetGroupMembersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedListMembers(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::GetGroupMembersRequest,::im::group::GetGroupMembersResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_SendGroupMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_SendGroupMessage() {
-      ::grpc::Service::MarkMethodStreamed(8,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::SendGroupMessageRequest, ::im::group::SendGroupMessageResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::SendGroupMessageRequest, ::im::group::SendGroupMessageResponse>* streamer) {
-                       return this->StreamedSendGroupMessage(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_SendGroupMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status SendGroupMessage(::grpc::ServerContext* /*context*/, const ::im::group::SendGroupMessageRequest* /*request*/, ::im::group::SendGroupMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSendGroupMessage(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::SendGroupMessageRequest,::im::group::SendGroupMessageResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_GetGroupMessages : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_GetGroupMessages() {
-      ::grpc::Service::MarkMethodStreamed(9,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::group::GetGroupMessagesRequest, ::im::group::GetGroupMessagesResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::group::GetGroupMessagesRequest, ::im::group::GetGroupMessagesResponse>* streamer) {
-                       return this->StreamedGetGroupMessages(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_GetGroupMessages() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status GetGroupMessages(::grpc::ServerContext* /*context*/, const ::im::group::GetGroupMessagesRequest* /*request*/, ::im::group::GetGroupMessagesResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetGroupMessages(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::group::GetGroupMessagesRequest,::im::group::GetGroupMessagesResponse>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_CreateGroup<WithStreamedUnaryMethod_JoinGroup<WithStreamedUnaryMethod_LeaveGroup<WithStreamedUnaryMethod_GetGroupInfo<WithStreamedUnaryMethod_SearchGroups<WithStreamedUnaryMethod_GroupExists<WithStreamedUnaryMethod_ListMyGroups<WithStreamedUnaryMethod_ListMembers<WithStreamedUnaryMethod_SendGroupMessage<WithStreamedUnaryMethod_GetGroupMessages<Service > > > > > > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_CreateGroup<WithStreamedUnaryMethod_JoinGroup<WithStreamedUnaryMethod_LeaveGroup<WithStreamedUnaryMethod_GetGroupInfo<WithStreamedUnaryMethod_SearchGroups<WithStreamedUnaryMethod_GroupExists<WithStreamedUnaryMethod_ListMyGroups<WithStreamedUnaryMethod_ListMembers<WithStreamedUnaryMethod_SendGroupMessage<WithStreamedUnaryMethod_GetGroupMessages<Service > > > > > > > > > > StreamedService;
-};
-
-}  // namespace group
-}  // namespace im
-
-
-#include <grpcpp/ports_undef.inc>
-#endif  // GRPC_group_2eproto__INCLUDED
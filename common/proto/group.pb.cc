@@ -1,13000 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: group.proto
-// Protobuf C++ Version: 5.29.3
-
-#include "group.pb.h"
-
-#include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace im {
-namespace group {
-
-inline constexpr GroupMessage::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : sender_uid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        sender_nickname_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        content_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        msg_id_{::uint64_t{0u}},
-        group_id_{::uint64_t{0u}},
-        create_time_{::int64_t{0}},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GroupMessage::GroupMessage(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GroupMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GroupMessageDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GroupMessageDefaultTypeInternal() {}
-  union {
-    GroupMessage _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GroupMessageDefaultTypeInternal _GroupMessage_default_instance_;
-
-inline constexpr GroupMember::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : uid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        nickname_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        role_{static_cast< ::im::group::GroupRole >(0)},
-        is_muted_{0},
-        join_time_{::int64_t{0}},
-        member_record_id_{::uint64_t{0u}},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GroupMember::GroupMember(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GroupMemberDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GroupMemberDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GroupMemberDefaultTypeInternal() {}
-  union {
-    GroupMember _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GroupMemberDefaultTypeInternal _GroupMember_default_instance_;
-
-inline constexpr GroupInfo::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        avatar_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        notice_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        owner_uid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        create_time_{::int64_t{0}},
-        is_muted_{0},
-        member_count_{0},
-        group_record_id_{::uint64_t{0u}},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GroupInfo::GroupInfo(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GroupInfoDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GroupInfoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GroupInfoDefaultTypeInternal() {}
-  union {
-    GroupInfo _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GroupInfoDefaultTypeInternal _GroupInfo_default_instance_;
-
-inline constexpr GroupExistsRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : group_id_{::uint64_t{0u}},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GroupExistsRequest::GroupExistsRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GroupExistsRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GroupExistsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GroupExistsRequestDefaultTypeInternal() {}
-  union {
-    GroupExistsRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GroupExistsRequestDefaultTypeInternal _GroupExistsRequest_default_instance_;
-
-inline constexpr TransferGroupOwnerResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TransferGroupOwnerResponse::TransferGroupOwnerResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TransferGroupOwnerResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TransferGroupOwnerResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TransferGroupOwnerResponseDefaultTypeInternal() {}
-  union {
-    TransferGroupOwnerResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferGroupOwnerResponseDefaultTypeInternal _TransferGroupOwnerResponse_default_instance_;
-
-inline constexpr TransferGroupOwnerRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        new_owner_uid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR TransferGroupOwnerRequest::TransferGroupOwnerRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct TransferGroupOwnerRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR TransferGroupOwnerRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~TransferGroupOwnerRequestDefaultTypeInternal() {}
-  union {
-    TransferGroupOwnerRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransferGroupOwnerRequestDefaultTypeInternal _TransferGroupOwnerRequest_default_instance_;
-
-inline constexpr SetGroupAdminResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SetGroupAdminResponse::SetGroupAdminResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SetGroupAdminResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SetGroupAdminResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SetGroupAdminResponseDefaultTypeInternal() {}
-  union {
-    SetGroupAdminResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetGroupAdminResponseDefaultTypeInternal _SetGroupAdminResponse_default_instance_;
-
-inline constexpr SetGroupAdminRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        uid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr},
-        set_admin_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SetGroupAdminRequest::SetGroupAdminRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SetGroupAdminRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SetGroupAdminRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SetGroupAdminRequestDefaultTypeInternal() {}
-  union {
-    SetGroupAdminRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SetGroupAdminRequestDefaultTypeInternal _SetGroupAdminRequest_default_instance_;
-
-inline constexpr SendGroupMessageResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr},
-        message_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SendGroupMessageResponse::SendGroupMessageResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SendGroupMessageResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SendGroupMessageResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SendGroupMessageResponseDefaultTypeInternal() {}
-  union {
-    SendGroupMessageResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendGroupMessageResponseDefaultTypeInternal _SendGroupMessageResponse_default_instance_;
-
-inline constexpr SendGroupMessageRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        content_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr},
-        group_id_{::uint64_t{0u}},
-        create_time_{::int64_t{0}} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SendGroupMessageRequest::SendGroupMessageRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SendGroupMessageRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SendGroupMessageRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SendGroupMessageRequestDefaultTypeInternal() {}
-  union {
-    SendGroupMessageRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendGroupMessageRequestDefaultTypeInternal _SendGroupMessageRequest_default_instance_;
-
-inline constexpr SearchGroupsResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        groups_{},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SearchGroupsResponse::SearchGroupsResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SearchGroupsResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SearchGroupsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SearchGroupsResponseDefaultTypeInternal() {}
-  union {
-    SearchGroupsResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchGroupsResponseDefaultTypeInternal _SearchGroupsResponse_default_instance_;
-
-inline constexpr SearchGroupsRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        keyword_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr},
-        limit_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SearchGroupsRequest::SearchGroupsRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SearchGroupsRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SearchGroupsRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SearchGroupsRequestDefaultTypeInternal() {}
-  union {
-    SearchGroupsRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchGroupsRequestDefaultTypeInternal _SearchGroupsRequest_default_instance_;
-
-inline constexpr QuitGroupResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR QuitGroupResponse::QuitGroupResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct QuitGroupResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR QuitGroupResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~QuitGroupResponseDefaultTypeInternal() {}
-  union {
-    QuitGroupResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QuitGroupResponseDefaultTypeInternal _QuitGroupResponse_default_instance_;
-
-inline constexpr QuitGroupRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR QuitGroupRequest::QuitGroupRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct QuitGroupRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR QuitGroupRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~QuitGroupRequestDefaultTypeInternal() {}
-  union {
-    QuitGroupRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QuitGroupRequestDefaultTypeInternal _QuitGroupRequest_default_instance_;
-
-inline constexpr ModifyGroupInfoResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr},
-        group_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ModifyGroupInfoResponse::ModifyGroupInfoResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ModifyGroupInfoResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ModifyGroupInfoResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ModifyGroupInfoResponseDefaultTypeInternal() {}
-  union {
-    ModifyGroupInfoResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModifyGroupInfoResponseDefaultTypeInternal _ModifyGroupInfoResponse_default_instance_;
-
-inline constexpr ModifyGroupInfoRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        avatar_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        notice_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ModifyGroupInfoRequest::ModifyGroupInfoRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ModifyGroupInfoRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ModifyGroupInfoRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ModifyGroupInfoRequestDefaultTypeInternal() {}
-  union {
-    ModifyGroupInfoRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ModifyGroupInfoRequestDefaultTypeInternal _ModifyGroupInfoRequest_default_instance_;
-
-inline constexpr LeaveGroupRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        header_{nullptr},
-        group_id_{::uint64_t{0u}} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR LeaveGroupRequest::LeaveGroupRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct LeaveGroupRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR LeaveGroupRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~LeaveGroupRequestDefaultTypeInternal() {}
-  union {
-    LeaveGroupRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LeaveGroupRequestDefaultTypeInternal _LeaveGroupRequest_default_instance_;
-
-inline constexpr KickMemberResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR KickMemberResponse::KickMemberResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct KickMemberResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR KickMemberResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~KickMemberResponseDefaultTypeInternal() {}
-  union {
-    KickMemberResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KickMemberResponseDefaultTypeInternal _KickMemberResponse_default_instance_;
-
-inline constexpr KickMemberRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        kick_uids_{},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR KickMemberRequest::KickMemberRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct KickMemberRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR KickMemberRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~KickMemberRequestDefaultTypeInternal() {}
-  union {
-    KickMemberRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 KickMemberRequestDefaultTypeInternal _KickMemberRequest_default_instance_;
-
-inline constexpr JoinGroupRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        header_{nullptr},
-        group_id_{::uint64_t{0u}} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR JoinGroupRequest::JoinGroupRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct JoinGroupRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR JoinGroupRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~JoinGroupRequestDefaultTypeInternal() {}
-  union {
-    JoinGroupRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 JoinGroupRequestDefaultTypeInternal _JoinGroupRequest_default_instance_;
-
-inline constexpr InviteMemberResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR InviteMemberResponse::InviteMemberResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct InviteMemberResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR InviteMemberResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~InviteMemberResponseDefaultTypeInternal() {}
-  union {
-    InviteMemberResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InviteMemberResponseDefaultTypeInternal _InviteMemberResponse_default_instance_;
-
-inline constexpr InviteMemberRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        invite_uids_{},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR InviteMemberRequest::InviteMemberRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct InviteMemberRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR InviteMemberRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~InviteMemberRequestDefaultTypeInternal() {}
-  union {
-    InviteMemberRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InviteMemberRequestDefaultTypeInternal _InviteMemberRequest_default_instance_;
-
-inline constexpr GroupExistsResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr},
-        exists_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GroupExistsResponse::GroupExistsResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GroupExistsResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GroupExistsResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GroupExistsResponseDefaultTypeInternal() {}
-  union {
-    GroupExistsResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GroupExistsResponseDefaultTypeInternal _GroupExistsResponse_default_instance_;
-
-inline constexpr GroupActionResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GroupActionResponse::GroupActionResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GroupActionResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GroupActionResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GroupActionResponseDefaultTypeInternal() {}
-  union {
-    GroupActionResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GroupActionResponseDefaultTypeInternal _GroupActionResponse_default_instance_;
-
-inline constexpr GetGroupMessagesResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        messages_{},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetGroupMessagesResponse::GetGroupMessagesResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetGroupMessagesResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetGroupMessagesResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetGroupMessagesResponseDefaultTypeInternal() {}
-  union {
-    GetGroupMessagesResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetGroupMessagesResponseDefaultTypeInternal _GetGroupMessagesResponse_default_instance_;
-
-inline constexpr GetGroupMessagesRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr},
-        since_{::int64_t{0}},
-        group_record_id_{::uint64_t{0u}},
-        limit_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetGroupMessagesRequest::GetGroupMessagesRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetGroupMessagesRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetGroupMessagesRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetGroupMessagesRequestDefaultTypeInternal() {}
-  union {
-    GetGroupMessagesRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetGroupMessagesRequestDefaultTypeInternal _GetGroupMessagesRequest_default_instance_;
-
-inline constexpr GetGroupMembersResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        members_{},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetGroupMembersResponse::GetGroupMembersResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetGroupMembersResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetGroupMembersResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetGroupMembersResponseDefaultTypeInternal() {}
-  union {
-    GetGroupMembersResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetGroupMembersResponseDefaultTypeInternal _GetGroupMembersResponse_default_instance_;
-
-inline constexpr GetGroupMembersRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr},
-        group_record_id_{::uint64_t{0u}} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetGroupMembersRequest::GetGroupMembersRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetGroupMembersRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetGroupMembersRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetGroupMembersRequestDefaultTypeInternal() {}
-  union {
-    GetGroupMembersRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetGroupMembersRequestDefaultTypeInternal _GetGroupMembersRequest_default_instance_;
-
-inline constexpr GetGroupListResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        groups_{},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetGroupListResponse::GetGroupListResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetGroupListResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetGroupListResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetGroupListResponseDefaultTypeInternal() {}
-  union {
-    GetGroupListResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetGroupListResponseDefaultTypeInternal _GetGroupListResponse_default_instance_;
-
-inline constexpr GetGroupListRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        header_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetGroupListRequest::GetGroupListRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetGroupListRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetGroupListRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetGroupListRequestDefaultTypeInternal() {}
-  union {
-    GetGroupListRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetGroupListRequestDefaultTypeInternal _GetGroupListRequest_default_instance_;
-
-inline constexpr GetGroupInfoResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        members_{},
-        base_{nullptr},
-        group_{nullptr},
-        joined_{false} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetGroupInfoResponse::GetGroupInfoResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetGroupInfoResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetGroupInfoResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetGroupInfoResponseDefaultTypeInternal() {}
-  union {
-    GetGroupInfoResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetGroupInfoResponseDefaultTypeInternal _GetGroupInfoResponse_default_instance_;
-
-inline constexpr GetGroupInfoRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr},
-        group_record_id_{::uint64_t{0u}} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetGroupInfoRequest::GetGroupInfoRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetGroupInfoRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetGroupInfoRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetGroupInfoRequestDefaultTypeInternal() {}
-  union {
-    GetGroupInfoRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetGroupInfoRequestDefaultTypeInternal _GetGroupInfoRequest_default_instance_;
-
-inline constexpr CreateGroupResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr},
-        group_{nullptr},
-        group_id_{::uint64_t{0u}} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CreateGroupResponse::CreateGroupResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CreateGroupResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CreateGroupResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CreateGroupResponseDefaultTypeInternal() {}
-  union {
-    CreateGroupResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateGroupResponseDefaultTypeInternal _CreateGroupResponse_default_instance_;
-
-inline constexpr CreateGroupRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        members_{},
-        name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        avatar_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR CreateGroupRequest::CreateGroupRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct CreateGroupRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR CreateGroupRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~CreateGroupRequestDefaultTypeInternal() {}
-  union {
-    CreateGroupRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CreateGroupRequestDefaultTypeInternal _CreateGroupRequest_default_instance_;
-
-inline constexpr ApplyJoinGroupResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ApplyJoinGroupResponse::ApplyJoinGroupResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ApplyJoinGroupResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ApplyJoinGroupResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ApplyJoinGroupResponseDefaultTypeInternal() {}
-  union {
-    ApplyJoinGroupResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApplyJoinGroupResponseDefaultTypeInternal _ApplyJoinGroupResponse_default_instance_;
-
-inline constexpr ApplyJoinGroupRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        group_id_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        apply_msg_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR ApplyJoinGroupRequest::ApplyJoinGroupRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct ApplyJoinGroupRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR ApplyJoinGroupRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~ApplyJoinGroupRequestDefaultTypeInternal() {}
-  union {
-    ApplyJoinGroupRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ApplyJoinGroupRequestDefaultTypeInternal _ApplyJoinGroupRequest_default_instance_;
-}  // namespace group
-}  // namespace im
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_group_2eproto[1];
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_group_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_group_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _impl_.name_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _impl_.avatar_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _impl_.notice_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _impl_.owner_uid_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _impl_.is_muted_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _impl_.create_time_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _impl_.group_record_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupInfo, _impl_.member_count_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMember, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMember, _impl_.uid_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMember, _impl_.role_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMember, _impl_.nickname_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMember, _impl_.is_muted_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMember, _impl_.join_time_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMember, _impl_.member_record_id_),
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMessage, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMessage, _impl_.msg_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMessage, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMessage, _impl_.sender_uid_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMessage, _impl_.sender_nickname_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMessage, _impl_.content_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupMessage, _impl_.create_time_),
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupRequest, _impl_.name_),
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupRequest, _impl_.avatar_),
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupRequest, _impl_.members_),
-        0,
-        ~0u,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupResponse, _impl_.group_),
-        PROTOBUF_FIELD_OFFSET(::im::group::CreateGroupResponse, _impl_.group_id_),
-        0,
-        1,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::JoinGroupRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::JoinGroupRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::JoinGroupRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::JoinGroupRequest, _impl_.group_id_),
-        0,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::LeaveGroupRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::LeaveGroupRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::LeaveGroupRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::LeaveGroupRequest, _impl_.group_id_),
-        0,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupActionResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupActionResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupActionResponse, _impl_.base_),
-        0,
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupExistsRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupExistsRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupExistsResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupExistsResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupExistsResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GroupExistsResponse, _impl_.exists_),
-        0,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoRequest, _impl_.group_record_id_),
-        0,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoResponse, _impl_.group_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoResponse, _impl_.members_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupInfoResponse, _impl_.joined_),
-        0,
-        1,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::SearchGroupsRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SearchGroupsRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::SearchGroupsRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SearchGroupsRequest, _impl_.keyword_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SearchGroupsRequest, _impl_.limit_),
-        0,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::SearchGroupsResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SearchGroupsResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::SearchGroupsResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SearchGroupsResponse, _impl_.groups_),
-        0,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupListRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupListRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupListRequest, _impl_.header_),
-        0,
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupListResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupListResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupListResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupListResponse, _impl_.groups_),
-        0,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoRequest, _impl_.name_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoRequest, _impl_.avatar_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoRequest, _impl_.notice_),
-        0,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ModifyGroupInfoResponse, _impl_.group_),
-        0,
-        1,
-        PROTOBUF_FIELD_OFFSET(::im::group::InviteMemberRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::InviteMemberRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::InviteMemberRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::InviteMemberRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::InviteMemberRequest, _impl_.invite_uids_),
-        0,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::InviteMemberResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::InviteMemberResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::InviteMemberResponse, _impl_.base_),
-        0,
-        PROTOBUF_FIELD_OFFSET(::im::group::KickMemberRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::KickMemberRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::KickMemberRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::KickMemberRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::KickMemberRequest, _impl_.kick_uids_),
-        0,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::KickMemberResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::KickMemberResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::KickMemberResponse, _impl_.base_),
-        0,
-        PROTOBUF_FIELD_OFFSET(::im::group::ApplyJoinGroupRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ApplyJoinGroupRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::ApplyJoinGroupRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ApplyJoinGroupRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ApplyJoinGroupRequest, _impl_.apply_msg_),
-        0,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::ApplyJoinGroupResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::ApplyJoinGroupResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::ApplyJoinGroupResponse, _impl_.base_),
-        0,
-        PROTOBUF_FIELD_OFFSET(::im::group::QuitGroupRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::QuitGroupRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::QuitGroupRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::QuitGroupRequest, _impl_.group_id_),
-        0,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::QuitGroupResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::QuitGroupResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::QuitGroupResponse, _impl_.base_),
-        0,
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMembersRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMembersRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMembersRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMembersRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMembersRequest, _impl_.group_record_id_),
-        0,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMembersResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMembersResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMembersResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMembersResponse, _impl_.members_),
-        0,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesRequest, _impl_.since_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesRequest, _impl_.limit_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesRequest, _impl_.group_record_id_),
-        0,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::group::GetGroupMessagesResponse, _impl_.messages_),
-        0,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageRequest, _impl_.content_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageRequest, _impl_.create_time_),
-        0,
-        ~0u,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SendGroupMessageResponse, _impl_.message_),
-        0,
-        1,
-        PROTOBUF_FIELD_OFFSET(::im::group::TransferGroupOwnerRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::TransferGroupOwnerRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::TransferGroupOwnerRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::TransferGroupOwnerRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::TransferGroupOwnerRequest, _impl_.new_owner_uid_),
-        0,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::TransferGroupOwnerResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::TransferGroupOwnerResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::TransferGroupOwnerResponse, _impl_.base_),
-        0,
-        PROTOBUF_FIELD_OFFSET(::im::group::SetGroupAdminRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SetGroupAdminRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::SetGroupAdminRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SetGroupAdminRequest, _impl_.group_id_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SetGroupAdminRequest, _impl_.uid_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SetGroupAdminRequest, _impl_.set_admin_),
-        0,
-        ~0u,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::group::SetGroupAdminResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::group::SetGroupAdminResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::group::SetGroupAdminResponse, _impl_.base_),
-        0,
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::im::group::GroupInfo)},
-        {17, -1, -1, sizeof(::im::group::GroupMember)},
-        {31, -1, -1, sizeof(::im::group::GroupMessage)},
-        {45, 57, -1, sizeof(::im::group::CreateGroupRequest)},
-        {61, 72, -1, sizeof(::im::group::CreateGroupResponse)},
-        {75, 85, -1, sizeof(::im::group::JoinGroupRequest)},
-        {87, 97, -1, sizeof(::im::group::LeaveGroupRequest)},
-        {99, 108, -1, sizeof(::im::group::GroupActionResponse)},
-        {109, -1, -1, sizeof(::im::group::GroupExistsRequest)},
-        {118, 128, -1, sizeof(::im::group::GroupExistsResponse)},
-        {130, 141, -1, sizeof(::im::group::GetGroupInfoRequest)},
-        {144, 156, -1, sizeof(::im::group::GetGroupInfoResponse)},
-        {160, 171, -1, sizeof(::im::group::SearchGroupsRequest)},
-        {174, 184, -1, sizeof(::im::group::SearchGroupsResponse)},
-        {186, 195, -1, sizeof(::im::group::GetGroupListRequest)},
-        {196, 206, -1, sizeof(::im::group::GetGroupListResponse)},
-        {208, 221, -1, sizeof(::im::group::ModifyGroupInfoRequest)},
-        {226, 236, -1, sizeof(::im::group::ModifyGroupInfoResponse)},
-        {238, 249, -1, sizeof(::im::group::InviteMemberRequest)},
-        {252, 261, -1, sizeof(::im::group::InviteMemberResponse)},
-        {262, 273, -1, sizeof(::im::group::KickMemberRequest)},
-        {276, 285, -1, sizeof(::im::group::KickMemberResponse)},
-        {286, 297, -1, sizeof(::im::group::ApplyJoinGroupRequest)},
-        {300, 309, -1, sizeof(::im::group::ApplyJoinGroupResponse)},
-        {310, 320, -1, sizeof(::im::group::QuitGroupRequest)},
-        {322, 331, -1, sizeof(::im::group::QuitGroupResponse)},
-        {332, 343, -1, sizeof(::im::group::GetGroupMembersRequest)},
-        {346, 356, -1, sizeof(::im::group::GetGroupMembersResponse)},
-        {358, 371, -1, sizeof(::im::group::GetGroupMessagesRequest)},
-        {376, 386, -1, sizeof(::im::group::GetGroupMessagesResponse)},
-        {388, 400, -1, sizeof(::im::group::SendGroupMessageRequest)},
-        {404, 414, -1, sizeof(::im::group::SendGroupMessageResponse)},
-        {416, 427, -1, sizeof(::im::group::TransferGroupOwnerRequest)},
-        {430, 439, -1, sizeof(::im::group::TransferGroupOwnerResponse)},
-        {440, 452, -1, sizeof(::im::group::SetGroupAdminRequest)},
-        {456, 465, -1, sizeof(::im::group::SetGroupAdminResponse)},
-};
-static const ::_pb::Message* const file_default_instances[] = {
-    &::im::group::_GroupInfo_default_instance_._instance,
-    &::im::group::_GroupMember_default_instance_._instance,
-    &::im::group::_GroupMessage_default_instance_._instance,
-    &::im::group::_CreateGroupRequest_default_instance_._instance,
-    &::im::group::_CreateGroupResponse_default_instance_._instance,
-    &::im::group::_JoinGroupRequest_default_instance_._instance,
-    &::im::group::_LeaveGroupRequest_default_instance_._instance,
-    &::im::group::_GroupActionResponse_default_instance_._instance,
-    &::im::group::_GroupExistsRequest_default_instance_._instance,
-    &::im::group::_GroupExistsResponse_default_instance_._instance,
-    &::im::group::_GetGroupInfoRequest_default_instance_._instance,
-    &::im::group::_GetGroupInfoResponse_default_instance_._instance,
-    &::im::group::_SearchGroupsRequest_default_instance_._instance,
-    &::im::group::_SearchGroupsResponse_default_instance_._instance,
-    &::im::group::_GetGroupListRequest_default_instance_._instance,
-    &::im::group::_GetGroupListResponse_default_instance_._instance,
-    &::im::group::_ModifyGroupInfoRequest_default_instance_._instance,
-    &::im::group::_ModifyGroupInfoResponse_default_instance_._instance,
-    &::im::group::_InviteMemberRequest_default_instance_._instance,
-    &::im::group::_InviteMemberResponse_default_instance_._instance,
-    &::im::group::_KickMemberRequest_default_instance_._instance,
-    &::im::group::_KickMemberResponse_default_instance_._instance,
-    &::im::group::_ApplyJoinGroupRequest_default_instance_._instance,
-    &::im::group::_ApplyJoinGroupResponse_default_instance_._instance,
-    &::im::group::_QuitGroupRequest_default_instance_._instance,
-    &::im::group::_QuitGroupResponse_default_instance_._instance,
-    &::im::group::_GetGroupMembersRequest_default_instance_._instance,
-    &::im::group::_GetGroupMembersResponse_default_instance_._instance,
-    &::im::group::_GetGroupMessagesRequest_default_instance_._instance,
-    &::im::group::_GetGroupMessagesResponse_default_instance_._instance,
-    &::im::group::_SendGroupMessageRequest_default_instance_._instance,
-    &::im::group::_SendGroupMessageResponse_default_instance_._instance,
-    &::im::group::_TransferGroupOwnerRequest_default_instance_._instance,
-    &::im::group::_TransferGroupOwnerResponse_default_instance_._instance,
-    &::im::group::_SetGroupAdminRequest_default_instance_._instance,
-    &::im::group::_SetGroupAdminResponse_default_instance_._instance,
-};
-const char descriptor_table_protodef_group_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\013group.proto\022\010im.group\032\nbase.proto\"\264\001\n\t"
-    "GroupInfo\022\020\n\010group_id\030\001 \001(\t\022\014\n\004name\030\002 \001("
-    "\t\022\016\n\006avatar\030\003 \001(\t\022\016\n\006notice\030\004 \001(\t\022\021\n\town"
-    "er_uid\030\005 \001(\t\022\020\n\010is_muted\030\006 \001(\005\022\023\n\013create"
-    "_time\030\007 \001(\003\022\027\n\017group_record_id\030\010 \001(\004\022\024\n\014"
-    "member_count\030\t \001(\005\"\216\001\n\013GroupMember\022\013\n\003ui"
-    "d\030\001 \001(\t\022!\n\004role\030\002 \001(\0162\023.im.group.GroupRo"
-    "le\022\020\n\010nickname\030\003 \001(\t\022\020\n\010is_muted\030\004 \001(\005\022\021"
-    "\n\tjoin_time\030\005 \001(\003\022\030\n\020member_record_id\030\006 "
-    "\001(\004\"\203\001\n\014GroupMessage\022\016\n\006msg_id\030\001 \001(\004\022\020\n\010"
-    "group_id\030\002 \001(\004\022\022\n\nsender_uid\030\003 \001(\t\022\027\n\017se"
-    "nder_nickname\030\004 \001(\t\022\017\n\007content\030\005 \001(\t\022\023\n\013"
-    "create_time\030\006 \001(\003\"f\n\022CreateGroupRequest\022"
-    "!\n\006header\030\001 \001(\0132\021.im.base.IMHeader\022\014\n\004na"
-    "me\030\002 \001(\t\022\016\n\006avatar\030\003 \001(\t\022\017\n\007members\030\004 \003("
-    "\t\"p\n\023CreateGroupResponse\022#\n\004base\030\001 \001(\0132\025"
-    ".im.base.BaseResponse\022\"\n\005group\030\002 \001(\0132\023.i"
-    "m.group.GroupInfo\022\020\n\010group_id\030\003 \001(\004\"G\n\020J"
-    "oinGroupRequest\022!\n\006header\030\001 \001(\0132\021.im.bas"
-    "e.IMHeader\022\020\n\010group_id\030\002 \001(\004\"H\n\021LeaveGro"
-    "upRequest\022!\n\006header\030\001 \001(\0132\021.im.base.IMHe"
-    "ader\022\020\n\010group_id\030\002 \001(\004\":\n\023GroupActionRes"
-    "ponse\022#\n\004base\030\001 \001(\0132\025.im.base.BaseRespon"
-    "se\"&\n\022GroupExistsRequest\022\020\n\010group_id\030\001 \001"
-    "(\004\"J\n\023GroupExistsResponse\022#\n\004base\030\001 \001(\0132"
-    "\025.im.base.BaseResponse\022\016\n\006exists\030\002 \001(\010\"c"
-    "\n\023GetGroupInfoRequest\022!\n\006header\030\001 \001(\0132\021."
-    "im.base.IMHeader\022\020\n\010group_id\030\002 \001(\t\022\027\n\017gr"
-    "oup_record_id\030\003 \001(\004\"\227\001\n\024GetGroupInfoResp"
-    "onse\022#\n\004base\030\001 \001(\0132\025.im.base.BaseRespons"
-    "e\022\"\n\005group\030\002 \001(\0132\023.im.group.GroupInfo\022&\n"
-    "\007members\030\003 \003(\0132\025.im.group.GroupMember\022\016\n"
-    "\006joined\030\004 \001(\010\"X\n\023SearchGroupsRequest\022!\n\006"
-    "header\030\001 \001(\0132\021.im.base.IMHeader\022\017\n\007keywo"
-    "rd\030\002 \001(\t\022\r\n\005limit\030\003 \001(\005\"`\n\024SearchGroupsR"
-    "esponse\022#\n\004base\030\001 \001(\0132\025.im.base.BaseResp"
-    "onse\022#\n\006groups\030\002 \003(\0132\023.im.group.GroupInf"
-    "o\"8\n\023GetGroupListRequest\022!\n\006header\030\001 \001(\013"
-    "2\021.im.base.IMHeader\"`\n\024GetGroupListRespo"
-    "nse\022#\n\004base\030\001 \001(\0132\025.im.base.BaseResponse"
-    "\022#\n\006groups\030\002 \003(\0132\023.im.group.GroupInfo\"{\n"
-    "\026ModifyGroupInfoRequest\022!\n\006header\030\001 \001(\0132"
-    "\021.im.base.IMHeader\022\020\n\010group_id\030\002 \001(\t\022\014\n\004"
-    "name\030\003 \001(\t\022\016\n\006avatar\030\004 \001(\t\022\016\n\006notice\030\005 \001"
-    "(\t\"b\n\027ModifyGroupInfoResponse\022#\n\004base\030\001 "
-    "\001(\0132\025.im.base.BaseResponse\022\"\n\005group\030\002 \001("
-    "\0132\023.im.group.GroupInfo\"_\n\023InviteMemberRe"
-    "quest\022!\n\006header\030\001 \001(\0132\021.im.base.IMHeader"
-    "\022\020\n\010group_id\030\002 \001(\t\022\023\n\013invite_uids\030\003 \003(\t\""
-    ";\n\024InviteMemberResponse\022#\n\004base\030\001 \001(\0132\025."
-    "im.base.BaseResponse\"[\n\021KickMemberReques"
-    "t\022!\n\006header\030\001 \001(\0132\021.im.base.IMHeader\022\020\n\010"
-    "group_id\030\002 \001(\t\022\021\n\tkick_uids\030\003 \003(\t\"9\n\022Kic"
-    "kMemberResponse\022#\n\004base\030\001 \001(\0132\025.im.base."
-    "BaseResponse\"_\n\025ApplyJoinGroupRequest\022!\n"
-    "\006header\030\001 \001(\0132\021.im.base.IMHeader\022\020\n\010grou"
-    "p_id\030\002 \001(\t\022\021\n\tapply_msg\030\003 \001(\t\"=\n\026ApplyJo"
-    "inGroupResponse\022#\n\004base\030\001 \001(\0132\025.im.base."
-    "BaseResponse\"G\n\020QuitGroupRequest\022!\n\006head"
-    "er\030\001 \001(\0132\021.im.base.IMHeader\022\020\n\010group_id\030"
-    "\002 \001(\t\"8\n\021QuitGroupResponse\022#\n\004base\030\001 \001(\013"
-    "2\025.im.base.BaseResponse\"f\n\026GetGroupMembe"
-    "rsRequest\022!\n\006header\030\001 \001(\0132\021.im.base.IMHe"
-    "ader\022\020\n\010group_id\030\002 \001(\t\022\027\n\017group_record_i"
-    "d\030\003 \001(\004\"f\n\027GetGroupMembersResponse\022#\n\004ba"
-    "se\030\001 \001(\0132\025.im.base.BaseResponse\022&\n\007membe"
-    "rs\030\002 \003(\0132\025.im.group.GroupMember\"\205\001\n\027GetG"
-    "roupMessagesRequest\022!\n\006header\030\001 \001(\0132\021.im"
-    ".base.IMHeader\022\020\n\010group_id\030\002 \001(\t\022\r\n\005sinc"
-    "e\030\003 \001(\003\022\r\n\005limit\030\004 \001(\005\022\027\n\017group_record_i"
-    "d\030\005 \001(\004\"i\n\030GetGroupMessagesResponse\022#\n\004b"
-    "ase\030\001 \001(\0132\025.im.base.BaseResponse\022(\n\010mess"
-    "ages\030\002 \003(\0132\026.im.group.GroupMessage\"t\n\027Se"
-    "ndGroupMessageRequest\022!\n\006header\030\001 \001(\0132\021."
-    "im.base.IMHeader\022\020\n\010group_id\030\002 \001(\004\022\017\n\007co"
-    "ntent\030\003 \001(\t\022\023\n\013create_time\030\004 \001(\003\"h\n\030Send"
-    "GroupMessageResponse\022#\n\004base\030\001 \001(\0132\025.im."
-    "base.BaseResponse\022\'\n\007message\030\002 \001(\0132\026.im."
-    "group.GroupMessage\"g\n\031TransferGroupOwner"
-    "Request\022!\n\006header\030\001 \001(\0132\021.im.base.IMHead"
-    "er\022\020\n\010group_id\030\002 \001(\t\022\025\n\rnew_owner_uid\030\003 "
-    "\001(\t\"A\n\032TransferGroupOwnerResponse\022#\n\004bas"
-    "e\030\001 \001(\0132\025.im.base.BaseResponse\"k\n\024SetGro"
-    "upAdminRequest\022!\n\006header\030\001 \001(\0132\021.im.base"
-    ".IMHeader\022\020\n\010group_id\030\002 \001(\t\022\013\n\003uid\030\003 \001(\t"
-    "\022\021\n\tset_admin\030\004 \001(\010\"<\n\025SetGroupAdminResp"
-    "onse\022#\n\004base\030\001 \001(\0132\025.im.base.BaseRespons"
-    "e*-\n\tGroupRole\022\n\n\006MEMBER\020\000\022\t\n\005ADMIN\020\001\022\t\n"
-    "\005OWNER\020\0022\257\006\n\014GroupService\022J\n\013CreateGroup"
-    "\022\034.im.group.CreateGroupRequest\032\035.im.grou"
-    "p.CreateGroupResponse\022F\n\tJoinGroup\022\032.im."
-    "group.JoinGroupRequest\032\035.im.group.GroupA"
-    "ctionResponse\022H\n\nLeaveGroup\022\033.im.group.L"
-    "eaveGroupRequest\032\035.im.group.GroupActionR"
-    "esponse\022M\n\014GetGroupInfo\022\035.im.group.GetGr"
-    "oupInfoRequest\032\036.im.group.GetGroupInfoRe"
-    "sponse\022M\n\014SearchGroups\022\035.im.group.Search"
-    "GroupsRequest\032\036.im.group.SearchGroupsRes"
-    "ponse\022J\n\013GroupExists\022\034.im.group.GroupExi"
-    "stsRequest\032\035.im.group.GroupExistsRespons"
-    "e\022M\n\014ListMyGroups\022\035.im.group.GetGroupLis"
-    "tRequest\032\036.im.group.GetGroupListResponse"
-    "\022R\n\013ListMembers\022 .im.group.GetGroupMembe"
-    "rsRequest\032!.im.group.GetGroupMembersResp"
-    "onse\022Y\n\020SendGroupMessage\022!.im.group.Send"
-    "GroupMessageRequest\032\".im.group.SendGroup"
-    "MessageResponse\022Y\n\020GetGroupMessages\022!.im"
-    ".group.GetGroupMessagesRequest\032\".im.grou"
-    "p.GetGroupMessagesResponseb\006proto3"
-};
-static const ::_pbi::DescriptorTable* const descriptor_table_group_2eproto_deps[1] =
-    {
-        &::descriptor_table_base_2eproto,
-};
-static ::absl::once_flag descriptor_table_group_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_group_2eproto = {
-    false,
-    false,
-    4354,
-    descriptor_table_protodef_group_2eproto,
-    "group.proto",
-    &descriptor_table_group_2eproto_once,
-    descriptor_table_group_2eproto_deps,
-    1,
-    36,
-    schemas,
-    file_default_instances,
-    TableStruct_group_2eproto::offsets,
-    file_level_enum_descriptors_group_2eproto,
-    file_level_service_descriptors_group_2eproto,
-};
-namespace im {
-namespace group {
-const ::google::protobuf::EnumDescriptor* GroupRole_descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_group_2eproto);
-  return file_level_enum_descriptors_group_2eproto[0];
-}
-PROTOBUF_CONSTINIT const uint32_t GroupRole_internal_data_[] = {
-    196608u, 0u, };
-bool GroupRole_IsValid(int value) {
-  return 0 <= value && value <= 2;
-}
-// ===================================================================
-
-class GroupInfo::_Internal {
- public:
-};
-
-GroupInfo::GroupInfo(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GroupInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GroupInfo& from_msg)
-      : group_id_(arena, from.group_id_),
-        name_(arena, from.name_),
-        avatar_(arena, from.avatar_),
-        notice_(arena, from.notice_),
-        owner_uid_(arena, from.owner_uid_),
-        _cached_size_{0} {}
-
-GroupInfo::GroupInfo(
-    ::google::protobuf::Arena* arena,
-    const GroupInfo& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GroupInfo* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, create_time_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, create_time_),
-           offsetof(Impl_, group_record_id_) -
-               offsetof(Impl_, create_time_) +
-               sizeof(Impl_::group_record_id_));
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GroupInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : group_id_(arena),
-        name_(arena),
-        avatar_(arena),
-        notice_(arena),
-        owner_uid_(arena),
-        _cached_size_{0} {}
-
-inline void GroupInfo::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, create_time_),
-           0,
-           offsetof(Impl_, group_record_id_) -
-               offsetof(Impl_, create_time_) +
-               sizeof(Impl_::group_record_id_));
-}
-GroupInfo::~GroupInfo() {
-  // @@protoc_insertion_point(destructor:im.group.GroupInfo)
-  SharedDtor(*this);
-}
-inline void GroupInfo::SharedDtor(MessageLite& self) {
-  GroupInfo& this_ = static_cast<GroupInfo&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  this_._impl_.name_.Destroy();
-  this_._impl_.avatar_.Destroy();
-  this_._impl_.notice_.Destroy();
-  this_._impl_.owner_uid_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GroupInfo::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GroupInfo(arena);
-}
-constexpr auto GroupInfo::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GroupInfo),
-                                            alignof(GroupInfo));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GroupInfo::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GroupInfo_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GroupInfo::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GroupInfo>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GroupInfo::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GroupInfo>(), &GroupInfo::ByteSizeLong,
-            &GroupInfo::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_._cached_size_),
-        false,
-    },
-    &GroupInfo::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GroupInfo::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<4, 9, 0, 68, 2> GroupInfo::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    9, 120,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294966784,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    9,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GroupInfo>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string group_id = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.group_id_)}},
-    // string name = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.name_)}},
-    // string avatar = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.avatar_)}},
-    // string notice = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.notice_)}},
-    // string owner_uid = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.owner_uid_)}},
-    // int32 is_muted = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GroupInfo, _impl_.is_muted_), 63>(),
-     {48, 63, 0, PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.is_muted_)}},
-    // int64 create_time = 7;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GroupInfo, _impl_.create_time_), 63>(),
-     {56, 63, 0, PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.create_time_)}},
-    // uint64 group_record_id = 8;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GroupInfo, _impl_.group_record_id_), 63>(),
-     {64, 63, 0, PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.group_record_id_)}},
-    // int32 member_count = 9;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GroupInfo, _impl_.member_count_), 63>(),
-     {72, 63, 0, PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.member_count_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string group_id = 1;
-    {PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.group_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string name = 2;
-    {PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string avatar = 3;
-    {PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.avatar_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string notice = 4;
-    {PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.notice_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string owner_uid = 5;
-    {PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.owner_uid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 is_muted = 6;
-    {PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.is_muted_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int64 create_time = 7;
-    {PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.create_time_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // uint64 group_record_id = 8;
-    {PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.group_record_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-    // int32 member_count = 9;
-    {PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.member_count_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }},
-  // no aux_entries
-  {{
-    "\22\10\4\6\6\11\0\0\0\0\0\0\0\0\0\0"
-    "im.group.GroupInfo"
-    "group_id"
-    "name"
-    "avatar"
-    "notice"
-    "owner_uid"
-  }},
-};
-
-PROTOBUF_NOINLINE void GroupInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GroupInfo)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_.ClearToEmpty();
-  _impl_.name_.ClearToEmpty();
-  _impl_.avatar_.ClearToEmpty();
-  _impl_.notice_.ClearToEmpty();
-  _impl_.owner_uid_.ClearToEmpty();
-  ::memset(&_impl_.create_time_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.group_record_id_) -
-      reinterpret_cast<char*>(&_impl_.create_time_)) + sizeof(_impl_.group_record_id_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GroupInfo::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GroupInfo& this_ = static_cast<const GroupInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GroupInfo::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GroupInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GroupInfo)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string group_id = 1;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupInfo.group_id");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string name = 2;
-          if (!this_._internal_name().empty()) {
-            const std::string& _s = this_._internal_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupInfo.name");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string avatar = 3;
-          if (!this_._internal_avatar().empty()) {
-            const std::string& _s = this_._internal_avatar();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupInfo.avatar");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string notice = 4;
-          if (!this_._internal_notice().empty()) {
-            const std::string& _s = this_._internal_notice();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupInfo.notice");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string owner_uid = 5;
-          if (!this_._internal_owner_uid().empty()) {
-            const std::string& _s = this_._internal_owner_uid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupInfo.owner_uid");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // int32 is_muted = 6;
-          if (this_._internal_is_muted() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<6>(
-                    stream, this_._internal_is_muted(), target);
-          }
-
-          // int64 create_time = 7;
-          if (this_._internal_create_time() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<7>(
-                    stream, this_._internal_create_time(), target);
-          }
-
-          // uint64 group_record_id = 8;
-          if (this_._internal_group_record_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                8, this_._internal_group_record_id(), target);
-          }
-
-          // int32 member_count = 9;
-          if (this_._internal_member_count() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<9>(
-                    stream, this_._internal_member_count(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GroupInfo)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GroupInfo::ByteSizeLong(const MessageLite& base) {
-          const GroupInfo& this_ = static_cast<const GroupInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GroupInfo::ByteSizeLong() const {
-          const GroupInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GroupInfo)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string group_id = 1;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-            // string name = 2;
-            if (!this_._internal_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_name());
-            }
-            // string avatar = 3;
-            if (!this_._internal_avatar().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_avatar());
-            }
-            // string notice = 4;
-            if (!this_._internal_notice().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_notice());
-            }
-            // string owner_uid = 5;
-            if (!this_._internal_owner_uid().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_owner_uid());
-            }
-            // int64 create_time = 7;
-            if (this_._internal_create_time() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_create_time());
-            }
-            // int32 is_muted = 6;
-            if (this_._internal_is_muted() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_is_muted());
-            }
-            // int32 member_count = 9;
-            if (this_._internal_member_count() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_member_count());
-            }
-            // uint64 group_record_id = 8;
-            if (this_._internal_group_record_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_record_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GroupInfo::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GroupInfo*>(&to_msg);
-  auto& from = static_cast<const GroupInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GroupInfo)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  if (!from._internal_name().empty()) {
-    _this->_internal_set_name(from._internal_name());
-  }
-  if (!from._internal_avatar().empty()) {
-    _this->_internal_set_avatar(from._internal_avatar());
-  }
-  if (!from._internal_notice().empty()) {
-    _this->_internal_set_notice(from._internal_notice());
-  }
-  if (!from._internal_owner_uid().empty()) {
-    _this->_internal_set_owner_uid(from._internal_owner_uid());
-  }
-  if (from._internal_create_time() != 0) {
-    _this->_impl_.create_time_ = from._impl_.create_time_;
-  }
-  if (from._internal_is_muted() != 0) {
-    _this->_impl_.is_muted_ = from._impl_.is_muted_;
-  }
-  if (from._internal_member_count() != 0) {
-    _this->_impl_.member_count_ = from._impl_.member_count_;
-  }
-  if (from._internal_group_record_id() != 0) {
-    _this->_impl_.group_record_id_ = from._impl_.group_record_id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GroupInfo::CopyFrom(const GroupInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GroupInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GroupInfo::InternalSwap(GroupInfo* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.avatar_, &other->_impl_.avatar_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.notice_, &other->_impl_.notice_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.owner_uid_, &other->_impl_.owner_uid_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.group_record_id_)
-      + sizeof(GroupInfo::_impl_.group_record_id_)
-      - PROTOBUF_FIELD_OFFSET(GroupInfo, _impl_.create_time_)>(
-          reinterpret_cast<char*>(&_impl_.create_time_),
-          reinterpret_cast<char*>(&other->_impl_.create_time_));
-}
-
-::google::protobuf::Metadata GroupInfo::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GroupMember::_Internal {
- public:
-};
-
-GroupMember::GroupMember(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GroupMember)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupMember::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GroupMember& from_msg)
-      : uid_(arena, from.uid_),
-        nickname_(arena, from.nickname_),
-        _cached_size_{0} {}
-
-GroupMember::GroupMember(
-    ::google::protobuf::Arena* arena,
-    const GroupMember& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GroupMember* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, role_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, role_),
-           offsetof(Impl_, member_record_id_) -
-               offsetof(Impl_, role_) +
-               sizeof(Impl_::member_record_id_));
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GroupMember)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupMember::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : uid_(arena),
-        nickname_(arena),
-        _cached_size_{0} {}
-
-inline void GroupMember::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, role_),
-           0,
-           offsetof(Impl_, member_record_id_) -
-               offsetof(Impl_, role_) +
-               sizeof(Impl_::member_record_id_));
-}
-GroupMember::~GroupMember() {
-  // @@protoc_insertion_point(destructor:im.group.GroupMember)
-  SharedDtor(*this);
-}
-inline void GroupMember::SharedDtor(MessageLite& self) {
-  GroupMember& this_ = static_cast<GroupMember&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.uid_.Destroy();
-  this_._impl_.nickname_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GroupMember::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GroupMember(arena);
-}
-constexpr auto GroupMember::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GroupMember),
-                                            alignof(GroupMember));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GroupMember::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GroupMember_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GroupMember::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GroupMember>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GroupMember::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GroupMember>(), &GroupMember::ByteSizeLong,
-            &GroupMember::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GroupMember, _impl_._cached_size_),
-        false,
-    },
-    &GroupMember::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GroupMember::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 0, 40, 2> GroupMember::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GroupMember>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string uid = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.uid_)}},
-    // .im.group.GroupRole role = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GroupMember, _impl_.role_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.role_)}},
-    // string nickname = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.nickname_)}},
-    // int32 is_muted = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GroupMember, _impl_.is_muted_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.is_muted_)}},
-    // int64 join_time = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GroupMember, _impl_.join_time_), 63>(),
-     {40, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.join_time_)}},
-    // uint64 member_record_id = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GroupMember, _impl_.member_record_id_), 63>(),
-     {48, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.member_record_id_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string uid = 1;
-    {PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.uid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // .im.group.GroupRole role = 2;
-    {PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.role_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // string nickname = 3;
-    {PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.nickname_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 is_muted = 4;
-    {PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.is_muted_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // int64 join_time = 5;
-    {PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.join_time_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // uint64 member_record_id = 6;
-    {PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.member_record_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-  }},
-  // no aux_entries
-  {{
-    "\24\3\0\10\0\0\0\0"
-    "im.group.GroupMember"
-    "uid"
-    "nickname"
-  }},
-};
-
-PROTOBUF_NOINLINE void GroupMember::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GroupMember)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.uid_.ClearToEmpty();
-  _impl_.nickname_.ClearToEmpty();
-  ::memset(&_impl_.role_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.member_record_id_) -
-      reinterpret_cast<char*>(&_impl_.role_)) + sizeof(_impl_.member_record_id_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GroupMember::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GroupMember& this_ = static_cast<const GroupMember&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GroupMember::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GroupMember& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GroupMember)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string uid = 1;
-          if (!this_._internal_uid().empty()) {
-            const std::string& _s = this_._internal_uid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupMember.uid");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // .im.group.GroupRole role = 2;
-          if (this_._internal_role() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                2, this_._internal_role(), target);
-          }
-
-          // string nickname = 3;
-          if (!this_._internal_nickname().empty()) {
-            const std::string& _s = this_._internal_nickname();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupMember.nickname");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // int32 is_muted = 4;
-          if (this_._internal_is_muted() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_is_muted(), target);
-          }
-
-          // int64 join_time = 5;
-          if (this_._internal_join_time() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<5>(
-                    stream, this_._internal_join_time(), target);
-          }
-
-          // uint64 member_record_id = 6;
-          if (this_._internal_member_record_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                6, this_._internal_member_record_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GroupMember)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GroupMember::ByteSizeLong(const MessageLite& base) {
-          const GroupMember& this_ = static_cast<const GroupMember&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GroupMember::ByteSizeLong() const {
-          const GroupMember& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GroupMember)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string uid = 1;
-            if (!this_._internal_uid().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_uid());
-            }
-            // string nickname = 3;
-            if (!this_._internal_nickname().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_nickname());
-            }
-            // .im.group.GroupRole role = 2;
-            if (this_._internal_role() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_role());
-            }
-            // int32 is_muted = 4;
-            if (this_._internal_is_muted() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_is_muted());
-            }
-            // int64 join_time = 5;
-            if (this_._internal_join_time() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_join_time());
-            }
-            // uint64 member_record_id = 6;
-            if (this_._internal_member_record_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_member_record_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GroupMember::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GroupMember*>(&to_msg);
-  auto& from = static_cast<const GroupMember&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GroupMember)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_uid().empty()) {
-    _this->_internal_set_uid(from._internal_uid());
-  }
-  if (!from._internal_nickname().empty()) {
-    _this->_internal_set_nickname(from._internal_nickname());
-  }
-  if (from._internal_role() != 0) {
-    _this->_impl_.role_ = from._impl_.role_;
-  }
-  if (from._internal_is_muted() != 0) {
-    _this->_impl_.is_muted_ = from._impl_.is_muted_;
-  }
-  if (from._internal_join_time() != 0) {
-    _this->_impl_.join_time_ = from._impl_.join_time_;
-  }
-  if (from._internal_member_record_id() != 0) {
-    _this->_impl_.member_record_id_ = from._impl_.member_record_id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GroupMember::CopyFrom(const GroupMember& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GroupMember)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GroupMember::InternalSwap(GroupMember* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.nickname_, &other->_impl_.nickname_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.member_record_id_)
-      + sizeof(GroupMember::_impl_.member_record_id_)
-      - PROTOBUF_FIELD_OFFSET(GroupMember, _impl_.role_)>(
-          reinterpret_cast<char*>(&_impl_.role_),
-          reinterpret_cast<char*>(&other->_impl_.role_));
-}
-
-::google::protobuf::Metadata GroupMember::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GroupMessage::_Internal {
- public:
-};
-
-GroupMessage::GroupMessage(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GroupMessage)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupMessage::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GroupMessage& from_msg)
-      : sender_uid_(arena, from.sender_uid_),
-        sender_nickname_(arena, from.sender_nickname_),
-        content_(arena, from.content_),
-        _cached_size_{0} {}
-
-GroupMessage::GroupMessage(
-    ::google::protobuf::Arena* arena,
-    const GroupMessage& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GroupMessage* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, msg_id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, msg_id_),
-           offsetof(Impl_, create_time_) -
-               offsetof(Impl_, msg_id_) +
-               sizeof(Impl_::create_time_));
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GroupMessage)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupMessage::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : sender_uid_(arena),
-        sender_nickname_(arena),
-        content_(arena),
-        _cached_size_{0} {}
-
-inline void GroupMessage::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, msg_id_),
-           0,
-           offsetof(Impl_, create_time_) -
-               offsetof(Impl_, msg_id_) +
-               sizeof(Impl_::create_time_));
-}
-GroupMessage::~GroupMessage() {
-  // @@protoc_insertion_point(destructor:im.group.GroupMessage)
-  SharedDtor(*this);
-}
-inline void GroupMessage::SharedDtor(MessageLite& self) {
-  GroupMessage& this_ = static_cast<GroupMessage&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.sender_uid_.Destroy();
-  this_._impl_.sender_nickname_.Destroy();
-  this_._impl_.content_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* GroupMessage::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GroupMessage(arena);
-}
-constexpr auto GroupMessage::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GroupMessage),
-                                            alignof(GroupMessage));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GroupMessage::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GroupMessage_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GroupMessage::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GroupMessage>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GroupMessage::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GroupMessage>(), &GroupMessage::ByteSizeLong,
-            &GroupMessage::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_._cached_size_),
-        false,
-    },
-    &GroupMessage::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GroupMessage::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 0, 62, 2> GroupMessage::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GroupMessage>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // uint64 msg_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GroupMessage, _impl_.msg_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.msg_id_)}},
-    // uint64 group_id = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GroupMessage, _impl_.group_id_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.group_id_)}},
-    // string sender_uid = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.sender_uid_)}},
-    // string sender_nickname = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.sender_nickname_)}},
-    // string content = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.content_)}},
-    // int64 create_time = 6;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GroupMessage, _impl_.create_time_), 63>(),
-     {48, 63, 0, PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.create_time_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // uint64 msg_id = 1;
-    {PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.msg_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-    // uint64 group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.group_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-    // string sender_uid = 3;
-    {PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.sender_uid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string sender_nickname = 4;
-    {PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.sender_nickname_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string content = 5;
-    {PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.content_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int64 create_time = 6;
-    {PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.create_time_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-  }},
-  // no aux_entries
-  {{
-    "\25\0\0\12\17\7\0\0"
-    "im.group.GroupMessage"
-    "sender_uid"
-    "sender_nickname"
-    "content"
-  }},
-};
-
-PROTOBUF_NOINLINE void GroupMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GroupMessage)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.sender_uid_.ClearToEmpty();
-  _impl_.sender_nickname_.ClearToEmpty();
-  _impl_.content_.ClearToEmpty();
-  ::memset(&_impl_.msg_id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.create_time_) -
-      reinterpret_cast<char*>(&_impl_.msg_id_)) + sizeof(_impl_.create_time_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GroupMessage::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GroupMessage& this_ = static_cast<const GroupMessage&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GroupMessage::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GroupMessage& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GroupMessage)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // uint64 msg_id = 1;
-          if (this_._internal_msg_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                1, this_._internal_msg_id(), target);
-          }
-
-          // uint64 group_id = 2;
-          if (this_._internal_group_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                2, this_._internal_group_id(), target);
-          }
-
-          // string sender_uid = 3;
-          if (!this_._internal_sender_uid().empty()) {
-            const std::string& _s = this_._internal_sender_uid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupMessage.sender_uid");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string sender_nickname = 4;
-          if (!this_._internal_sender_nickname().empty()) {
-            const std::string& _s = this_._internal_sender_nickname();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupMessage.sender_nickname");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string content = 5;
-          if (!this_._internal_content().empty()) {
-            const std::string& _s = this_._internal_content();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GroupMessage.content");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // int64 create_time = 6;
-          if (this_._internal_create_time() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<6>(
-                    stream, this_._internal_create_time(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GroupMessage)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GroupMessage::ByteSizeLong(const MessageLite& base) {
-          const GroupMessage& this_ = static_cast<const GroupMessage&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GroupMessage::ByteSizeLong() const {
-          const GroupMessage& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GroupMessage)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string sender_uid = 3;
-            if (!this_._internal_sender_uid().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_sender_uid());
-            }
-            // string sender_nickname = 4;
-            if (!this_._internal_sender_nickname().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_sender_nickname());
-            }
-            // string content = 5;
-            if (!this_._internal_content().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_content());
-            }
-            // uint64 msg_id = 1;
-            if (this_._internal_msg_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_msg_id());
-            }
-            // uint64 group_id = 2;
-            if (this_._internal_group_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_id());
-            }
-            // int64 create_time = 6;
-            if (this_._internal_create_time() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_create_time());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GroupMessage::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GroupMessage*>(&to_msg);
-  auto& from = static_cast<const GroupMessage&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GroupMessage)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_sender_uid().empty()) {
-    _this->_internal_set_sender_uid(from._internal_sender_uid());
-  }
-  if (!from._internal_sender_nickname().empty()) {
-    _this->_internal_set_sender_nickname(from._internal_sender_nickname());
-  }
-  if (!from._internal_content().empty()) {
-    _this->_internal_set_content(from._internal_content());
-  }
-  if (from._internal_msg_id() != 0) {
-    _this->_impl_.msg_id_ = from._impl_.msg_id_;
-  }
-  if (from._internal_group_id() != 0) {
-    _this->_impl_.group_id_ = from._impl_.group_id_;
-  }
-  if (from._internal_create_time() != 0) {
-    _this->_impl_.create_time_ = from._impl_.create_time_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GroupMessage::CopyFrom(const GroupMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GroupMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GroupMessage::InternalSwap(GroupMessage* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.sender_uid_, &other->_impl_.sender_uid_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.sender_nickname_, &other->_impl_.sender_nickname_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.content_, &other->_impl_.content_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.create_time_)
-      + sizeof(GroupMessage::_impl_.create_time_)
-      - PROTOBUF_FIELD_OFFSET(GroupMessage, _impl_.msg_id_)>(
-          reinterpret_cast<char*>(&_impl_.msg_id_),
-          reinterpret_cast<char*>(&other->_impl_.msg_id_));
-}
-
-::google::protobuf::Metadata GroupMessage::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CreateGroupRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<CreateGroupRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_._has_bits_);
-};
-
-void CreateGroupRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-CreateGroupRequest::CreateGroupRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.CreateGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CreateGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::CreateGroupRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        members_{visibility, arena, from.members_},
-        name_(arena, from.name_),
-        avatar_(arena, from.avatar_) {}
-
-CreateGroupRequest::CreateGroupRequest(
-    ::google::protobuf::Arena* arena,
-    const CreateGroupRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CreateGroupRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.CreateGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE CreateGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        members_{visibility, arena},
-        name_(arena),
-        avatar_(arena) {}
-
-inline void CreateGroupRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.header_ = {};
-}
-CreateGroupRequest::~CreateGroupRequest() {
-  // @@protoc_insertion_point(destructor:im.group.CreateGroupRequest)
-  SharedDtor(*this);
-}
-inline void CreateGroupRequest::SharedDtor(MessageLite& self) {
-  CreateGroupRequest& this_ = static_cast<CreateGroupRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.name_.Destroy();
-  this_._impl_.avatar_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* CreateGroupRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CreateGroupRequest(arena);
-}
-constexpr auto CreateGroupRequest::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_.members_) +
-          decltype(CreateGroupRequest::_impl_.members_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(CreateGroupRequest), alignof(CreateGroupRequest), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&CreateGroupRequest::PlacementNew_,
-                                 sizeof(CreateGroupRequest),
-                                 alignof(CreateGroupRequest));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CreateGroupRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CreateGroupRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CreateGroupRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CreateGroupRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CreateGroupRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CreateGroupRequest>(), &CreateGroupRequest::ByteSizeLong,
-            &CreateGroupRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_._cached_size_),
-        false,
-    },
-    &CreateGroupRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CreateGroupRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 53, 2> CreateGroupRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::CreateGroupRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated string members = 4;
-    {::_pbi::TcParser::FastUR1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_.members_)}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_.header_)}},
-    // string name = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_.name_)}},
-    // string avatar = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_.avatar_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string name = 2;
-    {PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_.name_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string avatar = 3;
-    {PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_.avatar_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated string members = 4;
-    {PROTOBUF_FIELD_OFFSET(CreateGroupRequest, _impl_.members_), -1, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\33\0\4\6\7\0\0\0"
-    "im.group.CreateGroupRequest"
-    "name"
-    "avatar"
-    "members"
-  }},
-};
-
-PROTOBUF_NOINLINE void CreateGroupRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.CreateGroupRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.members_.Clear();
-  _impl_.name_.ClearToEmpty();
-  _impl_.avatar_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CreateGroupRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CreateGroupRequest& this_ = static_cast<const CreateGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CreateGroupRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CreateGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.CreateGroupRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string name = 2;
-          if (!this_._internal_name().empty()) {
-            const std::string& _s = this_._internal_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.CreateGroupRequest.name");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string avatar = 3;
-          if (!this_._internal_avatar().empty()) {
-            const std::string& _s = this_._internal_avatar();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.CreateGroupRequest.avatar");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // repeated string members = 4;
-          for (int i = 0, n = this_._internal_members_size(); i < n; ++i) {
-            const auto& s = this_._internal_members().Get(i);
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.CreateGroupRequest.members");
-            target = stream->WriteString(4, s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.CreateGroupRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CreateGroupRequest::ByteSizeLong(const MessageLite& base) {
-          const CreateGroupRequest& this_ = static_cast<const CreateGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CreateGroupRequest::ByteSizeLong() const {
-          const CreateGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.CreateGroupRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated string members = 4;
-            {
-              total_size +=
-                  1 * ::google::protobuf::internal::FromIntSize(this_._internal_members().size());
-              for (int i = 0, n = this_._internal_members().size(); i < n; ++i) {
-                total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-                    this_._internal_members().Get(i));
-              }
-            }
-          }
-           {
-            // string name = 2;
-            if (!this_._internal_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_name());
-            }
-            // string avatar = 3;
-            if (!this_._internal_avatar().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_avatar());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CreateGroupRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CreateGroupRequest*>(&to_msg);
-  auto& from = static_cast<const CreateGroupRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.CreateGroupRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_members()->MergeFrom(from._internal_members());
-  if (!from._internal_name().empty()) {
-    _this->_internal_set_name(from._internal_name());
-  }
-  if (!from._internal_avatar().empty()) {
-    _this->_internal_set_avatar(from._internal_avatar());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CreateGroupRequest::CopyFrom(const CreateGroupRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.CreateGroupRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CreateGroupRequest::InternalSwap(CreateGroupRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.members_.InternalSwap(&other->_impl_.members_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.avatar_, &other->_impl_.avatar_, arena);
-  swap(_impl_.header_, other->_impl_.header_);
-}
-
-::google::protobuf::Metadata CreateGroupRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class CreateGroupResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<CreateGroupResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_._has_bits_);
-};
-
-void CreateGroupResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-CreateGroupResponse::CreateGroupResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.CreateGroupResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CreateGroupResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::CreateGroupResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-CreateGroupResponse::CreateGroupResponse(
-    ::google::protobuf::Arena* arena,
-    const CreateGroupResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  CreateGroupResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-  _impl_.group_ = (cached_has_bits & 0x00000002u) ? ::google::protobuf::Message::CopyConstruct<::im::group::GroupInfo>(
-                              arena, *from._impl_.group_)
-                        : nullptr;
-  _impl_.group_id_ = from._impl_.group_id_;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.CreateGroupResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE CreateGroupResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void CreateGroupResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, base_),
-           0,
-           offsetof(Impl_, group_id_) -
-               offsetof(Impl_, base_) +
-               sizeof(Impl_::group_id_));
-}
-CreateGroupResponse::~CreateGroupResponse() {
-  // @@protoc_insertion_point(destructor:im.group.CreateGroupResponse)
-  SharedDtor(*this);
-}
-inline void CreateGroupResponse::SharedDtor(MessageLite& self) {
-  CreateGroupResponse& this_ = static_cast<CreateGroupResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  delete this_._impl_.group_;
-  this_._impl_.~Impl_();
-}
-
-inline void* CreateGroupResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) CreateGroupResponse(arena);
-}
-constexpr auto CreateGroupResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(CreateGroupResponse),
-                                            alignof(CreateGroupResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull CreateGroupResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_CreateGroupResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &CreateGroupResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<CreateGroupResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &CreateGroupResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<CreateGroupResponse>(), &CreateGroupResponse::ByteSizeLong,
-            &CreateGroupResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_._cached_size_),
-        false,
-    },
-    &CreateGroupResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* CreateGroupResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 2, 0, 2> CreateGroupResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::CreateGroupResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_.base_)}},
-    // .im.group.GroupInfo group = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_.group_)}},
-    // uint64 group_id = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(CreateGroupResponse, _impl_.group_id_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_.group_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.group.GroupInfo group = 2;
-    {PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_.group_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // uint64 group_id = 3;
-    {PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::group::GroupInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void CreateGroupResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.CreateGroupResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.base_ != nullptr);
-      _impl_.base_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.group_ != nullptr);
-      _impl_.group_->Clear();
-    }
-  }
-  _impl_.group_id_ = ::uint64_t{0u};
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* CreateGroupResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const CreateGroupResponse& this_ = static_cast<const CreateGroupResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* CreateGroupResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const CreateGroupResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.CreateGroupResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.group.GroupInfo group = 2;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.group_, this_._impl_.group_->GetCachedSize(), target,
-                stream);
-          }
-
-          // uint64 group_id = 3;
-          if (this_._internal_group_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                3, this_._internal_group_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.CreateGroupResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t CreateGroupResponse::ByteSizeLong(const MessageLite& base) {
-          const CreateGroupResponse& this_ = static_cast<const CreateGroupResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t CreateGroupResponse::ByteSizeLong() const {
-          const CreateGroupResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.CreateGroupResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // .im.base.BaseResponse base = 1;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-            // .im.group.GroupInfo group = 2;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.group_);
-            }
-          }
-           {
-            // uint64 group_id = 3;
-            if (this_._internal_group_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void CreateGroupResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<CreateGroupResponse*>(&to_msg);
-  auto& from = static_cast<const CreateGroupResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.CreateGroupResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(from._impl_.base_ != nullptr);
-      if (_this->_impl_.base_ == nullptr) {
-        _this->_impl_.base_ =
-            ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-      } else {
-        _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-      }
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(from._impl_.group_ != nullptr);
-      if (_this->_impl_.group_ == nullptr) {
-        _this->_impl_.group_ =
-            ::google::protobuf::Message::CopyConstruct<::im::group::GroupInfo>(arena, *from._impl_.group_);
-      } else {
-        _this->_impl_.group_->MergeFrom(*from._impl_.group_);
-      }
-    }
-  }
-  if (from._internal_group_id() != 0) {
-    _this->_impl_.group_id_ = from._impl_.group_id_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void CreateGroupResponse::CopyFrom(const CreateGroupResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.CreateGroupResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void CreateGroupResponse::InternalSwap(CreateGroupResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_.group_id_)
-      + sizeof(CreateGroupResponse::_impl_.group_id_)
-      - PROTOBUF_FIELD_OFFSET(CreateGroupResponse, _impl_.base_)>(
-          reinterpret_cast<char*>(&_impl_.base_),
-          reinterpret_cast<char*>(&other->_impl_.base_));
-}
-
-::google::protobuf::Metadata CreateGroupResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class JoinGroupRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<JoinGroupRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(JoinGroupRequest, _impl_._has_bits_);
-};
-
-void JoinGroupRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-JoinGroupRequest::JoinGroupRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.JoinGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE JoinGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::JoinGroupRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-JoinGroupRequest::JoinGroupRequest(
-    ::google::protobuf::Arena* arena,
-    const JoinGroupRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  JoinGroupRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.group_id_ = from._impl_.group_id_;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.JoinGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE JoinGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void JoinGroupRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, group_id_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::group_id_));
-}
-JoinGroupRequest::~JoinGroupRequest() {
-  // @@protoc_insertion_point(destructor:im.group.JoinGroupRequest)
-  SharedDtor(*this);
-}
-inline void JoinGroupRequest::SharedDtor(MessageLite& self) {
-  JoinGroupRequest& this_ = static_cast<JoinGroupRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* JoinGroupRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) JoinGroupRequest(arena);
-}
-constexpr auto JoinGroupRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(JoinGroupRequest),
-                                            alignof(JoinGroupRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull JoinGroupRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_JoinGroupRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &JoinGroupRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<JoinGroupRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &JoinGroupRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<JoinGroupRequest>(), &JoinGroupRequest::ByteSizeLong,
-            &JoinGroupRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(JoinGroupRequest, _impl_._cached_size_),
-        false,
-    },
-    &JoinGroupRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* JoinGroupRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 0, 2> JoinGroupRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(JoinGroupRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::JoinGroupRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // uint64 group_id = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(JoinGroupRequest, _impl_.group_id_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(JoinGroupRequest, _impl_.group_id_)}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(JoinGroupRequest, _impl_.header_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(JoinGroupRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // uint64 group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(JoinGroupRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void JoinGroupRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.JoinGroupRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_.group_id_ = ::uint64_t{0u};
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* JoinGroupRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const JoinGroupRequest& this_ = static_cast<const JoinGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* JoinGroupRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const JoinGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.JoinGroupRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // uint64 group_id = 2;
-          if (this_._internal_group_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                2, this_._internal_group_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.JoinGroupRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t JoinGroupRequest::ByteSizeLong(const MessageLite& base) {
-          const JoinGroupRequest& this_ = static_cast<const JoinGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t JoinGroupRequest::ByteSizeLong() const {
-          const JoinGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.JoinGroupRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // uint64 group_id = 2;
-            if (this_._internal_group_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void JoinGroupRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<JoinGroupRequest*>(&to_msg);
-  auto& from = static_cast<const JoinGroupRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.JoinGroupRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_group_id() != 0) {
-    _this->_impl_.group_id_ = from._impl_.group_id_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void JoinGroupRequest::CopyFrom(const JoinGroupRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.JoinGroupRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void JoinGroupRequest::InternalSwap(JoinGroupRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(JoinGroupRequest, _impl_.group_id_)
-      + sizeof(JoinGroupRequest::_impl_.group_id_)
-      - PROTOBUF_FIELD_OFFSET(JoinGroupRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata JoinGroupRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class LeaveGroupRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<LeaveGroupRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(LeaveGroupRequest, _impl_._has_bits_);
-};
-
-void LeaveGroupRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-LeaveGroupRequest::LeaveGroupRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.LeaveGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE LeaveGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::LeaveGroupRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-LeaveGroupRequest::LeaveGroupRequest(
-    ::google::protobuf::Arena* arena,
-    const LeaveGroupRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  LeaveGroupRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.group_id_ = from._impl_.group_id_;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.LeaveGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE LeaveGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void LeaveGroupRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, group_id_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::group_id_));
-}
-LeaveGroupRequest::~LeaveGroupRequest() {
-  // @@protoc_insertion_point(destructor:im.group.LeaveGroupRequest)
-  SharedDtor(*this);
-}
-inline void LeaveGroupRequest::SharedDtor(MessageLite& self) {
-  LeaveGroupRequest& this_ = static_cast<LeaveGroupRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* LeaveGroupRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) LeaveGroupRequest(arena);
-}
-constexpr auto LeaveGroupRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(LeaveGroupRequest),
-                                            alignof(LeaveGroupRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull LeaveGroupRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_LeaveGroupRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &LeaveGroupRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<LeaveGroupRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &LeaveGroupRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<LeaveGroupRequest>(), &LeaveGroupRequest::ByteSizeLong,
-            &LeaveGroupRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(LeaveGroupRequest, _impl_._cached_size_),
-        false,
-    },
-    &LeaveGroupRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* LeaveGroupRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 0, 2> LeaveGroupRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(LeaveGroupRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::LeaveGroupRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // uint64 group_id = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(LeaveGroupRequest, _impl_.group_id_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(LeaveGroupRequest, _impl_.group_id_)}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(LeaveGroupRequest, _impl_.header_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(LeaveGroupRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // uint64 group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(LeaveGroupRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void LeaveGroupRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.LeaveGroupRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_.group_id_ = ::uint64_t{0u};
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* LeaveGroupRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const LeaveGroupRequest& this_ = static_cast<const LeaveGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* LeaveGroupRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const LeaveGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.LeaveGroupRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // uint64 group_id = 2;
-          if (this_._internal_group_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                2, this_._internal_group_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.LeaveGroupRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t LeaveGroupRequest::ByteSizeLong(const MessageLite& base) {
-          const LeaveGroupRequest& this_ = static_cast<const LeaveGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t LeaveGroupRequest::ByteSizeLong() const {
-          const LeaveGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.LeaveGroupRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // uint64 group_id = 2;
-            if (this_._internal_group_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void LeaveGroupRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<LeaveGroupRequest*>(&to_msg);
-  auto& from = static_cast<const LeaveGroupRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.LeaveGroupRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_group_id() != 0) {
-    _this->_impl_.group_id_ = from._impl_.group_id_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void LeaveGroupRequest::CopyFrom(const LeaveGroupRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.LeaveGroupRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void LeaveGroupRequest::InternalSwap(LeaveGroupRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(LeaveGroupRequest, _impl_.group_id_)
-      + sizeof(LeaveGroupRequest::_impl_.group_id_)
-      - PROTOBUF_FIELD_OFFSET(LeaveGroupRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata LeaveGroupRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GroupActionResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GroupActionResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GroupActionResponse, _impl_._has_bits_);
-};
-
-void GroupActionResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GroupActionResponse::GroupActionResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GroupActionResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupActionResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GroupActionResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-GroupActionResponse::GroupActionResponse(
-    ::google::protobuf::Arena* arena,
-    const GroupActionResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GroupActionResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GroupActionResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupActionResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void GroupActionResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-GroupActionResponse::~GroupActionResponse() {
-  // @@protoc_insertion_point(destructor:im.group.GroupActionResponse)
-  SharedDtor(*this);
-}
-inline void GroupActionResponse::SharedDtor(MessageLite& self) {
-  GroupActionResponse& this_ = static_cast<GroupActionResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GroupActionResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GroupActionResponse(arena);
-}
-constexpr auto GroupActionResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GroupActionResponse),
-                                            alignof(GroupActionResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GroupActionResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GroupActionResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GroupActionResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GroupActionResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GroupActionResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GroupActionResponse>(), &GroupActionResponse::ByteSizeLong,
-            &GroupActionResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GroupActionResponse, _impl_._cached_size_),
-        false,
-    },
-    &GroupActionResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GroupActionResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> GroupActionResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GroupActionResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GroupActionResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GroupActionResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(GroupActionResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GroupActionResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GroupActionResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GroupActionResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GroupActionResponse& this_ = static_cast<const GroupActionResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GroupActionResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GroupActionResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GroupActionResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GroupActionResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GroupActionResponse::ByteSizeLong(const MessageLite& base) {
-          const GroupActionResponse& this_ = static_cast<const GroupActionResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GroupActionResponse::ByteSizeLong() const {
-          const GroupActionResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GroupActionResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GroupActionResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GroupActionResponse*>(&to_msg);
-  auto& from = static_cast<const GroupActionResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GroupActionResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GroupActionResponse::CopyFrom(const GroupActionResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GroupActionResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GroupActionResponse::InternalSwap(GroupActionResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata GroupActionResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GroupExistsRequest::_Internal {
- public:
-};
-
-GroupExistsRequest::GroupExistsRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GroupExistsRequest)
-}
-GroupExistsRequest::GroupExistsRequest(
-    ::google::protobuf::Arena* arena, const GroupExistsRequest& from)
-    : GroupExistsRequest(arena) {
-  MergeFrom(from);
-}
-inline PROTOBUF_NDEBUG_INLINE GroupExistsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void GroupExistsRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.group_id_ = {};
-}
-GroupExistsRequest::~GroupExistsRequest() {
-  // @@protoc_insertion_point(destructor:im.group.GroupExistsRequest)
-  SharedDtor(*this);
-}
-inline void GroupExistsRequest::SharedDtor(MessageLite& self) {
-  GroupExistsRequest& this_ = static_cast<GroupExistsRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.~Impl_();
-}
-
-inline void* GroupExistsRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GroupExistsRequest(arena);
-}
-constexpr auto GroupExistsRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GroupExistsRequest),
-                                            alignof(GroupExistsRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GroupExistsRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GroupExistsRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GroupExistsRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GroupExistsRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GroupExistsRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GroupExistsRequest>(), &GroupExistsRequest::ByteSizeLong,
-            &GroupExistsRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GroupExistsRequest, _impl_._cached_size_),
-        false,
-    },
-    &GroupExistsRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GroupExistsRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 0, 0, 2> GroupExistsRequest::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GroupExistsRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // uint64 group_id = 1;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GroupExistsRequest, _impl_.group_id_), 63>(),
-     {8, 63, 0, PROTOBUF_FIELD_OFFSET(GroupExistsRequest, _impl_.group_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // uint64 group_id = 1;
-    {PROTOBUF_FIELD_OFFSET(GroupExistsRequest, _impl_.group_id_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-  }},
-  // no aux_entries
-  {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GroupExistsRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GroupExistsRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_ = ::uint64_t{0u};
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GroupExistsRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GroupExistsRequest& this_ = static_cast<const GroupExistsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GroupExistsRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GroupExistsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GroupExistsRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // uint64 group_id = 1;
-          if (this_._internal_group_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                1, this_._internal_group_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GroupExistsRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GroupExistsRequest::ByteSizeLong(const MessageLite& base) {
-          const GroupExistsRequest& this_ = static_cast<const GroupExistsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GroupExistsRequest::ByteSizeLong() const {
-          const GroupExistsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GroupExistsRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // uint64 group_id = 1;
-            if (this_._internal_group_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GroupExistsRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GroupExistsRequest*>(&to_msg);
-  auto& from = static_cast<const GroupExistsRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GroupExistsRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from._internal_group_id() != 0) {
-    _this->_impl_.group_id_ = from._impl_.group_id_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GroupExistsRequest::CopyFrom(const GroupExistsRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GroupExistsRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GroupExistsRequest::InternalSwap(GroupExistsRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-        swap(_impl_.group_id_, other->_impl_.group_id_);
-}
-
-::google::protobuf::Metadata GroupExistsRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GroupExistsResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GroupExistsResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GroupExistsResponse, _impl_._has_bits_);
-};
-
-void GroupExistsResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GroupExistsResponse::GroupExistsResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GroupExistsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupExistsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GroupExistsResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-GroupExistsResponse::GroupExistsResponse(
-    ::google::protobuf::Arena* arena,
-    const GroupExistsResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GroupExistsResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-  _impl_.exists_ = from._impl_.exists_;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GroupExistsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GroupExistsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void GroupExistsResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, base_),
-           0,
-           offsetof(Impl_, exists_) -
-               offsetof(Impl_, base_) +
-               sizeof(Impl_::exists_));
-}
-GroupExistsResponse::~GroupExistsResponse() {
-  // @@protoc_insertion_point(destructor:im.group.GroupExistsResponse)
-  SharedDtor(*this);
-}
-inline void GroupExistsResponse::SharedDtor(MessageLite& self) {
-  GroupExistsResponse& this_ = static_cast<GroupExistsResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GroupExistsResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GroupExistsResponse(arena);
-}
-constexpr auto GroupExistsResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GroupExistsResponse),
-                                            alignof(GroupExistsResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GroupExistsResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GroupExistsResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GroupExistsResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GroupExistsResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GroupExistsResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GroupExistsResponse>(), &GroupExistsResponse::ByteSizeLong,
-            &GroupExistsResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GroupExistsResponse, _impl_._cached_size_),
-        false,
-    },
-    &GroupExistsResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GroupExistsResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 0, 2> GroupExistsResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GroupExistsResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GroupExistsResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // bool exists = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(GroupExistsResponse, _impl_.exists_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(GroupExistsResponse, _impl_.exists_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GroupExistsResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(GroupExistsResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // bool exists = 2;
-    {PROTOBUF_FIELD_OFFSET(GroupExistsResponse, _impl_.exists_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GroupExistsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GroupExistsResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_.exists_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GroupExistsResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GroupExistsResponse& this_ = static_cast<const GroupExistsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GroupExistsResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GroupExistsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GroupExistsResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // bool exists = 2;
-          if (this_._internal_exists() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                2, this_._internal_exists(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GroupExistsResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GroupExistsResponse::ByteSizeLong(const MessageLite& base) {
-          const GroupExistsResponse& this_ = static_cast<const GroupExistsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GroupExistsResponse::ByteSizeLong() const {
-          const GroupExistsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GroupExistsResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-           {
-            // bool exists = 2;
-            if (this_._internal_exists() != 0) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GroupExistsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GroupExistsResponse*>(&to_msg);
-  auto& from = static_cast<const GroupExistsResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GroupExistsResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  if (from._internal_exists() != 0) {
-    _this->_impl_.exists_ = from._impl_.exists_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GroupExistsResponse::CopyFrom(const GroupExistsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GroupExistsResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GroupExistsResponse::InternalSwap(GroupExistsResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GroupExistsResponse, _impl_.exists_)
-      + sizeof(GroupExistsResponse::_impl_.exists_)
-      - PROTOBUF_FIELD_OFFSET(GroupExistsResponse, _impl_.base_)>(
-          reinterpret_cast<char*>(&_impl_.base_),
-          reinterpret_cast<char*>(&other->_impl_.base_));
-}
-
-::google::protobuf::Metadata GroupExistsResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetGroupInfoRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetGroupInfoRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_._has_bits_);
-};
-
-void GetGroupInfoRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetGroupInfoRequest::GetGroupInfoRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GetGroupInfoRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupInfoRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GetGroupInfoRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        group_id_(arena, from.group_id_) {}
-
-GetGroupInfoRequest::GetGroupInfoRequest(
-    ::google::protobuf::Arena* arena,
-    const GetGroupInfoRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetGroupInfoRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.group_record_id_ = from._impl_.group_record_id_;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GetGroupInfoRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupInfoRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        group_id_(arena) {}
-
-inline void GetGroupInfoRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, group_record_id_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::group_record_id_));
-}
-GetGroupInfoRequest::~GetGroupInfoRequest() {
-  // @@protoc_insertion_point(destructor:im.group.GetGroupInfoRequest)
-  SharedDtor(*this);
-}
-inline void GetGroupInfoRequest::SharedDtor(MessageLite& self) {
-  GetGroupInfoRequest& this_ = static_cast<GetGroupInfoRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetGroupInfoRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetGroupInfoRequest(arena);
-}
-constexpr auto GetGroupInfoRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetGroupInfoRequest),
-                                            alignof(GetGroupInfoRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetGroupInfoRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetGroupInfoRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetGroupInfoRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetGroupInfoRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetGroupInfoRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetGroupInfoRequest>(), &GetGroupInfoRequest::ByteSizeLong,
-            &GetGroupInfoRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetGroupInfoRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetGroupInfoRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 45, 2> GetGroupInfoRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GetGroupInfoRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_.header_)}},
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_.group_id_)}},
-    // uint64 group_record_id = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GetGroupInfoRequest, _impl_.group_record_id_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_.group_record_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // uint64 group_record_id = 3;
-    {PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_.group_record_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\34\0\10\0\0\0\0\0"
-    "im.group.GetGroupInfoRequest"
-    "group_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetGroupInfoRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GetGroupInfoRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_.group_record_id_ = ::uint64_t{0u};
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetGroupInfoRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetGroupInfoRequest& this_ = static_cast<const GetGroupInfoRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetGroupInfoRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetGroupInfoRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GetGroupInfoRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GetGroupInfoRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // uint64 group_record_id = 3;
-          if (this_._internal_group_record_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                3, this_._internal_group_record_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GetGroupInfoRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetGroupInfoRequest::ByteSizeLong(const MessageLite& base) {
-          const GetGroupInfoRequest& this_ = static_cast<const GetGroupInfoRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetGroupInfoRequest::ByteSizeLong() const {
-          const GetGroupInfoRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GetGroupInfoRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // uint64 group_record_id = 3;
-            if (this_._internal_group_record_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_record_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetGroupInfoRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetGroupInfoRequest*>(&to_msg);
-  auto& from = static_cast<const GetGroupInfoRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GetGroupInfoRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_group_record_id() != 0) {
-    _this->_impl_.group_record_id_ = from._impl_.group_record_id_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetGroupInfoRequest::CopyFrom(const GetGroupInfoRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GetGroupInfoRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetGroupInfoRequest::InternalSwap(GetGroupInfoRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_.group_record_id_)
-      + sizeof(GetGroupInfoRequest::_impl_.group_record_id_)
-      - PROTOBUF_FIELD_OFFSET(GetGroupInfoRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata GetGroupInfoRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetGroupInfoResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetGroupInfoResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_._has_bits_);
-};
-
-void GetGroupInfoResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetGroupInfoResponse::GetGroupInfoResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GetGroupInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GetGroupInfoResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        members_{visibility, arena, from.members_} {}
-
-GetGroupInfoResponse::GetGroupInfoResponse(
-    ::google::protobuf::Arena* arena,
-    const GetGroupInfoResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetGroupInfoResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-  _impl_.group_ = (cached_has_bits & 0x00000002u) ? ::google::protobuf::Message::CopyConstruct<::im::group::GroupInfo>(
-                              arena, *from._impl_.group_)
-                        : nullptr;
-  _impl_.joined_ = from._impl_.joined_;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GetGroupInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        members_{visibility, arena} {}
-
-inline void GetGroupInfoResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, base_),
-           0,
-           offsetof(Impl_, joined_) -
-               offsetof(Impl_, base_) +
-               sizeof(Impl_::joined_));
-}
-GetGroupInfoResponse::~GetGroupInfoResponse() {
-  // @@protoc_insertion_point(destructor:im.group.GetGroupInfoResponse)
-  SharedDtor(*this);
-}
-inline void GetGroupInfoResponse::SharedDtor(MessageLite& self) {
-  GetGroupInfoResponse& this_ = static_cast<GetGroupInfoResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  delete this_._impl_.group_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetGroupInfoResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetGroupInfoResponse(arena);
-}
-constexpr auto GetGroupInfoResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.members_) +
-          decltype(GetGroupInfoResponse::_impl_.members_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(GetGroupInfoResponse), alignof(GetGroupInfoResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&GetGroupInfoResponse::PlacementNew_,
-                                 sizeof(GetGroupInfoResponse),
-                                 alignof(GetGroupInfoResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetGroupInfoResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetGroupInfoResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetGroupInfoResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetGroupInfoResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetGroupInfoResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetGroupInfoResponse>(), &GetGroupInfoResponse::ByteSizeLong,
-            &GetGroupInfoResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetGroupInfoResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetGroupInfoResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 3, 0, 2> GetGroupInfoResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    3,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GetGroupInfoResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // bool joined = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(GetGroupInfoResponse, _impl_.joined_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.joined_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.base_)}},
-    // .im.group.GroupInfo group = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.group_)}},
-    // repeated .im.group.GroupMember members = 3;
-    {::_pbi::TcParser::FastMtR1,
-     {26, 63, 2, PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.members_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.group.GroupInfo group = 2;
-    {PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.group_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .im.group.GroupMember members = 3;
-    {PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.members_), -1, 2,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-    // bool joined = 4;
-    {PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.joined_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::group::GroupInfo>()},
-    {::_pbi::TcParser::GetTable<::im::group::GroupMember>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GetGroupInfoResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GetGroupInfoResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.members_.Clear();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.base_ != nullptr);
-      _impl_.base_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.group_ != nullptr);
-      _impl_.group_->Clear();
-    }
-  }
-  _impl_.joined_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetGroupInfoResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetGroupInfoResponse& this_ = static_cast<const GetGroupInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetGroupInfoResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetGroupInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GetGroupInfoResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.group.GroupInfo group = 2;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.group_, this_._impl_.group_->GetCachedSize(), target,
-                stream);
-          }
-
-          // repeated .im.group.GroupMember members = 3;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_members_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_members().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    3, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          // bool joined = 4;
-          if (this_._internal_joined() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                4, this_._internal_joined(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GetGroupInfoResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetGroupInfoResponse::ByteSizeLong(const MessageLite& base) {
-          const GetGroupInfoResponse& this_ = static_cast<const GetGroupInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetGroupInfoResponse::ByteSizeLong() const {
-          const GetGroupInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GetGroupInfoResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .im.group.GroupMember members = 3;
-            {
-              total_size += 1UL * this_._internal_members_size();
-              for (const auto& msg : this_._internal_members()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // .im.base.BaseResponse base = 1;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-            // .im.group.GroupInfo group = 2;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.group_);
-            }
-          }
-           {
-            // bool joined = 4;
-            if (this_._internal_joined() != 0) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetGroupInfoResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetGroupInfoResponse*>(&to_msg);
-  auto& from = static_cast<const GetGroupInfoResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GetGroupInfoResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_members()->MergeFrom(
-      from._internal_members());
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(from._impl_.base_ != nullptr);
-      if (_this->_impl_.base_ == nullptr) {
-        _this->_impl_.base_ =
-            ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-      } else {
-        _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-      }
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(from._impl_.group_ != nullptr);
-      if (_this->_impl_.group_ == nullptr) {
-        _this->_impl_.group_ =
-            ::google::protobuf::Message::CopyConstruct<::im::group::GroupInfo>(arena, *from._impl_.group_);
-      } else {
-        _this->_impl_.group_->MergeFrom(*from._impl_.group_);
-      }
-    }
-  }
-  if (from._internal_joined() != 0) {
-    _this->_impl_.joined_ = from._impl_.joined_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetGroupInfoResponse::CopyFrom(const GetGroupInfoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GetGroupInfoResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetGroupInfoResponse::InternalSwap(GetGroupInfoResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.members_.InternalSwap(&other->_impl_.members_);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.joined_)
-      + sizeof(GetGroupInfoResponse::_impl_.joined_)
-      - PROTOBUF_FIELD_OFFSET(GetGroupInfoResponse, _impl_.base_)>(
-          reinterpret_cast<char*>(&_impl_.base_),
-          reinterpret_cast<char*>(&other->_impl_.base_));
-}
-
-::google::protobuf::Metadata GetGroupInfoResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SearchGroupsRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<SearchGroupsRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_._has_bits_);
-};
-
-void SearchGroupsRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-SearchGroupsRequest::SearchGroupsRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.SearchGroupsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SearchGroupsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::SearchGroupsRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        keyword_(arena, from.keyword_) {}
-
-SearchGroupsRequest::SearchGroupsRequest(
-    ::google::protobuf::Arena* arena,
-    const SearchGroupsRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SearchGroupsRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.limit_ = from._impl_.limit_;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.SearchGroupsRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SearchGroupsRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        keyword_(arena) {}
-
-inline void SearchGroupsRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, limit_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::limit_));
-}
-SearchGroupsRequest::~SearchGroupsRequest() {
-  // @@protoc_insertion_point(destructor:im.group.SearchGroupsRequest)
-  SharedDtor(*this);
-}
-inline void SearchGroupsRequest::SharedDtor(MessageLite& self) {
-  SearchGroupsRequest& this_ = static_cast<SearchGroupsRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.keyword_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* SearchGroupsRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SearchGroupsRequest(arena);
-}
-constexpr auto SearchGroupsRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(SearchGroupsRequest),
-                                            alignof(SearchGroupsRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SearchGroupsRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SearchGroupsRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SearchGroupsRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SearchGroupsRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SearchGroupsRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SearchGroupsRequest>(), &SearchGroupsRequest::ByteSizeLong,
-            &SearchGroupsRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_._cached_size_),
-        false,
-    },
-    &SearchGroupsRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SearchGroupsRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 44, 2> SearchGroupsRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::SearchGroupsRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_.header_)}},
-    // string keyword = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_.keyword_)}},
-    // int32 limit = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SearchGroupsRequest, _impl_.limit_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_.limit_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string keyword = 2;
-    {PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_.keyword_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 limit = 3;
-    {PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_.limit_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\34\0\7\0\0\0\0\0"
-    "im.group.SearchGroupsRequest"
-    "keyword"
-  }},
-};
-
-PROTOBUF_NOINLINE void SearchGroupsRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.SearchGroupsRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.keyword_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_.limit_ = 0;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SearchGroupsRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SearchGroupsRequest& this_ = static_cast<const SearchGroupsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SearchGroupsRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SearchGroupsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.SearchGroupsRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string keyword = 2;
-          if (!this_._internal_keyword().empty()) {
-            const std::string& _s = this_._internal_keyword();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.SearchGroupsRequest.keyword");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // int32 limit = 3;
-          if (this_._internal_limit() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_limit(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.SearchGroupsRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SearchGroupsRequest::ByteSizeLong(const MessageLite& base) {
-          const SearchGroupsRequest& this_ = static_cast<const SearchGroupsRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SearchGroupsRequest::ByteSizeLong() const {
-          const SearchGroupsRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.SearchGroupsRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string keyword = 2;
-            if (!this_._internal_keyword().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_keyword());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // int32 limit = 3;
-            if (this_._internal_limit() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_limit());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SearchGroupsRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SearchGroupsRequest*>(&to_msg);
-  auto& from = static_cast<const SearchGroupsRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.SearchGroupsRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_keyword().empty()) {
-    _this->_internal_set_keyword(from._internal_keyword());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_limit() != 0) {
-    _this->_impl_.limit_ = from._impl_.limit_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SearchGroupsRequest::CopyFrom(const SearchGroupsRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.SearchGroupsRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SearchGroupsRequest::InternalSwap(SearchGroupsRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.keyword_, &other->_impl_.keyword_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_.limit_)
-      + sizeof(SearchGroupsRequest::_impl_.limit_)
-      - PROTOBUF_FIELD_OFFSET(SearchGroupsRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata SearchGroupsRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SearchGroupsResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<SearchGroupsResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(SearchGroupsResponse, _impl_._has_bits_);
-};
-
-void SearchGroupsResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-SearchGroupsResponse::SearchGroupsResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.SearchGroupsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SearchGroupsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::SearchGroupsResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        groups_{visibility, arena, from.groups_} {}
-
-SearchGroupsResponse::SearchGroupsResponse(
-    ::google::protobuf::Arena* arena,
-    const SearchGroupsResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SearchGroupsResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.SearchGroupsResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SearchGroupsResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        groups_{visibility, arena} {}
-
-inline void SearchGroupsResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-SearchGroupsResponse::~SearchGroupsResponse() {
-  // @@protoc_insertion_point(destructor:im.group.SearchGroupsResponse)
-  SharedDtor(*this);
-}
-inline void SearchGroupsResponse::SharedDtor(MessageLite& self) {
-  SearchGroupsResponse& this_ = static_cast<SearchGroupsResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* SearchGroupsResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SearchGroupsResponse(arena);
-}
-constexpr auto SearchGroupsResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(SearchGroupsResponse, _impl_.groups_) +
-          decltype(SearchGroupsResponse::_impl_.groups_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(SearchGroupsResponse), alignof(SearchGroupsResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&SearchGroupsResponse::PlacementNew_,
-                                 sizeof(SearchGroupsResponse),
-                                 alignof(SearchGroupsResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SearchGroupsResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SearchGroupsResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SearchGroupsResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SearchGroupsResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SearchGroupsResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SearchGroupsResponse>(), &SearchGroupsResponse::ByteSizeLong,
-            &SearchGroupsResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SearchGroupsResponse, _impl_._cached_size_),
-        false,
-    },
-    &SearchGroupsResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SearchGroupsResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> SearchGroupsResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(SearchGroupsResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::SearchGroupsResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .im.group.GroupInfo groups = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 1, PROTOBUF_FIELD_OFFSET(SearchGroupsResponse, _impl_.groups_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SearchGroupsResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(SearchGroupsResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .im.group.GroupInfo groups = 2;
-    {PROTOBUF_FIELD_OFFSET(SearchGroupsResponse, _impl_.groups_), -1, 1,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::group::GroupInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void SearchGroupsResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.SearchGroupsResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.groups_.Clear();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SearchGroupsResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SearchGroupsResponse& this_ = static_cast<const SearchGroupsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SearchGroupsResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SearchGroupsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.SearchGroupsResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // repeated .im.group.GroupInfo groups = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_groups_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_groups().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.SearchGroupsResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SearchGroupsResponse::ByteSizeLong(const MessageLite& base) {
-          const SearchGroupsResponse& this_ = static_cast<const SearchGroupsResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SearchGroupsResponse::ByteSizeLong() const {
-          const SearchGroupsResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.SearchGroupsResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .im.group.GroupInfo groups = 2;
-            {
-              total_size += 1UL * this_._internal_groups_size();
-              for (const auto& msg : this_._internal_groups()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SearchGroupsResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SearchGroupsResponse*>(&to_msg);
-  auto& from = static_cast<const SearchGroupsResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.SearchGroupsResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_groups()->MergeFrom(
-      from._internal_groups());
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SearchGroupsResponse::CopyFrom(const SearchGroupsResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.SearchGroupsResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SearchGroupsResponse::InternalSwap(SearchGroupsResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.groups_.InternalSwap(&other->_impl_.groups_);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata SearchGroupsResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetGroupListRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetGroupListRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetGroupListRequest, _impl_._has_bits_);
-};
-
-void GetGroupListRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetGroupListRequest::GetGroupListRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GetGroupListRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupListRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GetGroupListRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-GetGroupListRequest::GetGroupListRequest(
-    ::google::protobuf::Arena* arena,
-    const GetGroupListRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetGroupListRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GetGroupListRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupListRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void GetGroupListRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.header_ = {};
-}
-GetGroupListRequest::~GetGroupListRequest() {
-  // @@protoc_insertion_point(destructor:im.group.GetGroupListRequest)
-  SharedDtor(*this);
-}
-inline void GetGroupListRequest::SharedDtor(MessageLite& self) {
-  GetGroupListRequest& this_ = static_cast<GetGroupListRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetGroupListRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetGroupListRequest(arena);
-}
-constexpr auto GetGroupListRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GetGroupListRequest),
-                                            alignof(GetGroupListRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetGroupListRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetGroupListRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetGroupListRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetGroupListRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetGroupListRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetGroupListRequest>(), &GetGroupListRequest::ByteSizeLong,
-            &GetGroupListRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetGroupListRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetGroupListRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetGroupListRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> GetGroupListRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetGroupListRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GetGroupListRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetGroupListRequest, _impl_.header_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(GetGroupListRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GetGroupListRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GetGroupListRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetGroupListRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetGroupListRequest& this_ = static_cast<const GetGroupListRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetGroupListRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetGroupListRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GetGroupListRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GetGroupListRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetGroupListRequest::ByteSizeLong(const MessageLite& base) {
-          const GetGroupListRequest& this_ = static_cast<const GetGroupListRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetGroupListRequest::ByteSizeLong() const {
-          const GetGroupListRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GetGroupListRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetGroupListRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetGroupListRequest*>(&to_msg);
-  auto& from = static_cast<const GetGroupListRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GetGroupListRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetGroupListRequest::CopyFrom(const GetGroupListRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GetGroupListRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetGroupListRequest::InternalSwap(GetGroupListRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.header_, other->_impl_.header_);
-}
-
-::google::protobuf::Metadata GetGroupListRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetGroupListResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetGroupListResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetGroupListResponse, _impl_._has_bits_);
-};
-
-void GetGroupListResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetGroupListResponse::GetGroupListResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GetGroupListResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupListResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GetGroupListResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        groups_{visibility, arena, from.groups_} {}
-
-GetGroupListResponse::GetGroupListResponse(
-    ::google::protobuf::Arena* arena,
-    const GetGroupListResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetGroupListResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GetGroupListResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupListResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        groups_{visibility, arena} {}
-
-inline void GetGroupListResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-GetGroupListResponse::~GetGroupListResponse() {
-  // @@protoc_insertion_point(destructor:im.group.GetGroupListResponse)
-  SharedDtor(*this);
-}
-inline void GetGroupListResponse::SharedDtor(MessageLite& self) {
-  GetGroupListResponse& this_ = static_cast<GetGroupListResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetGroupListResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetGroupListResponse(arena);
-}
-constexpr auto GetGroupListResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(GetGroupListResponse, _impl_.groups_) +
-          decltype(GetGroupListResponse::_impl_.groups_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(GetGroupListResponse), alignof(GetGroupListResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&GetGroupListResponse::PlacementNew_,
-                                 sizeof(GetGroupListResponse),
-                                 alignof(GetGroupListResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetGroupListResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetGroupListResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetGroupListResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetGroupListResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetGroupListResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetGroupListResponse>(), &GetGroupListResponse::ByteSizeLong,
-            &GetGroupListResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetGroupListResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetGroupListResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetGroupListResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> GetGroupListResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetGroupListResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GetGroupListResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .im.group.GroupInfo groups = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 1, PROTOBUF_FIELD_OFFSET(GetGroupListResponse, _impl_.groups_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetGroupListResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(GetGroupListResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .im.group.GroupInfo groups = 2;
-    {PROTOBUF_FIELD_OFFSET(GetGroupListResponse, _impl_.groups_), -1, 1,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::group::GroupInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GetGroupListResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GetGroupListResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.groups_.Clear();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetGroupListResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetGroupListResponse& this_ = static_cast<const GetGroupListResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetGroupListResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetGroupListResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GetGroupListResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // repeated .im.group.GroupInfo groups = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_groups_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_groups().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GetGroupListResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetGroupListResponse::ByteSizeLong(const MessageLite& base) {
-          const GetGroupListResponse& this_ = static_cast<const GetGroupListResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetGroupListResponse::ByteSizeLong() const {
-          const GetGroupListResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GetGroupListResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .im.group.GroupInfo groups = 2;
-            {
-              total_size += 1UL * this_._internal_groups_size();
-              for (const auto& msg : this_._internal_groups()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetGroupListResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetGroupListResponse*>(&to_msg);
-  auto& from = static_cast<const GetGroupListResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GetGroupListResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_groups()->MergeFrom(
-      from._internal_groups());
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetGroupListResponse::CopyFrom(const GetGroupListResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GetGroupListResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetGroupListResponse::InternalSwap(GetGroupListResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.groups_.InternalSwap(&other->_impl_.groups_);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata GetGroupListResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ModifyGroupInfoRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<ModifyGroupInfoRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_._has_bits_);
-};
-
-void ModifyGroupInfoRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-ModifyGroupInfoRequest::ModifyGroupInfoRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.ModifyGroupInfoRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ModifyGroupInfoRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::ModifyGroupInfoRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        group_id_(arena, from.group_id_),
-        name_(arena, from.name_),
-        avatar_(arena, from.avatar_),
-        notice_(arena, from.notice_) {}
-
-ModifyGroupInfoRequest::ModifyGroupInfoRequest(
-    ::google::protobuf::Arena* arena,
-    const ModifyGroupInfoRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ModifyGroupInfoRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.ModifyGroupInfoRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ModifyGroupInfoRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        group_id_(arena),
-        name_(arena),
-        avatar_(arena),
-        notice_(arena) {}
-
-inline void ModifyGroupInfoRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.header_ = {};
-}
-ModifyGroupInfoRequest::~ModifyGroupInfoRequest() {
-  // @@protoc_insertion_point(destructor:im.group.ModifyGroupInfoRequest)
-  SharedDtor(*this);
-}
-inline void ModifyGroupInfoRequest::SharedDtor(MessageLite& self) {
-  ModifyGroupInfoRequest& this_ = static_cast<ModifyGroupInfoRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  this_._impl_.name_.Destroy();
-  this_._impl_.avatar_.Destroy();
-  this_._impl_.notice_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* ModifyGroupInfoRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ModifyGroupInfoRequest(arena);
-}
-constexpr auto ModifyGroupInfoRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ModifyGroupInfoRequest),
-                                            alignof(ModifyGroupInfoRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ModifyGroupInfoRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ModifyGroupInfoRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ModifyGroupInfoRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ModifyGroupInfoRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ModifyGroupInfoRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ModifyGroupInfoRequest>(), &ModifyGroupInfoRequest::ByteSizeLong,
-            &ModifyGroupInfoRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_._cached_size_),
-        false,
-    },
-    &ModifyGroupInfoRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ModifyGroupInfoRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 1, 64, 2> ModifyGroupInfoRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    5, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967264,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::ModifyGroupInfoRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.header_)}},
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.group_id_)}},
-    // string name = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.name_)}},
-    // string avatar = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.avatar_)}},
-    // string notice = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.notice_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string name = 3;
-    {PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.name_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string avatar = 4;
-    {PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.avatar_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string notice = 5;
-    {PROTOBUF_FIELD_OFFSET(ModifyGroupInfoRequest, _impl_.notice_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\37\0\10\4\6\6\0\0"
-    "im.group.ModifyGroupInfoRequest"
-    "group_id"
-    "name"
-    "avatar"
-    "notice"
-  }},
-};
-
-PROTOBUF_NOINLINE void ModifyGroupInfoRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.ModifyGroupInfoRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_.ClearToEmpty();
-  _impl_.name_.ClearToEmpty();
-  _impl_.avatar_.ClearToEmpty();
-  _impl_.notice_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ModifyGroupInfoRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ModifyGroupInfoRequest& this_ = static_cast<const ModifyGroupInfoRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ModifyGroupInfoRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ModifyGroupInfoRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.ModifyGroupInfoRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.ModifyGroupInfoRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string name = 3;
-          if (!this_._internal_name().empty()) {
-            const std::string& _s = this_._internal_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.ModifyGroupInfoRequest.name");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string avatar = 4;
-          if (!this_._internal_avatar().empty()) {
-            const std::string& _s = this_._internal_avatar();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.ModifyGroupInfoRequest.avatar");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string notice = 5;
-          if (!this_._internal_notice().empty()) {
-            const std::string& _s = this_._internal_notice();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.ModifyGroupInfoRequest.notice");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.ModifyGroupInfoRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ModifyGroupInfoRequest::ByteSizeLong(const MessageLite& base) {
-          const ModifyGroupInfoRequest& this_ = static_cast<const ModifyGroupInfoRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ModifyGroupInfoRequest::ByteSizeLong() const {
-          const ModifyGroupInfoRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.ModifyGroupInfoRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-            // string name = 3;
-            if (!this_._internal_name().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_name());
-            }
-            // string avatar = 4;
-            if (!this_._internal_avatar().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_avatar());
-            }
-            // string notice = 5;
-            if (!this_._internal_notice().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_notice());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ModifyGroupInfoRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ModifyGroupInfoRequest*>(&to_msg);
-  auto& from = static_cast<const ModifyGroupInfoRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.ModifyGroupInfoRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  if (!from._internal_name().empty()) {
-    _this->_internal_set_name(from._internal_name());
-  }
-  if (!from._internal_avatar().empty()) {
-    _this->_internal_set_avatar(from._internal_avatar());
-  }
-  if (!from._internal_notice().empty()) {
-    _this->_internal_set_notice(from._internal_notice());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ModifyGroupInfoRequest::CopyFrom(const ModifyGroupInfoRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.ModifyGroupInfoRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ModifyGroupInfoRequest::InternalSwap(ModifyGroupInfoRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.name_, &other->_impl_.name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.avatar_, &other->_impl_.avatar_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.notice_, &other->_impl_.notice_, arena);
-  swap(_impl_.header_, other->_impl_.header_);
-}
-
-::google::protobuf::Metadata ModifyGroupInfoRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ModifyGroupInfoResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<ModifyGroupInfoResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ModifyGroupInfoResponse, _impl_._has_bits_);
-};
-
-void ModifyGroupInfoResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-ModifyGroupInfoResponse::ModifyGroupInfoResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.ModifyGroupInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ModifyGroupInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::ModifyGroupInfoResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-ModifyGroupInfoResponse::ModifyGroupInfoResponse(
-    ::google::protobuf::Arena* arena,
-    const ModifyGroupInfoResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ModifyGroupInfoResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-  _impl_.group_ = (cached_has_bits & 0x00000002u) ? ::google::protobuf::Message::CopyConstruct<::im::group::GroupInfo>(
-                              arena, *from._impl_.group_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.ModifyGroupInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ModifyGroupInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void ModifyGroupInfoResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, base_),
-           0,
-           offsetof(Impl_, group_) -
-               offsetof(Impl_, base_) +
-               sizeof(Impl_::group_));
-}
-ModifyGroupInfoResponse::~ModifyGroupInfoResponse() {
-  // @@protoc_insertion_point(destructor:im.group.ModifyGroupInfoResponse)
-  SharedDtor(*this);
-}
-inline void ModifyGroupInfoResponse::SharedDtor(MessageLite& self) {
-  ModifyGroupInfoResponse& this_ = static_cast<ModifyGroupInfoResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  delete this_._impl_.group_;
-  this_._impl_.~Impl_();
-}
-
-inline void* ModifyGroupInfoResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ModifyGroupInfoResponse(arena);
-}
-constexpr auto ModifyGroupInfoResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(ModifyGroupInfoResponse),
-                                            alignof(ModifyGroupInfoResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ModifyGroupInfoResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ModifyGroupInfoResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ModifyGroupInfoResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ModifyGroupInfoResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ModifyGroupInfoResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ModifyGroupInfoResponse>(), &ModifyGroupInfoResponse::ByteSizeLong,
-            &ModifyGroupInfoResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ModifyGroupInfoResponse, _impl_._cached_size_),
-        false,
-    },
-    &ModifyGroupInfoResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ModifyGroupInfoResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> ModifyGroupInfoResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ModifyGroupInfoResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::ModifyGroupInfoResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.group.GroupInfo group = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(ModifyGroupInfoResponse, _impl_.group_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ModifyGroupInfoResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(ModifyGroupInfoResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.group.GroupInfo group = 2;
-    {PROTOBUF_FIELD_OFFSET(ModifyGroupInfoResponse, _impl_.group_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::group::GroupInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void ModifyGroupInfoResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.ModifyGroupInfoResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.base_ != nullptr);
-      _impl_.base_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.group_ != nullptr);
-      _impl_.group_->Clear();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ModifyGroupInfoResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ModifyGroupInfoResponse& this_ = static_cast<const ModifyGroupInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ModifyGroupInfoResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ModifyGroupInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.ModifyGroupInfoResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.group.GroupInfo group = 2;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.group_, this_._impl_.group_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.ModifyGroupInfoResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ModifyGroupInfoResponse::ByteSizeLong(const MessageLite& base) {
-          const ModifyGroupInfoResponse& this_ = static_cast<const ModifyGroupInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ModifyGroupInfoResponse::ByteSizeLong() const {
-          const ModifyGroupInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.ModifyGroupInfoResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // .im.base.BaseResponse base = 1;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-            // .im.group.GroupInfo group = 2;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.group_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ModifyGroupInfoResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ModifyGroupInfoResponse*>(&to_msg);
-  auto& from = static_cast<const ModifyGroupInfoResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.ModifyGroupInfoResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(from._impl_.base_ != nullptr);
-      if (_this->_impl_.base_ == nullptr) {
-        _this->_impl_.base_ =
-            ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-      } else {
-        _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-      }
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(from._impl_.group_ != nullptr);
-      if (_this->_impl_.group_ == nullptr) {
-        _this->_impl_.group_ =
-            ::google::protobuf::Message::CopyConstruct<::im::group::GroupInfo>(arena, *from._impl_.group_);
-      } else {
-        _this->_impl_.group_->MergeFrom(*from._impl_.group_);
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ModifyGroupInfoResponse::CopyFrom(const ModifyGroupInfoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.ModifyGroupInfoResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ModifyGroupInfoResponse::InternalSwap(ModifyGroupInfoResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(ModifyGroupInfoResponse, _impl_.group_)
-      + sizeof(ModifyGroupInfoResponse::_impl_.group_)
-      - PROTOBUF_FIELD_OFFSET(ModifyGroupInfoResponse, _impl_.base_)>(
-          reinterpret_cast<char*>(&_impl_.base_),
-          reinterpret_cast<char*>(&other->_impl_.base_));
-}
-
-::google::protobuf::Metadata ModifyGroupInfoResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class InviteMemberRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<InviteMemberRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_._has_bits_);
-};
-
-void InviteMemberRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-InviteMemberRequest::InviteMemberRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.InviteMemberRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE InviteMemberRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::InviteMemberRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        invite_uids_{visibility, arena, from.invite_uids_},
-        group_id_(arena, from.group_id_) {}
-
-InviteMemberRequest::InviteMemberRequest(
-    ::google::protobuf::Arena* arena,
-    const InviteMemberRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  InviteMemberRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.InviteMemberRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE InviteMemberRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        invite_uids_{visibility, arena},
-        group_id_(arena) {}
-
-inline void InviteMemberRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.header_ = {};
-}
-InviteMemberRequest::~InviteMemberRequest() {
-  // @@protoc_insertion_point(destructor:im.group.InviteMemberRequest)
-  SharedDtor(*this);
-}
-inline void InviteMemberRequest::SharedDtor(MessageLite& self) {
-  InviteMemberRequest& this_ = static_cast<InviteMemberRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* InviteMemberRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) InviteMemberRequest(arena);
-}
-constexpr auto InviteMemberRequest::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_.invite_uids_) +
-          decltype(InviteMemberRequest::_impl_.invite_uids_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(InviteMemberRequest), alignof(InviteMemberRequest), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&InviteMemberRequest::PlacementNew_,
-                                 sizeof(InviteMemberRequest),
-                                 alignof(InviteMemberRequest));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull InviteMemberRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_InviteMemberRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &InviteMemberRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<InviteMemberRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &InviteMemberRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<InviteMemberRequest>(), &InviteMemberRequest::ByteSizeLong,
-            &InviteMemberRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_._cached_size_),
-        false,
-    },
-    &InviteMemberRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* InviteMemberRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 56, 2> InviteMemberRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::InviteMemberRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_.header_)}},
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_.group_id_)}},
-    // repeated string invite_uids = 3;
-    {::_pbi::TcParser::FastUR1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_.invite_uids_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated string invite_uids = 3;
-    {PROTOBUF_FIELD_OFFSET(InviteMemberRequest, _impl_.invite_uids_), -1, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\34\0\10\13\0\0\0\0"
-    "im.group.InviteMemberRequest"
-    "group_id"
-    "invite_uids"
-  }},
-};
-
-PROTOBUF_NOINLINE void InviteMemberRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.InviteMemberRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.invite_uids_.Clear();
-  _impl_.group_id_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* InviteMemberRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const InviteMemberRequest& this_ = static_cast<const InviteMemberRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* InviteMemberRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const InviteMemberRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.InviteMemberRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.InviteMemberRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // repeated string invite_uids = 3;
-          for (int i = 0, n = this_._internal_invite_uids_size(); i < n; ++i) {
-            const auto& s = this_._internal_invite_uids().Get(i);
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.InviteMemberRequest.invite_uids");
-            target = stream->WriteString(3, s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.InviteMemberRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t InviteMemberRequest::ByteSizeLong(const MessageLite& base) {
-          const InviteMemberRequest& this_ = static_cast<const InviteMemberRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t InviteMemberRequest::ByteSizeLong() const {
-          const InviteMemberRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.InviteMemberRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated string invite_uids = 3;
-            {
-              total_size +=
-                  1 * ::google::protobuf::internal::FromIntSize(this_._internal_invite_uids().size());
-              for (int i = 0, n = this_._internal_invite_uids().size(); i < n; ++i) {
-                total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-                    this_._internal_invite_uids().Get(i));
-              }
-            }
-          }
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void InviteMemberRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<InviteMemberRequest*>(&to_msg);
-  auto& from = static_cast<const InviteMemberRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.InviteMemberRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_invite_uids()->MergeFrom(from._internal_invite_uids());
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void InviteMemberRequest::CopyFrom(const InviteMemberRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.InviteMemberRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void InviteMemberRequest::InternalSwap(InviteMemberRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.invite_uids_.InternalSwap(&other->_impl_.invite_uids_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  swap(_impl_.header_, other->_impl_.header_);
-}
-
-::google::protobuf::Metadata InviteMemberRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class InviteMemberResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<InviteMemberResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(InviteMemberResponse, _impl_._has_bits_);
-};
-
-void InviteMemberResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-InviteMemberResponse::InviteMemberResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.InviteMemberResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE InviteMemberResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::InviteMemberResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-InviteMemberResponse::InviteMemberResponse(
-    ::google::protobuf::Arena* arena,
-    const InviteMemberResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  InviteMemberResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.InviteMemberResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE InviteMemberResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void InviteMemberResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-InviteMemberResponse::~InviteMemberResponse() {
-  // @@protoc_insertion_point(destructor:im.group.InviteMemberResponse)
-  SharedDtor(*this);
-}
-inline void InviteMemberResponse::SharedDtor(MessageLite& self) {
-  InviteMemberResponse& this_ = static_cast<InviteMemberResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* InviteMemberResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) InviteMemberResponse(arena);
-}
-constexpr auto InviteMemberResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(InviteMemberResponse),
-                                            alignof(InviteMemberResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull InviteMemberResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_InviteMemberResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &InviteMemberResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<InviteMemberResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &InviteMemberResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<InviteMemberResponse>(), &InviteMemberResponse::ByteSizeLong,
-            &InviteMemberResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(InviteMemberResponse, _impl_._cached_size_),
-        false,
-    },
-    &InviteMemberResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* InviteMemberResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> InviteMemberResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(InviteMemberResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::InviteMemberResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(InviteMemberResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(InviteMemberResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void InviteMemberResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.InviteMemberResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* InviteMemberResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const InviteMemberResponse& this_ = static_cast<const InviteMemberResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* InviteMemberResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const InviteMemberResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.InviteMemberResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.InviteMemberResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t InviteMemberResponse::ByteSizeLong(const MessageLite& base) {
-          const InviteMemberResponse& this_ = static_cast<const InviteMemberResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t InviteMemberResponse::ByteSizeLong() const {
-          const InviteMemberResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.InviteMemberResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void InviteMemberResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<InviteMemberResponse*>(&to_msg);
-  auto& from = static_cast<const InviteMemberResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.InviteMemberResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void InviteMemberResponse::CopyFrom(const InviteMemberResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.InviteMemberResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void InviteMemberResponse::InternalSwap(InviteMemberResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata InviteMemberResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class KickMemberRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<KickMemberRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_._has_bits_);
-};
-
-void KickMemberRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-KickMemberRequest::KickMemberRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.KickMemberRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE KickMemberRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::KickMemberRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        kick_uids_{visibility, arena, from.kick_uids_},
-        group_id_(arena, from.group_id_) {}
-
-KickMemberRequest::KickMemberRequest(
-    ::google::protobuf::Arena* arena,
-    const KickMemberRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  KickMemberRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.KickMemberRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE KickMemberRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        kick_uids_{visibility, arena},
-        group_id_(arena) {}
-
-inline void KickMemberRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.header_ = {};
-}
-KickMemberRequest::~KickMemberRequest() {
-  // @@protoc_insertion_point(destructor:im.group.KickMemberRequest)
-  SharedDtor(*this);
-}
-inline void KickMemberRequest::SharedDtor(MessageLite& self) {
-  KickMemberRequest& this_ = static_cast<KickMemberRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* KickMemberRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) KickMemberRequest(arena);
-}
-constexpr auto KickMemberRequest::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_.kick_uids_) +
-          decltype(KickMemberRequest::_impl_.kick_uids_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::CopyInit(
-        sizeof(KickMemberRequest), alignof(KickMemberRequest), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&KickMemberRequest::PlacementNew_,
-                                 sizeof(KickMemberRequest),
-                                 alignof(KickMemberRequest));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull KickMemberRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_KickMemberRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &KickMemberRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<KickMemberRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &KickMemberRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<KickMemberRequest>(), &KickMemberRequest::ByteSizeLong,
-            &KickMemberRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_._cached_size_),
-        false,
-    },
-    &KickMemberRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* KickMemberRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 52, 2> KickMemberRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::KickMemberRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_.header_)}},
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_.group_id_)}},
-    // repeated string kick_uids = 3;
-    {::_pbi::TcParser::FastUR1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_.kick_uids_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // repeated string kick_uids = 3;
-    {PROTOBUF_FIELD_OFFSET(KickMemberRequest, _impl_.kick_uids_), -1, 0,
-    (0 | ::_fl::kFcRepeated | ::_fl::kUtf8String | ::_fl::kRepSString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\32\0\10\11\0\0\0\0"
-    "im.group.KickMemberRequest"
-    "group_id"
-    "kick_uids"
-  }},
-};
-
-PROTOBUF_NOINLINE void KickMemberRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.KickMemberRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.kick_uids_.Clear();
-  _impl_.group_id_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* KickMemberRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const KickMemberRequest& this_ = static_cast<const KickMemberRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* KickMemberRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const KickMemberRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.KickMemberRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.KickMemberRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // repeated string kick_uids = 3;
-          for (int i = 0, n = this_._internal_kick_uids_size(); i < n; ++i) {
-            const auto& s = this_._internal_kick_uids().Get(i);
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                s.data(), static_cast<int>(s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.KickMemberRequest.kick_uids");
-            target = stream->WriteString(3, s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.KickMemberRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t KickMemberRequest::ByteSizeLong(const MessageLite& base) {
-          const KickMemberRequest& this_ = static_cast<const KickMemberRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t KickMemberRequest::ByteSizeLong() const {
-          const KickMemberRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.KickMemberRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated string kick_uids = 3;
-            {
-              total_size +=
-                  1 * ::google::protobuf::internal::FromIntSize(this_._internal_kick_uids().size());
-              for (int i = 0, n = this_._internal_kick_uids().size(); i < n; ++i) {
-                total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-                    this_._internal_kick_uids().Get(i));
-              }
-            }
-          }
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void KickMemberRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<KickMemberRequest*>(&to_msg);
-  auto& from = static_cast<const KickMemberRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.KickMemberRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_kick_uids()->MergeFrom(from._internal_kick_uids());
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void KickMemberRequest::CopyFrom(const KickMemberRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.KickMemberRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void KickMemberRequest::InternalSwap(KickMemberRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.kick_uids_.InternalSwap(&other->_impl_.kick_uids_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  swap(_impl_.header_, other->_impl_.header_);
-}
-
-::google::protobuf::Metadata KickMemberRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class KickMemberResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<KickMemberResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(KickMemberResponse, _impl_._has_bits_);
-};
-
-void KickMemberResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-KickMemberResponse::KickMemberResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.KickMemberResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE KickMemberResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::KickMemberResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-KickMemberResponse::KickMemberResponse(
-    ::google::protobuf::Arena* arena,
-    const KickMemberResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  KickMemberResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.KickMemberResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE KickMemberResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void KickMemberResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-KickMemberResponse::~KickMemberResponse() {
-  // @@protoc_insertion_point(destructor:im.group.KickMemberResponse)
-  SharedDtor(*this);
-}
-inline void KickMemberResponse::SharedDtor(MessageLite& self) {
-  KickMemberResponse& this_ = static_cast<KickMemberResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* KickMemberResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) KickMemberResponse(arena);
-}
-constexpr auto KickMemberResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(KickMemberResponse),
-                                            alignof(KickMemberResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull KickMemberResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_KickMemberResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &KickMemberResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<KickMemberResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &KickMemberResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<KickMemberResponse>(), &KickMemberResponse::ByteSizeLong,
-            &KickMemberResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(KickMemberResponse, _impl_._cached_size_),
-        false,
-    },
-    &KickMemberResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* KickMemberResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> KickMemberResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(KickMemberResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::KickMemberResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(KickMemberResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(KickMemberResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void KickMemberResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.KickMemberResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* KickMemberResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const KickMemberResponse& this_ = static_cast<const KickMemberResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* KickMemberResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const KickMemberResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.KickMemberResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.KickMemberResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t KickMemberResponse::ByteSizeLong(const MessageLite& base) {
-          const KickMemberResponse& this_ = static_cast<const KickMemberResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t KickMemberResponse::ByteSizeLong() const {
-          const KickMemberResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.KickMemberResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void KickMemberResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<KickMemberResponse*>(&to_msg);
-  auto& from = static_cast<const KickMemberResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.KickMemberResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void KickMemberResponse::CopyFrom(const KickMemberResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.KickMemberResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void KickMemberResponse::InternalSwap(KickMemberResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata KickMemberResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ApplyJoinGroupRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<ApplyJoinGroupRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ApplyJoinGroupRequest, _impl_._has_bits_);
-};
-
-void ApplyJoinGroupRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-ApplyJoinGroupRequest::ApplyJoinGroupRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.ApplyJoinGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ApplyJoinGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::ApplyJoinGroupRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        group_id_(arena, from.group_id_),
-        apply_msg_(arena, from.apply_msg_) {}
-
-ApplyJoinGroupRequest::ApplyJoinGroupRequest(
-    ::google::protobuf::Arena* arena,
-    const ApplyJoinGroupRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ApplyJoinGroupRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.ApplyJoinGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE ApplyJoinGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        group_id_(arena),
-        apply_msg_(arena) {}
-
-inline void ApplyJoinGroupRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.header_ = {};
-}
-ApplyJoinGroupRequest::~ApplyJoinGroupRequest() {
-  // @@protoc_insertion_point(destructor:im.group.ApplyJoinGroupRequest)
-  SharedDtor(*this);
-}
-inline void ApplyJoinGroupRequest::SharedDtor(MessageLite& self) {
-  ApplyJoinGroupRequest& this_ = static_cast<ApplyJoinGroupRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  this_._impl_.apply_msg_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* ApplyJoinGroupRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ApplyJoinGroupRequest(arena);
-}
-constexpr auto ApplyJoinGroupRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(ApplyJoinGroupRequest),
-                                            alignof(ApplyJoinGroupRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ApplyJoinGroupRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ApplyJoinGroupRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ApplyJoinGroupRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ApplyJoinGroupRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ApplyJoinGroupRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ApplyJoinGroupRequest>(), &ApplyJoinGroupRequest::ByteSizeLong,
-            &ApplyJoinGroupRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ApplyJoinGroupRequest, _impl_._cached_size_),
-        false,
-    },
-    &ApplyJoinGroupRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ApplyJoinGroupRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 56, 2> ApplyJoinGroupRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ApplyJoinGroupRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::ApplyJoinGroupRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ApplyJoinGroupRequest, _impl_.header_)}},
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(ApplyJoinGroupRequest, _impl_.group_id_)}},
-    // string apply_msg = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(ApplyJoinGroupRequest, _impl_.apply_msg_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(ApplyJoinGroupRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(ApplyJoinGroupRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string apply_msg = 3;
-    {PROTOBUF_FIELD_OFFSET(ApplyJoinGroupRequest, _impl_.apply_msg_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\36\0\10\11\0\0\0\0"
-    "im.group.ApplyJoinGroupRequest"
-    "group_id"
-    "apply_msg"
-  }},
-};
-
-PROTOBUF_NOINLINE void ApplyJoinGroupRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.ApplyJoinGroupRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_.ClearToEmpty();
-  _impl_.apply_msg_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ApplyJoinGroupRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ApplyJoinGroupRequest& this_ = static_cast<const ApplyJoinGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ApplyJoinGroupRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ApplyJoinGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.ApplyJoinGroupRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.ApplyJoinGroupRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string apply_msg = 3;
-          if (!this_._internal_apply_msg().empty()) {
-            const std::string& _s = this_._internal_apply_msg();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.ApplyJoinGroupRequest.apply_msg");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.ApplyJoinGroupRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ApplyJoinGroupRequest::ByteSizeLong(const MessageLite& base) {
-          const ApplyJoinGroupRequest& this_ = static_cast<const ApplyJoinGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ApplyJoinGroupRequest::ByteSizeLong() const {
-          const ApplyJoinGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.ApplyJoinGroupRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-            // string apply_msg = 3;
-            if (!this_._internal_apply_msg().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_apply_msg());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ApplyJoinGroupRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ApplyJoinGroupRequest*>(&to_msg);
-  auto& from = static_cast<const ApplyJoinGroupRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.ApplyJoinGroupRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  if (!from._internal_apply_msg().empty()) {
-    _this->_internal_set_apply_msg(from._internal_apply_msg());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ApplyJoinGroupRequest::CopyFrom(const ApplyJoinGroupRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.ApplyJoinGroupRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ApplyJoinGroupRequest::InternalSwap(ApplyJoinGroupRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.apply_msg_, &other->_impl_.apply_msg_, arena);
-  swap(_impl_.header_, other->_impl_.header_);
-}
-
-::google::protobuf::Metadata ApplyJoinGroupRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class ApplyJoinGroupResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<ApplyJoinGroupResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(ApplyJoinGroupResponse, _impl_._has_bits_);
-};
-
-void ApplyJoinGroupResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-ApplyJoinGroupResponse::ApplyJoinGroupResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.ApplyJoinGroupResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ApplyJoinGroupResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::ApplyJoinGroupResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-ApplyJoinGroupResponse::ApplyJoinGroupResponse(
-    ::google::protobuf::Arena* arena,
-    const ApplyJoinGroupResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  ApplyJoinGroupResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.ApplyJoinGroupResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE ApplyJoinGroupResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void ApplyJoinGroupResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-ApplyJoinGroupResponse::~ApplyJoinGroupResponse() {
-  // @@protoc_insertion_point(destructor:im.group.ApplyJoinGroupResponse)
-  SharedDtor(*this);
-}
-inline void ApplyJoinGroupResponse::SharedDtor(MessageLite& self) {
-  ApplyJoinGroupResponse& this_ = static_cast<ApplyJoinGroupResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* ApplyJoinGroupResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) ApplyJoinGroupResponse(arena);
-}
-constexpr auto ApplyJoinGroupResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(ApplyJoinGroupResponse),
-                                            alignof(ApplyJoinGroupResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull ApplyJoinGroupResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_ApplyJoinGroupResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &ApplyJoinGroupResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<ApplyJoinGroupResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &ApplyJoinGroupResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<ApplyJoinGroupResponse>(), &ApplyJoinGroupResponse::ByteSizeLong,
-            &ApplyJoinGroupResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(ApplyJoinGroupResponse, _impl_._cached_size_),
-        false,
-    },
-    &ApplyJoinGroupResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* ApplyJoinGroupResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> ApplyJoinGroupResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(ApplyJoinGroupResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::ApplyJoinGroupResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(ApplyJoinGroupResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(ApplyJoinGroupResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void ApplyJoinGroupResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.ApplyJoinGroupResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* ApplyJoinGroupResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const ApplyJoinGroupResponse& this_ = static_cast<const ApplyJoinGroupResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* ApplyJoinGroupResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const ApplyJoinGroupResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.ApplyJoinGroupResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.ApplyJoinGroupResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t ApplyJoinGroupResponse::ByteSizeLong(const MessageLite& base) {
-          const ApplyJoinGroupResponse& this_ = static_cast<const ApplyJoinGroupResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t ApplyJoinGroupResponse::ByteSizeLong() const {
-          const ApplyJoinGroupResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.ApplyJoinGroupResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void ApplyJoinGroupResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<ApplyJoinGroupResponse*>(&to_msg);
-  auto& from = static_cast<const ApplyJoinGroupResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.ApplyJoinGroupResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void ApplyJoinGroupResponse::CopyFrom(const ApplyJoinGroupResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.ApplyJoinGroupResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void ApplyJoinGroupResponse::InternalSwap(ApplyJoinGroupResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata ApplyJoinGroupResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class QuitGroupRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<QuitGroupRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(QuitGroupRequest, _impl_._has_bits_);
-};
-
-void QuitGroupRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-QuitGroupRequest::QuitGroupRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.QuitGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE QuitGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::QuitGroupRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        group_id_(arena, from.group_id_) {}
-
-QuitGroupRequest::QuitGroupRequest(
-    ::google::protobuf::Arena* arena,
-    const QuitGroupRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  QuitGroupRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.QuitGroupRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE QuitGroupRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        group_id_(arena) {}
-
-inline void QuitGroupRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.header_ = {};
-}
-QuitGroupRequest::~QuitGroupRequest() {
-  // @@protoc_insertion_point(destructor:im.group.QuitGroupRequest)
-  SharedDtor(*this);
-}
-inline void QuitGroupRequest::SharedDtor(MessageLite& self) {
-  QuitGroupRequest& this_ = static_cast<QuitGroupRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* QuitGroupRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) QuitGroupRequest(arena);
-}
-constexpr auto QuitGroupRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(QuitGroupRequest),
-                                            alignof(QuitGroupRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull QuitGroupRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_QuitGroupRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &QuitGroupRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<QuitGroupRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &QuitGroupRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<QuitGroupRequest>(), &QuitGroupRequest::ByteSizeLong,
-            &QuitGroupRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(QuitGroupRequest, _impl_._cached_size_),
-        false,
-    },
-    &QuitGroupRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* QuitGroupRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 1, 42, 2> QuitGroupRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(QuitGroupRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::QuitGroupRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(QuitGroupRequest, _impl_.group_id_)}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(QuitGroupRequest, _impl_.header_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(QuitGroupRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(QuitGroupRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\31\0\10\0\0\0\0\0"
-    "im.group.QuitGroupRequest"
-    "group_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void QuitGroupRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.QuitGroupRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* QuitGroupRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const QuitGroupRequest& this_ = static_cast<const QuitGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* QuitGroupRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const QuitGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.QuitGroupRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.QuitGroupRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.QuitGroupRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t QuitGroupRequest::ByteSizeLong(const MessageLite& base) {
-          const QuitGroupRequest& this_ = static_cast<const QuitGroupRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t QuitGroupRequest::ByteSizeLong() const {
-          const QuitGroupRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.QuitGroupRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void QuitGroupRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<QuitGroupRequest*>(&to_msg);
-  auto& from = static_cast<const QuitGroupRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.QuitGroupRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void QuitGroupRequest::CopyFrom(const QuitGroupRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.QuitGroupRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void QuitGroupRequest::InternalSwap(QuitGroupRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  swap(_impl_.header_, other->_impl_.header_);
-}
-
-::google::protobuf::Metadata QuitGroupRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class QuitGroupResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<QuitGroupResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(QuitGroupResponse, _impl_._has_bits_);
-};
-
-void QuitGroupResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-QuitGroupResponse::QuitGroupResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.QuitGroupResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE QuitGroupResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::QuitGroupResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-QuitGroupResponse::QuitGroupResponse(
-    ::google::protobuf::Arena* arena,
-    const QuitGroupResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  QuitGroupResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.QuitGroupResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE QuitGroupResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void QuitGroupResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-QuitGroupResponse::~QuitGroupResponse() {
-  // @@protoc_insertion_point(destructor:im.group.QuitGroupResponse)
-  SharedDtor(*this);
-}
-inline void QuitGroupResponse::SharedDtor(MessageLite& self) {
-  QuitGroupResponse& this_ = static_cast<QuitGroupResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* QuitGroupResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) QuitGroupResponse(arena);
-}
-constexpr auto QuitGroupResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(QuitGroupResponse),
-                                            alignof(QuitGroupResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull QuitGroupResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_QuitGroupResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &QuitGroupResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<QuitGroupResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &QuitGroupResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<QuitGroupResponse>(), &QuitGroupResponse::ByteSizeLong,
-            &QuitGroupResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(QuitGroupResponse, _impl_._cached_size_),
-        false,
-    },
-    &QuitGroupResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* QuitGroupResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> QuitGroupResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(QuitGroupResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::QuitGroupResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(QuitGroupResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(QuitGroupResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void QuitGroupResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.QuitGroupResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* QuitGroupResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const QuitGroupResponse& this_ = static_cast<const QuitGroupResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* QuitGroupResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const QuitGroupResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.QuitGroupResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.QuitGroupResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t QuitGroupResponse::ByteSizeLong(const MessageLite& base) {
-          const QuitGroupResponse& this_ = static_cast<const QuitGroupResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t QuitGroupResponse::ByteSizeLong() const {
-          const QuitGroupResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.QuitGroupResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void QuitGroupResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<QuitGroupResponse*>(&to_msg);
-  auto& from = static_cast<const QuitGroupResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.QuitGroupResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void QuitGroupResponse::CopyFrom(const QuitGroupResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.QuitGroupResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void QuitGroupResponse::InternalSwap(QuitGroupResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata QuitGroupResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetGroupMembersRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetGroupMembersRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_._has_bits_);
-};
-
-void GetGroupMembersRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetGroupMembersRequest::GetGroupMembersRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GetGroupMembersRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupMembersRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GetGroupMembersRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        group_id_(arena, from.group_id_) {}
-
-GetGroupMembersRequest::GetGroupMembersRequest(
-    ::google::protobuf::Arena* arena,
-    const GetGroupMembersRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetGroupMembersRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.group_record_id_ = from._impl_.group_record_id_;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GetGroupMembersRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupMembersRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        group_id_(arena) {}
-
-inline void GetGroupMembersRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, group_record_id_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::group_record_id_));
-}
-GetGroupMembersRequest::~GetGroupMembersRequest() {
-  // @@protoc_insertion_point(destructor:im.group.GetGroupMembersRequest)
-  SharedDtor(*this);
-}
-inline void GetGroupMembersRequest::SharedDtor(MessageLite& self) {
-  GetGroupMembersRequest& this_ = static_cast<GetGroupMembersRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetGroupMembersRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetGroupMembersRequest(arena);
-}
-constexpr auto GetGroupMembersRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetGroupMembersRequest),
-                                            alignof(GetGroupMembersRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetGroupMembersRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetGroupMembersRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetGroupMembersRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetGroupMembersRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetGroupMembersRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetGroupMembersRequest>(), &GetGroupMembersRequest::ByteSizeLong,
-            &GetGroupMembersRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetGroupMembersRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetGroupMembersRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 48, 2> GetGroupMembersRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GetGroupMembersRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_.header_)}},
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_.group_id_)}},
-    // uint64 group_record_id = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GetGroupMembersRequest, _impl_.group_record_id_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_.group_record_id_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // uint64 group_record_id = 3;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_.group_record_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\37\0\10\0\0\0\0\0"
-    "im.group.GetGroupMembersRequest"
-    "group_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetGroupMembersRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GetGroupMembersRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_.group_record_id_ = ::uint64_t{0u};
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetGroupMembersRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetGroupMembersRequest& this_ = static_cast<const GetGroupMembersRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetGroupMembersRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetGroupMembersRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GetGroupMembersRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GetGroupMembersRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // uint64 group_record_id = 3;
-          if (this_._internal_group_record_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                3, this_._internal_group_record_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GetGroupMembersRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetGroupMembersRequest::ByteSizeLong(const MessageLite& base) {
-          const GetGroupMembersRequest& this_ = static_cast<const GetGroupMembersRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetGroupMembersRequest::ByteSizeLong() const {
-          const GetGroupMembersRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GetGroupMembersRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // uint64 group_record_id = 3;
-            if (this_._internal_group_record_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_record_id());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetGroupMembersRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetGroupMembersRequest*>(&to_msg);
-  auto& from = static_cast<const GetGroupMembersRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GetGroupMembersRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_group_record_id() != 0) {
-    _this->_impl_.group_record_id_ = from._impl_.group_record_id_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetGroupMembersRequest::CopyFrom(const GetGroupMembersRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GetGroupMembersRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetGroupMembersRequest::InternalSwap(GetGroupMembersRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_.group_record_id_)
-      + sizeof(GetGroupMembersRequest::_impl_.group_record_id_)
-      - PROTOBUF_FIELD_OFFSET(GetGroupMembersRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata GetGroupMembersRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetGroupMembersResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetGroupMembersResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetGroupMembersResponse, _impl_._has_bits_);
-};
-
-void GetGroupMembersResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetGroupMembersResponse::GetGroupMembersResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GetGroupMembersResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupMembersResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GetGroupMembersResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        members_{visibility, arena, from.members_} {}
-
-GetGroupMembersResponse::GetGroupMembersResponse(
-    ::google::protobuf::Arena* arena,
-    const GetGroupMembersResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetGroupMembersResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GetGroupMembersResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupMembersResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        members_{visibility, arena} {}
-
-inline void GetGroupMembersResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-GetGroupMembersResponse::~GetGroupMembersResponse() {
-  // @@protoc_insertion_point(destructor:im.group.GetGroupMembersResponse)
-  SharedDtor(*this);
-}
-inline void GetGroupMembersResponse::SharedDtor(MessageLite& self) {
-  GetGroupMembersResponse& this_ = static_cast<GetGroupMembersResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetGroupMembersResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetGroupMembersResponse(arena);
-}
-constexpr auto GetGroupMembersResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(GetGroupMembersResponse, _impl_.members_) +
-          decltype(GetGroupMembersResponse::_impl_.members_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(GetGroupMembersResponse), alignof(GetGroupMembersResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&GetGroupMembersResponse::PlacementNew_,
-                                 sizeof(GetGroupMembersResponse),
-                                 alignof(GetGroupMembersResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetGroupMembersResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetGroupMembersResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetGroupMembersResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetGroupMembersResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetGroupMembersResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetGroupMembersResponse>(), &GetGroupMembersResponse::ByteSizeLong,
-            &GetGroupMembersResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetGroupMembersResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetGroupMembersResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetGroupMembersResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> GetGroupMembersResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetGroupMembersResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GetGroupMembersResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .im.group.GroupMember members = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 1, PROTOBUF_FIELD_OFFSET(GetGroupMembersResponse, _impl_.members_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetGroupMembersResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMembersResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .im.group.GroupMember members = 2;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMembersResponse, _impl_.members_), -1, 1,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::group::GroupMember>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GetGroupMembersResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GetGroupMembersResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.members_.Clear();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetGroupMembersResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetGroupMembersResponse& this_ = static_cast<const GetGroupMembersResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetGroupMembersResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetGroupMembersResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GetGroupMembersResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // repeated .im.group.GroupMember members = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_members_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_members().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GetGroupMembersResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetGroupMembersResponse::ByteSizeLong(const MessageLite& base) {
-          const GetGroupMembersResponse& this_ = static_cast<const GetGroupMembersResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetGroupMembersResponse::ByteSizeLong() const {
-          const GetGroupMembersResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GetGroupMembersResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .im.group.GroupMember members = 2;
-            {
-              total_size += 1UL * this_._internal_members_size();
-              for (const auto& msg : this_._internal_members()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetGroupMembersResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetGroupMembersResponse*>(&to_msg);
-  auto& from = static_cast<const GetGroupMembersResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GetGroupMembersResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_members()->MergeFrom(
-      from._internal_members());
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetGroupMembersResponse::CopyFrom(const GetGroupMembersResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GetGroupMembersResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetGroupMembersResponse::InternalSwap(GetGroupMembersResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.members_.InternalSwap(&other->_impl_.members_);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata GetGroupMembersResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetGroupMessagesRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetGroupMessagesRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_._has_bits_);
-};
-
-void GetGroupMessagesRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetGroupMessagesRequest::GetGroupMessagesRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GetGroupMessagesRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupMessagesRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GetGroupMessagesRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        group_id_(arena, from.group_id_) {}
-
-GetGroupMessagesRequest::GetGroupMessagesRequest(
-    ::google::protobuf::Arena* arena,
-    const GetGroupMessagesRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetGroupMessagesRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, since_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, since_),
-           offsetof(Impl_, limit_) -
-               offsetof(Impl_, since_) +
-               sizeof(Impl_::limit_));
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GetGroupMessagesRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupMessagesRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        group_id_(arena) {}
-
-inline void GetGroupMessagesRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, limit_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::limit_));
-}
-GetGroupMessagesRequest::~GetGroupMessagesRequest() {
-  // @@protoc_insertion_point(destructor:im.group.GetGroupMessagesRequest)
-  SharedDtor(*this);
-}
-inline void GetGroupMessagesRequest::SharedDtor(MessageLite& self) {
-  GetGroupMessagesRequest& this_ = static_cast<GetGroupMessagesRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetGroupMessagesRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetGroupMessagesRequest(arena);
-}
-constexpr auto GetGroupMessagesRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetGroupMessagesRequest),
-                                            alignof(GetGroupMessagesRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetGroupMessagesRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetGroupMessagesRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetGroupMessagesRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetGroupMessagesRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetGroupMessagesRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetGroupMessagesRequest>(), &GetGroupMessagesRequest::ByteSizeLong,
-            &GetGroupMessagesRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetGroupMessagesRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetGroupMessagesRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 5, 1, 49, 2> GetGroupMessagesRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    5, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967264,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    5,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GetGroupMessagesRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.header_)}},
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.group_id_)}},
-    // int64 since = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GetGroupMessagesRequest, _impl_.since_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.since_)}},
-    // int32 limit = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(GetGroupMessagesRequest, _impl_.limit_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.limit_)}},
-    // uint64 group_record_id = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(GetGroupMessagesRequest, _impl_.group_record_id_), 63>(),
-     {40, 63, 0, PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.group_record_id_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int64 since = 3;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.since_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // int32 limit = 4;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.limit_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-    // uint64 group_record_id = 5;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.group_record_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\40\0\10\0\0\0\0\0"
-    "im.group.GetGroupMessagesRequest"
-    "group_id"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetGroupMessagesRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GetGroupMessagesRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  ::memset(&_impl_.since_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.limit_) -
-      reinterpret_cast<char*>(&_impl_.since_)) + sizeof(_impl_.limit_));
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetGroupMessagesRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetGroupMessagesRequest& this_ = static_cast<const GetGroupMessagesRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetGroupMessagesRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetGroupMessagesRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GetGroupMessagesRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.GetGroupMessagesRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // int64 since = 3;
-          if (this_._internal_since() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<3>(
-                    stream, this_._internal_since(), target);
-          }
-
-          // int32 limit = 4;
-          if (this_._internal_limit() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<4>(
-                    stream, this_._internal_limit(), target);
-          }
-
-          // uint64 group_record_id = 5;
-          if (this_._internal_group_record_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                5, this_._internal_group_record_id(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GetGroupMessagesRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetGroupMessagesRequest::ByteSizeLong(const MessageLite& base) {
-          const GetGroupMessagesRequest& this_ = static_cast<const GetGroupMessagesRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetGroupMessagesRequest::ByteSizeLong() const {
-          const GetGroupMessagesRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GetGroupMessagesRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // int64 since = 3;
-            if (this_._internal_since() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_since());
-            }
-            // uint64 group_record_id = 5;
-            if (this_._internal_group_record_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_record_id());
-            }
-            // int32 limit = 4;
-            if (this_._internal_limit() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_limit());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetGroupMessagesRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetGroupMessagesRequest*>(&to_msg);
-  auto& from = static_cast<const GetGroupMessagesRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GetGroupMessagesRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_since() != 0) {
-    _this->_impl_.since_ = from._impl_.since_;
-  }
-  if (from._internal_group_record_id() != 0) {
-    _this->_impl_.group_record_id_ = from._impl_.group_record_id_;
-  }
-  if (from._internal_limit() != 0) {
-    _this->_impl_.limit_ = from._impl_.limit_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetGroupMessagesRequest::CopyFrom(const GetGroupMessagesRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GetGroupMessagesRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetGroupMessagesRequest::InternalSwap(GetGroupMessagesRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.limit_)
-      + sizeof(GetGroupMessagesRequest::_impl_.limit_)
-      - PROTOBUF_FIELD_OFFSET(GetGroupMessagesRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata GetGroupMessagesRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetGroupMessagesResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetGroupMessagesResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetGroupMessagesResponse, _impl_._has_bits_);
-};
-
-void GetGroupMessagesResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetGroupMessagesResponse::GetGroupMessagesResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.GetGroupMessagesResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupMessagesResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::GetGroupMessagesResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        messages_{visibility, arena, from.messages_} {}
-
-GetGroupMessagesResponse::GetGroupMessagesResponse(
-    ::google::protobuf::Arena* arena,
-    const GetGroupMessagesResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetGroupMessagesResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.GetGroupMessagesResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetGroupMessagesResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        messages_{visibility, arena} {}
-
-inline void GetGroupMessagesResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-GetGroupMessagesResponse::~GetGroupMessagesResponse() {
-  // @@protoc_insertion_point(destructor:im.group.GetGroupMessagesResponse)
-  SharedDtor(*this);
-}
-inline void GetGroupMessagesResponse::SharedDtor(MessageLite& self) {
-  GetGroupMessagesResponse& this_ = static_cast<GetGroupMessagesResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetGroupMessagesResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetGroupMessagesResponse(arena);
-}
-constexpr auto GetGroupMessagesResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(GetGroupMessagesResponse, _impl_.messages_) +
-          decltype(GetGroupMessagesResponse::_impl_.messages_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(GetGroupMessagesResponse), alignof(GetGroupMessagesResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&GetGroupMessagesResponse::PlacementNew_,
-                                 sizeof(GetGroupMessagesResponse),
-                                 alignof(GetGroupMessagesResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetGroupMessagesResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetGroupMessagesResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetGroupMessagesResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetGroupMessagesResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetGroupMessagesResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetGroupMessagesResponse>(), &GetGroupMessagesResponse::ByteSizeLong,
-            &GetGroupMessagesResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetGroupMessagesResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetGroupMessagesResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetGroupMessagesResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> GetGroupMessagesResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetGroupMessagesResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::GetGroupMessagesResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .im.group.GroupMessage messages = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 1, PROTOBUF_FIELD_OFFSET(GetGroupMessagesResponse, _impl_.messages_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetGroupMessagesResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMessagesResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .im.group.GroupMessage messages = 2;
-    {PROTOBUF_FIELD_OFFSET(GetGroupMessagesResponse, _impl_.messages_), -1, 1,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::group::GroupMessage>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GetGroupMessagesResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.GetGroupMessagesResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.messages_.Clear();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetGroupMessagesResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetGroupMessagesResponse& this_ = static_cast<const GetGroupMessagesResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetGroupMessagesResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetGroupMessagesResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.GetGroupMessagesResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // repeated .im.group.GroupMessage messages = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_messages_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_messages().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.GetGroupMessagesResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetGroupMessagesResponse::ByteSizeLong(const MessageLite& base) {
-          const GetGroupMessagesResponse& this_ = static_cast<const GetGroupMessagesResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetGroupMessagesResponse::ByteSizeLong() const {
-          const GetGroupMessagesResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.GetGroupMessagesResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .im.group.GroupMessage messages = 2;
-            {
-              total_size += 1UL * this_._internal_messages_size();
-              for (const auto& msg : this_._internal_messages()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetGroupMessagesResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetGroupMessagesResponse*>(&to_msg);
-  auto& from = static_cast<const GetGroupMessagesResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.GetGroupMessagesResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_messages()->MergeFrom(
-      from._internal_messages());
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetGroupMessagesResponse::CopyFrom(const GetGroupMessagesResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.GetGroupMessagesResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetGroupMessagesResponse::InternalSwap(GetGroupMessagesResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata GetGroupMessagesResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SendGroupMessageRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<SendGroupMessageRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_._has_bits_);
-};
-
-void SendGroupMessageRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-SendGroupMessageRequest::SendGroupMessageRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.SendGroupMessageRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SendGroupMessageRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::SendGroupMessageRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        content_(arena, from.content_) {}
-
-SendGroupMessageRequest::SendGroupMessageRequest(
-    ::google::protobuf::Arena* arena,
-    const SendGroupMessageRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SendGroupMessageRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, group_id_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, group_id_),
-           offsetof(Impl_, create_time_) -
-               offsetof(Impl_, group_id_) +
-               sizeof(Impl_::create_time_));
-
-  // @@protoc_insertion_point(copy_constructor:im.group.SendGroupMessageRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SendGroupMessageRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        content_(arena) {}
-
-inline void SendGroupMessageRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, create_time_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::create_time_));
-}
-SendGroupMessageRequest::~SendGroupMessageRequest() {
-  // @@protoc_insertion_point(destructor:im.group.SendGroupMessageRequest)
-  SharedDtor(*this);
-}
-inline void SendGroupMessageRequest::SharedDtor(MessageLite& self) {
-  SendGroupMessageRequest& this_ = static_cast<SendGroupMessageRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.content_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* SendGroupMessageRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SendGroupMessageRequest(arena);
-}
-constexpr auto SendGroupMessageRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(SendGroupMessageRequest),
-                                            alignof(SendGroupMessageRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SendGroupMessageRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SendGroupMessageRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SendGroupMessageRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SendGroupMessageRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SendGroupMessageRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SendGroupMessageRequest>(), &SendGroupMessageRequest::ByteSizeLong,
-            &SendGroupMessageRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_._cached_size_),
-        false,
-    },
-    &SendGroupMessageRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SendGroupMessageRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 48, 2> SendGroupMessageRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::SendGroupMessageRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // int64 create_time = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(SendGroupMessageRequest, _impl_.create_time_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.create_time_)}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.header_)}},
-    // uint64 group_id = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(SendGroupMessageRequest, _impl_.group_id_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.group_id_)}},
-    // string content = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.content_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // uint64 group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUInt64)},
-    // string content = 3;
-    {PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.content_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int64 create_time = 4;
-    {PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.create_time_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\40\0\0\7\0\0\0\0"
-    "im.group.SendGroupMessageRequest"
-    "content"
-  }},
-};
-
-PROTOBUF_NOINLINE void SendGroupMessageRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.SendGroupMessageRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.content_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  ::memset(&_impl_.group_id_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.create_time_) -
-      reinterpret_cast<char*>(&_impl_.group_id_)) + sizeof(_impl_.create_time_));
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SendGroupMessageRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SendGroupMessageRequest& this_ = static_cast<const SendGroupMessageRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SendGroupMessageRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SendGroupMessageRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.SendGroupMessageRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // uint64 group_id = 2;
-          if (this_._internal_group_id() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteUInt64ToArray(
-                2, this_._internal_group_id(), target);
-          }
-
-          // string content = 3;
-          if (!this_._internal_content().empty()) {
-            const std::string& _s = this_._internal_content();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.SendGroupMessageRequest.content");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // int64 create_time = 4;
-          if (this_._internal_create_time() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<4>(
-                    stream, this_._internal_create_time(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.SendGroupMessageRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SendGroupMessageRequest::ByteSizeLong(const MessageLite& base) {
-          const SendGroupMessageRequest& this_ = static_cast<const SendGroupMessageRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SendGroupMessageRequest::ByteSizeLong() const {
-          const SendGroupMessageRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.SendGroupMessageRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string content = 3;
-            if (!this_._internal_content().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_content());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // uint64 group_id = 2;
-            if (this_._internal_group_id() != 0) {
-              total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(
-                  this_._internal_group_id());
-            }
-            // int64 create_time = 4;
-            if (this_._internal_create_time() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_create_time());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SendGroupMessageRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SendGroupMessageRequest*>(&to_msg);
-  auto& from = static_cast<const SendGroupMessageRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.SendGroupMessageRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_content().empty()) {
-    _this->_internal_set_content(from._internal_content());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_group_id() != 0) {
-    _this->_impl_.group_id_ = from._impl_.group_id_;
-  }
-  if (from._internal_create_time() != 0) {
-    _this->_impl_.create_time_ = from._impl_.create_time_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SendGroupMessageRequest::CopyFrom(const SendGroupMessageRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.SendGroupMessageRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SendGroupMessageRequest::InternalSwap(SendGroupMessageRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.content_, &other->_impl_.content_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.create_time_)
-      + sizeof(SendGroupMessageRequest::_impl_.create_time_)
-      - PROTOBUF_FIELD_OFFSET(SendGroupMessageRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata SendGroupMessageRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SendGroupMessageResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<SendGroupMessageResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(SendGroupMessageResponse, _impl_._has_bits_);
-};
-
-void SendGroupMessageResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-SendGroupMessageResponse::SendGroupMessageResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.SendGroupMessageResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SendGroupMessageResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::SendGroupMessageResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-SendGroupMessageResponse::SendGroupMessageResponse(
-    ::google::protobuf::Arena* arena,
-    const SendGroupMessageResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SendGroupMessageResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-  _impl_.message_ = (cached_has_bits & 0x00000002u) ? ::google::protobuf::Message::CopyConstruct<::im::group::GroupMessage>(
-                              arena, *from._impl_.message_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.SendGroupMessageResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SendGroupMessageResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void SendGroupMessageResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, base_),
-           0,
-           offsetof(Impl_, message_) -
-               offsetof(Impl_, base_) +
-               sizeof(Impl_::message_));
-}
-SendGroupMessageResponse::~SendGroupMessageResponse() {
-  // @@protoc_insertion_point(destructor:im.group.SendGroupMessageResponse)
-  SharedDtor(*this);
-}
-inline void SendGroupMessageResponse::SharedDtor(MessageLite& self) {
-  SendGroupMessageResponse& this_ = static_cast<SendGroupMessageResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  delete this_._impl_.message_;
-  this_._impl_.~Impl_();
-}
-
-inline void* SendGroupMessageResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SendGroupMessageResponse(arena);
-}
-constexpr auto SendGroupMessageResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(SendGroupMessageResponse),
-                                            alignof(SendGroupMessageResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SendGroupMessageResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SendGroupMessageResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SendGroupMessageResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SendGroupMessageResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SendGroupMessageResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SendGroupMessageResponse>(), &SendGroupMessageResponse::ByteSizeLong,
-            &SendGroupMessageResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SendGroupMessageResponse, _impl_._cached_size_),
-        false,
-    },
-    &SendGroupMessageResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SendGroupMessageResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> SendGroupMessageResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(SendGroupMessageResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::SendGroupMessageResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.group.GroupMessage message = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(SendGroupMessageResponse, _impl_.message_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SendGroupMessageResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(SendGroupMessageResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.group.GroupMessage message = 2;
-    {PROTOBUF_FIELD_OFFSET(SendGroupMessageResponse, _impl_.message_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::group::GroupMessage>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void SendGroupMessageResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.SendGroupMessageResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.base_ != nullptr);
-      _impl_.base_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.message_ != nullptr);
-      _impl_.message_->Clear();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SendGroupMessageResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SendGroupMessageResponse& this_ = static_cast<const SendGroupMessageResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SendGroupMessageResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SendGroupMessageResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.SendGroupMessageResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.group.GroupMessage message = 2;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.message_, this_._impl_.message_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.SendGroupMessageResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SendGroupMessageResponse::ByteSizeLong(const MessageLite& base) {
-          const SendGroupMessageResponse& this_ = static_cast<const SendGroupMessageResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SendGroupMessageResponse::ByteSizeLong() const {
-          const SendGroupMessageResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.SendGroupMessageResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // .im.base.BaseResponse base = 1;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-            // .im.group.GroupMessage message = 2;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.message_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SendGroupMessageResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SendGroupMessageResponse*>(&to_msg);
-  auto& from = static_cast<const SendGroupMessageResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.SendGroupMessageResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(from._impl_.base_ != nullptr);
-      if (_this->_impl_.base_ == nullptr) {
-        _this->_impl_.base_ =
-            ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-      } else {
-        _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-      }
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(from._impl_.message_ != nullptr);
-      if (_this->_impl_.message_ == nullptr) {
-        _this->_impl_.message_ =
-            ::google::protobuf::Message::CopyConstruct<::im::group::GroupMessage>(arena, *from._impl_.message_);
-      } else {
-        _this->_impl_.message_->MergeFrom(*from._impl_.message_);
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SendGroupMessageResponse::CopyFrom(const SendGroupMessageResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.SendGroupMessageResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SendGroupMessageResponse::InternalSwap(SendGroupMessageResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SendGroupMessageResponse, _impl_.message_)
-      + sizeof(SendGroupMessageResponse::_impl_.message_)
-      - PROTOBUF_FIELD_OFFSET(SendGroupMessageResponse, _impl_.base_)>(
-          reinterpret_cast<char*>(&_impl_.base_),
-          reinterpret_cast<char*>(&other->_impl_.base_));
-}
-
-::google::protobuf::Metadata SendGroupMessageResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class TransferGroupOwnerRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<TransferGroupOwnerRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(TransferGroupOwnerRequest, _impl_._has_bits_);
-};
-
-void TransferGroupOwnerRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-TransferGroupOwnerRequest::TransferGroupOwnerRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.TransferGroupOwnerRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE TransferGroupOwnerRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::TransferGroupOwnerRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        group_id_(arena, from.group_id_),
-        new_owner_uid_(arena, from.new_owner_uid_) {}
-
-TransferGroupOwnerRequest::TransferGroupOwnerRequest(
-    ::google::protobuf::Arena* arena,
-    const TransferGroupOwnerRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TransferGroupOwnerRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.TransferGroupOwnerRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE TransferGroupOwnerRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        group_id_(arena),
-        new_owner_uid_(arena) {}
-
-inline void TransferGroupOwnerRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.header_ = {};
-}
-TransferGroupOwnerRequest::~TransferGroupOwnerRequest() {
-  // @@protoc_insertion_point(destructor:im.group.TransferGroupOwnerRequest)
-  SharedDtor(*this);
-}
-inline void TransferGroupOwnerRequest::SharedDtor(MessageLite& self) {
-  TransferGroupOwnerRequest& this_ = static_cast<TransferGroupOwnerRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  this_._impl_.new_owner_uid_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* TransferGroupOwnerRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) TransferGroupOwnerRequest(arena);
-}
-constexpr auto TransferGroupOwnerRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(TransferGroupOwnerRequest),
-                                            alignof(TransferGroupOwnerRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull TransferGroupOwnerRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_TransferGroupOwnerRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &TransferGroupOwnerRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<TransferGroupOwnerRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &TransferGroupOwnerRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<TransferGroupOwnerRequest>(), &TransferGroupOwnerRequest::ByteSizeLong,
-            &TransferGroupOwnerRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(TransferGroupOwnerRequest, _impl_._cached_size_),
-        false,
-    },
-    &TransferGroupOwnerRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* TransferGroupOwnerRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 64, 2> TransferGroupOwnerRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(TransferGroupOwnerRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::TransferGroupOwnerRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TransferGroupOwnerRequest, _impl_.header_)}},
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(TransferGroupOwnerRequest, _impl_.group_id_)}},
-    // string new_owner_uid = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(TransferGroupOwnerRequest, _impl_.new_owner_uid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(TransferGroupOwnerRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(TransferGroupOwnerRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string new_owner_uid = 3;
-    {PROTOBUF_FIELD_OFFSET(TransferGroupOwnerRequest, _impl_.new_owner_uid_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\42\0\10\15\0\0\0\0"
-    "im.group.TransferGroupOwnerRequest"
-    "group_id"
-    "new_owner_uid"
-  }},
-};
-
-PROTOBUF_NOINLINE void TransferGroupOwnerRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.TransferGroupOwnerRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_.ClearToEmpty();
-  _impl_.new_owner_uid_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* TransferGroupOwnerRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const TransferGroupOwnerRequest& this_ = static_cast<const TransferGroupOwnerRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* TransferGroupOwnerRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const TransferGroupOwnerRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.TransferGroupOwnerRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.TransferGroupOwnerRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string new_owner_uid = 3;
-          if (!this_._internal_new_owner_uid().empty()) {
-            const std::string& _s = this_._internal_new_owner_uid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.TransferGroupOwnerRequest.new_owner_uid");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.TransferGroupOwnerRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t TransferGroupOwnerRequest::ByteSizeLong(const MessageLite& base) {
-          const TransferGroupOwnerRequest& this_ = static_cast<const TransferGroupOwnerRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t TransferGroupOwnerRequest::ByteSizeLong() const {
-          const TransferGroupOwnerRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.TransferGroupOwnerRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-            // string new_owner_uid = 3;
-            if (!this_._internal_new_owner_uid().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_new_owner_uid());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void TransferGroupOwnerRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<TransferGroupOwnerRequest*>(&to_msg);
-  auto& from = static_cast<const TransferGroupOwnerRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.TransferGroupOwnerRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  if (!from._internal_new_owner_uid().empty()) {
-    _this->_internal_set_new_owner_uid(from._internal_new_owner_uid());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void TransferGroupOwnerRequest::CopyFrom(const TransferGroupOwnerRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.TransferGroupOwnerRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void TransferGroupOwnerRequest::InternalSwap(TransferGroupOwnerRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.new_owner_uid_, &other->_impl_.new_owner_uid_, arena);
-  swap(_impl_.header_, other->_impl_.header_);
-}
-
-::google::protobuf::Metadata TransferGroupOwnerRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class TransferGroupOwnerResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<TransferGroupOwnerResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(TransferGroupOwnerResponse, _impl_._has_bits_);
-};
-
-void TransferGroupOwnerResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-TransferGroupOwnerResponse::TransferGroupOwnerResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.TransferGroupOwnerResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE TransferGroupOwnerResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::TransferGroupOwnerResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-TransferGroupOwnerResponse::TransferGroupOwnerResponse(
-    ::google::protobuf::Arena* arena,
-    const TransferGroupOwnerResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  TransferGroupOwnerResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.TransferGroupOwnerResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE TransferGroupOwnerResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void TransferGroupOwnerResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-TransferGroupOwnerResponse::~TransferGroupOwnerResponse() {
-  // @@protoc_insertion_point(destructor:im.group.TransferGroupOwnerResponse)
-  SharedDtor(*this);
-}
-inline void TransferGroupOwnerResponse::SharedDtor(MessageLite& self) {
-  TransferGroupOwnerResponse& this_ = static_cast<TransferGroupOwnerResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* TransferGroupOwnerResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) TransferGroupOwnerResponse(arena);
-}
-constexpr auto TransferGroupOwnerResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(TransferGroupOwnerResponse),
-                                            alignof(TransferGroupOwnerResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull TransferGroupOwnerResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_TransferGroupOwnerResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &TransferGroupOwnerResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<TransferGroupOwnerResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &TransferGroupOwnerResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<TransferGroupOwnerResponse>(), &TransferGroupOwnerResponse::ByteSizeLong,
-            &TransferGroupOwnerResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(TransferGroupOwnerResponse, _impl_._cached_size_),
-        false,
-    },
-    &TransferGroupOwnerResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* TransferGroupOwnerResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> TransferGroupOwnerResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(TransferGroupOwnerResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::TransferGroupOwnerResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(TransferGroupOwnerResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(TransferGroupOwnerResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void TransferGroupOwnerResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.TransferGroupOwnerResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* TransferGroupOwnerResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const TransferGroupOwnerResponse& this_ = static_cast<const TransferGroupOwnerResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* TransferGroupOwnerResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const TransferGroupOwnerResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.TransferGroupOwnerResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.TransferGroupOwnerResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t TransferGroupOwnerResponse::ByteSizeLong(const MessageLite& base) {
-          const TransferGroupOwnerResponse& this_ = static_cast<const TransferGroupOwnerResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t TransferGroupOwnerResponse::ByteSizeLong() const {
-          const TransferGroupOwnerResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.TransferGroupOwnerResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void TransferGroupOwnerResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<TransferGroupOwnerResponse*>(&to_msg);
-  auto& from = static_cast<const TransferGroupOwnerResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.TransferGroupOwnerResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void TransferGroupOwnerResponse::CopyFrom(const TransferGroupOwnerResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.TransferGroupOwnerResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void TransferGroupOwnerResponse::InternalSwap(TransferGroupOwnerResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata TransferGroupOwnerResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SetGroupAdminRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<SetGroupAdminRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_._has_bits_);
-};
-
-void SetGroupAdminRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-SetGroupAdminRequest::SetGroupAdminRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.SetGroupAdminRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SetGroupAdminRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::SetGroupAdminRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        group_id_(arena, from.group_id_),
-        uid_(arena, from.uid_) {}
-
-SetGroupAdminRequest::SetGroupAdminRequest(
-    ::google::protobuf::Arena* arena,
-    const SetGroupAdminRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SetGroupAdminRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.set_admin_ = from._impl_.set_admin_;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.SetGroupAdminRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SetGroupAdminRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        group_id_(arena),
-        uid_(arena) {}
-
-inline void SetGroupAdminRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, set_admin_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::set_admin_));
-}
-SetGroupAdminRequest::~SetGroupAdminRequest() {
-  // @@protoc_insertion_point(destructor:im.group.SetGroupAdminRequest)
-  SharedDtor(*this);
-}
-inline void SetGroupAdminRequest::SharedDtor(MessageLite& self) {
-  SetGroupAdminRequest& this_ = static_cast<SetGroupAdminRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.group_id_.Destroy();
-  this_._impl_.uid_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* SetGroupAdminRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SetGroupAdminRequest(arena);
-}
-constexpr auto SetGroupAdminRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(SetGroupAdminRequest),
-                                            alignof(SetGroupAdminRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SetGroupAdminRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SetGroupAdminRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SetGroupAdminRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SetGroupAdminRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SetGroupAdminRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SetGroupAdminRequest>(), &SetGroupAdminRequest::ByteSizeLong,
-            &SetGroupAdminRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_._cached_size_),
-        false,
-    },
-    &SetGroupAdminRequest::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SetGroupAdminRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 4, 1, 49, 2> SetGroupAdminRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    4, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967280,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    4,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::SetGroupAdminRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // bool set_admin = 4;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(SetGroupAdminRequest, _impl_.set_admin_), 63>(),
-     {32, 63, 0, PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.set_admin_)}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.header_)}},
-    // string group_id = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.group_id_)}},
-    // string uid = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.uid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string group_id = 2;
-    {PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.group_id_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string uid = 3;
-    {PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.uid_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // bool set_admin = 4;
-    {PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.set_admin_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\35\0\10\3\0\0\0\0"
-    "im.group.SetGroupAdminRequest"
-    "group_id"
-    "uid"
-  }},
-};
-
-PROTOBUF_NOINLINE void SetGroupAdminRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.SetGroupAdminRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.group_id_.ClearToEmpty();
-  _impl_.uid_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_.set_admin_ = false;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SetGroupAdminRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SetGroupAdminRequest& this_ = static_cast<const SetGroupAdminRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SetGroupAdminRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SetGroupAdminRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.SetGroupAdminRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string group_id = 2;
-          if (!this_._internal_group_id().empty()) {
-            const std::string& _s = this_._internal_group_id();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.SetGroupAdminRequest.group_id");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string uid = 3;
-          if (!this_._internal_uid().empty()) {
-            const std::string& _s = this_._internal_uid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.group.SetGroupAdminRequest.uid");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // bool set_admin = 4;
-          if (this_._internal_set_admin() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                4, this_._internal_set_admin(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.SetGroupAdminRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SetGroupAdminRequest::ByteSizeLong(const MessageLite& base) {
-          const SetGroupAdminRequest& this_ = static_cast<const SetGroupAdminRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SetGroupAdminRequest::ByteSizeLong() const {
-          const SetGroupAdminRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.SetGroupAdminRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string group_id = 2;
-            if (!this_._internal_group_id().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_group_id());
-            }
-            // string uid = 3;
-            if (!this_._internal_uid().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_uid());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // bool set_admin = 4;
-            if (this_._internal_set_admin() != 0) {
-              total_size += 2;
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SetGroupAdminRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SetGroupAdminRequest*>(&to_msg);
-  auto& from = static_cast<const SetGroupAdminRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.SetGroupAdminRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_group_id().empty()) {
-    _this->_internal_set_group_id(from._internal_group_id());
-  }
-  if (!from._internal_uid().empty()) {
-    _this->_internal_set_uid(from._internal_uid());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_set_admin() != 0) {
-    _this->_impl_.set_admin_ = from._impl_.set_admin_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SetGroupAdminRequest::CopyFrom(const SetGroupAdminRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.SetGroupAdminRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SetGroupAdminRequest::InternalSwap(SetGroupAdminRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.group_id_, &other->_impl_.group_id_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.set_admin_)
-      + sizeof(SetGroupAdminRequest::_impl_.set_admin_)
-      - PROTOBUF_FIELD_OFFSET(SetGroupAdminRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata SetGroupAdminRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SetGroupAdminResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<SetGroupAdminResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(SetGroupAdminResponse, _impl_._has_bits_);
-};
-
-void SetGroupAdminResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-SetGroupAdminResponse::SetGroupAdminResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.group.SetGroupAdminResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SetGroupAdminResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::group::SetGroupAdminResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-SetGroupAdminResponse::SetGroupAdminResponse(
-    ::google::protobuf::Arena* arena,
-    const SetGroupAdminResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SetGroupAdminResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.group.SetGroupAdminResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SetGroupAdminResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void SetGroupAdminResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-SetGroupAdminResponse::~SetGroupAdminResponse() {
-  // @@protoc_insertion_point(destructor:im.group.SetGroupAdminResponse)
-  SharedDtor(*this);
-}
-inline void SetGroupAdminResponse::SharedDtor(MessageLite& self) {
-  SetGroupAdminResponse& this_ = static_cast<SetGroupAdminResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* SetGroupAdminResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SetGroupAdminResponse(arena);
-}
-constexpr auto SetGroupAdminResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(SetGroupAdminResponse),
-                                            alignof(SetGroupAdminResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SetGroupAdminResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SetGroupAdminResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SetGroupAdminResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SetGroupAdminResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SetGroupAdminResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SetGroupAdminResponse>(), &SetGroupAdminResponse::ByteSizeLong,
-            &SetGroupAdminResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SetGroupAdminResponse, _impl_._cached_size_),
-        false,
-    },
-    &SetGroupAdminResponse::kDescriptorMethods,
-    &descriptor_table_group_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SetGroupAdminResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<0, 1, 1, 0, 2> SetGroupAdminResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(SetGroupAdminResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    1, 0,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967294,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    1,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::group::SetGroupAdminResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SetGroupAdminResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(SetGroupAdminResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void SetGroupAdminResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.group.SetGroupAdminResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SetGroupAdminResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SetGroupAdminResponse& this_ = static_cast<const SetGroupAdminResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SetGroupAdminResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SetGroupAdminResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.group.SetGroupAdminResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.group.SetGroupAdminResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SetGroupAdminResponse::ByteSizeLong(const MessageLite& base) {
-          const SetGroupAdminResponse& this_ = static_cast<const SetGroupAdminResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SetGroupAdminResponse::ByteSizeLong() const {
-          const SetGroupAdminResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.group.SetGroupAdminResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SetGroupAdminResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SetGroupAdminResponse*>(&to_msg);
-  auto& from = static_cast<const SetGroupAdminResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.group.SetGroupAdminResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SetGroupAdminResponse::CopyFrom(const SetGroupAdminResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.group.SetGroupAdminResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SetGroupAdminResponse::InternalSwap(SetGroupAdminResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata SetGroupAdminResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace group
-}  // namespace im
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-// @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ PROTOBUF_UNUSED =
-        (::_pbi::AddDescriptors(&descriptor_table_group_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
@@ -1,256 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: message.proto
-
-#include "message.pb.h"
-#include "message.grpc.pb.h"
-
-#include <functional>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/impl/channel_interface.h>
-#include <grpcpp/impl/client_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/rpc_service_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/sync_stream.h>
-namespace im {
-namespace message {
-
-static const char* MessageService_method_names[] = {
-  "/im.message.MessageService/SendMessage",
-  "/im.message.MessageService/GetConversation",
-  "/im.message.MessageService/PullOffline",
-  "/im.message.MessageService/MarkDelivered",
-  "/im.message.MessageService/MarkRead",
-};
-
-std::unique_ptr< MessageService::Stub> MessageService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
-  (void)options;
-  std::unique_ptr< MessageService::Stub> stub(new MessageService::Stub(channel, options));
-  return stub;
-}
-
-MessageService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
-  : channel_(channel), rpcmethod_SendMessage_(MessageService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetConversation_(MessageService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_PullOffline_(MessageService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_MarkDelivered_(MessageService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_MarkRead_(MessageService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  {}
-
-::grpc::Status MessageService::Stub::SendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::im::message::SendMessageResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::message::SendMessageRequest, ::im::message::SendMessageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SendMessage_, context, request, response);
-}
-
-void MessageService::Stub::async::SendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest* request, ::im::message::SendMessageResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::message::SendMessageRequest, ::im::message::SendMessageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SendMessage_, context, request, response, std::move(f));
-}
-
-void MessageService::Stub::async::SendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest* request, ::im::message::SendMessageResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SendMessage_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::SendMessageResponse>* MessageService::Stub::PrepareAsyncSendMessageRaw(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::message::SendMessageResponse, ::im::message::SendMessageRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SendMessage_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::SendMessageResponse>* MessageService::Stub::AsyncSendMessageRaw(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncSendMessageRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status MessageService::Stub::GetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::im::message::GetConversationResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::message::GetConversationRequest, ::im::message::GetConversationResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetConversation_, context, request, response);
-}
-
-void MessageService::Stub::async::GetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest* request, ::im::message::GetConversationResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::message::GetConversationRequest, ::im::message::GetConversationResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetConversation_, context, request, response, std::move(f));
-}
-
-void MessageService::Stub::async::GetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest* request, ::im::message::GetConversationResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetConversation_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::GetConversationResponse>* MessageService::Stub::PrepareAsyncGetConversationRaw(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::message::GetConversationResponse, ::im::message::GetConversationRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetConversation_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::GetConversationResponse>* MessageService::Stub::AsyncGetConversationRaw(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncGetConversationRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status MessageService::Stub::PullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::im::message::PullOfflineResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::message::PullOfflineRequest, ::im::message::PullOfflineResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_PullOffline_, context, request, response);
-}
-
-void MessageService::Stub::async::PullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest* request, ::im::message::PullOfflineResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::message::PullOfflineRequest, ::im::message::PullOfflineResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PullOffline_, context, request, response, std::move(f));
-}
-
-void MessageService::Stub::async::PullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest* request, ::im::message::PullOfflineResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_PullOffline_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::PullOfflineResponse>* MessageService::Stub::PrepareAsyncPullOfflineRaw(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::message::PullOfflineResponse, ::im::message::PullOfflineRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_PullOffline_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::PullOfflineResponse>* MessageService::Stub::AsyncPullOfflineRaw(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncPullOfflineRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status MessageService::Stub::MarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::im::message::MarkMessageDeliveredResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::message::MarkMessageDeliveredRequest, ::im::message::MarkMessageDeliveredResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_MarkDelivered_, context, request, response);
-}
-
-void MessageService::Stub::async::MarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest* request, ::im::message::MarkMessageDeliveredResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::message::MarkMessageDeliveredRequest, ::im::message::MarkMessageDeliveredResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MarkDelivered_, context, request, response, std::move(f));
-}
-
-void MessageService::Stub::async::MarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest* request, ::im::message::MarkMessageDeliveredResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MarkDelivered_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageDeliveredResponse>* MessageService::Stub::PrepareAsyncMarkDeliveredRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::message::MarkMessageDeliveredResponse, ::im::message::MarkMessageDeliveredRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_MarkDelivered_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageDeliveredResponse>* MessageService::Stub::AsyncMarkDeliveredRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncMarkDeliveredRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status MessageService::Stub::MarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::im::message::MarkMessageReadResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::message::MarkMessageReadRequest, ::im::message::MarkMessageReadResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_MarkRead_, context, request, response);
-}
-
-void MessageService::Stub::async::MarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest* request, ::im::message::MarkMessageReadResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::message::MarkMessageReadRequest, ::im::message::MarkMessageReadResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MarkRead_, context, request, response, std::move(f));
-}
-
-void MessageService::Stub::async::MarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest* request, ::im::message::MarkMessageReadResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MarkRead_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageReadResponse>* MessageService::Stub::PrepareAsyncMarkReadRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::message::MarkMessageReadResponse, ::im::message::MarkMessageReadRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_MarkRead_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageReadResponse>* MessageService::Stub::AsyncMarkReadRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncMarkReadRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-MessageService::Service::Service() {
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      MessageService_method_names[0],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< MessageService::Service, ::im::message::SendMessageRequest, ::im::message::SendMessageResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](MessageService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::message::SendMessageRequest* req,
-             ::im::message::SendMessageResponse* resp) {
-               return service->SendMessage(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      MessageService_method_names[1],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< MessageService::Service, ::im::message::GetConversationRequest, ::im::message::GetConversationResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](MessageService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::message::GetConversationRequest* req,
-             ::im::message::GetConversationResponse* resp) {
-               return service->GetConversation(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      MessageService_method_names[2],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< MessageService::Service, ::im::message::PullOfflineRequest, ::im::message::PullOfflineResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](MessageService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::message::PullOfflineRequest* req,
-             ::im::message::PullOfflineResponse* resp) {
-               return service->PullOffline(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      MessageService_method_names[3],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< MessageService::Service, ::im::message::MarkMessageDeliveredRequest, ::im::message::MarkMessageDeliveredResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](MessageService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::message::MarkMessageDeliveredRequest* req,
-             ::im::message::MarkMessageDeliveredResponse* resp) {
-               return service->MarkDelivered(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      MessageService_method_names[4],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< MessageService::Service, ::im::message::MarkMessageReadRequest, ::im::message::MarkMessageReadResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](MessageService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::message::MarkMessageReadRequest* req,
-             ::im::message::MarkMessageReadResponse* resp) {
-               return service->MarkRead(ctx, req, resp);
-             }, this)));
-}
-
-MessageService::Service::~Service() {
-}
-
-::grpc::Status MessageService::Service::SendMessage(::grpc::ServerContext* context, const ::im::message::SendMessageRequest* request, ::im::message::SendMessageResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status MessageService::Service::GetConversation(::grpc::ServerContext* context, const ::im::message::GetConversationRequest* request, ::im::message::GetConversationResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status MessageService::Service::PullOffline(::grpc::ServerContext* context, const ::im::message::PullOfflineRequest* request, ::im::message::PullOfflineResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status MessageService::Service::MarkDelivered(::grpc::ServerContext* context, const ::im::message::MarkMessageDeliveredRequest* request, ::im::message::MarkMessageDeliveredResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status MessageService::Service::MarkRead(::grpc::ServerContext* context, const ::im::message::MarkMessageReadRequest* request, ::im::message::MarkMessageReadResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-
-}  // namespace im
-}  // namespace message
-
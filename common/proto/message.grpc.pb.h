@@ -1,876 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: message.proto
-#ifndef GRPC_message_2eproto__INCLUDED
-#define GRPC_message_2eproto__INCLUDED
-
-#include "message.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-
-namespace im {
-namespace message {
-
-// MessageService is the service-to-service boundary for persisted one-to-one
-// message workflows. Gateway can keep using local MessageService while this
-// boundary is staged, then switch to RPC without changing the external HTTP/WS
-// contract.
-class MessageService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "im.message.MessageService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status SendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::im::message::SendMessageResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::SendMessageResponse>> AsyncSendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::SendMessageResponse>>(AsyncSendMessageRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::SendMessageResponse>> PrepareAsyncSendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::SendMessageResponse>>(PrepareAsyncSendMessageRaw(context, request, cq));
-    }
-    virtual ::grpc::Status GetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::im::message::GetConversationResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::GetConversationResponse>> AsyncGetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::GetConversationResponse>>(AsyncGetConversationRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::GetConversationResponse>> PrepareAsyncGetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::GetConversationResponse>>(PrepareAsyncGetConversationRaw(context, request, cq));
-    }
-    virtual ::grpc::Status PullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::im::message::PullOfflineResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::PullOfflineResponse>> AsyncPullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::PullOfflineResponse>>(AsyncPullOfflineRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::PullOfflineResponse>> PrepareAsyncPullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::PullOfflineResponse>>(PrepareAsyncPullOfflineRaw(context, request, cq));
-    }
-    virtual ::grpc::Status MarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::im::message::MarkMessageDeliveredResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageDeliveredResponse>> AsyncMarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageDeliveredResponse>>(AsyncMarkDeliveredRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageDeliveredResponse>> PrepareAsyncMarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageDeliveredResponse>>(PrepareAsyncMarkDeliveredRaw(context, request, cq));
-    }
-    virtual ::grpc::Status MarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::im::message::MarkMessageReadResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageReadResponse>> AsyncMarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageReadResponse>>(AsyncMarkReadRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageReadResponse>> PrepareAsyncMarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageReadResponse>>(PrepareAsyncMarkReadRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void SendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest* request, ::im::message::SendMessageResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void SendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest* request, ::im::message::SendMessageResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void GetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest* request, ::im::message::GetConversationResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void GetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest* request, ::im::message::GetConversationResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void PullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest* request, ::im::message::PullOfflineResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void PullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest* request, ::im::message::PullOfflineResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void MarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest* request, ::im::message::MarkMessageDeliveredResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void MarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest* request, ::im::message::MarkMessageDeliveredResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void MarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest* request, ::im::message::MarkMessageReadResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void MarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest* request, ::im::message::MarkMessageReadResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::SendMessageResponse>* AsyncSendMessageRaw(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::SendMessageResponse>* PrepareAsyncSendMessageRaw(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::GetConversationResponse>* AsyncGetConversationRaw(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::GetConversationResponse>* PrepareAsyncGetConversationRaw(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::PullOfflineResponse>* AsyncPullOfflineRaw(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::PullOfflineResponse>* PrepareAsyncPullOfflineRaw(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageDeliveredResponse>* AsyncMarkDeliveredRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageDeliveredResponse>* PrepareAsyncMarkDeliveredRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageReadResponse>* AsyncMarkReadRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::message::MarkMessageReadResponse>* PrepareAsyncMarkReadRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status SendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::im::message::SendMessageResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::SendMessageResponse>> AsyncSendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::SendMessageResponse>>(AsyncSendMessageRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::SendMessageResponse>> PrepareAsyncSendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::SendMessageResponse>>(PrepareAsyncSendMessageRaw(context, request, cq));
-    }
-    ::grpc::Status GetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::im::message::GetConversationResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::GetConversationResponse>> AsyncGetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::GetConversationResponse>>(AsyncGetConversationRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::GetConversationResponse>> PrepareAsyncGetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::GetConversationResponse>>(PrepareAsyncGetConversationRaw(context, request, cq));
-    }
-    ::grpc::Status PullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::im::message::PullOfflineResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::PullOfflineResponse>> AsyncPullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::PullOfflineResponse>>(AsyncPullOfflineRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::PullOfflineResponse>> PrepareAsyncPullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::PullOfflineResponse>>(PrepareAsyncPullOfflineRaw(context, request, cq));
-    }
-    ::grpc::Status MarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::im::message::MarkMessageDeliveredResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageDeliveredResponse>> AsyncMarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageDeliveredResponse>>(AsyncMarkDeliveredRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageDeliveredResponse>> PrepareAsyncMarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageDeliveredResponse>>(PrepareAsyncMarkDeliveredRaw(context, request, cq));
-    }
-    ::grpc::Status MarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::im::message::MarkMessageReadResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageReadResponse>> AsyncMarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageReadResponse>>(AsyncMarkReadRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageReadResponse>> PrepareAsyncMarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageReadResponse>>(PrepareAsyncMarkReadRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void SendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest* request, ::im::message::SendMessageResponse* response, std::function<void(::grpc::Status)>) override;
-      void SendMessage(::grpc::ClientContext* context, const ::im::message::SendMessageRequest* request, ::im::message::SendMessageResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void GetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest* request, ::im::message::GetConversationResponse* response, std::function<void(::grpc::Status)>) override;
-      void GetConversation(::grpc::ClientContext* context, const ::im::message::GetConversationRequest* request, ::im::message::GetConversationResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void PullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest* request, ::im::message::PullOfflineResponse* response, std::function<void(::grpc::Status)>) override;
-      void PullOffline(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest* request, ::im::message::PullOfflineResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void MarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest* request, ::im::message::MarkMessageDeliveredResponse* response, std::function<void(::grpc::Status)>) override;
-      void MarkDelivered(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest* request, ::im::message::MarkMessageDeliveredResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void MarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest* request, ::im::message::MarkMessageReadResponse* response, std::function<void(::grpc::Status)>) override;
-      void MarkRead(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest* request, ::im::message::MarkMessageReadResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::im::message::SendMessageResponse>* AsyncSendMessageRaw(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::message::SendMessageResponse>* PrepareAsyncSendMessageRaw(::grpc::ClientContext* context, const ::im::message::SendMessageRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::message::GetConversationResponse>* AsyncGetConversationRaw(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::message::GetConversationResponse>* PrepareAsyncGetConversationRaw(::grpc::ClientContext* context, const ::im::message::GetConversationRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::message::PullOfflineResponse>* AsyncPullOfflineRaw(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::message::PullOfflineResponse>* PrepareAsyncPullOfflineRaw(::grpc::ClientContext* context, const ::im::message::PullOfflineRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageDeliveredResponse>* AsyncMarkDeliveredRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageDeliveredResponse>* PrepareAsyncMarkDeliveredRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageDeliveredRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageReadResponse>* AsyncMarkReadRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::message::MarkMessageReadResponse>* PrepareAsyncMarkReadRaw(::grpc::ClientContext* context, const ::im::message::MarkMessageReadRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_SendMessage_;
-    const ::grpc::internal::RpcMethod rpcmethod_GetConversation_;
-    const ::grpc::internal::RpcMethod rpcmethod_PullOffline_;
-    const ::grpc::internal::RpcMethod rpcmethod_MarkDelivered_;
-    const ::grpc::internal::RpcMethod rpcmethod_MarkRead_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status SendMessage(::grpc::ServerContext* context, const ::im::message::SendMessageRequest* request, ::im::message::SendMessageResponse* response);
-    virtual ::grpc::Status GetConversation(::grpc::ServerContext* context, const ::im::message::GetConversationRequest* request, ::im::message::GetConversationResponse* response);
-    virtual ::grpc::Status PullOffline(::grpc::ServerContext* context, const ::im::message::PullOfflineRequest* request, ::im::message::PullOfflineResponse* response);
-    virtual ::grpc::Status MarkDelivered(::grpc::ServerContext* context, const ::im::message::MarkMessageDeliveredRequest* request, ::im::message::MarkMessageDeliveredResponse* response);
-    virtual ::grpc::Status MarkRead(::grpc::ServerContext* context, const ::im::message::MarkMessageReadRequest* request, ::im::message::MarkMessageReadResponse* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_SendMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_SendMessage() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_SendMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendMessage(::grpc::ServerContext* /*context*/, const ::im::message::SendMessageRequest* /*request*/, ::im::message::SendMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSendMessage(::grpc::ServerContext* context, ::im::message::SendMessageRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::message::SendMessageResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_GetConversation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_GetConversation() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_GetConversation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetConversation(::grpc::ServerContext* /*context*/, const ::im::message::GetConversationRequest* /*request*/, ::im::message::GetConversationResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetConversation(::grpc::ServerContext* context, ::im::message::GetConversationRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::message::GetConversationResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_PullOffline : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_PullOffline() {
-      ::grpc::Service::MarkMethodAsync(2);
-    }
-    ~WithAsyncMethod_PullOffline() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status PullOffline(::grpc::ServerContext* /*context*/, const ::im::message::PullOfflineRequest* /*request*/, ::im::message::PullOfflineResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestPullOffline(::grpc::ServerContext* context, ::im::message::PullOfflineRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::message::PullOfflineResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_MarkDelivered : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_MarkDelivered() {
-      ::grpc::Service::MarkMethodAsync(3);
-    }
-    ~WithAsyncMethod_MarkDelivered() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkDelivered(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageDeliveredRequest* /*request*/, ::im::message::MarkMessageDeliveredResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestMarkDelivered(::grpc::ServerContext* context, ::im::message::MarkMessageDeliveredRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::message::MarkMessageDeliveredResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_MarkRead : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_MarkRead() {
-      ::grpc::Service::MarkMethodAsync(4);
-    }
-    ~WithAsyncMethod_MarkRead() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkRead(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageReadRequest* /*request*/, ::im::message::MarkMessageReadResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestMarkRead(::grpc::ServerContext* context, ::im::message::MarkMessageReadRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::message::MarkMessageReadResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_SendMessage<WithAsyncMethod_GetConversation<WithAsyncMethod_PullOffline<WithAsyncMethod_MarkDelivered<WithAsyncMethod_MarkRead<Service > > > > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_SendMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_SendMessage() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::message::SendMessageRequest, ::im::message::SendMessageResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::message::SendMessageRequest* request, ::im::message::SendMessageResponse* response) { return this->SendMessage(context, request, response); }));}
-    void SetMessageAllocatorFor_SendMessage(
-        ::grpc::MessageAllocator< ::im::message::SendMessageRequest, ::im::message::SendMessageResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::message::SendMessageRequest, ::im::message::SendMessageResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_SendMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendMessage(::grpc::ServerContext* /*context*/, const ::im::message::SendMessageRequest* /*request*/, ::im::message::SendMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SendMessage(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::message::SendMessageRequest* /*request*/, ::im::message::SendMessageResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_GetConversation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_GetConversation() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::message::GetConversationRequest, ::im::message::GetConversationResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::message::GetConversationRequest* request, ::im::message::GetConversationResponse* response) { return this->GetConversation(context, request, response); }));}
-    void SetMessageAllocatorFor_GetConversation(
-        ::grpc::MessageAllocator< ::im::message::GetConversationRequest, ::im::message::GetConversationResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::message::GetConversationRequest, ::im::message::GetConversationResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_GetConversation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetConversation(::grpc::ServerContext* /*context*/, const ::im::message::GetConversationRequest* /*request*/, ::im::message::GetConversationResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetConversation(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::message::GetConversationRequest* /*request*/, ::im::message::GetConversationResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_PullOffline : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_PullOffline() {
-      ::grpc::Service::MarkMethodCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::message::PullOfflineRequest, ::im::message::PullOfflineResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::message::PullOfflineRequest* request, ::im::message::PullOfflineResponse* response) { return this->PullOffline(context, request, response); }));}
-    void SetMessageAllocatorFor_PullOffline(
-        ::grpc::MessageAllocator< ::im::message::PullOfflineRequest, ::im::message::PullOfflineResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::message::PullOfflineRequest, ::im::message::PullOfflineResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_PullOffline() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status PullOffline(::grpc::ServerContext* /*context*/, const ::im::message::PullOfflineRequest* /*request*/, ::im::message::PullOfflineResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* PullOffline(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::message::PullOfflineRequest* /*request*/, ::im::message::PullOfflineResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_MarkDelivered : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_MarkDelivered() {
-      ::grpc::Service::MarkMethodCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::message::MarkMessageDeliveredRequest, ::im::message::MarkMessageDeliveredResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::message::MarkMessageDeliveredRequest* request, ::im::message::MarkMessageDeliveredResponse* response) { return this->MarkDelivered(context, request, response); }));}
-    void SetMessageAllocatorFor_MarkDelivered(
-        ::grpc::MessageAllocator< ::im::message::MarkMessageDeliveredRequest, ::im::message::MarkMessageDeliveredResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::message::MarkMessageDeliveredRequest, ::im::message::MarkMessageDeliveredResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_MarkDelivered() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkDelivered(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageDeliveredRequest* /*request*/, ::im::message::MarkMessageDeliveredResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* MarkDelivered(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::message::MarkMessageDeliveredRequest* /*request*/, ::im::message::MarkMessageDeliveredResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_MarkRead : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_MarkRead() {
-      ::grpc::Service::MarkMethodCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::message::MarkMessageReadRequest, ::im::message::MarkMessageReadResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::message::MarkMessageReadRequest* request, ::im::message::MarkMessageReadResponse* response) { return this->MarkRead(context, request, response); }));}
-    void SetMessageAllocatorFor_MarkRead(
-        ::grpc::MessageAllocator< ::im::message::MarkMessageReadRequest, ::im::message::MarkMessageReadResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::message::MarkMessageReadRequest, ::im::message::MarkMessageReadResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_MarkRead() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkRead(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageReadRequest* /*request*/, ::im::message::MarkMessageReadResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* MarkRead(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::message::MarkMessageReadRequest* /*request*/, ::im::message::MarkMessageReadResponse* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_SendMessage<WithCallbackMethod_GetConversation<WithCallbackMethod_PullOffline<WithCallbackMethod_MarkDelivered<WithCallbackMethod_MarkRead<Service > > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_SendMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_SendMessage() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_SendMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendMessage(::grpc::ServerContext* /*context*/, const ::im::message::SendMessageRequest* /*request*/, ::im::message::SendMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_GetConversation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_GetConversation() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_GetConversation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetConversation(::grpc::ServerContext* /*context*/, const ::im::message::GetConversationRequest* /*request*/, ::im::message::GetConversationResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_PullOffline : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_PullOffline() {
-      ::grpc::Service::MarkMethodGeneric(2);
-    }
-    ~WithGenericMethod_PullOffline() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status PullOffline(::grpc::ServerContext* /*context*/, const ::im::message::PullOfflineRequest* /*request*/, ::im::message::PullOfflineResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_MarkDelivered : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_MarkDelivered() {
-      ::grpc::Service::MarkMethodGeneric(3);
-    }
-    ~WithGenericMethod_MarkDelivered() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkDelivered(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageDeliveredRequest* /*request*/, ::im::message::MarkMessageDeliveredResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_MarkRead : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_MarkRead() {
-      ::grpc::Service::MarkMethodGeneric(4);
-    }
-    ~WithGenericMethod_MarkRead() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkRead(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageReadRequest* /*request*/, ::im::message::MarkMessageReadResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_SendMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_SendMessage() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_SendMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendMessage(::grpc::ServerContext* /*context*/, const ::im::message::SendMessageRequest* /*request*/, ::im::message::SendMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSendMessage(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_GetConversation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_GetConversation() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_GetConversation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetConversation(::grpc::ServerContext* /*context*/, const ::im::message::GetConversationRequest* /*request*/, ::im::message::GetConversationResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetConversation(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_PullOffline : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_PullOffline() {
-      ::grpc::Service::MarkMethodRaw(2);
-    }
-    ~WithRawMethod_PullOffline() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status PullOffline(::grpc::ServerContext* /*context*/, const ::im::message::PullOfflineRequest* /*request*/, ::im::message::PullOfflineResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestPullOffline(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_MarkDelivered : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_MarkDelivered() {
-      ::grpc::Service::MarkMethodRaw(3);
-    }
-    ~WithRawMethod_MarkDelivered() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkDelivered(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageDeliveredRequest* /*request*/, ::im::message::MarkMessageDeliveredResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestMarkDelivered(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_MarkRead : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_MarkRead() {
-      ::grpc::Service::MarkMethodRaw(4);
-    }
-    ~WithRawMethod_MarkRead() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkRead(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageReadRequest* /*request*/, ::im::message::MarkMessageReadResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestMarkRead(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_SendMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_SendMessage() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SendMessage(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_SendMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SendMessage(::grpc::ServerContext* /*context*/, const ::im::message::SendMessageRequest* /*request*/, ::im::message::SendMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SendMessage(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_GetConversation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_GetConversation() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetConversation(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_GetConversation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetConversation(::grpc::ServerContext* /*context*/, const ::im::message::GetConversationRequest* /*request*/, ::im::message::GetConversationResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetConversation(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_PullOffline : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_PullOffline() {
-      ::grpc::Service::MarkMethodRawCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->PullOffline(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_PullOffline() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status PullOffline(::grpc::ServerContext* /*context*/, const ::im::message::PullOfflineRequest* /*request*/, ::im::message::PullOfflineResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* PullOffline(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_MarkDelivered : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_MarkDelivered() {
-      ::grpc::Service::MarkMethodRawCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->MarkDelivered(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_MarkDelivered() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkDelivered(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageDeliveredRequest* /*request*/, ::im::message::MarkMessageDeliveredResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* MarkDelivered(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_MarkRead : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_MarkRead() {
-      ::grpc::Service::MarkMethodRawCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->MarkRead(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_MarkRead() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status MarkRead(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageReadRequest* /*request*/, ::im::message::MarkMessageReadResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* MarkRead(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_SendMessage : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_SendMessage() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::message::SendMessageRequest, ::im::message::SendMessageResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::message::SendMessageRequest, ::im::message::SendMessageResponse>* streamer) {
-                       return this->StreamedSendMessage(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_SendMessage() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status SendMessage(::grpc::ServerContext* /*context*/, const ::im::message::SendMessageRequest* /*request*/, ::im::message::SendMessageResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSendMessage(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::message::SendMessageRequest,::im::message::SendMessageResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_GetConversation : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_GetConversation() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::message::GetConversationRequest, ::im::message::GetConversationResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::message::GetConversationRequest, ::im::message::GetConversationResponse>* streamer) {
-                       return this->StreamedGetConversation(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_GetConversation() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status GetConversation(::grpc::ServerContext* /*context*/, const ::im::message::GetConversationRequest* /*request*/, ::im::message::GetConversationResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetConversation(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::message::GetConversationRequest,::im::message::GetConversationResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_PullOffline : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_PullOffline() {
-      ::grpc::Service::MarkMethodStreamed(2,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::message::PullOfflineRequest, ::im::message::PullOfflineResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::message::PullOfflineRequest, ::im::message::PullOfflineResponse>* streamer) {
-                       return this->StreamedPullOffline(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_PullOffline() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status PullOffline(::grpc::ServerContext* /*context*/, const ::im::message::PullOfflineRequest* /*request*/, ::im::message::PullOfflineResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedPullOffline(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::message::PullOfflineRequest,::im::message::PullOfflineResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_MarkDelivered : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_MarkDelivered() {
-      ::grpc::Service::MarkMethodStreamed(3,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::message::MarkMessageDeliveredRequest, ::im::message::MarkMessageDeliveredResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::message::MarkMessageDeliveredRequest, ::im::message::MarkMessageDeliveredResponse>* streamer) {
-                       return this->StreamedMarkDelivered(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_MarkDelivered() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status MarkDelivered(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageDeliveredRequest* /*request*/, ::im::message::MarkMessageDeliveredResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedMarkDelivered(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::message::MarkMessageDeliveredRequest,::im::message::MarkMessageDeliveredResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_MarkRead : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_MarkRead() {
-      ::grpc::Service::MarkMethodStreamed(4,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::message::MarkMessageReadRequest, ::im::message::MarkMessageReadResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::message::MarkMessageReadRequest, ::im::message::MarkMessageReadResponse>* streamer) {
-                       return this->StreamedMarkRead(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_MarkRead() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status MarkRead(::grpc::ServerContext* /*context*/, const ::im::message::MarkMessageReadRequest* /*request*/, ::im::message::MarkMessageReadResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedMarkRead(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::message::MarkMessageReadRequest,::im::message::MarkMessageReadResponse>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_SendMessage<WithStreamedUnaryMethod_GetConversation<WithStreamedUnaryMethod_PullOffline<WithStreamedUnaryMethod_MarkDelivered<WithStreamedUnaryMethod_MarkRead<Service > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_SendMessage<WithStreamedUnaryMethod_GetConversation<WithStreamedUnaryMethod_PullOffline<WithStreamedUnaryMethod_MarkDelivered<WithStreamedUnaryMethod_MarkRead<Service > > > > > StreamedService;
-};
-
-}  // namespace message
-}  // namespace im
-
-
-#include <grpcpp/ports_undef.inc>
-#endif  // GRPC_message_2eproto__INCLUDED
@@ -1,256 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: user.proto
-
-#include "user.pb.h"
-#include "user.grpc.pb.h"
-
-#include <functional>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/impl/channel_interface.h>
-#include <grpcpp/impl/client_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/rpc_service_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/sync_stream.h>
-namespace im {
-namespace user {
-
-static const char* UserService_method_names[] = {
-  "/im.user.UserService/Register",
-  "/im.user.UserService/Login",
-  "/im.user.UserService/GetUserInfo",
-  "/im.user.UserService/SearchUsers",
-  "/im.user.UserService/UpdateUserInfo",
-};
-
-std::unique_ptr< UserService::Stub> UserService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
-  (void)options;
-  std::unique_ptr< UserService::Stub> stub(new UserService::Stub(channel, options));
-  return stub;
-}
-
-UserService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options)
-  : channel_(channel), rpcmethod_Register_(UserService_method_names[0], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_Login_(UserService_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetUserInfo_(UserService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SearchUsers_(UserService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_UpdateUserInfo_(UserService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  {}
-
-::grpc::Status UserService::Stub::Register(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::im::user::RegisterResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::user::RegisterRequest, ::im::user::RegisterResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Register_, context, request, response);
-}
-
-void UserService::Stub::async::Register(::grpc::ClientContext* context, const ::im::user::RegisterRequest* request, ::im::user::RegisterResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::user::RegisterRequest, ::im::user::RegisterResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Register_, context, request, response, std::move(f));
-}
-
-void UserService::Stub::async::Register(::grpc::ClientContext* context, const ::im::user::RegisterRequest* request, ::im::user::RegisterResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Register_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::RegisterResponse>* UserService::Stub::PrepareAsyncRegisterRaw(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::user::RegisterResponse, ::im::user::RegisterRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Register_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::RegisterResponse>* UserService::Stub::AsyncRegisterRaw(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncRegisterRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status UserService::Stub::Login(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::im::user::LoginResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::user::LoginRequest, ::im::user::LoginResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_Login_, context, request, response);
-}
-
-void UserService::Stub::async::Login(::grpc::ClientContext* context, const ::im::user::LoginRequest* request, ::im::user::LoginResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::user::LoginRequest, ::im::user::LoginResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Login_, context, request, response, std::move(f));
-}
-
-void UserService::Stub::async::Login(::grpc::ClientContext* context, const ::im::user::LoginRequest* request, ::im::user::LoginResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_Login_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::LoginResponse>* UserService::Stub::PrepareAsyncLoginRaw(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::user::LoginResponse, ::im::user::LoginRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_Login_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::LoginResponse>* UserService::Stub::AsyncLoginRaw(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncLoginRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status UserService::Stub::GetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::im::user::GetUserInfoResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::user::GetUserInfoRequest, ::im::user::GetUserInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetUserInfo_, context, request, response);
-}
-
-void UserService::Stub::async::GetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest* request, ::im::user::GetUserInfoResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::user::GetUserInfoRequest, ::im::user::GetUserInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetUserInfo_, context, request, response, std::move(f));
-}
-
-void UserService::Stub::async::GetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest* request, ::im::user::GetUserInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetUserInfo_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::GetUserInfoResponse>* UserService::Stub::PrepareAsyncGetUserInfoRaw(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::user::GetUserInfoResponse, ::im::user::GetUserInfoRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetUserInfo_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::GetUserInfoResponse>* UserService::Stub::AsyncGetUserInfoRaw(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncGetUserInfoRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status UserService::Stub::SearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::im::user::SearchUsersResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::user::SearchUsersRequest, ::im::user::SearchUsersResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SearchUsers_, context, request, response);
-}
-
-void UserService::Stub::async::SearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest* request, ::im::user::SearchUsersResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::user::SearchUsersRequest, ::im::user::SearchUsersResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SearchUsers_, context, request, response, std::move(f));
-}
-
-void UserService::Stub::async::SearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest* request, ::im::user::SearchUsersResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SearchUsers_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::SearchUsersResponse>* UserService::Stub::PrepareAsyncSearchUsersRaw(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::user::SearchUsersResponse, ::im::user::SearchUsersRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SearchUsers_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::SearchUsersResponse>* UserService::Stub::AsyncSearchUsersRaw(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncSearchUsersRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-::grpc::Status UserService::Stub::UpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::im::user::UpdateUserInfoResponse* response) {
-  return ::grpc::internal::BlockingUnaryCall< ::im::user::UpdateUserInfoRequest, ::im::user::UpdateUserInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_UpdateUserInfo_, context, request, response);
-}
-
-void UserService::Stub::async::UpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest* request, ::im::user::UpdateUserInfoResponse* response, std::function<void(::grpc::Status)> f) {
-  ::grpc::internal::CallbackUnaryCall< ::im::user::UpdateUserInfoRequest, ::im::user::UpdateUserInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_UpdateUserInfo_, context, request, response, std::move(f));
-}
-
-void UserService::Stub::async::UpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest* request, ::im::user::UpdateUserInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) {
-  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_UpdateUserInfo_, context, request, response, reactor);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::UpdateUserInfoResponse>* UserService::Stub::PrepareAsyncUpdateUserInfoRaw(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::im::user::UpdateUserInfoResponse, ::im::user::UpdateUserInfoRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_UpdateUserInfo_, context, request);
-}
-
-::grpc::ClientAsyncResponseReader< ::im::user::UpdateUserInfoResponse>* UserService::Stub::AsyncUpdateUserInfoRaw(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-  auto* result =
-    this->PrepareAsyncUpdateUserInfoRaw(context, request, cq);
-  result->StartCall();
-  return result;
-}
-
-UserService::Service::Service() {
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UserService_method_names[0],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< UserService::Service, ::im::user::RegisterRequest, ::im::user::RegisterResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](UserService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::user::RegisterRequest* req,
-             ::im::user::RegisterResponse* resp) {
-               return service->Register(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UserService_method_names[1],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< UserService::Service, ::im::user::LoginRequest, ::im::user::LoginResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](UserService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::user::LoginRequest* req,
-             ::im::user::LoginResponse* resp) {
-               return service->Login(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UserService_method_names[2],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< UserService::Service, ::im::user::GetUserInfoRequest, ::im::user::GetUserInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](UserService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::user::GetUserInfoRequest* req,
-             ::im::user::GetUserInfoResponse* resp) {
-               return service->GetUserInfo(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UserService_method_names[3],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< UserService::Service, ::im::user::SearchUsersRequest, ::im::user::SearchUsersResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](UserService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::user::SearchUsersRequest* req,
-             ::im::user::SearchUsersResponse* resp) {
-               return service->SearchUsers(ctx, req, resp);
-             }, this)));
-  AddMethod(new ::grpc::internal::RpcServiceMethod(
-      UserService_method_names[4],
-      ::grpc::internal::RpcMethod::NORMAL_RPC,
-      new ::grpc::internal::RpcMethodHandler< UserService::Service, ::im::user::UpdateUserInfoRequest, ::im::user::UpdateUserInfoResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
-          [](UserService::Service* service,
-             ::grpc::ServerContext* ctx,
-             const ::im::user::UpdateUserInfoRequest* req,
-             ::im::user::UpdateUserInfoResponse* resp) {
-               return service->UpdateUserInfo(ctx, req, resp);
-             }, this)));
-}
-
-UserService::Service::~Service() {
-}
-
-::grpc::Status UserService::Service::Register(::grpc::ServerContext* context, const ::im::user::RegisterRequest* request, ::im::user::RegisterResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status UserService::Service::Login(::grpc::ServerContext* context, const ::im::user::LoginRequest* request, ::im::user::LoginResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status UserService::Service::GetUserInfo(::grpc::ServerContext* context, const ::im::user::GetUserInfoRequest* request, ::im::user::GetUserInfoResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status UserService::Service::SearchUsers(::grpc::ServerContext* context, const ::im::user::SearchUsersRequest* request, ::im::user::SearchUsersResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-::grpc::Status UserService::Service::UpdateUserInfo(::grpc::ServerContext* context, const ::im::user::UpdateUserInfoRequest* request, ::im::user::UpdateUserInfoResponse* response) {
-  (void) context;
-  (void) request;
-  (void) response;
-  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-}
-
-
-}  // namespace im
-}  // namespace user
-
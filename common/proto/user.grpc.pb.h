@@ -1,876 +0,0 @@
-// Generated by the gRPC C++ plugin.
-// If you make any local change, they will be lost.
-// source: user.proto
-#ifndef GRPC_user_2eproto__INCLUDED
-#define GRPC_user_2eproto__INCLUDED
-
-#include "user.pb.h"
-
-#include <functional>
-#include <grpcpp/generic/async_generic_service.h>
-#include <grpcpp/support/async_stream.h>
-#include <grpcpp/support/async_unary_call.h>
-#include <grpcpp/support/client_callback.h>
-#include <grpcpp/client_context.h>
-#include <grpcpp/completion_queue.h>
-#include <grpcpp/support/message_allocator.h>
-#include <grpcpp/support/method_handler.h>
-#include <grpcpp/impl/proto_utils.h>
-#include <grpcpp/impl/rpc_method.h>
-#include <grpcpp/support/server_callback.h>
-#include <grpcpp/impl/server_callback_handlers.h>
-#include <grpcpp/server_context.h>
-#include <grpcpp/impl/service_type.h>
-#include <grpcpp/support/status.h>
-#include <grpcpp/support/stub_options.h>
-#include <grpcpp/support/sync_stream.h>
-#include <grpcpp/ports_def.inc>
-
-namespace im {
-namespace user {
-
-// UserService is the distributed gRPC boundary for core account workflows.
-// Gateway may keep using the in-process UserService while this boundary is
-// staged; service implementations should map this contract to the same core
-// UserService semantics.
-class UserService final {
- public:
-  static constexpr char const* service_full_name() {
-    return "im.user.UserService";
-  }
-  class StubInterface {
-   public:
-    virtual ~StubInterface() {}
-    virtual ::grpc::Status Register(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::im::user::RegisterResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::RegisterResponse>> AsyncRegister(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::RegisterResponse>>(AsyncRegisterRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::RegisterResponse>> PrepareAsyncRegister(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::RegisterResponse>>(PrepareAsyncRegisterRaw(context, request, cq));
-    }
-    virtual ::grpc::Status Login(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::im::user::LoginResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::LoginResponse>> AsyncLogin(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::LoginResponse>>(AsyncLoginRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::LoginResponse>> PrepareAsyncLogin(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::LoginResponse>>(PrepareAsyncLoginRaw(context, request, cq));
-    }
-    virtual ::grpc::Status GetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::im::user::GetUserInfoResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::GetUserInfoResponse>> AsyncGetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::GetUserInfoResponse>>(AsyncGetUserInfoRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::GetUserInfoResponse>> PrepareAsyncGetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::GetUserInfoResponse>>(PrepareAsyncGetUserInfoRaw(context, request, cq));
-    }
-    virtual ::grpc::Status SearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::im::user::SearchUsersResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::SearchUsersResponse>> AsyncSearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::SearchUsersResponse>>(AsyncSearchUsersRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::SearchUsersResponse>> PrepareAsyncSearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::SearchUsersResponse>>(PrepareAsyncSearchUsersRaw(context, request, cq));
-    }
-    virtual ::grpc::Status UpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::im::user::UpdateUserInfoResponse* response) = 0;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::UpdateUserInfoResponse>> AsyncUpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::UpdateUserInfoResponse>>(AsyncUpdateUserInfoRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::UpdateUserInfoResponse>> PrepareAsyncUpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::im::user::UpdateUserInfoResponse>>(PrepareAsyncUpdateUserInfoRaw(context, request, cq));
-    }
-    class async_interface {
-     public:
-      virtual ~async_interface() {}
-      virtual void Register(::grpc::ClientContext* context, const ::im::user::RegisterRequest* request, ::im::user::RegisterResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void Register(::grpc::ClientContext* context, const ::im::user::RegisterRequest* request, ::im::user::RegisterResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void Login(::grpc::ClientContext* context, const ::im::user::LoginRequest* request, ::im::user::LoginResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void Login(::grpc::ClientContext* context, const ::im::user::LoginRequest* request, ::im::user::LoginResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void GetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest* request, ::im::user::GetUserInfoResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void GetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest* request, ::im::user::GetUserInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void SearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest* request, ::im::user::SearchUsersResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void SearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest* request, ::im::user::SearchUsersResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-      virtual void UpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest* request, ::im::user::UpdateUserInfoResponse* response, std::function<void(::grpc::Status)>) = 0;
-      virtual void UpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest* request, ::im::user::UpdateUserInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
-    };
-    typedef class async_interface experimental_async_interface;
-    virtual class async_interface* async() { return nullptr; }
-    class async_interface* experimental_async() { return async(); }
-   private:
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::RegisterResponse>* AsyncRegisterRaw(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::RegisterResponse>* PrepareAsyncRegisterRaw(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::LoginResponse>* AsyncLoginRaw(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::LoginResponse>* PrepareAsyncLoginRaw(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::GetUserInfoResponse>* AsyncGetUserInfoRaw(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::GetUserInfoResponse>* PrepareAsyncGetUserInfoRaw(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::SearchUsersResponse>* AsyncSearchUsersRaw(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::SearchUsersResponse>* PrepareAsyncSearchUsersRaw(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::UpdateUserInfoResponse>* AsyncUpdateUserInfoRaw(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
-    virtual ::grpc::ClientAsyncResponseReaderInterface< ::im::user::UpdateUserInfoResponse>* PrepareAsyncUpdateUserInfoRaw(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) = 0;
-  };
-  class Stub final : public StubInterface {
-   public:
-    Stub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-    ::grpc::Status Register(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::im::user::RegisterResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::RegisterResponse>> AsyncRegister(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::RegisterResponse>>(AsyncRegisterRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::RegisterResponse>> PrepareAsyncRegister(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::RegisterResponse>>(PrepareAsyncRegisterRaw(context, request, cq));
-    }
-    ::grpc::Status Login(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::im::user::LoginResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::LoginResponse>> AsyncLogin(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::LoginResponse>>(AsyncLoginRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::LoginResponse>> PrepareAsyncLogin(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::LoginResponse>>(PrepareAsyncLoginRaw(context, request, cq));
-    }
-    ::grpc::Status GetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::im::user::GetUserInfoResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::GetUserInfoResponse>> AsyncGetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::GetUserInfoResponse>>(AsyncGetUserInfoRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::GetUserInfoResponse>> PrepareAsyncGetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::GetUserInfoResponse>>(PrepareAsyncGetUserInfoRaw(context, request, cq));
-    }
-    ::grpc::Status SearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::im::user::SearchUsersResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::SearchUsersResponse>> AsyncSearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::SearchUsersResponse>>(AsyncSearchUsersRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::SearchUsersResponse>> PrepareAsyncSearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::SearchUsersResponse>>(PrepareAsyncSearchUsersRaw(context, request, cq));
-    }
-    ::grpc::Status UpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::im::user::UpdateUserInfoResponse* response) override;
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::UpdateUserInfoResponse>> AsyncUpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::UpdateUserInfoResponse>>(AsyncUpdateUserInfoRaw(context, request, cq));
-    }
-    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::UpdateUserInfoResponse>> PrepareAsyncUpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) {
-      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::im::user::UpdateUserInfoResponse>>(PrepareAsyncUpdateUserInfoRaw(context, request, cq));
-    }
-    class async final :
-      public StubInterface::async_interface {
-     public:
-      void Register(::grpc::ClientContext* context, const ::im::user::RegisterRequest* request, ::im::user::RegisterResponse* response, std::function<void(::grpc::Status)>) override;
-      void Register(::grpc::ClientContext* context, const ::im::user::RegisterRequest* request, ::im::user::RegisterResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void Login(::grpc::ClientContext* context, const ::im::user::LoginRequest* request, ::im::user::LoginResponse* response, std::function<void(::grpc::Status)>) override;
-      void Login(::grpc::ClientContext* context, const ::im::user::LoginRequest* request, ::im::user::LoginResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void GetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest* request, ::im::user::GetUserInfoResponse* response, std::function<void(::grpc::Status)>) override;
-      void GetUserInfo(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest* request, ::im::user::GetUserInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void SearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest* request, ::im::user::SearchUsersResponse* response, std::function<void(::grpc::Status)>) override;
-      void SearchUsers(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest* request, ::im::user::SearchUsersResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-      void UpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest* request, ::im::user::UpdateUserInfoResponse* response, std::function<void(::grpc::Status)>) override;
-      void UpdateUserInfo(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest* request, ::im::user::UpdateUserInfoResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
-     private:
-      friend class Stub;
-      explicit async(Stub* stub): stub_(stub) { }
-      Stub* stub() { return stub_; }
-      Stub* stub_;
-    };
-    class async* async() override { return &async_stub_; }
-
-   private:
-    std::shared_ptr< ::grpc::ChannelInterface> channel_;
-    class async async_stub_{this};
-    ::grpc::ClientAsyncResponseReader< ::im::user::RegisterResponse>* AsyncRegisterRaw(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::user::RegisterResponse>* PrepareAsyncRegisterRaw(::grpc::ClientContext* context, const ::im::user::RegisterRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::user::LoginResponse>* AsyncLoginRaw(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::user::LoginResponse>* PrepareAsyncLoginRaw(::grpc::ClientContext* context, const ::im::user::LoginRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::user::GetUserInfoResponse>* AsyncGetUserInfoRaw(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::user::GetUserInfoResponse>* PrepareAsyncGetUserInfoRaw(::grpc::ClientContext* context, const ::im::user::GetUserInfoRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::user::SearchUsersResponse>* AsyncSearchUsersRaw(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::user::SearchUsersResponse>* PrepareAsyncSearchUsersRaw(::grpc::ClientContext* context, const ::im::user::SearchUsersRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::user::UpdateUserInfoResponse>* AsyncUpdateUserInfoRaw(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) override;
-    ::grpc::ClientAsyncResponseReader< ::im::user::UpdateUserInfoResponse>* PrepareAsyncUpdateUserInfoRaw(::grpc::ClientContext* context, const ::im::user::UpdateUserInfoRequest& request, ::grpc::CompletionQueue* cq) override;
-    const ::grpc::internal::RpcMethod rpcmethod_Register_;
-    const ::grpc::internal::RpcMethod rpcmethod_Login_;
-    const ::grpc::internal::RpcMethod rpcmethod_GetUserInfo_;
-    const ::grpc::internal::RpcMethod rpcmethod_SearchUsers_;
-    const ::grpc::internal::RpcMethod rpcmethod_UpdateUserInfo_;
-  };
-  static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
-
-  class Service : public ::grpc::Service {
-   public:
-    Service();
-    virtual ~Service();
-    virtual ::grpc::Status Register(::grpc::ServerContext* context, const ::im::user::RegisterRequest* request, ::im::user::RegisterResponse* response);
-    virtual ::grpc::Status Login(::grpc::ServerContext* context, const ::im::user::LoginRequest* request, ::im::user::LoginResponse* response);
-    virtual ::grpc::Status GetUserInfo(::grpc::ServerContext* context, const ::im::user::GetUserInfoRequest* request, ::im::user::GetUserInfoResponse* response);
-    virtual ::grpc::Status SearchUsers(::grpc::ServerContext* context, const ::im::user::SearchUsersRequest* request, ::im::user::SearchUsersResponse* response);
-    virtual ::grpc::Status UpdateUserInfo(::grpc::ServerContext* context, const ::im::user::UpdateUserInfoRequest* request, ::im::user::UpdateUserInfoResponse* response);
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_Register : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_Register() {
-      ::grpc::Service::MarkMethodAsync(0);
-    }
-    ~WithAsyncMethod_Register() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Register(::grpc::ServerContext* /*context*/, const ::im::user::RegisterRequest* /*request*/, ::im::user::RegisterResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestRegister(::grpc::ServerContext* context, ::im::user::RegisterRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::user::RegisterResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_Login : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_Login() {
-      ::grpc::Service::MarkMethodAsync(1);
-    }
-    ~WithAsyncMethod_Login() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Login(::grpc::ServerContext* /*context*/, const ::im::user::LoginRequest* /*request*/, ::im::user::LoginResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestLogin(::grpc::ServerContext* context, ::im::user::LoginRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::user::LoginResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_GetUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_GetUserInfo() {
-      ::grpc::Service::MarkMethodAsync(2);
-    }
-    ~WithAsyncMethod_GetUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::GetUserInfoRequest* /*request*/, ::im::user::GetUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetUserInfo(::grpc::ServerContext* context, ::im::user::GetUserInfoRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::user::GetUserInfoResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_SearchUsers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_SearchUsers() {
-      ::grpc::Service::MarkMethodAsync(3);
-    }
-    ~WithAsyncMethod_SearchUsers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchUsers(::grpc::ServerContext* /*context*/, const ::im::user::SearchUsersRequest* /*request*/, ::im::user::SearchUsersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSearchUsers(::grpc::ServerContext* context, ::im::user::SearchUsersRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::user::SearchUsersResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithAsyncMethod_UpdateUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithAsyncMethod_UpdateUserInfo() {
-      ::grpc::Service::MarkMethodAsync(4);
-    }
-    ~WithAsyncMethod_UpdateUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status UpdateUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::UpdateUserInfoRequest* /*request*/, ::im::user::UpdateUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestUpdateUserInfo(::grpc::ServerContext* context, ::im::user::UpdateUserInfoRequest* request, ::grpc::ServerAsyncResponseWriter< ::im::user::UpdateUserInfoResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  typedef WithAsyncMethod_Register<WithAsyncMethod_Login<WithAsyncMethod_GetUserInfo<WithAsyncMethod_SearchUsers<WithAsyncMethod_UpdateUserInfo<Service > > > > > AsyncService;
-  template <class BaseClass>
-  class WithCallbackMethod_Register : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_Register() {
-      ::grpc::Service::MarkMethodCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::user::RegisterRequest, ::im::user::RegisterResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::user::RegisterRequest* request, ::im::user::RegisterResponse* response) { return this->Register(context, request, response); }));}
-    void SetMessageAllocatorFor_Register(
-        ::grpc::MessageAllocator< ::im::user::RegisterRequest, ::im::user::RegisterResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(0);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::user::RegisterRequest, ::im::user::RegisterResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_Register() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Register(::grpc::ServerContext* /*context*/, const ::im::user::RegisterRequest* /*request*/, ::im::user::RegisterResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Register(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::user::RegisterRequest* /*request*/, ::im::user::RegisterResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_Login : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_Login() {
-      ::grpc::Service::MarkMethodCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::user::LoginRequest, ::im::user::LoginResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::user::LoginRequest* request, ::im::user::LoginResponse* response) { return this->Login(context, request, response); }));}
-    void SetMessageAllocatorFor_Login(
-        ::grpc::MessageAllocator< ::im::user::LoginRequest, ::im::user::LoginResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(1);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::user::LoginRequest, ::im::user::LoginResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_Login() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Login(::grpc::ServerContext* /*context*/, const ::im::user::LoginRequest* /*request*/, ::im::user::LoginResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Login(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::user::LoginRequest* /*request*/, ::im::user::LoginResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_GetUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_GetUserInfo() {
-      ::grpc::Service::MarkMethodCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::user::GetUserInfoRequest, ::im::user::GetUserInfoResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::user::GetUserInfoRequest* request, ::im::user::GetUserInfoResponse* response) { return this->GetUserInfo(context, request, response); }));}
-    void SetMessageAllocatorFor_GetUserInfo(
-        ::grpc::MessageAllocator< ::im::user::GetUserInfoRequest, ::im::user::GetUserInfoResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(2);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::user::GetUserInfoRequest, ::im::user::GetUserInfoResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_GetUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::GetUserInfoRequest* /*request*/, ::im::user::GetUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetUserInfo(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::user::GetUserInfoRequest* /*request*/, ::im::user::GetUserInfoResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_SearchUsers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_SearchUsers() {
-      ::grpc::Service::MarkMethodCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::user::SearchUsersRequest, ::im::user::SearchUsersResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::user::SearchUsersRequest* request, ::im::user::SearchUsersResponse* response) { return this->SearchUsers(context, request, response); }));}
-    void SetMessageAllocatorFor_SearchUsers(
-        ::grpc::MessageAllocator< ::im::user::SearchUsersRequest, ::im::user::SearchUsersResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(3);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::user::SearchUsersRequest, ::im::user::SearchUsersResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_SearchUsers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchUsers(::grpc::ServerContext* /*context*/, const ::im::user::SearchUsersRequest* /*request*/, ::im::user::SearchUsersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SearchUsers(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::user::SearchUsersRequest* /*request*/, ::im::user::SearchUsersResponse* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithCallbackMethod_UpdateUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithCallbackMethod_UpdateUserInfo() {
-      ::grpc::Service::MarkMethodCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::im::user::UpdateUserInfoRequest, ::im::user::UpdateUserInfoResponse>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::im::user::UpdateUserInfoRequest* request, ::im::user::UpdateUserInfoResponse* response) { return this->UpdateUserInfo(context, request, response); }));}
-    void SetMessageAllocatorFor_UpdateUserInfo(
-        ::grpc::MessageAllocator< ::im::user::UpdateUserInfoRequest, ::im::user::UpdateUserInfoResponse>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
-      static_cast<::grpc::internal::CallbackUnaryHandler< ::im::user::UpdateUserInfoRequest, ::im::user::UpdateUserInfoResponse>*>(handler)
-              ->SetMessageAllocator(allocator);
-    }
-    ~WithCallbackMethod_UpdateUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status UpdateUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::UpdateUserInfoRequest* /*request*/, ::im::user::UpdateUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* UpdateUserInfo(
-      ::grpc::CallbackServerContext* /*context*/, const ::im::user::UpdateUserInfoRequest* /*request*/, ::im::user::UpdateUserInfoResponse* /*response*/)  { return nullptr; }
-  };
-  typedef WithCallbackMethod_Register<WithCallbackMethod_Login<WithCallbackMethod_GetUserInfo<WithCallbackMethod_SearchUsers<WithCallbackMethod_UpdateUserInfo<Service > > > > > CallbackService;
-  typedef CallbackService ExperimentalCallbackService;
-  template <class BaseClass>
-  class WithGenericMethod_Register : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_Register() {
-      ::grpc::Service::MarkMethodGeneric(0);
-    }
-    ~WithGenericMethod_Register() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Register(::grpc::ServerContext* /*context*/, const ::im::user::RegisterRequest* /*request*/, ::im::user::RegisterResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_Login : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_Login() {
-      ::grpc::Service::MarkMethodGeneric(1);
-    }
-    ~WithGenericMethod_Login() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Login(::grpc::ServerContext* /*context*/, const ::im::user::LoginRequest* /*request*/, ::im::user::LoginResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_GetUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_GetUserInfo() {
-      ::grpc::Service::MarkMethodGeneric(2);
-    }
-    ~WithGenericMethod_GetUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::GetUserInfoRequest* /*request*/, ::im::user::GetUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_SearchUsers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_SearchUsers() {
-      ::grpc::Service::MarkMethodGeneric(3);
-    }
-    ~WithGenericMethod_SearchUsers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchUsers(::grpc::ServerContext* /*context*/, const ::im::user::SearchUsersRequest* /*request*/, ::im::user::SearchUsersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithGenericMethod_UpdateUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithGenericMethod_UpdateUserInfo() {
-      ::grpc::Service::MarkMethodGeneric(4);
-    }
-    ~WithGenericMethod_UpdateUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status UpdateUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::UpdateUserInfoRequest* /*request*/, ::im::user::UpdateUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_Register : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_Register() {
-      ::grpc::Service::MarkMethodRaw(0);
-    }
-    ~WithRawMethod_Register() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Register(::grpc::ServerContext* /*context*/, const ::im::user::RegisterRequest* /*request*/, ::im::user::RegisterResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestRegister(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_Login : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_Login() {
-      ::grpc::Service::MarkMethodRaw(1);
-    }
-    ~WithRawMethod_Login() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Login(::grpc::ServerContext* /*context*/, const ::im::user::LoginRequest* /*request*/, ::im::user::LoginResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestLogin(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(1, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_GetUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_GetUserInfo() {
-      ::grpc::Service::MarkMethodRaw(2);
-    }
-    ~WithRawMethod_GetUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::GetUserInfoRequest* /*request*/, ::im::user::GetUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestGetUserInfo(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(2, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_SearchUsers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_SearchUsers() {
-      ::grpc::Service::MarkMethodRaw(3);
-    }
-    ~WithRawMethod_SearchUsers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchUsers(::grpc::ServerContext* /*context*/, const ::im::user::SearchUsersRequest* /*request*/, ::im::user::SearchUsersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestSearchUsers(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawMethod_UpdateUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawMethod_UpdateUserInfo() {
-      ::grpc::Service::MarkMethodRaw(4);
-    }
-    ~WithRawMethod_UpdateUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status UpdateUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::UpdateUserInfoRequest* /*request*/, ::im::user::UpdateUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    void RequestUpdateUserInfo(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
-    }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_Register : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_Register() {
-      ::grpc::Service::MarkMethodRawCallback(0,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Register(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_Register() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Register(::grpc::ServerContext* /*context*/, const ::im::user::RegisterRequest* /*request*/, ::im::user::RegisterResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Register(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_Login : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_Login() {
-      ::grpc::Service::MarkMethodRawCallback(1,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->Login(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_Login() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status Login(::grpc::ServerContext* /*context*/, const ::im::user::LoginRequest* /*request*/, ::im::user::LoginResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* Login(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_GetUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_GetUserInfo() {
-      ::grpc::Service::MarkMethodRawCallback(2,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetUserInfo(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_GetUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status GetUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::GetUserInfoRequest* /*request*/, ::im::user::GetUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* GetUserInfo(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_SearchUsers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_SearchUsers() {
-      ::grpc::Service::MarkMethodRawCallback(3,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SearchUsers(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_SearchUsers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status SearchUsers(::grpc::ServerContext* /*context*/, const ::im::user::SearchUsersRequest* /*request*/, ::im::user::SearchUsersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* SearchUsers(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithRawCallbackMethod_UpdateUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithRawCallbackMethod_UpdateUserInfo() {
-      ::grpc::Service::MarkMethodRawCallback(4,
-          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
-            [this](
-                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->UpdateUserInfo(context, request, response); }));
-    }
-    ~WithRawCallbackMethod_UpdateUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable synchronous version of this method
-    ::grpc::Status UpdateUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::UpdateUserInfoRequest* /*request*/, ::im::user::UpdateUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    virtual ::grpc::ServerUnaryReactor* UpdateUserInfo(
-      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_Register : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_Register() {
-      ::grpc::Service::MarkMethodStreamed(0,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::user::RegisterRequest, ::im::user::RegisterResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::user::RegisterRequest, ::im::user::RegisterResponse>* streamer) {
-                       return this->StreamedRegister(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_Register() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status Register(::grpc::ServerContext* /*context*/, const ::im::user::RegisterRequest* /*request*/, ::im::user::RegisterResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedRegister(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::user::RegisterRequest,::im::user::RegisterResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_Login : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_Login() {
-      ::grpc::Service::MarkMethodStreamed(1,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::user::LoginRequest, ::im::user::LoginResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::user::LoginRequest, ::im::user::LoginResponse>* streamer) {
-                       return this->StreamedLogin(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_Login() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status Login(::grpc::ServerContext* /*context*/, const ::im::user::LoginRequest* /*request*/, ::im::user::LoginResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedLogin(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::user::LoginRequest,::im::user::LoginResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_GetUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_GetUserInfo() {
-      ::grpc::Service::MarkMethodStreamed(2,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::user::GetUserInfoRequest, ::im::user::GetUserInfoResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::user::GetUserInfoRequest, ::im::user::GetUserInfoResponse>* streamer) {
-                       return this->StreamedGetUserInfo(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_GetUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status GetUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::GetUserInfoRequest* /*request*/, ::im::user::GetUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedGetUserInfo(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::user::GetUserInfoRequest,::im::user::GetUserInfoResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_SearchUsers : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_SearchUsers() {
-      ::grpc::Service::MarkMethodStreamed(3,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::user::SearchUsersRequest, ::im::user::SearchUsersResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::user::SearchUsersRequest, ::im::user::SearchUsersResponse>* streamer) {
-                       return this->StreamedSearchUsers(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_SearchUsers() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status SearchUsers(::grpc::ServerContext* /*context*/, const ::im::user::SearchUsersRequest* /*request*/, ::im::user::SearchUsersResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedSearchUsers(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::user::SearchUsersRequest,::im::user::SearchUsersResponse>* server_unary_streamer) = 0;
-  };
-  template <class BaseClass>
-  class WithStreamedUnaryMethod_UpdateUserInfo : public BaseClass {
-   private:
-    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
-   public:
-    WithStreamedUnaryMethod_UpdateUserInfo() {
-      ::grpc::Service::MarkMethodStreamed(4,
-        new ::grpc::internal::StreamedUnaryHandler<
-          ::im::user::UpdateUserInfoRequest, ::im::user::UpdateUserInfoResponse>(
-            [this](::grpc::ServerContext* context,
-                   ::grpc::ServerUnaryStreamer<
-                     ::im::user::UpdateUserInfoRequest, ::im::user::UpdateUserInfoResponse>* streamer) {
-                       return this->StreamedUpdateUserInfo(context,
-                         streamer);
-                  }));
-    }
-    ~WithStreamedUnaryMethod_UpdateUserInfo() override {
-      BaseClassMustBeDerivedFromService(this);
-    }
-    // disable regular version of this method
-    ::grpc::Status UpdateUserInfo(::grpc::ServerContext* /*context*/, const ::im::user::UpdateUserInfoRequest* /*request*/, ::im::user::UpdateUserInfoResponse* /*response*/) override {
-      abort();
-      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
-    }
-    // replace default version of method with streamed unary
-    virtual ::grpc::Status StreamedUpdateUserInfo(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::im::user::UpdateUserInfoRequest,::im::user::UpdateUserInfoResponse>* server_unary_streamer) = 0;
-  };
-  typedef WithStreamedUnaryMethod_Register<WithStreamedUnaryMethod_Login<WithStreamedUnaryMethod_GetUserInfo<WithStreamedUnaryMethod_SearchUsers<WithStreamedUnaryMethod_UpdateUserInfo<Service > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_Register<WithStreamedUnaryMethod_Login<WithStreamedUnaryMethod_GetUserInfo<WithStreamedUnaryMethod_SearchUsers<WithStreamedUnaryMethod_UpdateUserInfo<Service > > > > > StreamedService;
-};
-
-}  // namespace user
-}  // namespace im
-
-
-#include <grpcpp/ports_undef.inc>
-#endif  // GRPC_user_2eproto__INCLUDED
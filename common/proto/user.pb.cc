@@ -1,4860 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// NO CHECKED-IN PROTOBUF GENCODE
-// source: user.proto
-// Protobuf C++ Version: 5.29.3
-
-#include "user.pb.h"
-
-#include <algorithm>
-#include <type_traits>
-#include "google/protobuf/io/coded_stream.h"
-#include "google/protobuf/generated_message_tctable_impl.h"
-#include "google/protobuf/extension_set.h"
-#include "google/protobuf/generated_message_util.h"
-#include "google/protobuf/wire_format_lite.h"
-#include "google/protobuf/descriptor.h"
-#include "google/protobuf/generated_message_reflection.h"
-#include "google/protobuf/reflection_ops.h"
-#include "google/protobuf/wire_format.h"
-// @@protoc_insertion_point(includes)
-
-// Must be included last.
-#include "google/protobuf/port_def.inc"
-PROTOBUF_PRAGMA_INIT_SEG
-namespace _pb = ::google::protobuf;
-namespace _pbi = ::google::protobuf::internal;
-namespace _fl = ::google::protobuf::internal::field_layout;
-namespace im {
-namespace user {
-
-inline constexpr UserInfo::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : uid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        account_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        nickname_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        avatar_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        signature_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        phone_number_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        email_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        address_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        birthday_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        company_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        job_title_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        wxid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        qqid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        real_name_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        extra_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        create_time_{::int64_t{0}},
-        gender_{static_cast< ::im::user::Gender >(0)},
-        online_{false},
-        last_login_{::int64_t{0}},
-        _cached_size_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR UserInfo::UserInfo(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct UserInfoDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR UserInfoDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~UserInfoDefaultTypeInternal() {}
-  union {
-    UserInfo _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserInfoDefaultTypeInternal _UserInfo_default_instance_;
-
-inline constexpr UpdateUserInfoResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr},
-        user_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR UpdateUserInfoResponse::UpdateUserInfoResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct UpdateUserInfoResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR UpdateUserInfoResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~UpdateUserInfoResponseDefaultTypeInternal() {}
-  union {
-    UpdateUserInfoResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateUserInfoResponseDefaultTypeInternal _UpdateUserInfoResponse_default_instance_;
-
-inline constexpr UpdateUserInfoRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        header_{nullptr},
-        user_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR UpdateUserInfoRequest::UpdateUserInfoRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct UpdateUserInfoRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR UpdateUserInfoRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~UpdateUserInfoRequestDefaultTypeInternal() {}
-  union {
-    UpdateUserInfoRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateUserInfoRequestDefaultTypeInternal _UpdateUserInfoRequest_default_instance_;
-
-inline constexpr SearchUsersResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        users_{},
-        base_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SearchUsersResponse::SearchUsersResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SearchUsersResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SearchUsersResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SearchUsersResponseDefaultTypeInternal() {}
-  union {
-    SearchUsersResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchUsersResponseDefaultTypeInternal _SearchUsersResponse_default_instance_;
-
-inline constexpr SearchUsersRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        keyword_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr},
-        limit_{0} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR SearchUsersRequest::SearchUsersRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct SearchUsersRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR SearchUsersRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~SearchUsersRequestDefaultTypeInternal() {}
-  union {
-    SearchUsersRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SearchUsersRequestDefaultTypeInternal _SearchUsersRequest_default_instance_;
-
-inline constexpr RegisterResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr},
-        user_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR RegisterResponse::RegisterResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct RegisterResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR RegisterResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~RegisterResponseDefaultTypeInternal() {}
-  union {
-    RegisterResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterResponseDefaultTypeInternal _RegisterResponse_default_instance_;
-
-inline constexpr RegisterRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        phone_number_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        email_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        password_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        nickname_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        avatar_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        verify_code_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        account_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr},
-        type_{static_cast< ::im::user::RegisterType >(0)} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR RegisterRequest::RegisterRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct RegisterRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR RegisterRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~RegisterRequestDefaultTypeInternal() {}
-  union {
-    RegisterRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RegisterRequestDefaultTypeInternal _RegisterRequest_default_instance_;
-
-inline constexpr LoginResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr},
-        user_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR LoginResponse::LoginResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct LoginResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR LoginResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~LoginResponseDefaultTypeInternal() {}
-  union {
-    LoginResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LoginResponseDefaultTypeInternal _LoginResponse_default_instance_;
-
-inline constexpr LoginRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        account_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        phone_number_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        email_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        password_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr},
-        type_{static_cast< ::im::user::LoginType >(0)} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR LoginRequest::LoginRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct LoginRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR LoginRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~LoginRequestDefaultTypeInternal() {}
-  union {
-    LoginRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LoginRequestDefaultTypeInternal _LoginRequest_default_instance_;
-
-inline constexpr GetUserInfoResponse::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        base_{nullptr},
-        user_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetUserInfoResponse::GetUserInfoResponse(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetUserInfoResponseDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetUserInfoResponseDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetUserInfoResponseDefaultTypeInternal() {}
-  union {
-    GetUserInfoResponse _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUserInfoResponseDefaultTypeInternal _GetUserInfoResponse_default_instance_;
-
-inline constexpr GetUserInfoRequest::Impl_::Impl_(
-    ::_pbi::ConstantInitialized) noexcept
-      : _cached_size_{0},
-        account_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        uid_(
-            &::google::protobuf::internal::fixed_address_empty_string,
-            ::_pbi::ConstantInitialized()),
-        header_{nullptr} {}
-
-template <typename>
-PROTOBUF_CONSTEXPR GetUserInfoRequest::GetUserInfoRequest(::_pbi::ConstantInitialized)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(_class_data_.base()),
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(),
-#endif  // PROTOBUF_CUSTOM_VTABLE
-      _impl_(::_pbi::ConstantInitialized()) {
-}
-struct GetUserInfoRequestDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR GetUserInfoRequestDefaultTypeInternal() : _instance(::_pbi::ConstantInitialized{}) {}
-  ~GetUserInfoRequestDefaultTypeInternal() {}
-  union {
-    GetUserInfoRequest _instance;
-  };
-};
-
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT
-    PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUserInfoRequestDefaultTypeInternal _GetUserInfoRequest_default_instance_;
-}  // namespace user
-}  // namespace im
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_user_2eproto[3];
-static constexpr const ::_pb::ServiceDescriptor**
-    file_level_service_descriptors_user_2eproto = nullptr;
-const ::uint32_t
-    TableStruct_user_2eproto::offsets[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-        protodesc_cold) = {
-        ~0u,  // no _has_bits_
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.uid_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.account_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.nickname_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.avatar_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.gender_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.signature_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.create_time_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.last_login_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.online_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.phone_number_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.email_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.address_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.birthday_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.company_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.job_title_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.wxid_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.qqid_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.real_name_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UserInfo, _impl_.extra_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_.type_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_.phone_number_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_.email_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_.password_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_.nickname_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_.avatar_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_.verify_code_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterRequest, _impl_.account_),
-        0,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::user::RegisterResponse, _impl_.user_),
-        0,
-        1,
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginRequest, _impl_.type_),
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginRequest, _impl_.account_),
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginRequest, _impl_.phone_number_),
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginRequest, _impl_.email_),
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginRequest, _impl_.password_),
-        0,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::user::LoginResponse, _impl_.user_),
-        0,
-        1,
-        PROTOBUF_FIELD_OFFSET(::im::user::GetUserInfoRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::GetUserInfoRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::GetUserInfoRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::user::GetUserInfoRequest, _impl_.account_),
-        PROTOBUF_FIELD_OFFSET(::im::user::GetUserInfoRequest, _impl_.uid_),
-        0,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::user::GetUserInfoResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::GetUserInfoResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::GetUserInfoResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::user::GetUserInfoResponse, _impl_.user_),
-        0,
-        1,
-        PROTOBUF_FIELD_OFFSET(::im::user::SearchUsersRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::SearchUsersRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::SearchUsersRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::user::SearchUsersRequest, _impl_.keyword_),
-        PROTOBUF_FIELD_OFFSET(::im::user::SearchUsersRequest, _impl_.limit_),
-        0,
-        ~0u,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::user::SearchUsersResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::SearchUsersResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::SearchUsersResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::user::SearchUsersResponse, _impl_.users_),
-        0,
-        ~0u,
-        PROTOBUF_FIELD_OFFSET(::im::user::UpdateUserInfoRequest, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UpdateUserInfoRequest, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::UpdateUserInfoRequest, _impl_.header_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UpdateUserInfoRequest, _impl_.user_),
-        0,
-        1,
-        PROTOBUF_FIELD_OFFSET(::im::user::UpdateUserInfoResponse, _impl_._has_bits_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UpdateUserInfoResponse, _internal_metadata_),
-        ~0u,  // no _extensions_
-        ~0u,  // no _oneof_case_
-        ~0u,  // no _weak_field_map_
-        ~0u,  // no _inlined_string_donated_
-        ~0u,  // no _split_
-        ~0u,  // no sizeof(Split)
-        PROTOBUF_FIELD_OFFSET(::im::user::UpdateUserInfoResponse, _impl_.base_),
-        PROTOBUF_FIELD_OFFSET(::im::user::UpdateUserInfoResponse, _impl_.user_),
-        0,
-        1,
-};
-
-static const ::_pbi::MigrationSchema
-    schemas[] ABSL_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-        {0, -1, -1, sizeof(::im::user::UserInfo)},
-        {27, 44, -1, sizeof(::im::user::RegisterRequest)},
-        {53, 63, -1, sizeof(::im::user::RegisterResponse)},
-        {65, 79, -1, sizeof(::im::user::LoginRequest)},
-        {85, 95, -1, sizeof(::im::user::LoginResponse)},
-        {97, 108, -1, sizeof(::im::user::GetUserInfoRequest)},
-        {111, 121, -1, sizeof(::im::user::GetUserInfoResponse)},
-        {123, 134, -1, sizeof(::im::user::SearchUsersRequest)},
-        {137, 147, -1, sizeof(::im::user::SearchUsersResponse)},
-        {149, 159, -1, sizeof(::im::user::UpdateUserInfoRequest)},
-        {161, 171, -1, sizeof(::im::user::UpdateUserInfoResponse)},
-};
-static const ::_pb::Message* const file_default_instances[] = {
-    &::im::user::_UserInfo_default_instance_._instance,
-    &::im::user::_RegisterRequest_default_instance_._instance,
-    &::im::user::_RegisterResponse_default_instance_._instance,
-    &::im::user::_LoginRequest_default_instance_._instance,
-    &::im::user::_LoginResponse_default_instance_._instance,
-    &::im::user::_GetUserInfoRequest_default_instance_._instance,
-    &::im::user::_GetUserInfoResponse_default_instance_._instance,
-    &::im::user::_SearchUsersRequest_default_instance_._instance,
-    &::im::user::_SearchUsersResponse_default_instance_._instance,
-    &::im::user::_UpdateUserInfoRequest_default_instance_._instance,
-    &::im::user::_UpdateUserInfoResponse_default_instance_._instance,
-};
-const char descriptor_table_protodef_user_2eproto[] ABSL_ATTRIBUTE_SECTION_VARIABLE(
-    protodesc_cold) = {
-    "\n\nuser.proto\022\007im.user\032\nbase.proto\"\341\002\n\010Us"
-    "erInfo\022\013\n\003uid\030\001 \001(\t\022\017\n\007account\030\002 \001(\t\022\020\n\010"
-    "nickname\030\003 \001(\t\022\016\n\006avatar\030\004 \001(\t\022\037\n\006gender"
-    "\030\005 \001(\0162\017.im.user.Gender\022\021\n\tsignature\030\006 \001"
-    "(\t\022\023\n\013create_time\030\007 \001(\003\022\022\n\nlast_login\030\010 "
-    "\001(\003\022\016\n\006online\030\t \001(\010\022\024\n\014phone_number\030\n \001("
-    "\t\022\r\n\005email\030\013 \001(\t\022\017\n\007address\030\014 \001(\t\022\020\n\010bir"
-    "thday\030\r \001(\t\022\017\n\007company\030\016 \001(\t\022\021\n\tjob_titl"
-    "e\030\017 \001(\t\022\014\n\004wxid\030\020 \001(\t\022\014\n\004qqid\030\021 \001(\t\022\021\n\tr"
-    "eal_name\030\022 \001(\t\022\r\n\005extra\030\023 \001(\t\"\330\001\n\017Regist"
-    "erRequest\022!\n\006header\030\001 \001(\0132\021.im.base.IMHe"
-    "ader\022#\n\004type\030\002 \001(\0162\025.im.user.RegisterTyp"
-    "e\022\024\n\014phone_number\030\003 \001(\t\022\r\n\005email\030\004 \001(\t\022\020"
-    "\n\010password\030\005 \001(\t\022\020\n\010nickname\030\006 \001(\t\022\016\n\006av"
-    "atar\030\007 \001(\t\022\023\n\013verify_code\030\010 \001(\t\022\017\n\007accou"
-    "nt\030\t \001(\t\"X\n\020RegisterResponse\022#\n\004base\030\001 \001"
-    "(\0132\025.im.base.BaseResponse\022\037\n\004user\030\002 \001(\0132"
-    "\021.im.user.UserInfo\"\233\001\n\014LoginRequest\022!\n\006h"
-    "eader\030\001 \001(\0132\021.im.base.IMHeader\022 \n\004type\030\002"
-    " \001(\0162\022.im.user.LoginType\022\017\n\007account\030\003 \001("
-    "\t\022\024\n\014phone_number\030\004 \001(\t\022\r\n\005email\030\005 \001(\t\022\020"
-    "\n\010password\030\006 \001(\t\"U\n\rLoginResponse\022#\n\004bas"
-    "e\030\001 \001(\0132\025.im.base.BaseResponse\022\037\n\004user\030\002"
-    " \001(\0132\021.im.user.UserInfo\"U\n\022GetUserInfoRe"
-    "quest\022!\n\006header\030\001 \001(\0132\021.im.base.IMHeader"
-    "\022\017\n\007account\030\002 \001(\t\022\013\n\003uid\030\003 \001(\t\"[\n\023GetUse"
-    "rInfoResponse\022#\n\004base\030\001 \001(\0132\025.im.base.Ba"
-    "seResponse\022\037\n\004user\030\002 \001(\0132\021.im.user.UserI"
-    "nfo\"W\n\022SearchUsersRequest\022!\n\006header\030\001 \001("
-    "\0132\021.im.base.IMHeader\022\017\n\007keyword\030\002 \001(\t\022\r\n"
-    "\005limit\030\003 \001(\005\"\\\n\023SearchUsersResponse\022#\n\004b"
-    "ase\030\001 \001(\0132\025.im.base.BaseResponse\022 \n\005user"
-    "s\030\002 \003(\0132\021.im.user.UserInfo\"[\n\025UpdateUser"
-    "InfoRequest\022!\n\006header\030\001 \001(\0132\021.im.base.IM"
-    "Header\022\037\n\004user\030\002 \001(\0132\021.im.user.UserInfo\""
-    "^\n\026UpdateUserInfoResponse\022#\n\004base\030\001 \001(\0132"
-    "\025.im.base.BaseResponse\022\037\n\004user\030\002 \001(\0132\021.i"
-    "m.user.UserInfo*L\n\014RegisterType\022\024\n\020REGIS"
-    "TER_UNKNOWN\020\000\022\022\n\016REGISTER_PHONE\020\001\022\022\n\016REG"
-    "ISTER_EMAIL\020\002*6\n\006Gender\022\013\n\007UNKNOWN\020\000\022\010\n\004"
-    "MALE\020\001\022\n\n\006FEMALE\020\002\022\t\n\005OTHER\020\003*S\n\tLoginTy"
-    "pe\022\021\n\rLOGIN_UNKNOWN\020\000\022\021\n\rLOGIN_ACCOUNT\020\001"
-    "\022\017\n\013LOGIN_PHONE\020\002\022\017\n\013LOGIN_EMAIL\020\0032\355\002\n\013U"
-    "serService\022\?\n\010Register\022\030.im.user.Registe"
-    "rRequest\032\031.im.user.RegisterResponse\0226\n\005L"
-    "ogin\022\025.im.user.LoginRequest\032\026.im.user.Lo"
-    "ginResponse\022H\n\013GetUserInfo\022\033.im.user.Get"
-    "UserInfoRequest\032\034.im.user.GetUserInfoRes"
-    "ponse\022H\n\013SearchUsers\022\033.im.user.SearchUse"
-    "rsRequest\032\034.im.user.SearchUsersResponse\022"
-    "Q\n\016UpdateUserInfo\022\036.im.user.UpdateUserIn"
-    "foRequest\032\037.im.user.UpdateUserInfoRespon"
-    "seb\006proto3"
-};
-static const ::_pbi::DescriptorTable* const descriptor_table_user_2eproto_deps[1] =
-    {
-        &::descriptor_table_base_2eproto,
-};
-static ::absl::once_flag descriptor_table_user_2eproto_once;
-PROTOBUF_CONSTINIT const ::_pbi::DescriptorTable descriptor_table_user_2eproto = {
-    false,
-    false,
-    2090,
-    descriptor_table_protodef_user_2eproto,
-    "user.proto",
-    &descriptor_table_user_2eproto_once,
-    descriptor_table_user_2eproto_deps,
-    1,
-    11,
-    schemas,
-    file_default_instances,
-    TableStruct_user_2eproto::offsets,
-    file_level_enum_descriptors_user_2eproto,
-    file_level_service_descriptors_user_2eproto,
-};
-namespace im {
-namespace user {
-const ::google::protobuf::EnumDescriptor* RegisterType_descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_user_2eproto);
-  return file_level_enum_descriptors_user_2eproto[0];
-}
-PROTOBUF_CONSTINIT const uint32_t RegisterType_internal_data_[] = {
-    196608u, 0u, };
-bool RegisterType_IsValid(int value) {
-  return 0 <= value && value <= 2;
-}
-const ::google::protobuf::EnumDescriptor* Gender_descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_user_2eproto);
-  return file_level_enum_descriptors_user_2eproto[1];
-}
-PROTOBUF_CONSTINIT const uint32_t Gender_internal_data_[] = {
-    262144u, 0u, };
-bool Gender_IsValid(int value) {
-  return 0 <= value && value <= 3;
-}
-const ::google::protobuf::EnumDescriptor* LoginType_descriptor() {
-  ::google::protobuf::internal::AssignDescriptors(&descriptor_table_user_2eproto);
-  return file_level_enum_descriptors_user_2eproto[2];
-}
-PROTOBUF_CONSTINIT const uint32_t LoginType_internal_data_[] = {
-    262144u, 0u, };
-bool LoginType_IsValid(int value) {
-  return 0 <= value && value <= 3;
-}
-// ===================================================================
-
-class UserInfo::_Internal {
- public:
-};
-
-UserInfo::UserInfo(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.UserInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE UserInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::UserInfo& from_msg)
-      : uid_(arena, from.uid_),
-        account_(arena, from.account_),
-        nickname_(arena, from.nickname_),
-        avatar_(arena, from.avatar_),
-        signature_(arena, from.signature_),
-        phone_number_(arena, from.phone_number_),
-        email_(arena, from.email_),
-        address_(arena, from.address_),
-        birthday_(arena, from.birthday_),
-        company_(arena, from.company_),
-        job_title_(arena, from.job_title_),
-        wxid_(arena, from.wxid_),
-        qqid_(arena, from.qqid_),
-        real_name_(arena, from.real_name_),
-        extra_(arena, from.extra_),
-        _cached_size_{0} {}
-
-UserInfo::UserInfo(
-    ::google::protobuf::Arena* arena,
-    const UserInfo& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  UserInfo* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::memcpy(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, create_time_),
-           reinterpret_cast<const char *>(&from._impl_) +
-               offsetof(Impl_, create_time_),
-           offsetof(Impl_, last_login_) -
-               offsetof(Impl_, create_time_) +
-               sizeof(Impl_::last_login_));
-
-  // @@protoc_insertion_point(copy_constructor:im.user.UserInfo)
-}
-inline PROTOBUF_NDEBUG_INLINE UserInfo::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : uid_(arena),
-        account_(arena),
-        nickname_(arena),
-        avatar_(arena),
-        signature_(arena),
-        phone_number_(arena),
-        email_(arena),
-        address_(arena),
-        birthday_(arena),
-        company_(arena),
-        job_title_(arena),
-        wxid_(arena),
-        qqid_(arena),
-        real_name_(arena),
-        extra_(arena),
-        _cached_size_{0} {}
-
-inline void UserInfo::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, create_time_),
-           0,
-           offsetof(Impl_, last_login_) -
-               offsetof(Impl_, create_time_) +
-               sizeof(Impl_::last_login_));
-}
-UserInfo::~UserInfo() {
-  // @@protoc_insertion_point(destructor:im.user.UserInfo)
-  SharedDtor(*this);
-}
-inline void UserInfo::SharedDtor(MessageLite& self) {
-  UserInfo& this_ = static_cast<UserInfo&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.uid_.Destroy();
-  this_._impl_.account_.Destroy();
-  this_._impl_.nickname_.Destroy();
-  this_._impl_.avatar_.Destroy();
-  this_._impl_.signature_.Destroy();
-  this_._impl_.phone_number_.Destroy();
-  this_._impl_.email_.Destroy();
-  this_._impl_.address_.Destroy();
-  this_._impl_.birthday_.Destroy();
-  this_._impl_.company_.Destroy();
-  this_._impl_.job_title_.Destroy();
-  this_._impl_.wxid_.Destroy();
-  this_._impl_.qqid_.Destroy();
-  this_._impl_.real_name_.Destroy();
-  this_._impl_.extra_.Destroy();
-  this_._impl_.~Impl_();
-}
-
-inline void* UserInfo::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) UserInfo(arena);
-}
-constexpr auto UserInfo::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(UserInfo),
-                                            alignof(UserInfo));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull UserInfo::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_UserInfo_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &UserInfo::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<UserInfo>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &UserInfo::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<UserInfo>(), &UserInfo::ByteSizeLong,
-            &UserInfo::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(UserInfo, _impl_._cached_size_),
-        false,
-    },
-    &UserInfo::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* UserInfo::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<5, 19, 0, 144, 2> UserInfo::_table_ = {
-  {
-    0,  // no _has_bits_
-    0, // no _extensions_
-    19, 248,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294443008,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    19,  // num_field_entries
-    0,  // num_aux_entries
-    offsetof(decltype(_table_), field_names),  // no aux_entries
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::UserInfo>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // string uid = 1;
-    {::_pbi::TcParser::FastUS1,
-     {10, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.uid_)}},
-    // string account = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.account_)}},
-    // string nickname = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.nickname_)}},
-    // string avatar = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.avatar_)}},
-    // .im.user.Gender gender = 5;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(UserInfo, _impl_.gender_), 63>(),
-     {40, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.gender_)}},
-    // string signature = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.signature_)}},
-    // int64 create_time = 7;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(UserInfo, _impl_.create_time_), 63>(),
-     {56, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.create_time_)}},
-    // int64 last_login = 8;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint64_t, offsetof(UserInfo, _impl_.last_login_), 63>(),
-     {64, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.last_login_)}},
-    // bool online = 9;
-    {::_pbi::TcParser::SingularVarintNoZag1<bool, offsetof(UserInfo, _impl_.online_), 63>(),
-     {72, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.online_)}},
-    // string phone_number = 10;
-    {::_pbi::TcParser::FastUS1,
-     {82, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.phone_number_)}},
-    // string email = 11;
-    {::_pbi::TcParser::FastUS1,
-     {90, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.email_)}},
-    // string address = 12;
-    {::_pbi::TcParser::FastUS1,
-     {98, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.address_)}},
-    // string birthday = 13;
-    {::_pbi::TcParser::FastUS1,
-     {106, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.birthday_)}},
-    // string company = 14;
-    {::_pbi::TcParser::FastUS1,
-     {114, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.company_)}},
-    // string job_title = 15;
-    {::_pbi::TcParser::FastUS1,
-     {122, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.job_title_)}},
-    // string wxid = 16;
-    {::_pbi::TcParser::FastUS2,
-     {386, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.wxid_)}},
-    // string qqid = 17;
-    {::_pbi::TcParser::FastUS2,
-     {394, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.qqid_)}},
-    // string real_name = 18;
-    {::_pbi::TcParser::FastUS2,
-     {402, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.real_name_)}},
-    // string extra = 19;
-    {::_pbi::TcParser::FastUS2,
-     {410, 63, 0, PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.extra_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // string uid = 1;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.uid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string account = 2;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.account_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string nickname = 3;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.nickname_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string avatar = 4;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.avatar_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // .im.user.Gender gender = 5;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.gender_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // string signature = 6;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.signature_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int64 create_time = 7;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.create_time_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // int64 last_login = 8;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.last_login_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt64)},
-    // bool online = 9;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.online_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kBool)},
-    // string phone_number = 10;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.phone_number_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string email = 11;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.email_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string address = 12;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.address_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string birthday = 13;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.birthday_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string company = 14;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.company_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string job_title = 15;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.job_title_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string wxid = 16;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.wxid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string qqid = 17;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.qqid_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string real_name = 18;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.real_name_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string extra = 19;
-    {PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.extra_), 0, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }},
-  // no aux_entries
-  {{
-    "\20\3\7\10\6\0\11\0\0\0\14\5\7\10\7\11\4\4\11\5\0\0\0\0"
-    "im.user.UserInfo"
-    "uid"
-    "account"
-    "nickname"
-    "avatar"
-    "signature"
-    "phone_number"
-    "email"
-    "address"
-    "birthday"
-    "company"
-    "job_title"
-    "wxid"
-    "qqid"
-    "real_name"
-    "extra"
-  }},
-};
-
-PROTOBUF_NOINLINE void UserInfo::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.UserInfo)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.uid_.ClearToEmpty();
-  _impl_.account_.ClearToEmpty();
-  _impl_.nickname_.ClearToEmpty();
-  _impl_.avatar_.ClearToEmpty();
-  _impl_.signature_.ClearToEmpty();
-  _impl_.phone_number_.ClearToEmpty();
-  _impl_.email_.ClearToEmpty();
-  _impl_.address_.ClearToEmpty();
-  _impl_.birthday_.ClearToEmpty();
-  _impl_.company_.ClearToEmpty();
-  _impl_.job_title_.ClearToEmpty();
-  _impl_.wxid_.ClearToEmpty();
-  _impl_.qqid_.ClearToEmpty();
-  _impl_.real_name_.ClearToEmpty();
-  _impl_.extra_.ClearToEmpty();
-  ::memset(&_impl_.create_time_, 0, static_cast<::size_t>(
-      reinterpret_cast<char*>(&_impl_.last_login_) -
-      reinterpret_cast<char*>(&_impl_.create_time_)) + sizeof(_impl_.last_login_));
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* UserInfo::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const UserInfo& this_ = static_cast<const UserInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* UserInfo::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const UserInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.UserInfo)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          // string uid = 1;
-          if (!this_._internal_uid().empty()) {
-            const std::string& _s = this_._internal_uid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.uid");
-            target = stream->WriteStringMaybeAliased(1, _s, target);
-          }
-
-          // string account = 2;
-          if (!this_._internal_account().empty()) {
-            const std::string& _s = this_._internal_account();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.account");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string nickname = 3;
-          if (!this_._internal_nickname().empty()) {
-            const std::string& _s = this_._internal_nickname();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.nickname");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string avatar = 4;
-          if (!this_._internal_avatar().empty()) {
-            const std::string& _s = this_._internal_avatar();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.avatar");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // .im.user.Gender gender = 5;
-          if (this_._internal_gender() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                5, this_._internal_gender(), target);
-          }
-
-          // string signature = 6;
-          if (!this_._internal_signature().empty()) {
-            const std::string& _s = this_._internal_signature();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.signature");
-            target = stream->WriteStringMaybeAliased(6, _s, target);
-          }
-
-          // int64 create_time = 7;
-          if (this_._internal_create_time() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<7>(
-                    stream, this_._internal_create_time(), target);
-          }
-
-          // int64 last_login = 8;
-          if (this_._internal_last_login() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt64ToArrayWithField<8>(
-                    stream, this_._internal_last_login(), target);
-          }
-
-          // bool online = 9;
-          if (this_._internal_online() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteBoolToArray(
-                9, this_._internal_online(), target);
-          }
-
-          // string phone_number = 10;
-          if (!this_._internal_phone_number().empty()) {
-            const std::string& _s = this_._internal_phone_number();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.phone_number");
-            target = stream->WriteStringMaybeAliased(10, _s, target);
-          }
-
-          // string email = 11;
-          if (!this_._internal_email().empty()) {
-            const std::string& _s = this_._internal_email();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.email");
-            target = stream->WriteStringMaybeAliased(11, _s, target);
-          }
-
-          // string address = 12;
-          if (!this_._internal_address().empty()) {
-            const std::string& _s = this_._internal_address();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.address");
-            target = stream->WriteStringMaybeAliased(12, _s, target);
-          }
-
-          // string birthday = 13;
-          if (!this_._internal_birthday().empty()) {
-            const std::string& _s = this_._internal_birthday();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.birthday");
-            target = stream->WriteStringMaybeAliased(13, _s, target);
-          }
-
-          // string company = 14;
-          if (!this_._internal_company().empty()) {
-            const std::string& _s = this_._internal_company();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.company");
-            target = stream->WriteStringMaybeAliased(14, _s, target);
-          }
-
-          // string job_title = 15;
-          if (!this_._internal_job_title().empty()) {
-            const std::string& _s = this_._internal_job_title();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.job_title");
-            target = stream->WriteStringMaybeAliased(15, _s, target);
-          }
-
-          // string wxid = 16;
-          if (!this_._internal_wxid().empty()) {
-            const std::string& _s = this_._internal_wxid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.wxid");
-            target = stream->WriteStringMaybeAliased(16, _s, target);
-          }
-
-          // string qqid = 17;
-          if (!this_._internal_qqid().empty()) {
-            const std::string& _s = this_._internal_qqid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.qqid");
-            target = stream->WriteStringMaybeAliased(17, _s, target);
-          }
-
-          // string real_name = 18;
-          if (!this_._internal_real_name().empty()) {
-            const std::string& _s = this_._internal_real_name();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.real_name");
-            target = stream->WriteStringMaybeAliased(18, _s, target);
-          }
-
-          // string extra = 19;
-          if (!this_._internal_extra().empty()) {
-            const std::string& _s = this_._internal_extra();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.UserInfo.extra");
-            target = stream->WriteStringMaybeAliased(19, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.UserInfo)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t UserInfo::ByteSizeLong(const MessageLite& base) {
-          const UserInfo& this_ = static_cast<const UserInfo&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t UserInfo::ByteSizeLong() const {
-          const UserInfo& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.UserInfo)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string uid = 1;
-            if (!this_._internal_uid().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_uid());
-            }
-            // string account = 2;
-            if (!this_._internal_account().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_account());
-            }
-            // string nickname = 3;
-            if (!this_._internal_nickname().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_nickname());
-            }
-            // string avatar = 4;
-            if (!this_._internal_avatar().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_avatar());
-            }
-            // string signature = 6;
-            if (!this_._internal_signature().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_signature());
-            }
-            // string phone_number = 10;
-            if (!this_._internal_phone_number().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_phone_number());
-            }
-            // string email = 11;
-            if (!this_._internal_email().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_email());
-            }
-            // string address = 12;
-            if (!this_._internal_address().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_address());
-            }
-            // string birthday = 13;
-            if (!this_._internal_birthday().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_birthday());
-            }
-            // string company = 14;
-            if (!this_._internal_company().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_company());
-            }
-            // string job_title = 15;
-            if (!this_._internal_job_title().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_job_title());
-            }
-            // string wxid = 16;
-            if (!this_._internal_wxid().empty()) {
-              total_size += 2 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_wxid());
-            }
-            // string qqid = 17;
-            if (!this_._internal_qqid().empty()) {
-              total_size += 2 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_qqid());
-            }
-            // string real_name = 18;
-            if (!this_._internal_real_name().empty()) {
-              total_size += 2 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_real_name());
-            }
-            // string extra = 19;
-            if (!this_._internal_extra().empty()) {
-              total_size += 2 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_extra());
-            }
-            // int64 create_time = 7;
-            if (this_._internal_create_time() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_create_time());
-            }
-            // .im.user.Gender gender = 5;
-            if (this_._internal_gender() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_gender());
-            }
-            // bool online = 9;
-            if (this_._internal_online() != 0) {
-              total_size += 2;
-            }
-            // int64 last_login = 8;
-            if (this_._internal_last_login() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(
-                  this_._internal_last_login());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void UserInfo::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<UserInfo*>(&to_msg);
-  auto& from = static_cast<const UserInfo&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.UserInfo)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_uid().empty()) {
-    _this->_internal_set_uid(from._internal_uid());
-  }
-  if (!from._internal_account().empty()) {
-    _this->_internal_set_account(from._internal_account());
-  }
-  if (!from._internal_nickname().empty()) {
-    _this->_internal_set_nickname(from._internal_nickname());
-  }
-  if (!from._internal_avatar().empty()) {
-    _this->_internal_set_avatar(from._internal_avatar());
-  }
-  if (!from._internal_signature().empty()) {
-    _this->_internal_set_signature(from._internal_signature());
-  }
-  if (!from._internal_phone_number().empty()) {
-    _this->_internal_set_phone_number(from._internal_phone_number());
-  }
-  if (!from._internal_email().empty()) {
-    _this->_internal_set_email(from._internal_email());
-  }
-  if (!from._internal_address().empty()) {
-    _this->_internal_set_address(from._internal_address());
-  }
-  if (!from._internal_birthday().empty()) {
-    _this->_internal_set_birthday(from._internal_birthday());
-  }
-  if (!from._internal_company().empty()) {
-    _this->_internal_set_company(from._internal_company());
-  }
-  if (!from._internal_job_title().empty()) {
-    _this->_internal_set_job_title(from._internal_job_title());
-  }
-  if (!from._internal_wxid().empty()) {
-    _this->_internal_set_wxid(from._internal_wxid());
-  }
-  if (!from._internal_qqid().empty()) {
-    _this->_internal_set_qqid(from._internal_qqid());
-  }
-  if (!from._internal_real_name().empty()) {
-    _this->_internal_set_real_name(from._internal_real_name());
-  }
-  if (!from._internal_extra().empty()) {
-    _this->_internal_set_extra(from._internal_extra());
-  }
-  if (from._internal_create_time() != 0) {
-    _this->_impl_.create_time_ = from._impl_.create_time_;
-  }
-  if (from._internal_gender() != 0) {
-    _this->_impl_.gender_ = from._impl_.gender_;
-  }
-  if (from._internal_online() != 0) {
-    _this->_impl_.online_ = from._impl_.online_;
-  }
-  if (from._internal_last_login() != 0) {
-    _this->_impl_.last_login_ = from._impl_.last_login_;
-  }
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void UserInfo::CopyFrom(const UserInfo& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.UserInfo)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void UserInfo::InternalSwap(UserInfo* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.account_, &other->_impl_.account_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.nickname_, &other->_impl_.nickname_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.avatar_, &other->_impl_.avatar_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.signature_, &other->_impl_.signature_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.phone_number_, &other->_impl_.phone_number_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.address_, &other->_impl_.address_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.birthday_, &other->_impl_.birthday_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.company_, &other->_impl_.company_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.job_title_, &other->_impl_.job_title_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.wxid_, &other->_impl_.wxid_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.qqid_, &other->_impl_.qqid_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.real_name_, &other->_impl_.real_name_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.extra_, &other->_impl_.extra_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.last_login_)
-      + sizeof(UserInfo::_impl_.last_login_)
-      - PROTOBUF_FIELD_OFFSET(UserInfo, _impl_.create_time_)>(
-          reinterpret_cast<char*>(&_impl_.create_time_),
-          reinterpret_cast<char*>(&other->_impl_.create_time_));
-}
-
-::google::protobuf::Metadata UserInfo::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class RegisterRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<RegisterRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_._has_bits_);
-};
-
-void RegisterRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-RegisterRequest::RegisterRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.RegisterRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE RegisterRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::RegisterRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        phone_number_(arena, from.phone_number_),
-        email_(arena, from.email_),
-        password_(arena, from.password_),
-        nickname_(arena, from.nickname_),
-        avatar_(arena, from.avatar_),
-        verify_code_(arena, from.verify_code_),
-        account_(arena, from.account_) {}
-
-RegisterRequest::RegisterRequest(
-    ::google::protobuf::Arena* arena,
-    const RegisterRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  RegisterRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.type_ = from._impl_.type_;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.RegisterRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE RegisterRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        phone_number_(arena),
-        email_(arena),
-        password_(arena),
-        nickname_(arena),
-        avatar_(arena),
-        verify_code_(arena),
-        account_(arena) {}
-
-inline void RegisterRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, type_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::type_));
-}
-RegisterRequest::~RegisterRequest() {
-  // @@protoc_insertion_point(destructor:im.user.RegisterRequest)
-  SharedDtor(*this);
-}
-inline void RegisterRequest::SharedDtor(MessageLite& self) {
-  RegisterRequest& this_ = static_cast<RegisterRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.phone_number_.Destroy();
-  this_._impl_.email_.Destroy();
-  this_._impl_.password_.Destroy();
-  this_._impl_.nickname_.Destroy();
-  this_._impl_.avatar_.Destroy();
-  this_._impl_.verify_code_.Destroy();
-  this_._impl_.account_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* RegisterRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) RegisterRequest(arena);
-}
-constexpr auto RegisterRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(RegisterRequest),
-                                            alignof(RegisterRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull RegisterRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_RegisterRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &RegisterRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<RegisterRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &RegisterRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<RegisterRequest>(), &RegisterRequest::ByteSizeLong,
-            &RegisterRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_._cached_size_),
-        false,
-    },
-    &RegisterRequest::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* RegisterRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<4, 9, 1, 97, 2> RegisterRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    9, 120,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294966784,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    9,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::RegisterRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.header_)}},
-    // .im.user.RegisterType type = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(RegisterRequest, _impl_.type_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.type_)}},
-    // string phone_number = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.phone_number_)}},
-    // string email = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.email_)}},
-    // string password = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.password_)}},
-    // string nickname = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.nickname_)}},
-    // string avatar = 7;
-    {::_pbi::TcParser::FastUS1,
-     {58, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.avatar_)}},
-    // string verify_code = 8;
-    {::_pbi::TcParser::FastUS1,
-     {66, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.verify_code_)}},
-    // string account = 9;
-    {::_pbi::TcParser::FastUS1,
-     {74, 63, 0, PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.account_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.user.RegisterType type = 2;
-    {PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.type_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // string phone_number = 3;
-    {PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.phone_number_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string email = 4;
-    {PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.email_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string password = 5;
-    {PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.password_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string nickname = 6;
-    {PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.nickname_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string avatar = 7;
-    {PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.avatar_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string verify_code = 8;
-    {PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.verify_code_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string account = 9;
-    {PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.account_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\27\0\0\14\5\10\10\6\13\7\0\0\0\0\0\0"
-    "im.user.RegisterRequest"
-    "phone_number"
-    "email"
-    "password"
-    "nickname"
-    "avatar"
-    "verify_code"
-    "account"
-  }},
-};
-
-PROTOBUF_NOINLINE void RegisterRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.RegisterRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.phone_number_.ClearToEmpty();
-  _impl_.email_.ClearToEmpty();
-  _impl_.password_.ClearToEmpty();
-  _impl_.nickname_.ClearToEmpty();
-  _impl_.avatar_.ClearToEmpty();
-  _impl_.verify_code_.ClearToEmpty();
-  _impl_.account_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_.type_ = 0;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* RegisterRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const RegisterRequest& this_ = static_cast<const RegisterRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* RegisterRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const RegisterRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.RegisterRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.user.RegisterType type = 2;
-          if (this_._internal_type() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                2, this_._internal_type(), target);
-          }
-
-          // string phone_number = 3;
-          if (!this_._internal_phone_number().empty()) {
-            const std::string& _s = this_._internal_phone_number();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.RegisterRequest.phone_number");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string email = 4;
-          if (!this_._internal_email().empty()) {
-            const std::string& _s = this_._internal_email();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.RegisterRequest.email");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string password = 5;
-          if (!this_._internal_password().empty()) {
-            const std::string& _s = this_._internal_password();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.RegisterRequest.password");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // string nickname = 6;
-          if (!this_._internal_nickname().empty()) {
-            const std::string& _s = this_._internal_nickname();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.RegisterRequest.nickname");
-            target = stream->WriteStringMaybeAliased(6, _s, target);
-          }
-
-          // string avatar = 7;
-          if (!this_._internal_avatar().empty()) {
-            const std::string& _s = this_._internal_avatar();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.RegisterRequest.avatar");
-            target = stream->WriteStringMaybeAliased(7, _s, target);
-          }
-
-          // string verify_code = 8;
-          if (!this_._internal_verify_code().empty()) {
-            const std::string& _s = this_._internal_verify_code();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.RegisterRequest.verify_code");
-            target = stream->WriteStringMaybeAliased(8, _s, target);
-          }
-
-          // string account = 9;
-          if (!this_._internal_account().empty()) {
-            const std::string& _s = this_._internal_account();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.RegisterRequest.account");
-            target = stream->WriteStringMaybeAliased(9, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.RegisterRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t RegisterRequest::ByteSizeLong(const MessageLite& base) {
-          const RegisterRequest& this_ = static_cast<const RegisterRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t RegisterRequest::ByteSizeLong() const {
-          const RegisterRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.RegisterRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string phone_number = 3;
-            if (!this_._internal_phone_number().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_phone_number());
-            }
-            // string email = 4;
-            if (!this_._internal_email().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_email());
-            }
-            // string password = 5;
-            if (!this_._internal_password().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_password());
-            }
-            // string nickname = 6;
-            if (!this_._internal_nickname().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_nickname());
-            }
-            // string avatar = 7;
-            if (!this_._internal_avatar().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_avatar());
-            }
-            // string verify_code = 8;
-            if (!this_._internal_verify_code().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_verify_code());
-            }
-            // string account = 9;
-            if (!this_._internal_account().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_account());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // .im.user.RegisterType type = 2;
-            if (this_._internal_type() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_type());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void RegisterRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<RegisterRequest*>(&to_msg);
-  auto& from = static_cast<const RegisterRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.RegisterRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_phone_number().empty()) {
-    _this->_internal_set_phone_number(from._internal_phone_number());
-  }
-  if (!from._internal_email().empty()) {
-    _this->_internal_set_email(from._internal_email());
-  }
-  if (!from._internal_password().empty()) {
-    _this->_internal_set_password(from._internal_password());
-  }
-  if (!from._internal_nickname().empty()) {
-    _this->_internal_set_nickname(from._internal_nickname());
-  }
-  if (!from._internal_avatar().empty()) {
-    _this->_internal_set_avatar(from._internal_avatar());
-  }
-  if (!from._internal_verify_code().empty()) {
-    _this->_internal_set_verify_code(from._internal_verify_code());
-  }
-  if (!from._internal_account().empty()) {
-    _this->_internal_set_account(from._internal_account());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_type() != 0) {
-    _this->_impl_.type_ = from._impl_.type_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void RegisterRequest::CopyFrom(const RegisterRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.RegisterRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void RegisterRequest::InternalSwap(RegisterRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.phone_number_, &other->_impl_.phone_number_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.password_, &other->_impl_.password_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.nickname_, &other->_impl_.nickname_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.avatar_, &other->_impl_.avatar_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.verify_code_, &other->_impl_.verify_code_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.account_, &other->_impl_.account_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.type_)
-      + sizeof(RegisterRequest::_impl_.type_)
-      - PROTOBUF_FIELD_OFFSET(RegisterRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata RegisterRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class RegisterResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<RegisterResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(RegisterResponse, _impl_._has_bits_);
-};
-
-void RegisterResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-RegisterResponse::RegisterResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.RegisterResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE RegisterResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::RegisterResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-RegisterResponse::RegisterResponse(
-    ::google::protobuf::Arena* arena,
-    const RegisterResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  RegisterResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-  _impl_.user_ = (cached_has_bits & 0x00000002u) ? ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(
-                              arena, *from._impl_.user_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.RegisterResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE RegisterResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void RegisterResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, base_),
-           0,
-           offsetof(Impl_, user_) -
-               offsetof(Impl_, base_) +
-               sizeof(Impl_::user_));
-}
-RegisterResponse::~RegisterResponse() {
-  // @@protoc_insertion_point(destructor:im.user.RegisterResponse)
-  SharedDtor(*this);
-}
-inline void RegisterResponse::SharedDtor(MessageLite& self) {
-  RegisterResponse& this_ = static_cast<RegisterResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  delete this_._impl_.user_;
-  this_._impl_.~Impl_();
-}
-
-inline void* RegisterResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) RegisterResponse(arena);
-}
-constexpr auto RegisterResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(RegisterResponse),
-                                            alignof(RegisterResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull RegisterResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_RegisterResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &RegisterResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<RegisterResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &RegisterResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<RegisterResponse>(), &RegisterResponse::ByteSizeLong,
-            &RegisterResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(RegisterResponse, _impl_._cached_size_),
-        false,
-    },
-    &RegisterResponse::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* RegisterResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> RegisterResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(RegisterResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::RegisterResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.user.UserInfo user = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(RegisterResponse, _impl_.user_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(RegisterResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(RegisterResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.user.UserInfo user = 2;
-    {PROTOBUF_FIELD_OFFSET(RegisterResponse, _impl_.user_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::user::UserInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void RegisterResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.RegisterResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.base_ != nullptr);
-      _impl_.base_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.user_ != nullptr);
-      _impl_.user_->Clear();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* RegisterResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const RegisterResponse& this_ = static_cast<const RegisterResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* RegisterResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const RegisterResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.RegisterResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.user.UserInfo user = 2;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.user_, this_._impl_.user_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.RegisterResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t RegisterResponse::ByteSizeLong(const MessageLite& base) {
-          const RegisterResponse& this_ = static_cast<const RegisterResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t RegisterResponse::ByteSizeLong() const {
-          const RegisterResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.RegisterResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // .im.base.BaseResponse base = 1;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-            // .im.user.UserInfo user = 2;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.user_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void RegisterResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<RegisterResponse*>(&to_msg);
-  auto& from = static_cast<const RegisterResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.RegisterResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(from._impl_.base_ != nullptr);
-      if (_this->_impl_.base_ == nullptr) {
-        _this->_impl_.base_ =
-            ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-      } else {
-        _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-      }
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(from._impl_.user_ != nullptr);
-      if (_this->_impl_.user_ == nullptr) {
-        _this->_impl_.user_ =
-            ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(arena, *from._impl_.user_);
-      } else {
-        _this->_impl_.user_->MergeFrom(*from._impl_.user_);
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void RegisterResponse::CopyFrom(const RegisterResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.RegisterResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void RegisterResponse::InternalSwap(RegisterResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(RegisterResponse, _impl_.user_)
-      + sizeof(RegisterResponse::_impl_.user_)
-      - PROTOBUF_FIELD_OFFSET(RegisterResponse, _impl_.base_)>(
-          reinterpret_cast<char*>(&_impl_.base_),
-          reinterpret_cast<char*>(&other->_impl_.base_));
-}
-
-::google::protobuf::Metadata RegisterResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class LoginRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<LoginRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_._has_bits_);
-};
-
-void LoginRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-LoginRequest::LoginRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.LoginRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::LoginRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        account_(arena, from.account_),
-        phone_number_(arena, from.phone_number_),
-        email_(arena, from.email_),
-        password_(arena, from.password_) {}
-
-LoginRequest::LoginRequest(
-    ::google::protobuf::Arena* arena,
-    const LoginRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  LoginRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.type_ = from._impl_.type_;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.LoginRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        account_(arena),
-        phone_number_(arena),
-        email_(arena),
-        password_(arena) {}
-
-inline void LoginRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, type_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::type_));
-}
-LoginRequest::~LoginRequest() {
-  // @@protoc_insertion_point(destructor:im.user.LoginRequest)
-  SharedDtor(*this);
-}
-inline void LoginRequest::SharedDtor(MessageLite& self) {
-  LoginRequest& this_ = static_cast<LoginRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.account_.Destroy();
-  this_._impl_.phone_number_.Destroy();
-  this_._impl_.email_.Destroy();
-  this_._impl_.password_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* LoginRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) LoginRequest(arena);
-}
-constexpr auto LoginRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(LoginRequest),
-                                            alignof(LoginRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull LoginRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_LoginRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &LoginRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<LoginRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &LoginRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<LoginRequest>(), &LoginRequest::ByteSizeLong,
-            &LoginRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_._cached_size_),
-        false,
-    },
-    &LoginRequest::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* LoginRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<3, 6, 1, 61, 2> LoginRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    6, 56,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967232,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    6,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::LoginRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.header_)}},
-    // .im.user.LoginType type = 2;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(LoginRequest, _impl_.type_), 63>(),
-     {16, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.type_)}},
-    // string account = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.account_)}},
-    // string phone_number = 4;
-    {::_pbi::TcParser::FastUS1,
-     {34, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.phone_number_)}},
-    // string email = 5;
-    {::_pbi::TcParser::FastUS1,
-     {42, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.email_)}},
-    // string password = 6;
-    {::_pbi::TcParser::FastUS1,
-     {50, 63, 0, PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.password_)}},
-    {::_pbi::TcParser::MiniParse, {}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.user.LoginType type = 2;
-    {PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.type_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kOpenEnum)},
-    // string account = 3;
-    {PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.account_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string phone_number = 4;
-    {PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.phone_number_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string email = 5;
-    {PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.email_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string password = 6;
-    {PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.password_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\24\0\0\7\14\5\10\0"
-    "im.user.LoginRequest"
-    "account"
-    "phone_number"
-    "email"
-    "password"
-  }},
-};
-
-PROTOBUF_NOINLINE void LoginRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.LoginRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.account_.ClearToEmpty();
-  _impl_.phone_number_.ClearToEmpty();
-  _impl_.email_.ClearToEmpty();
-  _impl_.password_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_.type_ = 0;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* LoginRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const LoginRequest& this_ = static_cast<const LoginRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* LoginRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const LoginRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.LoginRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.user.LoginType type = 2;
-          if (this_._internal_type() != 0) {
-            target = stream->EnsureSpace(target);
-            target = ::_pbi::WireFormatLite::WriteEnumToArray(
-                2, this_._internal_type(), target);
-          }
-
-          // string account = 3;
-          if (!this_._internal_account().empty()) {
-            const std::string& _s = this_._internal_account();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.LoginRequest.account");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          // string phone_number = 4;
-          if (!this_._internal_phone_number().empty()) {
-            const std::string& _s = this_._internal_phone_number();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.LoginRequest.phone_number");
-            target = stream->WriteStringMaybeAliased(4, _s, target);
-          }
-
-          // string email = 5;
-          if (!this_._internal_email().empty()) {
-            const std::string& _s = this_._internal_email();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.LoginRequest.email");
-            target = stream->WriteStringMaybeAliased(5, _s, target);
-          }
-
-          // string password = 6;
-          if (!this_._internal_password().empty()) {
-            const std::string& _s = this_._internal_password();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.LoginRequest.password");
-            target = stream->WriteStringMaybeAliased(6, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.LoginRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t LoginRequest::ByteSizeLong(const MessageLite& base) {
-          const LoginRequest& this_ = static_cast<const LoginRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t LoginRequest::ByteSizeLong() const {
-          const LoginRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.LoginRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string account = 3;
-            if (!this_._internal_account().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_account());
-            }
-            // string phone_number = 4;
-            if (!this_._internal_phone_number().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_phone_number());
-            }
-            // string email = 5;
-            if (!this_._internal_email().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_email());
-            }
-            // string password = 6;
-            if (!this_._internal_password().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_password());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // .im.user.LoginType type = 2;
-            if (this_._internal_type() != 0) {
-              total_size += 1 +
-                            ::_pbi::WireFormatLite::EnumSize(this_._internal_type());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void LoginRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<LoginRequest*>(&to_msg);
-  auto& from = static_cast<const LoginRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.LoginRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_account().empty()) {
-    _this->_internal_set_account(from._internal_account());
-  }
-  if (!from._internal_phone_number().empty()) {
-    _this->_internal_set_phone_number(from._internal_phone_number());
-  }
-  if (!from._internal_email().empty()) {
-    _this->_internal_set_email(from._internal_email());
-  }
-  if (!from._internal_password().empty()) {
-    _this->_internal_set_password(from._internal_password());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_type() != 0) {
-    _this->_impl_.type_ = from._impl_.type_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void LoginRequest::CopyFrom(const LoginRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.LoginRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void LoginRequest::InternalSwap(LoginRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.account_, &other->_impl_.account_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.phone_number_, &other->_impl_.phone_number_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.email_, &other->_impl_.email_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.password_, &other->_impl_.password_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.type_)
-      + sizeof(LoginRequest::_impl_.type_)
-      - PROTOBUF_FIELD_OFFSET(LoginRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata LoginRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class LoginResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<LoginResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_._has_bits_);
-};
-
-void LoginResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-LoginResponse::LoginResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.LoginResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::LoginResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-LoginResponse::LoginResponse(
-    ::google::protobuf::Arena* arena,
-    const LoginResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  LoginResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-  _impl_.user_ = (cached_has_bits & 0x00000002u) ? ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(
-                              arena, *from._impl_.user_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.LoginResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE LoginResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void LoginResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, base_),
-           0,
-           offsetof(Impl_, user_) -
-               offsetof(Impl_, base_) +
-               sizeof(Impl_::user_));
-}
-LoginResponse::~LoginResponse() {
-  // @@protoc_insertion_point(destructor:im.user.LoginResponse)
-  SharedDtor(*this);
-}
-inline void LoginResponse::SharedDtor(MessageLite& self) {
-  LoginResponse& this_ = static_cast<LoginResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  delete this_._impl_.user_;
-  this_._impl_.~Impl_();
-}
-
-inline void* LoginResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) LoginResponse(arena);
-}
-constexpr auto LoginResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(LoginResponse),
-                                            alignof(LoginResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull LoginResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_LoginResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &LoginResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<LoginResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &LoginResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<LoginResponse>(), &LoginResponse::ByteSizeLong,
-            &LoginResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_._cached_size_),
-        false,
-    },
-    &LoginResponse::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* LoginResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> LoginResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::LoginResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.user.UserInfo user = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.user_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.user.UserInfo user = 2;
-    {PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.user_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::user::UserInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void LoginResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.LoginResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.base_ != nullptr);
-      _impl_.base_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.user_ != nullptr);
-      _impl_.user_->Clear();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* LoginResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const LoginResponse& this_ = static_cast<const LoginResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* LoginResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const LoginResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.LoginResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.user.UserInfo user = 2;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.user_, this_._impl_.user_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.LoginResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t LoginResponse::ByteSizeLong(const MessageLite& base) {
-          const LoginResponse& this_ = static_cast<const LoginResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t LoginResponse::ByteSizeLong() const {
-          const LoginResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.LoginResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // .im.base.BaseResponse base = 1;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-            // .im.user.UserInfo user = 2;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.user_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void LoginResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<LoginResponse*>(&to_msg);
-  auto& from = static_cast<const LoginResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.LoginResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(from._impl_.base_ != nullptr);
-      if (_this->_impl_.base_ == nullptr) {
-        _this->_impl_.base_ =
-            ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-      } else {
-        _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-      }
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(from._impl_.user_ != nullptr);
-      if (_this->_impl_.user_ == nullptr) {
-        _this->_impl_.user_ =
-            ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(arena, *from._impl_.user_);
-      } else {
-        _this->_impl_.user_->MergeFrom(*from._impl_.user_);
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void LoginResponse::CopyFrom(const LoginResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.LoginResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void LoginResponse::InternalSwap(LoginResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.user_)
-      + sizeof(LoginResponse::_impl_.user_)
-      - PROTOBUF_FIELD_OFFSET(LoginResponse, _impl_.base_)>(
-          reinterpret_cast<char*>(&_impl_.base_),
-          reinterpret_cast<char*>(&other->_impl_.base_));
-}
-
-::google::protobuf::Metadata LoginResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetUserInfoRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetUserInfoRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetUserInfoRequest, _impl_._has_bits_);
-};
-
-void GetUserInfoRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetUserInfoRequest::GetUserInfoRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.GetUserInfoRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserInfoRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::GetUserInfoRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        account_(arena, from.account_),
-        uid_(arena, from.uid_) {}
-
-GetUserInfoRequest::GetUserInfoRequest(
-    ::google::protobuf::Arena* arena,
-    const GetUserInfoRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetUserInfoRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.GetUserInfoRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserInfoRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        account_(arena),
-        uid_(arena) {}
-
-inline void GetUserInfoRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.header_ = {};
-}
-GetUserInfoRequest::~GetUserInfoRequest() {
-  // @@protoc_insertion_point(destructor:im.user.GetUserInfoRequest)
-  SharedDtor(*this);
-}
-inline void GetUserInfoRequest::SharedDtor(MessageLite& self) {
-  GetUserInfoRequest& this_ = static_cast<GetUserInfoRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.account_.Destroy();
-  this_._impl_.uid_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetUserInfoRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetUserInfoRequest(arena);
-}
-constexpr auto GetUserInfoRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(GetUserInfoRequest),
-                                            alignof(GetUserInfoRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetUserInfoRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetUserInfoRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetUserInfoRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetUserInfoRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetUserInfoRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetUserInfoRequest>(), &GetUserInfoRequest::ByteSizeLong,
-            &GetUserInfoRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetUserInfoRequest, _impl_._cached_size_),
-        false,
-    },
-    &GetUserInfoRequest::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetUserInfoRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 45, 2> GetUserInfoRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetUserInfoRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::GetUserInfoRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetUserInfoRequest, _impl_.header_)}},
-    // string account = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserInfoRequest, _impl_.account_)}},
-    // string uid = 3;
-    {::_pbi::TcParser::FastUS1,
-     {26, 63, 0, PROTOBUF_FIELD_OFFSET(GetUserInfoRequest, _impl_.uid_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(GetUserInfoRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string account = 2;
-    {PROTOBUF_FIELD_OFFSET(GetUserInfoRequest, _impl_.account_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // string uid = 3;
-    {PROTOBUF_FIELD_OFFSET(GetUserInfoRequest, _impl_.uid_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\32\0\7\3\0\0\0\0"
-    "im.user.GetUserInfoRequest"
-    "account"
-    "uid"
-  }},
-};
-
-PROTOBUF_NOINLINE void GetUserInfoRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.GetUserInfoRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.account_.ClearToEmpty();
-  _impl_.uid_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetUserInfoRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetUserInfoRequest& this_ = static_cast<const GetUserInfoRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetUserInfoRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetUserInfoRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.GetUserInfoRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string account = 2;
-          if (!this_._internal_account().empty()) {
-            const std::string& _s = this_._internal_account();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.GetUserInfoRequest.account");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // string uid = 3;
-          if (!this_._internal_uid().empty()) {
-            const std::string& _s = this_._internal_uid();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.GetUserInfoRequest.uid");
-            target = stream->WriteStringMaybeAliased(3, _s, target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.GetUserInfoRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetUserInfoRequest::ByteSizeLong(const MessageLite& base) {
-          const GetUserInfoRequest& this_ = static_cast<const GetUserInfoRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetUserInfoRequest::ByteSizeLong() const {
-          const GetUserInfoRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.GetUserInfoRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string account = 2;
-            if (!this_._internal_account().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_account());
-            }
-            // string uid = 3;
-            if (!this_._internal_uid().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_uid());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetUserInfoRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetUserInfoRequest*>(&to_msg);
-  auto& from = static_cast<const GetUserInfoRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.GetUserInfoRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_account().empty()) {
-    _this->_internal_set_account(from._internal_account());
-  }
-  if (!from._internal_uid().empty()) {
-    _this->_internal_set_uid(from._internal_uid());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetUserInfoRequest::CopyFrom(const GetUserInfoRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.GetUserInfoRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetUserInfoRequest::InternalSwap(GetUserInfoRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.account_, &other->_impl_.account_, arena);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.uid_, &other->_impl_.uid_, arena);
-  swap(_impl_.header_, other->_impl_.header_);
-}
-
-::google::protobuf::Metadata GetUserInfoRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class GetUserInfoResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<GetUserInfoResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(GetUserInfoResponse, _impl_._has_bits_);
-};
-
-void GetUserInfoResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-GetUserInfoResponse::GetUserInfoResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.GetUserInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::GetUserInfoResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-GetUserInfoResponse::GetUserInfoResponse(
-    ::google::protobuf::Arena* arena,
-    const GetUserInfoResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  GetUserInfoResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-  _impl_.user_ = (cached_has_bits & 0x00000002u) ? ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(
-                              arena, *from._impl_.user_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.GetUserInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE GetUserInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void GetUserInfoResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, base_),
-           0,
-           offsetof(Impl_, user_) -
-               offsetof(Impl_, base_) +
-               sizeof(Impl_::user_));
-}
-GetUserInfoResponse::~GetUserInfoResponse() {
-  // @@protoc_insertion_point(destructor:im.user.GetUserInfoResponse)
-  SharedDtor(*this);
-}
-inline void GetUserInfoResponse::SharedDtor(MessageLite& self) {
-  GetUserInfoResponse& this_ = static_cast<GetUserInfoResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  delete this_._impl_.user_;
-  this_._impl_.~Impl_();
-}
-
-inline void* GetUserInfoResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) GetUserInfoResponse(arena);
-}
-constexpr auto GetUserInfoResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(GetUserInfoResponse),
-                                            alignof(GetUserInfoResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull GetUserInfoResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_GetUserInfoResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &GetUserInfoResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<GetUserInfoResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &GetUserInfoResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<GetUserInfoResponse>(), &GetUserInfoResponse::ByteSizeLong,
-            &GetUserInfoResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(GetUserInfoResponse, _impl_._cached_size_),
-        false,
-    },
-    &GetUserInfoResponse::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* GetUserInfoResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> GetUserInfoResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(GetUserInfoResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::GetUserInfoResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.user.UserInfo user = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(GetUserInfoResponse, _impl_.user_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(GetUserInfoResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(GetUserInfoResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.user.UserInfo user = 2;
-    {PROTOBUF_FIELD_OFFSET(GetUserInfoResponse, _impl_.user_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::user::UserInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void GetUserInfoResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.GetUserInfoResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.base_ != nullptr);
-      _impl_.base_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.user_ != nullptr);
-      _impl_.user_->Clear();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* GetUserInfoResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const GetUserInfoResponse& this_ = static_cast<const GetUserInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* GetUserInfoResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const GetUserInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.GetUserInfoResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.user.UserInfo user = 2;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.user_, this_._impl_.user_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.GetUserInfoResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t GetUserInfoResponse::ByteSizeLong(const MessageLite& base) {
-          const GetUserInfoResponse& this_ = static_cast<const GetUserInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t GetUserInfoResponse::ByteSizeLong() const {
-          const GetUserInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.GetUserInfoResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // .im.base.BaseResponse base = 1;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-            // .im.user.UserInfo user = 2;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.user_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void GetUserInfoResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<GetUserInfoResponse*>(&to_msg);
-  auto& from = static_cast<const GetUserInfoResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.GetUserInfoResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(from._impl_.base_ != nullptr);
-      if (_this->_impl_.base_ == nullptr) {
-        _this->_impl_.base_ =
-            ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-      } else {
-        _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-      }
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(from._impl_.user_ != nullptr);
-      if (_this->_impl_.user_ == nullptr) {
-        _this->_impl_.user_ =
-            ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(arena, *from._impl_.user_);
-      } else {
-        _this->_impl_.user_->MergeFrom(*from._impl_.user_);
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void GetUserInfoResponse::CopyFrom(const GetUserInfoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.GetUserInfoResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void GetUserInfoResponse::InternalSwap(GetUserInfoResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetUserInfoResponse, _impl_.user_)
-      + sizeof(GetUserInfoResponse::_impl_.user_)
-      - PROTOBUF_FIELD_OFFSET(GetUserInfoResponse, _impl_.base_)>(
-          reinterpret_cast<char*>(&_impl_.base_),
-          reinterpret_cast<char*>(&other->_impl_.base_));
-}
-
-::google::protobuf::Metadata GetUserInfoResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SearchUsersRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<SearchUsersRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_._has_bits_);
-};
-
-void SearchUsersRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-SearchUsersRequest::SearchUsersRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.SearchUsersRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SearchUsersRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::SearchUsersRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        keyword_(arena, from.keyword_) {}
-
-SearchUsersRequest::SearchUsersRequest(
-    ::google::protobuf::Arena* arena,
-    const SearchUsersRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SearchUsersRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.limit_ = from._impl_.limit_;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.SearchUsersRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE SearchUsersRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        keyword_(arena) {}
-
-inline void SearchUsersRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, limit_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::limit_));
-}
-SearchUsersRequest::~SearchUsersRequest() {
-  // @@protoc_insertion_point(destructor:im.user.SearchUsersRequest)
-  SharedDtor(*this);
-}
-inline void SearchUsersRequest::SharedDtor(MessageLite& self) {
-  SearchUsersRequest& this_ = static_cast<SearchUsersRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  this_._impl_.keyword_.Destroy();
-  delete this_._impl_.header_;
-  this_._impl_.~Impl_();
-}
-
-inline void* SearchUsersRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SearchUsersRequest(arena);
-}
-constexpr auto SearchUsersRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::CopyInit(sizeof(SearchUsersRequest),
-                                            alignof(SearchUsersRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SearchUsersRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SearchUsersRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SearchUsersRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SearchUsersRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SearchUsersRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SearchUsersRequest>(), &SearchUsersRequest::ByteSizeLong,
-            &SearchUsersRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_._cached_size_),
-        false,
-    },
-    &SearchUsersRequest::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SearchUsersRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<2, 3, 1, 42, 2> SearchUsersRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    3, 24,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967288,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    3,  // num_field_entries
-    1,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::SearchUsersRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    {::_pbi::TcParser::MiniParse, {}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_.header_)}},
-    // string keyword = 2;
-    {::_pbi::TcParser::FastUS1,
-     {18, 63, 0, PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_.keyword_)}},
-    // int32 limit = 3;
-    {::_pbi::TcParser::SingularVarintNoZag1<::uint32_t, offsetof(SearchUsersRequest, _impl_.limit_), 63>(),
-     {24, 63, 0, PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_.limit_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // string keyword = 2;
-    {PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_.keyword_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kUtf8String | ::_fl::kRepAString)},
-    // int32 limit = 3;
-    {PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_.limit_), -1, 0,
-    (0 | ::_fl::kFcSingular | ::_fl::kInt32)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-  }}, {{
-    "\32\0\7\0\0\0\0\0"
-    "im.user.SearchUsersRequest"
-    "keyword"
-  }},
-};
-
-PROTOBUF_NOINLINE void SearchUsersRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.SearchUsersRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.keyword_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.header_ != nullptr);
-    _impl_.header_->Clear();
-  }
-  _impl_.limit_ = 0;
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SearchUsersRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SearchUsersRequest& this_ = static_cast<const SearchUsersRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SearchUsersRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SearchUsersRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.SearchUsersRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // string keyword = 2;
-          if (!this_._internal_keyword().empty()) {
-            const std::string& _s = this_._internal_keyword();
-            ::google::protobuf::internal::WireFormatLite::VerifyUtf8String(
-                _s.data(), static_cast<int>(_s.length()), ::google::protobuf::internal::WireFormatLite::SERIALIZE, "im.user.SearchUsersRequest.keyword");
-            target = stream->WriteStringMaybeAliased(2, _s, target);
-          }
-
-          // int32 limit = 3;
-          if (this_._internal_limit() != 0) {
-            target = ::google::protobuf::internal::WireFormatLite::
-                WriteInt32ToArrayWithField<3>(
-                    stream, this_._internal_limit(), target);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.SearchUsersRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SearchUsersRequest::ByteSizeLong(const MessageLite& base) {
-          const SearchUsersRequest& this_ = static_cast<const SearchUsersRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SearchUsersRequest::ByteSizeLong() const {
-          const SearchUsersRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.SearchUsersRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // string keyword = 2;
-            if (!this_._internal_keyword().empty()) {
-              total_size += 1 + ::google::protobuf::internal::WireFormatLite::StringSize(
-                                              this_._internal_keyword());
-            }
-          }
-           {
-            // .im.base.IMHeader header = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-          }
-           {
-            // int32 limit = 3;
-            if (this_._internal_limit() != 0) {
-              total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(
-                  this_._internal_limit());
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SearchUsersRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SearchUsersRequest*>(&to_msg);
-  auto& from = static_cast<const SearchUsersRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.SearchUsersRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_keyword().empty()) {
-    _this->_internal_set_keyword(from._internal_keyword());
-  }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.header_ != nullptr);
-    if (_this->_impl_.header_ == nullptr) {
-      _this->_impl_.header_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-    } else {
-      _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-    }
-  }
-  if (from._internal_limit() != 0) {
-    _this->_impl_.limit_ = from._impl_.limit_;
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SearchUsersRequest::CopyFrom(const SearchUsersRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.SearchUsersRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SearchUsersRequest::InternalSwap(SearchUsersRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  auto* arena = GetArena();
-  ABSL_DCHECK_EQ(arena, other->GetArena());
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::_pbi::ArenaStringPtr::InternalSwap(&_impl_.keyword_, &other->_impl_.keyword_, arena);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_.limit_)
-      + sizeof(SearchUsersRequest::_impl_.limit_)
-      - PROTOBUF_FIELD_OFFSET(SearchUsersRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata SearchUsersRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class SearchUsersResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<SearchUsersResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(SearchUsersResponse, _impl_._has_bits_);
-};
-
-void SearchUsersResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-SearchUsersResponse::SearchUsersResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.SearchUsersResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SearchUsersResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::SearchUsersResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0},
-        users_{visibility, arena, from.users_} {}
-
-SearchUsersResponse::SearchUsersResponse(
-    ::google::protobuf::Arena* arena,
-    const SearchUsersResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SearchUsersResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.SearchUsersResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE SearchUsersResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0},
-        users_{visibility, arena} {}
-
-inline void SearchUsersResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  _impl_.base_ = {};
-}
-SearchUsersResponse::~SearchUsersResponse() {
-  // @@protoc_insertion_point(destructor:im.user.SearchUsersResponse)
-  SharedDtor(*this);
-}
-inline void SearchUsersResponse::SharedDtor(MessageLite& self) {
-  SearchUsersResponse& this_ = static_cast<SearchUsersResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  this_._impl_.~Impl_();
-}
-
-inline void* SearchUsersResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) SearchUsersResponse(arena);
-}
-constexpr auto SearchUsersResponse::InternalNewImpl_() {
-  constexpr auto arena_bits = ::google::protobuf::internal::EncodePlacementArenaOffsets({
-      PROTOBUF_FIELD_OFFSET(SearchUsersResponse, _impl_.users_) +
-          decltype(SearchUsersResponse::_impl_.users_)::
-              InternalGetArenaOffset(
-                  ::google::protobuf::Message::internal_visibility()),
-  });
-  if (arena_bits.has_value()) {
-    return ::google::protobuf::internal::MessageCreator::ZeroInit(
-        sizeof(SearchUsersResponse), alignof(SearchUsersResponse), *arena_bits);
-  } else {
-    return ::google::protobuf::internal::MessageCreator(&SearchUsersResponse::PlacementNew_,
-                                 sizeof(SearchUsersResponse),
-                                 alignof(SearchUsersResponse));
-  }
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull SearchUsersResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_SearchUsersResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &SearchUsersResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<SearchUsersResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &SearchUsersResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<SearchUsersResponse>(), &SearchUsersResponse::ByteSizeLong,
-            &SearchUsersResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(SearchUsersResponse, _impl_._cached_size_),
-        false,
-    },
-    &SearchUsersResponse::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* SearchUsersResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> SearchUsersResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(SearchUsersResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::SearchUsersResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // repeated .im.user.UserInfo users = 2;
-    {::_pbi::TcParser::FastMtR1,
-     {18, 63, 1, PROTOBUF_FIELD_OFFSET(SearchUsersResponse, _impl_.users_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(SearchUsersResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(SearchUsersResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // repeated .im.user.UserInfo users = 2;
-    {PROTOBUF_FIELD_OFFSET(SearchUsersResponse, _impl_.users_), -1, 1,
-    (0 | ::_fl::kFcRepeated | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::user::UserInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void SearchUsersResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.SearchUsersResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  _impl_.users_.Clear();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(_impl_.base_ != nullptr);
-    _impl_.base_->Clear();
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* SearchUsersResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const SearchUsersResponse& this_ = static_cast<const SearchUsersResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* SearchUsersResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const SearchUsersResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.SearchUsersResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // repeated .im.user.UserInfo users = 2;
-          for (unsigned i = 0, n = static_cast<unsigned>(
-                                   this_._internal_users_size());
-               i < n; i++) {
-            const auto& repfield = this_._internal_users().Get(i);
-            target =
-                ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                    2, repfield, repfield.GetCachedSize(),
-                    target, stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.SearchUsersResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t SearchUsersResponse::ByteSizeLong(const MessageLite& base) {
-          const SearchUsersResponse& this_ = static_cast<const SearchUsersResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t SearchUsersResponse::ByteSizeLong() const {
-          const SearchUsersResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.SearchUsersResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-           {
-            // repeated .im.user.UserInfo users = 2;
-            {
-              total_size += 1UL * this_._internal_users_size();
-              for (const auto& msg : this_._internal_users()) {
-                total_size += ::google::protobuf::internal::WireFormatLite::MessageSize(msg);
-              }
-            }
-          }
-           {
-            // .im.base.BaseResponse base = 1;
-            cached_has_bits = this_._impl_._has_bits_[0];
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void SearchUsersResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<SearchUsersResponse*>(&to_msg);
-  auto& from = static_cast<const SearchUsersResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.SearchUsersResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  _this->_internal_mutable_users()->MergeFrom(
-      from._internal_users());
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    ABSL_DCHECK(from._impl_.base_ != nullptr);
-    if (_this->_impl_.base_ == nullptr) {
-      _this->_impl_.base_ =
-          ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-    } else {
-      _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void SearchUsersResponse::CopyFrom(const SearchUsersResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.SearchUsersResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void SearchUsersResponse::InternalSwap(SearchUsersResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  _impl_.users_.InternalSwap(&other->_impl_.users_);
-  swap(_impl_.base_, other->_impl_.base_);
-}
-
-::google::protobuf::Metadata SearchUsersResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class UpdateUserInfoRequest::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<UpdateUserInfoRequest>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(UpdateUserInfoRequest, _impl_._has_bits_);
-};
-
-void UpdateUserInfoRequest::clear_header() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.header_ != nullptr) _impl_.header_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-UpdateUserInfoRequest::UpdateUserInfoRequest(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.UpdateUserInfoRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdateUserInfoRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::UpdateUserInfoRequest& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-UpdateUserInfoRequest::UpdateUserInfoRequest(
-    ::google::protobuf::Arena* arena,
-    const UpdateUserInfoRequest& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  UpdateUserInfoRequest* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.header_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(
-                              arena, *from._impl_.header_)
-                        : nullptr;
-  _impl_.user_ = (cached_has_bits & 0x00000002u) ? ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(
-                              arena, *from._impl_.user_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.UpdateUserInfoRequest)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdateUserInfoRequest::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void UpdateUserInfoRequest::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, header_),
-           0,
-           offsetof(Impl_, user_) -
-               offsetof(Impl_, header_) +
-               sizeof(Impl_::user_));
-}
-UpdateUserInfoRequest::~UpdateUserInfoRequest() {
-  // @@protoc_insertion_point(destructor:im.user.UpdateUserInfoRequest)
-  SharedDtor(*this);
-}
-inline void UpdateUserInfoRequest::SharedDtor(MessageLite& self) {
-  UpdateUserInfoRequest& this_ = static_cast<UpdateUserInfoRequest&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.header_;
-  delete this_._impl_.user_;
-  this_._impl_.~Impl_();
-}
-
-inline void* UpdateUserInfoRequest::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) UpdateUserInfoRequest(arena);
-}
-constexpr auto UpdateUserInfoRequest::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(UpdateUserInfoRequest),
-                                            alignof(UpdateUserInfoRequest));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull UpdateUserInfoRequest::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_UpdateUserInfoRequest_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &UpdateUserInfoRequest::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<UpdateUserInfoRequest>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &UpdateUserInfoRequest::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<UpdateUserInfoRequest>(), &UpdateUserInfoRequest::ByteSizeLong,
-            &UpdateUserInfoRequest::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(UpdateUserInfoRequest, _impl_._cached_size_),
-        false,
-    },
-    &UpdateUserInfoRequest::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* UpdateUserInfoRequest::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> UpdateUserInfoRequest::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(UpdateUserInfoRequest, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::UpdateUserInfoRequest>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.user.UserInfo user = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(UpdateUserInfoRequest, _impl_.user_)}},
-    // .im.base.IMHeader header = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(UpdateUserInfoRequest, _impl_.header_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.IMHeader header = 1;
-    {PROTOBUF_FIELD_OFFSET(UpdateUserInfoRequest, _impl_.header_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.user.UserInfo user = 2;
-    {PROTOBUF_FIELD_OFFSET(UpdateUserInfoRequest, _impl_.user_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::IMHeader>()},
-    {::_pbi::TcParser::GetTable<::im::user::UserInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void UpdateUserInfoRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.UpdateUserInfoRequest)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.header_ != nullptr);
-      _impl_.header_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.user_ != nullptr);
-      _impl_.user_->Clear();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* UpdateUserInfoRequest::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const UpdateUserInfoRequest& this_ = static_cast<const UpdateUserInfoRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* UpdateUserInfoRequest::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const UpdateUserInfoRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.UpdateUserInfoRequest)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.IMHeader header = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.header_, this_._impl_.header_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.user.UserInfo user = 2;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.user_, this_._impl_.user_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.UpdateUserInfoRequest)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t UpdateUserInfoRequest::ByteSizeLong(const MessageLite& base) {
-          const UpdateUserInfoRequest& this_ = static_cast<const UpdateUserInfoRequest&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t UpdateUserInfoRequest::ByteSizeLong() const {
-          const UpdateUserInfoRequest& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.UpdateUserInfoRequest)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // .im.base.IMHeader header = 1;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.header_);
-            }
-            // .im.user.UserInfo user = 2;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.user_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void UpdateUserInfoRequest::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<UpdateUserInfoRequest*>(&to_msg);
-  auto& from = static_cast<const UpdateUserInfoRequest&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.UpdateUserInfoRequest)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(from._impl_.header_ != nullptr);
-      if (_this->_impl_.header_ == nullptr) {
-        _this->_impl_.header_ =
-            ::google::protobuf::Message::CopyConstruct<::im::base::IMHeader>(arena, *from._impl_.header_);
-      } else {
-        _this->_impl_.header_->MergeFrom(*from._impl_.header_);
-      }
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(from._impl_.user_ != nullptr);
-      if (_this->_impl_.user_ == nullptr) {
-        _this->_impl_.user_ =
-            ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(arena, *from._impl_.user_);
-      } else {
-        _this->_impl_.user_->MergeFrom(*from._impl_.user_);
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void UpdateUserInfoRequest::CopyFrom(const UpdateUserInfoRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.UpdateUserInfoRequest)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void UpdateUserInfoRequest::InternalSwap(UpdateUserInfoRequest* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(UpdateUserInfoRequest, _impl_.user_)
-      + sizeof(UpdateUserInfoRequest::_impl_.user_)
-      - PROTOBUF_FIELD_OFFSET(UpdateUserInfoRequest, _impl_.header_)>(
-          reinterpret_cast<char*>(&_impl_.header_),
-          reinterpret_cast<char*>(&other->_impl_.header_));
-}
-
-::google::protobuf::Metadata UpdateUserInfoRequest::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// ===================================================================
-
-class UpdateUserInfoResponse::_Internal {
- public:
-  using HasBits =
-      decltype(std::declval<UpdateUserInfoResponse>()._impl_._has_bits_);
-  static constexpr ::int32_t kHasBitsOffset =
-      8 * PROTOBUF_FIELD_OFFSET(UpdateUserInfoResponse, _impl_._has_bits_);
-};
-
-void UpdateUserInfoResponse::clear_base() {
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  if (_impl_.base_ != nullptr) _impl_.base_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
-}
-UpdateUserInfoResponse::UpdateUserInfoResponse(::google::protobuf::Arena* arena)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  SharedCtor(arena);
-  // @@protoc_insertion_point(arena_constructor:im.user.UpdateUserInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdateUserInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility, ::google::protobuf::Arena* arena,
-    const Impl_& from, const ::im::user::UpdateUserInfoResponse& from_msg)
-      : _has_bits_{from._has_bits_},
-        _cached_size_{0} {}
-
-UpdateUserInfoResponse::UpdateUserInfoResponse(
-    ::google::protobuf::Arena* arena,
-    const UpdateUserInfoResponse& from)
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-    : ::google::protobuf::Message(arena, _class_data_.base()) {
-#else   // PROTOBUF_CUSTOM_VTABLE
-    : ::google::protobuf::Message(arena) {
-#endif  // PROTOBUF_CUSTOM_VTABLE
-  UpdateUserInfoResponse* const _this = this;
-  (void)_this;
-  _internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(
-      from._internal_metadata_);
-  new (&_impl_) Impl_(internal_visibility(), arena, from._impl_, from);
-  ::uint32_t cached_has_bits = _impl_._has_bits_[0];
-  _impl_.base_ = (cached_has_bits & 0x00000001u) ? ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(
-                              arena, *from._impl_.base_)
-                        : nullptr;
-  _impl_.user_ = (cached_has_bits & 0x00000002u) ? ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(
-                              arena, *from._impl_.user_)
-                        : nullptr;
-
-  // @@protoc_insertion_point(copy_constructor:im.user.UpdateUserInfoResponse)
-}
-inline PROTOBUF_NDEBUG_INLINE UpdateUserInfoResponse::Impl_::Impl_(
-    ::google::protobuf::internal::InternalVisibility visibility,
-    ::google::protobuf::Arena* arena)
-      : _cached_size_{0} {}
-
-inline void UpdateUserInfoResponse::SharedCtor(::_pb::Arena* arena) {
-  new (&_impl_) Impl_(internal_visibility(), arena);
-  ::memset(reinterpret_cast<char *>(&_impl_) +
-               offsetof(Impl_, base_),
-           0,
-           offsetof(Impl_, user_) -
-               offsetof(Impl_, base_) +
-               sizeof(Impl_::user_));
-}
-UpdateUserInfoResponse::~UpdateUserInfoResponse() {
-  // @@protoc_insertion_point(destructor:im.user.UpdateUserInfoResponse)
-  SharedDtor(*this);
-}
-inline void UpdateUserInfoResponse::SharedDtor(MessageLite& self) {
-  UpdateUserInfoResponse& this_ = static_cast<UpdateUserInfoResponse&>(self);
-  this_._internal_metadata_.Delete<::google::protobuf::UnknownFieldSet>();
-  ABSL_DCHECK(this_.GetArena() == nullptr);
-  delete this_._impl_.base_;
-  delete this_._impl_.user_;
-  this_._impl_.~Impl_();
-}
-
-inline void* UpdateUserInfoResponse::PlacementNew_(const void*, void* mem,
-                                        ::google::protobuf::Arena* arena) {
-  return ::new (mem) UpdateUserInfoResponse(arena);
-}
-constexpr auto UpdateUserInfoResponse::InternalNewImpl_() {
-  return ::google::protobuf::internal::MessageCreator::ZeroInit(sizeof(UpdateUserInfoResponse),
-                                            alignof(UpdateUserInfoResponse));
-}
-PROTOBUF_CONSTINIT
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::google::protobuf::internal::ClassDataFull UpdateUserInfoResponse::_class_data_ = {
-    ::google::protobuf::internal::ClassData{
-        &_UpdateUserInfoResponse_default_instance_._instance,
-        &_table_.header,
-        nullptr,  // OnDemandRegisterArenaDtor
-        nullptr,  // IsInitialized
-        &UpdateUserInfoResponse::MergeImpl,
-        ::google::protobuf::Message::GetNewImpl<UpdateUserInfoResponse>(),
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        &UpdateUserInfoResponse::SharedDtor,
-        ::google::protobuf::Message::GetClearImpl<UpdateUserInfoResponse>(), &UpdateUserInfoResponse::ByteSizeLong,
-            &UpdateUserInfoResponse::_InternalSerialize,
-#endif  // PROTOBUF_CUSTOM_VTABLE
-        PROTOBUF_FIELD_OFFSET(UpdateUserInfoResponse, _impl_._cached_size_),
-        false,
-    },
-    &UpdateUserInfoResponse::kDescriptorMethods,
-    &descriptor_table_user_2eproto,
-    nullptr,  // tracker
-};
-const ::google::protobuf::internal::ClassData* UpdateUserInfoResponse::GetClassData() const {
-  ::google::protobuf::internal::PrefetchToLocalCache(&_class_data_);
-  ::google::protobuf::internal::PrefetchToLocalCache(_class_data_.tc_table);
-  return _class_data_.base();
-}
-PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1
-const ::_pbi::TcParseTable<1, 2, 2, 0, 2> UpdateUserInfoResponse::_table_ = {
-  {
-    PROTOBUF_FIELD_OFFSET(UpdateUserInfoResponse, _impl_._has_bits_),
-    0, // no _extensions_
-    2, 8,  // max_field_number, fast_idx_mask
-    offsetof(decltype(_table_), field_lookup_table),
-    4294967292,  // skipmap
-    offsetof(decltype(_table_), field_entries),
-    2,  // num_field_entries
-    2,  // num_aux_entries
-    offsetof(decltype(_table_), aux_entries),
-    _class_data_.base(),
-    nullptr,  // post_loop_handler
-    ::_pbi::TcParser::GenericFallback,  // fallback
-    #ifdef PROTOBUF_PREFETCH_PARSE_TABLE
-    ::_pbi::TcParser::GetTable<::im::user::UpdateUserInfoResponse>(),  // to_prefetch
-    #endif  // PROTOBUF_PREFETCH_PARSE_TABLE
-  }, {{
-    // .im.user.UserInfo user = 2;
-    {::_pbi::TcParser::FastMtS1,
-     {18, 1, 1, PROTOBUF_FIELD_OFFSET(UpdateUserInfoResponse, _impl_.user_)}},
-    // .im.base.BaseResponse base = 1;
-    {::_pbi::TcParser::FastMtS1,
-     {10, 0, 0, PROTOBUF_FIELD_OFFSET(UpdateUserInfoResponse, _impl_.base_)}},
-  }}, {{
-    65535, 65535
-  }}, {{
-    // .im.base.BaseResponse base = 1;
-    {PROTOBUF_FIELD_OFFSET(UpdateUserInfoResponse, _impl_.base_), _Internal::kHasBitsOffset + 0, 0,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-    // .im.user.UserInfo user = 2;
-    {PROTOBUF_FIELD_OFFSET(UpdateUserInfoResponse, _impl_.user_), _Internal::kHasBitsOffset + 1, 1,
-    (0 | ::_fl::kFcOptional | ::_fl::kMessage | ::_fl::kTvTable)},
-  }}, {{
-    {::_pbi::TcParser::GetTable<::im::base::BaseResponse>()},
-    {::_pbi::TcParser::GetTable<::im::user::UserInfo>()},
-  }}, {{
-  }},
-};
-
-PROTOBUF_NOINLINE void UpdateUserInfoResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:im.user.UpdateUserInfoResponse)
-  ::google::protobuf::internal::TSanWrite(&_impl_);
-  ::uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(_impl_.base_ != nullptr);
-      _impl_.base_->Clear();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(_impl_.user_ != nullptr);
-      _impl_.user_->Clear();
-    }
-  }
-  _impl_._has_bits_.Clear();
-  _internal_metadata_.Clear<::google::protobuf::UnknownFieldSet>();
-}
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::uint8_t* UpdateUserInfoResponse::_InternalSerialize(
-            const MessageLite& base, ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) {
-          const UpdateUserInfoResponse& this_ = static_cast<const UpdateUserInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::uint8_t* UpdateUserInfoResponse::_InternalSerialize(
-            ::uint8_t* target,
-            ::google::protobuf::io::EpsCopyOutputStream* stream) const {
-          const UpdateUserInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(serialize_to_array_start:im.user.UpdateUserInfoResponse)
-          ::uint32_t cached_has_bits = 0;
-          (void)cached_has_bits;
-
-          cached_has_bits = this_._impl_._has_bits_[0];
-          // .im.base.BaseResponse base = 1;
-          if (cached_has_bits & 0x00000001u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                1, *this_._impl_.base_, this_._impl_.base_->GetCachedSize(), target,
-                stream);
-          }
-
-          // .im.user.UserInfo user = 2;
-          if (cached_has_bits & 0x00000002u) {
-            target = ::google::protobuf::internal::WireFormatLite::InternalWriteMessage(
-                2, *this_._impl_.user_, this_._impl_.user_->GetCachedSize(), target,
-                stream);
-          }
-
-          if (PROTOBUF_PREDICT_FALSE(this_._internal_metadata_.have_unknown_fields())) {
-            target =
-                ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-                    this_._internal_metadata_.unknown_fields<::google::protobuf::UnknownFieldSet>(::google::protobuf::UnknownFieldSet::default_instance), target, stream);
-          }
-          // @@protoc_insertion_point(serialize_to_array_end:im.user.UpdateUserInfoResponse)
-          return target;
-        }
-
-#if defined(PROTOBUF_CUSTOM_VTABLE)
-        ::size_t UpdateUserInfoResponse::ByteSizeLong(const MessageLite& base) {
-          const UpdateUserInfoResponse& this_ = static_cast<const UpdateUserInfoResponse&>(base);
-#else   // PROTOBUF_CUSTOM_VTABLE
-        ::size_t UpdateUserInfoResponse::ByteSizeLong() const {
-          const UpdateUserInfoResponse& this_ = *this;
-#endif  // PROTOBUF_CUSTOM_VTABLE
-          // @@protoc_insertion_point(message_byte_size_start:im.user.UpdateUserInfoResponse)
-          ::size_t total_size = 0;
-
-          ::uint32_t cached_has_bits = 0;
-          // Prevent compiler warnings about cached_has_bits being unused
-          (void)cached_has_bits;
-
-          ::_pbi::Prefetch5LinesFrom7Lines(&this_);
-          cached_has_bits = this_._impl_._has_bits_[0];
-          if (cached_has_bits & 0x00000003u) {
-            // .im.base.BaseResponse base = 1;
-            if (cached_has_bits & 0x00000001u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.base_);
-            }
-            // .im.user.UserInfo user = 2;
-            if (cached_has_bits & 0x00000002u) {
-              total_size += 1 +
-                            ::google::protobuf::internal::WireFormatLite::MessageSize(*this_._impl_.user_);
-            }
-          }
-          return this_.MaybeComputeUnknownFieldsSize(total_size,
-                                                     &this_._impl_._cached_size_);
-        }
-
-void UpdateUserInfoResponse::MergeImpl(::google::protobuf::MessageLite& to_msg, const ::google::protobuf::MessageLite& from_msg) {
-  auto* const _this = static_cast<UpdateUserInfoResponse*>(&to_msg);
-  auto& from = static_cast<const UpdateUserInfoResponse&>(from_msg);
-  ::google::protobuf::Arena* arena = _this->GetArena();
-  // @@protoc_insertion_point(class_specific_merge_from_start:im.user.UpdateUserInfoResponse)
-  ABSL_DCHECK_NE(&from, _this);
-  ::uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      ABSL_DCHECK(from._impl_.base_ != nullptr);
-      if (_this->_impl_.base_ == nullptr) {
-        _this->_impl_.base_ =
-            ::google::protobuf::Message::CopyConstruct<::im::base::BaseResponse>(arena, *from._impl_.base_);
-      } else {
-        _this->_impl_.base_->MergeFrom(*from._impl_.base_);
-      }
-    }
-    if (cached_has_bits & 0x00000002u) {
-      ABSL_DCHECK(from._impl_.user_ != nullptr);
-      if (_this->_impl_.user_ == nullptr) {
-        _this->_impl_.user_ =
-            ::google::protobuf::Message::CopyConstruct<::im::user::UserInfo>(arena, *from._impl_.user_);
-      } else {
-        _this->_impl_.user_->MergeFrom(*from._impl_.user_);
-      }
-    }
-  }
-  _this->_impl_._has_bits_[0] |= cached_has_bits;
-  _this->_internal_metadata_.MergeFrom<::google::protobuf::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void UpdateUserInfoResponse::CopyFrom(const UpdateUserInfoResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:im.user.UpdateUserInfoResponse)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-
-void UpdateUserInfoResponse::InternalSwap(UpdateUserInfoResponse* PROTOBUF_RESTRICT other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::google::protobuf::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(UpdateUserInfoResponse, _impl_.user_)
-      + sizeof(UpdateUserInfoResponse::_impl_.user_)
-      - PROTOBUF_FIELD_OFFSET(UpdateUserInfoResponse, _impl_.base_)>(
-          reinterpret_cast<char*>(&_impl_.base_),
-          reinterpret_cast<char*>(&other->_impl_.base_));
-}
-
-::google::protobuf::Metadata UpdateUserInfoResponse::GetMetadata() const {
-  return ::google::protobuf::Message::GetMetadataImpl(GetClassData()->full());
-}
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace user
-}  // namespace im
-namespace google {
-namespace protobuf {
-}  // namespace protobuf
-}  // namespace google
-// @@protoc_insertion_point(global_scope)
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::std::false_type
-    _static_init2_ PROTOBUF_UNUSED =
-        (::_pbi::AddDescriptors(&descriptor_table_user_2eproto),
-         ::std::false_type{});
-#include "google/protobuf/port_undef.inc"
@@ -40,6 +40,7 @@ enum class HeaderMsgType :uint8_t{
     NORMAL,
     PING,
     PONG,
+    AUTH,  // 消息体为 access token，连接建立后的第一帧
     UNKNOWN,
     ENUM_END
 };
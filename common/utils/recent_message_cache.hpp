@@ -0,0 +1,274 @@
+#ifndef RECENT_MESSAGE_CACHE_HPP
+#define RECENT_MESSAGE_CACHE_HPP
+
+/******************************************************************************
+ *
+ * @file       recent_message_cache.hpp
+ * @brief      按会话缓存最近 N 条消息的进程内环形缓存
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * 每个会话（单聊会话或群）保存按时间升序排列的最近 N 条消息，缓存窗口始终是
+ * 该会话时间线的一个后缀：窗口内最旧消息之后的所有消息都在缓存里。因此
+ * "before_time 之前最新的 limit 条" 只要落在窗口内即可直接返回；窗口不够时
+ * 未命中，由调用方回源数据库。
+ *
+ * 填充与写入存在竞态：回源读数据库期间如有新消息写入同一会话，回源结果可能
+ * 缺少该消息。fill 需要携带读库前取得的 ticket，期间同一分片有写入则放弃填充。
+ *
+ *****************************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace im {
+namespace utils {
+
+struct RecentMessageCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    std::size_t entries = 0;
+
+    double hit_ratio() const {
+        const uint64_t total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+};
+
+/**
+ * @brief 会话最近消息缓存
+ *
+ * @tparam Key      会话键（单聊为规范化的 uid 对，群为 group_id）
+ * @tparam Item     缓存的消息 DTO
+ * @tparam TimeMem  Item 中的时间字段（毫秒时间戳，查询按它分页）
+ * @tparam IdMem    Item 中的消息 id 字段（用于按 id 更新/失效）
+ */
+template <typename Key, typename Item, int64_t Item::*TimeMem, uint64_t Item::*IdMem>
+class RecentMessageCache {
+public:
+    using FillTicket = uint64_t;
+
+    RecentMessageCache(std::size_t per_key_capacity, std::size_t max_keys)
+        : capacity_(per_key_capacity), max_keys_(max_keys) {}
+
+    bool enabled() const { return capacity_ > 0 && max_keys_ > 0; }
+    std::size_t capacity() const { return capacity_; }
+
+    /**
+     * @brief 取 before_time 之前最新的 limit 条，按时间升序返回
+     * @param record  是否计入命中/未命中统计（回源填充后的重试不计入）
+     * @return 窗口无法确定结果时返回 std::nullopt
+     */
+    std::optional<std::vector<Item>> find(const Key& key, int64_t before_time, int limit,
+                                          bool record = true) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = entries_.find(key);
+        if (it == entries_.end() || limit <= 0) {
+            misses_ += record ? 1 : 0;
+            return std::nullopt;
+        }
+
+        Entry& entry = it->second;
+        auto end = std::lower_bound(entry.items.begin(), entry.items.end(), before_time,
+                                    [](const Item& item, int64_t t) { return item.*TimeMem < t; });
+        const auto available = static_cast<std::size_t>(end - entry.items.begin());
+        const auto wanted = static_cast<std::size_t>(limit);
+        if (available < wanted && !entry.complete) {
+            misses_ += record ? 1 : 0;
+            return std::nullopt;
+        }
+
+        hits_ += record ? 1 : 0;
+        touch(entry);
+        const std::size_t n = std::min(available, wanted);
+        return std::vector<Item>(end - static_cast<std::ptrdiff_t>(n), end);
+    }
+
+    bool contains(const Key& key) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.count(key) != 0;
+    }
+
+    /// 回源读库前调用，记录该会话所在分片的写入序号。
+    FillTicket begin_fill(const Key& key) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stripes_[stripe(key)];
+    }
+
+    /**
+     * @brief 用数据库中最新的一批消息建立窗口
+     * @param items     任意顺序，最多 capacity 条的会话最新消息
+     * @param complete  items 已包含该会话的全部消息
+     */
+    void fill(const Key& key, std::vector<Item> items, bool complete, FillTicket ticket) {
+        if (!enabled()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stripes_[stripe(key)] != ticket || entries_.count(key) != 0) {
+            return;
+        }
+
+        std::sort(items.begin(), items.end(),
+                  [](const Item& a, const Item& b) { return a.*TimeMem < b.*TimeMem; });
+        while (items.size() > capacity_) {
+            items.erase(items.begin());
+            complete = false;
+        }
+
+        lru_.push_front(key);
+        Entry& entry = entries_[key];
+        entry.lru_it = lru_.begin();
+        entry.complete = complete;
+        for (auto& item : items) {
+            ids_[item.*IdMem] = key;
+            entry.items.push_back(std::move(item));
+        }
+        evict_over_limit();
+    }
+
+    /// 新消息写入后调用；会话不在缓存中时只推进分片写入序号。
+    void append(const Key& key, Item item) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stripes_[stripe(key)];
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return;
+        }
+
+        // 回源结果可能已包含这条刚提交的消息。
+        if (ids_.count(item.*IdMem) != 0) {
+            return;
+        }
+
+        Entry& entry = it->second;
+        auto& items = entry.items;
+        const int64_t t = item.*TimeMem;
+        if (!items.empty() && t < items.back().*TimeMem) {
+            // 早于窗口起点的消息不属于窗口（窗口仍是时间线后缀）。
+            if (!entry.complete && t < items.front().*TimeMem) {
+                return;
+            }
+            auto pos = std::upper_bound(items.begin(), items.end(), t,
+                                        [](int64_t v, const Item& i) { return v < i.*TimeMem; });
+            ids_[item.*IdMem] = key;
+            items.insert(pos, std::move(item));
+        } else {
+            ids_[item.*IdMem] = key;
+            items.push_back(std::move(item));
+        }
+
+        while (items.size() > capacity_) {
+            ids_.erase(items.front().*IdMem);
+            items.pop_front();
+            entry.complete = false;
+        }
+        touch(entry);
+    }
+
+    /// 就地修改缓存中的某条消息（例如投递/已读状态）；不在缓存中则忽略。
+    void update(uint64_t msg_id, const std::function<void(Item&)>& fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Item* item = find_item(msg_id);
+        if (item) {
+            fn(*item);
+        }
+    }
+
+    /// 丢弃包含该消息的整个会话窗口（例如撤回）。
+    void invalidate_message(uint64_t msg_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto id_it = ids_.find(msg_id);
+        if (id_it == ids_.end()) {
+            return;
+        }
+        const Key key = id_it->second;
+        ++stripes_[stripe(key)];
+        erase_entry(key);
+    }
+
+    void invalidate(const Key& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stripes_[stripe(key)];
+        erase_entry(key);
+    }
+
+    RecentMessageCacheStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {hits_, misses_, entries_.size()};
+    }
+
+private:
+    static constexpr std::size_t kStripes = 256;
+
+    struct Entry {
+        std::deque<Item> items;  // 按时间升序
+        bool complete = false;
+        typename std::list<Key>::iterator lru_it;
+    };
+
+    static std::size_t stripe(const Key& key) { return std::hash<Key>{}(key) % kStripes; }
+
+    void touch(Entry& entry) { lru_.splice(lru_.begin(), lru_, entry.lru_it); }
+
+    Item* find_item(uint64_t msg_id) {
+        auto id_it = ids_.find(msg_id);
+        if (id_it == ids_.end()) {
+            return nullptr;
+        }
+        auto it = entries_.find(id_it->second);
+        if (it == entries_.end()) {
+            return nullptr;
+        }
+        for (auto& item : it->second.items) {
+            if (item.*IdMem == msg_id) {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+
+    void erase_entry(const Key& key) {
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return;
+        }
+        for (const auto& item : it->second.items) {
+            ids_.erase(item.*IdMem);
+        }
+        lru_.erase(it->second.lru_it);
+        entries_.erase(it);
+    }
+
+    void evict_over_limit() {
+        while (entries_.size() > max_keys_ && !lru_.empty()) {
+            const Key victim = lru_.back();
+            erase_entry(victim);
+        }
+    }
+
+    const std::size_t capacity_;
+    const std::size_t max_keys_;
+    mutable std::mutex mutex_;
+    std::unordered_map<Key, Entry> entries_;
+    std::unordered_map<uint64_t, Key> ids_;
+    std::list<Key> lru_;
+    std::array<uint64_t, kStripes> stripes_{};
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+}  // namespace utils
+}  // namespace im
+
+#endif  // RECENT_MESSAGE_CACHE_HPP
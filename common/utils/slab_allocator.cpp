@@ -0,0 +1,264 @@
+#include "slab_allocator.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <mutex>
+
+namespace im {
+namespace utils {
+
+namespace {
+
+// 尺寸等级：128 字节以内按 16 字节递增，之后每个 2 的幂区间均分 4 档，
+// 最坏情况下内部碎片约 25%。
+constexpr std::size_t kSmallClasses = 8;
+constexpr std::size_t kClassesPerDoubling = 4;
+constexpr std::size_t kClassCount =
+        kSmallClasses +
+        kClassesPerDoubling * (std::bit_width(SlabAllocator::kMaxSmallSize) - 1 - 7);
+constexpr std::size_t kSlabBytes = 64 * 1024;
+
+constexpr std::size_t class_index(std::size_t bytes) {
+    if (bytes <= 128) {
+        return bytes == 0 ? 0 : (bytes + 15) / 16 - 1;
+    }
+    const std::size_t k = std::bit_width(bytes - 1) - 1;  // bytes ∈ (2^k, 2^(k+1)]
+    const std::size_t step = std::size_t{1} << (k - 2);
+    const std::size_t offset = (bytes - (std::size_t{1} << k) + step - 1) / step;
+    return kSmallClasses + (k - 7) * kClassesPerDoubling + offset - 1;
+}
+
+constexpr std::size_t class_size(std::size_t index) {
+    if (index < kSmallClasses) {
+        return (index + 1) * 16;
+    }
+    const std::size_t j = index - kSmallClasses;
+    const std::size_t k = 7 + j / kClassesPerDoubling;
+    return (std::size_t{1} << k) + (j % kClassesPerDoubling + 1) * (std::size_t{1} << (k - 2));
+}
+
+static_assert(class_size(kClassCount - 1) == SlabAllocator::kMaxSmallSize);
+static_assert(class_index(SlabAllocator::kMaxSmallSize) == kClassCount - 1);
+static_assert(class_index(129) == kSmallClasses && class_size(kSmallClasses) == 160);
+
+/// 线程缓存与中心之间一次搬运的块数。
+constexpr uint32_t batch_count(std::size_t index) {
+    const std::size_t n = 32 * 1024 / class_size(index);
+    return static_cast<uint32_t>(n < 4 ? 4 : (n > 64 ? 64 : n));
+}
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+struct CentralList {
+    std::mutex mutex;
+    FreeBlock* head = nullptr;
+};
+
+struct Central {
+    std::array<CentralList, kClassCount> lists;
+    std::atomic<uint64_t> slab_bytes{0};
+    std::atomic<uint64_t> fetches{0};
+    std::atomic<uint64_t> releases{0};
+    std::atomic<uint64_t> large{0};
+};
+
+// 有意泄漏：线程缓存可能在静态析构期间才归还，中心必须一直存在。
+Central& central() {
+    static Central* instance = new Central();
+    return *instance;
+}
+
+/// 切一块新 slab，返回串好的空闲链表；调用方持有该等级的中心锁。
+FreeBlock* carve_slab(std::size_t index) {
+    const std::size_t size = class_size(index);
+    const std::size_t blocks = kSlabBytes / size;
+    auto* base = static_cast<char*>(::operator new(blocks * size));
+    central().slab_bytes.fetch_add(blocks * size, std::memory_order_relaxed);
+
+    FreeBlock* head = nullptr;
+    for (std::size_t i = blocks; i > 0; --i) {
+        auto* block = reinterpret_cast<FreeBlock*>(base + (i - 1) * size);
+        block->next = head;
+        head = block;
+    }
+    return head;
+}
+
+/// 从中心取最多 want 块，返回链表头，实际块数写入 got。
+FreeBlock* fetch_from_central(std::size_t index, uint32_t want, uint32_t& got) {
+    Central& c = central();
+    CentralList& list = c.lists[index];
+    c.fetches.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(list.mutex);
+    if (!list.head) {
+        list.head = carve_slab(index);
+    }
+    FreeBlock* head = list.head;
+    FreeBlock* tail = head;
+    got = 1;
+    while (got < want && tail->next) {
+        tail = tail->next;
+        ++got;
+    }
+    list.head = tail->next;
+    tail->next = nullptr;
+    return head;
+}
+
+/// 把 [head, tail] 整段挂回中心。
+void release_to_central(std::size_t index, FreeBlock* head, FreeBlock* tail) {
+    Central& c = central();
+    CentralList& list = c.lists[index];
+    c.releases.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(list.mutex);
+    tail->next = list.head;
+    list.head = head;
+}
+
+class ThreadCache {
+public:
+    ~ThreadCache();
+
+    void* allocate(std::size_t index) {
+        Local& local = lists_[index];
+        if (!local.head) {
+            local.head = fetch_from_central(index, batch_count(index), local.count);
+        }
+        FreeBlock* block = local.head;
+        local.head = block->next;
+        --local.count;
+        return block;
+    }
+
+    void deallocate(void* p, std::size_t index) {
+        Local& local = lists_[index];
+        auto* block = static_cast<FreeBlock*>(p);
+        block->next = local.head;
+        local.head = block;
+        ++local.count;
+
+        const uint32_t batch = batch_count(index);
+        if (local.count > 2 * batch) {
+            release(index, batch);
+        }
+    }
+
+private:
+    struct Local {
+        FreeBlock* head = nullptr;
+        uint32_t count = 0;
+    };
+
+    void release(std::size_t index, uint32_t n) {
+        Local& local = lists_[index];
+        FreeBlock* head = local.head;
+        FreeBlock* tail = head;
+        for (uint32_t i = 1; i < n; ++i) {
+            tail = tail->next;
+        }
+        local.head = tail->next;
+        local.count -= n;
+        release_to_central(index, head, tail);
+    }
+
+    std::array<Local, kClassCount> lists_{};
+};
+
+thread_local ThreadCache tls_cache;
+thread_local bool tls_cache_destroyed = false;
+
+ThreadCache::~ThreadCache() {
+    for (std::size_t i = 0; i < kClassCount; ++i) {
+        if (lists_[i].count > 0) {
+            release(i, lists_[i].count);
+        }
+    }
+    tls_cache_destroyed = true;
+}
+
+}  // namespace
+
+void* SlabAllocator::allocate(std::size_t bytes) {
+#ifdef IM_DISABLE_SLAB_ALLOCATOR
+    return ::operator new(bytes);
+#else
+    if (bytes > kMaxSmallSize) {
+        central().large.fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(bytes);
+    }
+    const std::size_t index = class_index(bytes);
+    if (tls_cache_destroyed) {
+        // 线程退出阶段（其他 thread_local 析构里）直接走中心。
+        uint32_t got = 0;
+        return fetch_from_central(index, 1, got);
+    }
+    return tls_cache.allocate(index);
+#endif
+}
+
+void SlabAllocator::deallocate(void* p, std::size_t bytes) noexcept {
+    if (!p) {
+        return;
+    }
+#ifdef IM_DISABLE_SLAB_ALLOCATOR
+    ::operator delete(p, bytes);
+#else
+    if (bytes > kMaxSmallSize) {
+        ::operator delete(p, bytes);
+        return;
+    }
+    const std::size_t index = class_index(bytes);
+    if (tls_cache_destroyed) {
+        auto* block = static_cast<FreeBlock*>(p);
+        release_to_central(index, block, block);
+        return;
+    }
+    tls_cache.deallocate(p, index);
+#endif
+}
+
+std::size_t SlabAllocator::block_size(std::size_t bytes) noexcept {
+#ifdef IM_DISABLE_SLAB_ALLOCATOR
+    return bytes;
+#else
+    return bytes > kMaxSmallSize ? bytes : class_size(class_index(bytes));
+#endif
+}
+
+SlabAllocatorStats SlabAllocator::stats() noexcept {
+    const Central& c = central();
+    SlabAllocatorStats s;
+    s.slab_bytes = c.slab_bytes.load(std::memory_order_relaxed);
+    s.central_fetches = c.fetches.load(std::memory_order_relaxed);
+    s.central_releases = c.releases.load(std::memory_order_relaxed);
+    s.large_allocations = c.large.load(std::memory_order_relaxed);
+    return s;
+}
+
+void* SlabMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    if (alignment > SlabAllocator::kAlignment) {
+        return ::operator new(bytes, std::align_val_t(alignment));
+    }
+    return SlabAllocator::allocate(bytes);
+}
+
+void SlabMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+    if (alignment > SlabAllocator::kAlignment) {
+        ::operator delete(p, bytes, std::align_val_t(alignment));
+        return;
+    }
+    SlabAllocator::deallocate(p, bytes);
+}
+
+std::pmr::memory_resource* slab_memory_resource() noexcept {
+    static SlabMemoryResource resource;
+    return &resource;
+}
+
+}  // namespace utils
+}  // namespace im
@@ -0,0 +1,122 @@
+#ifndef SLAB_ALLOCATOR_HPP
+#define SLAB_ALLOCATOR_HPP
+
+/******************************************************************************
+ *
+ * @file       slab_allocator.hpp
+ * @brief      按尺寸分级的 slab 分配器（线程本地缓存 + 批量归还）
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * 网关每处理一帧都会分配 UnifiedMessage、packaged_task 控制块、发送队列节点
+ * 等小对象。SlabAllocator 把不超过 kMaxSmallSize 的请求向上取整到固定尺寸
+ * 等级，每个线程为每个等级维护一条空闲链表，热路径上的分配/释放不加锁。
+ *
+ * 线程本地链表为空时从中心链表整批取块（中心也为空时切一块新的 slab）；
+ * 链表超过高水位时整批归还中心。一个线程分配、另一个线程释放的块（例如
+ * I/O 线程构造消息、工作线程析构）因此只在批量边界上触发一次加锁。线程
+ * 退出时把本地缓存全部归还中心。
+ *
+ * slab 一经切分不再归还系统，内存占用以峰值为准。超过 kMaxSmallSize 的请求
+ * 直接转发 ::operator new。定义 IM_DISABLE_SLAB_ALLOCATOR 后全部转发系统
+ * 分配器，便于 ASan / valgrind 定位越界。
+ *
+ * 释放必须带上分配时的字节数（sized delete、pmr、STL 分配器都满足）。
+ *
+ *****************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+namespace im {
+namespace utils {
+
+struct SlabAllocatorStats {
+    uint64_t slab_bytes = 0;         // 已切分的 slab 总字节数
+    uint64_t central_fetches = 0;    // 线程缓存从中心整批取块次数
+    uint64_t central_releases = 0;   // 线程缓存向中心整批归还次数
+    uint64_t large_allocations = 0;  // 超出尺寸等级、转发系统分配器的次数
+};
+
+class SlabAllocator {
+public:
+    static constexpr std::size_t kMaxSmallSize = 8192;
+    static constexpr std::size_t kAlignment = alignof(std::max_align_t);
+
+    /// 分配至少 bytes 字节、按 kAlignment 对齐的内存；失败抛 std::bad_alloc。
+    static void* allocate(std::size_t bytes);
+
+    /// 释放 allocate(bytes) 得到的内存，bytes 必须与分配时一致。
+    static void deallocate(void* p, std::size_t bytes) noexcept;
+
+    /// bytes 实际占用的块大小；大对象返回 bytes 本身。
+    static std::size_t block_size(std::size_t bytes) noexcept;
+
+    static SlabAllocatorStats stats() noexcept;
+};
+
+/**
+ * @brief std::pmr 适配器，对齐要求超过 kAlignment 时转发系统分配器。
+ */
+class SlabMemoryResource : public std::pmr::memory_resource {
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+/// 进程内唯一的 SlabMemoryResource。
+std::pmr::memory_resource* slab_memory_resource() noexcept;
+
+/**
+ * @brief 无状态 STL 分配器，供容器和 std::allocate_shared 使用。
+ */
+template <typename T>
+struct SlabStlAllocator {
+    using value_type = T;
+
+    SlabStlAllocator() noexcept = default;
+    template <typename U>
+    SlabStlAllocator(const SlabStlAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if constexpr (alignof(T) > SlabAllocator::kAlignment) {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        } else {
+            return static_cast<T*>(SlabAllocator::allocate(n * sizeof(T)));
+        }
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept {
+        if constexpr (alignof(T) > SlabAllocator::kAlignment) {
+            ::operator delete(p, n * sizeof(T), std::align_val_t(alignof(T)));
+        } else {
+            SlabAllocator::deallocate(p, n * sizeof(T));
+        }
+    }
+
+    template <typename U>
+    bool operator==(const SlabStlAllocator<U>&) const noexcept {
+        return true;
+    }
+};
+
+/**
+ * @brief 继承后类的 new/delete 走 SlabAllocator（仅单对象，数组仍用默认分配器）。
+ */
+struct SlabAllocated {
+    static void* operator new(std::size_t bytes) { return SlabAllocator::allocate(bytes); }
+    static void operator delete(void* p, std::size_t bytes) noexcept {
+        SlabAllocator::deallocate(p, bytes);
+    }
+};
+
+}  // namespace utils
+}  // namespace im
+
+#endif  // SLAB_ALLOCATOR_HPP
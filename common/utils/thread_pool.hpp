@@ -14,8 +14,10 @@
  *****************************************************************************/
 
 #include "singleton.hpp"
+#include "slab_allocator.hpp"
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <future>
 #include <mutex>
@@ -72,7 +74,9 @@ private:
     void WorkerThread();  // 工作线程函数，处理任务队列中的任务
 
     std::vector<std::thread> m_threads;         // 线程池中的线程
-    std::queue<std::function<void()>> m_tasks;  // 任务队列
+    using Task = std::function<void()>;
+    // 任务队列；节点块与 packaged_task 控制块都走 slab 线程缓存
+    std::queue<Task, std::deque<Task, SlabStlAllocator<Task>>> m_tasks;
     mutable std::mutex m_mutex;                 // 互斥锁，保护任务队列
     std::condition_variable m_condition;        // 条件变量，用于线程同步
     std::atomic<bool> m_shutdown{false};        // 线程池是否关闭标志
@@ -104,7 +108,10 @@ auto ThreadPool::Enqueue(F&& f,
     // std::packaged_task<return_type()> 表示一个无参数、返回 return_type 的函数对象
     // std::bind 将函数 f 和参数 args 绑定成一个无参数的函数对象
     // std::forward 进行完美转发，保持参数的原始值类型（左值/右值）
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
+    // allocate_shared 让控制块和 packaged_task 一起从 slab 分配（捕获 shared_ptr 的
+    // lambda 可放进 std::function 的内联存储，不再额外分配）
+    auto task = std::allocate_shared<std::packaged_task<return_type()>>(
+            SlabStlAllocator<std::packaged_task<return_type()>>(),
             std::bind(std::forward<F>(f), std::forward<Args>(args)...));
 
 
@@ -0,0 +1,34 @@
+-- Per-member group read cursors.
+--
+-- Group history is a shared timeline, so each member's read position lives in
+-- its own row. Unread counts are derived as "messages in the group with an id
+-- above the member's cursor, not sent by the member". The (group_id, id) index
+-- below carries sender_uid so that count stays an index-only range scan.
+--
+-- Existing members are backfilled at the current head of each group, so the
+-- first summary after rollout reports zero unread instead of their full history.
+
+CREATE TABLE IF NOT EXISTS "im_group_read_cursors" (
+  "group_id" BIGINT NOT NULL,
+  "user_uid" TEXT NOT NULL,
+  "last_read_msg_id" BIGINT NOT NULL DEFAULT 0,
+  "updated_at" BIGINT NOT NULL DEFAULT 0,
+  PRIMARY KEY ("group_id", "user_uid")
+);
+
+CREATE INDEX IF NOT EXISTS "im_group_read_cursors_user_i"
+  ON "im_group_read_cursors" ("user_uid");
+
+CREATE INDEX IF NOT EXISTS "im_group_messages_group_id_i"
+  ON "im_group_messages" ("group_id", "id") INCLUDE ("sender_uid");
+
+INSERT INTO "im_group_read_cursors"
+  ("group_id", "user_uid", "last_read_msg_id", "updated_at")
+SELECT m."group_id", m."user_uid", COALESCE(h."last_msg_id", 0),
+       (EXTRACT(EPOCH FROM now()) * 1000)::BIGINT
+  FROM "im_group_members" m
+  LEFT JOIN (
+        SELECT "group_id", MAX("id") AS "last_msg_id"
+          FROM "im_group_messages"
+         GROUP BY "group_id") h ON h."group_id" = m."group_id"
+ON CONFLICT ("group_id", "user_uid") DO NOTHING;
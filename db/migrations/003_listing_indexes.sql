@@ -0,0 +1,12 @@
+-- Indexes for per-user listing queries.
+--
+-- "My groups" filters im_group_members by user_uid, which the
+-- (group_id, user_uid) pair index cannot serve. Friend listing is split into
+-- a requester-side branch (served by im_friends_pair_i) and a target-side
+-- branch that needs its own (target_uid, status) index.
+
+CREATE INDEX IF NOT EXISTS "im_group_members_user_i"
+  ON "im_group_members" ("user_uid");
+
+CREATE INDEX IF NOT EXISTS "im_friends_target_status_i"
+  ON "im_friends" ("target_uid", "status");
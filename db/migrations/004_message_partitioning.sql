@@ -0,0 +1,141 @@
+-- Monthly range partitioning for the message tables.
+--
+-- "im_messages" and "im_group_messages" grow without bound and every history
+-- or offline query filters on their epoch-millisecond time column. Converting
+-- them to RANGE partitions on that column lets the planner skip months that
+-- cannot match and lets cold months be detached and archived as whole tables
+-- (see scripts/db/archive_message_partitions.sh).
+--
+-- The existing table is kept as-is: it is renamed to "<table>_legacy" and
+-- attached as the partition covering everything before the first monthly
+-- partition, so no rows are copied. Monthly partitions are named
+-- "<table>_pYYYYMM" (UTC months); a "<table>_default" partition catches rows
+-- outside the created ranges so inserts never fail. The message service calls
+-- im_ensure_monthly_partitions() on startup to keep upcoming months created.
+--
+-- The primary key must contain the partition key, so it becomes
+-- (id, time). Ids still come from the original sequence and stay unique.
+
+CREATE OR REPLACE FUNCTION im_month_start_ms(ts_ms BIGINT, month_offset INTEGER)
+RETURNS BIGINT
+LANGUAGE sql
+IMMUTABLE
+AS $$
+  SELECT (EXTRACT(EPOCH FROM
+            date_trunc('month', to_timestamp(ts_ms / 1000.0) AT TIME ZONE 'UTC')
+            + make_interval(months => month_offset)) * 1000)::BIGINT
+$$;
+
+CREATE OR REPLACE FUNCTION im_partition_by_month(parent TEXT, id_col TEXT, key_col TEXT)
+RETURNS VOID
+LANGUAGE plpgsql
+AS $$
+DECLARE
+  legacy TEXT := parent || '_legacy';
+  max_key BIGINT;
+  cutoff BIGINT;
+  seq TEXT;
+  idx RECORD;
+BEGIN
+  IF EXISTS (SELECT 1 FROM pg_partitioned_table
+             WHERE partrelid = to_regclass(quote_ident(parent))) THEN
+    RETURN;
+  END IF;
+
+  EXECUTE format('SELECT max(%I) FROM %I', key_col, parent) INTO max_key;
+  cutoff := im_month_start_ms(
+      GREATEST((EXTRACT(EPOCH FROM now()) * 1000)::BIGINT, COALESCE(max_key, 0)), 1);
+
+  EXECUTE format('ALTER TABLE %I RENAME TO %I', parent, legacy);
+  EXECUTE format('ALTER TABLE %I RENAME CONSTRAINT %I TO %I',
+                 legacy, parent || '_pkey', legacy || '_pkey');
+  FOR idx IN
+    SELECT indexname FROM pg_indexes
+    WHERE tablename = legacy AND indexname LIKE parent || '\_%' ESCAPE '\'
+  LOOP
+    EXECUTE format('ALTER INDEX %I RENAME TO %I', idx.indexname,
+                   legacy || substr(idx.indexname, length(parent) + 1));
+  END LOOP;
+
+  EXECUTE format('CREATE TABLE %I (LIKE %I INCLUDING DEFAULTS) PARTITION BY RANGE (%I)',
+                 parent, legacy, key_col);
+  EXECUTE format('ALTER TABLE %I ADD PRIMARY KEY (%I, %I)', parent, id_col, key_col);
+
+  seq := pg_get_serial_sequence(quote_ident(legacy), id_col);
+  IF seq IS NOT NULL THEN
+    EXECUTE format('ALTER SEQUENCE %s OWNED BY %I.%I', seq, parent, id_col);
+  END IF;
+
+  EXECUTE format('ALTER TABLE %I ATTACH PARTITION %I FOR VALUES FROM (MINVALUE) TO (%s)',
+                 parent, legacy, cutoff);
+  EXECUTE format('CREATE TABLE IF NOT EXISTS %I PARTITION OF %I DEFAULT',
+                 parent || '_default', parent);
+END;
+$$;
+
+-- Creates the monthly partitions for the month containing from_ms and the
+-- following months_ahead months. Rows that already landed in the default
+-- partition for a new month are moved into it. Months that overlap an existing
+-- partition (e.g. the legacy range) are skipped. Returns the number created.
+CREATE OR REPLACE FUNCTION im_ensure_monthly_partitions(parent TEXT,
+                                                        key_col TEXT,
+                                                        from_ms BIGINT,
+                                                        months_ahead INTEGER)
+RETURNS INTEGER
+LANGUAGE plpgsql
+AS $$
+DECLARE
+  lo BIGINT;
+  hi BIGINT;
+  part TEXT;
+  created INTEGER := 0;
+BEGIN
+  FOR i IN 0..months_ahead LOOP
+    lo := im_month_start_ms(from_ms, i);
+    hi := im_month_start_ms(from_ms, i + 1);
+    part := parent || '_p' || to_char(to_timestamp(lo / 1000) AT TIME ZONE 'UTC', 'YYYYMM');
+    CONTINUE WHEN to_regclass(quote_ident(part)) IS NOT NULL;
+
+    BEGIN
+      EXECUTE format('CREATE TABLE %I (LIKE %I INCLUDING DEFAULTS)', part, parent);
+      IF to_regclass(quote_ident(parent || '_default')) IS NOT NULL THEN
+        EXECUTE format('WITH moved AS (DELETE FROM %I WHERE %I >= $1 AND %I < $2 RETURNING *) '
+                       'INSERT INTO %I SELECT * FROM moved',
+                       parent || '_default', key_col, key_col, part)
+          USING lo, hi;
+      END IF;
+      EXECUTE format('ALTER TABLE %I ATTACH PARTITION %I FOR VALUES FROM (%s) TO (%s)',
+                     parent, part, lo, hi);
+      created := created + 1;
+    EXCEPTION WHEN invalid_object_definition THEN
+      -- Range already covered by another partition; the subtransaction rollback
+      -- also undoes the CREATE TABLE and any moved rows.
+      NULL;
+    END;
+  END LOOP;
+  RETURN created;
+END;
+$$;
+
+SELECT im_partition_by_month('im_messages', 'msg_id', 'create_time');
+SELECT im_partition_by_month('im_group_messages', 'id', 'created_at');
+
+-- Partitioned indexes; each partition gets its own copy. They match the
+-- history, offline and unread-count access paths so every surviving partition
+-- is probed by index.
+CREATE INDEX IF NOT EXISTS "im_messages_pair_time_i"
+  ON "im_messages" ("sender_uid", "receiver_uid", "create_time");
+
+CREATE INDEX IF NOT EXISTS "im_messages_receiver_status_time_i"
+  ON "im_messages" ("receiver_uid", "status", "create_time");
+
+CREATE INDEX IF NOT EXISTS "im_group_messages_group_id_i"
+  ON "im_group_messages" ("group_id", "id") INCLUDE ("sender_uid");
+
+CREATE INDEX IF NOT EXISTS "im_group_messages_group_time_i"
+  ON "im_group_messages" ("group_id", "created_at");
+
+SELECT im_ensure_monthly_partitions('im_messages', 'create_time',
+                                    (EXTRACT(EPOCH FROM now()) * 1000)::BIGINT, 3);
+SELECT im_ensure_monthly_partitions('im_group_messages', 'created_at',
+                                    (EXTRACT(EPOCH FROM now()) * 1000)::BIGINT, 3);
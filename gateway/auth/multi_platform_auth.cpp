@@ -80,6 +80,13 @@ MultiPlatformAuthManager::MultiPlatformAuthManager(std::string secret_key,
     }
 }
 
+MultiPlatformAuthManager::MultiPlatformAuthManager(std::string secret_key,
+                                                   const std::string& config_path,
+                                                   RevocationChecker revocation_checker)
+        : secret_key_(std::move(secret_key)),
+          platform_token_strategy_(config_path),
+          revocation_checker_(std::move(revocation_checker)) {}
+
 MultiPlatformAuthManager::MultiPlatformAuthManager(const std::string& config_path)
         : platform_token_strategy_(config_path) {
     ConfigManager config(config_path);
@@ -270,6 +277,7 @@ bool MultiPlatformAuthManager::verify_access_token(const std::string& access_tok
         user_info.platform = decoded.get_payload_claim("platform").as_string();
         user_info.create_time = decoded.get_issued_at();
         user_info.expire_time = decoded.get_expires_at();
+        user_info.token_id = decoded.get_id();
 
         return true;
 
@@ -463,9 +471,15 @@ bool MultiPlatformAuthManager::del_refresh_token(const std::string& refresh_toke
 }
 
 bool MultiPlatformAuthManager::is_token_revoked(const std::string& token) {
+    return is_token_id_revoked(extract_jti(token));
+}
+
+bool MultiPlatformAuthManager::is_token_id_revoked(const std::string& jti) {
     try {
-        std::string jti = extract_jti(token);
         if (jti.empty()) return false;
+        if (revocation_checker_) {
+            return revocation_checker_(jti);
+        }
         auto conn = RedisManager::GetInstance().get_connection();
         return conn->exists("revoked_access_token:" + jti);
 
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <random>
@@ -95,6 +96,7 @@ struct UserTokenInfo {
     std::string platform;   ///< 平台标识，例如 "web", "mobile", "desktop"
     std::chrono::system_clock::time_point create_time;  ///< Token创建时间
     std::chrono::system_clock::time_point expire_time;  ///< Token过期时间
+    std::string token_id;   ///< Token的JWT ID (jti)，用于撤销检查
 };
 
 
@@ -167,6 +169,9 @@ private:
  */
 class MultiPlatformAuthManager {
 public:
+    /// Access Token 撤销检查，参数为 jti，返回是否已撤销
+    using RevocationChecker = std::function<bool(const std::string& jti)>;
+
     /**
      * @brief 构造函数，初始化认证管理器
      * @param secret_key JWT签名密钥
@@ -176,6 +181,16 @@ public:
 
     MultiPlatformAuthManager(const std::string& config_path);
 
+    /**
+     * @brief 不连接Redis的构造函数，撤销检查交给 revocation_checker
+     * @param secret_key JWT签名密钥
+     * @param config_path 平台配置文件路径
+     * @param revocation_checker 撤销检查
+     *
+     * @note 用于进程内压测和不依赖Redis的测试；Refresh Token 相关接口仍需要Redis
+     */
+    MultiPlatformAuthManager(std::string secret_key, const std::string& config_path,
+                             RevocationChecker revocation_checker);
 
 
     /**
@@ -251,6 +266,13 @@ public:
      */
     bool is_token_revoked(const std::string& token);
 
+    /**
+     * @brief 按 JWT ID 检查Token是否已被撤销，省去一次Token解码
+     * @param jti Token的JWT ID（UserTokenInfo::token_id）
+     * @return Token是否已被撤销
+     */
+    bool is_token_id_revoked(const std::string& jti);
+
     /**
      * @brief 撤销Access Token
      * @param token Access Token字符串
@@ -304,6 +326,7 @@ private:
 private:
     std::string secret_key_;                         ///< JWT签名密钥
     PlatformTokenStrategy platform_token_strategy_;  ///< 平台Token策略管理器
+    RevocationChecker revocation_checker_;           ///< 为空时查询Redis撤销列表
 };
 
 
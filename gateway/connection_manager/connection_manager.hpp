@@ -5,7 +5,7 @@
  *
  * @file       connection_manager.hpp
  * @brief      连接管理器，负责管理客户端连接，支持多设备登录和同设备登录挤号
- *             使用Redis作为后端存储，与WebSocketServer集成实现会话管理
+ *             连接状态保存在 ConnectionStateStore（默认Redis），与WebSocketServer集成实现会话管理
  *
  * @author     myself
  * @date       2025/08/19
@@ -14,8 +14,9 @@
  *             1. 多设备登录支持：允许同一用户在不同设备上同时登录
  *             2. 平台特定配置：根据平台配置决定是否允许多设备登录
  *             3. 登录挤号机制：对于不允许多设备登录的平台，实现登录挤号功能
- *             4. Redis存储：使用Redis持久化存储连接信息，支持分布式部署
- *             5. WebSocket集成：与WebSocketServer集成，支持会话操作
+ *             4. Redis存储：默认使用Redis持久化存储连接信息，支持分布式部署；
+ *                单进程场景可注入 InMemoryConnectionStateStore
+ *             5. 会话集成：通过SessionLookup查找WebSocket/原生TCP连接，支持会话操作
  *
  * @note       Redis键结构设计：
  *             - user:sessions:{user_id} 存储用户在各个设备上的会话信息
@@ -29,60 +30,57 @@
 #include <string>
 #include <vector>
 
-#include "../../common/database/redis/redis_mgr.hpp"
-#include "../../common/network/websocket_session.hpp"
+#include "../../common/network/client_session.hpp"
 #include "../auth/multi_platform_auth.hpp"
+#include "connection_state_store.hpp"
 
 namespace im {
 namespace gateway {
 
 
 using SessionPtr = network::SessionPtr;
-using RedisManager = im::db::RedisManager;
 using PlatformTokenStrategy = im::gateway::PlatformTokenStrategy;
 
+// 前置声明
+class GatewayServer;
 
+/**
+ * @class PresenceListener
+ * @brief 接收 ConnectionManager 的连接变化，用于好友在线状态推送
+ *
+ * 每次会话绑定/解绑都会回调；user_online / user_offline 表示该用户在所有网关实例上
+ * 由离线变为在线 / 由在线变为离线（以 user:sessions 的会话数为准）。回调在调用 add_connection /
+ * remove_connection 的线程上执行，实现不应阻塞。
+ */
+class PresenceListener {
+public:
+    virtual ~PresenceListener() = default;
 
-// 设备会话信息结构
-struct DeviceSessionInfo {
-    std::string session_id;  ///< WebSocket会话ID
-    std::string device_id;   ///< 设备唯一标识
-    std::string platform;    ///< 平台标识（如android, ios, web等）
-    std::chrono::system_clock::time_point connect_time;  ///< 连接建立时间
-
-    /**
-     * @brief 序列化为JSON格式
-     * @return JSON对象
-     */
-    nlohmann::json to_json() const;
+    virtual void on_session_added(const std::string& user_id, const std::string& session_id,
+                                  bool user_online) = 0;
 
-    /**
-     * @brief 从JSON对象反序列化
-     * @param j JSON对象
-     * @return DeviceSessionInfo对象
-     */
-    static DeviceSessionInfo from_json(const nlohmann::json& j);
+    virtual void on_session_removed(const std::string& user_id, const std::string& session_id,
+                                    bool user_offline) = 0;
 };
 
-// 前置声明
-class GatewayServer;
-
 /**
  * @class ConnectionManager
  * @brief 连接管理器类，负责管理客户端WebSocket连接
  *
- * 该类使用Redis作为后端存储，支持多设备登录和同平台登录挤号功能。
- * 通过与WebSocketServer集成，实现会话的添加、查询和移除操作。
+ * 该类默认使用Redis作为后端存储，支持多设备登录和同平台登录挤号功能。
+ * 通过 SessionLookup 查找实际连接（WebSocket 或原生 TCP），实现会话的添加、查询和移除操作。
  */
 class ConnectionManager {
 public:
     /**
      * @brief 构造函数
      * @param platform_config_path 平台配置文件路径
-     * @param websocket_server WebSocket服务器指针，用于获取会话信息
+     * @param sessions 按会话ID查找连接，网关传入覆盖全部传输的查找器
+     * @param state_store 连接状态存储，为空时使用 RedisConnectionStateStore
      */
     explicit ConnectionManager(const std::string& platform_config_path,
-                               network::WebSocketServer* websocket_server);
+                               const network::SessionLookup* sessions,
+                               std::shared_ptr<ConnectionStateStore> state_store = nullptr);
 
     /**
      * @brief 添加连接（支持多设备）
@@ -93,7 +91,7 @@ public:
      * @return 是否添加成功
      *
      * @details 该方法会检查是否需要踢掉同平台的旧连接，然后将新的会话信息
-     *          存储到Redis中，包括用户会话映射、设备到用户映射和会话到用户映射。
+     *          写入连接状态存储，包括用户会话映射、设备到用户映射和会话到用户映射。
      */
     bool add_connection(const std::string& user_id,
                         const std::string& device_id,
@@ -105,7 +103,7 @@ public:
      * @param user_id 用户ID
      * @param device_id 设备ID
      *
-     * @details 从Redis中删除指定用户和设备的会话信息，包括所有相关的映射关系。
+     * @details 从连接状态存储中删除指定用户和设备的会话信息，包括所有相关的映射关系。
      */
     void remove_connection(const std::string& user_id, const std::string& device_id);
 
@@ -113,7 +111,8 @@ public:
      * @brief 移除连接（通过会话）
      * @param session WebSocket会话
      *
-     * @details 通过会话ID获取用户信息，然后调用remove_connection(user_id, device_id)方法。
+     * @details 通过会话ID获取用户信息，只在设备上登记的仍是该会话时删除，
+     *          旧会话晚于同设备的新会话关闭时不会把新会话的登记删掉。
      */
     void remove_connection(SessionPtr session);
 
@@ -122,9 +121,9 @@ public:
      * @param user_id 用户ID
      * @param device_id 设备ID
      * @param platform 平台标识
-     * @return WebSocket会话指针，如果找不到则返回nullptr
+     * @return 会话指针，如果找不到则返回nullptr
      *
-     * @details 通过Redis查询会话信息，然后通过WebSocketServer获取实际的SessionPtr。
+     * @details 从连接状态存储查询会话信息，然后通过SessionLookup获取实际的SessionPtr。
      */
     SessionPtr get_session(const std::string& user_id,
                            const std::string& device_id,
@@ -135,7 +134,7 @@ public:
      * @param user_id 用户ID
      * @return 设备会话信息列表
      *
-     * @details 从Redis中获取用户的所有会话信息，返回DeviceSessionInfo对象列表。
+     * @details 从连接状态存储获取用户的所有会话信息，返回DeviceSessionInfo对象列表。
      */
     std::vector<DeviceSessionInfo> get_user_sessions(const std::string& user_id);
 
@@ -143,7 +142,6 @@ public:
      * @brief 获取在线用户列表
      * @return 在线用户ID列表
      *
-     * @note 该实现需要一个全局的在线用户集合，可以考虑使用Redis的集合来维护。
      */
     std::vector<std::string> get_online_users();
 
@@ -153,16 +151,28 @@ public:
      */
     size_t get_online_count() const;
 
+    /**
+     * @brief 检查用户在任意网关上是否还有会话
+     * @param user_id 用户ID
+     * @return 是否在线；状态存储出错时返回 false
+     */
+    bool is_user_online(const std::string& user_id);
+
     /**
      * @brief 检查用户在指定平台是否已登录
      * @param user_id 用户ID
      * @param platform 平台标识
      * @return 是否已登录
      *
-     * @details 查询Redis中的用户平台设备集合，检查是否有指定平台的设备。
+     * @details 遍历用户的所有会话，检查是否有指定平台的设备。
      */
     bool is_user_online_on_platform(const std::string& user_id, const std::string& platform);
 
+    /**
+     * @brief 设置在线状态监听器，需在接入连接之前设置；传 nullptr 取消
+     */
+    void set_presence_listener(PresenceListener* listener) { presence_listener_ = listener; }
+
 
 private:
     /**
@@ -179,38 +189,26 @@ private:
                                              const std::string& platform);
 
     /**
-     * @brief 断开指定会话
-     * @param session_id 会话ID
-     *
-     * @details 通过WebSocketServer获取会话并关闭连接。
+     * @brief 从状态存储删除设备上的会话并通知在线状态监听
+     * @param session_id 为空时删除设备上的任意会话，否则只删除该会话
      */
-    void disconnect_session(const std::string& session_id);
+    void remove_device_session(const std::string& user_id, const std::string& device_id,
+                               const std::string& session_id);
 
     /**
-     * @brief 生成Redis键名
-     * @param prefix 键前缀
-     * @param user_id 用户ID
-     * @return 完整的Redis键名
-     *
-     * @details 生成格式为"prefix:user_id"的Redis键名。
-     */
-    std::string generate_redis_key(const std::string& prefix, const std::string& user_id) const;
-
-    /**
-     * @brief 生成设备字段名
-     * @param device_id 设备ID
-     * @param platform 平台标识
-     * @return 设备字段名
+     * @brief 断开指定会话
+     * @param session_id 会话ID
      *
-     * @details 生成格式为"device_id:platform"的设备字段名。
+     * @details 通过SessionLookup获取会话并关闭连接。
      */
-    std::string generate_device_field(const std::string& device_id,
-                                      const std::string& platform) const;
+    void disconnect_session(const std::string& session_id);
 
 private:
     mutable std::mutex mutex_;                                  ///< 线程安全互斥锁
     std::unique_ptr<PlatformTokenStrategy> platform_strategy_;  ///< 平台令牌策略管理器
-    network::WebSocketServer* websocket_server_;                ///< WebSocket服务器指针
+    const network::SessionLookup* sessions_;                    ///< 会话查找（各传输）
+    std::shared_ptr<ConnectionStateStore> state_store_;         ///< 连接状态存储
+    PresenceListener* presence_listener_ = nullptr;             ///< 在线状态监听（可选）
 };
 
 }  // namespace gateway
@@ -0,0 +1,352 @@
+#include "connection_state_store.hpp"
+
+#include "../../common/database/redis/redis_mgr.hpp"
+#include "../../common/utils/log_manager.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <unordered_set>
+
+namespace im {
+namespace gateway {
+
+using im::db::RedisManager;
+
+// DeviceSessionInfo序列化方法实现
+nlohmann::json DeviceSessionInfo::to_json() const {
+    nlohmann::json j;
+    j["session_id"] = session_id;
+    j["device_id"] = device_id;
+    j["platform"] = platform;
+    // 将时间点转换为毫秒数进行存储
+    j["connect_time"] =
+            std::chrono::duration_cast<std::chrono::milliseconds>(connect_time.time_since_epoch())
+                    .count();
+    return j;
+}
+
+DeviceSessionInfo DeviceSessionInfo::from_json(const nlohmann::json& j) {
+    DeviceSessionInfo info;
+    info.session_id = j.value("session_id", "");
+    info.device_id = j.value("device_id", "");
+    info.platform = j.value("platform", "");
+    // 从毫秒数恢复时间点
+    auto timestamp = j.value("connect_time", 0LL);
+    info.connect_time = std::chrono::system_clock::time_point(std::chrono::milliseconds(timestamp));
+    return info;
+}
+
+// ==================== RedisConnectionStateStore ====================
+
+RedisConnectionStateStore::RedisConnectionStateStore(std::size_t online_buckets)
+        : online_buckets_(std::max<std::size_t>(1, online_buckets)) {}
+
+std::string RedisConnectionStateStore::redis_key(const std::string& prefix,
+                                                 const std::string& id) {
+    return prefix + ":{" + id + "}";
+}
+
+std::string RedisConnectionStateStore::user_sessions_key(const std::string& user_id) {
+    return redis_key("user:sessions", user_id);
+}
+
+std::string RedisConnectionStateStore::user_platform_key(const std::string& user_id) {
+    return redis_key("user:platform", user_id);
+}
+
+std::string RedisConnectionStateStore::session_owner_key(const std::string& session_id) {
+    return redis_key("session:user", session_id);
+}
+
+std::string RedisConnectionStateStore::bucket_key(std::size_t bucket) const {
+    return online_buckets_ == 1 ? std::string("online:users")
+                                : redis_key("online:users", std::to_string(bucket));
+}
+
+std::string RedisConnectionStateStore::online_key(const std::string& user_id) const {
+    return bucket_key(im::db::RedisClient::key_slot(user_id) % online_buckets_);
+}
+
+std::string RedisConnectionStateStore::device_field(const std::string& device_id,
+                                                    const std::string& platform) {
+    return device_id + ":" + platform;
+}
+
+namespace {
+
+// KEYS[1] user:sessions:{uid}  KEYS[2] user:platform:{uid}
+// ARGV[1] device_id:platform   ARGV[2] 会话信息JSON
+// 登记会话；返回 1 表示 HLEN 由 0 变为 1（用户由离线变为在线）
+const std::string kAddSessionScript = R"lua(
+local before = redis.call('HLEN', KEYS[1])
+redis.call('HSET', KEYS[1], ARGV[1], ARGV[2])
+redis.call('SADD', KEYS[2], ARGV[1])
+if before == 0 then
+    return 1
+end
+return 0
+)lua";
+
+// KEYS[1] user:sessions:{uid}  KEYS[2] user:platform:{uid}
+// ARGV[1] device_id            ARGV[2] session_id
+// 只删除 device_id 上会话ID等于 ARGV[2] 的字段；返回值 bit0 = 已删除，
+// bit1 = 这次删除让 HLEN 由 1 变为 0（用户由在线变为离线）
+const std::string kRemoveSessionScript = R"lua(
+local removed = 0
+local entries = redis.call('HGETALL', KEYS[1])
+for i = 1, #entries, 2 do
+    local field = entries[i]
+    local sep = string.find(field, ':', 1, true)
+    if sep and string.sub(field, 1, sep - 1) == ARGV[1] then
+        local ok, info = pcall(cjson.decode, entries[i + 1])
+        if ok and type(info) == 'table' and info['session_id'] == ARGV[2] then
+            redis.call('HDEL', KEYS[1], field)
+            redis.call('SREM', KEYS[2], field)
+            removed = 1
+            break
+        end
+    end
+end
+if removed == 1 and redis.call('HLEN', KEYS[1]) == 0 then
+    return 3
+end
+return removed
+)lua";
+
+}  // namespace
+
+bool RedisConnectionStateStore::add(const std::string& user_id, const DeviceSessionInfo& info) {
+    auto sessions_key = user_sessions_key(user_id);
+    auto devices_key = user_platform_key(user_id);
+    auto session_user_key = session_owner_key(info.session_id);
+    auto field = device_field(info.device_id, info.platform);
+    auto session_json = info.to_json().dump();
+
+    return RedisManager::GetInstance().execute([&](auto& redis) {
+        // 1. 原子登记用户会话和设备，上线与否由 user:sessions 的 HLEN 变化决定，
+        //    多个网关同时登记同一用户时只有一个看到 0 -> 1
+        const bool came_online =
+                redis.eval(kAddSessionScript, std::vector<std::string>{sessions_key, devices_key},
+                           std::vector<std::string>{field, session_json}) == 1;
+
+        // 2. 保存会话到用户映射
+        redis.hset(session_user_key, "user_id", user_id);
+        redis.hset(session_user_key, "device_id", info.device_id);
+        redis.hset(session_user_key, "platform", info.platform);
+
+        // 3. 在线集合只是统计用的索引（与用户的键不同槽，不能放进脚本），每次都 SADD，
+        //    被并发的下线误删后下一次登记即可补回
+        redis.sadd(online_key(user_id), user_id);
+        return came_online;
+    });
+}
+
+RemovedSession RedisConnectionStateStore::remove(const std::string& user_id,
+                                                 const std::string& device_id,
+                                                 const std::string& session_id) {
+    auto sessions_key = user_sessions_key(user_id);
+    auto devices_key = user_platform_key(user_id);
+
+    RemovedSession removed;
+    RedisManager::GetInstance().execute([&](auto& redis) {
+        std::string target = session_id;
+        if (target.empty()) {
+            // 未指定会话：删除设备上当前登记的会话
+            std::unordered_map<std::string, std::string> sessions;
+            redis.hgetall(sessions_key, std::inserter(sessions, sessions.begin()));
+            for (const auto& [field, value] : sessions) {
+                auto pos = field.find(':');
+                if (pos != std::string::npos && field.substr(0, pos) == device_id) {
+                    target = DeviceSessionInfo::from_json(nlohmann::json::parse(value)).session_id;
+                    break;
+                }
+            }
+        }
+
+        // 比较会话ID后再删除，HGETALL 与 HDEL 之间不会被其它网关的登记插入
+        auto result = redis.eval(kRemoveSessionScript,
+                                 std::vector<std::string>{sessions_key, devices_key},
+                                 std::vector<std::string>{device_id, target});
+
+        // 会话ID跨进程唯一，无论设备上登记的是否还是它，反查键都可以删除
+        if (!target.empty()) {
+            redis.del(session_owner_key(target));
+        }
+        if (result & 1) {
+            removed.session_id = target;
+        }
+        // 下线以脚本内的 HLEN 变化为准；在线集合只是索引，SREM 前再确认一次没有
+        // 其它网关在脚本之后登记了新会话
+        removed.user_offline = (result & 2) != 0;
+        if (removed.user_offline && redis.hlen(sessions_key) == 0) {
+            redis.srem(online_key(user_id), user_id);
+        }
+    });
+    return removed;
+}
+
+std::optional<SessionOwner> RedisConnectionStateStore::find_owner(const std::string& session_id) {
+    auto session_user_key = session_owner_key(session_id);
+
+    std::unordered_map<std::string, std::string> user_info;
+    RedisManager::GetInstance().execute([&](auto& redis) {
+        redis.hgetall(session_user_key, std::inserter(user_info, user_info.begin()));
+    });
+    if (user_info["user_id"].empty()) {
+        return std::nullopt;
+    }
+    return SessionOwner{user_info["user_id"], user_info["device_id"], user_info["platform"]};
+}
+
+std::optional<DeviceSessionInfo> RedisConnectionStateStore::find(const std::string& user_id,
+                                                                 const std::string& device_id,
+                                                                 const std::string& platform) {
+    auto sessions_key = user_sessions_key(user_id);
+    auto field = device_field(device_id, platform);
+
+    auto result = RedisManager::GetInstance().execute(
+            [&](auto& redis) { return redis.hget(sessions_key, field); });
+    if (!result) {
+        return std::nullopt;
+    }
+    return DeviceSessionInfo::from_json(nlohmann::json::parse(*result));
+}
+
+std::vector<DeviceSessionInfo> RedisConnectionStateStore::list(const std::string& user_id) {
+    auto sessions_key = user_sessions_key(user_id);
+
+    std::unordered_map<std::string, std::string> session_map;
+    RedisManager::GetInstance().execute([&](auto& redis) {
+        redis.hgetall(sessions_key, std::inserter(session_map, session_map.begin()));
+    });
+
+    std::vector<DeviceSessionInfo> sessions;
+    sessions.reserve(session_map.size());
+    for (const auto& [field, value] : session_map) {
+        try {
+            sessions.push_back(DeviceSessionInfo::from_json(nlohmann::json::parse(value)));
+        } catch (const std::exception& e) {
+            im::utils::LogManager::GetLogger("connection_manager")
+                    ->error("Failed to parse session info for user {}: {}", user_id, e.what());
+        }
+    }
+    return sessions;
+}
+
+std::vector<std::string> RedisConnectionStateStore::online_users() {
+    std::unordered_set<std::string> user_set;
+    RedisManager::GetInstance().execute([&](auto& redis) {
+        for (std::size_t bucket = 0; bucket < online_buckets_; ++bucket) {
+            redis.smembers(bucket_key(bucket), std::inserter(user_set, user_set.begin()));
+        }
+    });
+    return {user_set.begin(), user_set.end()};
+}
+
+std::size_t RedisConnectionStateStore::online_count() {
+    auto count = RedisManager::GetInstance().execute([&](auto& redis) {
+        int64_t total = 0;
+        for (std::size_t bucket = 0; bucket < online_buckets_; ++bucket) {
+            total += redis.scard(bucket_key(bucket));
+        }
+        return total;
+    });
+    return static_cast<std::size_t>(count);
+}
+
+// ==================== InMemoryConnectionStateStore ====================
+
+bool InMemoryConnectionStateStore::add(const std::string& user_id, const DeviceSessionInfo& info) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto [user_it, came_online] = sessions_.try_emplace(user_id);
+    auto& devices = user_it->second;
+    auto& slot = devices[info.device_id + ":" + info.platform];
+    if (!slot.session_id.empty() && slot.session_id != info.session_id) {
+        owners_.erase(slot.session_id);
+    }
+    slot = info;
+    owners_[info.session_id] = SessionOwner{user_id, info.device_id, info.platform};
+    return came_online;
+}
+
+RemovedSession InMemoryConnectionStateStore::remove(const std::string& user_id,
+                                                    const std::string& device_id,
+                                                    const std::string& session_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    RemovedSession removed;
+    auto user_it = sessions_.find(user_id);
+    if (user_it == sessions_.end()) {
+        return removed;
+    }
+    auto& devices = user_it->second;
+    for (auto it = devices.begin(); it != devices.end(); ++it) {
+        if (it->second.device_id == device_id &&
+            (session_id.empty() || it->second.session_id == session_id)) {
+            removed.session_id = it->second.session_id;
+            owners_.erase(it->second.session_id);
+            devices.erase(it);
+            break;
+        }
+    }
+    if (devices.empty()) {
+        sessions_.erase(user_it);
+        removed.user_offline = true;
+    }
+    return removed;
+}
+
+std::optional<SessionOwner> InMemoryConnectionStateStore::find_owner(
+        const std::string& session_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = owners_.find(session_id);
+    if (it == owners_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<DeviceSessionInfo> InMemoryConnectionStateStore::find(const std::string& user_id,
+                                                                    const std::string& device_id,
+                                                                    const std::string& platform) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto user_it = sessions_.find(user_id);
+    if (user_it == sessions_.end()) {
+        return std::nullopt;
+    }
+    auto it = user_it->second.find(device_id + ":" + platform);
+    if (it == user_it->second.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::vector<DeviceSessionInfo> InMemoryConnectionStateStore::list(const std::string& user_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<DeviceSessionInfo> sessions;
+    auto user_it = sessions_.find(user_id);
+    if (user_it != sessions_.end()) {
+        sessions.reserve(user_it->second.size());
+        for (const auto& [field, info] : user_it->second) {
+            sessions.push_back(info);
+        }
+    }
+    return sessions;
+}
+
+std::vector<std::string> InMemoryConnectionStateStore::online_users() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> users;
+    users.reserve(sessions_.size());
+    for (const auto& [user_id, devices] : sessions_) {
+        users.push_back(user_id);
+    }
+    return users;
+}
+
+std::size_t InMemoryConnectionStateStore::online_count() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sessions_.size();
+}
+
+}  // namespace gateway
+}  // namespace im
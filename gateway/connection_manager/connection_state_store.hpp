@@ -0,0 +1,186 @@
+#ifndef CONNECTION_STATE_STORE_HPP
+#define CONNECTION_STATE_STORE_HPP
+
+/******************************************************************************
+ *
+ * @file       connection_state_store.hpp
+ * @brief      ConnectionManager 的连接状态存储
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ * @details    ConnectionManager 只负责挤号策略和会话查找，用户/设备/会话之间的
+ *             映射关系交给 ConnectionStateStore 保存：
+ *             - RedisConnectionStateStore：默认实现，多网关实例共享，键结构见
+ *               connection_manager.hpp；
+ *             - InMemoryConnectionStateStore：单进程内存实现，供进程内压测和
+ *               不依赖 Redis 的测试使用。
+ *
+ *             存储实现出错时直接抛异常，由 ConnectionManager 统一记录日志。
+ *
+ *****************************************************************************/
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace im {
+namespace gateway {
+
+// 设备会话信息结构
+struct DeviceSessionInfo {
+    std::string session_id;  ///< WebSocket会话ID
+    std::string device_id;   ///< 设备唯一标识
+    std::string platform;    ///< 平台标识（如android, ios, web等）
+    std::chrono::system_clock::time_point connect_time;  ///< 连接建立时间
+
+    /**
+     * @brief 序列化为JSON格式
+     * @return JSON对象
+     */
+    nlohmann::json to_json() const;
+
+    /**
+     * @brief 从JSON对象反序列化
+     * @param j JSON对象
+     * @return DeviceSessionInfo对象
+     */
+    static DeviceSessionInfo from_json(const nlohmann::json& j);
+};
+
+/// 会话ID反查到的归属信息
+struct SessionOwner {
+    std::string user_id;
+    std::string device_id;
+    std::string platform;
+};
+
+/// remove() 的结果
+struct RemovedSession {
+    std::string session_id;     ///< 被删除的会话ID，设备不存在时为空
+    bool user_offline = false;  ///< 这次删除后用户不再有任何会话（由在线变为离线）
+};
+
+class ConnectionStateStore {
+public:
+    virtual ~ConnectionStateStore() = default;
+
+    /**
+     * @brief 记录用户在 device_id:platform 上的会话，并加入在线用户集合
+     * @return 用户此前没有任何会话（由离线变为在线）时返回 true
+     */
+    virtual bool add(const std::string& user_id, const DeviceSessionInfo& info) = 0;
+
+    /**
+     * @brief 删除用户在 device_id 上的会话；用户没有剩余会话时移出在线集合
+     * @param session_id 非空时只在设备上登记的仍是该会话时才删除（compare-and-delete），
+     *        避免旧会话关闭时删掉同设备上新登记的会话（挤号、热重启）；为空时删除设备上的任意会话
+     */
+    virtual RemovedSession remove(const std::string& user_id, const std::string& device_id,
+                                  const std::string& session_id) = 0;
+
+    /**
+     * @brief 通过会话ID查找归属的用户和设备
+     */
+    virtual std::optional<SessionOwner> find_owner(const std::string& session_id) = 0;
+
+    /**
+     * @brief 查找用户在指定设备和平台上的会话
+     */
+    virtual std::optional<DeviceSessionInfo> find(const std::string& user_id,
+                                                  const std::string& device_id,
+                                                  const std::string& platform) = 0;
+
+    /**
+     * @brief 用户在所有设备上的会话
+     */
+    virtual std::vector<DeviceSessionInfo> list(const std::string& user_id) = 0;
+
+    virtual std::vector<std::string> online_users() = 0;
+
+    virtual std::size_t online_count() = 0;
+};
+
+/**
+ * @brief 基于 Redis 的连接状态存储
+ *
+ * 键结构（花括号为 Cluster hash tag：同一用户的 user:* 键落在同一个槽，
+ * session:user 按会话ID分布，与用户的键不保证同槽）：
+ * - user:sessions:{user_id}  Hash，字段 device_id:platform，值为会话信息JSON
+ * - user:platform:{user_id}  Set，成员 device_id:platform
+ * - session:user:{session_id} Hash，字段 user_id / device_id / platform
+ * - online:users             Set，在线用户ID；分桶时为 online:users:{bucket}，
+ *                            bucket = key_slot(user_id) % online_buckets
+ *
+ * 用户级上下线取自 Lua 脚本内 user:sessions:{user_id} 的 HLEN 变化（0 -> 1、1 -> 0），
+ * 与会话登记/删除原子完成。online:users 与用户的键不同槽，只作为统计用的尽力而为索引。
+ */
+class RedisConnectionStateStore final : public ConnectionStateStore {
+public:
+    /**
+     * @param online_buckets 在线用户集合的分桶数，为 1 时使用单个 online:users
+     */
+    explicit RedisConnectionStateStore(std::size_t online_buckets = 1);
+
+    bool add(const std::string& user_id, const DeviceSessionInfo& info) override;
+    RemovedSession remove(const std::string& user_id, const std::string& device_id,
+                          const std::string& session_id) override;
+    std::optional<SessionOwner> find_owner(const std::string& session_id) override;
+    std::optional<DeviceSessionInfo> find(const std::string& user_id,
+                                          const std::string& device_id,
+                                          const std::string& platform) override;
+    std::vector<DeviceSessionInfo> list(const std::string& user_id) override;
+    std::vector<std::string> online_users() override;
+    std::size_t online_count() override;
+
+    static std::string user_sessions_key(const std::string& user_id);
+    static std::string user_platform_key(const std::string& user_id);
+    static std::string session_owner_key(const std::string& session_id);
+    /// user_id 所在的在线用户集合
+    std::string online_key(const std::string& user_id) const;
+
+private:
+    /// 生成格式为"prefix:{id}"的Redis键名
+    static std::string redis_key(const std::string& prefix, const std::string& id);
+
+    /// 生成格式为"device_id:platform"的设备字段名
+    static std::string device_field(const std::string& device_id, const std::string& platform);
+
+    std::string bucket_key(std::size_t bucket) const;
+
+    std::size_t online_buckets_;
+};
+
+/**
+ * @brief 进程内连接状态存储，语义与 Redis 实现一致，但只对当前网关实例可见
+ */
+class InMemoryConnectionStateStore final : public ConnectionStateStore {
+public:
+    bool add(const std::string& user_id, const DeviceSessionInfo& info) override;
+    RemovedSession remove(const std::string& user_id, const std::string& device_id,
+                          const std::string& session_id) override;
+    std::optional<SessionOwner> find_owner(const std::string& session_id) override;
+    std::optional<DeviceSessionInfo> find(const std::string& user_id,
+                                          const std::string& device_id,
+                                          const std::string& platform) override;
+    std::vector<DeviceSessionInfo> list(const std::string& user_id) override;
+    std::vector<std::string> online_users() override;
+    std::size_t online_count() override;
+
+private:
+    std::mutex mutex_;
+    /// user_id -> (device_id:platform -> 会话信息)
+    std::unordered_map<std::string, std::unordered_map<std::string, DeviceSessionInfo>> sessions_;
+    std::unordered_map<std::string, SessionOwner> owners_;
+};
+
+}  // namespace gateway
+}  // namespace im
+
+#endif  // CONNECTION_STATE_STORE_HPP
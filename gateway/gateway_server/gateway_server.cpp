@@ -33,6 +33,7 @@
  *
  *****************************************************************************/
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <functional>
@@ -40,15 +41,20 @@
 #include <iostream>
 #include <memory>
 #include <filesystem>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <thread>
 
+#include <sys/socket.h>
+#include <unistd.h>
+
 // Protocol Buffers相关
 #include "../../common/proto/base.pb.h"
 #include "../../common/proto/command.pb.h"
 
 // 网络和编解码组件
+#include "../../common/network/protobuf_arena_pool.hpp"
 #include "../../common/network/protobuf_codec.hpp"
 
 // 工具组件
@@ -61,6 +67,8 @@
 #include "gateway_server.hpp"
 #include "httplib.h"
 #include "../http/httplib_adapter.hpp"
+#include "../ws/inline_command_handler.hpp"
+#include "../../common/network/tls_session_resumption.hpp"
 #include <nlohmann/json.hpp>
 
 namespace {
@@ -131,7 +139,9 @@ void register_user_http_routes_on_server(httplib::Server& server,
 #endif
 
 #ifdef IM_ENABLE_PUSH_SERVICE
+#include "../push/message_store_offline_source.hpp"
 #include "../push/push_service.hpp"
+#include "../push/redis_offline_outbox.hpp"
 #endif
 
 #ifdef IM_ENABLE_REMOTE_PUSH_NOTIFIER
@@ -163,12 +173,15 @@ void register_message_http_routes_on_server(httplib::Server& server,
 #endif
 
 #ifdef IM_ENABLE_MESSAGE_WS
+#include "../push/delivery_ledger.hpp"
+#include "../ws/delivery_ack_coalescer.hpp"
 #include "../ws/message_ws_handler.hpp"
 #endif
 
 #ifdef IM_ENABLE_FRIEND_HTTP
 #include "../http/friend_http_controller.hpp"
 #include "../http/friend_client.hpp"
+#include "../push/presence_fanout.hpp"
 #include "../../services/friend/friend_service.hpp"
 #include "../../services/user/password_hasher.hpp"
 #include "../../services/user/user_service.hpp"
@@ -352,18 +365,40 @@ using im::utils::ServiceIdentityManager;
  */
 GatewayServer::GatewayServer(const std::string platform_strategy_config,
                              const std::string router_mgr, uint16_t ws_port, uint16_t http_port)
+        : GatewayServer(platform_strategy_config, router_mgr, ws_port, http_port,
+                        GatewayDependencies{}) {}
+
+/**
+ * @brief 带依赖注入的构造函数
+ * @details deps 中非空的组件直接使用，其余按配置文件创建，
+ *          用于进程内压测等不连接 Redis / 远程服务的场景
+ */
+GatewayServer::GatewayServer(const std::string platform_strategy_config,
+                             const std::string router_mgr, uint16_t ws_port, uint16_t http_port,
+                             GatewayDependencies deps)
         : ssl_ctx_(boost::asio::ssl::context::tlsv12_server)
-        , auth_mgr_(std::make_shared<MultiPlatformAuthManager>(platform_strategy_config))
+        , conn_state_store_(std::move(deps.connection_state_store))
+        , auth_mgr_(deps.auth_mgr
+                            ? std::move(deps.auth_mgr)
+                            : std::make_shared<MultiPlatformAuthManager>(platform_strategy_config))
         , router_mgr_(std::make_shared<RouterManager>(router_mgr))
         , is_running_(false)
         , psc_path_(platform_strategy_config)
         , config_path_(platform_strategy_config) {
 
+#if defined(IM_ENABLE_MESSAGE_HTTP) || defined(IM_ENABLE_MESSAGE_WS) || defined(IM_ENABLE_PUSH_SERVICE)
+    message_client_ = std::move(deps.message_client);
+#endif
+
     ConfigManager config(platform_strategy_config);
     max_ws_inflight_messages_ = config.get<size_t>("gateway.max_ws_inflight_messages", 4096);
     if (max_ws_inflight_messages_ == 0) {
         max_ws_inflight_messages_ = 4096;
     }
+    max_ws_batch_size_ = config.get<size_t>("gateway.ws_max_batch_size", 64);
+    if (max_ws_batch_size_ == 0) {
+        max_ws_batch_size_ = 64;
+    }
 
     // 初始化分布式服务标识 - 用于微服务环境中的服务发现和标识
     if (!ServiceIdentityManager::getInstance().initializeFromEnv("gateway")) {
@@ -453,6 +488,12 @@ void GatewayServer::start() {
         websocket_server_->start();
         server_logger->info("WebSocket server started");
 
+        // 原生TCP端口（可选）- 与WebSocket共用消息处理和连接管理
+        if (tcp_server_) {
+            tcp_server_->start();
+            server_logger->info("TCP server started");
+        }
+
         // 启动HTTP服务器（在独立线程中运行，避免阻塞主线程）
         // 首先清理可能存在的旧线程
         if (http_thread_.joinable()) {
@@ -481,6 +522,9 @@ void GatewayServer::start() {
         is_running_ = true;
         server_logger->info("GatewayServer started successfully");
 
+        // 已在接收连接，通知旧进程开始排空，并等待下一次热重启
+        start_hot_restart();
+
     } catch (const std::exception& e) {
         server_logger->error("Failed to start GatewayServer: {}", e.what());
         is_running_ = false;
@@ -512,6 +556,13 @@ void GatewayServer::stop() {
     is_running_ = false;
     server_logger->info("Stopping GatewayServer...");
 
+    if (handoff_server_) {
+        handoff_server_->stop();
+    }
+    if (drain_timer_) {
+        boost::asio::post(drain_timer_->get_executor(), [this] { drain_timer_->cancel(); });
+    }
+
 #ifdef IM_ENABLE_REMOTE_PUSH_NOTIFIER
     stop_gateway_push_delivery_server();
 #endif
@@ -527,6 +578,33 @@ void GatewayServer::stop() {
         server_logger->error("Unknown error stopping WebSocket server");
     }
 
+    if (tcp_server_) {
+        try {
+            server_logger->info("Stopping TCP server...");
+            tcp_server_->stop();
+            server_logger->info("TCP server stopped");
+        } catch (const std::exception& e) {
+            server_logger->error("Error stopping TCP server: {}", e.what());
+        }
+    }
+
+#ifdef IM_ENABLE_FRIEND_HTTP
+    // 仍在关闭的会话会继续回调 presence_fanout_，对象随 GatewayServer 析构
+    if (presence_fanout_) {
+        presence_fanout_->stop();
+    }
+#endif
+
+#ifdef IM_ENABLE_MESSAGE_WS
+    // 连接已关闭，冲刷尚未写库的送达 ACK
+    if (delivery_ack_coalescer_) {
+        delivery_ack_coalescer_->stop();
+        const auto ack_stats = delivery_ack_coalescer_->stats();
+        server_logger->info("Delivery acks: {} received, {} coalesced writes",
+                            ack_stats.acks, ack_stats.flushes);
+    }
+#endif
+
     // 停止HTTP服务器
     try {
         server_logger->info("Stopping HTTP server...");
@@ -635,20 +713,67 @@ std::string GatewayServer::get_server_stats() const {
                 ss << " " << prefix << ".max_ms: " << stats.max_ms << std::endl;
             };
 
+    // 仅 local 模式下服务在网关进程内，remote 模式的缓存统计由对应服务自己输出。
+    [[maybe_unused]] const auto append_history_cache_stats =
+        [&ss](const char* prefix, const auto& stats) {
+            ss << " " << prefix << ".hits: " << stats.hits << std::endl;
+            ss << " " << prefix << ".misses: " << stats.misses << std::endl;
+            ss << " " << prefix << ".hit_ratio: " << stats.hit_ratio() << std::endl;
+            ss << " " << prefix << ".entries: " << stats.entries << std::endl;
+        };
     ss << "GatewayServer stats:" << std::endl;
     ss << "  Running: " << (is_running_ ? "true" : "false") << std::endl;
     ss << "online user count:" << conn_mgr_->get_online_count() << std::endl;
+    ss << " asio.backend: " << IOServicePool::backend_name() << std::endl;
     if (websocket_server_) {
         const auto ws_stats = websocket_server_->get_stats();
         ss << " ws.accept_ok: " << ws_stats.accept_ok << std::endl;
         ss << " ws.accept_fail: " << ws_stats.accept_fail << std::endl;
+        ss << " ws.admitted: " << ws_stats.admitted << std::endl;
+        ss << " ws.deferred: " << ws_stats.deferred << std::endl;
+        ss << " ws.dropped: " << ws_stats.dropped << std::endl;
         ss << " ws.active_handshakes: " << ws_stats.active_handshakes << std::endl;
         ss << " ws.current_sessions: " << ws_stats.current_sessions << std::endl;
+        ss << " ws.tls_full_handshakes: " << ws_stats.tls_full_handshakes << std::endl;
+        ss << " ws.tls_resumed_handshakes: " << ws_stats.tls_resumed_handshakes << std::endl;
+        ss << " ws.ktls_sessions: " << ws_stats.ktls_sessions << std::endl;
+        ss << " ws.ktls_fallbacks: " << ws_stats.ktls_fallbacks << std::endl;
+        ss << " ws.rss_bytes_per_session: " << ws_stats.rss_bytes_per_session << std::endl;
+        if (tls_ticket_keys_) {
+            ss << " ws.tls_ticket_key_rotations: " << tls_ticket_keys_->rotations() << std::endl;
+        }
         append_duration_stats("ws.ssl_handshake", ws_stats.ssl_handshake);
         append_duration_stats("ws.upgrade_read", ws_stats.upgrade_read);
         append_duration_stats("ws.accept_handshake", ws_stats.ws_accept);
         append_duration_stats("ws.session_add", ws_stats.session_add);
     }
+    if (tcp_server_) {
+        ss << " tcp.current_sessions: " << tcp_server_->get_session_count() << std::endl;
+    }
+    if (!hot_restart_socket_.empty()) {
+        ss << " hot_restart.draining: " << (draining_.load() ? 1 : 0) << std::endl;
+    }
+#ifdef IM_ENABLE_FRIEND_HTTP
+    if (presence_fanout_) {
+        const auto presence_stats = presence_fanout_->stats();
+        ss << " presence.transitions: " << presence_stats.transitions << std::endl;
+        ss << " presence.coalesced: " << presence_stats.coalesced << std::endl;
+        ss << " presence.published: " << presence_stats.published << std::endl;
+        ss << " presence.frames: " << presence_stats.frames << std::endl;
+    }
+#endif
+#if defined(IM_ENABLE_MESSAGE_HTTP) || defined(IM_ENABLE_MESSAGE_WS)
+    if (local_message_service_) {
+        append_history_cache_stats("message.history_cache",
+                                   local_message_service_->history_cache_stats());
+    }
+#endif
+#if defined(IM_ENABLE_GROUP_HTTP) || defined(IM_ENABLE_GROUP_MESSAGE_HTTP)
+    if (local_group_message_service_) {
+        append_history_cache_stats("group.history_cache",
+                                   local_group_message_service_->history_cache_stats());
+    }
+#endif
     ss << " processed message count:" << msg_parser_->get_stats().http_requests_parsed << std::endl;
     ss << "  processed websocket message count:"
        << msg_parser_->get_stats().websocket_messages_parsed << std::endl;
@@ -656,6 +781,8 @@ std::string GatewayServer::get_server_stats() const {
     ss << " parse.routing failed count:" << msg_parser_->get_stats().routing_failures << std::endl;
     ss << " ws.inflight_messages: " << ws_inflight_messages_.load() << std::endl;
     ss << " ws.max_inflight_messages: " << max_ws_inflight_messages_ << std::endl;
+    ss << " ws.inline_commands: " << (inline_commands_ ? inline_commands_->handled() : 0)
+       << std::endl;
     ss << " http.worker_threads: " << kHttpWorkerThreads << std::endl;
     ss << " http.max_queued_requests: " << kHttpMaxQueuedRequests << std::endl;
     ss << " http.keep_alive_timeout_sec: " << kHttpKeepAliveTimeoutSec << std::endl;
@@ -673,6 +800,13 @@ std::string GatewayServer::get_server_stats() const {
     ss << " http.status_other: "
        << http_stats_.status_other.load(std::memory_order_relaxed) << std::endl;
     ss << format_http_route_stats();
+    const auto arena_stats = im::network::ArenaPool::global().stats();
+    ss << " arena_pool.acquired: " << arena_stats.acquired << std::endl;
+    ss << " arena_pool.reused: " << arena_stats.reused << std::endl;
+    ss << " arena_pool.overflowed: " << arena_stats.overflowed << std::endl;
+    ss << " arena_pool.initial_block: " << arena_stats.initial_block << std::endl;
+    ss << " arena_pool.pooled: " << arena_stats.pooled << std::endl;
+    ss << " arena_pool.central_transfers: " << arena_stats.central_transfers << std::endl;
     ss << " thread_pool.threads: " << im::utils::ThreadPool::GetInstance().GetThreadCount()
        << std::endl;
     ss << " thread_pool.queued_or_running_tasks: "
@@ -801,7 +935,7 @@ bool GatewayServer::init_server(uint16_t ws_port, uint16_t http_port, const std:
                 message_cfg.get<std::string>("message.mode", "local");
 
 #ifdef IM_ENABLE_REMOTE_MESSAGE_CLIENT
-            if (message_mode == "remote") {
+            if (!message_client_ && message_mode == "remote") {
                 const int message_timeout_ms =
                     message_cfg.get<int>("message.timeout_ms", 200);
                 const std::string endpoint =
@@ -830,6 +964,7 @@ bool GatewayServer::init_server(uint16_t ws_port, uint16_t http_port, const std:
                 }
                 auto msg_svc =
                     std::make_shared<im::service::message::MessageService>(odb_db_);
+                local_message_service_ = msg_svc;
                 message_client_ = std::make_shared<LocalMessageClient>(msg_svc);
                 server_logger->info("Local Message client initialized");
             }
@@ -938,6 +1073,7 @@ bool GatewayServer::init_server(uint16_t ws_port, uint16_t http_port, const std:
                     odb_db_, user_svc);
                 auto group_msg_svc = std::make_shared<im::service::group::GroupMessageService>(
                     odb_db_, user_svc, group_svc);
+                local_group_message_service_ = group_msg_svc;
                 group_client_ = std::make_shared<LocalGroupClient>(group_svc, group_msg_svc);
                 server_logger->info("Local Group client initialized");
             }
@@ -988,6 +1124,7 @@ bool GatewayServer::init_server(uint16_t ws_port, uint16_t http_port, const std:
                     odb_db_, user_svc);
                 auto group_msg_svc = std::make_shared<im::service::group::GroupMessageService>(
                     odb_db_, user_svc, group_svc);
+                local_group_message_service_ = group_msg_svc;
                 group_client_ = std::make_shared<LocalGroupClient>(group_svc, group_msg_svc);
                 server_logger->info("Local Group client initialized");
             }
@@ -1001,18 +1138,60 @@ bool GatewayServer::init_server(uint16_t ws_port, uint16_t http_port, const std:
 #endif
 
         // 步骤5: 初始化网络服务器。HTTP初始化阶段会先注册专用路由，再注册 catch-all。
+        init_hot_restart();
         init_ws_server(ws_port);
+        init_tcp_server();
         init_http_server(http_port);
 
         // 步骤6: 初始化连接管理器 (依赖websocket_server)
         init_conn_mgr();
 
+#ifdef IM_ENABLE_FRIEND_HTTP
+        // 好友上下线推送：在接入连接之前挂到 ConnectionManager 上
+        {
+            ConfigManager presence_cfg(config_path_);
+            if (friend_client_ && presence_cfg.get<bool>("friend.presence.enabled", false)) {
+                const int window_ms = std::max(
+                        1, presence_cfg.get<int>("friend.presence.coalesce_window_ms", 2000));
+                // 推送走 PushService（与消息推送同一条路径），它在下方才创建，按调用时取
+                presence_fanout_ = std::make_unique<PresenceFanout>(
+                        [client = friend_client_](const std::string& uid) {
+                            std::vector<std::string> friend_uids;
+                            for (const auto& info : client->get_friends(uid)) {
+                                friend_uids.push_back(info.friend_uid);
+                            }
+                            return friend_uids;
+                        },
+                        [this](const std::string& receiver_uid,
+                               const std::string& frame) -> std::size_t {
+#ifdef IM_ENABLE_PUSH_SERVICE
+                            if (push_service_) {
+                                return push_service_->push_transient(receiver_uid, frame);
+                            }
+#endif
+                            (void)receiver_uid;
+                            (void)frame;
+                            return 0;
+                        },
+                        [conn_mgr = conn_mgr_.get()](const std::string& uid) {
+                            return conn_mgr->is_user_online(uid);
+                        },
+                        std::chrono::milliseconds(window_ms));
+                presence_fanout_->start();
+                conn_mgr_->set_presence_listener(presence_fanout_.get());
+                server_logger->info("Friend presence fan-out enabled (coalesce window {} ms)",
+                                    window_ms);
+            }
+        }
+#endif
+
         // Initialize PushService and WS message handler after ConnectionManager and WebSocketServer are ready.
 #ifdef IM_ENABLE_MESSAGE_WS
         try {
             if (!message_client_) {
                 auto msg_svc =
                     std::make_shared<im::service::message::MessageService>(odb_db_);
+                local_message_service_ = msg_svc;
                 message_client_ = std::make_shared<LocalMessageClient>(msg_svc);
                 server_logger->info("Local Message client initialized for WS/Push");
             }
@@ -1052,7 +1231,7 @@ bool GatewayServer::init_server(uint16_t ws_port, uint16_t http_port, const std:
                                              "push.gateway_delivery_listen_address",
                                              "push.mode=remote");
                 push_service_ = std::make_unique<PushService>(
-                    conn_mgr_.get(), websocket_server_.get(), message_client_);
+                    conn_mgr_.get(), &session_lookup_, message_client_);
                 start_gateway_push_delivery_server(delivery_listen_address);
                 remote_push_notifier_ = std::make_unique<RemotePushNotifier>(
                     endpoint, std::chrono::milliseconds(push_timeout_ms));
@@ -1064,14 +1243,67 @@ bool GatewayServer::init_server(uint16_t ws_port, uint16_t http_port, const std:
 #endif
             } else {
                 push_service_ = std::make_unique<PushService>(
-                    conn_mgr_.get(), websocket_server_.get(), message_client_);
+                    conn_mgr_.get(), &session_lookup_, message_client_);
                 push_notifier_ = push_service_.get();
                 server_logger->info("Local PushService initialized");
             }
 
+            if (push_service_ && push_cfg.get<bool>("push.offline_outbox.enabled", true)) {
+                RedisOfflineOutboxOptions outbox_options;
+                outbox_options.max_entries_per_user = static_cast<std::size_t>(
+                    push_cfg.get<int>("push.offline_outbox.max_entries", 1000));
+                outbox_options.ttl_seconds =
+                    push_cfg.get<int>("push.offline_outbox.ttl_seconds", 7 * 24 * 3600);
+                offline_outbox_ = std::make_shared<RedisOfflineOutbox>(outbox_options);
+                push_service_->set_offline_outbox(offline_outbox_);
+                server_logger->info("Redis offline outbox enabled (max {} entries per user)",
+                                    outbox_options.max_entries_per_user);
+            }
+            // 补推兜底会在每次连接时查询 PostgreSQL，默认关闭，只依赖 Redis outbox。
+            // 开启客户端 ACK 时强制打开：没收到 ACK 的消息保持 SENT，只能靠补推重发
+            const bool delivery_ack_enabled = push_cfg.get<bool>("push.delivery_ack.enabled", false);
+            bool offline_catchup_enabled = push_cfg.get<bool>("push.offline_catchup.enabled", false);
+            if (delivery_ack_enabled && !offline_catchup_enabled) {
+                server_logger->warn("push.delivery_ack.enabled requires connect-time catch-up; "
+                                    "enabling push.offline_catchup");
+                offline_catchup_enabled = true;
+            }
+            if (push_service_ && offline_catchup_enabled) {
+                push_service_->set_pending_source(
+                    std::make_shared<MessageStoreOfflineSource>(message_client_));
+                server_logger->info("Connect-time offline catch-up enabled");
+            }
+
             message_ws_handler_ = std::make_unique<MessageWsHandler>(
                 message_client_, auth_mgr_, push_notifier_);
             server_logger->info("Message WS handler initialized with PushNotifier");
+
+            // 送达状态由客户端 ACK（CMD_MESSAGE_DELIVERED）驱动：ACK 经 DeliveryLedger 换成
+            // 本会话实际收到的消息ID，再按用户在窗口内合并写库
+            if (delivery_ack_enabled) {
+                const int window_ms = push_cfg.get<int>("push.delivery_ack.coalesce_window_ms", 200);
+                delivery_ack_coalescer_ = std::make_unique<DeliveryAckCoalescer>(
+                    [client = message_client_](const std::string& uid,
+                                               const std::vector<uint64_t>& msg_ids) {
+                        const auto delivered_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::system_clock::now().time_since_epoch()).count();
+                        client->mark_delivered_ids(uid, msg_ids, delivered_time);
+                    },
+                    std::chrono::milliseconds(window_ms));
+                delivery_ack_coalescer_->start();
+                message_ws_handler_->set_delivery_ack_coalescer(delivery_ack_coalescer_.get());
+                delivery_ledger_ = std::make_unique<DeliveryLedger>();
+                message_ws_handler_->set_delivery_ledger(delivery_ledger_.get());
+#ifdef IM_ENABLE_PUSH_SERVICE
+                message_ws_handler_->set_offline_outbox(offline_outbox_.get());
+                if (push_service_) {
+                    push_service_->set_delivery_ledger(delivery_ledger_.get());
+                    push_service_->set_require_client_ack(true);
+                }
+#endif
+                server_logger->info("Client delivery acks enabled (coalesce window {} ms)",
+                                    window_ms);
+            }
         } catch (const std::exception& e) {
             server_logger->error("Failed to initialize Message WS handler: {}", e.what());
             throw;
@@ -1086,6 +1318,9 @@ bool GatewayServer::init_server(uint16_t ws_port, uint16_t http_port, const std:
 #ifdef IM_ENABLE_MESSAGE_HTTP
         if (message_http_controller_) {
             message_http_controller_->set_push_notifier(push_notifier_);
+#ifdef IM_ENABLE_PUSH_SERVICE
+            message_http_controller_->set_offline_outbox(offline_outbox_.get());
+#endif
         }
 #endif
 
@@ -1140,6 +1375,8 @@ void GatewayServer::init_logger(const std::string& log_path) {
     LogManager::SetLogToFile("io_service_pool", path + "io_service_pool.log");
     LogManager::SetLogToFile("websocket_server", path + "websocket_server.log");
     LogManager::SetLogToFile("websocket_session", path + "websocket_session.log");
+    LogManager::SetLogToFile("tcp_server", path + "tcp_server.log");
+    LogManager::SetLogToFile("tcp_session", path + "tcp_session.log");
     LogManager::SetLogToFile("connection_manager", path + "connection_manager.log");
     LogManager::SetLogToFile("redis_manager", path + "redis_mgr.log");
     LogManager::SetLogToFile("redis_connection_pool", path + "redis_connection_pool.log");
@@ -1208,151 +1445,116 @@ void GatewayServer::init_ws_server(uint16_t port) {
             server_logger->info("Using WebSocket TLS cert: {} and key: {}", cert_path, key_path);
             ssl_ctx_.use_certificate_chain_file(cert_path);
             ssl_ctx_.use_private_key_file(key_path, boost::asio::ssl::context::pem);
+
+            // 可选 ECDSA 证书：与上面的证书并存，OpenSSL 按客户端支持的签名算法挑选，
+            // ECDSA P-256 签名比 RSA-2048 便宜得多，重连高峰时握手 CPU 主要省在这里
+            auto ecdsa_cert_path = config.get<std::string>("gateway.ecdsa_cert_file", "");
+            auto ecdsa_key_path = config.get<std::string>("gateway.ecdsa_key_file", "");
+            if (!ecdsa_cert_path.empty() || !ecdsa_key_path.empty()) {
+                if (!std::filesystem::exists(ecdsa_cert_path) ||
+                    !std::filesystem::exists(ecdsa_key_path)) {
+                    throw std::runtime_error("ECDSA certificate or private key file does not exist");
+                }
+                server_logger->info("Using WebSocket ECDSA cert: {} and key: {}", ecdsa_cert_path,
+                                    ecdsa_key_path);
+                ssl_ctx_.use_certificate_chain_file(ecdsa_cert_path);
+                ssl_ctx_.use_private_key_file(ecdsa_key_path, boost::asio::ssl::context::pem);
+            }
+            SSL_CTX_set_options(ssl_ctx_.native_handle(), SSL_OP_CIPHER_SERVER_PREFERENCE);
+            SSL_CTX_set1_groups_list(ssl_ctx_.native_handle(), "X25519:P-256:P-384");
+
+            im::network::TlsSessionOptions tls_options;
+            tls_options.session_cache = config.get<bool>("gateway.tls_session_cache", true);
+            tls_options.session_cache_size =
+                    config.get<size_t>("gateway.tls_session_cache_size", 20480);
+            tls_options.session_timeout_sec =
+                    config.get<uint32_t>("gateway.tls_session_timeout_sec", 3600);
+            tls_options.session_tickets = config.get<bool>("gateway.tls_session_tickets", true);
+            tls_options.ticket_key_rotation_sec =
+                    config.get<uint32_t>("gateway.tls_ticket_key_rotation_sec", 3600);
+            tls_options.ticket_key_file = config.get<std::string>("gateway.tls_ticket_key_file", "");
+            tls_ticket_keys_ = im::network::configure_tls_session_resumption(ssl_ctx_, tls_options);
+            server_logger->info(
+                    "TLS session resumption: cache={} (size {}), tickets={} ({}), timeout {}s",
+                    tls_options.session_cache, tls_options.session_cache_size,
+                    tls_options.session_tickets,
+                    tls_options.ticket_key_file.empty() ? "in-process keys"
+                                                        : tls_options.ticket_key_file,
+                    tls_options.session_timeout_sec);
             server_logger->info("SSL context configured successfully");
         } catch (const std::exception& e) {
             server_logger->error("SSL context configuration failed: {}", e.what());
             throw;
         }
 
+        {
+            ConfigManager config(config_path_);
+            if (config.get<bool>("gateway.ws_inline_commands", true)) {
+                // 撤销检查要查 Redis，不能在 I/O 线程做：每个连接每隔 N 秒把一帧交给常规路径，
+                // 由线程池里的 token 验证顺带复查撤销
+                const int recheck_sec =
+                        config.get<int>("gateway.ws_inline_revocation_recheck_sec", 30);
+                inline_commands_ = std::make_unique<InlineCommandHandler>(
+                        std::chrono::seconds(recheck_sec));
+                server_logger->info(
+                        "WebSocket inline commands enabled (heartbeat fast path, "
+                        "revocation rechecked every {}s)", recheck_sec);
+            }
+        }
+
         // ============ 消息处理回调函数构建 ============
         // 构造WebSocket服务器消息处理函数（处理所有接收到的WebSocket消息）
         std::function<void(SessionPtr, beast::flat_buffer&&)>
         message_handler([this](SessionPtr sessionPtr, beast::flat_buffer&& buffer) -> void {
-            // 第一步：解析WebSocket消息
-            auto result = this->msg_parser_->parse_websocket_message_enhanced(
-                    beast::buffers_to_string(buffer.data()), sessionPtr->get_session_id());
-            if (!result.success) {
-                server_logger->error(
-                        "parse message error in gateway.ws_server callback; error_message: {}, "
-                        "error_code: {}",
-                        result.error_message, result.error_code);
-                return;  // 解析失败，直接返回
-            }
+            this->on_client_frame(sessionPtr, beast::buffers_to_string(buffer.data()));
+        });
 
-            // 第二步：将消息处理投递到受控业务执行器
-            if (msg_processor_) {
-                // 保存原始头信息，用于构建错误响应时的序列号匹配
-                base::IMHeader original_header = result.message->get_header();
 
-                size_t current_inflight =
-                        ws_inflight_messages_.fetch_add(1, std::memory_order_acq_rel) + 1;
-                if (current_inflight > max_ws_inflight_messages_) {
-                    ws_inflight_messages_.fetch_sub(1, std::memory_order_acq_rel);
-                    server_logger->warn(
-                            "WS message rejected by inflight limit: current={}, limit={}",
-                            current_inflight, max_ws_inflight_messages_);
-                    std::string protobuf_response = ProtobufCodec::buildErrorResponse(
-                            original_header,
-                            base::ErrorCode::SERVER_ERROR,
-                            "Gateway is busy, please retry later.");
-                    if (!protobuf_response.empty()) {
-                        sessionPtr->send(protobuf_response);
-                    }
-                    return;
-                }
+        auto& ioc = io_service_pool_->GetIOService();
+        if (auto acceptor = adopt_listener("ws", port, ioc)) {
+            websocket_server_ = std::make_unique<WebSocketServer>(ssl_ctx_, std::move(*acceptor),
+                                                                  message_handler);
+        } else {
+            websocket_server_ =
+                    std::make_unique<WebSocketServer>(ioc, ssl_ctx_, port, message_handler);
+        }
 
-                try {
-                    im::utils::ThreadPool::GetInstance().Enqueue(
-                            [this,
-                             sessionPtr,
-                             original_header,
-                             message = std::move(result.message),
-                             guard = std::make_shared<InflightMessageGuard>(
-                                     ws_inflight_messages_)]() mutable {
-                                (void)guard;
-                                try {
-                                    // 业务任务已经位于全局线程池内，直接执行同步处理核心。
-                                    auto final_result =
-                                            this->msg_processor_->process_message_sync(
-                                                    std::move(message));
-                                    this->server_logger->info(
-                                            "WS processing completed: status_code={}, has_pb={}, has_json={}",
-                                            final_result.status_code,
-                                            !final_result.protobuf_message.empty(),
-                                            !final_result.json_body.empty());
-
-                                    // 第四步：根据处理结果发送响应或执行特殊操作
-                                    if (final_result.status_code == base::ErrorCode::AUTH_FAILED) {
-                                        this->server_logger->warn(
-                                                "Authentication failed for session {}, closing connection",
-                                                sessionPtr->get_session_id());
-
-                                        base::IMHeader error_header =
-                                                ProtobufCodec::returnHeaderBuilder(
-                                                        original_header,
-                                                        im::utils::ServiceId::getDeviceId(),
-                                                        im::utils::ServiceId::getPlatformInfo());
-
-                                        std::string protobuf_response =
-                                                ProtobufCodec::buildAuthFailedResponse(
-                                                        error_header,
-                                                        "Token verification failed. Connection will be closed.");
-                                        if (!protobuf_response.empty()) {
-                                            sessionPtr->send(protobuf_response);
-                                        }
-
-                                        if (this->conn_mgr_) {
-                                            this->conn_mgr_->remove_connection(sessionPtr);
-                                            this->server_logger->debug(
-                                                    "Removed session {} from ConnectionManager due to auth failure",
-                                                    sessionPtr->get_session_id());
-                                        }
-
-                                        this->schedule_delayed_close(
-                                                sessionPtr, std::chrono::milliseconds(100));
-                                    } else if (final_result.status_code != 0) {
-                                        this->server_logger->error(
-                                                "Message processing error: {} (code: {})",
-                                                final_result.error_message,
-                                                final_result.status_code);
-                                        if (!final_result.protobuf_message.empty()) {
-                                            sessionPtr->send(final_result.protobuf_message);
-                                        } else if (!final_result.json_body.empty()) {
-                                            sessionPtr->send(final_result.json_body);
-                                        }
-                                    } else {
-                                        this->server_logger->info("WS success branch, sending response");
-                                        if (!final_result.protobuf_message.empty()) {
-                                            sessionPtr->send(final_result.protobuf_message);
-                                        } else if (!final_result.json_body.empty()) {
-                                            this->server_logger->warn(
-                                                    "WebSocket sending JSON response, should use protobuf");
-                                            sessionPtr->send(final_result.json_body);
-                                        }
-                                    }
-                                } catch (const std::exception& e) {
-                                    this->server_logger->error(
-                                            "MessageProcessor exception in gateway.ws_server callback: {}",
-                                            e.what());
-                                }
-                            });
-                } catch (const std::exception& e) {
-                    ws_inflight_messages_.fetch_sub(1, std::memory_order_acq_rel);
-                    server_logger->error("Failed to enqueue WS message task: {}", e.what());
-                    std::string protobuf_response = ProtobufCodec::buildErrorResponse(
-                            original_header,
-                            base::ErrorCode::SERVER_ERROR,
-                            "Gateway is busy, please retry later.");
-                    if (!protobuf_response.empty()) {
-                        sessionPtr->send(protobuf_response);
-                    }
-                }
-            } else {
-                server_logger->error("MessageProcessor is not initialized.");
-                init_msg_processor();
+        {
+            ConfigManager config(config_path_);
+            if (config.get<bool>("gateway.ws_ktls", false)) {
+                // kTLS 下重协商消息由内核当作错误返回，直接禁用
+                SSL_CTX_set_options(ssl_ctx_.native_handle(), SSL_OP_NO_RENEGOTIATION);
+                websocket_server_->set_ktls_enabled(true);
+                server_logger->info("WebSocket kTLS enabled (falls back to userspace TLS when unsupported)");
             }
-        });
 
-
-        websocket_server_ = std::make_unique<WebSocketServer>(io_service_pool_->GetIOService(),
-                                                              ssl_ctx_, port, message_handler);
+            // 重启后全量重连时限制握手与会话建立速度，保护鉴权和 Redis
+            im::network::WebSocketAdmissionLimits limits;
+            limits.max_accepts_per_sec = static_cast<uint32_t>(
+                    std::max(0, config.get<int>("gateway.ws_max_accepts_per_sec", 0)));
+            limits.max_pending_handshakes = static_cast<uint32_t>(
+                    std::max(0, config.get<int>("gateway.ws_max_pending_handshakes", 0)));
+            limits.retry_after_min = std::chrono::milliseconds(
+                    std::max(1, config.get<int>("gateway.ws_retry_after_min_ms", 1000)));
+            limits.retry_after_max = std::chrono::milliseconds(
+                    std::max(1, config.get<int>("gateway.ws_retry_after_max_ms", 5000)));
+            websocket_server_->set_admission_limits(limits);
+            if (limits.max_accepts_per_sec > 0 || limits.max_pending_handshakes > 0) {
+                server_logger->info(
+                        "WebSocket admission control: {} accepts/s, {} pending handshakes, "
+                        "retry after {}-{} ms",
+                        limits.max_accepts_per_sec, limits.max_pending_handshakes,
+                        limits.retry_after_min.count(), limits.retry_after_max.count());
+            }
+        }
 
         // 设置连接和断开回调
         websocket_server_->set_connect_handler(
                 [this](SessionPtr session) { this->on_websocket_connect(session); });
 
         websocket_server_->set_disconnect_handler(
-                [this](SessionPtr session) { this->on_websocket_disconnect(session); });
+                [this](SessionPtr session) { this->on_client_disconnect(session); });
+        session_lookup_.add(websocket_server_.get());
 
         server_logger->info("WebSocket server initialized on port {}", port);
 
@@ -1364,6 +1566,382 @@ void GatewayServer::init_ws_server(uint16_t port) {
         throw std::runtime_error("Failed to start websocket server: unknown exception");
     }
 }
+
+/**
+ * @brief 热重启：若旧进程在 gateway.hot_restart_socket 上等待交接，先接手它的监听 socket
+ *
+ * @details 接手的 socket 由 init_ws_server / init_tcp_server 通过 adopt_listener 取用，
+ *          不再重新 bind；旧进程在本进程 start() 完成并确认之前照常 accept。
+ *          没有旧进程时按普通启动处理。
+ */
+void GatewayServer::init_hot_restart() {
+    ConfigManager config(config_path_);
+    hot_restart_socket_ = config.get<std::string>("gateway.hot_restart_socket", "");
+    drain_window_ = std::chrono::seconds(
+            std::max(1, config.get<int>("gateway.drain_window_sec", 60)));
+    if (hot_restart_socket_.empty()) {
+        return;
+    }
+
+    auto client = std::make_unique<im::network::ListenerHandoffClient>();
+    std::string error;
+    if (client->connect(hot_restart_socket_, error)) {
+        server_logger->info("Hot restart: took over listeners from {}", hot_restart_socket_);
+        inherited_listeners_ = std::move(client);
+    } else if (!error.empty()) {
+        server_logger->warn("Hot restart: listener handoff failed, binding fresh sockets: {}",
+                            error);
+    }
+}
+
+/**
+ * @brief 取出旧进程交来的监听 socket；端口与配置不一致时关闭它，改为重新 bind
+ */
+std::optional<boost::asio::ip::tcp::acceptor> GatewayServer::adopt_listener(
+        const std::string& name, uint16_t port, boost::asio::io_context& ioc) {
+    const int fd = inherited_listeners_ ? inherited_listeners_->take(name) : -1;
+    if (fd < 0) {
+        return std::nullopt;
+    }
+
+    boost::asio::ip::tcp::acceptor acceptor(ioc);
+    boost::system::error_code ec;
+    acceptor.assign(boost::asio::ip::tcp::v4(), fd, ec);
+    if (!ec) {
+        const auto endpoint = acceptor.local_endpoint(ec);
+        if (!ec && endpoint.port() == port) {
+            server_logger->info("Hot restart: reusing {} listener on port {}", name, port);
+            return acceptor;
+        }
+    }
+    server_logger->warn("Hot restart: inherited {} listener does not match port {}, ignoring",
+                        name, port);
+    if (acceptor.is_open()) {
+        acceptor.close(ec);
+    } else {
+        ::close(fd);
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief 启动完成后确认交接，并在 gateway.hot_restart_socket 上等待下一个新进程
+ */
+void GatewayServer::start_hot_restart() {
+    if (hot_restart_socket_.empty()) {
+        return;
+    }
+
+    if (inherited_listeners_) {
+        std::string error;
+        if (inherited_listeners_->confirm(error)) {
+            server_logger->info("Hot restart: previous gateway notified to drain");
+        } else {
+            server_logger->warn("Hot restart: confirm handoff failed: {}", error);
+        }
+        inherited_listeners_.reset();
+    }
+
+    handoff_server_ = std::make_unique<im::network::ListenerHandoffServer>(hot_restart_socket_);
+    std::string error;
+    const bool started = handoff_server_->start(
+            [this] {
+                std::vector<im::network::HandoffListener> listeners;
+                listeners.push_back({"ws", websocket_server_->listener_fd()});
+                if (tcp_server_) {
+                    listeners.push_back({"tcp", tcp_server_->listener_fd()});
+                }
+                return listeners;
+            },
+            [this] { begin_drain(); }, error);
+    if (started) {
+        server_logger->info("Hot restart: waiting for successor on {}", hot_restart_socket_);
+    } else {
+        server_logger->error("Hot restart: cannot listen on {}: {}", hot_restart_socket_, error);
+        handoff_server_.reset();
+    }
+}
+
+/**
+ * @brief 新进程已接手监听 socket：停止 accept，把已有连接分批关闭
+ *
+ * @details 在交接线程上调用。连接在 drain_window_ 内按秒均匀关闭，每条连接带一个
+ *          一秒内的随机重连延迟（WebSocket 关闭帧 1012 + "reconnect_after_ms=N"），
+ *          重连和重新登录的压力摊在整个窗口上。全部关闭后调用 drained_handler_。
+ */
+void GatewayServer::begin_drain() {
+    bool expected = false;
+    if (!draining_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    websocket_server_->stop_accepting();
+    if (tcp_server_) {
+        tcp_server_->stop_accepting();
+    }
+    // 新进程已在同一端口上监听 HTTP；处理中的请求由 httplib 的工作线程完成
+    try {
+        http_server_->stop();
+    } catch (const std::exception& e) {
+        server_logger->error("Hot restart: stopping HTTP server failed: {}", e.what());
+    }
+
+    auto sessions = session_lookup_.get_sessions();
+    server_logger->info("Hot restart: handed off listeners, draining {} sessions over {}s",
+                        sessions.size(), drain_window_.count());
+
+    auto& ioc = io_service_pool_->GetIOService();
+    drain_timer_ = std::make_unique<boost::asio::steady_timer>(ioc);
+    boost::asio::post(ioc, [this, sessions = std::move(sessions)]() mutable {
+        drain_queue_ = std::move(sessions);
+        drain_deadline_ = std::chrono::steady_clock::now() + drain_window_;
+        drain_step();
+    });
+}
+
+void GatewayServer::drain_step() {
+    constexpr auto kDrainTick = std::chrono::seconds(1);
+    // 快照之后才完成握手的连接，窗口结束后再给一点时间收尾
+    constexpr auto kDrainGrace = std::chrono::seconds(5);
+
+    if (!is_running_) {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (drain_queue_.empty() && now < drain_deadline_ + kDrainGrace) {
+        drain_queue_ = session_lookup_.get_sessions();
+    }
+    if (drain_queue_.empty()) {
+        server_logger->info("Hot restart: drain finished");
+        if (drained_handler_) {
+            drained_handler_();
+        }
+        return;
+    }
+
+    // 剩余时间里每秒关闭相同数量的连接，窗口结束后一次关完。向上取整：
+    // 窗口 N 秒分 N 批，向下取整会少一批，第一批就关掉过多连接
+    const auto ticks_left = std::max<int64_t>(
+            1, std::chrono::ceil<std::chrono::seconds>(drain_deadline_ - now).count());
+    const size_t batch =
+            (drain_queue_.size() + static_cast<size_t>(ticks_left) - 1) / static_cast<size_t>(ticks_left);
+
+    thread_local std::mt19937 rng{std::random_device{}()};
+    std::uniform_int_distribution<int> jitter_ms(
+            0, static_cast<int>(std::chrono::milliseconds(kDrainTick).count()) - 1);
+    for (size_t i = 0; i < batch && !drain_queue_.empty(); ++i) {
+        drain_queue_.back()->close_for_restart(std::chrono::milliseconds(jitter_ms(rng)));
+        drain_queue_.pop_back();
+    }
+
+    drain_timer_->expires_after(kDrainTick);
+    drain_timer_->async_wait([this](const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        drain_step();
+    });
+}
+
+/**
+ * @brief 初始化原生TCP服务器（gateway.tcp_port 为 0 时不启用）
+ *
+ * @details 面向桌面端、IoT 等原生客户端：帧格式为 TCPSession 的 5 字节帧头
+ *          （4 字节大端长度 + 1 字节类型）加 v1 protobuf 信封，省去 HTTP 升级、
+ *          WebSocket 掩码与分帧。gateway.tcp_tls 为 true 时复用 WebSocket 的
+ *          ssl_context（证书与会话复用配置相同）。
+ *          消息与 WebSocket 走同一个 on_client_frame；会话登记到 session_lookup_，
+ *          ConnectionManager 和 PushService 不区分连接所在的传输。
+ */
+void GatewayServer::init_tcp_server() {
+    ConfigManager config(config_path_);
+    const int port = config.get<int>("gateway.tcp_port", 0);
+    if (port <= 0) {
+        return;
+    }
+    const bool tls = config.get<bool>("gateway.tcp_tls", true);
+
+    try {
+        auto& ioc = io_service_pool_->GetIOService();
+        if (auto acceptor = adopt_listener("tcp", static_cast<uint16_t>(port), ioc)) {
+            tcp_server_ = std::make_unique<TCPServer>(ioc, std::move(*acceptor),
+                                                      tls ? &ssl_ctx_ : nullptr);
+        } else {
+            tcp_server_ = std::make_unique<TCPServer>(ioc, static_cast<unsigned short>(port),
+                                                      tls ? &ssl_ctx_ : nullptr);
+        }
+    } catch (const std::exception& e) {
+        server_logger->error("Failed to start TCP server on port {}: {}", port, e.what());
+        throw std::runtime_error("Failed to start TCP server: " + std::string(e.what()));
+    }
+
+    tcp_server_->set_connection_handler(
+            [this](std::shared_ptr<TCPSession> session) { this->on_tcp_connect(session); });
+    tcp_server_->set_disconnect_handler(
+            [this](std::shared_ptr<TCPSession> session) { this->on_client_disconnect(session); });
+    session_lookup_.add(tcp_server_.get());
+
+    server_logger->info("TCP server initialized on port {} ({})", port, tls ? "tls" : "plain");
+}
+
+/**
+ * @brief 处理客户端发来的一帧消息（WebSocket 与原生 TCP 共用）
+ * @param session 发送消息的会话
+ * @param frame 完整的消息帧（v1 信封或 v2 帧）
+ *
+ * @details 处理流程：
+ *          1. 心跳等简单命令在当前 I/O 线程直接应答
+ *          2. v2 批量帧整批交给 handle_ws_batch_frame
+ *          3. 解析后投递到受控业务执行器，按处理结果回包或关闭连接
+ */
+void GatewayServer::on_client_frame(SessionPtr session, const std::string& frame) {
+    // 心跳等简单命令：v2 直接看原始字节，在当前 I/O 线程应答
+    if (inline_commands_ && inline_commands_->try_handle_frame(*session, frame)) {
+        return;
+    }
+
+    if (session->wire_version() == im::network::WireVersion::V2 &&
+        ProtobufCodec::isBatchFrameV2(frame)) {
+        this->handle_ws_batch_frame(session, frame);
+        return;
+    }
+
+    // 第一步：解析WebSocket消息
+    auto result = this->msg_parser_->parse_websocket_message_enhanced(
+            frame, session->get_session_id(),
+            session->wire_version(), session->identity());
+    if (!result.success) {
+        server_logger->error(
+                "parse message error in gateway client frame handler; error_message: {}, "
+                "error_code: {}",
+                result.error_message, result.error_code);
+        return;  // 解析失败，直接返回
+    }
+
+    // v1 帧要解包才知道 cmd_id，解析后再判断一次，仍不离开 I/O 线程
+    if (inline_commands_ &&
+        inline_commands_->try_handle_message(*session, result.message->get_header())) {
+        return;
+    }
+
+    // 第二步：将消息处理投递到受控业务执行器
+    if (msg_processor_) {
+        // 保存原始头信息，用于构建错误响应时的序列号匹配
+        base::IMHeader original_header = result.message->get_header();
+
+        size_t current_inflight =
+                ws_inflight_messages_.fetch_add(1, std::memory_order_acq_rel) + 1;
+        if (current_inflight > max_ws_inflight_messages_) {
+            ws_inflight_messages_.fetch_sub(1, std::memory_order_acq_rel);
+            server_logger->warn(
+                    "WS message rejected by inflight limit: current={}, limit={}",
+                    current_inflight, max_ws_inflight_messages_);
+            std::string protobuf_response = ProtobufCodec::buildErrorResponse(
+                    original_header,
+                    base::ErrorCode::SERVER_ERROR,
+                    "Gateway is busy, please retry later.",
+                    session->wire_version());
+            if (!protobuf_response.empty()) {
+                session->send(protobuf_response);
+            }
+            return;
+        }
+
+        try {
+            im::utils::ThreadPool::GetInstance().Enqueue(
+                    [this,
+                     session,
+                     original_header,
+                     message = std::move(result.message),
+                     guard = std::make_shared<InflightMessageGuard>(
+                             ws_inflight_messages_)]() mutable {
+                        (void)guard;
+                        try {
+                            // 业务任务已经位于全局线程池内，直接执行同步处理核心。
+                            auto final_result =
+                                    this->msg_processor_->process_message_sync(
+                                            std::move(message));
+                            this->server_logger->info(
+                                    "WS processing completed: status_code={}, has_pb={}, has_json={}",
+                                    final_result.status_code,
+                                    !final_result.protobuf_message.empty(),
+                                    !final_result.json_body.empty());
+
+                            // 第四步：根据处理结果发送响应或执行特殊操作
+                            if (final_result.status_code == base::ErrorCode::AUTH_FAILED) {
+                                this->server_logger->warn(
+                                        "Authentication failed for session {}, closing connection",
+                                        session->get_session_id());
+
+                                base::IMHeader error_header =
+                                        ProtobufCodec::returnHeaderBuilder(
+                                                original_header,
+                                                im::utils::ServiceId::getDeviceId(),
+                                                im::utils::ServiceId::getPlatformInfo());
+
+                                std::string protobuf_response =
+                                        ProtobufCodec::buildAuthFailedResponse(
+                                                error_header,
+                                                "Token verification failed. Connection will be closed.",
+                                                session->wire_version());
+                                if (!protobuf_response.empty()) {
+                                    session->send(protobuf_response);
+                                }
+
+                                if (this->conn_mgr_) {
+                                    this->conn_mgr_->remove_connection(session);
+                                    this->server_logger->debug(
+                                            "Removed session {} from ConnectionManager due to auth failure",
+                                            session->get_session_id());
+                                }
+
+                                this->schedule_delayed_close(
+                                        session, std::chrono::milliseconds(100));
+                            } else if (final_result.status_code != 0) {
+                                this->server_logger->error(
+                                        "Message processing error: {} (code: {})",
+                                        final_result.error_message,
+                                        final_result.status_code);
+                                if (!final_result.protobuf_message.empty()) {
+                                    session->send(final_result.protobuf_message);
+                                } else if (!final_result.json_body.empty()) {
+                                    session->send(final_result.json_body);
+                                }
+                            } else {
+                                this->server_logger->info("WS success branch, sending response");
+                                if (!final_result.protobuf_message.empty()) {
+                                    session->send(final_result.protobuf_message);
+                                } else if (!final_result.json_body.empty()) {
+                                    this->server_logger->warn(
+                                            "WebSocket sending JSON response, should use protobuf");
+                                    session->send(final_result.json_body);
+                                }
+                            }
+                        } catch (const std::exception& e) {
+                            this->server_logger->error(
+                                    "MessageProcessor exception in gateway client frame handler: {}",
+                                    e.what());
+                        }
+                    });
+        } catch (const std::exception& e) {
+            ws_inflight_messages_.fetch_sub(1, std::memory_order_acq_rel);
+            server_logger->error("Failed to enqueue WS message task: {}", e.what());
+            std::string protobuf_response = ProtobufCodec::buildErrorResponse(
+                    original_header,
+                    base::ErrorCode::SERVER_ERROR,
+                    "Gateway is busy, please retry later.",
+                    session->wire_version());
+            if (!protobuf_response.empty()) {
+                session->send(protobuf_response);
+            }
+        }
+    } else {
+        server_logger->error("MessageProcessor is not initialized.");
+        init_msg_processor();
+    }
+}
+
 /**
  * @brief 初始化HTTP服务器
  * @param port HTTP服务端口
@@ -1387,6 +1965,15 @@ void GatewayServer::init_http_server(uint16_t port) {
         http_server_->set_keep_alive_timeout(kHttpKeepAliveTimeoutSec);
         http_server_->set_keep_alive_max_count(kHttpKeepAliveMaxCount);
         http_server_->set_tcp_nodelay(true);
+        if (!hot_restart_socket_.empty()) {
+            // httplib 不能接管已有的监听 fd：新旧进程都开 SO_REUSEPORT，
+            // 新进程直接绑定同一端口，旧进程交接后停止 HTTP 服务
+            http_server_->set_socket_options([](socket_t sock) {
+                int yes = 1;
+                ::setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+                ::setsockopt(sock, SOL_SOCKET, SO_REUSEPORT, &yes, sizeof(yes));
+            });
+        }
         http_server_->set_pre_routing_handler([this](const httplib::Request&,
                                                      httplib::Response&) {
             t_http_request_start_us = now_steady_us();
@@ -1584,11 +2171,12 @@ void GatewayServer::init_http_server(uint16_t port) {
 
 /**
  * @brief 初始化连接管理器
- * @details 基于平台策略配置文件和WebSocket服务器实例创建连接管理器
- *          管理用户、设备、平台与WebSocket会话的映射关系
+ * @details 基于平台策略配置文件和会话查找器（WebSocket + 原生TCP）创建连接管理器
+ *          管理用户、设备、平台与客户端会话的映射关系
  */
 void GatewayServer::init_conn_mgr() {
-    conn_mgr_ = std::make_unique<ConnectionManager>(psc_path_, websocket_server_.get());
+    conn_mgr_ = std::make_unique<ConnectionManager>(psc_path_, &session_lookup_,
+                                                    conn_state_store_);
 }
 
 /**
@@ -1759,23 +2347,26 @@ ProcessorResult GatewayServer::handle_heartbeat_message(
         const std::shared_ptr<MultiPlatformAuthManager>& auth_mgr) {
     const auto& header = msg.get_header();
 
+    // 响应对象都建在本次请求的 arena 上，随 UnifiedMessage 一起释放
     auto build_heartbeat_response =
-            [](const im::base::IMHeader& request_header,
-               im::base::ErrorCode code,
-               const std::string& message) -> std::string {
-        im::base::BaseResponse response;
-        response.set_error_code(code);
-        response.set_error_message(message);
-
-        im::base::IMHeader response_header =
-                im::network::ProtobufCodec::returnHeaderBuilder(
-                        request_header,
-                        im::utils::ServiceIdentityManager::getInstance().getDeviceId(),
-                        im::utils::ServiceIdentityManager::getInstance().getPlatformInfo());
-        response_header.set_cmd_id(im::command::CMD_HEARTBEAT);
+            [&msg](const im::base::IMHeader& request_header,
+                   im::base::ErrorCode code,
+                   const std::string& message) -> std::string {
+        auto* response = google::protobuf::Arena::Create<im::base::BaseResponse>(msg.arena());
+        response->set_error_code(code);
+        response->set_error_message(message);
+
+        auto* response_header = google::protobuf::Arena::Create<im::base::IMHeader>(msg.arena());
+        im::network::ProtobufCodec::fillReturnHeader(
+                request_header,
+                im::utils::ServiceIdentityManager::getInstance().getDeviceId(),
+                im::utils::ServiceIdentityManager::getInstance().getPlatformInfo(),
+                response_header);
+        response_header->set_cmd_id(im::command::CMD_HEARTBEAT);
 
         std::string encoded;
-        if (im::network::ProtobufCodec::encode(response_header, response, encoded)) {
+        if (im::network::ProtobufCodec::encode(*response_header, *response, encoded,
+                                               msg.get_session_context().wire_version)) {
             return encoded;
         }
         return "";
@@ -1822,11 +2413,36 @@ void GatewayServer::register_message_handlers() {
         if (message_ws_handler_) {
             server_logger->info("Registering WebSocket message handler for CMD_SEND_MESSAGE");
 
-            register_message_handlers(im::command::CMD_SEND_MESSAGE,
-                [this](const UnifiedMessage& msg) -> ProcessorResult {
-                    return message_ws_handler_->handle_send(msg);
+            // Token and device are checked before the payload is type-checked or parsed.
+            MessageWsHandler* ws_handler = message_ws_handler_.get();
+            auto authenticate = [ws_handler](const UnifiedMessage& msg, UserTokenInfo& user) {
+                return ws_handler->authenticate(msg, user);
+            };
+
+            register_authenticated_handler<im::command::CMD_SEND_MESSAGE,
+                                           im::message::SendMessageRequest,
+                                           im::message::SendMessageResponse, UserTokenInfo>(
+                authenticate,
+                [ws_handler](const UnifiedMessage& msg, const UserTokenInfo& user,
+                             const im::message::SendMessageRequest& req,
+                             im::message::SendMessageResponse& resp) {
+                    return ws_handler->on_send(msg, user, req, resp);
                 });
 
+            if (delivery_ack_coalescer_) {
+                register_authenticated_handler<im::command::CMD_MESSAGE_DELIVERED,
+                                               im::message::MarkMessageDeliveredRequest,
+                                               im::message::MarkMessageDeliveredResponse,
+                                               UserTokenInfo>(
+                    authenticate,
+                    [ws_handler](const UnifiedMessage& msg, const UserTokenInfo& user,
+                                 const im::message::MarkMessageDeliveredRequest& req,
+                                 im::message::MarkMessageDeliveredResponse& resp) {
+                        return ws_handler->on_delivered_ack(msg, user, req, resp);
+                    });
+                server_logger->info("WebSocket delivery ack handler registered for CMD_MESSAGE_DELIVERED");
+            }
+
             server_logger->info("WebSocket message handler registered");
         } else {
             server_logger->warn("MessageWsHandler not available — skipping WS handler registration");
@@ -1872,7 +2488,7 @@ bool GatewayServer::push_message_to_user(const std::string& user_id, const std::
 
         // 遍历每个设备会话并发送消息
         for (const auto& device_session : sessions) {
-            auto session = websocket_server_->get_session(device_session.session_id);
+            auto session = session_lookup_.get_session(device_session.session_id);
             if (session) {
                 session->send(message);
                 pushed = true;  // 至少有一个设备成功接收
@@ -1962,39 +2578,8 @@ void GatewayServer::on_websocket_connect(SessionPtr session) {
                         session->get_client_ip());
 
     // 检查连接时是否携带了认证Token（支持连接时直接认证）
-    const std::string& token = session->get_token();
-    if (!token.empty()) {
-        // 携带Token，尝试自动验证并绑定连接
-        server_logger->info("Session {} provided token, attempting automatic verification",
-                            session->get_session_id());
-
-        if (verify_and_bind_connection(session, token)) {
-            server_logger->info("Session {} automatically authenticated with token",
-                                session->get_session_id());
-            // 连接成功，无需发送响应消息，客户端通过连接状态判断成功
-        } else {
-            server_logger->warn(
-                    "Session {} provided invalid token, closing connection for security",
-                    session->get_session_id());
-
-            // 构建protobuf格式的认证失败响应
-            base::IMHeader dummy_header;
-            dummy_header.set_cmd_id(command::CommandID::CMD_SERVER_NOTIFY);  // 服务器通知
-            dummy_header.set_seq(0);  // 连接时验证失败，非请求响应，使用seq=0
-            dummy_header.set_timestamp(std::chrono::duration_cast<std::chrono::milliseconds>(
-                                               std::chrono::system_clock::now().time_since_epoch())
-                                               .count());
-
-            std::string protobuf_response = ProtobufCodec::buildAuthFailedResponse(
-                    dummy_header, "Token authentication failed. Connection will be closed.");
-
-            if (!protobuf_response.empty()) {
-                session->send(protobuf_response);
-            }
-
-            // 延迟关闭连接，确保错误消息能发送出去
-            schedule_delayed_close(session, std::chrono::milliseconds(100));
-        }
+    if (!session->get_token().empty()) {
+        authenticate_connection(session);
     } else {
         // 没有Token，给予30秒时间进行登录认证
         server_logger->info(
@@ -2010,8 +2595,79 @@ void GatewayServer::on_websocket_connect(SessionPtr session) {
 }
 
 /**
- * @brief WebSocket连接断开事件处理
- * @param session 断开的WebSocket会话
+ * @brief 原生TCP连接建立事件处理
+ * @param session 新接受的TCP会话（尚未开始读帧）
+ *
+ * @details TCP 连接没有握手请求可携带 Token：
+ *          1. 帧回调接入与 WebSocket 相同的处理路径
+ *          2. 客户端的第一帧应为 AUTH 帧，收到后按连接时Token认证处理
+ *          3. 同样启动认证超时定时器，超时未认证即关闭
+ */
+void GatewayServer::on_tcp_connect(std::shared_ptr<TCPSession> session) {
+    server_logger->info("TCP client connected: {} from IP: {}", session->get_session_id(),
+                        session->get_client_ip());
+
+    // 回调存放在会话里，只持有弱引用
+    std::weak_ptr<TCPSession> weak_session = session;
+    session->set_message_handler([this, weak_session](const std::string& frame) {
+        if (auto s = weak_session.lock()) {
+            this->on_client_frame(s, frame);
+        }
+    });
+    session->set_auth_handler([this, weak_session]() {
+        if (auto s = weak_session.lock()) {
+            this->authenticate_connection(s);
+        }
+    });
+
+    schedule_unauthenticated_timeout(session);
+}
+
+/**
+ * @brief 用连接携带的Token认证并绑定连接
+ * @param session 已携带Token的会话（WebSocket握手参数或TCP的AUTH帧）
+ *
+ * @details 认证失败时发送认证失败通知并延迟关闭连接
+ */
+void GatewayServer::authenticate_connection(SessionPtr session) {
+    const std::string& token = session->get_token();
+    // 携带Token，尝试自动验证并绑定连接
+    server_logger->info("Session {} provided token, attempting automatic verification",
+                        session->get_session_id());
+
+    if (verify_and_bind_connection(session, token)) {
+        server_logger->info("Session {} automatically authenticated with token",
+                            session->get_session_id());
+        // 连接成功，无需发送响应消息，客户端通过连接状态判断成功
+    } else {
+        server_logger->warn(
+                "Session {} provided invalid token, closing connection for security",
+                session->get_session_id());
+
+        // 构建protobuf格式的认证失败响应
+        base::IMHeader dummy_header;
+        dummy_header.set_cmd_id(command::CommandID::CMD_SERVER_NOTIFY);  // 服务器通知
+        dummy_header.set_seq(0);  // 连接时验证失败，非请求响应，使用seq=0
+        dummy_header.set_timestamp(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                           std::chrono::system_clock::now().time_since_epoch())
+                                           .count());
+
+        std::string protobuf_response = ProtobufCodec::buildAuthFailedResponse(
+                dummy_header, "Token authentication failed. Connection will be closed.",
+                session->wire_version());
+
+        if (!protobuf_response.empty()) {
+            session->send(protobuf_response);
+        }
+
+        // 延迟关闭连接，确保错误消息能发送出去
+        schedule_delayed_close(session, std::chrono::milliseconds(100));
+    }
+}
+
+/**
+ * @brief 客户端连接断开事件处理（WebSocket 与原生 TCP 共用）
+ * @param session 断开的会话
  *
  * @details 连接断开流程：
  *          1. 记录连接断开事件
@@ -2020,8 +2676,8 @@ void GatewayServer::on_websocket_connect(SessionPtr session) {
  *
  * @note ConnectionManager是认证状态的唯一数据源，确保会话资源得到正确释放
  */
-void GatewayServer::on_websocket_disconnect(SessionPtr session) {
-    server_logger->info("WebSocket client disconnected: {}", session->get_session_id());
+void GatewayServer::on_client_disconnect(SessionPtr session) {
+    server_logger->info("Client disconnected: {}", session->get_session_id());
 
     // 从连接管理器中移除连接（ConnectionManager是认证状态的唯一来源）
     if (conn_mgr_) {
@@ -2029,6 +2685,130 @@ void GatewayServer::on_websocket_disconnect(SessionPtr session) {
         server_logger->debug("Removed connection from ConnectionManager: {}",
                              session->get_session_id());
     }
+#ifdef IM_ENABLE_MESSAGE_WS
+    // 未 ACK 的消息保持 SENT，下次连接时补推
+    if (delivery_ledger_) {
+        delivery_ledger_->forget(session->get_session_id());
+    }
+#endif
+}
+
+/**
+ * @brief 处理 v2 批量帧
+ * @param session 发送批量帧的会话
+ * @param frame 完整的批量帧
+ *
+ * @details 处理流程：
+ *          1. 拆分并解析全部子帧，任一子帧非法或超过 gateway.ws_max_batch_size 时整批拒绝
+ *          2. 整批只占一个在途名额、投递一个线程池任务，子消息按帧内顺序同步处理
+ *          3. 有响应的子请求把各自的 v2 响应帧拼成一个批量帧，一次发送
+ *          4. 子请求认证失败时停止处理后续子消息，先发出已聚合的响应，
+ *             再按单帧路径通知认证失败并关闭连接
+ */
+void GatewayServer::handle_ws_batch_frame(SessionPtr session, const std::string& frame) {
+    auto send_batch_error = [&session](uint32_t seq, base::ErrorCode code,
+                                       const std::string& message) {
+        base::IMHeader batch_header;
+        batch_header.set_seq(seq);
+        std::string response = ProtobufCodec::buildErrorResponse(
+                batch_header, code, message, im::network::WireVersion::V2);
+        if (!response.empty()) {
+            session->send(response);
+        }
+    };
+
+    auto batch = msg_parser_->parse_websocket_batch(frame, session->get_session_id(),
+                                                    session->identity(), max_ws_batch_size_);
+    if (!batch.success) {
+        server_logger->warn("WS batch rejected for session {}: {} (code: {})",
+                            session->get_session_id(), batch.error_message, batch.error_code);
+        send_batch_error(batch.seq, base::ErrorCode::INVALID_REQUEST, batch.error_message);
+        return;
+    }
+
+    if (!msg_processor_) {
+        server_logger->error("MessageProcessor is not initialized.");
+        return;
+    }
+
+    size_t current_inflight = ws_inflight_messages_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    if (current_inflight > max_ws_inflight_messages_) {
+        ws_inflight_messages_.fetch_sub(1, std::memory_order_acq_rel);
+        server_logger->warn("WS batch rejected by inflight limit: current={}, limit={}",
+                            current_inflight, max_ws_inflight_messages_);
+        send_batch_error(batch.seq, base::ErrorCode::SERVER_ERROR,
+                         "Gateway is busy, please retry later.");
+        return;
+    }
+
+    try {
+        im::utils::ThreadPool::GetInstance().Enqueue(
+                [this,
+                 session,
+                 seq = batch.seq,
+                 messages = std::move(batch.messages),
+                 guard = std::make_shared<InflightMessageGuard>(ws_inflight_messages_)]() mutable {
+                    (void)guard;
+                    std::vector<std::string> responses;
+                    responses.reserve(messages.size());
+                    bool auth_failed = false;
+                    base::IMHeader failed_header;
+
+                    for (auto& message : messages) {
+                        base::IMHeader request_header;
+                        request_header.set_cmd_id(message->get_cmd_id());
+                        request_header.set_seq(message->get_header().seq());
+                        try {
+                            auto result =
+                                    this->msg_processor_->process_message_sync(std::move(message));
+                            if (result.status_code == base::ErrorCode::AUTH_FAILED) {
+                                auth_failed = true;
+                                failed_header = std::move(request_header);
+                                break;
+                            }
+                            if (!result.protobuf_message.empty()) {
+                                responses.push_back(std::move(result.protobuf_message));
+                            }
+                        } catch (const std::exception& e) {
+                            this->server_logger->error(
+                                    "MessageProcessor exception in WS batch: {}", e.what());
+                        }
+                    }
+
+                    if (!responses.empty()) {
+                        std::string batch_response;
+                        if (ProtobufCodec::encodeBatchV2(seq, responses, batch_response)) {
+                            session->send(batch_response);
+                        }
+                    }
+
+                    if (auth_failed) {
+                        this->server_logger->warn(
+                                "Authentication failed in WS batch for session {}, closing "
+                                "connection",
+                                session->get_session_id());
+                        base::IMHeader error_header = ProtobufCodec::returnHeaderBuilder(
+                                failed_header, im::utils::ServiceId::getDeviceId(),
+                                im::utils::ServiceId::getPlatformInfo());
+                        std::string protobuf_response = ProtobufCodec::buildAuthFailedResponse(
+                                error_header,
+                                "Token verification failed. Connection will be closed.",
+                                im::network::WireVersion::V2);
+                        if (!protobuf_response.empty()) {
+                            session->send(protobuf_response);
+                        }
+                        if (this->conn_mgr_) {
+                            this->conn_mgr_->remove_connection(session);
+                        }
+                        this->schedule_delayed_close(session, std::chrono::milliseconds(100));
+                    }
+                });
+    } catch (const std::exception& e) {
+        ws_inflight_messages_.fetch_sub(1, std::memory_order_acq_rel);
+        server_logger->error("Failed to enqueue WS batch task: {}", e.what());
+        send_batch_error(batch.seq, base::ErrorCode::SERVER_ERROR,
+                         "Gateway is busy, please retry later.");
+    }
 }
 
 // ==================== Token验证和连接绑定管理 ====================
@@ -2067,8 +2847,21 @@ bool GatewayServer::verify_and_bind_connection(SessionPtr session, const std::st
                                                    user_info.platform, session);
 
         if (connected) {
+            // v2 帧不再携带身份字段，解析时从连接上补全
+            session->bind_identity(user_info.user_id, user_info.device_id, user_info.platform,
+                                   user_info.expire_time, user_info.token_id);
             server_logger->info("User {} connected via token on device {} ({})", user_info.user_id,
                                 user_info.device_id, user_info.platform);
+#ifdef IM_ENABLE_PUSH_SERVICE
+            // 第三步：将离线期间积压的单聊消息以 CMD_PUSH_BATCH_MESSAGE 批量推给新连接，
+            // 客户端无需再轮询 /messages/offline
+            if (push_service_) {
+                im::utils::ThreadPool::GetInstance().Enqueue(
+                        [this, uid = user_info.user_id, sid = session->get_session_id()]() {
+                            push_service_->drain_offline(uid, sid);
+                        });
+            }
+#endif
             return true;
         } else {
             server_logger->warn("Failed to bind connection for user {} device {} ({})",
@@ -2122,7 +2915,8 @@ void GatewayServer::schedule_unauthenticated_timeout(SessionPtr session) {
 
             // 构建超时响应消息
             std::string protobuf_response = ProtobufCodec::buildTimeoutResponse(
-                    dummy_header, "Authentication timeout. Connection closed.");
+                    dummy_header, "Authentication timeout. Connection closed.",
+                    session->wire_version());
 
             if (!protobuf_response.empty()) {
                 session->send(protobuf_response);
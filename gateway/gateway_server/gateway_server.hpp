@@ -13,6 +13,7 @@
 
 
 #include "../../common/network/IOService_pool.hpp"
+#include "../../common/network/listener_handoff.hpp"
 #include "../../common/network/tcp_server.hpp"
 #include "../../common/network/websocket_server.hpp"
 
@@ -35,13 +36,17 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <thread>
+#include <vector>
 
 namespace odb { namespace pgsql { class database; } }
 namespace grpc { class Server; }
+namespace im::gateway { class InlineCommandHandler; }
+namespace im::network { class TlsTicketKeyRing; }
 
 #ifdef IM_ENABLE_USER_HTTP
 namespace im::gateway { class UserHttpController; }
@@ -52,16 +57,23 @@ namespace im::gateway { class UserClient; }
 namespace im::gateway { class MessageClient; }
 #endif
 
+#if defined(IM_ENABLE_MESSAGE_HTTP) || defined(IM_ENABLE_MESSAGE_WS)
+namespace im::service::message { class MessageService; }
+#endif
+
 #ifdef IM_ENABLE_MESSAGE_HTTP
 namespace im::gateway { class MessageHttpController; }
 #endif
 
 #ifdef IM_ENABLE_MESSAGE_WS
 namespace im::gateway { class MessageWsHandler; }
+namespace im::gateway { class DeliveryAckCoalescer; }
+namespace im::gateway { class DeliveryLedger; }
 #endif
 
 #ifdef IM_ENABLE_PUSH_SERVICE
 namespace im::gateway { class PushService; }
+namespace im::service::push { class OfflineOutbox; }
 #endif
 
 #if defined(IM_ENABLE_MESSAGE_WS) || defined(IM_ENABLE_GROUP_MESSAGE_HTTP)
@@ -76,6 +88,7 @@ namespace im::gateway { class GatewayPushDeliveryService; }
 #ifdef IM_ENABLE_FRIEND_HTTP
 namespace im::gateway { class FriendClient; }
 namespace im::gateway { class FriendHttpController; }
+namespace im::gateway { class PresenceFanout; }
 #endif
 
 #ifdef IM_ENABLE_GROUP_HTTP
@@ -84,8 +97,11 @@ namespace im::gateway { class GroupClient; }
 namespace im::gateway { class GroupHttpController; }
 #endif
 
-#ifdef IM_ENABLE_GROUP_MESSAGE_HTTP
+#if defined(IM_ENABLE_GROUP_HTTP) || defined(IM_ENABLE_GROUP_MESSAGE_HTTP)
 namespace im::service::group { class GroupMessageService; }
+#endif
+
+#ifdef IM_ENABLE_GROUP_MESSAGE_HTTP
 namespace im::gateway { class GroupMessageHttpController; }
 #endif
 
@@ -94,12 +110,26 @@ namespace gateway {
 
 using im::network::IOServicePool;
 using im::network::SessionPtr;
+using im::network::TCPServer;
+using im::network::TCPSession;
 using im::network::WebSocketServer;
 using im::network::WebSocketSession;
 using im::utils::ConfigManager;
 using im::utils::LogManager;
 using message_handler = std::function<Task<CoroProcessorResult>(const UnifiedMessage& msg)>;
 
+/**
+ * @brief 可注入的网关依赖，为空的字段按配置文件创建默认实现
+ *
+ * 进程内压测和测试用它替换依赖外部服务（Redis、PostgreSQL、远程服务）的组件。
+ */
+struct GatewayDependencies {
+    std::shared_ptr<MultiPlatformAuthManager> auth_mgr;
+    std::shared_ptr<ConnectionStateStore> connection_state_store;
+#if defined(IM_ENABLE_MESSAGE_HTTP) || defined(IM_ENABLE_MESSAGE_WS) || defined(IM_ENABLE_PUSH_SERVICE)
+    std::shared_ptr<MessageClient> message_client;
+#endif
+};
 
 class GatewayServer : public std::enable_shared_from_this<GatewayServer> {
 public:
@@ -107,6 +137,8 @@ public:
     GatewayServer(const GatewayServer&) = delete;
     GatewayServer(const std::string platform_strategy_config, const std::string router_mgr,
                   uint16_t ws_port = 8080, uint16_t http_port = 8081);
+    GatewayServer(const std::string platform_strategy_config, const std::string router_mgr,
+                  uint16_t ws_port, uint16_t http_port, GatewayDependencies deps);
     ~GatewayServer();
 
     // 启动网关服务
@@ -122,6 +154,12 @@ public:
 
     bool is_running() const { return is_running_; }
 
+    // 热重启：监听 socket 已交给新进程，正在排空连接
+    bool is_draining() const { return draining_.load(std::memory_order_acquire); }
+
+    // 排空结束后调用（在 I/O 线程上），进程据此退出；需在 start() 前设置
+    void set_drained_handler(std::function<void()> handler) { drained_handler_ = std::move(handler); }
+
     // ConnectionManager集成接口
     bool push_message_to_user(const std::string& user_id, const std::string& message);
     bool push_message_to_device(const std::string& user_id, const std::string& device_id,
@@ -132,6 +170,21 @@ public:
     // bool register_message_handlers(uint32_t cmd_id, message_handler handler) { return msg_processor_->register_coro_processor(cmd_id, handler) == 0; }
     bool register_message_handlers(uint32_t cmd_id, std::function<ProcessorResult(const UnifiedMessage&)> handler);
     bool force_register_handler(uint32_t cmd_id, std::function<ProcessorResult(const UnifiedMessage&)> handler);  // Test helper
+
+    // 类型化注册：解析/类型校验/响应编码由 typed_handler.hpp 在编译期生成
+    template <uint32_t CmdId, typename Request, typename Response, typename Fn>
+    bool register_handler(Fn fn) {
+        return register_message_handlers(
+                CmdId, make_typed_processor<CmdId, Request, Response>(std::move(fn)));
+    }
+    // 带鉴权的类型化注册：auth 先于类型校验和解析执行
+    template <uint32_t CmdId, typename Request, typename Response, typename Identity,
+              typename Auth, typename Fn>
+    bool register_authenticated_handler(Auth auth, Fn fn) {
+        return register_message_handlers(
+                CmdId, make_authenticated_processor<CmdId, Request, Response, Identity>(
+                               std::move(auth), std::move(fn)));
+    }
     static ProcessorResult handle_heartbeat_message(
             const UnifiedMessage& msg,
             const std::shared_ptr<MultiPlatformAuthManager>& auth_mgr);
@@ -144,8 +197,20 @@ public:
 private:
     // bool init_network_components();
     void init_ws_server(uint16_t port);  // param : ioc , ssl_context ,port , message_callback
+    void init_tcp_server();              // gateway.tcp_port > 0 时启用原生TCP端口
     void init_http_server(uint16_t port);
 
+    // 热重启（gateway.hot_restart_socket）：启动时从旧进程接手监听 socket，
+    // 启动完成后确认交接并等待下一个新进程
+    void init_hot_restart();
+    void start_hot_restart();
+    std::optional<boost::asio::ip::tcp::acceptor> adopt_listener(
+            const std::string& name, uint16_t port, boost::asio::io_context& ioc);
+
+    // 交接完成：停止 accept，按 gateway.drain_window_sec 分批关闭已有连接
+    void begin_drain();
+    void drain_step();
+
     // bool init_core_components();
     void init_conn_mgr();       // param: platform_strategy_configfile , ws_server
     void init_msg_parser();     // param: routerMgr/router_configfile
@@ -183,11 +248,19 @@ private:
     void stop_gateway_push_delivery_server();
 #endif
 
-    // WebSocket连接事件处理
+    // 连接事件处理
     void on_websocket_connect(SessionPtr session);
-    void on_websocket_disconnect(SessionPtr session);
+    void on_tcp_connect(std::shared_ptr<TCPSession> session);
+    void on_client_disconnect(SessionPtr session);
+
+    // 客户端消息帧处理，WebSocket 与原生 TCP 共用
+    void on_client_frame(SessionPtr session, const std::string& frame);
+
+    // v2 批量帧：整批一个任务，子请求响应聚合为一个批量响应帧
+    void handle_ws_batch_frame(SessionPtr session, const std::string& frame);
 
     // Token验证和连接管理
+    void authenticate_connection(SessionPtr session);
     bool verify_and_bind_connection(SessionPtr session, const std::string& token);
 
     // 安全相关
@@ -220,13 +293,32 @@ private:
 
     // 网络服务组件
     std::shared_ptr<IOServicePool> io_service_pool_;
+    // 按会话ID查找 WebSocket 与原生 TCP 连接，交给 ConnectionManager / PushService
+    im::network::CompositeSessionLookup session_lookup_;
     std::unique_ptr<WebSocketServer> websocket_server_;
+    // 心跳等简单命令在 I/O 线程直接应答，gateway.ws_inline_commands=false 时为空
+    std::unique_ptr<InlineCommandHandler> inline_commands_;
+    // 声明在 ssl_ctx_ 之前：ssl_ctx_ 先析构，ticket 回调不会访问已释放的密钥
+    std::unique_ptr<im::network::TlsTicketKeyRing> tls_ticket_keys_;
     boost::asio::ssl::context ssl_ctx_;  // ssl_context必须要初始化
+    std::unique_ptr<TCPServer> tcp_server_;  // 原生TCP端口，未配置时为空
     std::unique_ptr<httplib::Server> http_server_;
     std::thread http_thread_;
 
+    // 热重启
+    std::string hot_restart_socket_;  // 为空时不启用
+    std::unique_ptr<im::network::ListenerHandoffClient> inherited_listeners_;
+    std::unique_ptr<im::network::ListenerHandoffServer> handoff_server_;
+    std::chrono::seconds drain_window_{60};
+    std::atomic<bool> draining_{false};
+    std::unique_ptr<boost::asio::steady_timer> drain_timer_;
+    std::vector<SessionPtr> drain_queue_;  // 只在 drain_timer_ 的 I/O 线程上访问
+    std::chrono::steady_clock::time_point drain_deadline_;
+    std::function<void()> drained_handler_;
+
     // 网关核心组件
     std::unique_ptr<ConnectionManager> conn_mgr_;
+    std::shared_ptr<ConnectionStateStore> conn_state_store_;  // 为空时 ConnectionManager 使用Redis
     std::shared_ptr<MultiPlatformAuthManager> auth_mgr_;
     std::shared_ptr<RouterManager> router_mgr_;
     std::unique_ptr<MessageParser> msg_parser_;
@@ -240,6 +332,7 @@ private:
     std::atomic<bool> is_running_;
     std::atomic<size_t> ws_inflight_messages_{0};
     size_t max_ws_inflight_messages_{4096};
+    size_t max_ws_batch_size_{64};  // 单个批量帧允许的子消息数
     HttpStats http_stats_;
     std::string psc_path_;     // platform_strategy_config_path_
     std::string config_path_;  // gateway/router/auth shared config path for the MVP
@@ -261,8 +354,16 @@ private:
     std::shared_ptr<MessageClient> message_client_;
 #endif
 
+#if defined(IM_ENABLE_MESSAGE_HTTP) || defined(IM_ENABLE_MESSAGE_WS)
+    // message.mode=local 时网关内的 MessageService，仅用于输出历史缓存统计。
+    std::shared_ptr<im::service::message::MessageService> local_message_service_;
+#endif
+
 #ifdef IM_ENABLE_MESSAGE_WS
     std::unique_ptr<MessageWsHandler> message_ws_handler_;
+    std::unique_ptr<DeliveryAckCoalescer> delivery_ack_coalescer_;
+    // 每个会话实际写出的消息ID，客户端 ACK 只覆盖本会话收到的消息
+    std::unique_ptr<DeliveryLedger> delivery_ledger_;
 #endif
 
 #if defined(IM_ENABLE_MESSAGE_WS) || defined(IM_ENABLE_GROUP_MESSAGE_HTTP)
@@ -271,6 +372,7 @@ private:
 
 #ifdef IM_ENABLE_PUSH_SERVICE
     std::unique_ptr<PushService> push_service_;
+    std::shared_ptr<im::service::push::OfflineOutbox> offline_outbox_;
 #endif
 
 #ifdef IM_ENABLE_REMOTE_PUSH_NOTIFIER
@@ -283,6 +385,7 @@ private:
 #ifdef IM_ENABLE_FRIEND_HTTP
     std::shared_ptr<FriendClient> friend_client_;
     std::unique_ptr<FriendHttpController> friend_http_controller_;
+    std::unique_ptr<PresenceFanout> presence_fanout_;
 #endif
 
 #ifdef IM_ENABLE_GROUP_HTTP
@@ -293,6 +396,11 @@ private:
 #ifdef IM_ENABLE_GROUP_MESSAGE_HTTP
     std::unique_ptr<GroupMessageHttpController> group_message_http_controller_;
 #endif
+
+#if defined(IM_ENABLE_GROUP_HTTP) || defined(IM_ENABLE_GROUP_MESSAGE_HTTP)
+    // group.mode=local 时网关内的 GroupMessageService，仅用于输出历史缓存统计。
+    std::shared_ptr<im::service::group::GroupMessageService> local_group_message_service_;
+#endif
 };
 
 
@@ -41,4 +41,22 @@ bool LocalMessageClient::mark_read(uint64_t msg_id, int64_t read_time) {
     return message_service_->mark_read(msg_id, read_time);
 }
 
+std::size_t LocalMessageClient::mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                                     int64_t delivered_time) {
+    return message_service_->mark_delivered_batch(msg_ids, delivered_time);
+}
+
+std::size_t LocalMessageClient::mark_delivered_ids(const std::string& receiver_uid,
+                                                   const std::vector<uint64_t>& msg_ids,
+                                                   int64_t delivered_time) {
+    return message_service_->mark_delivered_ids(receiver_uid, msg_ids, delivered_time);
+}
+
+std::vector<im::service::message::MessageData> LocalMessageClient::pull_offline_after(
+    const std::string& receiver_uid,
+    uint64_t after_msg_id,
+    int limit) {
+    return message_service_->pull_offline_after(receiver_uid, after_msg_id, limit);
+}
+
 }  // namespace im::gateway
@@ -1,8 +1,11 @@
 #ifndef GATEWAY_HTTP_MESSAGE_CLIENT_HPP
 #define GATEWAY_HTTP_MESSAGE_CLIENT_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "../../services/message/message_service.hpp"
@@ -29,6 +32,42 @@ public:
 
     virtual bool mark_delivered(uint64_t msg_id, int64_t delivered_time) = 0;
     virtual bool mark_read(uint64_t msg_id, int64_t read_time) = 0;
+
+    // Default issues one mark_delivered per id; the message service has no
+    // batch RPC yet, so only the in-process client overrides this.
+    virtual std::size_t mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                             int64_t delivered_time) {
+        std::size_t marked = 0;
+        for (uint64_t msg_id : msg_ids) {
+            marked += mark_delivered(msg_id, delivered_time) ? 1 : 0;
+        }
+        return marked;
+    }
+
+    // Client delivery ack: msg_ids are the messages a session of
+    // receiver_uid acknowledged. The default has no receiver check and
+    // marks them by id; the in-process client scopes the UPDATE to
+    // receiver_uid.
+    virtual std::size_t mark_delivered_ids(const std::string& /*receiver_uid*/,
+                                           const std::vector<uint64_t>& msg_ids,
+                                           int64_t delivered_time) {
+        return msg_ids.empty() ? 0 : mark_delivered_batch(msg_ids, delivered_time);
+    }
+
+    // Undelivered messages with msg_id > after_msg_id, ascending. The default
+    // filters one offline page; the in-process client pages by msg_id.
+    virtual std::vector<im::service::message::MessageData> pull_offline_after(
+        const std::string& receiver_uid,
+        uint64_t after_msg_id,
+        int limit) {
+        std::vector<im::service::message::MessageData> out;
+        for (auto& m : pull_offline(receiver_uid, INT64_MAX, limit)) {
+            if (m.msg_id > after_msg_id) {
+                out.push_back(std::move(m));
+            }
+        }
+        return out;
+    }
 };
 
 class LocalMessageClient final : public MessageClient {
@@ -52,6 +91,15 @@ public:
 
     bool mark_delivered(uint64_t msg_id, int64_t delivered_time) override;
     bool mark_read(uint64_t msg_id, int64_t read_time) override;
+    std::size_t mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                     int64_t delivered_time) override;
+    std::size_t mark_delivered_ids(const std::string& receiver_uid,
+                                   const std::vector<uint64_t>& msg_ids,
+                                   int64_t delivered_time) override;
+    std::vector<im::service::message::MessageData> pull_offline_after(
+        const std::string& receiver_uid,
+        uint64_t after_msg_id,
+        int limit) override;
 
 private:
     std::shared_ptr<im::service::message::MessageService> message_service_;
@@ -1,5 +1,6 @@
 #include "message_http_controller.hpp"
 
+#include <algorithm>
 #include <cctype>
 #include <chrono>
 #include <string>
@@ -11,6 +12,7 @@
 #include "../auth/multi_platform_auth.hpp"
 #include "message_client.hpp"
 #include "../../services/odb/message.hpp"
+#include "../../services/push/offline_outbox.hpp"
 #include "../../services/push/push_notifier.hpp"
 
 namespace im::gateway {
@@ -235,6 +237,12 @@ void MessageHttpController::handle_offline(const HttpRequest& req, HttpResponse&
         m.status = im::service::message::MessageStatus::DELIVERED;
         m.delivered_time = delivered_now;
     }
+    if (offline_outbox_ && !msgs.empty()) {
+        auto [lo, hi] = std::minmax_element(
+            msgs.begin(), msgs.end(),
+            [](const MessageData& a, const MessageData& b) { return a.msg_id < b.msg_id; });
+        offline_outbox_->ack_range(user_info.user_id, lo->msg_id, hi->msg_id);
+    }
 
     json messages = json::array();
     for (const auto& m : msgs) {
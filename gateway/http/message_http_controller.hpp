@@ -14,6 +14,7 @@ class MessageClient;
 
 namespace im::service::push {
 class PushNotifier;
+class OfflineOutbox;
 }
 
 namespace im::gateway {
@@ -35,6 +36,12 @@ public:
         push_notifier_ = notifier;
     }
 
+    // Entries pulled over HTTP are removed from the gateway's offline outbox
+    // so a later reconnect does not push them a second time.
+    void set_offline_outbox(im::service::push::OfflineOutbox* outbox) {
+        offline_outbox_ = outbox;
+    }
+
     void handle_send(const HttpRequest& req, HttpResponse& res);
     void handle_history(const HttpRequest& req, HttpResponse& res);
     void handle_offline(const HttpRequest& req, HttpResponse& res);
@@ -45,6 +52,7 @@ private:
     std::shared_ptr<MessageClient> msg_client_;
     std::shared_ptr<MultiPlatformAuthManager> auth_mgr_;
     im::service::push::PushNotifier* push_notifier_;
+    im::service::push::OfflineOutbox* offline_outbox_ = nullptr;
     std::shared_ptr<spdlog::logger> logger_;
 };
 
@@ -12,6 +12,7 @@
 
 #include "base.pb.h"
 #include "friend.hpp"
+#include "../../common/network/protobuf_arena_pool.hpp"
 #include "../../common/utils/log_manager.hpp"
 
 namespace im::gateway {
@@ -128,12 +129,13 @@ im::service::friend_::FriendResult RemoteFriendClient::send_request(
         return result;
     }
 
-    im::friend_::AddFriendRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::friend_::AddFriendRequest>();
     rpc_request.mutable_header()->set_from_uid(request.requester_uid);
     rpc_request.mutable_header()->set_timestamp(static_cast<uint64_t>(request.now_ms));
     rpc_request.set_to_uid(request.target_uid);
 
-    im::friend_::AddFriendResponse rpc_response;
+    auto& rpc_response = *arena.create<im::friend_::AddFriendResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -168,12 +170,13 @@ im::service::friend_::FriendResult RemoteFriendClient::respond_to_request(
         return result;
     }
 
-    im::friend_::HandleFriendRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::friend_::HandleFriendRequest>();
     rpc_request.mutable_header()->set_from_uid(uid);
     rpc_request.set_request_id(std::to_string(friend_id));
     rpc_request.set_accept(accept);
 
-    im::friend_::HandleFriendResponse rpc_response;
+    auto& rpc_response = *arena.create<im::friend_::HandleFriendResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -204,10 +207,11 @@ std::vector<im::service::friend_::FriendInfoDTO> RemoteFriendClient::get_friends
         return {};
     }
 
-    im::friend_::GetFriendListRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::friend_::GetFriendListRequest>();
     rpc_request.mutable_header()->set_from_uid(uid);
 
-    im::friend_::GetFriendListResponse rpc_response;
+    auto& rpc_response = *arena.create<im::friend_::GetFriendListResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -238,10 +242,11 @@ std::vector<im::service::friend_::FriendInfoDTO> RemoteFriendClient::get_pending
         return {};
     }
 
-    im::friend_::GetFriendRequestsRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::friend_::GetFriendRequestsRequest>();
     rpc_request.mutable_header()->set_from_uid(uid);
 
-    im::friend_::GetFriendRequestsResponse rpc_response;
+    auto& rpc_response = *arena.create<im::friend_::GetFriendRequestsResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
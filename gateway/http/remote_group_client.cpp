@@ -12,6 +12,7 @@
 
 #include "base.pb.h"
 #include "group.hpp"
+#include "../../common/network/protobuf_arena_pool.hpp"
 #include "../../common/utils/log_manager.hpp"
 
 namespace im::gateway {
@@ -179,12 +180,13 @@ im::service::group::GroupResult RemoteGroupClient::create_group(
         return result;
     }
 
-    im::group::CreateGroupRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::CreateGroupRequest>();
     rpc_request.mutable_header()->set_from_uid(request.creator_uid);
     rpc_request.mutable_header()->set_timestamp(static_cast<uint64_t>(request.now_ms));
     rpc_request.set_name(request.name);
 
-    im::group::CreateGroupResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::CreateGroupResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -219,12 +221,13 @@ im::service::group::GroupResult RemoteGroupClient::join_group(
         return result;
     }
 
-    im::group::JoinGroupRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::JoinGroupRequest>();
     rpc_request.mutable_header()->set_from_uid(user_uid);
     rpc_request.mutable_header()->set_timestamp(static_cast<uint64_t>(now_ms));
     rpc_request.set_group_id(group_id);
 
-    im::group::GroupActionResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::GroupActionResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -257,11 +260,12 @@ im::service::group::GroupResult RemoteGroupClient::leave_group(
         return result;
     }
 
-    im::group::LeaveGroupRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::LeaveGroupRequest>();
     rpc_request.mutable_header()->set_from_uid(user_uid);
     rpc_request.set_group_id(group_id);
 
-    im::group::GroupActionResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::GroupActionResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -290,10 +294,11 @@ std::vector<im::service::group::GroupInfoDTO> RemoteGroupClient::list_my_groups(
         logger_->warn("Remote group list lookup skipped: RPC client is not configured");
         return {};
     }
-    im::group::GetGroupListRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::GetGroupListRequest>();
     rpc_request.mutable_header()->set_from_uid(user_uid);
 
-    im::group::GetGroupListResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::GetGroupListResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
     auto status = client_->list_my_groups(&context, rpc_request, &rpc_response);
@@ -314,9 +319,10 @@ std::optional<im::service::group::GroupInfoDTO> RemoteGroupClient::get_group_inf
     if (!client_ || group_id == 0) {
         return std::nullopt;
     }
-    im::group::GetGroupInfoRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::GetGroupInfoRequest>();
     rpc_request.set_group_record_id(group_id);
-    im::group::GetGroupInfoResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::GetGroupInfoResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
     auto status = client_->get_group_info(&context, rpc_request, &rpc_response);
@@ -333,10 +339,11 @@ std::vector<im::service::group::GroupInfoDTO> RemoteGroupClient::search_groups(
     if (!client_ || keyword.empty() || limit == 0) {
         return groups;
     }
-    im::group::SearchGroupsRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::SearchGroupsRequest>();
     rpc_request.set_keyword(keyword);
     rpc_request.set_limit(static_cast<int32_t>(limit));
-    im::group::SearchGroupsResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::SearchGroupsResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
     auto status = client_->search_groups(&context, rpc_request, &rpc_response);
@@ -354,9 +361,10 @@ bool RemoteGroupClient::group_exists(uint64_t group_id) {
     if (!client_) {
         return false;
     }
-    im::group::GroupExistsRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::GroupExistsRequest>();
     rpc_request.set_group_id(group_id);
-    im::group::GroupExistsResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::GroupExistsResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
     auto status = client_->group_exists(&context, rpc_request, &rpc_response);
@@ -371,10 +379,11 @@ std::vector<im::service::group::MemberInfoDTO> RemoteGroupClient::list_members(
     if (!client_) {
         return {};
     }
-    im::group::GetGroupMembersRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::GetGroupMembersRequest>();
     rpc_request.mutable_header()->set_from_uid(caller_uid);
     rpc_request.set_group_record_id(group_id);
-    im::group::GetGroupMembersResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::GetGroupMembersResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
     auto status = client_->list_members(&context, rpc_request, &rpc_response);
@@ -400,13 +409,14 @@ im::service::group::GroupSendResult RemoteGroupClient::send_message(
         result.message = "Remote Group client is not configured";
         return result;
     }
-    im::group::SendGroupMessageRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::SendGroupMessageRequest>();
     rpc_request.mutable_header()->set_from_uid(sender_uid);
     rpc_request.mutable_header()->set_timestamp(static_cast<uint64_t>(now_ms));
     rpc_request.set_group_id(group_id);
     rpc_request.set_content(content);
     rpc_request.set_create_time(now_ms);
-    im::group::SendGroupMessageResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::SendGroupMessageResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
     auto status = client_->send_message(&context, rpc_request, &rpc_response);
@@ -434,12 +444,13 @@ std::vector<im::service::group::GroupMessageDTO> RemoteGroupClient::get_history(
     if (!client_) {
         return {};
     }
-    im::group::GetGroupMessagesRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::group::GetGroupMessagesRequest>();
     rpc_request.mutable_header()->set_from_uid(caller_uid);
     rpc_request.set_group_record_id(group_id);
     rpc_request.set_since(before_time);
     rpc_request.set_limit(limit);
-    im::group::GetGroupMessagesResponse rpc_response;
+    auto& rpc_response = *arena.create<im::group::GetGroupMessagesResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
     auto status = client_->get_history(&context, rpc_request, &rpc_response);
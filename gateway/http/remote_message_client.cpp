@@ -12,6 +12,7 @@
 
 #include "base.pb.h"
 #include "message.hpp"
+#include "../../common/network/protobuf_arena_pool.hpp"
 #include "../../common/utils/log_manager.hpp"
 
 namespace im::gateway {
@@ -149,14 +150,15 @@ im::service::message::SendResult RemoteMessageClient::send_text_message(
         return result;
     }
 
-    im::message::SendMessageRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::message::SendMessageRequest>();
     rpc_request.mutable_header()->set_from_uid(request.sender_uid);
     rpc_request.mutable_header()->set_to_uid(request.receiver_uid);
     rpc_request.mutable_header()->set_timestamp(static_cast<uint64_t>(request.now_ms));
     rpc_request.mutable_body()->set_type(to_proto_type(request.msg_type));
     rpc_request.mutable_body()->set_content(request.content);
 
-    im::message::SendMessageResponse rpc_response;
+    auto& rpc_response = *arena.create<im::message::SendMessageResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -190,13 +192,14 @@ std::vector<im::service::message::MessageData> RemoteMessageClient::get_conversa
         return {};
     }
 
-    im::message::GetConversationRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::message::GetConversationRequest>();
     rpc_request.set_user_a(user_a);
     rpc_request.set_user_b(user_b);
     rpc_request.set_before_time(before_time);
     rpc_request.set_limit(limit);
 
-    im::message::GetConversationResponse rpc_response;
+    auto& rpc_response = *arena.create<im::message::GetConversationResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -229,12 +232,13 @@ std::vector<im::service::message::MessageData> RemoteMessageClient::pull_offline
         return {};
     }
 
-    im::message::PullOfflineRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::message::PullOfflineRequest>();
     rpc_request.set_receiver_uid(receiver_uid);
     rpc_request.set_before_time(before_time);
     rpc_request.set_limit(limit);
 
-    im::message::PullOfflineResponse rpc_response;
+    auto& rpc_response = *arena.create<im::message::PullOfflineResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -263,11 +267,12 @@ bool RemoteMessageClient::mark_delivered(uint64_t msg_id, int64_t delivered_time
         return false;
     }
 
-    im::message::MarkMessageDeliveredRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::message::MarkMessageDeliveredRequest>();
     rpc_request.set_msg_id(msg_id);
     rpc_request.set_delivered_time(delivered_time);
 
-    im::message::MarkMessageDeliveredResponse rpc_response;
+    auto& rpc_response = *arena.create<im::message::MarkMessageDeliveredResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -285,11 +290,12 @@ bool RemoteMessageClient::mark_read(uint64_t msg_id, int64_t read_time) {
         return false;
     }
 
-    im::message::MarkMessageReadRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::message::MarkMessageReadRequest>();
     rpc_request.set_msg_id(msg_id);
     rpc_request.set_read_time(read_time);
 
-    im::message::MarkMessageReadResponse rpc_response;
+    auto& rpc_response = *arena.create<im::message::MarkMessageReadResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -10,6 +10,7 @@
 
 #include "base.pb.h"
 #include "user.hpp"
+#include "../../common/network/protobuf_arena_pool.hpp"
 #include "../../common/utils/log_manager.hpp"
 
 namespace im::gateway {
@@ -141,12 +142,13 @@ im::service::user::RegisterResult RemoteUserClient::register_user(
         return result;
     }
 
-    im::user::RegisterRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::user::RegisterRequest>();
     rpc_request.set_account(request.account);
     rpc_request.set_password(request.password);
     rpc_request.set_nickname(request.nickname);
 
-    im::user::RegisterResponse rpc_response;
+    auto& rpc_response = *arena.create<im::user::RegisterResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -181,11 +183,12 @@ im::service::user::LoginResult RemoteUserClient::login_by_account(
         return result;
     }
 
-    im::user::LoginRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::user::LoginRequest>();
     rpc_request.set_account(account);
     rpc_request.set_password(password);
 
-    im::user::LoginResponse rpc_response;
+    auto& rpc_response = *arena.create<im::user::LoginResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -216,10 +219,11 @@ std::optional<im::service::user::UserProfile> RemoteUserClient::get_profile_by_u
         return std::nullopt;
     }
 
-    im::user::GetUserInfoRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::user::GetUserInfoRequest>();
     rpc_request.set_uid(uid);
 
-    im::user::GetUserInfoResponse rpc_response;
+    auto& rpc_response = *arena.create<im::user::GetUserInfoResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -244,10 +248,11 @@ std::optional<im::service::user::UserProfile> RemoteUserClient::get_profile_by_a
         return std::nullopt;
     }
 
-    im::user::GetUserInfoRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::user::GetUserInfoRequest>();
     rpc_request.set_account(account);
 
-    im::user::GetUserInfoResponse rpc_response;
+    auto& rpc_response = *arena.create<im::user::GetUserInfoResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -273,11 +278,12 @@ std::vector<im::service::user::UserProfile> RemoteUserClient::search_profiles(
         return profiles;
     }
 
-    im::user::SearchUsersRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::user::SearchUsersRequest>();
     rpc_request.set_keyword(keyword);
     rpc_request.set_limit(static_cast<int32_t>(limit));
 
-    im::user::SearchUsersResponse rpc_response;
+    auto& rpc_response = *arena.create<im::user::SearchUsersResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
@@ -308,7 +314,8 @@ im::service::user::UpdateProfileResult RemoteUserClient::update_profile(
         return result;
     }
 
-    im::user::UpdateUserInfoRequest rpc_request;
+    auto arena = im::network::ArenaPool::global().acquire();
+    auto& rpc_request = *arena.create<im::user::UpdateUserInfoRequest>();
     rpc_request.mutable_header()->set_from_uid(request.uid);
     auto* user = rpc_request.mutable_user();
     user->set_nickname(request.nickname);
@@ -328,7 +335,7 @@ im::service::user::UpdateProfileResult RemoteUserClient::update_profile(
     }());
     user->set_signature(request.signature);
 
-    im::user::UpdateUserInfoResponse rpc_response;
+    auto& rpc_response = *arena.create<im::user::UpdateUserInfoResponse>();
     ::grpc::ClientContext context;
     apply_deadline(context);
 
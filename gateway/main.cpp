@@ -5,11 +5,13 @@
 #include "../common/utils/signal_handler.hpp"
 #include "gateway_server/gateway_server.hpp"
 
+#include <csignal>
 #include <cstdint>
 #include <exception>
 #include <filesystem>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <sys/resource.h>
 
@@ -83,14 +85,33 @@ im::db::RedisConfig load_redis_config(const im::utils::ConfigManager& config) {
             "redis.connect_timeout", "MYCHAT_REDIS_CONNECT_TIMEOUT", redis_config.connect_timeout);
     redis_config.socket_timeout = config.getWithEnv<int>(
             "redis.socket_timeout", "MYCHAT_REDIS_SOCKET_TIMEOUT", redis_config.socket_timeout);
+    // 环境变量为逗号分隔的 host:port 列表，覆盖配置文件中的 redis.cluster_nodes 数组
+    const auto cluster_nodes = config.getEnv<std::string>("MYCHAT_REDIS_CLUSTER_NODES", "");
+    if (!cluster_nodes.empty()) {
+        std::stringstream stream(cluster_nodes);
+        for (std::string node; std::getline(stream, node, ',');) {
+            if (!node.empty()) {
+                redis_config.cluster_nodes.push_back(node);
+            }
+        }
+    } else {
+        redis_config.cluster_nodes = config.get_array<std::string>("redis.cluster_nodes");
+    }
+    redis_config.cluster_max_redirects = config.get<int>("redis.cluster_max_redirects",
+                                                         redis_config.cluster_max_redirects);
     return redis_config;
 }
 
 bool initialize_redis(const im::utils::ConfigManager& config) {
     auto redis_config = load_redis_config(config);
     if (!im::db::RedisManager::GetInstance().initialize(redis_config)) {
-        std::cerr << "Failed to initialize Redis at " << redis_config.host << ":"
-                  << redis_config.port << std::endl;
+        if (redis_config.cluster_nodes.empty()) {
+            std::cerr << "Failed to initialize Redis at " << redis_config.host << ":"
+                      << redis_config.port << std::endl;
+        } else {
+            std::cerr << "Failed to initialize Redis Cluster via "
+                      << redis_config.cluster_nodes.front() << std::endl;
+        }
         return false;
     }
     return true;
@@ -193,6 +214,9 @@ int main(int argc, char** argv) {
         auto& signal_handler = im::utils::SignalHandler::getInstance();
         signal_handler.registerGracefulShutdown(shutdown_gateway);
 
+        // 热重启交接后排空完毕：按收到 SIGTERM 的流程退出
+        server->set_drained_handler([] { std::raise(SIGTERM); });
+
         // 启动GatewayServer
         server->start();
         std::cout << "Gateway server started. WebSocket port: " << g_config.websocket_port
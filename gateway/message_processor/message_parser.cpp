@@ -471,6 +471,124 @@ ParseResult MessageParser::parse_websocket_message_enhanced(const std::string& r
     }
 }
 
+ParseResult MessageParser::parse_websocket_message_enhanced(
+        const std::string& raw_message, const std::string& session_id,
+        im::network::WireVersion version, const im::network::ConnectionIdentity& identity) {
+    if (version == im::network::WireVersion::V1) {
+        return parse_websocket_message_enhanced(raw_message, session_id);
+    }
+
+    auto logger = LogManager::GetLogger("message_parser");
+
+    if (raw_message.size() > 10 * 1024 * 1024) {  // 10MB limit
+        return ParseResult::error_result(ParseResult::INVALID_REQUEST,
+                                         "WebSocket message too large (>10MB)");
+    }
+
+    try {
+        // 1. 解析固定头，消息体保持原始字节
+        im::network::FrameHeaderV2 frame_header;
+        std::string payload_bytes;
+        if (!im::network::ProtobufCodec::decodeFrameV2(raw_message, frame_header, payload_bytes)) {
+            decode_failures_.fetch_add(1);
+            std::string error_msg = "Failed to decode WebSocket v2 frame, size: " +
+                                    std::to_string(raw_message.size()) + " bytes";
+            logger->warn(error_msg);
+            return ParseResult::error_result(ParseResult::DECODE_FAILED, error_msg);
+        }
+
+        if (frame_header.cmd_id == 0) {
+            std::string error_msg = "Invalid CMD_ID (0) in WebSocket message";
+            logger->warn(error_msg);
+            return ParseResult::error_result(ParseResult::INVALID_REQUEST, error_msg);
+        }
+
+        // 2. 用连接身份补全帧里省略的 IMHeader 字段，处理器照常读取 header
+        auto message = std::make_unique<UnifiedMessage>();
+        im::base::IMHeader header;
+        header.set_version("2");
+        header.set_seq(frame_header.seq);
+        header.set_cmd_id(frame_header.cmd_id);
+        header.set_from_uid(identity.user_id);
+        header.set_token(identity.token);
+        header.set_device_id(identity.device_id);
+        header.set_platform(identity.platform);
+        header.set_timestamp(static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::system_clock::now().time_since_epoch())
+                        .count()));
+        message->set_header(std::move(header));
+
+        UnifiedMessage::SessionContext context;
+        context.protocol = UnifiedMessage::Protocol::WEBSOCKET;
+        context.session_id = session_id.empty() ? generate_session_id() : session_id;
+        context.receive_time = std::chrono::system_clock::now();
+        context.wire_version = im::network::WireVersion::V2;
+        message->set_session_context(std::move(context));
+
+        message->set_raw_protobuf_data(raw_message);
+        message->set_protobuf_type_id(frame_header.type_id);
+        message->set_protobuf_payload(std::move(payload_bytes));
+
+        websocket_messages_parsed_.fetch_add(1);
+        return ParseResult::success_result(std::move(message));
+
+    } catch (const std::exception& e) {
+        decode_failures_.fetch_add(1);
+        std::string error_msg =
+                "Exception in WebSocket v2 message processing: " + std::string(e.what());
+        logger->error(error_msg);
+        return ParseResult::error_result(ParseResult::PARSE_ERROR, error_msg);
+    }
+}
+
+BatchParseResult MessageParser::parse_websocket_batch(
+        const std::string& raw_message, const std::string& session_id,
+        const im::network::ConnectionIdentity& identity, std::size_t max_items) {
+    auto logger = LogManager::GetLogger("message_parser");
+    BatchParseResult result;
+
+    if (raw_message.size() > 10 * 1024 * 1024) {  // 10MB limit
+        result.error_code = ParseResult::INVALID_REQUEST;
+        result.error_message = "WebSocket message too large (>10MB)";
+        return result;
+    }
+
+    // 1. 切分子帧；外层头没能读出时 seq 保持 0
+    im::network::FrameHeaderV2 batch_header;
+    std::vector<std::string> sub_frames;
+    if (!im::network::ProtobufCodec::decodeBatchV2(raw_message, batch_header, sub_frames,
+                                                   max_items)) {
+        decode_failures_.fetch_add(1);
+        result.seq = batch_header.seq;
+        result.error_code = ParseResult::DECODE_FAILED;
+        result.error_message = "Invalid v2 batch frame or more than " +
+                               std::to_string(max_items) + " sub-frames";
+        logger->warn(result.error_message);
+        return result;
+    }
+    result.seq = batch_header.seq;
+
+    // 2. 子帧逐个按单帧规则解析，任一失败则整批失败
+    result.messages.reserve(sub_frames.size());
+    for (const auto& sub_frame : sub_frames) {
+        auto parsed = parse_websocket_message_enhanced(
+                sub_frame, session_id, im::network::WireVersion::V2, identity);
+        if (!parsed.success) {
+            result.messages.clear();
+            result.error_code = parsed.error_code;
+            result.error_message = "Invalid sub-frame in v2 batch: " + parsed.error_message;
+            return result;
+        }
+        result.messages.push_back(std::move(parsed.message));
+    }
+
+    result.success = true;
+    logger->debug("WebSocket v2 batch parsed: seq={}, items={}", result.seq,
+                  result.messages.size());
+    return result;
+}
+
 // ===== 统计信息管理 =====
 
 MessageParser::ParserStats MessageParser::get_stats() const {
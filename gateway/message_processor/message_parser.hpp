@@ -20,9 +20,11 @@
 #include <memory>
 #include <shared_mutex>
 #include <string>
+#include <vector>
 
 #include <httplib.h>
 #include "../../common/network/protobuf_codec.hpp"
+#include "../../common/network/wire_format.hpp"
 #include "../router/router_mgr.hpp"
 #include "unified_message.hpp"
 
@@ -60,6 +62,19 @@ struct ParseResult {
         return {false, nullptr, message, code};
     }
 };
+/**
+ * @brief v2 批量帧的解析结果
+ *
+ * @details 子消息按帧内顺序排列；任何一个子帧非法时整批失败，messages 为空
+ */
+struct BatchParseResult {
+    bool success = false;
+    std::vector<std::unique_ptr<UnifiedMessage>> messages;  ///< 成功时的子消息
+    uint32_t seq = 0;               ///< 批次序号，批量响应和整批错误原样带回
+    std::string error_message;      ///< 失败时的错误信息
+    int error_code = ParseResult::SUCCESS;
+};
+
 /**
  * @brief 统一消息解析器
  *
@@ -138,6 +153,34 @@ public:
     ParseResult parse_websocket_message_enhanced(const std::string& raw_message,
                                                  const std::string& session_id = "");
 
+    /**
+     * @brief 按连接协商的帧格式解析WebSocket消息
+     *
+     * @param raw_message 原始二进制消息
+     * @param session_id 会话ID
+     * @param version 连接协商的帧格式，V1 等价于上面的重载
+     * @param identity 连接身份，v2 帧据此补全 IMHeader 的 token / from_uid / device_id / platform
+     * @return 解析结果，包含详细的错误信息
+     */
+    ParseResult parse_websocket_message_enhanced(const std::string& raw_message,
+                                                 const std::string& session_id,
+                                                 im::network::WireVersion version,
+                                                 const im::network::ConnectionIdentity& identity);
+
+    /**
+     * @brief 解析 v2 批量帧
+     *
+     * @param raw_message 外层 flags 带 kFrameFlagBatch 的 v2 帧
+     * @param session_id 会话ID
+     * @param identity 连接身份，用于补全每个子消息的 IMHeader
+     * @param max_items 允许的最大子帧数（gateway.ws_max_batch_size）
+     * @return 批量解析结果，子帧逐个按 v2 单帧规则解析
+     */
+    BatchParseResult parse_websocket_batch(const std::string& raw_message,
+                                           const std::string& session_id,
+                                           const im::network::ConnectionIdentity& identity,
+                                           std::size_t max_items);
+
     /**
      * @brief 获取路由管理器引用（用于路由查询）
      *
@@ -14,6 +14,7 @@
  *
  *****************************************************************************/
 
+#include <algorithm>
 #include <memory>
 #include "../../common/utils/log_manager.hpp"
 #include "../../common/utils/thread_pool.hpp"
@@ -78,8 +79,11 @@ int MessageProcessor::register_processor(
                        cmd_id);
     }
 
-    // 3. 检查是否已经注册过该cmd_id的处理函数（需要C++20支持）
-    if (processor_map_.contains(cmd_id)) {
+    // 3. 检查是否已经注册过该cmd_id的处理函数
+    auto pos = std::lower_bound(
+            processor_map_.begin(), processor_map_.end(), cmd_id,
+            [](const auto& entry, uint32_t id) { return entry.first < id; });
+    if (pos != processor_map_.end() && pos->first == cmd_id) {
         LogManager::GetLogger("message_processor")
                 ->warn("MessageProcessor::register_processor: processor already exists for cmd_id: "
                        "{}",
@@ -87,8 +91,8 @@ int MessageProcessor::register_processor(
         return 1;
     }
 
-    // 4. 注册处理函数
-    processor_map_[cmd_id] = processor;
+    // 4. 按cmd_id有序插入
+    processor_map_.emplace(pos, cmd_id, std::move(processor));
     LogManager::GetLogger("message_processor")
             ->info("MessageProcessor::register_processor: processor registered for cmd_id: {}",
                    cmd_id);
@@ -129,9 +133,9 @@ ProcessorResult MessageProcessor::process_message_sync(std::unique_ptr<UnifiedMe
 
         // 3. 查找对应的处理函数
         uint32_t cmd_id = message->get_cmd_id();
-        auto processor_it = processor_map_.find(cmd_id);
+        const ProcessorFunction* processor = find_processor(cmd_id);
 
-        if (processor_it == processor_map_.end()) {
+        if (!processor) {
             LogManager::GetLogger("message_processor")
                     ->error("MessageProcessor::process_message_sync: no processor for cmd_id: {}",
                             cmd_id);
@@ -143,7 +147,7 @@ ProcessorResult MessageProcessor::process_message_sync(std::unique_ptr<UnifiedMe
         LogManager::GetLogger("message_processor")
                 ->debug("MessageProcessor::process_message_sync: executing processor for cmd_id: {}",
                         cmd_id);
-        return processor_it->second(*message);
+        return (*processor)(*message);
 
     } catch (const std::exception& e) {
         // 5. 异常处理和日志记录
@@ -155,6 +159,17 @@ ProcessorResult MessageProcessor::process_message_sync(std::unique_ptr<UnifiedMe
     }
 }
 
+const MessageProcessor::ProcessorFunction* MessageProcessor::find_processor(
+        uint32_t cmd_id) const {
+    auto it = std::lower_bound(
+            processor_map_.begin(), processor_map_.end(), cmd_id,
+            [](const auto& entry, uint32_t id) { return entry.first < id; });
+    if (it == processor_map_.end() || it->first != cmd_id) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
 bool MessageProcessor::verify_access_token(const UnifiedMessage& message) {
     if (message.get_token().empty()) {
         LogManager::GetLogger("message_processor")
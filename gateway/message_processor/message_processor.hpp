@@ -22,13 +22,16 @@
 #include "../auth/multi_platform_auth.hpp"
 #include "../router/router_mgr.hpp"
 #include "message_parser.hpp"
+#include "processor_result.hpp"
+#include "typed_handler.hpp"
 #include "unified_message.hpp"
 
 #include <functional>
 #include <future>
 #include <memory>
 #include <string>
-#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace im::gateway {
 
@@ -38,54 +41,6 @@ using im::gateway::MultiPlatformAuthManager;
 using im::gateway::RouterManager;
 using im::gateway::UnifiedMessage;
 
-/**
- * @brief 消息处理结果结构体
- *
- * @details 封装消息处理的结果信息，包括状态码、错误信息和响应数据
- *          支持Protobuf和JSON两种响应格式
- *  json_body: {
- *     code,
- *     body,
- *     err_msg
- *  }
- */
-struct ProcessorResult {
-    int status_code;               ///< 状态码，0表示成功，其他表示错误类型
-    std::string error_message;     ///< 错误信息描述
-    std::string protobuf_message;  ///< Protobuf格式的响应数据 (header + body
-                                   ///< ,需配合protobufcodec进行使用)
-    std::string json_body;         ///< JSON格式的响应数据
-
-    /**
-     * @brief 默认构造函数，创建成功状态的结果
-     */
-    ProcessorResult() : status_code(0), error_message(), protobuf_message(), json_body() {}
-
-    /**
-     * @brief 构造错误结果
-     * @param code 错误状态码
-     * @param err_msg 错误信息
-     */
-    ProcessorResult(int code, std::string err_msg)
-            : status_code(code)
-            , error_message(std::move(err_msg))
-            , protobuf_message()
-            , json_body() {}
-
-    /**
-     * @brief 构造完整结果
-     * @param code 状态码
-     * @param err_msg 错误信息
-     * @param pb_msg Protobuf响应数据
-     * @param json JSON响应数据
-     */
-    ProcessorResult(int code, std::string err_msg, std::string pb_msg, std::string json)
-            : status_code(code)
-            , error_message(std::move(err_msg))
-            , protobuf_message(std::move(pb_msg))
-            , json_body(std::move(json)) {}
-};
-
 /**
  * @class MessageProcessor
  * @brief 异步消息处理器
@@ -154,6 +109,56 @@ public:
     int register_processor(
             uint32_t cmd_id, std::function<ProcessorResult(const UnifiedMessage&)> processor);
 
+    /**
+     * @brief 注册类型化处理函数
+     *
+     * @tparam CmdId    命令ID
+     * @tparam Request  请求消息类型（需在 message_type_registry.hpp 登记）
+     * @tparam Response 响应消息类型（需带 base 字段）
+     * @param fn        HandlerStatus(const UnifiedMessage&, const Request&, Response&)
+     *
+     * @return 同 register_processor
+     *
+     * @details 类型校验、arena 上的解析和响应编码在编译期由 typed_handler.hpp
+     *          生成，处理函数只处理业务字段。fn 会被并发调用，需可按 const
+     *          调用且不持有可变状态。
+     *
+     * @code
+     * processor->register_handler<im::command::CMD_SEND_MESSAGE,
+     *                             im::message::SendMessageRequest,
+     *                             im::message::SendMessageResponse>(
+     *         [](const UnifiedMessage& msg, const auto& req, auto& resp) {
+     *             resp.mutable_message()->set_content(req.body().content());
+     *             return HandlerStatus::ok();
+     *         });
+     * @endcode
+     */
+    template <uint32_t CmdId, typename Request, typename Response, typename Fn>
+    int register_handler(Fn fn) {
+        return register_processor(CmdId,
+                                  make_typed_processor<CmdId, Request, Response>(std::move(fn)));
+    }
+
+    /**
+     * @brief 注册带鉴权的类型化处理函数
+     *
+     * @tparam Identity 鉴权得到的身份类型
+     * @param auth      HandlerStatus(const UnifiedMessage&, Identity&)
+     * @param fn        HandlerStatus(const UnifiedMessage&, const Identity&,
+     *                                const Request&, Response&)
+     *
+     * @return 同 register_processor
+     *
+     * @details auth 先于类型校验和解析执行，未通过时请求体不会被解析。
+     */
+    template <uint32_t CmdId, typename Request, typename Response, typename Identity,
+              typename Auth, typename Fn>
+    int register_authenticated_handler(Auth auth, Fn fn) {
+        return register_processor(
+                CmdId, make_authenticated_processor<CmdId, Request, Response, Identity>(
+                               std::move(auth), std::move(fn)));
+    }
+
     /**
      * @brief 异步处理消息
      *
@@ -196,9 +201,14 @@ private:
     /// 多平台认证管理器，用于Token验证和用户身份认证
     std::shared_ptr<MultiPlatformAuthManager> auth_mgr_;
 
-    /// 消息处理函数映射表，key为cmd_id，value为对应的处理函数
-    std::unordered_map<uint32_t, std::function<ProcessorResult(const UnifiedMessage&)>>
-            processor_map_;
+    using ProcessorFunction = std::function<ProcessorResult(const UnifiedMessage&)>;
+
+    /// 按cmd_id查找处理函数，未注册返回nullptr
+    const ProcessorFunction* find_processor(uint32_t cmd_id) const;
+
+    /// 消息处理函数表，按cmd_id升序的平铺数组。只在启动时注册，
+    /// 命令数量少，二分查找比哈希表少一次取模和链表跳转
+    std::vector<std::pair<uint32_t, ProcessorFunction>> processor_map_;
 };
 
 }  // namespace im::gateway
@@ -207,7 +217,7 @@ private:
  * @note 使用注意事项：
  * 1. 处理函数应该避免长时间阻塞操作，如需要可以在内部使用异步调用
  * 2. HTTP协议消息会自动进行Token验证，WebSocket消息假设已在连接时验证
- * 3. 需要C++20支持以使用std::unordered_map::contains方法
+ * 3. 处理函数表在注册阶段构建，运行期只读，注册应在开始处理消息前完成
  * 4. 错误处理使用ErrorCode枚举，确保与系统其他模块保持一致
  * 5. 所有操作都有详细的日志记录，便于问题排查和监控
  */
@@ -0,0 +1,69 @@
+#ifndef PROCESSOR_RESULT_HPP
+#define PROCESSOR_RESULT_HPP
+
+/******************************************************************************
+ *
+ * @file       processor_result.hpp
+ * @brief      消息处理结果，MessageProcessor 与类型化处理器共用
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ *****************************************************************************/
+
+#include <string>
+#include <utility>
+
+namespace im::gateway {
+
+/**
+ * @brief 消息处理结果结构体
+ *
+ * @details 封装消息处理的结果信息，包括状态码、错误信息和响应数据
+ *          支持Protobuf和JSON两种响应格式
+ *  json_body: {
+ *     code,
+ *     body,
+ *     err_msg
+ *  }
+ */
+struct ProcessorResult {
+    int status_code;               ///< 状态码，0表示成功，其他表示错误类型
+    std::string error_message;     ///< 错误信息描述
+    std::string protobuf_message;  ///< Protobuf格式的响应数据 (header + body
+                                   ///< ,需配合protobufcodec进行使用)
+    std::string json_body;         ///< JSON格式的响应数据
+
+    /**
+     * @brief 默认构造函数，创建成功状态的结果
+     */
+    ProcessorResult() : status_code(0), error_message(), protobuf_message(), json_body() {}
+
+    /**
+     * @brief 构造错误结果
+     * @param code 错误状态码
+     * @param err_msg 错误信息
+     */
+    ProcessorResult(int code, std::string err_msg)
+            : status_code(code)
+            , error_message(std::move(err_msg))
+            , protobuf_message()
+            , json_body() {}
+
+    /**
+     * @brief 构造完整结果
+     * @param code 状态码
+     * @param err_msg 错误信息
+     * @param pb_msg Protobuf响应数据
+     * @param json JSON响应数据
+     */
+    ProcessorResult(int code, std::string err_msg, std::string pb_msg, std::string json)
+            : status_code(code)
+            , error_message(std::move(err_msg))
+            , protobuf_message(std::move(pb_msg))
+            , json_body(std::move(json)) {}
+};
+
+}  // namespace im::gateway
+
+#endif  // PROCESSOR_RESULT_HPP
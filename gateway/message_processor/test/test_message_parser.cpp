@@ -327,6 +327,149 @@ TEST_F(MessageParserTest, ParseWebSocketMessageEnhanced_LargeMessage) {
     EXPECT_EQ(result.message, nullptr);
 }
 
+// ===== v2 帧解析测试 =====
+
+TEST_F(MessageParserTest, ParseWebSocketMessageV2_FillsHeaderFromConnectionIdentity) {
+    im::base::IMHeader header;
+    header.set_cmd_id(1001);
+    header.set_seq(9);
+    im::base::BaseRequest request;
+    request.set_payload("v2-payload");
+    std::string frame;
+    ASSERT_TRUE(im::network::ProtobufCodec::encode(header, request, frame,
+                                                   im::network::WireVersion::V2));
+
+    im::network::ConnectionIdentity identity;
+    identity.token = "conn_token";
+    identity.user_id = "conn_user";
+    identity.device_id = "conn_device";
+    identity.platform = "ios";
+
+    auto result = parser_->parse_websocket_message_enhanced(
+            frame, "ws_session_v2", im::network::WireVersion::V2, identity);
+
+    ASSERT_TRUE(result.success) << result.error_message;
+    ASSERT_NE(result.message, nullptr);
+    EXPECT_EQ(result.message->get_cmd_id(), 1001u);
+    EXPECT_EQ(result.message->get_header().seq(), 9u);
+    EXPECT_EQ(result.message->get_token(), "conn_token");
+    EXPECT_EQ(result.message->get_from_uid(), "conn_user");
+    EXPECT_EQ(result.message->get_device_id(), "conn_device");
+    EXPECT_EQ(result.message->get_platform(), "ios");
+    EXPECT_EQ(result.message->get_session_context().wire_version, im::network::WireVersion::V2);
+    EXPECT_EQ(result.message->get_protobuf_type_id(),
+              im::network::wire_type_id_v<im::base::BaseRequest>);
+
+    im::base::BaseRequest parsed;
+    ASSERT_TRUE(parsed.ParseFromString(result.message->get_protobuf_payload()));
+    EXPECT_EQ(parsed.payload(), "v2-payload");
+}
+
+TEST_F(MessageParserTest, ParseWebSocketMessageV2_RejectsTruncatedFrame) {
+    im::base::IMHeader header;
+    header.set_cmd_id(1001);
+    im::base::BaseRequest request;
+    request.set_payload("v2-payload");
+    std::string frame;
+    ASSERT_TRUE(im::network::ProtobufCodec::encode(header, request, frame,
+                                                   im::network::WireVersion::V2));
+    frame.pop_back();
+
+    auto result = parser_->parse_websocket_message_enhanced(
+            frame, "ws_session_v2", im::network::WireVersion::V2, {});
+
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(result.error_code, ParseResult::DECODE_FAILED);
+    EXPECT_EQ(result.message, nullptr);
+}
+
+TEST_F(MessageParserTest, ParseWebSocketBatch_SplitsSubFramesInOrder) {
+    std::vector<std::string> sub_frames;
+    for (uint32_t seq = 1; seq <= 3; ++seq) {
+        im::base::IMHeader header;
+        header.set_cmd_id(1001);
+        header.set_seq(seq);
+        im::base::BaseRequest request;
+        request.set_payload("item-" + std::to_string(seq));
+        std::string frame;
+        ASSERT_TRUE(im::network::ProtobufCodec::encode(header, request, frame,
+                                                       im::network::WireVersion::V2));
+        sub_frames.push_back(std::move(frame));
+    }
+    std::string batch;
+    ASSERT_TRUE(im::network::ProtobufCodec::encodeBatchV2(77, sub_frames, batch));
+    ASSERT_TRUE(im::network::ProtobufCodec::isBatchFrameV2(batch));
+
+    im::network::ConnectionIdentity identity;
+    identity.user_id = "user_batch";
+    auto result = parser_->parse_websocket_batch(batch, "ws_session_batch", identity, 8);
+
+    ASSERT_TRUE(result.success) << result.error_message;
+    EXPECT_EQ(result.seq, 77u);
+    ASSERT_EQ(result.messages.size(), 3u);
+    for (uint32_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(result.messages[i]->get_header().seq(), i + 1);
+        EXPECT_EQ(result.messages[i]->get_from_uid(), "user_batch");
+    }
+}
+
+TEST_F(MessageParserTest, ParseWebSocketBatch_RejectsOversizedBatch) {
+    im::base::IMHeader header;
+    header.set_cmd_id(1001);
+    im::base::BaseRequest request;
+    std::string frame;
+    ASSERT_TRUE(im::network::ProtobufCodec::encode(header, request, frame,
+                                                   im::network::WireVersion::V2));
+    std::string batch;
+    ASSERT_TRUE(im::network::ProtobufCodec::encodeBatchV2(5, {frame, frame, frame}, batch));
+
+    auto result = parser_->parse_websocket_batch(batch, "ws_session_batch", {}, 2);
+
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(result.error_code, ParseResult::DECODE_FAILED);
+    EXPECT_EQ(result.seq, 5u);
+    EXPECT_TRUE(result.messages.empty());
+}
+
+TEST_F(MessageParserTest, ParseWebSocketBatch_RejectsConcatenatedOrNestedFrames) {
+    im::base::IMHeader header;
+    header.set_cmd_id(1001);
+    im::base::BaseRequest request;
+    std::string frame;
+    ASSERT_TRUE(im::network::ProtobufCodec::encode(header, request, frame,
+                                                   im::network::WireVersion::V2));
+    std::string nested;
+    ASSERT_TRUE(im::network::ProtobufCodec::encodeBatchV2(6, {frame}, nested));
+
+    // The batch body is a FrameBatch message, not raw sub-frames back to back.
+    std::string concatenated = nested.substr(0, im::network::kFrameHeaderV2Size) + frame;
+    for (int i = 0; i < 4; ++i) {  // body_length, little endian
+        concatenated[16 + i] = static_cast<char>((frame.size() >> (8 * i)) & 0xff);
+    }
+    auto result = parser_->parse_websocket_batch(concatenated, "ws_session_batch", {}, 8);
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(result.error_code, ParseResult::DECODE_FAILED);
+
+    std::string outer;
+    ASSERT_TRUE(im::network::ProtobufCodec::encodeBatchV2(7, {frame, nested}, outer));
+    result = parser_->parse_websocket_batch(outer, "ws_session_batch", {}, 8);
+    EXPECT_FALSE(result.success);
+    EXPECT_EQ(result.seq, 7u);
+    EXPECT_TRUE(result.messages.empty());
+}
+
+TEST_F(MessageParserTest, ParseWebSocketMessageV1_ResolvesTypeId) {
+    auto ws_message = websocket_client_->create_heartbeat_message();
+
+    auto result = parser_->parse_websocket_message_enhanced(
+            ws_message, "ws_session_v1", im::network::WireVersion::V1, {});
+
+    ASSERT_TRUE(result.success);
+    EXPECT_EQ(result.message->get_protobuf_type_id(),
+              im::network::wire_type_id_v<im::base::BaseResponse>);
+    EXPECT_EQ(result.message->get_session_context().wire_version, im::network::WireVersion::V1);
+}
+
 // ===== 会话ID生成测试 =====
 
 TEST_F(MessageParserTest, SessionIdGeneration_HTTP) {
@@ -0,0 +1,241 @@
+#ifndef TYPED_HANDLER_HPP
+#define TYPED_HANDLER_HPP
+
+/******************************************************************************
+ *
+ * @file       typed_handler.hpp
+ * @brief      按 (cmd_id, 请求类型, 响应类型) 在编译期生成的处理器包装
+ *
+ * @details    业务处理函数只写
+ *                 HandlerStatus fn(const UnifiedMessage&, const Req&, Resp&)
+ *             或（带鉴权）
+ *                 HandlerStatus fn(const UnifiedMessage&, const Identity&, const Req&, Resp&)
+ *             包装层按模板参数生成：
+ *             0. 鉴权（仅带鉴权的版本）：先于任何校验和解析，未通过直接返回
+ *             1. cmd_id 校验（整数比较）
+ *             2. 类型校验：比较 wire_type_id_v<Req>，不做类型名字符串比较
+ *             3. 在本次请求的 arena 上创建并解析 Req、创建 Resp
+ *             4. 调用处理函数，按 HandlerStatus 填 base 并按请求的帧格式编码
+ *
+ *             Req 未在 message_type_registry.hpp 登记时编译失败；
+ *             Resp 必须带 `base`（im.base.BaseResponse）字段。
+ *             处理函数以 const 方式调用：包装后的 std::function 会被多个
+ *             I/O 线程并发执行，处理函数不能持有可变状态。
+ *
+ * @author     myself
+ * @date       2026/10/17
+ *
+ *****************************************************************************/
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <google/protobuf/arena.h>
+
+#include "../../common/network/message_type_registry.hpp"
+#include "../../common/network/protobuf_codec.hpp"
+#include "../../common/proto/base.pb.h"
+#include "../../common/utils/log_manager.hpp"
+#include "../../common/utils/service_identity.hpp"
+#include "processor_result.hpp"
+#include "unified_message.hpp"
+
+namespace im::gateway {
+
+/**
+ * @brief 类型化处理函数的返回值
+ *
+ * code 非 SUCCESS 时包装层会清空已填的响应体，只回带错误码的 base；
+ * reply 为 false 时不编码响应帧（如送达回执成功、非 WebSocket 调用）。
+ */
+struct HandlerStatus {
+    im::base::ErrorCode code = im::base::ErrorCode::SUCCESS;
+    std::string message;
+    bool reply = true;
+
+    static HandlerStatus ok() { return {}; }
+
+    static HandlerStatus error(im::base::ErrorCode code, std::string message) {
+        return {code, std::move(message), true};
+    }
+
+    static HandlerStatus no_reply(im::base::ErrorCode code = im::base::ErrorCode::SUCCESS,
+                                  std::string message = {}) {
+        return {code, std::move(message), false};
+    }
+};
+
+namespace detail {
+
+template <typename Response>
+ProcessorResult finish_typed_response(const UnifiedMessage& msg, Response& resp,
+                                      HandlerStatus status) {
+    if (!status.reply) {
+        return ProcessorResult(status.code, std::move(status.message));
+    }
+
+    if (status.code != im::base::ErrorCode::SUCCESS) {
+        resp.Clear();
+    }
+    resp.mutable_base()->set_error_code(status.code);
+    if (!status.message.empty()) {
+        resp.mutable_base()->set_error_message(status.message);
+    }
+
+    auto* response_header = google::protobuf::Arena::Create<im::base::IMHeader>(msg.arena());
+    auto& identity = im::utils::ServiceIdentityManager::getInstance();
+    im::network::ProtobufCodec::fillReturnHeader(msg.get_header(), identity.getDeviceId(),
+                                                 identity.getPlatformInfo(), response_header);
+
+    std::string encoded;
+    if (!im::network::ProtobufCodec::encode(*response_header, resp, encoded,
+                                            msg.get_session_context().wire_version)) {
+        im::utils::LogManager::GetLogger("message_processor")
+                ->error("typed handler: failed to encode {} for cmd_id: {}",
+                        Response::descriptor()->full_name(), msg.get_cmd_id());
+        return ProcessorResult(im::base::ErrorCode::SERVER_ERROR, "Failed to encode response");
+    }
+    return ProcessorResult(status.code, std::move(status.message), std::move(encoded), "");
+}
+
+}  // namespace detail
+
+namespace detail {
+
+// cmd_id/类型校验并在 arena 上解析请求；失败时返回已编码的错误响应
+template <uint32_t CmdId, typename Request, typename Response>
+Request* parse_typed_request(const UnifiedMessage& msg, Response& resp,
+                             ProcessorResult& error) {
+    static_assert(CmdId != 0, "typed handler needs a non-zero cmd_id");
+    static_assert(im::network::wire_type_id_v<Request> != 0,
+                  "request type must be registered in message_type_registry.hpp");
+
+    if (msg.get_cmd_id() != CmdId) {
+        im::utils::LogManager::GetLogger("message_processor")
+                ->warn("typed handler: unexpected cmd_id: {}, expected {}", msg.get_cmd_id(),
+                       CmdId);
+        error = finish_typed_response(
+                msg, resp,
+                HandlerStatus::error(im::base::ErrorCode::INVALID_REQUEST,
+                                     "Unexpected command ID"));
+        return nullptr;
+    }
+
+    if (msg.get_protobuf_type_id() != im::network::wire_type_id_v<Request>) {
+        im::utils::LogManager::GetLogger("message_processor")
+                ->warn("typed handler: unexpected protobuf type id: {}, expected {}",
+                       msg.get_protobuf_type_id(), Request::descriptor()->full_name());
+        error = finish_typed_response(
+                msg, resp,
+                HandlerStatus::error(im::base::ErrorCode::INVALID_REQUEST,
+                                     "Unexpected protobuf type, expected " +
+                                             std::string(Request::descriptor()->full_name())));
+        return nullptr;
+    }
+
+    auto* req = google::protobuf::Arena::Create<Request>(msg.arena());
+    if (!req->ParseFromString(msg.get_protobuf_payload())) {
+        error = finish_typed_response(
+                msg, resp,
+                HandlerStatus::error(im::base::ErrorCode::INVALID_REQUEST,
+                                     "Failed to parse " +
+                                             std::string(Request::descriptor()->full_name())));
+        return nullptr;
+    }
+    return req;
+}
+
+}  // namespace detail
+
+/**
+ * @brief 执行一次类型化处理：校验、解析、调用、编码
+ *
+ * @tparam CmdId    处理器负责的命令ID
+ * @tparam Request  请求消息类型，需已登记类型编号
+ * @tparam Response 响应消息类型，需带 base 字段
+ * @param fn        HandlerStatus(const UnifiedMessage&, const Request&, Response&) const
+ */
+template <uint32_t CmdId, typename Request, typename Response, typename Fn>
+ProcessorResult invoke_typed_handler(const UnifiedMessage& msg, const Fn& fn) {
+    static_assert(std::is_invocable_r_v<HandlerStatus, const Fn&, const UnifiedMessage&,
+                                        const Request&, Response&>,
+                  "typed handler must be callable as const");
+
+    auto* resp = google::protobuf::Arena::Create<Response>(msg.arena());
+    ProcessorResult error;
+    const Request* req = detail::parse_typed_request<CmdId, Request>(msg, *resp, error);
+    if (req == nullptr) {
+        return error;
+    }
+    return detail::finish_typed_response(msg, *resp, fn(msg, *req, *resp));
+}
+
+/**
+ * @brief 带鉴权的类型化处理：先鉴权，再校验、解析、调用、编码
+ *
+ * @tparam Identity 鉴权得到的身份（如 UserTokenInfo）
+ * @param auth      HandlerStatus(const UnifiedMessage&, Identity&) const
+ * @param fn        HandlerStatus(const UnifiedMessage&, const Identity&,
+ *                                const Request&, Response&) const
+ *
+ * @details 鉴权失败时不做 cmd_id/类型校验也不解析请求体，未认证的
+ *          客户端无法借错误码探测负载格式，也不会消耗解析开销。
+ */
+template <uint32_t CmdId, typename Request, typename Response, typename Identity,
+          typename Auth, typename Fn>
+ProcessorResult invoke_authenticated_handler(const UnifiedMessage& msg, const Auth& auth,
+                                             const Fn& fn) {
+    static_assert(std::is_invocable_r_v<HandlerStatus, const Auth&, const UnifiedMessage&,
+                                        Identity&>,
+                  "authenticator must be callable as const");
+    static_assert(std::is_invocable_r_v<HandlerStatus, const Fn&, const UnifiedMessage&,
+                                        const Identity&, const Request&, Response&>,
+                  "typed handler must be callable as const");
+
+    auto* resp = google::protobuf::Arena::Create<Response>(msg.arena());
+
+    Identity identity{};
+    HandlerStatus auth_status = auth(msg, identity);
+    if (auth_status.code != im::base::ErrorCode::SUCCESS) {
+        return detail::finish_typed_response(msg, *resp, std::move(auth_status));
+    }
+
+    ProcessorResult error;
+    const Request* req = detail::parse_typed_request<CmdId, Request>(msg, *resp, error);
+    if (req == nullptr) {
+        return error;
+    }
+    return detail::finish_typed_response(msg, *resp, fn(msg, identity, *req, *resp));
+}
+
+/**
+ * @brief 把类型化处理函数包装成 MessageProcessor 使用的通用处理函数
+ *
+ * 返回的 std::function 会被并发调用，fn 按 const 调用且不应持有可变状态。
+ */
+template <uint32_t CmdId, typename Request, typename Response, typename Fn>
+std::function<ProcessorResult(const UnifiedMessage&)> make_typed_processor(Fn fn) {
+    return [fn = std::move(fn)](const UnifiedMessage& msg) -> ProcessorResult {
+        return invoke_typed_handler<CmdId, Request, Response>(msg, fn);
+    };
+}
+
+/**
+ * @brief 带鉴权的 make_typed_processor
+ */
+template <uint32_t CmdId, typename Request, typename Response, typename Identity,
+          typename Auth, typename Fn>
+std::function<ProcessorResult(const UnifiedMessage&)> make_authenticated_processor(Auth auth,
+                                                                                   Fn fn) {
+    return [auth = std::move(auth), fn = std::move(fn)](const UnifiedMessage& msg)
+                   -> ProcessorResult {
+        return invoke_authenticated_handler<CmdId, Request, Response, Identity>(msg, auth, fn);
+    };
+}
+
+}  // namespace im::gateway
+
+#endif  // TYPED_HANDLER_HPP
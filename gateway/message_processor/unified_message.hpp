@@ -17,7 +17,11 @@
 #include <string>
 #include <sstream>
 #include <iomanip>
+#include "../../common/network/message_type_registry.hpp"
+#include "../../common/network/protobuf_arena_pool.hpp"
+#include "../../common/network/wire_format.hpp"
 #include "../../common/proto/base.pb.h"
+#include "../../common/utils/slab_allocator.hpp"
 
 namespace im {
 namespace gateway {
@@ -26,8 +30,9 @@ namespace gateway {
  * @class UnifiedMessage
  * @brief 精简的统一消息格式
  *
+ * 每帧都会分配一个，对象本身走 SlabAllocator。
  */
-class UnifiedMessage {
+class UnifiedMessage : public im::utils::SlabAllocated {
 public:
     enum class Protocol { HTTP, WEBSOCKET, ENUM_END };
 
@@ -36,6 +41,7 @@ public:
         std::string session_id;                              // 会话ID
         std::string client_ip;                               // 客户端IP
         std::chrono::system_clock::time_point receive_time;  // 接收时间
+        im::network::WireVersion wire_version = im::network::WireVersion::V1;  // WS帧格式，回包按此编码
 
         // HTTP专用字段
         std::string http_method;    // HTTP方法 (GET/POST等)
@@ -69,6 +75,8 @@ public:
 
     // 新增：WS解包信息访问
     const std::string& get_protobuf_type_name() const { return protobuf_type_name_; }
+    // 消息类型编号（见 message_type_registry.hpp），未登记的类型为 0；v2 帧只有编号没有类型名
+    uint32_t get_protobuf_type_id() const { return protobuf_type_id_; }
     const std::string& get_protobuf_payload() const { return protobuf_payload_bytes_; }
 
     // 会话信息访问
@@ -79,6 +87,15 @@ public:
     // 完整的Header访问（给需要的地方用）
     const im::base::IMHeader& get_header() const { return header_; }
 
+    // 本次请求的 protobuf arena，首次调用时从全局 ArenaPool 借出，消息析构时归还。
+    // handler 在上面用 Arena::Create 构造请求/响应对象，不需要逐个释放。
+    google::protobuf::Arena* arena() const {
+        if (!arena_) {
+            arena_ = im::network::ArenaPool::global().acquire();
+        }
+        return arena_.get();
+    }
+
     // ===== 设置接口（给MessageProcessor用） =====
 
     void set_header(const im::base::IMHeader& header) { header_ = header; }
@@ -94,8 +111,16 @@ public:
     void set_raw_protobuf_data(std::string&& raw_data) { raw_protobuf_data_ = std::move(raw_data); }
 
     // 新增：WS解包字段设置
-    void set_protobuf_type_name(const std::string& type_name) { protobuf_type_name_ = type_name; }
-    void set_protobuf_type_name(std::string&& type_name) { protobuf_type_name_ = std::move(type_name); }
+    // 设置类型名时同时解析出类型编号，处理器统一按编号比较
+    void set_protobuf_type_name(const std::string& type_name) {
+        protobuf_type_name_ = type_name;
+        protobuf_type_id_ = im::network::MessageTypeRegistry::id_of(protobuf_type_name_);
+    }
+    void set_protobuf_type_name(std::string&& type_name) {
+        protobuf_type_name_ = std::move(type_name);
+        protobuf_type_id_ = im::network::MessageTypeRegistry::id_of(protobuf_type_name_);
+    }
+    void set_protobuf_type_id(uint32_t type_id) { protobuf_type_id_ = type_id; }
     void set_protobuf_payload(const std::string& payload_bytes) { protobuf_payload_bytes_ = payload_bytes; }
     void set_protobuf_payload(std::string&& payload_bytes) { protobuf_payload_bytes_ = std::move(payload_bytes); }
     
@@ -177,12 +202,16 @@ public:
     };
 
 private:
+    // 最先声明、最后析构：其余成员析构时 arena 上的对象仍然有效
+    mutable im::network::PooledArena arena_;
+
     // 核心数据（基于你现有的设计）
     im::base::IMHeader header_;  // 最重要：包含cmd_id, token等
     std::unique_ptr<google::protobuf::Message> protobuf_message_;  // Protobuf消息体
     std::string json_body_;                                        // JSON消息体（HTTP用）
     std::string raw_protobuf_data_;                                // 原始Protobuf数据（避免不必要的对象创建）
     std::string protobuf_type_name_;                               // 原始消息的类型名（WS按需解析）
+    uint32_t protobuf_type_id_ = 0;                                // 消息类型编号
     std::string protobuf_payload_bytes_;                           // 解包后的消息体原始字节
     SessionContext session_context_;                               // 会话上下文
 };
@@ -0,0 +1,54 @@
+#include "delivery_ledger.hpp"
+
+#include <algorithm>
+
+namespace im::gateway {
+
+void DeliveryLedger::record(const std::string& session_id,
+                            const std::vector<uint64_t>& msg_ids) {
+    if (session_id.empty() || msg_ids.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& written = written_[session_id];
+    written.insert(written.end(), msg_ids.begin(), msg_ids.end());
+    if (written.size() > kMaxPerSession) {
+        written.erase(written.begin(),
+                      written.begin() + static_cast<std::ptrdiff_t>(written.size() - kMaxPerSession));
+    }
+}
+
+std::vector<uint64_t> DeliveryLedger::take_acked(const std::string& session_id,
+                                                 uint64_t acked_msg_id) {
+    std::vector<uint64_t> acked;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = written_.find(session_id);
+    if (it == written_.end()) {
+        return acked;
+    }
+    auto& written = it->second;
+    auto pos = std::find(written.begin(), written.end(), acked_msg_id);
+    if (pos == written.end()) {
+        return acked;
+    }
+    ++pos;
+    acked.assign(written.begin(), pos);
+    written.erase(written.begin(), pos);
+    if (written.empty()) {
+        written_.erase(it);
+    }
+    return acked;
+}
+
+void DeliveryLedger::forget(const std::string& session_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    written_.erase(session_id);
+}
+
+std::size_t DeliveryLedger::size(const std::string& session_id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = written_.find(session_id);
+    return it == written_.end() ? 0 : it->second.size();
+}
+
+} // namespace im::gateway
@@ -0,0 +1,48 @@
+#ifndef GATEWAY_DELIVERY_LEDGER_HPP
+#define GATEWAY_DELIVERY_LEDGER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace im::gateway {
+
+// Per-session record of the message ids written to each session, in the
+// order their frames were queued.
+//
+// A session writes frames in queue order, so a client acking msg_id X has
+// received every frame queued before the one carrying X. take_acked()
+// returns exactly those ids, which keeps a cumulative ack from marking
+// messages that were never sent to this session (or are still queued
+// behind X, e.g. an older catch-up batch behind a live push).
+class DeliveryLedger {
+public:
+    // Oldest ids beyond this are forgotten; they stay pending and are
+    // re-sent by the next connect-time catch-up, which the gateway always
+    // enables together with client acks.
+    static constexpr std::size_t kMaxPerSession = 4096;
+
+    void record(const std::string& session_id, const std::vector<uint64_t>& msg_ids);
+
+    // Removes and returns the ids recorded for session_id up to and
+    // including acked_msg_id. Empty when acked_msg_id was never recorded
+    // for the session or was already taken.
+    std::vector<uint64_t> take_acked(const std::string& session_id, uint64_t acked_msg_id);
+
+    // Drops a closed session's record; its unacked ids stay pending.
+    void forget(const std::string& session_id);
+
+    std::size_t size(const std::string& session_id) const;
+
+private:
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::deque<uint64_t>> written_;
+};
+
+} // namespace im::gateway
+
+#endif // GATEWAY_DELIVERY_LEDGER_HPP
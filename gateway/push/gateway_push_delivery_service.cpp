@@ -3,6 +3,7 @@
 #include <chrono>
 #include <exception>
 #include <string>
+#include <vector>
 
 #include "../../common/proto/base.pb.h"
 
@@ -85,8 +86,10 @@ GatewayPushDeliveryService::GatewayPushDeliveryService(
     }
 
     try {
-        const bool accepted =
-            payload_sender_->send_payload(request->session_id(), request->payload());
+        const std::vector<uint64_t> msg_ids(request->msg_ids().begin(),
+                                            request->msg_ids().end());
+        const bool accepted = payload_sender_->send_messages(
+            request->session_id(), request->payload(), msg_ids);
         response->set_accepted(accepted);
         set_base(base, im::base::SUCCESS);
     } catch (const std::exception& e) {
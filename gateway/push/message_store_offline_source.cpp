@@ -0,0 +1,52 @@
+#include "message_store_offline_source.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "../http/message_client.hpp"
+
+namespace im::gateway {
+
+using im::service::push::OfflineEntry;
+
+MessageStoreOfflineSource::MessageStoreOfflineSource(std::shared_ptr<MessageClient> msg_client)
+    : msg_client_(std::move(msg_client)) {}
+
+bool MessageStoreOfflineSource::append(const std::string& /*receiver_uid*/,
+                                       const OfflineEntry& /*entry*/) {
+    // The message row is already persisted as SENT.
+    return true;
+}
+
+std::vector<OfflineEntry> MessageStoreOfflineSource::peek(const std::string& receiver_uid,
+                                                          uint64_t after_msg_id,
+                                                          std::size_t limit) {
+    if (!msg_client_ || limit == 0) {
+        return {};
+    }
+
+    auto msgs = msg_client_->pull_offline_after(receiver_uid, after_msg_id,
+                                                static_cast<int>(limit));
+
+    std::vector<OfflineEntry> entries;
+    entries.reserve(msgs.size());
+    for (auto& m : msgs) {
+        OfflineEntry entry;
+        entry.msg_id = m.msg_id;
+        entry.content = std::move(m.content);
+        entry.context.sender_uid = m.sender_uid;
+        entry.context.conversation_type = "direct";
+        entry.context.conversation_id = m.sender_uid;
+        entries.push_back(std::move(entry));
+    }
+    std::sort(entries.begin(), entries.end(),
+              [](const OfflineEntry& a, const OfflineEntry& b) { return a.msg_id < b.msg_id; });
+    return entries;
+}
+
+void MessageStoreOfflineSource::ack_range(const std::string& /*receiver_uid*/,
+                                          uint64_t /*from_msg_id*/,
+                                          uint64_t /*to_msg_id*/) {}
+
+} // namespace im::gateway
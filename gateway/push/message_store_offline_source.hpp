@@ -0,0 +1,41 @@
+#ifndef GATEWAY_MESSAGE_STORE_OFFLINE_SOURCE_HPP
+#define GATEWAY_MESSAGE_STORE_OFFLINE_SOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../services/push/offline_outbox.hpp"
+
+namespace im::gateway {
+class MessageClient;
+
+// Read-only OfflineOutbox view over the message service's undelivered
+// (status SENT) direct messages. Used as PushRuntime's pending source for
+// connect-time catch-up: marking a message delivered is what removes it, so
+// ack_range() is a no-op and append() is never called.
+class MessageStoreOfflineSource final : public im::service::push::OfflineOutbox {
+public:
+    explicit MessageStoreOfflineSource(std::shared_ptr<MessageClient> msg_client);
+
+    bool append(const std::string& receiver_uid,
+                const im::service::push::OfflineEntry& entry) override;
+
+    // Oldest pending messages with msg_id > after_msg_id, ascending by msg_id.
+    std::vector<im::service::push::OfflineEntry> peek(const std::string& receiver_uid,
+                                                      uint64_t after_msg_id,
+                                                      std::size_t limit) override;
+
+    void ack_range(const std::string& receiver_uid,
+                   uint64_t from_msg_id,
+                   uint64_t to_msg_id) override;
+
+private:
+    std::shared_ptr<MessageClient> msg_client_;
+};
+
+} // namespace im::gateway
+
+#endif // GATEWAY_MESSAGE_STORE_OFFLINE_SOURCE_HPP
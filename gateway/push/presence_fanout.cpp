@@ -0,0 +1,227 @@
+#include "presence_fanout.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+#include "../../common/network/protobuf_codec.hpp"
+#include "../../common/proto/command.pb.h"
+#include "../../common/proto/push.pb.h"
+#include "../../common/utils/log_manager.hpp"
+#include "../../common/utils/service_identity.hpp"
+
+namespace im::gateway {
+
+using im::network::ProtobufCodec;
+using im::utils::LogManager;
+
+namespace {
+
+int64_t now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+PresenceFanout::PresenceFanout(FriendResolver friends,
+                               FrameSender sender,
+                               OnlineCheck is_online,
+                               std::chrono::milliseconds window)
+    : friends_(std::move(friends))
+    , sender_(std::move(sender))
+    , is_online_(std::move(is_online))
+    , window_(window) {}
+
+PresenceFanout::~PresenceFanout() {
+    stop();
+}
+
+void PresenceFanout::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    worker_ = std::thread([this] { run(); });
+}
+
+void PresenceFanout::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+void PresenceFanout::on_session_added(const std::string& user_id,
+                                      const std::string& /*session_id*/,
+                                      bool user_online) {
+    if (user_online) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        record(user_id, true);
+    }
+}
+
+void PresenceFanout::on_session_removed(const std::string& user_id,
+                                        const std::string& /*session_id*/,
+                                        bool user_offline) {
+    if (user_offline) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        record(user_id, false);
+    }
+}
+
+void PresenceFanout::record(const std::string& user_id, bool online) {
+    ++stats_.transitions;
+    auto [it, inserted] = pending_.try_emplace(user_id);
+    if (inserted) {
+        it->second.was_online = !online;
+    }
+    it->second.online = online;
+    it->second.changed_at_ms = now_ms();
+}
+
+std::size_t PresenceFanout::flush_now() {
+    std::unordered_map<std::string, PendingChange> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.swap(pending_);
+    }
+
+    std::size_t coalesced = 0;
+    std::vector<PresenceChange> changes;
+    std::vector<std::pair<std::string, PendingChange>> held;
+    changes.reserve(batch.size());
+    for (auto& [uid, pending] : batch) {
+        if (pending.was_online == pending.online) {
+            ++coalesced;
+        } else if (!pending.online && !pending.held) {
+            // Give a reconnect through another gateway one more window to land.
+            pending.held = true;
+            held.emplace_back(uid, pending);
+        } else {
+            changes.push_back({uid, pending.online, pending.changed_at_ms});
+        }
+    }
+
+    if (!held.empty()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& [uid, pending] : held) {
+            auto [it, inserted] = pending_.try_emplace(uid, pending);
+            if (!inserted) {
+                // Transitions recorded since the swap keep the latest state.
+                it->second.was_online = pending.was_online;
+            }
+        }
+    }
+
+    // The shared store has the last word: this gateway saw the user leave,
+    // but the user may already be back on another one.
+    if (is_online_) {
+        auto stale = std::remove_if(changes.begin(), changes.end(), [this](const auto& change) {
+            try {
+                return is_online_(change.uid) != change.online;
+            } catch (const std::exception& e) {
+                LogManager::GetLogger("presence_fanout")
+                    ->warn("Online check for user {} failed: {}", change.uid, e.what());
+                return false;
+            }
+        });
+        coalesced += static_cast<std::size_t>(changes.end() - stale);
+        changes.erase(stale, changes.end());
+    }
+
+    // One friend lookup per net change.
+    std::unordered_map<std::string, std::vector<PresenceChange>> by_receiver;
+    for (const auto& change : changes) {
+        std::vector<std::string> friend_uids;
+        try {
+            friend_uids = friends_ ? friends_(change.uid) : std::vector<std::string>{};
+        } catch (const std::exception& e) {
+            LogManager::GetLogger("presence_fanout")
+                ->warn("Friend lookup for presence of user {} failed: {}", change.uid, e.what());
+            continue;
+        }
+        for (const auto& friend_uid : friend_uids) {
+            by_receiver[friend_uid].push_back(change);
+        }
+    }
+
+    uint64_t frames = 0;
+    if (sender_) {
+        for (const auto& [receiver_uid, receiver_changes] : by_receiver) {
+            const auto frame = build_frame(receiver_uid, receiver_changes);
+            if (frame.empty()) {
+                continue;
+            }
+            try {
+                frames += sender_(receiver_uid, frame);
+            } catch (const std::exception& e) {
+                LogManager::GetLogger("presence_fanout")
+                    ->warn("Presence push to user {} failed: {}", receiver_uid, e.what());
+            }
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.coalesced += coalesced;
+    stats_.published += changes.size();
+    stats_.frames += frames;
+    return changes.size();
+}
+
+std::string PresenceFanout::build_frame(const std::string& receiver_uid,
+                                        const std::vector<PresenceChange>& changes) {
+    im::base::IMHeader header;
+    header.set_version("1.0");
+    header.set_cmd_id(im::command::CMD_USER_ONLINE);
+    header.set_from_uid(im::utils::ServiceIdentityManager::getInstance().getDeviceId());
+    header.set_to_uid(receiver_uid);
+    header.set_timestamp(static_cast<uint64_t>(now_ms()));
+
+    im::push::PresenceNotifyRequest request;
+    for (const auto& change : changes) {
+        auto* item = request.add_items();
+        item->set_uid(change.uid);
+        item->set_online(change.online);
+        item->set_changed_at_ms(change.changed_at_ms);
+    }
+
+    std::string encoded;
+    if (!ProtobufCodec::encode(header, request, encoded)) {
+        return "";
+    }
+    return encoded;
+}
+
+PresenceFanoutStats PresenceFanout::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void PresenceFanout::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        cv_.wait_for(lock, window_, [this] { return !running_; });
+        if (!running_) {
+            break;
+        }
+        lock.unlock();
+        try {
+            flush_now();
+        } catch (const std::exception& e) {
+            LogManager::GetLogger("presence_fanout")->warn("Presence flush failed: {}", e.what());
+        }
+        lock.lock();
+    }
+}
+
+} // namespace im::gateway
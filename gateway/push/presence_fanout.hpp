@@ -0,0 +1,116 @@
+#ifndef GATEWAY_PRESENCE_FANOUT_HPP
+#define GATEWAY_PRESENCE_FANOUT_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "connection_manager/connection_manager.hpp"
+
+namespace im::gateway {
+
+struct PresenceChange {
+    std::string uid;
+    bool online = false;
+    int64_t changed_at_ms = 0;  // time of the latest transition, ms since epoch
+};
+
+struct PresenceFanoutStats {
+    uint64_t transitions = 0;  // user-level online/offline transitions reported
+    uint64_t coalesced = 0;    // users whose transitions cancelled out, here or across gateways
+    uint64_t published = 0;    // net presence changes fanned out
+    uint64_t frames = 0;       // sessions that accepted a CMD_USER_ONLINE frame
+};
+
+// Pushes friends' online/offline changes to the friends' sessions.
+//
+// ConnectionManager reports every session bind/unbind; the fan-out records
+// user-level transitions as pending. A background thread flushes every
+// `window`:
+// - a user who went offline and came back (or the reverse) within the window
+//   produces nothing, so reconnects and flapping networks cost no fan-out;
+// - an offline change waits one extra flush, then is dropped if the shared
+//   connection store shows the user online again. A reconnect that lands on
+//   another gateway (hot restart drain, load balancer) is therefore not shown
+//   to friends as offline followed by online;
+// - each remaining change resolves the user's friends once;
+// - every friend gets a single CMD_USER_ONLINE frame per flush carrying all
+//   changes relevant to them, sent through the push path (PushService).
+//   PushService writes only to sessions held by this gateway, so friends
+//   connected elsewhere see the change when they next refresh the friend
+//   list. Presence has no msg_id and is never queued for offline friends:
+//   they read the current state from the friend list when they connect.
+class PresenceFanout final : public PresenceListener {
+public:
+    using FriendResolver = std::function<std::vector<std::string>(const std::string& uid)>;
+    // Delivers an encoded frame to receiver_uid's sessions; returns how many
+    // accepted it. Normally PushService::push_transient.
+    using FrameSender =
+        std::function<std::size_t(const std::string& receiver_uid, const std::string& frame)>;
+    // Whether uid has a session on any gateway right now.
+    using OnlineCheck = std::function<bool(const std::string& uid)>;
+
+    PresenceFanout(FriendResolver friends,
+                   FrameSender sender,
+                   OnlineCheck is_online,
+                   std::chrono::milliseconds window);
+    ~PresenceFanout() override;
+
+    PresenceFanout(const PresenceFanout&) = delete;
+    PresenceFanout& operator=(const PresenceFanout&) = delete;
+
+    void start();
+    // Stops the flush thread; pending changes are dropped since the sessions
+    // they would go to are closing as well.
+    void stop();
+
+    void on_session_added(const std::string& user_id, const std::string& session_id,
+                          bool user_online) override;
+    void on_session_removed(const std::string& user_id, const std::string& session_id,
+                            bool user_offline) override;
+
+    // Flushes pending changes on the calling thread; returns the changes
+    // published. Offline changes first seen by this flush are held for the next.
+    std::size_t flush_now();
+
+    PresenceFanoutStats stats() const;
+
+    // v1 CMD_USER_ONLINE frame carrying a PresenceNotifyRequest.
+    static std::string build_frame(const std::string& receiver_uid,
+                                   const std::vector<PresenceChange>& changes);
+
+private:
+    struct PendingChange {
+        bool was_online = false;  // state before the first transition in the window
+        bool online = false;      // latest state
+        int64_t changed_at_ms = 0;
+        bool held = false;        // offline change already kept back by one flush
+    };
+
+    void record(const std::string& user_id, bool online);
+
+    void run();
+
+    FriendResolver friends_;
+    FrameSender sender_;
+    OnlineCheck is_online_;
+    const std::chrono::milliseconds window_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unordered_map<std::string, PendingChange> pending_;
+    PresenceFanoutStats stats_;
+    bool running_ = false;
+    std::thread worker_;
+};
+
+} // namespace im::gateway
+
+#endif // GATEWAY_PRESENCE_FANOUT_HPP
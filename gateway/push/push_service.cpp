@@ -2,7 +2,10 @@
 
 #include <string>
 
+#include "../../common/network/protobuf_codec.hpp"
+#include "../../common/utils/thread_pool.hpp"
 #include "../http/message_client.hpp"
+#include "delivery_ledger.hpp"
 
 namespace im::gateway {
 
@@ -12,10 +15,10 @@ using im::service::push::PushSessionInfo;
 // --- PushService ---
 
 PushService::PushService(ConnectionManager* conn_mgr,
-                         im::network::WebSocketServer* ws_server,
+                         const im::network::SessionLookup* sessions,
                          std::shared_ptr<MessageClient> msg_client)
     : conn_mgr_(conn_mgr)
-    , ws_server_(ws_server)
+    , sessions_(sessions)
     , msg_client_(std::move(msg_client))
     , runtime_(this, this, this)
 {}
@@ -24,6 +27,30 @@ void PushService::set_fanout_policy(std::unique_ptr<FanoutPolicy> policy) {
     runtime_.set_fanout_policy(std::move(policy));
 }
 
+void PushService::set_offline_outbox(
+    std::shared_ptr<im::service::push::OfflineOutbox> outbox) {
+    runtime_.set_offline_outbox(std::move(outbox));
+}
+
+void PushService::set_pending_source(
+    std::shared_ptr<im::service::push::OfflineOutbox> source) {
+    runtime_.set_pending_source(std::move(source));
+}
+
+void PushService::set_require_client_ack(bool required) {
+    require_client_ack_ = required;
+    runtime_.set_require_client_ack(required);
+}
+
+void PushService::set_delivery_ledger(DeliveryLedger* ledger) {
+    delivery_ledger_ = ledger;
+}
+
+void PushService::drain_offline(const std::string& receiver_uid,
+                                const std::string& session_id) {
+    runtime_.drain_offline(receiver_uid, session_id);
+}
+
 void PushService::push_to_user(const std::string& receiver_uid,
                                uint64_t msg_id,
                                const std::string& content,
@@ -31,6 +58,11 @@ void PushService::push_to_user(const std::string& receiver_uid,
     runtime_.notify_user(receiver_uid, msg_id, content, context);
 }
 
+std::size_t PushService::push_transient(const std::string& receiver_uid,
+                                        const std::string& payload) {
+    return runtime_.push_transient(receiver_uid, payload);
+}
+
 void PushService::notify_user(const std::string& receiver_uid,
                               uint64_t msg_id,
                               const std::string& content,
@@ -58,24 +90,76 @@ std::vector<PushSessionInfo> PushService::get_sessions(const std::string& receiv
 
 bool PushService::send_payload(const std::string& session_id,
                                const std::string& payload) {
-    if (!ws_server_) {
+    return send_messages(session_id, payload, {});
+}
+
+bool PushService::send_messages(const std::string& session_id,
+                                const std::string& payload,
+                                const std::vector<uint64_t>& msg_ids) {
+    if (!sessions_) {
         return false;
     }
 
-    auto session = ws_server_->get_session(session_id);
+    auto session = sessions_->get_session(session_id);
     if (!session) {
         return false;
     }
 
-    session->send(payload);
+    // 推送按接收者编码一次 v1 帧，协商了 v2 的连接在投递前转换
+    const bool v2 = session->wire_version() == im::network::WireVersion::V2;
+    std::string frame;
+    if (v2 && !im::network::ProtobufCodec::transcodeToV2(payload, frame)) {
+        return false;
+    }
+
+    // 先记账再入队，客户端对这一帧的 ACK 不会早于记录
+    if (delivery_ledger_) {
+        delivery_ledger_->record(session_id, msg_ids);
+    }
+    session->send(v2 ? frame : payload);
     return true;
 }
 
+std::size_t PushService::pending_payloads(const std::string& session_id) {
+    if (!sessions_) {
+        return 0;
+    }
+
+    auto session = sessions_->get_session(session_id);
+    return session ? session->pending_sends() : 0;
+}
+
+void PushService::when_writable(const std::string& session_id,
+                                std::size_t window,
+                                std::function<void(bool)> resume) {
+    auto session = sessions_ ? sessions_->get_session(session_id) : nullptr;
+    if (!session) {
+        resume(false);
+        return;
+    }
+    // 回调在会话的 I/O 线程触发，补推要读 Redis/数据库，转到线程池继续
+    session->when_writable(window, [resume = std::move(resume)](bool writable) {
+        im::utils::ThreadPool::GetInstance().Enqueue(
+            [resume, writable]() { resume(writable); });
+    });
+}
+
 bool PushService::mark_delivered(uint64_t msg_id, int64_t delivered_time) {
     if (!msg_client_) {
         return false;
     }
+    if (require_client_ack_) {
+        return true;
+    }
     return msg_client_->mark_delivered(msg_id, delivered_time);
 }
 
+std::size_t PushService::mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                              int64_t delivered_time) {
+    if (!msg_client_ || require_client_ack_) {
+        return 0;
+    }
+    return msg_client_->mark_delivered_batch(msg_ids, delivered_time);
+}
+
 } // namespace im::gateway
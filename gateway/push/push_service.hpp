@@ -2,18 +2,21 @@
 #define GATEWAY_PUSH_SERVICE_HPP
 
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "connection_manager/connection_manager.hpp"
-#include "../../common/network/websocket_server.hpp"
+#include "../../common/network/client_session.hpp"
 #include "../../services/push/fanout_policy.hpp"
 #include "../../services/push/push_notifier.hpp"
 #include "../../services/push/push_runtime.hpp"
 
 namespace im::gateway {
+class DeliveryLedger;
 class MessageClient;
 
 class PushService : public im::service::push::PushNotifier,
@@ -22,11 +25,33 @@ class PushService : public im::service::push::PushNotifier,
                     public im::service::push::PushDeliveryMarker {
 public:
     PushService(ConnectionManager* conn_mgr,
-                im::network::WebSocketServer* ws_server,
+                const im::network::SessionLookup* sessions,
                 std::shared_ptr<MessageClient> msg_client);
 
     void set_fanout_policy(std::unique_ptr<im::service::push::FanoutPolicy> policy);
 
+    void set_offline_outbox(std::shared_ptr<im::service::push::OfflineOutbox> outbox);
+
+    void set_pending_source(std::shared_ptr<im::service::push::OfflineOutbox> source);
+
+    // Switches delivered state to client acks: pushes (local runtime or the
+    // remote push server's MarkMessageDelivered callback) stop writing it and
+    // CMD_MESSAGE_DELIVERED acks become the only writer.
+    void set_require_client_ack(bool required);
+
+    // Records which message ids go to which session so a client ack only
+    // covers what that session was actually sent. Set together with client
+    // acks; nullptr disables recording.
+    void set_delivery_ledger(DeliveryLedger* ledger);
+
+    // Streams queued and still-undelivered messages to a session that just
+    // bound to receiver_uid as CMD_PUSH_BATCH_MESSAGE frames. Reads the
+    // outbox/store, so call off the I/O threads; once the session's send
+    // window is full the rest continues on the thread pool after its writes
+    // complete.
+    void drain_offline(const std::string& receiver_uid,
+                       const std::string& session_id);
+
     // Push a CMD_PUSH_MESSAGE to the recipient's selected sessions.
     //
     // Best-effort semantics:
@@ -40,6 +65,11 @@ public:
                       const im::service::push::PushContext& context =
                           im::service::push::PushContext{});
 
+    // Best-effort delivery of a frame that is not a persisted message, such
+    // as a presence change; see PushRuntime::push_transient.
+    std::size_t push_transient(const std::string& receiver_uid,
+                               const std::string& payload);
+
     void notify_user(const std::string& receiver_uid,
                      uint64_t msg_id,
                      const std::string& content,
@@ -52,12 +82,28 @@ public:
     bool send_payload(const std::string& session_id,
                       const std::string& payload) override;
 
+    bool send_messages(const std::string& session_id,
+                       const std::string& payload,
+                       const std::vector<uint64_t>& msg_ids) override;
+
+    std::size_t pending_payloads(const std::string& session_id) override;
+
+    // Resumes on the thread pool, never on the session's I/O thread.
+    void when_writable(const std::string& session_id,
+                       std::size_t window,
+                       std::function<void(bool)> resume) override;
+
     bool mark_delivered(uint64_t msg_id, int64_t delivered_time) override;
 
+    std::size_t mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                     int64_t delivered_time) override;
+
 private:
     ConnectionManager* conn_mgr_;
-    im::network::WebSocketServer* ws_server_;
+    const im::network::SessionLookup* sessions_;  // WebSocket 与原生 TCP 连接
     std::shared_ptr<MessageClient> msg_client_;
+    bool require_client_ack_ = false;
+    DeliveryLedger* delivery_ledger_ = nullptr;
     im::service::push::PushRuntime runtime_;
 };
 
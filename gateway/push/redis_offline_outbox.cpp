@@ -0,0 +1,128 @@
+#include "redis_offline_outbox.hpp"
+
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "../../common/database/redis/redis_mgr.hpp"
+#include "../../common/utils/log_manager.hpp"
+
+namespace im::gateway {
+
+using im::db::RedisManager;
+using im::service::push::OfflineEntry;
+using json = nlohmann::json;
+
+namespace {
+
+std::string encode_entry(const OfflineEntry& entry) {
+    json j;
+    j["msg_id"] = entry.msg_id;
+    j["content"] = entry.content;
+    j["sender_uid"] = entry.context.sender_uid;
+    j["conversation_type"] = entry.context.conversation_type;
+    j["conversation_id"] = entry.context.conversation_id;
+    return j.dump();
+}
+
+bool decode_entry(const std::string& raw, OfflineEntry& entry) {
+    auto j = json::parse(raw, nullptr, false);
+    if (j.is_discarded() || !j.is_object()) {
+        return false;
+    }
+    entry.msg_id = j.value("msg_id", uint64_t{0});
+    entry.content = j.value("content", "");
+    entry.context.sender_uid = j.value("sender_uid", "");
+    entry.context.conversation_type = j.value("conversation_type", "");
+    entry.context.conversation_id = j.value("conversation_id", "");
+    return entry.msg_id != 0;
+}
+
+// ZADD + cap + TTL in one round trip; ARGV: score, member, max_entries, ttl_seconds.
+constexpr const char* kAppendScript = R"(
+redis.call('ZADD', KEYS[1], ARGV[1], ARGV[2])
+local cap = tonumber(ARGV[3])
+if cap > 0 then
+  redis.call('ZREMRANGEBYRANK', KEYS[1], 0, -cap - 1)
+end
+local ttl = tonumber(ARGV[4])
+if ttl > 0 then
+  redis.call('EXPIRE', KEYS[1], ttl)
+end
+return 1
+)";
+
+} // namespace
+
+RedisOfflineOutbox::RedisOfflineOutbox(RedisOfflineOutboxOptions options)
+    : options_(std::move(options))
+    , logger_(im::utils::LogManager::GetLogger("offline_outbox"))
+{}
+
+std::string RedisOfflineOutbox::outbox_key(const std::string& receiver_uid) {
+    // Hash tag keeps each user's outbox addressable as a single key in Cluster mode.
+    return "user:outbox:{" + receiver_uid + "}";
+}
+
+bool RedisOfflineOutbox::append(const std::string& receiver_uid, const OfflineEntry& entry) {
+    try {
+        const auto key = outbox_key(receiver_uid);
+        const std::vector<std::string> args{
+            std::to_string(entry.msg_id), encode_entry(entry),
+            std::to_string(options_.max_entries_per_user),
+            std::to_string(options_.ttl_seconds)};
+        RedisManager::GetInstance().execute([&](auto& redis) {
+            return redis.eval(kAppendScript, key, args);
+        });
+        return true;
+    } catch (const std::exception& e) {
+        logger_->warn("Offline outbox append failed for user {}: {}", receiver_uid, e.what());
+        return false;
+    }
+}
+
+std::vector<OfflineEntry> RedisOfflineOutbox::peek(const std::string& receiver_uid,
+                                                   uint64_t after_msg_id,
+                                                   std::size_t limit) {
+    std::vector<OfflineEntry> entries;
+    if (limit == 0) {
+        return entries;
+    }
+
+    try {
+        const auto raw = RedisManager::GetInstance().execute([&](auto& redis) {
+            return redis.zrangebyscore(outbox_key(receiver_uid),
+                                       "(" + std::to_string(after_msg_id), "+inf",
+                                       0, static_cast<int64_t>(limit));
+        });
+        entries.reserve(raw.size());
+        for (const auto& member : raw) {
+            OfflineEntry entry;
+            if (decode_entry(member, entry)) {
+                entries.push_back(std::move(entry));
+            }
+        }
+    } catch (const std::exception& e) {
+        logger_->warn("Offline outbox read failed for user {}: {}", receiver_uid, e.what());
+    }
+    return entries;
+}
+
+void RedisOfflineOutbox::ack_range(const std::string& receiver_uid,
+                                   uint64_t from_msg_id,
+                                   uint64_t to_msg_id) {
+    try {
+        RedisManager::GetInstance().execute([&](auto& redis) {
+            return redis.zremrangebyscore(outbox_key(receiver_uid),
+                                          std::to_string(from_msg_id),
+                                          std::to_string(to_msg_id));
+        });
+    } catch (const std::exception& e) {
+        logger_->warn("Offline outbox trim failed for user {}: {}", receiver_uid, e.what());
+    }
+}
+
+} // namespace im::gateway
@@ -0,0 +1,51 @@
+#ifndef GATEWAY_REDIS_OFFLINE_OUTBOX_HPP
+#define GATEWAY_REDIS_OFFLINE_OUTBOX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <spdlog/logger.h>
+
+#include "../../services/push/offline_outbox.hpp"
+
+namespace im::gateway {
+
+struct RedisOfflineOutboxOptions {
+    // Oldest entries beyond this are trimmed; offline pull still finds them.
+    std::size_t max_entries_per_user = 1000;
+    int ttl_seconds = 7 * 24 * 3600;
+};
+
+// OfflineOutbox backed by one Redis sorted set per user,
+// "user:outbox:{uid}" (the braces are a Cluster hash tag), scored by msg_id
+// with a JSON member per message.
+// Redis failures are logged and reported as empty/false; callers fall back to
+// the PostgreSQL offline pull.
+class RedisOfflineOutbox final : public im::service::push::OfflineOutbox {
+public:
+    explicit RedisOfflineOutbox(RedisOfflineOutboxOptions options = {});
+
+    bool append(const std::string& receiver_uid,
+                const im::service::push::OfflineEntry& entry) override;
+
+    std::vector<im::service::push::OfflineEntry> peek(const std::string& receiver_uid,
+                                                      uint64_t after_msg_id,
+                                                      std::size_t limit) override;
+
+    void ack_range(const std::string& receiver_uid,
+                   uint64_t from_msg_id,
+                   uint64_t to_msg_id) override;
+
+    static std::string outbox_key(const std::string& receiver_uid);
+
+private:
+    RedisOfflineOutboxOptions options_;
+    std::shared_ptr<spdlog::logger> logger_;
+};
+
+} // namespace im::gateway
+
+#endif // GATEWAY_REDIS_OFFLINE_OUTBOX_HPP
@@ -0,0 +1,93 @@
+#include "delivery_ack_coalescer.hpp"
+
+#include <exception>
+#include <utility>
+
+#include "../../common/utils/log_manager.hpp"
+
+namespace im::gateway {
+
+using im::utils::LogManager;
+
+DeliveryAckCoalescer::DeliveryAckCoalescer(FlushFn flush, std::chrono::milliseconds window)
+    : flush_(std::move(flush))
+    , window_(window) {}
+
+DeliveryAckCoalescer::~DeliveryAckCoalescer() {
+    stop();
+}
+
+void DeliveryAckCoalescer::start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    worker_ = std::thread([this] { run(); });
+}
+
+void DeliveryAckCoalescer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    flush_now();
+}
+
+void DeliveryAckCoalescer::ack(const std::string& uid, const std::vector<uint64_t>& msg_ids) {
+    if (uid.empty() || msg_ids.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.acks;
+    auto& pending = pending_[uid];
+    pending.insert(pending.end(), msg_ids.begin(), msg_ids.end());
+}
+
+std::size_t DeliveryAckCoalescer::flush_now() {
+    std::unordered_map<std::string, std::vector<uint64_t>> batch;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        batch.swap(pending_);
+        stats_.flushes += batch.size();
+    }
+
+    for (const auto& [uid, msg_ids] : batch) {
+        try {
+            flush_(uid, msg_ids);
+        } catch (const std::exception& e) {
+            // The messages stay SENT; connect-time catch-up, forced on with
+            // client acks, re-sends them on the next connection.
+            LogManager::GetLogger("message_ws_handler")
+                ->warn("Delivery ack flush for user {} failed: {}", uid, e.what());
+        }
+    }
+    return batch.size();
+}
+
+DeliveryAckStats DeliveryAckCoalescer::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void DeliveryAckCoalescer::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        cv_.wait_for(lock, window_, [this] { return !running_; });
+        if (!running_) {
+            break;
+        }
+        lock.unlock();
+        flush_now();
+        lock.lock();
+    }
+}
+
+} // namespace im::gateway
@@ -0,0 +1,65 @@
+#ifndef GATEWAY_DELIVERY_ACK_COALESCER_HPP
+#define GATEWAY_DELIVERY_ACK_COALESCER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace im::gateway {
+
+struct DeliveryAckStats {
+    uint64_t acks = 0;     // client acks received
+    uint64_t flushes = 0;  // per-user writes issued
+};
+
+// Coalesces client delivery acks per user.
+//
+// Each ack carries the ids its session was sent up to the acked frame (see
+// DeliveryLedger). A background thread flushes every `window`, issuing one
+// write per user that acked during the window instead of one per ack.
+// stop() flushes whatever is pending before returning.
+class DeliveryAckCoalescer {
+public:
+    using FlushFn =
+        std::function<void(const std::string& uid, const std::vector<uint64_t>& msg_ids)>;
+
+    DeliveryAckCoalescer(FlushFn flush, std::chrono::milliseconds window);
+    ~DeliveryAckCoalescer();
+
+    DeliveryAckCoalescer(const DeliveryAckCoalescer&) = delete;
+    DeliveryAckCoalescer& operator=(const DeliveryAckCoalescer&) = delete;
+
+    void start();
+    void stop();
+
+    void ack(const std::string& uid, const std::vector<uint64_t>& msg_ids);
+
+    // Flushes pending acks on the calling thread; returns the users flushed.
+    std::size_t flush_now();
+
+    DeliveryAckStats stats() const;
+
+private:
+    void run();
+
+    FlushFn flush_;
+    const std::chrono::milliseconds window_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::unordered_map<std::string, std::vector<uint64_t>> pending_;
+    DeliveryAckStats stats_;
+    bool running_ = false;
+    std::thread worker_;
+};
+
+} // namespace im::gateway
+
+#endif // GATEWAY_DELIVERY_ACK_COALESCER_HPP
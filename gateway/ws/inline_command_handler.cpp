@@ -0,0 +1,141 @@
+#include "inline_command_handler.hpp"
+
+#include <chrono>
+#include <cstring>
+
+#include "../../common/network/protobuf_codec.hpp"
+#include "../../common/network/client_session.hpp"
+#include "../../common/proto/base.pb.h"
+#include "../../common/proto/command.pb.h"
+#include "../../common/utils/service_identity.hpp"
+
+namespace im::gateway {
+
+using im::network::ConnectionIdentity;
+using im::network::ProtobufCodec;
+using im::network::WireVersion;
+using im::network::kFrameHeaderV2Size;
+using im::utils::ServiceIdentityManager;
+
+namespace {
+
+// Commands answered inline. Each gets a plain BaseResponse{SUCCESS}.
+constexpr uint32_t kInlineCommandIds[] = {
+    im::command::CMD_HEARTBEAT,
+};
+
+uint32_t read_le32(const char* in) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(in);
+    return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+           (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+} // anonymous namespace
+
+InlineCommandHandler::InlineCommandHandler(
+    std::chrono::steady_clock::duration revocation_recheck)
+    : revocation_recheck_(revocation_recheck) {
+    im::base::BaseResponse success;
+    success.set_error_code(im::base::ErrorCode::SUCCESS);
+
+    for (uint32_t cmd_id : kInlineCommandIds) {
+        im::base::IMHeader header;
+        header.set_cmd_id(cmd_id);
+        InlineCommand command{cmd_id, {}};
+        if (ProtobufCodec::encode(header, success, command.v2_response, WireVersion::V2)) {
+            commands_.push_back(std::move(command));
+        }
+    }
+}
+
+const InlineCommandHandler::InlineCommand* InlineCommandHandler::find(uint32_t cmd_id) const {
+    for (const auto& command : commands_) {
+        if (command.cmd_id == cmd_id) {
+            return &command;
+        }
+    }
+    return nullptr;
+}
+
+bool InlineCommandHandler::identity_valid(im::network::ClientSession& session) const {
+    const ConnectionIdentity& identity = session.identity();
+    if (identity.user_id.empty() ||
+        identity.expire_time <= std::chrono::system_clock::time_point{} ||
+        std::chrono::system_clock::now() >= identity.expire_time) {
+        return false;
+    }
+    if (revocation_recheck_ <= std::chrono::steady_clock::duration::zero()) {
+        return true;
+    }
+    if (identity.token_id.empty()) {
+        return false;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (now - identity.revocation_checked_at < revocation_recheck_) {
+        return true;
+    }
+    // Due: this frame goes through the regular path, which checks revocation
+    // off the I/O thread and closes the connection if the token is revoked.
+    session.mark_revocation_checked(now);
+    return false;
+}
+
+bool InlineCommandHandler::try_handle_frame(im::network::ClientSession& session,
+                                            const std::string& frame) {
+    // Plain (non-batch) well-formed v2 frame only; the body is not inspected.
+    if (session.wire_version() != WireVersion::V2 || frame.size() < kFrameHeaderV2Size ||
+        static_cast<uint8_t>(frame[0]) != static_cast<uint8_t>(WireVersion::V2) ||
+        frame[1] != 0 ||
+        read_le32(frame.data() + im::network::kFrameHeaderV2BodyLengthOffset) !=
+            frame.size() - kFrameHeaderV2Size) {
+        return false;
+    }
+
+    const InlineCommand* command =
+        find(read_le32(frame.data() + im::network::kFrameHeaderV2CmdIdOffset));
+    if (!command || !identity_valid(session)) {
+        return false;
+    }
+
+    // seq is little-endian on both sides, copy the request bytes verbatim.
+    std::string response = command->v2_response;
+    std::memcpy(response.data() + im::network::kFrameHeaderV2SeqOffset,
+                frame.data() + im::network::kFrameHeaderV2SeqOffset, sizeof(uint32_t));
+    session.send(response);
+    handled_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool InlineCommandHandler::try_handle_message(im::network::ClientSession& session,
+                                              const im::base::IMHeader& header) {
+    if (!find(header.cmd_id()) || !identity_valid(session)) {
+        return false;
+    }
+
+    // v1 frames carry their own token/device; anything that does not match the
+    // connection goes through the regular, verifying path.
+    const ConnectionIdentity& identity = session.identity();
+    if (header.token() != identity.token ||
+        (!header.device_id().empty() && header.device_id() != identity.device_id)) {
+        return false;
+    }
+
+    im::base::BaseResponse success;
+    success.set_error_code(im::base::ErrorCode::SUCCESS);
+    im::base::IMHeader response_header;
+    ProtobufCodec::fillReturnHeader(header,
+                                    ServiceIdentityManager::getInstance().getDeviceId(),
+                                    ServiceIdentityManager::getInstance().getPlatformInfo(),
+                                    &response_header);
+    response_header.set_cmd_id(header.cmd_id());
+
+    std::string response;
+    if (!ProtobufCodec::encode(response_header, success, response, session.wire_version())) {
+        return false;
+    }
+    session.send(response);
+    handled_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+} // namespace im::gateway
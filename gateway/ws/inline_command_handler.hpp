@@ -0,0 +1,82 @@
+#ifndef GATEWAY_INLINE_COMMAND_HANDLER_HPP
+#define GATEWAY_INLINE_COMMAND_HANDLER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace im::base {
+class IMHeader;
+}
+
+namespace im::network {
+class ClientSession;
+struct ConnectionIdentity;
+}
+
+namespace im::gateway {
+
+// Answers a designated set of trivial commands (currently CMD_HEARTBEAT)
+// directly on the session's io_context: no UnifiedMessage, no inflight slot,
+// no ThreadPool hop and no per-frame token verification.
+//
+// Only sessions whose identity was bound at connect time and whose token has
+// not expired qualify. Anything else (unbound session, expired token, a v1
+// header whose token or device differs from the connection's) returns false
+// and the frame takes the regular path, which re-verifies and closes the
+// connection on failure.
+//
+// Revocation needs a Redis lookup, which must not run on the I/O thread.
+// Instead, once every revocation_recheck interval the next frame is handed
+// to the regular path, which checks revocation on the thread pool; frames in
+// between are answered inline. A revoked token is therefore noticed within
+// one interval.
+//
+// v2 frames are recognised from the raw bytes before parsing, and answered
+// by copying a pre-encoded template with only seq patched. v1 frames need the
+// envelope decoded to find cmd_id, so they are checked right after the normal
+// parse (still on the I/O thread) and encoded per frame, since the v1 header
+// carries a timestamp, the echoed token and a CRC.
+class InlineCommandHandler {
+public:
+    // A zero interval never hands frames back for revocation: only expiry is
+    // enforced inline.
+    explicit InlineCommandHandler(
+        std::chrono::steady_clock::duration revocation_recheck = {});
+
+    InlineCommandHandler(const InlineCommandHandler&) = delete;
+    InlineCommandHandler& operator=(const InlineCommandHandler&) = delete;
+
+    // Raw v2 frame, before parsing. Returns true when answered inline.
+    bool try_handle_frame(im::network::ClientSession& session, const std::string& frame);
+
+    // Parsed request header (v1 path). Returns true when answered inline.
+    bool try_handle_message(im::network::ClientSession& session,
+                            const im::base::IMHeader& header);
+
+    uint64_t handled() const { return handled_.load(std::memory_order_relaxed); }
+
+private:
+    struct InlineCommand {
+        uint32_t cmd_id;
+        std::string v2_response;  // BaseResponse{SUCCESS}, seq = 0
+    };
+
+    const InlineCommand* find(uint32_t cmd_id) const;
+
+    // Connection-level auth is still good: identity bound after token
+    // verification, token not expired, and revocation checked within the
+    // last interval. When the check is due it is recorded as done and false
+    // is returned, so this frame's regular path performs it.
+    bool identity_valid(im::network::ClientSession& session) const;
+
+    std::chrono::steady_clock::duration revocation_recheck_;
+    std::vector<InlineCommand> commands_;
+    std::atomic<uint64_t> handled_{0};
+};
+
+} // namespace im::gateway
+
+#endif // GATEWAY_INLINE_COMMAND_HANDLER_HPP
@@ -1,22 +1,23 @@
 #include "message_ws_handler.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <string>
+#include <vector>
 
-#include "../../common/network/protobuf_codec.hpp"
 #include "../../common/utils/log_manager.hpp"
-#include "../../common/utils/service_identity.hpp"
+#include "../../services/push/offline_outbox.hpp"
 #include "../../services/push/push_notifier.hpp"
 #include "../http/message_client.hpp"
+#include "delivery_ack_coalescer.hpp"
+#include "../push/delivery_ledger.hpp"
 #include "../../services/odb/message.hpp"
 
 namespace im::gateway {
 
 using im::base::ErrorCode;
-using im::network::ProtobufCodec;
 using im::service::message::SendRequest;
 using im::utils::LogManager;
-using im::utils::ServiceIdentityManager;
 
 namespace {
 
@@ -26,30 +27,6 @@ int64_t now_ms() {
     ).count();
 }
 
-// Build an encoded SendMessageResponse with the given error code and message,
-// preserving the request header's sequence identity.
-std::string encode_error_response(const im::base::IMHeader& request_header,
-                                  ErrorCode error_code,
-                                  const std::string& error_message)
-{
-    im::message::SendMessageResponse resp;
-    resp.mutable_base()->set_error_code(error_code);
-    if (!error_message.empty()) {
-        resp.mutable_base()->set_error_message(error_message);
-    }
-
-    base::IMHeader response_header = ProtobufCodec::returnHeaderBuilder(
-        request_header,
-        ServiceIdentityManager::getInstance().getDeviceId(),
-        ServiceIdentityManager::getInstance().getPlatformInfo());
-
-    std::string encoded;
-    if (ProtobufCodec::encode(response_header, resp, encoded)) {
-        return encoded;
-    }
-    return "";
-}
-
 } // anonymous namespace
 
 MessageWsHandler::MessageWsHandler(
@@ -64,145 +41,137 @@ MessageWsHandler::MessageWsHandler(
     logger_ = LogManager::GetLogger("message_ws_handler");
 }
 
-ProcessorResult MessageWsHandler::handle_send(const UnifiedMessage& msg) {
+HandlerStatus MessageWsHandler::authenticate(const UnifiedMessage& msg,
+                                             UserTokenInfo& user) const {
+    if (!msg.is_websocket()) {
+        return HandlerStatus::no_reply(ErrorCode::INVALID_REQUEST,
+                                       "WS handler called for non-WebSocket message");
+    }
+
+    const auto& header = msg.get_header();
+    if (!auth_mgr_->verify_access_token(header.token(), user)) {
+        return HandlerStatus::error(ErrorCode::AUTH_FAILED, "Invalid or expired access token");
+    }
+
+    if (!header.device_id().empty() && header.device_id() != user.device_id) {
+        logger_->warn("Device ID mismatch: client={}, token={}",
+                      header.device_id(), user.device_id);
+        return HandlerStatus::error(ErrorCode::AUTH_FAILED, "Device ID mismatch");
+    }
+    return HandlerStatus::ok();
+}
+
+HandlerStatus MessageWsHandler::on_send(const UnifiedMessage& msg,
+                                        const UserTokenInfo& token_user,
+                                        const im::message::SendMessageRequest& send_req,
+                                        im::message::SendMessageResponse& send_resp) const {
+    const auto& header = msg.get_header();
+
+    // 1. Validate receiver. v2 frames carry no header.to_uid; the receiver
+    //    comes from the message body instead.
+    const auto& body = send_req.body();
+    const std::string& receiver_uid =
+        header.to_uid().empty() ? body.receiver_uid() : header.to_uid();
+    if (receiver_uid.empty()) {
+        return HandlerStatus::error(ErrorCode::PARAM_ERROR, "Missing receiver UID");
+    }
+
+    // 2. Validate content.
+    const std::string& content = body.content();
+    if (content.empty()) {
+        return HandlerStatus::error(ErrorCode::PARAM_ERROR, "Missing message content");
+    }
+
+    // 3. Persist the message. The sender identity comes from the verified
+    //    token, NOT from header.from_uid or any client-supplied field.
+    SendRequest store_req;
+    store_req.sender_uid = token_user.user_id;
+    store_req.receiver_uid = receiver_uid;
+    store_req.content = content;
+    store_req.msg_type = im::service::message::MessageType::TEXT;
+    store_req.now_ms = now_ms();
+
+    auto result = msg_client_->send_text_message(store_req);
+    if (!result.ok) {
+        logger_->warn("Persistence failed: {} ({})", result.message, result.error_code);
+        return HandlerStatus::error(ErrorCode::SERVER_ERROR, result.message);
+    }
+
+    // 4. Fill the SendMessageResponse; base and encoding are done by the wrapper.
+    im::message::MessageBody* response_body = send_resp.mutable_message();
+    response_body->set_message_id(std::to_string(result.data.msg_id));
+    response_body->set_type(static_cast<im::message::MessageType>(result.data.msg_type));
+    response_body->set_content(result.data.content);
+    response_body->set_is_recalled(false);
+    response_body->set_is_read(false);
+
+    logger_->info("WS send: token_user={} -> {} (msg_id={}, client_from_uid={})",
+                  token_user.user_id, receiver_uid, result.data.msg_id, header.from_uid());
+
+    // 5. Delegate push through the boundary (best-effort, does not affect ack).
+    if (push_notifier_) {
+        im::service::push::PushContext context;
+        context.sender_uid = token_user.user_id;
+        context.conversation_type = "direct";
+        context.conversation_id = token_user.user_id;
+        push_notifier_->notify_user(receiver_uid, result.data.msg_id, content, context);
+    }
+
+    return HandlerStatus::ok();
+}
+
+HandlerStatus MessageWsHandler::on_delivered_ack(
+    const UnifiedMessage& msg,
+    const UserTokenInfo& token_user,
+    const im::message::MarkMessageDeliveredRequest& ack_req,
+    im::message::MarkMessageDeliveredResponse& /*resp*/) const {
+    // msg_id is cumulative over this session's frames: everything queued to
+    // the session up to and including the frame carrying it has arrived.
+    // Messages never sent to this session, or still queued behind it, are
+    // not covered.
+    if (ack_req.msg_id() == 0) {
+        return HandlerStatus::error(ErrorCode::PARAM_ERROR, "Missing or invalid msg_id");
+    }
+
+    const auto msg_ids = delivery_ledger_
+        ? delivery_ledger_->take_acked(msg.get_session_id(), ack_req.msg_id())
+        : std::vector<uint64_t>{ack_req.msg_id()};
+    if (msg_ids.empty()) {
+        // Already acked, or never pushed to this session.
+        return HandlerStatus::no_reply();
+    }
+
+    if (ack_coalescer_) {
+        ack_coalescer_->ack(token_user.user_id, msg_ids);
+    } else {
+        msg_client_->mark_delivered_ids(token_user.user_id, msg_ids, now_ms());
+    }
+    // Ledger order is queue order, not msg_id order. Ids inside the range
+    // that this session never got are still pending in the message store
+    // and come back through catch-up.
+    if (offline_outbox_) {
+        const auto [lo, hi] = std::minmax_element(msg_ids.begin(), msg_ids.end());
+        offline_outbox_->ack_range(token_user.user_id, *lo, *hi);
+    }
+
+    // Acks are fire-and-forget; replying would double the frame count.
+    return HandlerStatus::no_reply();
+}
+
+ProcessorResult MessageWsHandler::handle_send(const UnifiedMessage& msg) const {
+    auto auth = [this](const UnifiedMessage& m, UserTokenInfo& user) {
+        return authenticate(m, user);
+    };
+    auto fn = [this](const UnifiedMessage& m, const UserTokenInfo& user,
+                     const im::message::SendMessageRequest& req,
+                     im::message::SendMessageResponse& resp) {
+        return on_send(m, user, req, resp);
+    };
     try {
-        if (!msg.is_websocket()) {
-            return ProcessorResult(ErrorCode::INVALID_REQUEST,
-                                   "WS handler called for non-WebSocket message",
-                                   "", "");
-        }
-
-        const auto& header = msg.get_header();
-
-        // 1. Validate cmd_id.
-        if (msg.get_cmd_id() != im::command::CMD_SEND_MESSAGE) {
-            logger_->warn("Unexpected cmd_id: {}, expected CMD_SEND_MESSAGE(2001)",
-                          msg.get_cmd_id());
-            std::string error_pb = encode_error_response(
-                header, ErrorCode::INVALID_REQUEST,
-                "Unexpected command ID, expected CMD_SEND_MESSAGE");
-            return ProcessorResult(ErrorCode::INVALID_REQUEST,
-                                   "Unexpected cmd_id", error_pb, "");
-        }
-
-        // 2. Verify the access token and derive sender identity.
-        UserTokenInfo token_user;
-        if (!auth_mgr_->verify_access_token(header.token(), token_user)) {
-            std::string error_pb = encode_error_response(
-                header, ErrorCode::AUTH_FAILED,
-                "Invalid or expired access token");
-            return ProcessorResult(ErrorCode::AUTH_FAILED,
-                                   "Invalid or expired access token", error_pb, "");
-        }
-
-        // 3. Reject if the client-supplied device_id does not match the token.
-        if (!header.device_id().empty() && header.device_id() != token_user.device_id) {
-            logger_->warn("Device ID mismatch: client={}, token={}",
-                          header.device_id(), token_user.device_id);
-            std::string error_pb = encode_error_response(
-                header, ErrorCode::AUTH_FAILED,
-                "Device ID mismatch");
-            return ProcessorResult(ErrorCode::AUTH_FAILED,
-                                   "Device ID mismatch", error_pb, "");
-        }
-
-        // 4. Validate protobuf type name.
-        if (msg.get_protobuf_type_name() != "im.message.SendMessageRequest") {
-            logger_->warn("Unexpected protobuf type: {}, expected im.message.SendMessageRequest",
-                          msg.get_protobuf_type_name());
-            std::string error_pb = encode_error_response(
-                header, ErrorCode::INVALID_REQUEST,
-                "Unexpected protobuf type, expected im.message.SendMessageRequest");
-            return ProcessorResult(ErrorCode::INVALID_REQUEST,
-                                   "Wrong protobuf type", error_pb, "");
-        }
-
-        // 5. Parse the SendMessageRequest from the protobuf payload.
-        im::message::SendMessageRequest send_req;
-        if (!send_req.ParseFromString(msg.get_protobuf_payload())) {
-            std::string error_pb = encode_error_response(
-                header, ErrorCode::INVALID_REQUEST,
-                "Failed to parse SendMessageRequest");
-            return ProcessorResult(ErrorCode::INVALID_REQUEST,
-                                   "Failed to parse SendMessageRequest", error_pb, "");
-        }
-
-        // 6. Validate receiver.
-        std::string receiver_uid = header.to_uid();
-        if (receiver_uid.empty()) {
-            std::string error_pb = encode_error_response(
-                header, ErrorCode::PARAM_ERROR,
-                "Missing receiver UID");
-            return ProcessorResult(ErrorCode::PARAM_ERROR,
-                                   "Missing receiver UID", error_pb, "");
-        }
-
-        // 7. Validate content (from the protobuf body, or fall back to header).
-        const auto& body = send_req.body();
-        std::string content = body.content();
-        if (content.empty()) {
-            std::string error_pb = encode_error_response(
-                header, ErrorCode::PARAM_ERROR,
-                "Missing message content");
-            return ProcessorResult(ErrorCode::PARAM_ERROR,
-                                   "Missing message content", error_pb, "");
-        }
-
-        // 8. Persist the message. The sender identity comes from the verified
-        //    token, NOT from header.from_uid or any client-supplied field.
-        SendRequest store_req;
-        store_req.sender_uid = token_user.user_id;
-        store_req.receiver_uid = receiver_uid;
-        store_req.content = content;
-        store_req.msg_type = im::service::message::MessageType::TEXT;
-        store_req.now_ms = now_ms();
-
-        auto result = msg_client_->send_text_message(store_req);
-        if (!result.ok) {
-            logger_->warn("Persistence failed: {} ({})", result.message, result.error_code);
-            std::string error_pb = encode_error_response(
-                header, ErrorCode::SERVER_ERROR, result.message);
-            return ProcessorResult(ErrorCode::SERVER_ERROR, result.message, error_pb, "");
-        }
-
-        // 9. Build SendMessageResponse protobuf.
-        im::message::SendMessageResponse send_resp;
-        send_resp.mutable_base()->set_error_code(ErrorCode::SUCCESS);
-        send_resp.mutable_base()->set_error_message("");
-        im::message::MessageBody* response_body = send_resp.mutable_message();
-        response_body->set_message_id(std::to_string(result.data.msg_id));
-        response_body->set_type(static_cast<im::message::MessageType>(result.data.msg_type));
-        response_body->set_content(result.data.content);
-        response_body->set_is_recalled(false);
-        response_body->set_is_read(false);
-
-        base::IMHeader response_header = ProtobufCodec::returnHeaderBuilder(
-            header,
-            ServiceIdentityManager::getInstance().getDeviceId(),
-            ServiceIdentityManager::getInstance().getPlatformInfo());
-
-        std::string protobuf_response;
-        if (!ProtobufCodec::encode(response_header, send_resp, protobuf_response)) {
-            logger_->error("Failed to encode SendMessageResponse");
-            std::string error_pb = encode_error_response(
-                header, ErrorCode::SERVER_ERROR, "Failed to encode response");
-            return ProcessorResult(ErrorCode::SERVER_ERROR,
-                                   "Failed to encode response", error_pb, "");
-        }
-
-        logger_->info("WS send: token_user={} -> {} (msg_id={}, client_from_uid={})",
-                      token_user.user_id, receiver_uid, result.data.msg_id, header.from_uid());
-
-        // 10. Delegate push through the boundary (best-effort, does not affect ack).
-        if (push_notifier_) {
-            im::service::push::PushContext context;
-            context.sender_uid = token_user.user_id;
-            context.conversation_type = "direct";
-            context.conversation_id = token_user.user_id;
-            push_notifier_->notify_user(receiver_uid, result.data.msg_id, content, context);
-        }
-
-        return ProcessorResult(0, "", protobuf_response, "");
+        return invoke_authenticated_handler<im::command::CMD_SEND_MESSAGE,
+                                            im::message::SendMessageRequest,
+                                            im::message::SendMessageResponse,
+                                            UserTokenInfo>(msg, auth, fn);
     } catch (const std::exception& e) {
         logger_->error("Exception in handle_send: {}", e.what());
         return ProcessorResult(ErrorCode::SERVER_ERROR,
@@ -210,4 +179,25 @@ ProcessorResult MessageWsHandler::handle_send(const UnifiedMessage& msg) {
     }
 }
 
+ProcessorResult MessageWsHandler::handle_delivered_ack(const UnifiedMessage& msg) const {
+    auto auth = [this](const UnifiedMessage& m, UserTokenInfo& user) {
+        return authenticate(m, user);
+    };
+    auto fn = [this](const UnifiedMessage& m, const UserTokenInfo& user,
+                     const im::message::MarkMessageDeliveredRequest& req,
+                     im::message::MarkMessageDeliveredResponse& resp) {
+        return on_delivered_ack(m, user, req, resp);
+    };
+    try {
+        return invoke_authenticated_handler<im::command::CMD_MESSAGE_DELIVERED,
+                                            im::message::MarkMessageDeliveredRequest,
+                                            im::message::MarkMessageDeliveredResponse,
+                                            UserTokenInfo>(msg, auth, fn);
+    } catch (const std::exception& e) {
+        logger_->error("Exception in handle_delivered_ack: {}", e.what());
+        return ProcessorResult(ErrorCode::SERVER_ERROR,
+                               std::string("Exception: ") + e.what(), "", "");
+    }
+}
+
 } // namespace im::gateway
@@ -12,18 +12,22 @@
 #include "auth/multi_platform_auth.hpp"
 #include "message_processor/unified_message.hpp"
 #include "message_processor/message_processor.hpp"
+#include "message_processor/typed_handler.hpp"
 
 namespace im::service::push {
+class OfflineOutbox;
 class PushNotifier;
 }
 
 namespace im::gateway {
+class DeliveryAckCoalescer;
+class DeliveryLedger;
 class MessageClient;
 
-// Handles CMD_SEND_MESSAGE over WebSocket.
+// Handles CMD_SEND_MESSAGE and CMD_MESSAGE_DELIVERED over WebSocket.
 //
 // Input is a UnifiedMessage produced by the Gateway parser. The handler
-// validates protobuf type/payload, verifies token-derived sender identity,
+// verifies token-derived sender identity, validates protobuf type/payload,
 // persists through MessageService, returns a protobuf ack, and delegates
 // best-effort recipient delivery to PushService when available.
 class MessageWsHandler {
@@ -33,12 +37,53 @@ public:
         std::shared_ptr<MultiPlatformAuthManager> auth_mgr,
         im::service::push::PushNotifier* push_notifier = nullptr);
 
-    ProcessorResult handle_send(const UnifiedMessage& msg);
+    // Checks the access token and that the client-supplied device_id
+    // matches it. Runs before the payload is type-checked or parsed.
+    HandlerStatus authenticate(const UnifiedMessage& msg, UserTokenInfo& user) const;
+
+    // Typed handlers, registered with register_authenticated_handler<CMD,
+    // Req, Resp, UserTokenInfo> behind authenticate(). The request has
+    // already been type-checked and parsed on the message arena; the
+    // returned status is written into resp.base and encoded by the
+    // typed-handler wrapper.
+    HandlerStatus on_send(const UnifiedMessage& msg, const UserTokenInfo& user,
+                          const im::message::SendMessageRequest& req,
+                          im::message::SendMessageResponse& resp) const;
+
+    // Delivery ack (MarkMessageDeliveredRequest.msg_id = last msg_id the
+    // session received). With a ledger the ack covers the ids this session
+    // was sent up to that frame; without one only msg_id itself. Goes
+    // through the coalescer when set, otherwise writes immediately, and
+    // trims the acked ids from the offline outbox. Success sends no
+    // response frame.
+    HandlerStatus on_delivered_ack(const UnifiedMessage& msg, const UserTokenInfo& user,
+                                   const im::message::MarkMessageDeliveredRequest& req,
+                                   im::message::MarkMessageDeliveredResponse& resp) const;
+
+    // Untyped entry points: run authenticate() and the typed handlers
+    // through the same wrapper used by the dispatch table.
+    ProcessorResult handle_send(const UnifiedMessage& msg) const;
+    ProcessorResult handle_delivered_ack(const UnifiedMessage& msg) const;
+
+    void set_delivery_ack_coalescer(DeliveryAckCoalescer* coalescer) {
+        ack_coalescer_ = coalescer;
+    }
+
+    void set_delivery_ledger(DeliveryLedger* ledger) { delivery_ledger_ = ledger; }
+
+    // With client acks the push drain leaves queued entries in the outbox;
+    // they are removed here once the client confirms them.
+    void set_offline_outbox(im::service::push::OfflineOutbox* outbox) {
+        offline_outbox_ = outbox;
+    }
 
 private:
     std::shared_ptr<MessageClient> msg_client_;
     std::shared_ptr<MultiPlatformAuthManager> auth_mgr_;
     im::service::push::PushNotifier* push_notifier_;
+    DeliveryAckCoalescer* ack_coalescer_ = nullptr;
+    DeliveryLedger* delivery_ledger_ = nullptr;
+    im::service::push::OfflineOutbox* offline_outbox_ = nullptr;
     std::shared_ptr<spdlog::logger> logger_;
 };
 
@@ -0,0 +1,140 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Exports monthly message partitions older than a given month to
+# gzip-compressed CSV files, then detaches them. A partition is detached only
+# after its export has been verified (gzip integrity and row count), so a
+# failed export leaves the month attached and queryable. Partitions are
+# created by db/migrations/004_message_partitioning.sql and the message
+# service.
+#
+# Usage: archive_message_partitions.sh --before YYYYMM [--out DIR] [--drop] [--dry-run]
+#
+#   --before YYYYMM  archive partitions for months strictly before this one
+#   --out DIR        output directory (default: ./archive/messages)
+#   --drop           drop each partition after it is exported and detached
+#   --dry-run        only list the partitions that would be archived
+#
+# The "<table>_legacy" partition (pre-partitioning history) is never touched.
+
+DB_HOST="${MYCHAT_PGHOST:-127.0.0.1}"
+DB_PORT="${MYCHAT_PGPORT:-5432}"
+DB_NAME="${MYCHAT_PGDATABASE:-mychat}"
+DB_USER="${MYCHAT_PGUSER:-mychat}"
+DB_PASSWORD="${MYCHAT_PGPASSWORD:-mychat-dev-pass}"
+
+TABLES=("im_messages" "im_group_messages")
+
+before=""
+out_dir="archive/messages"
+drop=0
+dry_run=0
+
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    --before) before="${2:-}"; shift 2 ;;
+    --out) out_dir="${2:-}"; shift 2 ;;
+    --drop) drop=1; shift ;;
+    --dry-run) dry_run=1; shift ;;
+    -h|--help) sed -n '4,18p' "${BASH_SOURCE[0]}" | sed 's/^# \{0,1\}//'; exit 0 ;;
+    *) echo "Unknown argument: $1" >&2; exit 1 ;;
+  esac
+done
+
+if [[ ! "${before}" =~ ^[0-9]{6}$ ]]; then
+  echo "--before YYYYMM is required" >&2
+  exit 1
+fi
+
+run_psql() {
+  local sql="$1"
+  if command -v psql >/dev/null 2>&1; then
+    PGPASSWORD="${DB_PASSWORD}" psql \
+      --host="${DB_HOST}" \
+      --port="${DB_PORT}" \
+      --username="${DB_USER}" \
+      --dbname="${DB_NAME}" \
+      --set=ON_ERROR_STOP=1 \
+      --quiet \
+      --tuples-only \
+      --no-align \
+      --command="${sql}"
+    return
+  fi
+
+  docker compose exec -T \
+    -e PGPASSWORD="${DB_PASSWORD}" \
+    postgres \
+    psql \
+      --username="${DB_USER}" \
+      --dbname="${DB_NAME}" \
+      --set=ON_ERROR_STOP=1 \
+      --quiet \
+      --tuples-only \
+      --no-align \
+      --command="${sql}"
+}
+
+# Number of CSV records (header excluded) in a gzip file. Quoted fields may
+# contain newlines, so a record ends only at a newline outside quotes: the
+# running count of '"' is even there because embedded quotes are doubled.
+csv_records() {
+  gzip -dc "$1" | awk '{ quotes += gsub(/"/, "\""); if (quotes % 2 == 0) records++ }
+                       END { print (records > 0 ? records - 1 : 0) }'
+}
+
+mkdir -p "${out_dir}"
+
+for table in "${TABLES[@]}"; do
+  partitions="$(run_psql "SELECT c.relname
+      FROM pg_inherits i
+      JOIN pg_class c ON c.oid = i.inhrelid
+     WHERE i.inhparent = to_regclass('\"${table}\"')
+       AND c.relname ~ '^${table}_p[0-9]{6}\$'
+       AND right(c.relname, 6) < '${before}'
+     ORDER BY c.relname;")"
+
+  if [[ -z "${partitions}" ]]; then
+    echo "==> ${table}: nothing older than ${before}"
+    continue
+  fi
+
+  while IFS= read -r part; do
+    [[ -z "${part}" ]] && continue
+    file="${out_dir}/${part}.csv.gz"
+
+    if [[ "${dry_run}" -eq 1 ]]; then
+      echo "==> Would archive ${part} -> ${file}"
+      continue
+    fi
+
+    echo "==> Exporting ${part} -> ${file}"
+    rows="$(run_psql "SELECT count(*) FROM \"${part}\";")"
+    run_psql "COPY \"${part}\" TO STDOUT WITH (FORMAT csv, HEADER true);" | gzip -c > "${file}.tmp"
+    gzip -t "${file}.tmp"
+    exported="$(csv_records "${file}.tmp")"
+    if [[ "${exported}" != "${rows}" ]]; then
+      echo "Export of ${part} has ${exported} rows, table has ${rows}; left attached" >&2
+      rm -f "${file}.tmp"
+      exit 1
+    fi
+    mv "${file}.tmp" "${file}"
+
+    echo "==> Detaching ${part} (${rows} rows exported)"
+    run_psql "ALTER TABLE \"${table}\" DETACH PARTITION \"${part}\";" >/dev/null
+
+    if [[ "${drop}" -eq 1 ]]; then
+      # Rows written between the export and the detach would be lost by the
+      # drop; keep the detached table for manual handling instead.
+      remaining="$(run_psql "SELECT count(*) FROM \"${part}\";")"
+      if [[ "${remaining}" != "${rows}" ]]; then
+        echo "${part} changed after export (${remaining} rows, exported ${rows}); not dropped" >&2
+        exit 1
+      fi
+      echo "==> Dropping ${part}"
+      run_psql "DROP TABLE \"${part}\";" >/dev/null
+    fi
+  done <<< "${partitions}"
+done
+
+echo "==> Message partition archival complete"
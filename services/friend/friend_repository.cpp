@@ -4,9 +4,12 @@
 
 #include <odb/database.hxx>
 #include <odb/pgsql/database.hxx>
+#include <odb/pgsql/transaction.hxx>
 #include <odb/transaction.hxx>
 #include <odb/query.hxx>
 
+#include "pgsql/native_query.hpp"
+
 #include <friend.hpp>
 #include <friend-odb.hxx>
 
@@ -14,6 +17,25 @@ namespace im {
 namespace service {
 namespace friend_ {
 
+namespace {
+
+std::vector<FriendProfileRow> to_profile_rows(const im::db::NativeResult& r) {
+    std::vector<FriendProfileRow> rows;
+    rows.reserve(static_cast<std::size_t>(r.rows()));
+    for (int i = 0; i < r.rows(); ++i) {
+        FriendProfileRow row;
+        row.friend_id = r.uint64(i, 0);
+        row.friend_uid = r.text(i, 1);
+        row.nickname = r.is_null(i, 2) ? row.friend_uid : r.text(i, 2);
+        row.status = static_cast<FriendStatus>(r.int64(i, 3));
+        row.created_at = r.int64(i, 4);
+        rows.push_back(std::move(row));
+    }
+    return rows;
+}
+
+} // anonymous namespace
+
 FriendRepository::FriendRepository(std::shared_ptr<odb::pgsql::database> db)
     : db_(std::move(db)) {}
 
@@ -90,39 +112,53 @@ std::optional<Friend> FriendRepository::find_relationship(
     }
 }
 
-std::vector<Friend> FriendRepository::find_friends(const std::string& uid) {
-    std::vector<Friend> result;
+std::vector<FriendProfileRow> FriendRepository::find_friends_with_profile(
+    const std::string& uid)
+{
     try {
-        odb::transaction t(db_->begin());
-        odb::query<Friend> q(
-            (odb::query<Friend>::requester_uid == uid ||
-             odb::query<Friend>::target_uid == uid) &&
-            odb::query<Friend>::status == FriendStatus::ACCEPTED);
-        odb::result<Friend> r(db_->query<Friend>(q));
-        for (const auto& f : r) {
-            result.push_back(f);
-        }
+        odb::pgsql::transaction t(db_->begin());
+        // UNION ALL instead of an OR predicate so each branch uses its index:
+        // im_friends_pair_i for the requester side, im_friends_target_status_i
+        // for the target side.
+        auto r = im::db::native_query(
+            R"(SELECT f."friend_id", f."target_uid", u."nickname",
+                      f."status", f."created_at"
+                 FROM "im_friends" f
+                 LEFT JOIN "im_users" u ON u."uid" = f."target_uid"
+                WHERE f."requester_uid" = $1 AND f."status" = $2
+               UNION ALL
+               SELECT f."friend_id", f."requester_uid", u."nickname",
+                      f."status", f."created_at"
+                 FROM "im_friends" f
+                 LEFT JOIN "im_users" u ON u."uid" = f."requester_uid"
+                WHERE f."target_uid" = $1 AND f."status" = $2)",
+            {uid, std::to_string(static_cast<int>(FriendStatus::ACCEPTED))});
+        auto rows = to_profile_rows(r);
         t.commit();
+        return rows;
     } catch (const odb::exception&) {
+        return {};
     }
-    return result;
 }
 
-std::vector<Friend> FriendRepository::find_pending(const std::string& uid) {
-    std::vector<Friend> result;
+std::vector<FriendProfileRow> FriendRepository::find_pending_with_profile(
+    const std::string& uid)
+{
     try {
-        odb::transaction t(db_->begin());
-        odb::query<Friend> q(
-            odb::query<Friend>::target_uid == uid &&
-            odb::query<Friend>::status == FriendStatus::PENDING);
-        odb::result<Friend> r(db_->query<Friend>(q));
-        for (const auto& f : r) {
-            result.push_back(f);
-        }
+        odb::pgsql::transaction t(db_->begin());
+        auto r = im::db::native_query(
+            R"(SELECT f."friend_id", f."requester_uid", u."nickname",
+                      f."status", f."created_at"
+                 FROM "im_friends" f
+                 LEFT JOIN "im_users" u ON u."uid" = f."requester_uid"
+                WHERE f."target_uid" = $1 AND f."status" = $2)",
+            {uid, std::to_string(static_cast<int>(FriendStatus::PENDING))});
+        auto rows = to_profile_rows(r);
         t.commit();
+        return rows;
     } catch (const odb::exception&) {
+        return {};
     }
-    return result;
 }
 
 bool FriendRepository::update_status(uint64_t friend_id, FriendStatus status) {
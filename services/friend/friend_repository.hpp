@@ -20,6 +20,15 @@ namespace friend_ {
 enum class FriendStatus : int;
 class Friend;
 
+// One relationship row joined with the other side's profile.
+struct FriendProfileRow {
+    uint64_t friend_id = 0;
+    std::string friend_uid;
+    std::string nickname;
+    FriendStatus status;
+    int64_t created_at = 0;
+};
+
 class FriendRepository {
 public:
     explicit FriendRepository(std::shared_ptr<odb::pgsql::database> db);
@@ -30,8 +39,10 @@ public:
                                        const std::string& target_uid);
     std::optional<Friend> find_relationship(const std::string& user_a,
                                             const std::string& user_b);
-    std::vector<Friend> find_friends(const std::string& uid);
-    std::vector<Friend> find_pending(const std::string& uid);
+    // Accepted friends / incoming requests with the peer's nickname, each in
+    // one round trip. Both sides of the relationship are served by an index.
+    std::vector<FriendProfileRow> find_friends_with_profile(const std::string& uid);
+    std::vector<FriendProfileRow> find_pending_with_profile(const std::string& uid);
     bool update_status(uint64_t friend_id, FriendStatus status);
     bool relationship_exists(const std::string& user_a, const std::string& user_b);
 
@@ -119,48 +119,28 @@ FriendResult FriendService::respond_to_request(
 }
 
 std::vector<FriendInfoDTO> FriendService::get_friends(const std::string& uid) {
-    std::vector<FriendInfoDTO> result;
-    auto friends = repo_->find_friends(uid);
-    result.reserve(friends.size());
-    for (const auto& f : friends) {
-        result.push_back(to_friend_info(f, uid));
-    }
-    return result;
+    return to_friend_infos(repo_->find_friends_with_profile(uid));
 }
 
 std::vector<FriendInfoDTO> FriendService::get_pending_requests(const std::string& uid) {
-    std::vector<FriendInfoDTO> result;
-    auto pending = repo_->find_pending(uid);
-    result.reserve(pending.size());
-    for (const auto& f : pending) {
-        result.push_back(to_friend_info(f, uid));
-    }
-    return result;
+    return to_friend_infos(repo_->find_pending_with_profile(uid));
 }
 
-std::string FriendService::resolve_nickname(const std::string& uid) {
-    if (auto profile = user_service_->get_profile_by_uid(uid)) {
-        return profile->nickname;
-    }
-    return uid;
-}
-
-FriendInfoDTO FriendService::to_friend_info(
-    const Friend& f, const std::string& uid)
+std::vector<FriendInfoDTO> FriendService::to_friend_infos(
+    const std::vector<FriendProfileRow>& rows)
 {
-    FriendInfoDTO dto;
-    dto.friend_id = f.friend_id();
-    dto.status = f.status();
-    dto.created_at = f.created_at();
-
-    // Determine the other user's UID
-    std::string other_uid = (f.requester_uid() == uid)
-        ? f.target_uid()
-        : f.requester_uid();
-    dto.friend_uid = other_uid;
-    dto.nickname = resolve_nickname(other_uid);
-
-    return dto;
+    std::vector<FriendInfoDTO> result;
+    result.reserve(rows.size());
+    for (const auto& row : rows) {
+        FriendInfoDTO dto;
+        dto.friend_id = row.friend_id;
+        dto.friend_uid = row.friend_uid;
+        dto.nickname = row.nickname;
+        dto.status = row.status;
+        dto.created_at = row.created_at;
+        result.push_back(std::move(dto));
+    }
+    return result;
 }
 
 } // namespace friend_
@@ -44,6 +44,7 @@ struct FriendInfoDTO {
 };
 
 class FriendRepository;
+struct FriendProfileRow;
 
 class FriendService {
 public:
@@ -58,8 +59,8 @@ public:
     std::vector<FriendInfoDTO> get_pending_requests(const std::string& uid);
 
 private:
-    std::string resolve_nickname(const std::string& uid);
-    FriendInfoDTO to_friend_info(const class Friend& f, const std::string& uid);
+    static std::vector<FriendInfoDTO> to_friend_infos(
+        const std::vector<FriendProfileRow>& rows);
 
     std::shared_ptr<odb::pgsql::database> db_;
     std::shared_ptr<im::service::user::UserService> user_service_;
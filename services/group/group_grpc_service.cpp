@@ -490,4 +490,71 @@ GroupGrpcService::GroupGrpcService(GroupService* group_service,
     }
 }
 
+::grpc::Status GroupGrpcService::MarkGroupRead(
+    ::grpc::ServerContext* /*context*/,
+    const im::group::MarkGroupReadRequest* request,
+    im::group::GroupActionResponse* response) {
+    if (!require_group_message_service(group_message_service_, response)) {
+        return ::grpc::Status::OK;
+    }
+    if (!request || request->group_id() == 0 || request->header().from_uid().empty()) {
+        set_base(response->mutable_base(), im::base::PARAM_ERROR,
+                 "group_id and from_uid are required");
+        return ::grpc::Status::OK;
+    }
+
+    try {
+        const auto result = group_message_service_->mark_read(
+            request->group_id(),
+            request->header().from_uid(),
+            request->last_read_msg_id(),
+            request->header().timestamp() > 0
+                ? static_cast<int64_t>(request->header().timestamp())
+                : now_ms());
+        set_base(response->mutable_base(),
+                 result.ok ? im::base::SUCCESS : group_error_code(result.error_code),
+                 result.ok ? "" : result.message);
+        return ::grpc::Status::OK;
+    } catch (const std::exception& e) {
+        set_base(response->mutable_base(), im::base::SERVER_ERROR, e.what());
+        return ::grpc::Status::OK;
+    }
+}
+
+::grpc::Status GroupGrpcService::GetUnreadSummary(
+    ::grpc::ServerContext* /*context*/,
+    const im::group::GetUnreadSummaryRequest* request,
+    im::group::GetUnreadSummaryResponse* response) {
+    if (!require_group_message_service(group_message_service_, response)) {
+        return ::grpc::Status::OK;
+    }
+    if (!request || request->header().from_uid().empty()) {
+        set_base(response->mutable_base(), im::base::PARAM_ERROR,
+                 "from_uid is required");
+        return ::grpc::Status::OK;
+    }
+
+    try {
+        const auto summary = group_message_service_->get_unread_summary(
+            request->header().from_uid());
+        if (!summary.has_value()) {
+            set_base(response->mutable_base(), im::base::SERVER_ERROR,
+                     "unread summary unavailable");
+            return ::grpc::Status::OK;
+        }
+        set_base(response->mutable_base(), im::base::SUCCESS);
+        for (const auto& item : *summary) {
+            auto* out = response->add_groups();
+            out->set_group_id(item.group_id);
+            out->set_last_read_msg_id(item.last_read_msg_id);
+            out->set_last_msg_id(item.last_msg_id);
+            out->set_unread_count(item.unread_count);
+        }
+        return ::grpc::Status::OK;
+    } catch (const std::exception& e) {
+        set_base(response->mutable_base(), im::base::SERVER_ERROR, e.what());
+        return ::grpc::Status::OK;
+    }
+}
+
 }  // namespace im::service::group
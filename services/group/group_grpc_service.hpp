@@ -59,6 +59,14 @@ public:
                                     const im::group::GetGroupMessagesRequest* request,
                                     im::group::GetGroupMessagesResponse* response) override;
 
+    ::grpc::Status MarkGroupRead(::grpc::ServerContext* context,
+                                 const im::group::MarkGroupReadRequest* request,
+                                 im::group::GroupActionResponse* response) override;
+
+    ::grpc::Status GetUnreadSummary(::grpc::ServerContext* context,
+                                    const im::group::GetUnreadSummaryRequest* request,
+                                    im::group::GetUnreadSummaryResponse* response) override;
+
 private:
     GroupService* group_service_;
     GroupMessageService* group_message_service_;
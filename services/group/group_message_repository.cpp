@@ -27,6 +27,9 @@ std::vector<GroupMessage> GroupMessageRepository::find_by_group(
 {
     std::vector<GroupMessage> result;
     try {
+        // im_group_messages is range-partitioned on created_at: the upper
+        // bound prunes newer months and DESC + LIMIT walks the remaining
+        // partitions newest-first, stopping as soon as the page is full.
         odb::transaction t(db_->begin());
         odb::query<GroupMessage> q(
             odb::query<GroupMessage>::group_id == group_id &&
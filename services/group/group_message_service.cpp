@@ -1,5 +1,7 @@
 #include "group_message_service.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 
 #include <group_message.hpp>
@@ -9,11 +11,20 @@
 #include <user_service.hpp>
 
 #include "group_message_repository.hpp"
+#include "group_read_cursor_repository.hpp"
+#include "group_unread_cache.hpp"
 
 namespace im {
 namespace service {
 namespace group {
 
+namespace {
+
+constexpr std::size_t kHistoryCachePerGroup = 100;
+constexpr std::size_t kHistoryCacheMaxGroups = 10000;
+
+} // namespace
+
 GroupMessageService::GroupMessageService(
     std::shared_ptr<odb::pgsql::database> db,
     std::shared_ptr<im::service::user::UserService> user_service,
@@ -22,6 +33,9 @@ GroupMessageService::GroupMessageService(
     , user_service_(std::move(user_service))
     , group_service_(std::move(group_service))
     , repo_(std::make_unique<GroupMessageRepository>(db_))
+    , cursor_repo_(std::make_unique<GroupReadCursorRepository>(db_))
+    , history_cache_(std::make_unique<GroupHistoryCache>(kHistoryCachePerGroup,
+                                                         kHistoryCacheMaxGroups))
 {}
 
 GroupMessageService::~GroupMessageService() = default;
@@ -51,15 +65,88 @@ GroupSendResult GroupMessageService::send_message(
         return {false, "STORE_FAILED", "Failed to store message", 0};
     }
 
+    std::vector<std::string> member_uids;
+    member_uids.reserve(members.size());
+    for (const auto& m : members) {
+        member_uids.push_back(m.user_uid);
+    }
+    group_service_->unread_cache()->on_message(group_id, msg.id(), sender_uid,
+                                               member_uids);
+
+    GroupMessageDTO dto{msg.id(), sender_uid, "", content, now_ms};
+    if (history_cache_->contains(group_id)) {
+        dto.sender_nickname = resolve_nickname(sender_uid);
+    }
+    history_cache_->append(group_id, std::move(dto));
+
     return {true, "", "Message sent", msg.id()};
 }
 
 std::vector<GroupMessageDTO> GroupMessageService::get_history(
     uint64_t group_id, int64_t before_time, int limit)
 {
-    auto msgs = repo_->find_by_group(group_id, before_time, limit);
+    // The cache returns oldest-first; history is served newest-first.
+    auto newest_first = [](std::vector<GroupMessageDTO> rows) {
+        std::reverse(rows.begin(), rows.end());
+        return rows;
+    };
+
+    if (auto cached = history_cache_->find(group_id, before_time, limit)) {
+        return newest_first(std::move(*cached));
+    }
 
+    if (history_cache_->enabled() && !history_cache_->contains(group_id)) {
+        const auto ticket = history_cache_->begin_fill(group_id);
+        const auto capacity = history_cache_->capacity();
+        auto window = to_dtos(repo_->find_by_group(group_id, INT64_MAX,
+                                                   static_cast<int>(capacity)));
+        if (window.empty()) {
+            return {};
+        }
+        const bool complete = window.size() < capacity;
+        history_cache_->fill(group_id, std::move(window), complete, ticket);
+        if (auto cached = history_cache_->find(group_id, before_time, limit, false)) {
+            return newest_first(std::move(*cached));
+        }
+    }
+
+    return to_dtos(repo_->find_by_group(group_id, before_time, limit));
+}
+
+GroupReadResult GroupMessageService::mark_read(
+    uint64_t group_id, const std::string& user_uid, uint64_t msg_id,
+    int64_t now_ms)
+{
+    if (group_id == 0) {
+        return {false, "INVALID_GROUP", "Invalid group id"};
+    }
+    if (user_uid.empty()) {
+        return {false, "EMPTY_UID", "User uid is empty"};
+    }
+
+    uint64_t stored_msg_id = 0;
+    switch (cursor_repo_->advance(group_id, user_uid, msg_id, now_ms, stored_msg_id)) {
+    case CursorAdvance::kAdvanced:
+        break;
+    case CursorAdvance::kNotMember:
+        return {false, "FORBIDDEN", "Not a member of this group"};
+    case CursorAdvance::kFailed:
+        return {false, "STORE_FAILED", "Failed to store read cursor"};
+    }
+
+    group_service_->unread_cache()->on_read(group_id, user_uid, stored_msg_id);
+    return {true, "", "Read cursor updated"};
+}
+
+im::utils::RecentMessageCacheStats GroupMessageService::history_cache_stats() const {
+    return history_cache_->stats();
+}
+
+std::vector<GroupMessageDTO> GroupMessageService::to_dtos(
+    const std::vector<GroupMessage>& msgs)
+{
     std::vector<GroupMessageDTO> result;
+    result.reserve(msgs.size());
     for (const auto& m : msgs) {
         GroupMessageDTO dto;
         dto.msg_id = m.id();
@@ -72,6 +159,29 @@ std::vector<GroupMessageDTO> GroupMessageService::get_history(
     return result;
 }
 
+std::optional<std::vector<GroupUnreadDTO>> GroupMessageService::get_unread_summary(
+    const std::string& user_uid)
+{
+    auto cache = group_service_->unread_cache();
+    auto rows = cache->get(user_uid);
+    if (!rows.has_value()) {
+        const auto ticket = cache->begin_fill(user_uid);
+        rows = cursor_repo_->unread_summary(user_uid);
+        if (!rows.has_value()) {
+            return std::nullopt;
+        }
+        cache->put(user_uid, *rows, ticket);
+    }
+
+    std::vector<GroupUnreadDTO> result;
+    result.reserve(rows->size());
+    for (const auto& row : *rows) {
+        result.push_back({row.group_id, row.last_read_msg_id, row.last_msg_id,
+                          row.unread_count});
+    }
+    return result;
+}
+
 std::string GroupMessageService::resolve_nickname(const std::string& uid) {
     auto profile = user_service_->get_profile_by_uid(uid);
     if (profile.has_value()) {
@@ -3,9 +3,12 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "../../common/utils/recent_message_cache.hpp"
+
 namespace odb {
 namespace pgsql {
 class database;
@@ -23,6 +26,8 @@ namespace group {
 class GroupService;
 
 class GroupRepository;
+class GroupReadCursorRepository;
+class GroupMessage;
 
 struct GroupSendResult {
     bool ok = false;
@@ -39,6 +44,24 @@ struct GroupMessageDTO {
     int64_t created_at;
 };
 
+// Newest messages per group; items carry the resolved sender nickname.
+using GroupHistoryCache =
+    im::utils::RecentMessageCache<uint64_t, GroupMessageDTO,
+                                  &GroupMessageDTO::created_at, &GroupMessageDTO::msg_id>;
+
+struct GroupUnreadDTO {
+    uint64_t group_id = 0;
+    uint64_t last_read_msg_id = 0;
+    uint64_t last_msg_id = 0;
+    int64_t unread_count = 0;
+};
+
+struct GroupReadResult {
+    bool ok = false;
+    std::string error_code;
+    std::string message;
+};
+
 class GroupMessageService {
 public:
     GroupMessageService(std::shared_ptr<odb::pgsql::database> db,
@@ -51,13 +74,26 @@ public:
     std::vector<GroupMessageDTO> get_history(uint64_t group_id, int64_t before_time,
                                               int limit = 50);
 
+    // Read-ack: moves the caller's cursor in group_id up to msg_id.
+    GroupReadResult mark_read(uint64_t group_id, const std::string& user_uid,
+                              uint64_t msg_id, int64_t now_ms);
+    // Unread counts for all of the user's groups; cache hit or one query.
+    // std::nullopt when the query fails; failures are never cached.
+    std::optional<std::vector<GroupUnreadDTO>> get_unread_summary(
+        const std::string& user_uid);
+
+    im::utils::RecentMessageCacheStats history_cache_stats() const;
+
 private:
     std::string resolve_nickname(const std::string& uid);
+    std::vector<GroupMessageDTO> to_dtos(const std::vector<GroupMessage>& msgs);
 
     std::shared_ptr<odb::pgsql::database> db_;
     std::shared_ptr<im::service::user::UserService> user_service_;
     std::shared_ptr<GroupService> group_service_;
     std::unique_ptr<class GroupMessageRepository> repo_;
+    std::unique_ptr<GroupReadCursorRepository> cursor_repo_;
+    std::unique_ptr<GroupHistoryCache> history_cache_;
 };
 
 } // namespace group
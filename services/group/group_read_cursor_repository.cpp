@@ -0,0 +1,145 @@
+#include "group_read_cursor_repository.hpp"
+
+#include <utility>
+
+#include <odb/exceptions.hxx>
+#include <odb/pgsql/database.hxx>
+#include <odb/pgsql/transaction.hxx>
+
+#include "pgsql/native_query.hpp"
+
+namespace im {
+namespace service {
+namespace group {
+
+GroupReadCursorRepository::GroupReadCursorRepository(
+    std::shared_ptr<odb::pgsql::database> db)
+    : db_(std::move(db)) {}
+
+CursorAdvance GroupReadCursorRepository::advance(uint64_t group_id,
+                                                 const std::string& user_uid,
+                                                 uint64_t msg_id, int64_t now_ms,
+                                                 uint64_t& stored_msg_id)
+{
+    try {
+        odb::pgsql::transaction t(db_->begin());
+        // The SELECT yields no row for a non-member, so nothing is written.
+        // The head comes from im_group_messages(group_id, id).
+        auto r = im::db::native_query(
+            R"(INSERT INTO "im_group_read_cursors"
+                   ("group_id", "user_uid", "last_read_msg_id", "updated_at")
+               SELECT m."group_id", m."user_uid",
+                      LEAST($3::BIGINT, COALESCE(
+                          (SELECT MAX(gm."id") FROM "im_group_messages" gm
+                            WHERE gm."group_id" = m."group_id"), 0)),
+                      $4
+                 FROM "im_group_members" m
+                WHERE m."group_id" = $1 AND m."user_uid" = $2
+               ON CONFLICT ("group_id", "user_uid") DO UPDATE
+                   SET "last_read_msg_id" = GREATEST(
+                           "im_group_read_cursors"."last_read_msg_id",
+                           EXCLUDED."last_read_msg_id"),
+                       "updated_at" = EXCLUDED."updated_at"
+               RETURNING "last_read_msg_id")",
+            {std::to_string(group_id), user_uid, std::to_string(msg_id),
+             std::to_string(now_ms)});
+        if (r.rows() == 0) {
+            t.commit();
+            return CursorAdvance::kNotMember;
+        }
+        stored_msg_id = r.uint64(0, 0);
+        t.commit();
+        return CursorAdvance::kAdvanced;
+    } catch (const odb::exception&) {
+        return CursorAdvance::kFailed;
+    }
+}
+
+bool GroupReadCursorRepository::init_at_head(uint64_t group_id,
+                                             const std::string& user_uid,
+                                             int64_t now_ms)
+{
+    try {
+        odb::pgsql::transaction t(db_->begin());
+        im::db::native_query(
+            R"(INSERT INTO "im_group_read_cursors"
+                   ("group_id", "user_uid", "last_read_msg_id", "updated_at")
+               SELECT $1, $2, COALESCE(MAX("id"), 0), $3
+                 FROM "im_group_messages" WHERE "group_id" = $1
+               ON CONFLICT ("group_id", "user_uid") DO NOTHING)",
+            {std::to_string(group_id), user_uid, std::to_string(now_ms)});
+        t.commit();
+        return true;
+    } catch (const odb::exception&) {
+        return false;
+    }
+}
+
+bool GroupReadCursorRepository::remove(uint64_t group_id,
+                                       const std::string& user_uid)
+{
+    try {
+        odb::pgsql::transaction t(db_->begin());
+        im::db::native_query(
+            R"(DELETE FROM "im_group_read_cursors"
+               WHERE "group_id" = $1 AND "user_uid" = $2)",
+            {std::to_string(group_id), user_uid});
+        t.commit();
+        return true;
+    } catch (const odb::exception&) {
+        return false;
+    }
+}
+
+std::optional<std::vector<GroupUnreadRow>>
+GroupReadCursorRepository::unread_summary(const std::string& user_uid)
+{
+    std::vector<GroupUnreadRow> result;
+    try {
+        odb::pgsql::transaction t(db_->begin());
+        // The count runs on im_group_messages(group_id, id) INCLUDE (sender_uid)
+        // from the member's cursor, so the sender filter is answered from the
+        // index and cost follows unread volume. A member without a cursor row
+        // (none should exist after migration 002's backfill) counts from the
+        // head instead of scanning the whole history.
+        auto r = im::db::native_query(
+            R"(SELECT m."group_id",
+                      COALESCE(c."last_read_msg_id", head."last_msg_id", 0),
+                      COALESCE(head."last_msg_id", 0),
+                      COALESCE(unread."n", 0)
+                 FROM "im_group_members" m
+                 LEFT JOIN "im_group_read_cursors" c
+                        ON c."group_id" = m."group_id" AND c."user_uid" = m."user_uid"
+                 LEFT JOIN LATERAL (
+                        SELECT MAX(gm."id") AS "last_msg_id"
+                          FROM "im_group_messages" gm
+                         WHERE gm."group_id" = m."group_id") head ON TRUE
+                 LEFT JOIN LATERAL (
+                        SELECT COUNT(*) AS "n"
+                          FROM "im_group_messages" gm
+                         WHERE gm."group_id" = m."group_id"
+                           AND gm."id" > COALESCE(c."last_read_msg_id",
+                                                  head."last_msg_id", 0)
+                           AND gm."sender_uid" <> m."user_uid") unread ON TRUE
+                WHERE m."user_uid" = $1
+                ORDER BY m."group_id")",
+            {user_uid});
+        result.reserve(static_cast<std::size_t>(r.rows()));
+        for (int i = 0; i < r.rows(); ++i) {
+            GroupUnreadRow row;
+            row.group_id = r.uint64(i, 0);
+            row.last_read_msg_id = r.uint64(i, 1);
+            row.last_msg_id = r.uint64(i, 2);
+            row.unread_count = r.int64(i, 3);
+            result.push_back(row);
+        }
+        t.commit();
+    } catch (const odb::exception&) {
+        return std::nullopt;
+    }
+    return result;
+}
+
+} // namespace group
+} // namespace service
+} // namespace im
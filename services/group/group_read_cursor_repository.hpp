@@ -0,0 +1,67 @@
+#ifndef IM_SERVICE_GROUP_GROUP_READ_CURSOR_REPOSITORY_HPP
+#define IM_SERVICE_GROUP_GROUP_READ_CURSOR_REPOSITORY_HPP
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace odb {
+namespace pgsql {
+class database;
+}
+}
+
+namespace im {
+namespace service {
+namespace group {
+
+struct GroupUnreadRow {
+    uint64_t group_id = 0;
+    uint64_t last_read_msg_id = 0;
+    uint64_t last_msg_id = 0;
+    int64_t unread_count = 0;
+};
+
+enum class CursorAdvance {
+    kAdvanced,
+    kNotMember,
+    kFailed,
+};
+
+// Per-member read positions in im_group_read_cursors. The table is not an
+// ODB persistent class; statements run as native SQL inside ODB transactions.
+class GroupReadCursorRepository {
+public:
+    explicit GroupReadCursorRepository(std::shared_ptr<odb::pgsql::database> db);
+
+    // Moves the cursor forward only; an older ack never rewinds it, and an
+    // ack past the newest message is capped at it. Only members of the group
+    // get a cursor (kNotMember otherwise). On kAdvanced, stored_msg_id is the
+    // cursor after the update.
+    CursorAdvance advance(uint64_t group_id, const std::string& user_uid,
+                          uint64_t msg_id, int64_t now_ms,
+                          uint64_t& stored_msg_id);
+
+    // Starts a new member's cursor at the current head of the group.
+    bool init_at_head(uint64_t group_id, const std::string& user_uid,
+                      int64_t now_ms);
+
+    bool remove(uint64_t group_id, const std::string& user_uid);
+
+    // Unread counts for every group the user belongs to, in one round trip.
+    // The user's own messages are never counted as unread, and a member with
+    // no cursor row is treated as caught up. std::nullopt on database error.
+    std::optional<std::vector<GroupUnreadRow>> unread_summary(
+        const std::string& user_uid);
+
+private:
+    std::shared_ptr<odb::pgsql::database> db_;
+};
+
+} // namespace group
+} // namespace service
+} // namespace im
+
+#endif // IM_SERVICE_GROUP_GROUP_READ_CURSOR_REPOSITORY_HPP
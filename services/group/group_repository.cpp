@@ -4,9 +4,12 @@
 
 #include <odb/database.hxx>
 #include <odb/pgsql/database.hxx>
+#include <odb/pgsql/transaction.hxx>
 #include <odb/transaction.hxx>
 #include <odb/query.hxx>
 
+#include "pgsql/native_query.hpp"
+
 #include <group.hpp>
 #include <group-odb.hxx>
 
@@ -60,27 +63,46 @@ std::optional<Group> GroupRepository::find_group_by_id(uint64_t group_id) {
 std::vector<Group> GroupRepository::find_groups_by_user(
     const std::string& user_uid)
 {
-    std::vector<uint64_t> group_ids;
+    std::vector<Group> result;
+    for (auto& row : find_groups_with_member_count(user_uid)) {
+        Group g(row.name, row.creator_uid, row.created_at);
+        g.group_id(row.group_id);
+        result.push_back(std::move(g));
+    }
+    return result;
+}
+
+std::vector<GroupWithCountRow> GroupRepository::find_groups_with_member_count(
+    const std::string& user_uid)
+{
+    std::vector<GroupWithCountRow> result;
     try {
-        odb::transaction t(db_->begin());
-        odb::query<GroupMember> mq(
-            odb::query<GroupMember>::user_uid == user_uid);
-        odb::result<GroupMember> mr(db_->query<GroupMember>(mq));
-        for (const auto& m : mr) {
-            group_ids.push_back(m.group_id());
+        odb::pgsql::transaction t(db_->begin());
+        // Membership lookup uses im_group_members_user_i; each count is an
+        // index range on im_group_members_pair_i.
+        auto r = im::db::native_query(
+            R"(SELECT g."group_id", g."name", g."creator_uid", g."created_at",
+                      (SELECT COUNT(*) FROM "im_group_members" c
+                        WHERE c."group_id" = g."group_id")
+                 FROM "im_group_members" m
+                 JOIN "im_groups" g ON g."group_id" = m."group_id"
+                WHERE m."user_uid" = $1
+                ORDER BY g."group_id")",
+            {user_uid});
+        result.reserve(static_cast<std::size_t>(r.rows()));
+        for (int i = 0; i < r.rows(); ++i) {
+            GroupWithCountRow row;
+            row.group_id = r.uint64(i, 0);
+            row.name = r.text(i, 1);
+            row.creator_uid = r.text(i, 2);
+            row.created_at = r.int64(i, 3);
+            row.member_count = static_cast<int>(r.int64(i, 4));
+            result.push_back(std::move(row));
         }
         t.commit();
     } catch (const odb::exception&) {
         return {};
     }
-
-    std::vector<Group> result;
-    for (auto gid : group_ids) {
-        auto g = find_group_by_id(gid);
-        if (g.has_value()) {
-            result.push_back(std::move(g.value()));
-        }
-    }
     return result;
 }
 
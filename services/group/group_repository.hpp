@@ -22,6 +22,14 @@ enum class GroupRole : int;
 class Group;
 class GroupMember;
 
+struct GroupWithCountRow {
+    uint64_t group_id = 0;
+    std::string name;
+    std::string creator_uid;
+    int64_t created_at = 0;
+    int member_count = 0;
+};
+
 class GroupRepository {
 public:
     explicit GroupRepository(std::shared_ptr<odb::pgsql::database> db);
@@ -31,6 +39,9 @@ public:
     bool create_group_with_owner(Group& g, GroupMember& owner);
     std::optional<Group> find_group_by_id(uint64_t group_id);
     std::vector<Group> find_groups_by_user(const std::string& user_uid);
+    // Groups the user belongs to plus each group's member count, one query.
+    std::vector<GroupWithCountRow> find_groups_with_member_count(
+        const std::string& user_uid);
     std::vector<Group> search_groups(const std::string& keyword,
                                      std::size_t limit);
 
@@ -73,6 +73,9 @@ void GroupServerApp::shutdown() {
     if (server_) {
         logger_->info("Stopping Group gRPC server on {}", config_.listen_address);
         server_->Shutdown();
+        const auto cache = group_message_service_->history_cache_stats();
+        logger_->info("History cache: hits={} misses={} hit_ratio={:.3f} entries={}",
+                      cache.hits, cache.misses, cache.hit_ratio(), cache.entries);
         server_.reset();
         selected_port_ = 0;
     }
@@ -1,5 +1,7 @@
 #include "group_service.hpp"
+#include "group_read_cursor_repository.hpp"
 #include "group_repository.hpp"
+#include "group_unread_cache.hpp"
 
 #include <utility>
 #include <chrono>
@@ -28,7 +30,9 @@ GroupService::GroupService(
     std::shared_ptr<im::service::user::UserService> user_service)
     : db_(std::move(db))
     , user_service_(std::move(user_service))
-    , repo_(std::make_unique<GroupRepository>(db_)) {}
+    , repo_(std::make_unique<GroupRepository>(db_))
+    , cursor_repo_(std::make_unique<GroupReadCursorRepository>(db_))
+    , unread_cache_(std::make_shared<GroupUnreadCache>()) {}
 
 GroupService::~GroupService() = default;
 
@@ -63,6 +67,9 @@ GroupResult GroupService::create_group(const CreateGroupRequest& request) {
         return result;
     }
 
+    cursor_repo_->init_at_head(g.group_id(), request.creator_uid, t);
+    unread_cache_->invalidate(request.creator_uid);
+
     result.ok = true;
     result.group_id = g.group_id();
     result.message = "Group created";
@@ -109,6 +116,10 @@ GroupResult GroupService::join_group(uint64_t group_id,
         return result;
     }
 
+    // History before joining is not unread for the new member.
+    cursor_repo_->init_at_head(group_id, user_uid, joined_at);
+    unread_cache_->invalidate(user_uid);
+
     result.ok = true;
     result.message = "Joined group";
     return result;
@@ -145,6 +156,9 @@ GroupResult GroupService::leave_group(uint64_t group_id,
         return result;
     }
 
+    cursor_repo_->remove(group_id, user_uid);
+    unread_cache_->invalidate(user_uid);
+
     result.ok = true;
     result.message = "Left group";
     return result;
@@ -154,16 +168,16 @@ std::vector<GroupInfoDTO> GroupService::list_my_groups(
     const std::string& user_uid)
 {
     std::vector<GroupInfoDTO> result;
-    auto groups = repo_->find_groups_by_user(user_uid);
-    result.reserve(groups.size());
-    for (const auto& g : groups) {
+    auto rows = repo_->find_groups_with_member_count(user_uid);
+    result.reserve(rows.size());
+    for (auto& row : rows) {
         GroupInfoDTO dto;
-        dto.group_id = g.group_id();
-        dto.name = g.name();
-        dto.creator_uid = g.creator_uid();
-        dto.created_at = g.created_at();
-        dto.member_count = static_cast<int>(repo_->find_members(g.group_id()).size());
-        result.push_back(dto);
+        dto.group_id = row.group_id;
+        dto.name = std::move(row.name);
+        dto.creator_uid = std::move(row.creator_uid);
+        dto.created_at = row.created_at;
+        dto.member_count = row.member_count;
+        result.push_back(std::move(dto));
     }
     return result;
 }
@@ -54,6 +54,8 @@ struct MemberInfoDTO {
 };
 
 class GroupRepository;
+class GroupReadCursorRepository;
+class GroupUnreadCache;
 
 class GroupService {
 public:
@@ -73,12 +75,17 @@ public:
     std::vector<MemberInfoDTO> list_members(uint64_t group_id,
                                             const std::string& caller_uid);
 
+    // Shared with GroupMessageService; join/leave invalidate the member here.
+    std::shared_ptr<GroupUnreadCache> unread_cache() const { return unread_cache_; }
+
 private:
     std::string resolve_nickname(const std::string& uid);
 
     std::shared_ptr<odb::pgsql::database> db_;
     std::shared_ptr<im::service::user::UserService> user_service_;
     std::unique_ptr<GroupRepository> repo_;
+    std::unique_ptr<GroupReadCursorRepository> cursor_repo_;
+    std::shared_ptr<GroupUnreadCache> unread_cache_;
 };
 
 } // namespace group
@@ -0,0 +1,149 @@
+#include "group_unread_cache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace im {
+namespace service {
+namespace group {
+
+GroupUnreadCache::GroupUnreadCache(std::size_t max_users)
+    : max_users_(max_users > 0 ? max_users : 1) {}
+
+std::optional<std::vector<GroupUnreadRow>> GroupUnreadCache::get(
+    const std::string& user_uid)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(user_uid);
+    if (it == entries_.end()) {
+        ++misses_;
+        return std::nullopt;
+    }
+    ++hits_;
+    touch(it->second);
+    return it->second.rows;
+}
+
+GroupUnreadCache::FillTicket GroupUnreadCache::begin_fill(
+    const std::string& user_uid) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stripes_[stripe(user_uid)];
+}
+
+void GroupUnreadCache::put(const std::string& user_uid,
+                           std::vector<GroupUnreadRow> rows, FillTicket ticket)
+{
+    std::sort(rows.begin(), rows.end(),
+              [](const GroupUnreadRow& a, const GroupUnreadRow& b) {
+                  return a.group_id < b.group_id;
+              });
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stripes_[stripe(user_uid)] != ticket) {
+        return;
+    }
+    auto it = entries_.find(user_uid);
+    if (it != entries_.end()) {
+        it->second.rows = std::move(rows);
+        touch(it->second);
+        return;
+    }
+
+    while (entries_.size() >= max_users_ && !lru_.empty()) {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+    }
+    lru_.push_front(user_uid);
+    entries_.emplace(user_uid, Entry{std::move(rows), lru_.begin()});
+}
+
+void GroupUnreadCache::on_message(uint64_t group_id, uint64_t msg_id,
+                                  const std::string& sender_uid,
+                                  const std::vector<std::string>& member_uids)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& uid : member_uids) {
+        ++stripes_[stripe(uid)];
+        auto it = entries_.find(uid);
+        if (it == entries_.end()) {
+            continue;
+        }
+        auto* row = find_row(it->second, group_id);
+        if (!row) {
+            // Membership changed behind our back; reload on next read.
+            lru_.erase(it->second.lru_it);
+            entries_.erase(it);
+            continue;
+        }
+        row->last_msg_id = std::max(row->last_msg_id, msg_id);
+        if (uid == sender_uid) {
+            continue;
+        }
+        ++row->unread_count;
+    }
+}
+
+void GroupUnreadCache::on_read(uint64_t group_id, const std::string& user_uid,
+                               uint64_t msg_id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stripes_[stripe(user_uid)];
+    auto it = entries_.find(user_uid);
+    if (it == entries_.end()) {
+        return;
+    }
+    auto* row = find_row(it->second, group_id);
+    if (row && msg_id <= row->last_read_msg_id) {
+        return;
+    }
+    if (row && msg_id >= row->last_msg_id) {
+        row->last_read_msg_id = msg_id;
+        row->unread_count = 0;
+        return;
+    }
+    // Partial ack: the remaining count needs the per-message sender filter,
+    // which only the database knows.
+    lru_.erase(it->second.lru_it);
+    entries_.erase(it);
+}
+
+void GroupUnreadCache::invalidate(const std::string& user_uid) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stripes_[stripe(user_uid)];
+    auto it = entries_.find(user_uid);
+    if (it == entries_.end()) {
+        return;
+    }
+    lru_.erase(it->second.lru_it);
+    entries_.erase(it);
+}
+
+GroupUnreadCacheStats GroupUnreadCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {hits_, misses_, entries_.size()};
+}
+
+GroupUnreadRow* GroupUnreadCache::find_row(Entry& entry, uint64_t group_id) {
+    auto it = std::lower_bound(entry.rows.begin(), entry.rows.end(), group_id,
+                               [](const GroupUnreadRow& row, uint64_t id) {
+                                   return row.group_id < id;
+                               });
+    if (it == entry.rows.end() || it->group_id != group_id) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+std::size_t GroupUnreadCache::stripe(const std::string& user_uid) {
+    return std::hash<std::string>{}(user_uid) % kStripes;
+}
+
+void GroupUnreadCache::touch(Entry& entry) {
+    lru_.splice(lru_.begin(), lru_, entry.lru_it);
+}
+
+} // namespace group
+} // namespace service
+} // namespace im
@@ -0,0 +1,82 @@
+#ifndef IM_SERVICE_GROUP_GROUP_UNREAD_CACHE_HPP
+#define IM_SERVICE_GROUP_GROUP_UNREAD_CACHE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "group_read_cursor_repository.hpp"
+
+namespace im {
+namespace service {
+namespace group {
+
+struct GroupUnreadCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    std::size_t users = 0;
+};
+
+// In-process LRU of per-user unread summaries. An entry is filled from one
+// GroupReadCursorRepository::unread_summary() query and then kept current by
+// send and read-ack events, so repeated logins are served without touching
+// PostgreSQL. Anything the cache cannot update exactly drops the user entry.
+class GroupUnreadCache {
+public:
+    using FillTicket = uint64_t;
+
+    explicit GroupUnreadCache(std::size_t max_users = 10000);
+
+    std::optional<std::vector<GroupUnreadRow>> get(const std::string& user_uid);
+
+    // Take before querying the database. Any send, ack or invalidation that
+    // touches the user in between makes the matching put() a no-op, so a
+    // summary read before the event can never overwrite the update.
+    FillTicket begin_fill(const std::string& user_uid) const;
+    void put(const std::string& user_uid, std::vector<GroupUnreadRow> rows,
+             FillTicket ticket);
+
+    // A new message in group_id: bump every cached member except the sender.
+    void on_message(uint64_t group_id, uint64_t msg_id,
+                    const std::string& sender_uid,
+                    const std::vector<std::string>& member_uids);
+
+    // The user acknowledged reading up to msg_id in group_id.
+    void on_read(uint64_t group_id, const std::string& user_uid, uint64_t msg_id);
+
+    void invalidate(const std::string& user_uid);
+
+    GroupUnreadCacheStats stats() const;
+
+private:
+    struct Entry {
+        std::vector<GroupUnreadRow> rows;  // sorted by group_id
+        std::list<std::string>::iterator lru_it;
+    };
+
+    static constexpr std::size_t kStripes = 256;
+
+    static GroupUnreadRow* find_row(Entry& entry, uint64_t group_id);
+    static std::size_t stripe(const std::string& user_uid);
+    void touch(Entry& entry);
+
+    const std::size_t max_users_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::list<std::string> lru_;
+    std::array<uint64_t, kStripes> stripes_{};
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+};
+
+} // namespace group
+} // namespace service
+} // namespace im
+
+#endif // IM_SERVICE_GROUP_GROUP_UNREAD_CACHE_HPP
@@ -0,0 +1,59 @@
+#include "message_partition_manager.hpp"
+
+#include <string>
+#include <utility>
+
+#include <odb/exceptions.hxx>
+#include <odb/pgsql/database.hxx>
+#include <odb/pgsql/transaction.hxx>
+
+#include "pgsql/native_query.hpp"
+
+namespace im {
+namespace service {
+namespace message {
+
+namespace {
+
+struct PartitionedTable {
+    const char* name;
+    const char* key_column;
+};
+
+constexpr PartitionedTable kPartitionedTables[] = {
+    {"im_messages", "create_time"},
+    {"im_group_messages", "created_at"},
+};
+
+} // namespace
+
+MessagePartitionManager::MessagePartitionManager(
+    std::shared_ptr<odb::pgsql::database> db)
+    : db_(std::move(db)) {}
+
+PartitionEnsureResult MessagePartitionManager::ensure_upcoming(int64_t now_ms,
+                                                               int months_ahead)
+{
+    PartitionEnsureResult result;
+    try {
+        odb::pgsql::transaction t(db_->begin());
+        for (const auto& table : kPartitionedTables) {
+            auto r = im::db::native_query(
+                "SELECT im_ensure_monthly_partitions($1, $2, $3, $4)",
+                {table.name, table.key_column, std::to_string(now_ms),
+                 std::to_string(months_ahead > 0 ? months_ahead : 0)});
+            if (r.rows() > 0) {
+                result.created += static_cast<int>(r.int64(0, 0));
+            }
+        }
+        t.commit();
+        result.ok = true;
+    } catch (const odb::exception&) {
+        result.created = 0;
+    }
+    return result;
+}
+
+} // namespace message
+} // namespace service
+} // namespace im
@@ -0,0 +1,42 @@
+#ifndef IM_SERVICE_MESSAGE_MESSAGE_PARTITION_MANAGER_HPP
+#define IM_SERVICE_MESSAGE_MESSAGE_PARTITION_MANAGER_HPP
+
+#include <cstdint>
+#include <memory>
+
+namespace odb {
+namespace pgsql {
+class database;
+}
+}
+
+namespace im {
+namespace service {
+namespace message {
+
+struct PartitionEnsureResult {
+    bool ok = false;
+    int created = 0;
+};
+
+// Keeps monthly partitions of im_messages and im_group_messages created ahead
+// of time. The tables are converted by db/migrations/004; this only calls the
+// im_ensure_monthly_partitions() helper installed there. On an unpartitioned
+// schema the call fails and ok stays false, which callers treat as a warning.
+class MessagePartitionManager {
+public:
+    explicit MessagePartitionManager(std::shared_ptr<odb::pgsql::database> db);
+
+    // Creates partitions for the month containing now_ms and the following
+    // months_ahead months, for every message table.
+    PartitionEnsureResult ensure_upcoming(int64_t now_ms, int months_ahead);
+
+private:
+    std::shared_ptr<odb::pgsql::database> db_;
+};
+
+} // namespace message
+} // namespace service
+} // namespace im
+
+#endif // IM_SERVICE_MESSAGE_MESSAGE_PARTITION_MANAGER_HPP
@@ -1,11 +1,16 @@
 #include "message_repository.hpp"
 
+#include <algorithm>
+#include <string>
 #include <utility>
 
 #include <odb/database.hxx>
 #include <odb/pgsql/database.hxx>
 #include <odb/transaction.hxx>
 #include <odb/query.hxx>
+#include <odb/pgsql/transaction.hxx>
+
+#include "pgsql/native_query.hpp"
 
 #include <message.hpp>
 #include <message-odb.hxx>
@@ -14,6 +19,23 @@ namespace im {
 namespace service {
 namespace message {
 
+namespace {
+
+// PostgreSQL array literal for a BIGINT[] parameter.
+std::string to_id_array(const std::vector<uint64_t>& msg_ids) {
+    std::string id_array = "{";
+    for (std::size_t i = 0; i < msg_ids.size(); ++i) {
+        if (i != 0) {
+            id_array += ',';
+        }
+        id_array += std::to_string(msg_ids[i]);
+    }
+    id_array += '}';
+    return id_array;
+}
+
+} // namespace
+
 MessageRepository::MessageRepository(std::shared_ptr<odb::pgsql::database> db)
     : db_(std::move(db)) {}
 
@@ -51,19 +73,25 @@ std::vector<Message> MessageRepository::find_conversation(
     std::vector<Message> results;
     try {
         odb::transaction t(db_->begin());
+        // The time bound sits at the top level of the WHERE clause and the
+        // LIMIT is pushed into SQL, so partitions past before_time are pruned
+        // and the ordered scan stops once enough rows have been read. The
+        // newest page is read and then returned oldest-first.
         odb::query<Message> q =
-            (odb::query<Message>::sender_uid == user_a &&
-             odb::query<Message>::receiver_uid == user_b &&
-             odb::query<Message>::create_time < before_time) ||
-            (odb::query<Message>::sender_uid == user_b &&
-             odb::query<Message>::receiver_uid == user_a &&
-             odb::query<Message>::create_time < before_time);
-        odb::result<Message> r(db_->query<Message>(q + "ORDER BY create_time"));
-        for (auto it = r.begin(); it != r.end() && static_cast<int>(results.size()) < limit; ++it) {
-            results.push_back(*it);
+            odb::query<Message>::create_time < before_time &&
+            ((odb::query<Message>::sender_uid == user_a &&
+              odb::query<Message>::receiver_uid == user_b) ||
+             (odb::query<Message>::sender_uid == user_b &&
+              odb::query<Message>::receiver_uid == user_a));
+        odb::result<Message> r(db_->query<Message>(
+            q + "ORDER BY create_time DESC LIMIT " + std::to_string(limit)));
+        for (const auto& m : r) {
+            results.push_back(m);
         }
         t.commit();
+        std::reverse(results.begin(), results.end());
     } catch (const odb::exception&) {
+        results.clear();
     }
     return results;
 }
@@ -80,9 +108,33 @@ std::vector<Message> MessageRepository::find_offline(
             odb::query<Message>::receiver_uid == receiver_uid &&
             odb::query<Message>::status == MessageStatus::SENT &&
             odb::query<Message>::create_time < before_time;
-        odb::result<Message> r(db_->query<Message>(q + "ORDER BY create_time"));
-        for (auto it = r.begin(); it != r.end() && static_cast<int>(results.size()) < limit; ++it) {
-            results.push_back(*it);
+        odb::result<Message> r(db_->query<Message>(
+            q + "ORDER BY create_time LIMIT " + std::to_string(limit)));
+        for (const auto& m : r) {
+            results.push_back(m);
+        }
+        t.commit();
+    } catch (const odb::exception&) {
+    }
+    return results;
+}
+
+std::vector<Message> MessageRepository::find_offline_after(
+    const std::string& receiver_uid,
+    uint64_t after_msg_id,
+    int limit)
+{
+    std::vector<Message> results;
+    try {
+        odb::transaction t(db_->begin());
+        odb::query<Message> q =
+            odb::query<Message>::receiver_uid == receiver_uid &&
+            odb::query<Message>::status == MessageStatus::SENT &&
+            odb::query<Message>::msg_id > after_msg_id;
+        odb::result<Message> r(db_->query<Message>(
+            q + "ORDER BY msg_id LIMIT " + std::to_string(limit)));
+        for (const auto& m : r) {
+            results.push_back(m);
         }
         t.commit();
     } catch (const odb::exception&) {
@@ -105,6 +157,59 @@ bool MessageRepository::mark_delivered(uint64_t msg_id, int64_t delivered_time)
     }
 }
 
+std::size_t MessageRepository::mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                                   int64_t delivered_time) {
+    if (msg_ids.empty()) {
+        return 0;
+    }
+
+    try {
+        odb::pgsql::transaction t(db_->begin());
+        auto r = im::db::native_query(
+            R"(UPDATE "im_messages"
+                  SET "status" = $1, "delivered_time" = $2
+                WHERE "msg_id" = ANY($3::BIGINT[]) AND "status" = $4)",
+            {std::to_string(static_cast<int>(MessageStatus::DELIVERED)),
+             std::to_string(delivered_time),
+             to_id_array(msg_ids),
+             std::to_string(static_cast<int>(MessageStatus::SENT))});
+        t.commit();
+        return static_cast<std::size_t>(r.affected());
+    } catch (const odb::exception&) {
+        return 0;
+    }
+}
+
+std::vector<uint64_t> MessageRepository::mark_delivered_ids(const std::string& receiver_uid,
+                                                            const std::vector<uint64_t>& msg_ids,
+                                                            int64_t delivered_time) {
+    std::vector<uint64_t> changed;
+    if (msg_ids.empty()) {
+        return changed;
+    }
+    try {
+        odb::pgsql::transaction t(db_->begin());
+        auto r = im::db::native_query(
+            R"(UPDATE "im_messages"
+                  SET "status" = $1, "delivered_time" = $2
+                WHERE "receiver_uid" = $3 AND "status" = $4 AND "msg_id" = ANY($5::BIGINT[])
+            RETURNING "msg_id")",
+            {std::to_string(static_cast<int>(MessageStatus::DELIVERED)),
+             std::to_string(delivered_time),
+             receiver_uid,
+             std::to_string(static_cast<int>(MessageStatus::SENT)),
+             to_id_array(msg_ids)});
+        t.commit();
+        changed.reserve(static_cast<std::size_t>(r.rows()));
+        for (int i = 0; i < r.rows(); ++i) {
+            changed.push_back(r.uint64(i, 0));
+        }
+    } catch (const odb::exception&) {
+        changed.clear();
+    }
+    return changed;
+}
+
 bool MessageRepository::mark_read(uint64_t msg_id, int64_t read_time) {
     try {
         odb::transaction t(db_->begin());
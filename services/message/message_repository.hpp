@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include <cstddef>
 #include <cstdint>
 
 namespace odb {
@@ -26,6 +27,8 @@ public:
 
     bool create(Message& msg);
     std::optional<Message> find_by_id(uint64_t msg_id);
+    // The newest `limit` messages between the pair created before
+    // before_time, returned in ascending create_time order.
     std::vector<Message> find_conversation(const std::string& user_a,
                                             const std::string& user_b,
                                             int64_t before_time,
@@ -33,7 +36,23 @@ public:
     std::vector<Message> find_offline(const std::string& receiver_uid,
                                        int64_t before_time,
                                        int limit);
+    // Undelivered messages for receiver_uid with msg_id > after_msg_id,
+    // ascending by msg_id (forward paging for connect-time catch-up).
+    std::vector<Message> find_offline_after(const std::string& receiver_uid,
+                                             uint64_t after_msg_id,
+                                             int limit);
     bool mark_delivered(uint64_t msg_id, int64_t delivered_time);
+    // Marks every still-SENT message in msg_ids delivered with one UPDATE.
+    // Returns the number of rows changed; messages already delivered or read
+    // are left untouched.
+    std::size_t mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                     int64_t delivered_time);
+    // Client ack: marks the still-SENT messages in msg_ids that are
+    // addressed to receiver_uid delivered in one UPDATE. Returns the ids
+    // that changed.
+    std::vector<uint64_t> mark_delivered_ids(const std::string& receiver_uid,
+                                             const std::vector<uint64_t>& msg_ids,
+                                             int64_t delivered_time);
     bool mark_read(uint64_t msg_id, int64_t read_time);
 
 private:
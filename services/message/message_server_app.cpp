@@ -1,5 +1,6 @@
 #include "message_server_app.hpp"
 
+#include <chrono>
 #include <exception>
 #include <utility>
 
@@ -20,6 +21,7 @@ MessageServerApp::MessageServerApp(MessageServerConfig config)
         db_ = std::make_shared<odb::pgsql::database>(config_.postgres_connection_string);
         message_service_ = std::make_unique<MessageService>(db_);
         grpc_service_ = std::make_unique<MessageGrpcService>(message_service_.get());
+        partition_manager_ = std::make_unique<MessagePartitionManager>(db_);
     }
 }
 
@@ -38,6 +40,8 @@ bool MessageServerApp::start() {
         return false;
     }
 
+    ensure_partitions();
+
     ::grpc::ServerBuilder builder;
     int selected_port = 0;
     builder.AddListeningPort(config_.listen_address,
@@ -54,9 +58,56 @@ bool MessageServerApp::start() {
     selected_port_ = selected_port;
     logger_->info("Message gRPC server listening on {} (selected port {})",
                   config_.listen_address, selected_port_);
+    start_partition_maintenance();
     return true;
 }
 
+void MessageServerApp::ensure_partitions() {
+    if (!partition_manager_ || config_.partition_months_ahead <= 0) {
+        return;
+    }
+
+    const auto now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const auto result = partition_manager_->ensure_upcoming(now_ms, config_.partition_months_ahead);
+    if (!result.ok) {
+        logger_->warn("Message partition maintenance skipped; "
+                      "apply db/migrations/004_message_partitioning.sql to enable it");
+        return;
+    }
+    logger_->info("Message partitions ensured {} months ahead ({} created)",
+                  config_.partition_months_ahead, result.created);
+}
+
+void MessageServerApp::start_partition_maintenance() {
+    if (!partition_manager_ || config_.partition_months_ahead <= 0 ||
+        config_.partition_maintenance_interval <= std::chrono::seconds::zero()) {
+        return;
+    }
+
+    partition_stopping_ = false;
+    partition_thread_ = std::thread([this] {
+        std::unique_lock<std::mutex> lock(partition_mutex_);
+        while (!partition_cv_.wait_for(lock, config_.partition_maintenance_interval,
+                                       [this] { return partition_stopping_; })) {
+            lock.unlock();
+            ensure_partitions();
+            lock.lock();
+        }
+    });
+}
+
+void MessageServerApp::stop_partition_maintenance() {
+    {
+        std::lock_guard<std::mutex> lock(partition_mutex_);
+        partition_stopping_ = true;
+    }
+    partition_cv_.notify_all();
+    if (partition_thread_.joinable()) {
+        partition_thread_.join();
+    }
+}
+
 void MessageServerApp::wait() {
     if (server_) {
         server_->Wait();
@@ -66,7 +117,11 @@ void MessageServerApp::wait() {
 void MessageServerApp::shutdown() {
     if (server_) {
         logger_->info("Stopping Message gRPC server on {}", config_.listen_address);
+        stop_partition_maintenance();
         server_->Shutdown();
+        const auto cache = message_service_->history_cache_stats();
+        logger_->info("History cache: hits={} misses={} hit_ratio={:.3f} entries={}",
+                      cache.hits, cache.misses, cache.hit_ratio(), cache.entries);
         server_.reset();
         selected_port_ = 0;
     }
@@ -1,13 +1,18 @@
 #ifndef IM_SERVICE_MESSAGE_MESSAGE_SERVER_APP_HPP
 #define IM_SERVICE_MESSAGE_MESSAGE_SERVER_APP_HPP
 
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include <grpcpp/server.h>
 #include <spdlog/logger.h>
 
 #include "message_grpc_service.hpp"
+#include "message_partition_manager.hpp"
 #include "message_service.hpp"
 
 namespace odb::pgsql {
@@ -19,6 +24,13 @@ namespace im::service::message {
 struct MessageServerConfig {
     std::string listen_address = "0.0.0.0:9002";
     std::string postgres_connection_string;
+    // Monthly message partitions to keep created beyond the current month.
+    // Zero or less disables partition maintenance.
+    int partition_months_ahead = 3;
+    // Maintenance runs on start and then at this interval while the server is
+    // up, so a long-running process keeps creating months before rows for
+    // them fall into the default partition.
+    std::chrono::seconds partition_maintenance_interval{6 * 3600};
 };
 
 class MessageServerApp {
@@ -38,13 +50,23 @@ public:
     bool is_running() const { return static_cast<bool>(server_); }
 
 private:
+    void ensure_partitions();
+    void start_partition_maintenance();
+    void stop_partition_maintenance();
+
     MessageServerConfig config_;
     std::shared_ptr<odb::pgsql::database> db_;
     std::unique_ptr<MessageService> message_service_;
     std::unique_ptr<MessageGrpcService> grpc_service_;
+    std::unique_ptr<MessagePartitionManager> partition_manager_;
     std::unique_ptr<::grpc::Server> server_;
     std::shared_ptr<spdlog::logger> logger_;
     int selected_port_ = 0;
+
+    std::thread partition_thread_;
+    std::mutex partition_mutex_;
+    std::condition_variable partition_cv_;
+    bool partition_stopping_ = false;
 };
 
 }  // namespace im::service::message
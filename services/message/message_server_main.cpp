@@ -1,3 +1,4 @@
+#include <chrono>
 #include <exception>
 #include <filesystem>
 #include <iostream>
@@ -21,6 +22,8 @@ struct MessageServerRuntimeConfig {
     std::string pg_user = "mychat";
     std::string pg_password = "mychat-dev-pass";
     std::string log_level = "info";
+    int partition_months_ahead = 3;
+    int partition_maintenance_interval_sec = 6 * 3600;
 };
 
 MessageServerRuntimeConfig g_config;
@@ -97,6 +100,13 @@ int main(int argc, char** argv) {
             "postgres.password", "MYCHAT_DB_PASSWORD", g_config.pg_password);
         g_config.log_level = config.getWithEnv<std::string>(
             "message.log_level", "MYCHAT_LOG_LEVEL", g_config.log_level);
+        g_config.partition_months_ahead = config.getWithEnv<int>(
+            "message.partition_months_ahead", "MYCHAT_MESSAGE_PARTITION_MONTHS_AHEAD",
+            g_config.partition_months_ahead);
+        g_config.partition_maintenance_interval_sec = config.getWithEnv<int>(
+            "message.partition_maintenance_interval_sec",
+            "MYCHAT_MESSAGE_PARTITION_MAINTENANCE_INTERVAL_SEC",
+            g_config.partition_maintenance_interval_sec);
 
         im::utils::LogManager::SetLogLevel(g_config.log_level);
         if (!im::utils::ServiceIdentityManager::getInstance().initializeFromEnv("message")) {
@@ -107,6 +117,9 @@ int main(int argc, char** argv) {
         im::service::message::MessageServerConfig server_config;
         server_config.listen_address = g_config.listen_address;
         server_config.postgres_connection_string = build_pg_connection_string(g_config);
+        server_config.partition_months_ahead = g_config.partition_months_ahead;
+        server_config.partition_maintenance_interval =
+            std::chrono::seconds(g_config.partition_maintenance_interval_sec);
 
         im::service::message::MessageServerApp server(server_config);
         g_server = &server;
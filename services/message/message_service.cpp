@@ -3,13 +3,27 @@
 
 #include <message.hpp>
 
+#include <cstddef>
+#include <utility>
+
 namespace im {
 namespace service {
 namespace message {
 
+namespace {
+
+// History pages are at most 200 rows (gateway clamp) and default to 50; a
+// window of 100 serves the default first page plus one page of new traffic.
+constexpr std::size_t kHistoryCachePerConversation = 100;
+constexpr std::size_t kHistoryCacheMaxConversations = 10000;
+
+} // namespace
+
 MessageService::MessageService(std::shared_ptr<odb::pgsql::database> db)
     : db_(std::move(db))
-    , repo_(std::make_unique<MessageRepository>(db_)) {}
+    , repo_(std::make_unique<MessageRepository>(db_))
+    , history_cache_(std::make_unique<ConversationHistoryCache>(
+          kHistoryCachePerConversation, kHistoryCacheMaxConversations)) {}
 
 MessageService::~MessageService() = default;
 
@@ -53,6 +67,8 @@ SendResult MessageService::send_text_message(const SendRequest& request) {
 
     result.ok = true;
     result.data = to_data(persisted.value());
+    history_cache_->append(conversation_key(request.sender_uid, request.receiver_uid),
+                           result.data);
     return result;
 }
 
@@ -62,10 +78,37 @@ std::vector<MessageData> MessageService::get_conversation(
     int64_t before_time,
     int limit)
 {
+    const int64_t before = before_time > 0 ? before_time : INT64_MAX;
+    const int page = limit > 0 ? limit : 50;
+    const std::string key = conversation_key(user_a, user_b);
+
+    if (auto cached = history_cache_->find(key, before, page)) {
+        return std::move(*cached);
+    }
+
+    // Cold conversation: load its newest window once, then answer from it
+    // when the requested page falls inside.
+    if (history_cache_->enabled() && !history_cache_->contains(key)) {
+        const auto ticket = history_cache_->begin_fill(key);
+        const auto capacity = history_cache_->capacity();
+        auto newest = repo_->find_conversation(user_a, user_b, INT64_MAX,
+                                               static_cast<int>(capacity));
+        if (newest.empty()) {
+            return {};
+        }
+        std::vector<MessageData> window;
+        window.reserve(newest.size());
+        for (const auto& msg : newest) {
+            window.push_back(to_data(msg));
+        }
+        history_cache_->fill(key, std::move(window), newest.size() < capacity, ticket);
+        if (auto cached = history_cache_->find(key, before, page, false)) {
+            return std::move(*cached);
+        }
+    }
+
     std::vector<MessageData> results;
-    auto msgs = repo_->find_conversation(user_a, user_b,
-                                          before_time > 0 ? before_time : INT64_MAX,
-                                          limit > 0 ? limit : 50);
+    auto msgs = repo_->find_conversation(user_a, user_b, before, page);
     for (const auto& msg : msgs) {
         results.push_back(to_data(msg));
     }
@@ -87,12 +130,80 @@ std::vector<MessageData> MessageService::pull_offline(
     return results;
 }
 
+std::vector<MessageData> MessageService::pull_offline_after(
+    const std::string& receiver_uid,
+    uint64_t after_msg_id,
+    int limit)
+{
+    std::vector<MessageData> results;
+    auto msgs = repo_->find_offline_after(receiver_uid, after_msg_id, limit > 0 ? limit : 50);
+    results.reserve(msgs.size());
+    for (const auto& msg : msgs) {
+        results.push_back(to_data(msg));
+    }
+    return results;
+}
+
 bool MessageService::mark_delivered(uint64_t msg_id, int64_t delivered_time) {
-    return repo_->mark_delivered(msg_id, delivered_time);
+    if (!repo_->mark_delivered(msg_id, delivered_time)) {
+        return false;
+    }
+    history_cache_->update(msg_id, [delivered_time](MessageData& data) {
+        data.status = MessageStatus::DELIVERED;
+        data.delivered_time = delivered_time;
+    });
+    return true;
+}
+
+std::size_t MessageService::mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                                int64_t delivered_time) {
+    const std::size_t marked = repo_->mark_delivered_batch(msg_ids, delivered_time);
+    if (marked == 0) {
+        return 0;
+    }
+    for (uint64_t msg_id : msg_ids) {
+        history_cache_->update(msg_id, [delivered_time](MessageData& data) {
+            if (data.status == MessageStatus::SENT) {
+                data.status = MessageStatus::DELIVERED;
+                data.delivered_time = delivered_time;
+            }
+        });
+    }
+    return marked;
+}
+
+std::size_t MessageService::mark_delivered_ids(const std::string& receiver_uid,
+                                              const std::vector<uint64_t>& msg_ids,
+                                              int64_t delivered_time) {
+    const auto changed = repo_->mark_delivered_ids(receiver_uid, msg_ids, delivered_time);
+    for (uint64_t msg_id : changed) {
+        history_cache_->update(msg_id, [delivered_time](MessageData& data) {
+            data.status = MessageStatus::DELIVERED;
+            data.delivered_time = delivered_time;
+        });
+    }
+    return changed.size();
 }
 
 bool MessageService::mark_read(uint64_t msg_id, int64_t read_time) {
-    return repo_->mark_read(msg_id, read_time);
+    if (!repo_->mark_read(msg_id, read_time)) {
+        return false;
+    }
+    history_cache_->update(msg_id, [read_time](MessageData& data) {
+        data.status = MessageStatus::READ;
+        data.read_time = read_time;
+    });
+    return true;
+}
+
+im::utils::RecentMessageCacheStats MessageService::history_cache_stats() const {
+    return history_cache_->stats();
+}
+
+std::string MessageService::conversation_key(const std::string& user_a,
+                                             const std::string& user_b) {
+    // '\x1f' (unit separator) never appears in uids.
+    return user_a < user_b ? user_a + '\x1f' + user_b : user_b + '\x1f' + user_a;
 }
 
 MessageData MessageService::to_data(const Message& msg) const {
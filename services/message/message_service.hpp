@@ -6,8 +6,11 @@
 #include <string>
 #include <vector>
 
+#include <cstddef>
 #include <cstdint>
 
+#include "../../common/utils/recent_message_cache.hpp"
+
 namespace odb {
 namespace pgsql {
 class database;
@@ -51,6 +54,11 @@ struct SendResult {
 
 class MessageRepository;
 
+// Newest messages per conversation, keyed by the ordered uid pair.
+using ConversationHistoryCache =
+    im::utils::RecentMessageCache<std::string, MessageData,
+                                  &MessageData::create_time, &MessageData::msg_id>;
+
 class MessageService {
 public:
     explicit MessageService(std::shared_ptr<odb::pgsql::database> db);
@@ -64,14 +72,33 @@ public:
     std::vector<MessageData> pull_offline(const std::string& receiver_uid,
                                            int64_t before_time,
                                            int limit);
+    // Forward paging over undelivered messages, ascending by msg_id.
+    std::vector<MessageData> pull_offline_after(const std::string& receiver_uid,
+                                                 uint64_t after_msg_id,
+                                                 int limit);
     bool mark_delivered(uint64_t msg_id, int64_t delivered_time);
+    // Bulk form used by the gateway's offline catch-up; returns the number of
+    // messages that moved from SENT to DELIVERED.
+    std::size_t mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                     int64_t delivered_time);
+    // Client ack for the msg_ids a session of receiver_uid received; ids
+    // addressed to anyone else are ignored. Returns the number of messages
+    // that moved from SENT to DELIVERED.
+    std::size_t mark_delivered_ids(const std::string& receiver_uid,
+                                   const std::vector<uint64_t>& msg_ids,
+                                   int64_t delivered_time);
     bool mark_read(uint64_t msg_id, int64_t read_time);
 
+    im::utils::RecentMessageCacheStats history_cache_stats() const;
+
 private:
     MessageData to_data(const Message& msg) const;
+    static std::string conversation_key(const std::string& user_a,
+                                        const std::string& user_b);
 
     std::shared_ptr<odb::pgsql::database> db_;
     std::unique_ptr<MessageRepository> repo_;
+    std::unique_ptr<ConversationHistoryCache> history_cache_;
 };
 
 } // namespace message
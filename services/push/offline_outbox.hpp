@@ -0,0 +1,42 @@
+#ifndef SERVICES_PUSH_OFFLINE_OUTBOX_HPP
+#define SERVICES_PUSH_OFFLINE_OUTBOX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "push_notifier.hpp"
+
+namespace im::service::push {
+
+struct OfflineEntry {
+    uint64_t msg_id = 0;
+    std::string content;
+    PushContext context;
+};
+
+// Per-user queue of direct messages that could not be pushed live, ordered by
+// msg_id. It is a delivery accelerator only: PostgreSQL message status stays
+// the source of truth, so a lost or trimmed outbox entry is still recovered by
+// the offline pull path.
+class OfflineOutbox {
+public:
+    virtual ~OfflineOutbox() = default;
+
+    virtual bool append(const std::string& receiver_uid, const OfflineEntry& entry) = 0;
+
+    // Up to `limit` entries with msg_id > after_msg_id, ascending.
+    virtual std::vector<OfflineEntry> peek(const std::string& receiver_uid,
+                                           uint64_t after_msg_id,
+                                           std::size_t limit) = 0;
+
+    // Drops entries with from_msg_id <= msg_id <= to_msg_id (delivered-ack).
+    virtual void ack_range(const std::string& receiver_uid,
+                           uint64_t from_msg_id,
+                           uint64_t to_msg_id) = 0;
+};
+
+} // namespace im::service::push
+
+#endif // SERVICES_PUSH_OFFLINE_OUTBOX_HPP
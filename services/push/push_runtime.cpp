@@ -1,7 +1,9 @@
 #include "push_runtime.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <sstream>
+#include <unordered_set>
 #include <utility>
 
 #include "../../common/network/protobuf_codec.hpp"
@@ -90,6 +92,18 @@ void PushRuntime::set_fanout_policy(std::unique_ptr<FanoutPolicy> policy) {
     fanout_policy_ = std::move(policy);
 }
 
+void PushRuntime::set_offline_outbox(std::shared_ptr<OfflineOutbox> outbox) {
+    offline_outbox_ = std::move(outbox);
+}
+
+void PushRuntime::set_pending_source(std::shared_ptr<OfflineOutbox> source) {
+    pending_source_ = std::move(source);
+}
+
+void PushRuntime::set_require_client_ack(bool required) {
+    require_client_ack_ = required;
+}
+
 void PushRuntime::notify_user(const std::string& receiver_uid,
                               uint64_t msg_id,
                               const std::string& content,
@@ -104,12 +118,14 @@ void PushRuntime::notify_user(const std::string& receiver_uid,
         if (sessions.empty()) {
             logger_->debug("No online sessions for receiver {}, message stays undelivered",
                            receiver_uid);
+            enqueue_offline(receiver_uid, msg_id, content, context);
             return;
         }
 
         auto selected = fanout_policy_->select_sessions(sessions);
         if (selected.empty()) {
             logger_->debug("Fanout policy selected 0 sessions for user {}", receiver_uid);
+            enqueue_offline(receiver_uid, msg_id, content, context);
             return;
         }
 
@@ -119,10 +135,11 @@ void PushRuntime::notify_user(const std::string& receiver_uid,
             return;
         }
 
+        const std::vector<uint64_t> msg_ids{msg_id};
         int success_count = 0;
         for (const auto& session_id : selected) {
             try {
-                if (payload_sender_->send_payload(session_id, payload)) {
+                if (payload_sender_->send_messages(session_id, payload, msg_ids)) {
                     ++success_count;
                 }
             } catch (const std::exception& e) {
@@ -131,18 +148,213 @@ void PushRuntime::notify_user(const std::string& receiver_uid,
         }
 
         if (success_count > 0) {
-            delivery_marker_->mark_delivered(msg_id, now_ms());
-            logger_->info("Pushed message {} to {}/{} sessions of user {}, marked delivered",
-                          msg_id, success_count, selected.size(), receiver_uid);
+            if (!require_client_ack_) {
+                delivery_marker_->mark_delivered(msg_id, now_ms());
+            }
+            logger_->info("Pushed message {} to {}/{} sessions of user {}{}",
+                          msg_id, success_count, selected.size(), receiver_uid,
+                          require_client_ack_ ? ", awaiting client ack" : ", marked delivered");
         } else {
             logger_->info("No session accepted push for message {} to user {}, stays undelivered",
                           msg_id, receiver_uid);
+            enqueue_offline(receiver_uid, msg_id, content, context);
         }
     } catch (const std::exception& e) {
         logger_->error("Exception in PushRuntime::notify_user: {}", e.what());
     }
 }
 
+std::size_t PushRuntime::push_transient(const std::string& receiver_uid,
+                                        const std::string& payload) {
+    if (!session_provider_ || !payload_sender_ || !fanout_policy_ || payload.empty()) {
+        return 0;
+    }
+
+    std::size_t accepted = 0;
+    try {
+        const auto sessions = session_provider_->get_sessions(receiver_uid);
+        if (sessions.empty()) {
+            return 0;
+        }
+        for (const auto& session_id : fanout_policy_->select_sessions(sessions)) {
+            try {
+                if (payload_sender_->send_payload(session_id, payload)) {
+                    ++accepted;
+                }
+            } catch (const std::exception& e) {
+                logger_->warn("Push to session {} failed: {}", session_id, e.what());
+            }
+        }
+    } catch (const std::exception& e) {
+        logger_->error("Exception in PushRuntime::push_transient: {}", e.what());
+    }
+    return accepted;
+}
+
+struct PushRuntime::DrainJob {
+    std::string receiver_uid;
+    std::string session_id;
+    std::size_t remaining = 0;
+    DrainDone on_done;
+
+    std::vector<OfflineOutbox*> sources;
+    std::size_t source_index = 0;
+    uint64_t after_msg_id = 0;
+    bool source_exhausted = false;
+
+    // Current page, minus ids an earlier source already pushed; frames are
+    // cut from entries[begin..].
+    std::vector<OfflineEntry> entries;
+    std::size_t begin = 0;
+
+    std::size_t pushed = 0;
+    std::unordered_set<uint64_t> sent;
+};
+
+void PushRuntime::drain_offline(const std::string& receiver_uid,
+                                const std::string& session_id,
+                                std::size_t max_messages,
+                                DrainDone on_done) {
+    auto job = std::make_shared<DrainJob>();
+    job->receiver_uid = receiver_uid;
+    job->session_id = session_id;
+    job->remaining = max_messages;
+    job->on_done = std::move(on_done);
+    for (OfflineOutbox* source : {offline_outbox_.get(), pending_source_.get()}) {
+        if (source) {
+            job->sources.push_back(source);
+        }
+    }
+    if (!payload_sender_ || !delivery_marker_ || job->sources.empty()) {
+        finish_drain(*job, false);
+        return;
+    }
+    continue_drain(job);
+}
+
+void PushRuntime::continue_drain(const std::shared_ptr<DrainJob>& job) {
+    try {
+        while (job->remaining > 0) {
+            if (job->begin >= job->entries.size() && !load_page(*job)) {
+                finish_drain(*job, false);
+                return;
+            }
+
+            if (payload_sender_->pending_payloads(job->session_id) >= kSendWindow) {
+                payload_sender_->when_writable(
+                    job->session_id, kSendWindow, [this, job](bool writable) {
+                        if (writable) {
+                            continue_drain(job);
+                        } else {
+                            finish_drain(*job, true);
+                        }
+                    });
+                return;
+            }
+
+            // A frame takes at least one entry, then grows while the content
+            // stays under kBatchBytes.
+            const auto& entries = job->entries;
+            const std::size_t begin = job->begin;
+            const std::size_t limit = begin + std::min(job->remaining, entries.size() - begin);
+            std::size_t end = begin + 1;
+            std::size_t bytes = entries[begin].content.size();
+            while (end < limit && bytes + entries[end].content.size() <= kBatchBytes) {
+                bytes += entries[end].content.size();
+                ++end;
+            }
+
+            std::vector<uint64_t> msg_ids;
+            msg_ids.reserve(end - begin);
+            for (std::size_t i = begin; i < end; ++i) {
+                msg_ids.push_back(entries[i].msg_id);
+            }
+
+            const auto payload = build_batch_payload(job->receiver_uid, entries, begin, end);
+            if (payload.empty() ||
+                !payload_sender_->send_messages(job->session_id, payload, msg_ids)) {
+                finish_drain(*job, true);
+                return;
+            }
+            // With client acks the frame is only queued, not received: the
+            // entries stay in the source until the ack trims them.
+            if (!require_client_ack_) {
+                delivery_marker_->mark_delivered_batch(msg_ids, now_ms());
+                job->sources[job->source_index]->ack_range(job->receiver_uid, msg_ids.front(),
+                                                           msg_ids.back());
+            }
+            job->sent.insert(msg_ids.begin(), msg_ids.end());
+            job->pushed += msg_ids.size();
+            job->remaining -= msg_ids.size();
+            job->begin = end;
+        }
+        finish_drain(*job, false);
+    } catch (const std::exception& e) {
+        logger_->error("Exception in PushRuntime::drain_offline: {}", e.what());
+        finish_drain(*job, true);
+    }
+}
+
+bool PushRuntime::load_page(DrainJob& job) {
+    while (job.source_index < job.sources.size()) {
+        if (!job.source_exhausted) {
+            const std::size_t wanted = std::min(kBatchMessages, job.remaining);
+            auto entries = job.sources[job.source_index]->peek(job.receiver_uid,
+                                                                job.after_msg_id, wanted);
+            if (!entries.empty()) {
+                job.source_exhausted = entries.size() < wanted;
+                job.after_msg_id = entries.back().msg_id;
+                // With client acks the pending source still lists what the
+                // outbox just pushed; skip those rather than sending them twice.
+                entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                             [&job](const OfflineEntry& e) {
+                                                 return job.sent.count(e.msg_id) != 0;
+                                             }),
+                              entries.end());
+                if (!entries.empty()) {
+                    job.entries = std::move(entries);
+                    job.begin = 0;
+                    return true;
+                }
+                continue;
+            }
+        }
+        ++job.source_index;
+        job.after_msg_id = 0;
+        job.source_exhausted = false;
+    }
+    return false;
+}
+
+void PushRuntime::finish_drain(DrainJob& job, bool stopped_early) {
+    if (job.pushed > 0) {
+        logger_->info("Drained {} offline messages to session {} of user {}{}",
+                      job.pushed, job.session_id, job.receiver_uid,
+                      stopped_early ? " (stopped early)" : "");
+    }
+    if (job.on_done) {
+        auto on_done = std::move(job.on_done);
+        job.on_done = nullptr;
+        on_done(job.pushed);
+    }
+}
+
+void PushRuntime::enqueue_offline(const std::string& receiver_uid,
+                                  uint64_t msg_id,
+                                  const std::string& content,
+                                  const PushContext& context) {
+    // Group messages have no per-receiver delivery state in PostgreSQL and
+    // their ids come from a different sequence; group catch-up goes through
+    // read cursors instead.
+    if (!offline_outbox_ || context.conversation_type == "group") {
+        return;
+    }
+    if (!offline_outbox_->append(receiver_uid, OfflineEntry{msg_id, content, context})) {
+        logger_->warn("Failed to queue message {} in offline outbox of user {}",
+                      msg_id, receiver_uid);
+    }
+}
+
 std::string PushRuntime::build_payload(const std::string& receiver_uid,
                                        uint64_t msg_id,
                                        const std::string& content,
@@ -173,4 +385,34 @@ std::string PushRuntime::build_payload(const std::string& receiver_uid,
     return encoded;
 }
 
+std::string PushRuntime::build_batch_payload(const std::string& receiver_uid,
+                                             const std::vector<OfflineEntry>& entries,
+                                             std::size_t begin,
+                                             std::size_t end) const {
+    im::base::IMHeader push_header;
+    push_header.set_version("1.0");
+    push_header.set_cmd_id(im::command::CMD_PUSH_BATCH_MESSAGE);
+    push_header.set_from_uid(ServiceIdentityManager::getInstance().getDeviceId());
+    push_header.set_to_uid(receiver_uid);
+    push_header.set_timestamp(static_cast<uint64_t>(now_ms()));
+
+    im::push::PushBatchRequest batch;
+    batch.set_type(im::push::PUSH_OFFLINE);
+    for (std::size_t i = begin; i < end; ++i) {
+        const auto& entry = entries[i];
+        auto* item = batch.add_items();
+        item->set_msg_id(entry.msg_id);
+        item->set_content(entry.content);
+        item->set_sender_uid(entry.context.sender_uid);
+        item->set_conversation_type(entry.context.conversation_type);
+        item->set_conversation_id(entry.context.conversation_id);
+    }
+
+    std::string encoded;
+    if (!ProtobufCodec::encode(push_header, batch, encoded)) {
+        return "";
+    }
+    return encoded;
+}
+
 } // namespace im::service::push
@@ -1,7 +1,9 @@
 #ifndef SERVICES_PUSH_PUSH_RUNTIME_HPP
 #define SERVICES_PUSH_PUSH_RUNTIME_HPP
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -9,6 +11,7 @@
 #include <spdlog/logger.h>
 
 #include "fanout_policy.hpp"
+#include "offline_outbox.hpp"
 #include "push_notifier.hpp"
 
 namespace im::service::push {
@@ -27,6 +30,29 @@ public:
 
     virtual bool send_payload(const std::string& session_id,
                               const std::string& payload) = 0;
+
+    // send_payload for a frame carrying msg_ids. Senders that track what
+    // each session was sent, so client acks can be scoped to it, override
+    // this; the default just sends.
+    virtual bool send_messages(const std::string& session_id,
+                               const std::string& payload,
+                               const std::vector<uint64_t>& /*msg_ids*/) {
+        return send_payload(session_id, payload);
+    }
+
+    // Frames accepted for session_id but not yet written to the socket.
+    // Bulk senders wait for this to drop before queueing more.
+    virtual std::size_t pending_payloads(const std::string& /*session_id*/) { return 0; }
+
+    // Calls resume(true) once pending_payloads(session_id) is below window,
+    // or resume(false) if the session goes away first. Senders that can
+    // observe write completions resume from there; the default has none and
+    // answers from the current count straight away.
+    virtual void when_writable(const std::string& session_id,
+                               std::size_t window,
+                               std::function<void(bool)> resume) {
+        resume(pending_payloads(session_id) < window);
+    }
 };
 
 class PushDeliveryMarker {
@@ -34,6 +60,15 @@ public:
     virtual ~PushDeliveryMarker() = default;
 
     virtual bool mark_delivered(uint64_t msg_id, int64_t delivered_time) = 0;
+
+    virtual std::size_t mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                             int64_t delivered_time) {
+        std::size_t marked = 0;
+        for (uint64_t msg_id : msg_ids) {
+            marked += mark_delivered(msg_id, delivered_time) ? 1 : 0;
+        }
+        return marked;
+    }
 };
 
 // Core push delivery workflow independent of Gateway runtime types.
@@ -45,12 +80,80 @@ public:
 
     void set_fanout_policy(std::unique_ptr<FanoutPolicy> policy);
 
+    // Optional. When set, direct messages that reach no live session are
+    // queued here and replayed by drain_offline() on reconnect.
+    void set_offline_outbox(std::shared_ptr<OfflineOutbox> outbox);
+
+    // Optional. Authoritative store of undelivered messages (the message
+    // service), drained after the outbox so messages the outbox never saw or
+    // trimmed still reach the session. Never appended to.
+    void set_pending_source(std::shared_ptr<OfflineOutbox> source);
+
+    // When set, a successful send no longer marks the message delivered;
+    // the client's cumulative CMD_MESSAGE_DELIVERED ack does. Messages whose
+    // ack never arrives stay pending and are re-sent from the pending source
+    // on the next drain_offline(), so callers enabling this must also set
+    // one (the gateway turns connect-time catch-up on with client acks).
+    void set_require_client_ack(bool required);
+
     void notify_user(const std::string& receiver_uid,
                      uint64_t msg_id,
                      const std::string& content,
                      const PushContext& context = PushContext{}) override;
 
+    // Sends an encoded frame that is not a persisted message (presence
+    // changes, notices) to the receiver's sessions picked by the fanout
+    // policy. It has no msg_id, so it is never queued in the outbox or
+    // marked delivered; a receiver with no reachable session sees the
+    // current state when it next connects. Returns the sessions that
+    // accepted the frame.
+    std::size_t push_transient(const std::string& receiver_uid, const std::string& payload);
+
+    // Streams the receiver's outbox, then the pending source, to a freshly
+    // bound session in msg_id order. Messages are packed into
+    // CMD_PUSH_BATCH_MESSAGE frames (at most kBatchMessages entries and
+    // roughly kBatchBytes of content each); after every accepted frame its
+    // messages are marked delivered in one call and acked from the source,
+    // unless client acks are required, in which case the ack handler does
+    // both once the client confirms the frame.
+    // Keeps at most kSendWindow frames queued on the session: when the
+    // window is full the drain parks on the sender's when_writable() and
+    // continues from the write completion, so no thread waits on a slow
+    // reader. Stops at the first failed send, when the session closes, or
+    // after max_messages, then calls on_done with the number pushed.
+    using DrainDone = std::function<void(std::size_t pushed)>;
+    void drain_offline(const std::string& receiver_uid,
+                       const std::string& session_id,
+                       std::size_t max_messages = 1000,
+                       DrainDone on_done = {});
+
+    static constexpr std::size_t kBatchMessages = 100;
+    static constexpr std::size_t kBatchBytes = 64 * 1024;
+    static constexpr std::size_t kSendWindow = 4;
+
 private:
+    struct DrainJob;
+
+    // Sends frames until the job finishes or the send window fills; in the
+    // latter case re-enters itself from when_writable().
+    void continue_drain(const std::shared_ptr<DrainJob>& job);
+
+    // Loads the next page of the current source into job.entries, moving on
+    // to the next source when one is exhausted. False when none is left.
+    bool load_page(DrainJob& job);
+
+    void finish_drain(DrainJob& job, bool stopped_early);
+
+    std::string build_batch_payload(const std::string& receiver_uid,
+                                    const std::vector<OfflineEntry>& entries,
+                                    std::size_t begin,
+                                    std::size_t end) const;
+
+    void enqueue_offline(const std::string& receiver_uid,
+                         uint64_t msg_id,
+                         const std::string& content,
+                         const PushContext& context);
+
     std::string build_payload(const std::string& receiver_uid,
                               uint64_t msg_id,
                               const std::string& content,
@@ -60,6 +163,9 @@ private:
     PushPayloadSender* payload_sender_;
     PushDeliveryMarker* delivery_marker_;
     std::unique_ptr<FanoutPolicy> fanout_policy_;
+    std::shared_ptr<OfflineOutbox> offline_outbox_;
+    std::shared_ptr<OfflineOutbox> pending_source_;
+    bool require_client_ack_ = false;
     std::shared_ptr<spdlog::logger> logger_;
 };
 
@@ -166,6 +166,12 @@ RemoteGatewayPushPayloadSender::RemoteGatewayPushPayloadSender(
 
 bool RemoteGatewayPushPayloadSender::send_payload(const std::string& session_id,
                                                   const std::string& payload) {
+    return send_messages(session_id, payload, {});
+}
+
+bool RemoteGatewayPushPayloadSender::send_messages(const std::string& session_id,
+                                                   const std::string& payload,
+                                                   const std::vector<uint64_t>& msg_ids) {
     if (!client_) {
         logger_->warn("Remote Gateway payload send skipped: RPC client is not configured");
         return false;
@@ -174,6 +180,9 @@ bool RemoteGatewayPushPayloadSender::send_payload(const std::string& session_id,
     im::push::SendSessionPayloadRequest request;
     request.set_session_id(session_id);
     request.set_payload(payload);
+    for (uint64_t msg_id : msg_ids) {
+        request.add_msg_ids(msg_id);
+    }
 
     im::push::SendSessionPayloadResponse response;
     ::grpc::ClientContext context;
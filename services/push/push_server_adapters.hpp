@@ -101,6 +101,11 @@ public:
     bool send_payload(const std::string& session_id,
                       const std::string& payload) override;
 
+    // Forwards msg_ids so the Gateway can scope client acks to this session.
+    bool send_messages(const std::string& session_id,
+                       const std::string& payload,
+                       const std::vector<uint64_t>& msg_ids) override;
+
 private:
     std::shared_ptr<GatewayDeliveryRpcClient> client_;
     std::chrono::milliseconds timeout_;
@@ -312,3 +312,30 @@ TEST_F(AuthTokenTest, ConcurrentTokenLifecycleUsesRedisPool) {
     EXPECT_EQ(final.available_connections, 4u);
     EXPECT_EQ(final.active_connections, 0u);
 }
+
+TEST(AuthTokenWithoutRedisTest, RevocationCheckerReplacesRedisLookup) {
+    const auto config_path =
+            (std::filesystem::path(MYCHAT_SOURCE_DIR) / "config/dev.json").string();
+    std::vector<std::string> checked;
+    im::gateway::MultiPlatformAuthManager auth(
+            "test_secret_key_for_auth_token_tests", config_path,
+            [&checked](const std::string& jti) {
+                checked.push_back(jti);
+                return checked.size() > 1;
+            });
+
+    auto token = auth.generate_access_token("test-user", "alice", "device-1", "web");
+    ASSERT_FALSE(token.empty());
+
+    im::gateway::UserTokenInfo info;
+    EXPECT_TRUE(auth.verify_access_token(token, info));
+    EXPECT_EQ(info.user_id, "test-user");
+    EXPECT_EQ(info.token_id, checked.front());
+    EXPECT_FALSE(auth.verify_access_token(token, info));
+    ASSERT_EQ(checked.size(), 2u);
+    EXPECT_FALSE(checked.front().empty());
+
+    // The inline heartbeat path checks by jti without decoding the token again.
+    EXPECT_TRUE(auth.is_token_id_revoked(info.token_id));
+    EXPECT_EQ(checked.back(), info.token_id);
+}
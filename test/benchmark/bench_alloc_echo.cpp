@@ -0,0 +1,190 @@
+// 统计一次 WS 回显往返在网关侧触发的系统堆分配次数。
+//
+// 路径与 gateway_server 处理心跳帧一致：解包 → UnifiedMessage → ThreadPool
+// 处理（protobuf 对象建在请求 arena 上）→ 编码响应 → 进入会话发送队列 →
+// 写完出队。客户端编码不计入。
+//
+// 同一份源码构建两个程序：bench_alloc_echo 使用 SlabAllocator，
+// bench_alloc_echo_system 定义 IM_DISABLE_SLAB_ALLOCATOR 全部转发系统分配器，
+// 两者输出直接对比即可看出 slab 吸收了多少次分配。
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+
+#include "benchmark_codec.hpp"
+#include "common/network/protobuf_arena_pool.hpp"
+#include "common/network/protobuf_codec.hpp"
+#include "common/proto/base.pb.h"
+#include "common/proto/command.pb.h"
+#include "common/utils/slab_allocator.hpp"
+#include "common/utils/thread_pool.hpp"
+#include "gateway/message_processor/unified_message.hpp"
+
+namespace {
+
+std::atomic<uint64_t> g_allocs{0};
+std::atomic<uint64_t> g_bytes{0};
+
+void* counted_alloc(std::size_t bytes, std::size_t alignment = 0) {
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    void* p = alignment ? std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment)
+                        : std::malloc(bytes ? bytes : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+using SendQueue = std::deque<std::string, im::utils::SlabStlAllocator<std::string>>;
+
+std::string build_request_frame() {
+    im::base::IMHeader header;
+    header.set_version("1.0");
+    header.set_seq(1);
+    header.set_cmd_id(im::command::CMD_HEARTBEAT);
+    header.set_from_uid("bench-user");
+    header.set_token("bench-token-0123456789abcdef");
+    header.set_device_id("bench-device");
+    header.set_platform("bench");
+
+    im::base::BaseRequest request;
+    request.set_payload(std::string(64, 'x'));
+
+    std::string frame;
+    im::benchmark::BenchmarkCodec::encode(header, request, frame);
+    return frame;
+}
+
+/// 服务端一次往返；返回 false 表示解包或编码失败。
+bool echo_round_trip(const std::string& frame, SendQueue& send_queue) {
+    using im::gateway::UnifiedMessage;
+
+    im::base::IMHeader header;
+    std::string type_name;
+    std::string payload;
+    if (!im::network::ProtobufCodec::decodeEnvelope(frame, header, type_name, payload)) {
+        return false;
+    }
+
+    auto message = std::make_unique<UnifiedMessage>();
+    message->set_header(std::move(header));
+    UnifiedMessage::SessionContext context;
+    context.protocol = UnifiedMessage::Protocol::WEBSOCKET;
+    context.session_id = "session_1";
+    context.receive_time = std::chrono::system_clock::now();
+    message->set_session_context(std::move(context));
+    message->set_protobuf_type_name(std::move(type_name));
+    message->set_protobuf_payload(std::move(payload));
+
+    auto future = im::utils::ThreadPool::GetInstance().Enqueue(
+            [msg = std::move(message)]() -> std::string {
+                auto* arena = msg->arena();
+                auto* request = google::protobuf::Arena::Create<im::base::BaseRequest>(arena);
+                request->ParseFromString(msg->get_protobuf_payload());
+
+                auto* response = google::protobuf::Arena::Create<im::base::BaseResponse>(arena);
+                response->set_error_code(im::base::ErrorCode::SUCCESS);
+                response->set_payload(request->payload());
+
+                auto* response_header = google::protobuf::Arena::Create<im::base::IMHeader>(arena);
+                im::network::ProtobufCodec::fillReturnHeader(
+                        msg->get_header(), "bench-gateway", "bench", response_header);
+                response_header->set_cmd_id(im::command::CMD_HEARTBEAT);
+
+                std::string encoded;
+                im::network::ProtobufCodec::encode(*response_header, *response, encoded);
+                return encoded;
+            });
+
+    std::string out = future.get();
+    if (out.empty()) {
+        return false;
+    }
+    send_queue.emplace_back(std::move(out));
+    send_queue.pop_front();  // 模拟 async_write 完成
+    return true;
+}
+
+}  // namespace
+
+void* operator new(std::size_t bytes) { return counted_alloc(bytes); }
+void* operator new[](std::size_t bytes) { return counted_alloc(bytes); }
+void* operator new(std::size_t bytes, std::align_val_t a) {
+    return counted_alloc(bytes, static_cast<std::size_t>(a));
+}
+void* operator new[](std::size_t bytes, std::align_val_t a) {
+    return counted_alloc(bytes, static_cast<std::size_t>(a));
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+int main(int argc, char* argv[]) {
+    int iterations = 100000;
+    int warmup = 10000;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--iterations" && i + 1 < argc) iterations = std::stoi(argv[++i]);
+        else if (arg == "--warmup" && i + 1 < argc) warmup = std::stoi(argv[++i]);
+        else if (arg == "--help") {
+            std::cout << "Usage: bench_alloc_echo [options]\n"
+                      << "  --iterations N          Measured round trips (default: 100000)\n"
+                      << "  --warmup N              Unmeasured round trips (default: 10000)\n";
+            return 0;
+        }
+    }
+    if (iterations <= 0) {
+        std::cerr << "--iterations must be positive" << std::endl;
+        return 1;
+    }
+
+    im::utils::ThreadPool::GetInstance().Init(1);
+    const std::string frame = build_request_frame();
+    SendQueue send_queue;
+
+    for (int i = 0; i < warmup; ++i) {
+        if (!echo_round_trip(frame, send_queue)) {
+            std::cerr << "echo round trip failed during warmup" << std::endl;
+            return 1;
+        }
+    }
+
+    const uint64_t allocs_before = g_allocs.load();
+    const uint64_t bytes_before = g_bytes.load();
+    for (int i = 0; i < iterations; ++i) {
+        echo_round_trip(frame, send_queue);
+    }
+    const uint64_t allocs = g_allocs.load() - allocs_before;
+    const uint64_t bytes = g_bytes.load() - bytes_before;
+
+    im::utils::ThreadPool::GetInstance().Shutdown();
+
+    const auto stats = im::utils::SlabAllocator::stats();
+#ifdef IM_DISABLE_SLAB_ALLOCATOR
+    std::cout << "allocator: system\n";
+#else
+    std::cout << "allocator: slab\n";
+#endif
+    std::cout << "frame bytes: " << frame.size() << "\n"
+              << "round trips: " << iterations << "\n"
+              << "heap allocations / round trip: "
+              << static_cast<double>(allocs) / iterations << "\n"
+              << "heap bytes / round trip: " << static_cast<double>(bytes) / iterations << "\n"
+              << "slab bytes: " << stats.slab_bytes
+              << " | central fetches: " << stats.central_fetches
+              << " | central releases: " << stats.central_releases << std::endl;
+    return 0;
+}
@@ -0,0 +1,174 @@
+// 空闲 WSS 连接在网关侧的常驻内存：N 条连接建立并各收发一帧后静置，
+// 服务端进程 RSS 增量 / N 即每条空闲连接的成本。
+//
+// 服务端与网关相同，直接使用 WebSocketServer / WebSocketSession；客户端在
+// fork 出的子进程里，不计入服务端 RSS。每条连接握手后发一帧、等一帧回包，
+// 读缓冲、发送队列、OpenSSL 记录缓冲都至少走过一次，测的是"用过之后"的空闲态。
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+
+#include "common/network/websocket_server.hpp"
+#include "common/network/websocket_session.hpp"
+
+namespace {
+
+namespace net = boost::asio;
+namespace ssl = net::ssl;
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+using tcp = net::ip::tcp;
+
+struct Options {
+    std::size_t connections = 2000;
+    unsigned short port = 19443;
+    std::string cert = "test/network/test_cert.pem";
+    std::string key = "test/network/test_key.pem";
+};
+
+uint64_t rss_bytes() {
+    std::ifstream statm("/proc/self/statm");
+    uint64_t size = 0, resident = 0;
+    statm >> size >> resident;
+    return resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+}
+
+// 子进程：建连、发一帧、收回包，然后保持空闲直到父进程关闭管道
+int run_clients(const Options& opt, int ready_fd, int hold_fd) {
+    net::io_context ioc;
+    ssl::context ctx(ssl::context::tlsv12_client);
+    ctx.set_verify_mode(ssl::verify_none);
+
+    std::vector<std::unique_ptr<websocket::stream<ssl::stream<tcp::socket>>>> clients;
+    clients.reserve(opt.connections);
+    const tcp::endpoint endpoint(net::ip::make_address("127.0.0.1"), opt.port);
+    for (std::size_t i = 0; i < opt.connections; ++i) {
+        auto ws = std::make_unique<websocket::stream<ssl::stream<tcp::socket>>>(ioc, ctx);
+        beast::error_code ec;
+        for (int attempt = 0; attempt < 50; ++attempt) {
+            beast::get_lowest_layer(*ws).connect(endpoint, ec);
+            if (!ec) break;
+            beast::get_lowest_layer(*ws).close();
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        if (!ec) ws->next_layer().handshake(ssl::stream_base::client, ec);
+        if (!ec) ws->handshake("127.0.0.1", "/?token=bench-idle-token", ec);
+        if (!ec) {
+            ws->binary(true);
+            ws->write(net::buffer(std::string(64, 'x')), ec);
+        }
+        beast::flat_buffer buffer;
+        if (!ec) ws->read(buffer, ec);
+        if (ec) {
+            std::cerr << "client " << i << " failed: " << ec.message() << "\n";
+            return 1;
+        }
+        clients.push_back(std::move(ws));
+    }
+
+    char byte = 1;
+    if (write(ready_fd, &byte, 1) != 1) return 1;
+    // 父进程测完后关闭管道，read 返回 0
+    (void)read(hold_fd, &byte, 1);
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--connections" && i + 1 < argc) opt.connections = std::stoul(argv[++i]);
+        else if (arg == "--port" && i + 1 < argc) opt.port = static_cast<unsigned short>(std::stoul(argv[++i]));
+        else if (arg == "--cert" && i + 1 < argc) opt.cert = argv[++i];
+        else if (arg == "--key" && i + 1 < argc) opt.key = argv[++i];
+        else {
+            std::cout << "Usage: bench_idle_sessions [options]\n"
+                      << "  --connections N  idle connections to hold (default 2000)\n"
+                      << "  --port N         loopback port for the server (default 19443)\n"
+                      << "  --cert FILE      server certificate (default test/network/test_cert.pem)\n"
+                      << "  --key FILE       server private key (default test/network/test_key.pem)\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    int ready_pipe[2];
+    int hold_pipe[2];
+    if (pipe(ready_pipe) != 0 || pipe(hold_pipe) != 0) {
+        std::cerr << "pipe failed\n";
+        return 1;
+    }
+    // 先 fork 再起线程，子进程里没有服务端的任何状态
+    pid_t child = fork();
+    if (child == 0) {
+        close(ready_pipe[0]);
+        close(hold_pipe[1]);
+        _exit(run_clients(opt, ready_pipe[1], hold_pipe[0]));
+    }
+    close(ready_pipe[1]);
+    close(hold_pipe[0]);
+
+    ssl::context ctx(ssl::context::tls_server);
+    ctx.use_certificate_chain_file(opt.cert);
+    ctx.use_private_key_file(opt.key, ssl::context::pem);
+
+    net::io_context ioc;
+    im::network::WebSocketServer server(
+            ioc, ctx, opt.port,
+            [](im::network::SessionPtr session, beast::flat_buffer&& buffer) {
+                session->send(beast::buffers_to_string(buffer.data()));
+            });
+    server.start();
+    std::thread io_thread([&ioc] { ioc.run(); });
+
+    // 留一点时间让监听和首个 accept 的内存先落地
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    const uint64_t rss_before = rss_bytes();
+
+    char byte = 0;
+    const bool ready = read(ready_pipe[0], &byte, 1) == 1;
+    // 回包写完、会话回到空闲读
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    const uint64_t rss_after = rss_bytes();
+    const auto stats = server.get_stats();
+
+    if (ready) {
+        const double per_session =
+                static_cast<double>(rss_after - rss_before) / static_cast<double>(opt.connections);
+        std::cout << "connections: " << opt.connections
+                  << "  sessions: " << stats.current_sessions << "\n"
+                  << std::fixed << std::setprecision(0)
+                  << "rss_before: " << rss_before / 1024 << " KiB  rss_after: "
+                  << rss_after / 1024 << " KiB\n"
+                  << "bytes_per_idle_session: " << per_session << "\n"
+                  << "stats.rss_bytes_per_session: " << stats.rss_bytes_per_session << "\n";
+    } else {
+        std::cerr << "clients did not connect\n";
+    }
+
+    close(hold_pipe[1]);
+    int status = 0;
+    waitpid(child, &status, 0);
+    server.stop();
+    ioc.stop();
+    io_thread.join();
+    return ready ? 0 : 1;
+}
@@ -0,0 +1,165 @@
+// 推送为主的负载下，对比用户态 TLS 与 kTLS 每 GB 出向数据消耗的发送端 CPU。
+//
+// 同一进程内用回环连接：服务端与网关 WebSocketSession 相同，
+// websocket::stream<TlsTransportStream>，握手后按模式决定是否 enable_ktls；
+// 客户端为普通 Beast WSS 客户端，只负责读。只统计服务端线程的 CPU 时间
+// (CLOCK_THREAD_CPUTIME_ID)，客户端解密开销不计入。
+//
+// 内核或套件不支持 kTLS 时，ktls 一行会打印回退原因并跳过。
+
+#include <time.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+
+#include "common/network/tls_transport_stream.hpp"
+
+namespace {
+
+namespace net = boost::asio;
+namespace ssl = net::ssl;
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+using tcp = net::ip::tcp;
+
+struct Options {
+    uint64_t total_bytes = 1ull << 30;
+    std::size_t payload = 16 * 1024;
+    std::string cert = "test/network/test_cert.pem";
+    std::string key = "test/network/test_key.pem";
+    std::string cipher = "ECDHE-RSA-AES128-GCM-SHA256";
+};
+
+struct Result {
+    bool ran = false;
+    std::string note;
+    double cpu_sec = 0;
+    double wall_sec = 0;
+    uint64_t bytes = 0;
+};
+
+double thread_cpu_seconds() {
+    timespec ts{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec) / 1e9;
+}
+
+Result run(const Options& opt, bool use_ktls) {
+    ssl::context server_ctx(ssl::context::tlsv12_server);
+    server_ctx.use_certificate_chain_file(opt.cert);
+    server_ctx.use_private_key_file(opt.key, ssl::context::pem);
+    SSL_CTX_set_cipher_list(server_ctx.native_handle(), opt.cipher.c_str());
+    SSL_CTX_set_options(server_ctx.native_handle(), SSL_OP_NO_RENEGOTIATION);
+
+    ssl::context client_ctx(ssl::context::tlsv12_client);
+    client_ctx.set_verify_mode(ssl::verify_none);
+
+    net::io_context ioc;
+    tcp::acceptor acceptor(ioc, tcp::endpoint(net::ip::make_address("127.0.0.1"), 0));
+    const uint64_t frames = (opt.total_bytes + opt.payload - 1) / opt.payload;
+
+    std::thread client([&] {
+        websocket::stream<ssl::stream<tcp::socket>> ws(ioc, client_ctx);
+        beast::error_code ec;
+        beast::get_lowest_layer(ws).connect(acceptor.local_endpoint(), ec);
+        if (!ec) ws.next_layer().handshake(ssl::stream_base::client, ec);
+        if (!ec) ws.handshake("127.0.0.1", "/", ec);
+        beast::flat_buffer buffer;
+        while (!ec) {
+            ws.read(buffer, ec);
+            buffer.consume(buffer.size());
+        }
+    });
+
+    Result result;
+    {
+        tcp::socket socket(ioc);
+        acceptor.accept(socket);
+        websocket::stream<im::network::TlsTransportStream> ws(std::move(socket), server_ctx);
+        ws.next_layer().handshake(ssl::stream_base::server);
+
+        if (use_ktls) {
+            std::string reason;
+            if (ws.next_layer().enable_ktls(reason) != im::network::KtlsResult::Enabled) {
+                result.note = reason;
+            }
+        }
+
+        if (use_ktls && !result.note.empty()) {
+            beast::error_code ec;
+            beast::get_lowest_layer(ws).close(ec);
+        } else {
+            ws.accept();
+            ws.binary(true);
+            std::string payload(opt.payload, 'p');
+
+            const double cpu_start = thread_cpu_seconds();
+            const auto wall_start = std::chrono::steady_clock::now();
+            for (uint64_t i = 0; i < frames; ++i) {
+                ws.write(net::buffer(payload));
+            }
+            result.cpu_sec = thread_cpu_seconds() - cpu_start;
+            result.wall_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                            wall_start)
+                                      .count();
+            result.bytes = frames * opt.payload;
+            result.ran = true;
+
+            beast::error_code ec;
+            ws.close(websocket::close_code::normal, ec);
+        }
+    }
+    client.join();
+    return result;
+}
+
+void print(const char* mode, const Result& r) {
+    if (!r.ran) {
+        std::cout << std::left << std::setw(10) << mode << "skipped: " << r.note << "\n";
+        return;
+    }
+    const double gb = static_cast<double>(r.bytes) / (1ull << 30);
+    std::cout << std::left << std::setw(10) << mode << std::fixed << std::setprecision(3)
+              << "cpu_sec/GB=" << r.cpu_sec / gb << "  wall_sec/GB=" << r.wall_sec / gb
+              << "  MiB/s=" << std::setprecision(1) << (r.bytes / (1024.0 * 1024.0)) / r.wall_sec
+              << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--mib" && i + 1 < argc) opt.total_bytes = std::stoull(argv[++i]) << 20;
+        else if (arg == "--payload" && i + 1 < argc) opt.payload = std::stoul(argv[++i]);
+        else if (arg == "--cert" && i + 1 < argc) opt.cert = argv[++i];
+        else if (arg == "--key" && i + 1 < argc) opt.key = argv[++i];
+        else if (arg == "--cipher" && i + 1 < argc) opt.cipher = argv[++i];
+        else {
+            std::cout << "Usage: bench_ktls_push [options]\n"
+                      << "  --mib N        data pushed per mode (default 1024)\n"
+                      << "  --payload N    frame payload bytes (default 16384)\n"
+                      << "  --cert FILE    server certificate (default test/network/test_cert.pem)\n"
+                      << "  --key FILE     server private key (default test/network/test_key.pem)\n"
+                      << "  --cipher LIST  TLS 1.2 cipher list (default ECDHE-RSA-AES128-GCM-SHA256)\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+
+    std::cout << "payload bytes: " << opt.payload << ", pushed per mode: "
+              << (opt.total_bytes >> 20) << " MiB\n";
+    print("userspace", run(opt, false));
+    print("ktls", run(opt, true));
+    return 0;
+}
@@ -0,0 +1,330 @@
+// 原生 TCP 与 WSS 在网关侧的每消息 CPU：同一进程里依次起 WebSocketServer、
+// TCPServer（TLS）、TCPServer（明文）三个回显服务，客户端对每种传输发 N 条
+// 消息并收回包，服务端进程 CPU 时间（用户态 + 内核态）/ N 即每条消息的成本。
+//
+// 客户端在 fork 出的子进程里，不计入服务端 CPU；建连和握手不计时，子进程就绪后
+// 由父进程发令开始，收齐回包后结束。客户端按窗口批量发送，服务端一次读多帧、
+// 合并写回包，和真实推送/收发负载接近。
+
+#include <arpa/inet.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+
+#include "common/network/tcp_server.hpp"
+#include "common/network/tcp_session.hpp"
+#include "common/network/websocket_server.hpp"
+#include "common/network/websocket_session.hpp"
+
+namespace {
+
+namespace net = boost::asio;
+namespace ssl = net::ssl;
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+using tcp = net::ip::tcp;
+
+struct Options {
+    std::size_t messages = 200000;
+    std::size_t payload = 256;
+    std::size_t window = 32;
+    unsigned short port = 19543;  // WSS 用 port，TCP+TLS 用 port+1，明文 TCP 用 port+2
+    std::string cert = "test/network/test_cert.pem";
+    std::string key = "test/network/test_key.pem";
+};
+
+enum class Transport { Wss, TcpTls, TcpPlain };
+
+constexpr std::array<Transport, 3> kTransports{Transport::Wss, Transport::TcpTls,
+                                               Transport::TcpPlain};
+
+const char* transport_name(Transport t) {
+    switch (t) {
+        case Transport::Wss: return "wss";
+        case Transport::TcpTls: return "tcp+tls";
+        case Transport::TcpPlain: return "tcp";
+    }
+    return "?";
+}
+
+unsigned short transport_port(const Options& opt, Transport t) {
+    return static_cast<unsigned short>(opt.port + static_cast<int>(t));
+}
+
+double cpu_seconds() {
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    auto seconds = [](const timeval& tv) {
+        return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec) / 1e6;
+    };
+    return seconds(usage.ru_utime) + seconds(usage.ru_stime);
+}
+
+bool signal_byte(int fd) {
+    char byte = 1;
+    return write(fd, &byte, 1) == 1;
+}
+
+bool wait_byte(int fd) {
+    char byte = 0;
+    return read(fd, &byte, 1) == 1;
+}
+
+template <class Stream>
+void connect_with_retry(Stream& lowest, const tcp::endpoint& endpoint, beast::error_code& ec) {
+    for (int attempt = 0; attempt < 50; ++attempt) {
+        lowest.connect(endpoint, ec);
+        if (!ec) {
+            // 逐条写的客户端不关 Nagle 会和延迟 ACK 叠出 40ms 的停顿
+            lowest.set_option(tcp::no_delay(true), ec);
+            return;
+        }
+        lowest.close();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
+// 原生 TCP 帧：4 字节长度（网络序）+ 1 字节类型 + 消息体
+template <class SyncStream>
+void write_tcp_frames(SyncStream& stream, const std::string& frames, beast::error_code& ec) {
+    net::write(stream, net::buffer(frames), ec);
+}
+
+template <class SyncStream>
+void read_tcp_frame(SyncStream& stream, std::string& body, beast::error_code& ec) {
+    std::array<char, HEADER_SIZE> header{};
+    net::read(stream, net::buffer(header), ec);
+    if (ec) return;
+    uint32_t length = 0;
+    std::memcpy(&length, header.data(), sizeof(length));
+    body.resize(ntohl(length));
+    net::read(stream, net::buffer(body), ec);
+}
+
+std::string encode_tcp_frame(const std::string& body) {
+    std::string frame(HEADER_SIZE, '\0');
+    const uint32_t length = htonl(static_cast<uint32_t>(body.size()));
+    std::memcpy(frame.data(), &length, sizeof(length));
+    frame[4] = static_cast<char>(HeaderMsgType::NORMAL);
+    return frame + body;
+}
+
+template <class SyncStream>
+int run_tcp_client(const Options& opt, SyncStream& stream, int ready_fd, int go_fd) {
+    const std::string body(opt.payload, 'x');
+    std::string batch;
+    for (std::size_t i = 0; i < opt.window; ++i) {
+        batch += encode_tcp_frame(body);
+    }
+
+    if (!signal_byte(ready_fd) || !wait_byte(go_fd)) return 1;
+    beast::error_code ec;
+    std::string reply;
+    for (std::size_t sent = 0; sent < opt.messages && !ec; sent += opt.window) {
+        write_tcp_frames(stream, batch, ec);
+        for (std::size_t i = 0; i < opt.window && !ec; ++i) {
+            read_tcp_frame(stream, reply, ec);
+        }
+    }
+    if (ec) {
+        std::cerr << "tcp client failed: " << ec.message() << "\n";
+        return 1;
+    }
+    return signal_byte(ready_fd) ? 0 : 1;
+}
+
+int run_ws_client(const Options& opt, net::io_context& ioc, ssl::context& ctx, int ready_fd,
+                  int go_fd) {
+    websocket::stream<ssl::stream<tcp::socket>> ws(ioc, ctx);
+    beast::error_code ec;
+    connect_with_retry(beast::get_lowest_layer(ws),
+                       tcp::endpoint(net::ip::make_address("127.0.0.1"),
+                                     transport_port(opt, Transport::Wss)),
+                       ec);
+    if (!ec) ws.next_layer().handshake(ssl::stream_base::client, ec);
+    if (!ec) ws.handshake("127.0.0.1", "/?token=bench-tcp-vs-ws", ec);
+    if (ec) {
+        std::cerr << "wss connect failed: " << ec.message() << "\n";
+        return 1;
+    }
+    ws.binary(true);
+
+    const std::string body(opt.payload, 'x');
+    if (!signal_byte(ready_fd) || !wait_byte(go_fd)) return 1;
+    beast::flat_buffer buffer;
+    for (std::size_t sent = 0; sent < opt.messages && !ec; sent += opt.window) {
+        for (std::size_t i = 0; i < opt.window && !ec; ++i) {
+            ws.write(net::buffer(body), ec);
+        }
+        for (std::size_t i = 0; i < opt.window && !ec; ++i) {
+            buffer.clear();
+            ws.read(buffer, ec);
+        }
+    }
+    if (ec) {
+        std::cerr << "wss client failed: " << ec.message() << "\n";
+        return 1;
+    }
+    return signal_byte(ready_fd) ? 0 : 1;
+}
+
+// 子进程：按 kTransports 的顺序逐个建连、等父进程发令、收发完成后回报
+int run_clients(const Options& opt, int ready_fd, int go_fd) {
+    net::io_context ioc;
+    ssl::context ctx(ssl::context::tlsv12_client);
+    ctx.set_verify_mode(ssl::verify_none);
+
+    for (Transport t : kTransports) {
+        int rc = 0;
+        if (t == Transport::Wss) {
+            rc = run_ws_client(opt, ioc, ctx, ready_fd, go_fd);
+        } else {
+            const tcp::endpoint endpoint(net::ip::make_address("127.0.0.1"),
+                                         transport_port(opt, t));
+            beast::error_code ec;
+            if (t == Transport::TcpTls) {
+                ssl::stream<tcp::socket> stream(ioc, ctx);
+                connect_with_retry(stream.next_layer(), endpoint, ec);
+                if (!ec) stream.handshake(ssl::stream_base::client, ec);
+                rc = ec ? 1 : run_tcp_client(opt, stream, ready_fd, go_fd);
+            } else {
+                tcp::socket socket(ioc);
+                connect_with_retry(socket, endpoint, ec);
+                rc = ec ? 1 : run_tcp_client(opt, socket, ready_fd, go_fd);
+            }
+            if (ec) {
+                std::cerr << transport_name(t) << " connect failed: " << ec.message() << "\n";
+            }
+        }
+        if (rc != 0) return rc;
+    }
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--messages" && i + 1 < argc) opt.messages = std::stoul(argv[++i]);
+        else if (arg == "--payload" && i + 1 < argc) opt.payload = std::stoul(argv[++i]);
+        else if (arg == "--window" && i + 1 < argc) opt.window = std::stoul(argv[++i]);
+        else if (arg == "--port" && i + 1 < argc) opt.port = static_cast<unsigned short>(std::stoul(argv[++i]));
+        else if (arg == "--cert" && i + 1 < argc) opt.cert = argv[++i];
+        else if (arg == "--key" && i + 1 < argc) opt.key = argv[++i];
+        else {
+            std::cout << "Usage: bench_tcp_vs_ws [options]\n"
+                      << "  --messages N  echo round trips per transport (default 200000)\n"
+                      << "  --payload N   message body bytes (default 256)\n"
+                      << "  --window N    messages in flight per batch (default 32)\n"
+                      << "  --port N      first loopback port, uses N..N+2 (default 19543)\n"
+                      << "  --cert FILE   server certificate (default test/network/test_cert.pem)\n"
+                      << "  --key FILE    server private key (default test/network/test_key.pem)\n";
+            return arg == "--help" ? 0 : 1;
+        }
+    }
+    if (opt.window == 0) opt.window = 1;
+    opt.messages = (opt.messages + opt.window - 1) / opt.window * opt.window;
+
+    int ready_pipe[2];
+    int go_pipe[2];
+    if (pipe(ready_pipe) != 0 || pipe(go_pipe) != 0) {
+        std::cerr << "pipe failed\n";
+        return 1;
+    }
+    // 先 fork 再起线程，子进程里没有服务端的任何状态
+    pid_t child = fork();
+    if (child == 0) {
+        close(ready_pipe[0]);
+        close(go_pipe[1]);
+        _exit(run_clients(opt, ready_pipe[1], go_pipe[0]));
+    }
+    close(ready_pipe[1]);
+    close(go_pipe[0]);
+
+    ssl::context ctx(ssl::context::tls_server);
+    ctx.use_certificate_chain_file(opt.cert);
+    ctx.use_private_key_file(opt.key, ssl::context::pem);
+
+    net::io_context ioc;
+    im::network::WebSocketServer ws_server(
+            ioc, ctx, transport_port(opt, Transport::Wss),
+            [](im::network::SessionPtr session, beast::flat_buffer&& buffer) {
+                session->send(beast::buffers_to_string(buffer.data()));
+            });
+    im::network::TCPServer tls_server(ioc, transport_port(opt, Transport::TcpTls), &ctx);
+    im::network::TCPServer plain_server(ioc, transport_port(opt, Transport::TcpPlain));
+    auto echo = [](im::network::TCPSession::Ptr session) {
+        std::weak_ptr<im::network::TCPSession> weak = session;
+        session->set_message_handler([weak](const std::string& message) {
+            if (auto self = weak.lock()) {
+                self->send(message);
+            }
+        });
+    };
+    tls_server.set_connection_handler(echo);
+    plain_server.set_connection_handler(echo);
+
+    ws_server.start();
+    tls_server.start();
+    plain_server.start();
+    std::thread io_thread([&ioc] { ioc.run(); });
+
+    bool ok = true;
+    std::cout << "messages: " << opt.messages << "  payload: " << opt.payload
+              << " B  window: " << opt.window << "\n";
+    for (Transport t : kTransports) {
+        // 等子进程建连握手完成
+        if (!wait_byte(ready_pipe[0])) {
+            ok = false;
+            break;
+        }
+        const double cpu_before = cpu_seconds();
+        const auto wall_before = std::chrono::steady_clock::now();
+        if (!signal_byte(go_pipe[1]) || !wait_byte(ready_pipe[0])) {
+            ok = false;
+            break;
+        }
+        const double cpu = cpu_seconds() - cpu_before;
+        const double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                                          wall_before)
+                                    .count();
+        std::cout << std::left << std::setw(8) << transport_name(t) << std::right << std::fixed
+                  << std::setprecision(2) << "  server_cpu_us_per_msg: "
+                  << cpu * 1e6 / static_cast<double>(opt.messages)
+                  << "  msgs_per_sec: " << std::setprecision(0)
+                  << static_cast<double>(opt.messages) / wall << "\n";
+    }
+    if (!ok) {
+        std::cerr << "client aborted\n";
+    }
+
+    close(go_pipe[1]);
+    int status = 0;
+    waitpid(child, &status, 0);
+    ws_server.stop();
+    tls_server.stop();
+    plain_server.stop();
+    ioc.stop();
+    io_thread.join();
+    return ok && WIFEXITED(status) && WEXITSTATUS(status) == 0 ? 0 : 1;
+}
@@ -3,11 +3,11 @@
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <limits>
-#include <mutex>
-#include <numeric>
+#include <random>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -26,9 +26,11 @@
 #include <google/protobuf/message.h>
 
 #include "benchmark_codec.hpp"
+#include "hdr_histogram.hpp"
 #include "common/proto/base.pb.h"
 #include "common/proto/command.pb.h"
 #include "common/proto/message.pb.h"
+#include "common/proto/push.pb.h"
 
 namespace net = boost::asio;
 namespace ssl = boost::asio::ssl;
@@ -38,6 +40,12 @@ namespace http = beast::http;
 using tcp = net::ip::tcp;
 using json = nlohmann::json;
 using namespace std::chrono;
+using im::benchmark::HdrHistogram;
+using im::benchmark::ShardedHdrRecorder;
+
+// 发送方把计划发送时刻 (system_clock, 微秒) 写进消息内容，接收方据此计算推送延迟。
+// 收发双方在同一进程内，不受跨机时钟偏差影响。
+static constexpr std::string_view kBenchContentPrefix = "bench:";
 
 struct UserToken {
     std::string uid;
@@ -57,26 +65,11 @@ struct BenchConfig {
     int conn_timeout_ms = 15000;
     int connect_rate = 0;
     int threads = 4;
+    double rate = 0;              // 开环模式的总发送速率 (msg/s)，0 表示按 --interval 闭环发送
+    std::string timeseries_file;  // 每秒时间序列 CSV，空表示只打到 stderr
     bool csv_mode = false;
 };
 
-struct SampleSink {
-    static constexpr size_t MAX = 2 << 20;
-    double* samples;
-    std::atomic<size_t> count{0};
-    std::atomic<size_t> dropped{0};
-
-    SampleSink() { samples = new double[MAX]; }
-    ~SampleSink() { delete[] samples; }
-
-    void push(double v) {
-        size_t pos = count.fetch_add(1, std::memory_order_relaxed);
-        if (pos < MAX) samples[pos] = v;
-        else dropped.fetch_add(1, std::memory_order_relaxed);
-    }
-    size_t size() const { return std::min(count.load(), MAX); }
-};
-
 struct BenchStats {
     std::atomic<int64_t> connects_ok{0};
     std::atomic<int64_t> connects_fail{0};
@@ -88,15 +81,19 @@ struct BenchStats {
     std::atomic<int64_t> post_connect_errors{0};
     std::atomic<int64_t> msgs_sent{0};
     std::atomic<int64_t> msgs_recv{0};
+    std::atomic<int64_t> acks_recv{0};
+    std::atomic<int64_t> pushes_recv{0};
     std::atomic<int64_t> errors{0};
     std::atomic<int64_t> bytes_sent{0};
     std::atomic<int64_t> bytes_recv{0};
-    SampleSink rtt_ms;
-    SampleSink connect_time_ms;
-    SampleSink resolve_ms;
-    SampleSink tcp_connect_ms;
-    SampleSink ssl_handshake_ms;
-    SampleSink ws_handshake_ms;
+    // 以下均为微秒
+    ShardedHdrRecorder ack_rtt_us;        // 计划发送时刻 → 收到发送响应
+    ShardedHdrRecorder push_delivery_us;  // 计划发送时刻 → 接收方收到推送
+    ShardedHdrRecorder connect_time_us;
+    ShardedHdrRecorder resolve_us;
+    ShardedHdrRecorder tcp_connect_us;
+    ShardedHdrRecorder ssl_handshake_us;
+    ShardedHdrRecorder ws_handshake_us;
 };
 
 static BenchStats g_stats;
@@ -105,11 +102,14 @@ static std::atomic<bool> g_stop{false};
 
 class WsSession : public std::enable_shared_from_this<WsSession> {
 public:
+    // 每个会话一个 strand：读、写、定时器回调在多个 IO 线程间串行执行。
     WsSession(net::io_context& ioc, ssl::context& ssl_ctx, int conn_timeout_ms)
-        : resolver_(ioc)
-        , ws_(ioc, ssl_ctx)
-        , timer_(ioc)
-        , conn_timeout_ms_(conn_timeout_ms)
+        : conn_timeout_ms_(conn_timeout_ms)
+        , strand_(net::make_strand(ioc))
+        , resolver_(strand_)
+        , ws_(strand_, ssl_ctx)
+        , timer_(strand_)
+        , conn_timer_(strand_)
     {}
 
     ~WsSession() { close(); }
@@ -122,12 +122,29 @@ public:
     void set_host(const std::string& h) { host_ = h; }
     void set_port(uint16_t p) { port_ = p; }
     void set_interval_ms(int ms) { interval_ms_ = ms; }
-    void stop() { close(); }
+    /// 开环模式：按泊松过程以 rate msg/s 发送，与响应是否返回无关。
+    void set_rate(double rate, uint64_t seed) {
+        rate_ = rate;
+        rng_.seed(seed);
+        gap_ = std::exponential_distribution<double>(rate);
+    }
+    void stop() {
+        auto self = shared_from_this();
+        net::post(strand_, [self] { self->close(); });
+    }
     bool connected() const { return connected_.load(); }
+    /// 已发送但未收到响应的消息数；只在 IO 线程退出后读取。
+    size_t pending_acks() const { return pending_seqs_.size(); }
 
     void start() {
         auto self = shared_from_this();
-        connect_start_ = high_resolution_clock::now();
+        net::dispatch(strand_, [self] { self->do_start(); });
+    }
+
+private:
+    void do_start() {
+        auto self = shared_from_this();
+        connect_start_ = steady_clock::now();
         resolve_start_ = connect_start_;
 
         conn_timer_.expires_after(milliseconds(conn_timeout_ms_));
@@ -141,16 +158,15 @@ public:
             host_, std::to_string(port_),
             [self](beast::error_code ec, tcp::resolver::results_type results) {
                 if (self->closed_.load()) return;
-                auto now = high_resolution_clock::now();
-                self->record_stage(self->resolve_start_, now, g_stats.resolve_ms);
+                auto now = steady_clock::now();
+                self->record_stage(self->resolve_start_, now, g_stats.resolve_us);
                 if (ec) { self->fail("resolve", ec); return; }
                 self->on_resolve(results, now);
             });
     }
 
-private:
     void on_resolve(tcp::resolver::results_type results,
-                    high_resolution_clock::time_point resolved_at) {
+                    steady_clock::time_point resolved_at) {
         if (closed_.load()) return;
         auto self = shared_from_this();
         tcp_start_ = resolved_at;
@@ -158,23 +174,23 @@ private:
             results.begin()->endpoint(),
             [self](beast::error_code ec) {
                 if (self->closed_.load()) return;
-                auto now = high_resolution_clock::now();
-                self->record_stage(self->tcp_start_, now, g_stats.tcp_connect_ms);
+                auto now = steady_clock::now();
+                self->record_stage(self->tcp_start_, now, g_stats.tcp_connect_us);
                 if (ec) { self->fail("tcp", ec); return; }
                 self->ssl_start_ = now;
                 self->ws_.next_layer().async_handshake(
                     ssl::stream_base::client,
                     [self](beast::error_code ec) {
                         if (self->closed_.load()) return;
-                        auto now = high_resolution_clock::now();
-                        self->record_stage(self->ssl_start_, now, g_stats.ssl_handshake_ms);
+                        auto now = steady_clock::now();
+                        self->record_stage(self->ssl_start_, now, g_stats.ssl_handshake_us);
                         if (ec) { self->fail("ssl", ec); return; }
                         self->on_ssl_handshake(now);
                     });
             });
     }
 
-    void on_ssl_handshake(high_resolution_clock::time_point ssl_done_at) {
+    void on_ssl_handshake(steady_clock::time_point ssl_done_at) {
         if (closed_.load()) return;
         auto self = shared_from_this();
         ws_start_ = ssl_done_at;
@@ -183,8 +199,8 @@ private:
         ws_.async_handshake(host_, uri_,
             [self](beast::error_code ec) {
                 if (self->closed_.load()) return;
-                auto now = high_resolution_clock::now();
-                self->record_stage(self->ws_start_, now, g_stats.ws_handshake_ms);
+                auto now = steady_clock::now();
+                self->record_stage(self->ws_start_, now, g_stats.ws_handshake_us);
                 if (ec) { self->fail("ws", ec); return; }
                 self->on_ws_handshake();
             });
@@ -195,32 +211,50 @@ private:
         ws_.binary(true);
         conn_timer_.cancel();
         connected_.store(true);
-        auto ms = duration_cast<milliseconds>(high_resolution_clock::now() - connect_start_).count();
-        g_stats.connect_time_ms.push(static_cast<double>(ms));
+        record_stage(connect_start_, steady_clock::now(), g_stats.connect_time_us);
         g_stats.connects_ok.fetch_add(1);
         g_active_sessions.fetch_add(1);
 
         do_read();
+        next_send_ = steady_clock::now() + next_gap();
         schedule_send();
     }
 
+    steady_clock::duration next_gap() {
+        if (rate_ <= 0) {
+            return milliseconds(interval_ms_);
+        }
+        return duration_cast<steady_clock::duration>(duration<double>(gap_(rng_)));
+    }
+
     void schedule_send() {
         if (g_stop.load() || closed_.load() || !connected_.load()) return;
         auto self = shared_from_this();
-        timer_.expires_after(milliseconds(interval_ms_));
+        timer_.expires_at(next_send_);
         timer_.async_wait([self](beast::error_code ec) {
             if (ec || g_stop.load() || self->closed_.load()) return;
-            self->do_send();
+            if (self->rate_ <= 0) {
+                // 闭环：下一条从本次实际发送时刻起算
+                self->do_send(steady_clock::now());
+                self->next_send_ = steady_clock::now() + self->next_gap();
+            } else {
+                // 开环：计时器晚到或本线程被拖住时，把已过计划时刻的消息一次补发，
+                // 延迟仍从各自的计划时刻算起，服务端卡顿不会被少发掩盖。
+                auto now = steady_clock::now();
+                while (self->next_send_ <= now) {
+                    self->do_send(self->next_send_);
+                    self->next_send_ += self->next_gap();
+                }
+            }
             self->schedule_send();
         });
     }
 
-    void do_send() {
+    void do_send(steady_clock::time_point intended) {
         if (closed_.load() || !connected_.load()) return;
-        auto self = shared_from_this();
 
         im::base::IMHeader hdr;
-        uint32_t seq = seq_.fetch_add(1);
+        uint32_t seq = seq_++;
         hdr.set_version("1.0");
         hdr.set_seq(seq);
         hdr.set_cmd_id(im::command::CMD_SEND_MESSAGE);
@@ -232,12 +266,16 @@ private:
         auto ts = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
         hdr.set_timestamp(ts);
 
+        const auto intended_wall_us =
+            duration_cast<microseconds>(system_clock::now().time_since_epoch()).count() -
+            duration_cast<microseconds>(steady_clock::now() - intended).count();
+
         im::message::SendMessageRequest send_req;
         *send_req.mutable_header() = hdr;
         auto* body = send_req.mutable_body();
         body->set_message_id(std::to_string(seq));
         body->set_type(im::message::TEXT);
-        body->set_content("bench");
+        body->set_content(std::string(kBenchContentPrefix) + std::to_string(intended_wall_us));
         body->set_sender_uid(token_.uid);
         body->set_receiver_uid(receiver_uid_);
         body->set_create_time(ts);
@@ -248,18 +286,26 @@ private:
             return;
         }
 
-        {
-            std::lock_guard<std::mutex> lk(pending_mutex_);
-            pending_seqs_[seq] = high_resolution_clock::now();
-        }
-
+        pending_seqs_[seq] = intended;
         g_stats.msgs_sent.fetch_add(1);
         g_stats.bytes_sent.fetch_add(frame.size());
 
-        ws_.async_write(net::buffer(frame),
-            [self, seq](beast::error_code ec, size_t) {
+        write_queue_.push_back(std::move(frame));
+        if (write_queue_.size() == 1) {
+            do_write();
+        }
+    }
+
+    void do_write() {
+        auto self = shared_from_this();
+        ws_.async_write(net::buffer(write_queue_.front()),
+            [self](beast::error_code ec, size_t) {
                 if (self->closed_.load()) return;
-                if (ec) { self->fail("write", ec); }
+                if (ec) { self->fail("write", ec); return; }
+                self->write_queue_.pop_front();
+                if (!self->write_queue_.empty()) {
+                    self->do_write();
+                }
             });
     }
 
@@ -283,38 +329,45 @@ private:
         g_stats.bytes_recv.fetch_add(buffer_.size());
 
         std::string data = beast::buffers_to_string(buffer_.data());
-        auto now = high_resolution_clock::now();
+        auto now = steady_clock::now();
 
         im::base::IMHeader resp_hdr;
         std::string type_name, body_bytes;
-        if (im::benchmark::BenchmarkCodec::decodeEnvelope(data, resp_hdr, type_name, body_bytes)) {
-            uint32_t seq = resp_hdr.seq();
-            high_resolution_clock::time_point sent_ts;
-            bool found = false;
-            {
-                std::lock_guard<std::mutex> lk(pending_mutex_);
-                auto it = pending_seqs_.find(seq);
-                if (it != pending_seqs_.end()) {
-                    sent_ts = it->second;
-                    pending_seqs_.erase(it);
-                    found = true;
-                }
-            }
-            if (found) {
-                double ms = duration_cast<microseconds>(now - sent_ts).count() / 1000.0;
-                g_stats.rtt_ms.push(ms);
-            }
-        } else {
+        if (!im::benchmark::BenchmarkCodec::decodeEnvelope(data, resp_hdr, type_name, body_bytes)) {
             g_stats.errors.fetch_add(1);
+        } else if (resp_hdr.cmd_id() == im::command::CMD_PUSH_MESSAGE) {
+            on_push(body_bytes);
+        } else {
+            auto it = pending_seqs_.find(resp_hdr.seq());
+            if (it != pending_seqs_.end()) {
+                g_stats.acks_recv.fetch_add(1);
+                g_stats.ack_rtt_us.record(duration_cast<microseconds>(now - it->second).count());
+                pending_seqs_.erase(it);
+            }
         }
 
         do_read();
     }
 
+    void on_push(const std::string& body_bytes) {
+        im::push::PushRequest push;
+        if (!push.ParseFromString(body_bytes)) {
+            g_stats.errors.fetch_add(1);
+            return;
+        }
+        const std::string& content = push.body().content();
+        if (content.rfind(kBenchContentPrefix, 0) != 0) {
+            return;  // 不是本工具发出的消息
+        }
+        const int64_t sent_us = std::strtoll(content.c_str() + kBenchContentPrefix.size(), nullptr, 10);
+        const int64_t now_us = duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+        g_stats.pushes_recv.fetch_add(1);
+        g_stats.push_delivery_us.record(static_cast<uint64_t>(std::max<int64_t>(0, now_us - sent_us)));
+    }
+
     void fail(const char* op, beast::error_code ec) {
         if (!fail_recorded_.exchange(true) && !connected_.load()) {
-            auto ms = duration_cast<milliseconds>(high_resolution_clock::now() - connect_start_).count();
-            g_stats.connect_time_ms.push(static_cast<double>(ms));
+            record_stage(connect_start_, steady_clock::now(), g_stats.connect_time_us);
             g_stats.connects_fail.fetch_add(1);
             record_connect_failure(op);
         } else if (connected_.load()) {
@@ -324,11 +377,11 @@ private:
         close();
     }
 
-    void record_stage(high_resolution_clock::time_point begin,
-                      high_resolution_clock::time_point end,
-                      SampleSink& sink) {
+    void record_stage(steady_clock::time_point begin,
+                      steady_clock::time_point end,
+                      ShardedHdrRecorder& recorder) {
         if (begin.time_since_epoch().count() == 0) return;
-        sink.push(duration_cast<microseconds>(end - begin).count() / 1000.0);
+        recorder.record(duration_cast<microseconds>(end - begin).count());
     }
 
     void record_connect_failure(const char* op) {
@@ -367,23 +420,29 @@ private:
     std::string uri_;
     UserToken token_;
     int interval_ms_ = 5000;
+    double rate_ = 0;
+    std::mt19937_64 rng_;
+    std::exponential_distribution<double> gap_;
     int conn_timeout_ms_ = 15000;
 
+    net::strand<net::io_context::executor_type> strand_;
     tcp::resolver resolver_;
     websocket::stream<beast::ssl_stream<tcp::socket>> ws_;
     beast::flat_buffer buffer_;
     net::steady_timer timer_;
-    net::steady_timer conn_timer_{timer_.get_executor()};
-
-    std::atomic<uint32_t> seq_{1};
-    std::unordered_map<uint32_t, high_resolution_clock::time_point> pending_seqs_;
-    std::mutex pending_mutex_;
-
-    high_resolution_clock::time_point connect_start_;
-    high_resolution_clock::time_point resolve_start_;
-    high_resolution_clock::time_point tcp_start_;
-    high_resolution_clock::time_point ssl_start_;
-    high_resolution_clock::time_point ws_start_;
+    net::steady_timer conn_timer_;
+    std::deque<std::string> write_queue_;
+    steady_clock::time_point next_send_;
+
+    uint32_t seq_ = 1;
+    // seq → 计划发送时刻；只在 strand 上访问
+    std::unordered_map<uint32_t, steady_clock::time_point> pending_seqs_;
+
+    steady_clock::time_point connect_start_;
+    steady_clock::time_point resolve_start_;
+    steady_clock::time_point tcp_start_;
+    steady_clock::time_point ssl_start_;
+    steady_clock::time_point ws_start_;
     std::atomic<bool> connected_{false};
     std::atomic<bool> closed_{false};
     std::atomic<bool> fail_recorded_{false};
@@ -407,22 +466,21 @@ static std::vector<UserToken> load_tokens(const std::string& path) {
     return tokens;
 }
 
-static void fmt_sample_sink(std::ostream& os, const std::string& label, SampleSink& s, bool csv) {
-    size_t n = s.size();
+static void fmt_histogram(std::ostream& os, const std::string& label, const HdrHistogram& h, bool csv) {
+    const uint64_t n = h.count();
     if (n < 2) {
         os << (csv ? "" : "  ") << label << (csv ? "," : ": ") << "no_samples" << std::endl;
         return;
     }
-    std::vector<double> v(s.samples, s.samples + n);
-    std::sort(v.begin(), v.end());
-    double sum = std::accumulate(v.begin(), v.end(), 0.0);
-    double avg = sum / n;
-    double p50 = v[static_cast<size_t>(n * 0.50)];
-    double p90 = v[static_cast<size_t>(n * 0.90)];
-    double p95 = v[static_cast<size_t>(n * 0.95)];
-    double p99 = v[static_cast<size_t>(n * 0.99)];
-    double min = v.front();
-    double max = v.back();
+    auto ms = [](double us) { return us / 1000.0; };
+    double min = ms(h.min());
+    double avg = ms(h.mean());
+    double max = ms(h.max());
+    double p50 = ms(h.value_at_percentile(50));
+    double p90 = ms(h.value_at_percentile(90));
+    double p95 = ms(h.value_at_percentile(95));
+    double p99 = ms(h.value_at_percentile(99));
+    double p999 = ms(h.value_at_percentile(99.9));
 
     if (csv) {
         os << label << "_count," << n << std::endl;
@@ -433,19 +491,92 @@ static void fmt_sample_sink(std::ostream& os, const std::string& label, SampleSi
         os << label << "_p90," << p90 << std::endl;
         os << label << "_p95," << p95 << std::endl;
         os << label << "_p99," << p99 << std::endl;
-        if (s.dropped.load())
-            os << label << "_dropped," << s.dropped.load() << std::endl;
+        os << label << "_p999," << p999 << std::endl;
     } else {
         os << "  " << label << ":" << std::endl;
-        os << "    count: " << n;
-        if (s.dropped.load()) os << " (dropped: " << s.dropped.load() << ")";
-        os << std::endl;
+        os << "    count: " << n << std::endl;
         os << "    min/avg/max: " << std::fixed << std::setprecision(2) << min << " / " << avg << " / " << max << " ms" << std::endl;
-        os << "    p50/p90/p95/p99: " << p50 << " / " << p90 << " / " << p95 << " / " << p99 << " ms" << std::endl;
+        os << "    p50/p90/p95/p99/p99.9: " << p50 << " / " << p90 << " / " << p95 << " / " << p99 << " / " << p999 << " ms" << std::endl;
+    }
+}
+
+static HdrHistogram drain(ShardedHdrRecorder& recorder) {
+    HdrHistogram h;
+    recorder.drain_into(h);
+    return h;
+}
+
+struct LatencyTotals {
+    HdrHistogram ack_rtt;
+    HdrHistogram push_delivery;
+};
+
+// 每秒 drain 一次 ack / push 分片：输出该秒的吞吐和延迟分位，再并入总量。
+static void run_reporter(const BenchConfig& cfg, LatencyTotals& totals) {
+    std::ofstream ts_file;
+    if (!cfg.timeseries_file.empty()) {
+        ts_file.open(cfg.timeseries_file);
+        if (!ts_file) {
+            std::cerr << "Cannot open " << cfg.timeseries_file << std::endl;
+        } else {
+            ts_file << "second,active,sent,acks,pushes,"
+                    << "ack_p50_ms,ack_p99_ms,ack_max_ms,push_p50_ms,push_p99_ms,push_max_ms" << std::endl;
+        }
+    }
+
+    HdrHistogram ack_sec;
+    HdrHistogram push_sec;
+    // 错峰建连期间已经发出的消息不计入第一秒
+    int64_t last_sent = g_stats.msgs_sent.load();
+    int64_t last_acks = g_stats.acks_recv.load();
+    int64_t last_pushes = g_stats.pushes_recv.load();
+    auto next_tick = steady_clock::now();
+    auto ms = [](uint64_t us) { return us / 1000.0; };
+
+    for (int sec = 1; sec <= cfg.duration_sec; ++sec) {
+        next_tick += seconds(1);
+        std::this_thread::sleep_until(next_tick);
+
+        ack_sec.reset();
+        push_sec.reset();
+        g_stats.ack_rtt_us.drain_into(ack_sec);
+        g_stats.push_delivery_us.drain_into(push_sec);
+
+        const int64_t sent = g_stats.msgs_sent.load();
+        const int64_t acks = g_stats.acks_recv.load();
+        const int64_t pushes = g_stats.pushes_recv.load();
+
+        std::ostringstream line;
+        line << std::fixed << std::setprecision(2);
+        line << "[" << std::setw(4) << sec << "s] active=" << g_active_sessions.load()
+             << " sent=" << sent - last_sent
+             << " ack=" << acks - last_acks
+             << " p50/p99/max=" << ms(ack_sec.value_at_percentile(50))
+             << "/" << ms(ack_sec.value_at_percentile(99)) << "/" << ms(ack_sec.max()) << "ms"
+             << " push=" << pushes - last_pushes
+             << " p50/p99/max=" << ms(push_sec.value_at_percentile(50))
+             << "/" << ms(push_sec.value_at_percentile(99)) << "/" << ms(push_sec.max()) << "ms";
+        std::cerr << line.str() << std::endl;
+
+        if (ts_file) {
+            ts_file << std::fixed << std::setprecision(2)
+                    << sec << "," << g_active_sessions.load() << ","
+                    << sent - last_sent << "," << acks - last_acks << "," << pushes - last_pushes << ","
+                    << ms(ack_sec.value_at_percentile(50)) << "," << ms(ack_sec.value_at_percentile(99)) << ","
+                    << ms(ack_sec.max()) << ","
+                    << ms(push_sec.value_at_percentile(50)) << "," << ms(push_sec.value_at_percentile(99)) << ","
+                    << ms(push_sec.max()) << std::endl;
+        }
+
+        totals.ack_rtt.merge(ack_sec);
+        totals.push_delivery.merge(push_sec);
+        last_sent = sent;
+        last_acks = acks;
+        last_pushes = pushes;
     }
 }
 
-static void print_stats(bool csv, int duration_sec) {
+static void print_stats(bool csv, int duration_sec, const LatencyTotals& totals, size_t acks_missing) {
     std::ostringstream oss;
 
     int64_t sent = g_stats.msgs_sent.load();
@@ -453,6 +584,12 @@ static void print_stats(bool csv, int duration_sec) {
     int64_t ok = g_stats.connects_ok.load();
     int64_t fail = g_stats.connects_fail.load();
 
+    const HdrHistogram connect_time = drain(g_stats.connect_time_us);
+    const HdrHistogram resolve = drain(g_stats.resolve_us);
+    const HdrHistogram tcp_connect = drain(g_stats.tcp_connect_us);
+    const HdrHistogram ssl_handshake = drain(g_stats.ssl_handshake_us);
+    const HdrHistogram ws_handshake = drain(g_stats.ws_handshake_us);
+
     if (csv) {
         oss << "connects_ok," << ok << std::endl;
         oss << "connects_fail," << fail << std::endl;
@@ -465,6 +602,9 @@ static void print_stats(bool csv, int duration_sec) {
         oss << "post_connect_errors," << g_stats.post_connect_errors.load() << std::endl;
         oss << "messages_sent," << sent << std::endl;
         oss << "messages_recv," << recv << std::endl;
+        oss << "acks_recv," << g_stats.acks_recv.load() << std::endl;
+        oss << "acks_missing," << acks_missing << std::endl;
+        oss << "pushes_recv," << g_stats.pushes_recv.load() << std::endl;
         oss << "errors," << g_stats.errors.load() << std::endl;
         oss << "bytes_sent," << g_stats.bytes_sent.load() << std::endl;
         oss << "bytes_recv," << g_stats.bytes_recv.load() << std::endl;
@@ -472,12 +612,13 @@ static void print_stats(bool csv, int duration_sec) {
         oss << "throughput_msg_s," << std::fixed << std::setprecision(2) << (double)sent / duration_sec << std::endl;
         oss << "throughput_recv_s," << (double)recv / duration_sec << std::endl;
         oss << "throughput_kbps," << std::fixed << std::setprecision(2) << (g_stats.bytes_sent.load() / 1000.0) / duration_sec << std::endl;
-        fmt_sample_sink(oss, "connect_time", g_stats.connect_time_ms, true);
-        fmt_sample_sink(oss, "resolve", g_stats.resolve_ms, true);
-        fmt_sample_sink(oss, "tcp_connect", g_stats.tcp_connect_ms, true);
-        fmt_sample_sink(oss, "ssl_handshake", g_stats.ssl_handshake_ms, true);
-        fmt_sample_sink(oss, "ws_handshake", g_stats.ws_handshake_ms, true);
-        fmt_sample_sink(oss, "rtt", g_stats.rtt_ms, true);
+        fmt_histogram(oss, "connect_time", connect_time, true);
+        fmt_histogram(oss, "resolve", resolve, true);
+        fmt_histogram(oss, "tcp_connect", tcp_connect, true);
+        fmt_histogram(oss, "ssl_handshake", ssl_handshake, true);
+        fmt_histogram(oss, "ws_handshake", ws_handshake, true);
+        fmt_histogram(oss, "rtt", totals.ack_rtt, true);
+        fmt_histogram(oss, "push_delivery", totals.push_delivery, true);
     } else {
         oss << "\n======= Results =======" << std::endl;
         oss << "Connects OK:    " << ok << std::endl;
@@ -493,18 +634,21 @@ static void print_stats(bool csv, int duration_sec) {
         oss << "Post-connect errors: " << g_stats.post_connect_errors.load() << std::endl;
         oss << "Messages sent:  " << sent << std::endl;
         oss << "Messages recv:  " << recv << std::endl;
+        oss << "Acks recv:      " << g_stats.acks_recv.load() << " (missing: " << acks_missing << ")" << std::endl;
+        oss << "Pushes recv:    " << g_stats.pushes_recv.load() << std::endl;
         oss << "Errors:         " << g_stats.errors.load() << std::endl;
         oss << "Bytes sent:     " << g_stats.bytes_sent.load() << std::endl;
         oss << "Bytes recv:     " << g_stats.bytes_recv.load() << std::endl;
         oss << "Duration:       " << duration_sec << "s" << std::endl;
         oss << "Throughput:     " << std::fixed << std::setprecision(1) << (double)sent / duration_sec << " msg/s";
         oss << "  (" << std::setprecision(2) << (g_stats.bytes_sent.load() / 1000.0) / duration_sec << " KB/s)" << std::endl;
-        fmt_sample_sink(oss, "Connect time", g_stats.connect_time_ms, false);
-        fmt_sample_sink(oss, "Resolve", g_stats.resolve_ms, false);
-        fmt_sample_sink(oss, "TCP connect", g_stats.tcp_connect_ms, false);
-        fmt_sample_sink(oss, "TLS handshake", g_stats.ssl_handshake_ms, false);
-        fmt_sample_sink(oss, "WS handshake", g_stats.ws_handshake_ms, false);
-        fmt_sample_sink(oss, "RTT", g_stats.rtt_ms, false);
+        fmt_histogram(oss, "Connect time", connect_time, false);
+        fmt_histogram(oss, "Resolve", resolve, false);
+        fmt_histogram(oss, "TCP connect", tcp_connect, false);
+        fmt_histogram(oss, "TLS handshake", ssl_handshake, false);
+        fmt_histogram(oss, "WS handshake", ws_handshake, false);
+        fmt_histogram(oss, "RTT", totals.ack_rtt, false);
+        fmt_histogram(oss, "Push delivery", totals.push_delivery, false);
     }
 
     std::cout << oss.str();
@@ -521,9 +665,11 @@ int main(int argc, char* argv[]) {
         else if (arg == "--users" && i + 1 < argc) cfg.max_users = std::stoi(argv[++i]);
         else if (arg == "--duration" && i + 1 < argc) cfg.duration_sec = std::stoi(argv[++i]);
         else if (arg == "--interval" && i + 1 < argc) cfg.message_interval_ms = std::stoi(argv[++i]);
+        else if (arg == "--rate" && i + 1 < argc) cfg.rate = std::stod(argv[++i]);
         else if (arg == "--timeout" && i + 1 < argc) cfg.conn_timeout_ms = std::stoi(argv[++i]);
         else if (arg == "--connect-rate" && i + 1 < argc) cfg.connect_rate = std::stoi(argv[++i]);
         else if (arg == "--threads" && i + 1 < argc) cfg.threads = std::stoi(argv[++i]);
+        else if (arg == "--timeseries" && i + 1 < argc) cfg.timeseries_file = argv[++i];
         else if (arg == "--csv") cfg.csv_mode = true;
         else if (arg == "--help") {
             std::cout << "Usage: bench_ws [options]\n"
@@ -532,10 +678,13 @@ int main(int argc, char* argv[]) {
                       << "  --tokens FILE           Token JSON file\n"
                       << "  --users N               Max users to connect (0=all)\n"
                       << "  --duration SEC          Test duration (default: 60)\n"
-                      << "  --interval MS           Message interval ms (default: 5000)\n"
+                      << "  --interval MS           Closed-loop message interval ms (default: 5000)\n"
+                      << "  --rate N                Open-loop aggregate rate msg/s, Poisson arrivals\n"
+                      << "                          (overrides --interval)\n"
                       << "  --timeout MS            Connection timeout (default: 15000)\n"
                       << "  --connect-rate N        Connections per second (default: unlimited)\n"
                       << "  --threads N             IO threads (default: 4)\n"
+                      << "  --timeseries FILE       Write per-second CSV time series\n"
                       << "  --csv                   CSV output mode\n";
             return 0;
         }
@@ -546,9 +695,13 @@ int main(int argc, char* argv[]) {
     if (cfg.max_users > 0 && static_cast<size_t>(cfg.max_users) < tokens.size())
         tokens.resize(cfg.max_users);
 
-    std::cerr << "Users: " << tokens.size()
-              << " | Interval: " << cfg.message_interval_ms << "ms"
-              << " | Duration: " << cfg.duration_sec << "s"
+    // 开环速率按配置的用户数均分；连接失败的用户不会把份额转给其他连接。
+    const double per_conn_rate = cfg.rate > 0 ? cfg.rate / tokens.size() : 0;
+
+    std::cerr << "Users: " << tokens.size();
+    if (cfg.rate > 0) std::cerr << " | Rate: " << cfg.rate << " msg/s (open loop)";
+    else std::cerr << " | Interval: " << cfg.message_interval_ms << "ms";
+    std::cerr << " | Duration: " << cfg.duration_sec << "s"
               << " | Threads: " << cfg.threads
               << " | Connect rate: " << (cfg.connect_rate > 0 ? std::to_string(cfg.connect_rate) + "/s" : "unlimited")
               << std::endl;
@@ -571,23 +724,24 @@ int main(int argc, char* argv[]) {
         s->set_token(t);
         s->set_receiver_uid(next_t.uid);
         s->set_interval_ms(cfg.message_interval_ms);
+        if (per_conn_rate > 0) s->set_rate(per_conn_rate, i + 1);
         sessions.push_back(s);
     }
 
-    auto start_ts = high_resolution_clock::now();
+    auto start_ts = steady_clock::now();
     auto work_guard = net::make_work_guard(ioc);
     std::vector<std::thread> workers;
     for (int i = 0; i < cfg.threads; ++i)
         workers.emplace_back([&ioc] { ioc.run(); });
 
     for (size_t i = 0; i < sessions.size(); ++i) {
-        auto session = sessions[i];
-        net::post(ioc, [session] { session->start(); });
+        sessions[i]->start();
         if (stagger_us > 0 && i + 1 < sessions.size())
             std::this_thread::sleep_for(microseconds(stagger_us));
     }
 
-    std::this_thread::sleep_for(seconds(cfg.duration_sec));
+    LatencyTotals totals;
+    run_reporter(cfg, totals);
 
     g_stop.store(true);
 
@@ -598,10 +752,17 @@ int main(int argc, char* argv[]) {
         if (w.joinable()) w.join();
     }
 
-    auto elapsed = duration_cast<milliseconds>(high_resolution_clock::now() - start_ts).count() / 1000.0;
+    // 最后不足一秒内到达的样本
+    g_stats.ack_rtt_us.drain_into(totals.ack_rtt);
+    g_stats.push_delivery_us.drain_into(totals.push_delivery);
+
+    size_t acks_missing = 0;
+    for (auto& s : sessions) acks_missing += s->pending_acks();
+
+    auto elapsed = duration_cast<milliseconds>(steady_clock::now() - start_ts).count() / 1000.0;
     std::cerr << "Elapsed: " << std::fixed << std::setprecision(1) << elapsed << "s" << std::endl;
 
-    print_stats(cfg.csv_mode, (int)elapsed);
+    print_stats(cfg.csv_mode, (int)elapsed, totals, acks_missing);
 
     return g_stats.connects_fail.load() > 0 && g_stats.connects_ok.load() == 0 ? 1 : 0;
 }
@@ -0,0 +1,213 @@
+#pragma once
+
+// 压测用的 HDR（High Dynamic Range）延迟直方图，单位微秒。
+//
+// 对数-线性分桶：[0, 2048) 逐值计数，之后每个 2 的幂区间均分 1024 档，
+// 任意值的相对误差不超过 1/1024（约 3 位有效数字）。内存固定，
+// 与压测时长和样本数无关。
+//
+// HdrHistogram 是普通计数数组，用于合并和出报告；ShardedHdrRecorder 给
+// 每个记录线程一个原子分片，IO 线程之间互不争用，汇报线程按秒 drain
+// 所有分片再合并。
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace im {
+namespace benchmark {
+
+struct HdrLayout {
+    static constexpr uint32_t kSubBucketBits = 11;
+    static constexpr uint64_t kSubBucketCount = uint64_t{1} << kSubBucketBits;  // 2048
+    static constexpr uint64_t kSubBucketHalf = kSubBucketCount / 2;             // 1024
+    /// 可记录的最大值约 2^32 us（71 分钟），更大的值记入最后一档。
+    static constexpr uint32_t kMaxValueBits = 32;
+    static constexpr std::size_t kBucketCount =
+            kSubBucketCount + (kMaxValueBits - kSubBucketBits) * kSubBucketHalf;
+
+    static constexpr std::size_t index_of(uint64_t value) {
+        if (value < kSubBucketCount) {
+            return static_cast<std::size_t>(value);
+        }
+        const uint32_t shift = static_cast<uint32_t>(std::bit_width(value)) - kSubBucketBits;
+        if (shift > kMaxValueBits - kSubBucketBits) {
+            return kBucketCount - 1;
+        }
+        const uint64_t sub = (value >> shift) - kSubBucketHalf;  // [0, 1024)
+        return static_cast<std::size_t>(kSubBucketCount + (shift - 1) * kSubBucketHalf + sub);
+    }
+
+    /// 该档覆盖的最小值。
+    static constexpr uint64_t lowest_of(std::size_t index) {
+        if (index < kSubBucketCount) {
+            return index;
+        }
+        const uint64_t j = index - kSubBucketCount;
+        const uint32_t shift = static_cast<uint32_t>(j / kSubBucketHalf) + 1;
+        return (kSubBucketHalf + j % kSubBucketHalf) << shift;
+    }
+
+    /// 该档覆盖的最大值。
+    static constexpr uint64_t highest_of(std::size_t index) {
+        if (index < kSubBucketCount) {
+            return index;
+        }
+        const uint32_t shift = static_cast<uint32_t>((index - kSubBucketCount) / kSubBucketHalf) + 1;
+        return lowest_of(index) + (uint64_t{1} << shift) - 1;
+    }
+};
+
+static_assert(HdrLayout::index_of(2047) == 2047);
+static_assert(HdrLayout::index_of(2048) == 2048 && HdrLayout::lowest_of(2048) == 2048);
+static_assert(HdrLayout::index_of(4095) == 3071 && HdrLayout::highest_of(3071) == 4095);
+static_assert(HdrLayout::index_of(4096) == 3072 && HdrLayout::lowest_of(3072) == 4096);
+static_assert(HdrLayout::index_of(~uint64_t{0}) == HdrLayout::kBucketCount - 1);
+
+class HdrHistogram {
+public:
+    HdrHistogram() : counts_(HdrLayout::kBucketCount, 0) {}
+
+    void record(uint64_t value_us, uint64_t count = 1) {
+        counts_[HdrLayout::index_of(value_us)] += count;
+        total_ += count;
+    }
+
+    void add_at(std::size_t index, uint64_t count) {
+        counts_[index] += count;
+        total_ += count;
+    }
+
+    void merge(const HdrHistogram& other) {
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            counts_[i] += other.counts_[i];
+        }
+        total_ += other.total_;
+    }
+
+    void reset() {
+        std::fill(counts_.begin(), counts_.end(), 0);
+        total_ = 0;
+    }
+
+    uint64_t count() const { return total_; }
+
+    /// percentile ∈ [0, 100]；返回所在档的上界，保证不低估。
+    uint64_t value_at_percentile(double percentile) const {
+        if (total_ == 0) {
+            return 0;
+        }
+        const double p = std::clamp(percentile, 0.0, 100.0);
+        uint64_t rank = static_cast<uint64_t>(p / 100.0 * static_cast<double>(total_) + 0.5);
+        rank = std::clamp<uint64_t>(rank, 1, total_);
+        uint64_t seen = 0;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return HdrLayout::highest_of(i);
+            }
+        }
+        return max();
+    }
+
+    uint64_t min() const {
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            if (counts_[i]) return HdrLayout::lowest_of(i);
+        }
+        return 0;
+    }
+
+    uint64_t max() const {
+        for (std::size_t i = counts_.size(); i > 0; --i) {
+            if (counts_[i - 1]) return HdrLayout::highest_of(i - 1);
+        }
+        return 0;
+    }
+
+    /// 按各档中点估算的均值。
+    double mean() const {
+        if (total_ == 0) {
+            return 0.0;
+        }
+        double sum = 0.0;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            if (counts_[i]) {
+                const double mid = (HdrLayout::lowest_of(i) + HdrLayout::highest_of(i)) / 2.0;
+                sum += mid * static_cast<double>(counts_[i]);
+            }
+        }
+        return sum / static_cast<double>(total_);
+    }
+
+private:
+    std::vector<uint64_t> counts_;
+    uint64_t total_ = 0;
+};
+
+/// 多线程记录、单线程汇总的直方图。
+class ShardedHdrRecorder {
+public:
+    static constexpr std::size_t kMaxShards = 64;
+
+    ShardedHdrRecorder() = default;
+    ~ShardedHdrRecorder() {
+        for (auto& slot : shards_) {
+            delete slot.load(std::memory_order_relaxed);
+        }
+    }
+
+    ShardedHdrRecorder(const ShardedHdrRecorder&) = delete;
+    ShardedHdrRecorder& operator=(const ShardedHdrRecorder&) = delete;
+
+    void record(uint64_t value_us) {
+        shard().counts[HdrLayout::index_of(value_us)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// 把所有分片的计数移入 out（分片清零），用于按秒输出。
+    void drain_into(HdrHistogram& out) {
+        for (auto& slot : shards_) {
+            Shard* s = slot.load(std::memory_order_acquire);
+            if (!s) continue;
+            for (std::size_t i = 0; i < HdrLayout::kBucketCount; ++i) {
+                if (s->counts[i].load(std::memory_order_relaxed) == 0) continue;
+                const uint64_t n = s->counts[i].exchange(0, std::memory_order_relaxed);
+                if (n) out.add_at(i, n);
+            }
+        }
+    }
+
+private:
+    struct Shard {
+        std::array<std::atomic<uint64_t>, HdrLayout::kBucketCount> counts{};
+    };
+
+    /// 每个线程固定一个分片号；分片按需分配，超过 kMaxShards 的线程共用（原子计数仍然正确）。
+    static std::size_t thread_slot() {
+        static std::atomic<std::size_t> next{0};
+        thread_local const std::size_t slot = next.fetch_add(1, std::memory_order_relaxed) % kMaxShards;
+        return slot;
+    }
+
+    Shard& shard() {
+        std::atomic<Shard*>& slot = shards_[thread_slot()];
+        Shard* s = slot.load(std::memory_order_acquire);
+        if (s) {
+            return *s;
+        }
+        auto fresh = std::make_unique<Shard>();
+        if (slot.compare_exchange_strong(s, fresh.get(), std::memory_order_acq_rel)) {
+            return *fresh.release();
+        }
+        return *s;
+    }
+
+    std::array<std::atomic<Shard*>, kMaxShards> shards_{};
+};
+
+}  // namespace benchmark
+}  // namespace im
@@ -2,12 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <future>
 #include <string>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace {
 
@@ -227,11 +229,9 @@ TEST_F(RedisHiredisTest, HashOperations) {
 TEST_F(RedisHiredisTest, SetOperations) {
     auto& manager = im::db::redis_manager();
 
-    manager.execute([](auto& redis) {
-        redis.sadd(key("set"), "web");
-        redis.sadd(key("set"), "desktop");
-        return true;
-    });
+    EXPECT_EQ(manager.execute([](auto& redis) { return redis.sadd(key("set"), "web"); }), 1);
+    EXPECT_EQ(manager.execute([](auto& redis) { return redis.sadd(key("set"), "desktop"); }), 1);
+    EXPECT_EQ(manager.execute([](auto& redis) { return redis.sadd(key("set"), "web"); }), 0);
 
     EXPECT_TRUE(manager.execute([](auto& redis) { return redis.sismember(key("set"), "web"); }));
     EXPECT_EQ(manager.execute([](auto& redis) { return redis.scard(key("set")); }), 2);
@@ -244,13 +244,44 @@ TEST_F(RedisHiredisTest, SetOperations) {
     EXPECT_TRUE(members.contains("web"));
     EXPECT_TRUE(members.contains("desktop"));
 
-    manager.execute([](auto& redis) {
-        redis.srem(key("set"), "web");
-        return true;
-    });
+    EXPECT_EQ(manager.execute([](auto& redis) { return redis.srem(key("set"), "web"); }), 1);
+    EXPECT_EQ(manager.execute([](auto& redis) { return redis.srem(key("set"), "web"); }), 0);
     EXPECT_FALSE(manager.execute([](auto& redis) { return redis.sismember(key("set"), "web"); }));
 }
 
+TEST_F(RedisHiredisTest, EvalRunsScriptInOneCall) {
+    auto& manager = im::db::redis_manager();
+    const std::string script =
+        "redis.call('ZADD', KEYS[1], ARGV[1], ARGV[2]) "
+        "redis.call('ZREMRANGEBYRANK', KEYS[1], 0, -tonumber(ARGV[3]) - 1) "
+        "redis.call('EXPIRE', KEYS[1], ARGV[4]) "
+        "return redis.call('ZCARD', KEYS[1])";
+
+    for (int i = 1; i <= 3; ++i) {
+        const auto n = manager.execute([&](auto& redis) {
+            return redis.eval(script, key("zset"), {std::to_string(i), "m" + std::to_string(i),
+                                                    "2", "60"});
+        });
+        EXPECT_EQ(n, std::min(i, 2));
+    }
+
+    auto members = manager.execute([](auto& redis) {
+        return redis.zrangebyscore(key("zset"), "-inf", "+inf", 0, 10);
+    });
+    EXPECT_EQ(members, (std::vector<std::string>{"m2", "m3"}));
+    EXPECT_GT(manager.execute([](auto& redis) { return redis.ttl(key("zset")); }), 0);
+}
+
+TEST(RedisClusterSlotTest, MatchesClusterSpec) {
+    using im::db::RedisClient;
+    EXPECT_EQ(RedisClient::key_slot("123456789"), 12739);
+    EXPECT_EQ(RedisClient::key_slot("foo"), 12182);
+    EXPECT_EQ(RedisClient::key_slot("user:sessions:{1000}"), RedisClient::key_slot("1000"));
+    EXPECT_EQ(RedisClient::key_slot("foo{bar}{zap}"), RedisClient::key_slot("bar"));
+    EXPECT_EQ(RedisClient::key_slot("foo{{bar}}zap"), RedisClient::key_slot("{bar"));
+    EXPECT_NE(RedisClient::key_slot("foo{}{bar}"), RedisClient::key_slot("bar"));
+}
+
 TEST_F(RedisHiredisTest, ExpireRemovesKey) {
     auto& manager = im::db::redis_manager();
 
@@ -312,6 +312,37 @@ TEST_F(FriendServiceTest, GetAcceptedFriendsList) {
     EXPECT_TRUE(found_c) << "uid_c should be in friend list";
 }
 
+TEST_F(FriendServiceTest, GetFriendsFromTargetSideIncludesRequesterProfile) {
+    auto user_svc = std::make_shared<UserService>(db_, std::make_unique<PasswordHasher>());
+    FriendService svc(db_, user_svc);
+
+    std::string uid_a = create_user(*user_svc, "friend-test-side-a");
+    std::string uid_b = create_user(*user_svc, "friend-test-side-b");
+
+    FriendRequest req;
+    req.requester_uid = uid_a;
+    req.target_uid = uid_b;
+    req.now_ms = kNowMs;
+    ASSERT_TRUE(svc.send_request(req).ok);
+
+    auto pending = svc.get_pending_requests(uid_b);
+    ASSERT_EQ(pending.size(), 1);
+    EXPECT_EQ(pending[0].friend_uid, uid_a);
+    EXPECT_EQ(pending[0].nickname, "friend-test-side-a");
+    ASSERT_TRUE(svc.respond_to_request(pending[0].friend_id, uid_b, true).ok);
+
+    auto friends_b = svc.get_friends(uid_b);
+    ASSERT_EQ(friends_b.size(), 1);
+    EXPECT_EQ(friends_b[0].friend_uid, uid_a);
+    EXPECT_EQ(friends_b[0].nickname, "friend-test-side-a");
+    EXPECT_EQ(friends_b[0].created_at, kNowMs);
+
+    auto friends_a = svc.get_friends(uid_a);
+    ASSERT_EQ(friends_a.size(), 1);
+    EXPECT_EQ(friends_a[0].friend_uid, uid_b);
+    EXPECT_EQ(friends_a[0].nickname, "friend-test-side-b");
+}
+
 TEST_F(FriendServiceTest, GetPendingRequestsList) {
     auto user_svc = std::make_shared<UserService>(db_, std::make_unique<PasswordHasher>());
     FriendService svc(db_, user_svc);
@@ -0,0 +1,662 @@
+// 进程内网关吞吐压测：同一进程启动 GatewayServer 与 N 个 WSS 客户端，走完整的
+// TLS → WebSocket → 解包 → 鉴权 → MessageWsHandler → PushService → 推送链路。
+//
+// 外部依赖全部换成进程内实现，不需要 Redis / PostgreSQL / 远程服务：
+//   - 连接状态：InMemoryConnectionStateStore
+//   - 鉴权：MultiPlatformAuthManager 的免 Redis 构造，撤销检查恒为未撤销
+//   - 消息服务：InMemoryMessageClient，只分配 msg_id 不落库
+//   - 推送：push.mode=local 的 PushService，离线 outbox 关闭后只访问内存中的连接状态
+//
+// 客户端 i 给客户端 i+1 发消息，每个客户端保持 --inflight 条未确认的消息（闭环）。
+// 统计 ack 往返延迟（发送 → 收到同 seq 响应）和推送延迟（发送 → 接收方收到推送）。
+//
+// 计量窗口内整个进程（网关 + 进程内客户端）的系统调用次数用 raw_syscalls:sys_enter
+// tracepoint 逐线程计数，折算成 syscalls/msg，用于对比 epoll 与 io_uring 构建
+// （-DMYCHAT_ASIO_IO_URING=ON）。没有 tracefs / perf 权限时该列为空。
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <linux/perf_event.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast.hpp>
+#include <boost/beast/ssl.hpp>
+#include <nlohmann/json.hpp>
+
+#include <gateway/auth/multi_platform_auth.hpp>
+#include <gateway/connection_manager/connection_state_store.hpp>
+#include <gateway/gateway_server/gateway_server.hpp>
+#include <gateway/http/message_client.hpp>
+#include <message.hpp>
+#include <network/IOService_pool.hpp>
+#include <network/protobuf_codec.hpp>
+#include <utils/log_manager.hpp>
+
+#include "../../common/proto/base.pb.h"
+#include "../../common/proto/command.pb.h"
+#include "../../common/proto/message.pb.h"
+#include "../../common/proto/push.pb.h"
+#include "../benchmark/hdr_histogram.hpp"
+
+namespace {
+
+namespace net = boost::asio;
+namespace ssl = boost::asio::ssl;
+namespace beast = boost::beast;
+namespace websocket = beast::websocket;
+using tcp = net::ip::tcp;
+using json = nlohmann::json;
+using steady_clock = std::chrono::steady_clock;
+using im::benchmark::HdrHistogram;
+using im::benchmark::ShardedHdrRecorder;
+
+// 推送内容携带发送时刻（steady_clock 微秒），收发同进程，可直接相减。
+constexpr std::string_view kContentPrefix = "bench:";
+
+struct BenchConfig {
+    int clients = 100;
+    int inflight = 1;
+    int duration_s = 10;
+    int warmup_s = 2;
+    int client_threads = 2;
+    int payload_bytes = 64;
+    int ws_port = 0;
+    int http_port = 0;
+    int connect_timeout_s = 30;
+    std::string log_level = "warn";
+    bool csv = false;
+};
+
+struct BenchStats {
+    std::atomic<uint64_t> sent{0};
+    std::atomic<uint64_t> acks{0};
+    std::atomic<uint64_t> pushes{0};
+    std::atomic<uint64_t> errors{0};
+    std::atomic<int> connected{0};
+    std::atomic<int> failed{0};
+    ShardedHdrRecorder ack_us;
+    ShardedHdrRecorder push_us;
+};
+
+BenchStats g_stats;
+std::atomic<bool> g_stop{false};
+
+int64_t steady_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               steady_clock::now().time_since_epoch())
+        .count();
+}
+
+int64_t now_ms() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+int find_free_port() {
+    net::io_context ioc;
+    tcp::acceptor acceptor(ioc);
+    acceptor.open(tcp::v4());
+    acceptor.set_option(net::socket_base::reuse_address(true));
+    acceptor.bind(tcp::endpoint(net::ip::make_address("127.0.0.1"), 0));
+    const int port = acceptor.local_endpoint().port();
+    acceptor.close();
+    return port;
+}
+
+/// 10k 连接时进程内同时持有两端 socket，软上限抬到硬上限
+void raise_fd_limit() {
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+/// 计量窗口内本进程所有线程的系统调用次数；线程在窗口开始前都已创建
+class SyscallCounter {
+public:
+    ~SyscallCounter() { close_all(); }
+
+    bool start() {
+        const uint64_t id = tracepoint_id();
+        if (id == 0) {
+            return false;
+        }
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_TRACEPOINT;
+        attr.size = sizeof(attr);
+        attr.config = id;
+        for (const auto& task : std::filesystem::directory_iterator("/proc/self/task")) {
+            const pid_t tid = static_cast<pid_t>(std::stol(task.path().filename().string()));
+            const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0));
+            if (fd < 0) {
+                close_all();
+                return false;
+            }
+            fds_.push_back(fd);
+        }
+        return !fds_.empty();
+    }
+
+    uint64_t stop() {
+        uint64_t total = 0;
+        for (int fd : fds_) {
+            uint64_t value = 0;
+            if (read(fd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+                total += value;
+            }
+        }
+        close_all();
+        return total;
+    }
+
+private:
+    static uint64_t tracepoint_id() {
+        for (const char* path : {"/sys/kernel/tracing/events/raw_syscalls/sys_enter/id",
+                                 "/sys/kernel/debug/tracing/events/raw_syscalls/sys_enter/id"}) {
+            std::ifstream input(path);
+            uint64_t id = 0;
+            if (input >> id) {
+                return id;
+            }
+        }
+        return 0;
+    }
+
+    void close_all() {
+        for (int fd : fds_) {
+            close(fd);
+        }
+        fds_.clear();
+    }
+
+    std::vector<int> fds_;
+};
+
+std::filesystem::path source_path(const std::string& relative) {
+    return std::filesystem::path(MYCHAT_SOURCE_DIR) / relative;
+}
+
+/// 基于 config/dev.json 生成压测配置：证书用源码树绝对路径，关闭依赖 Redis 的推送组件。
+std::filesystem::path write_temp_config(int ws_port, int http_port, json& config) {
+    std::ifstream input(source_path("config/dev.json"));
+    if (!input) {
+        throw std::runtime_error("Failed to open config/dev.json");
+    }
+    config = json::parse(input);
+
+    config["gateway"]["websocket_port"] = ws_port;
+    config["gateway"]["http_port"] = http_port;
+    config["gateway"]["cert_file"] = source_path("test/network/test_cert.pem").string();
+    config["gateway"]["key_file"] = source_path("test/network/test_key.pem").string();
+    config["message"]["mode"] = "local";
+    config["push"]["mode"] = "local";
+    config["push"]["offline_outbox"]["enabled"] = false;
+    config["push"]["offline_catchup"]["enabled"] = false;
+    config["push"]["delivery_ack"]["enabled"] = false;
+
+    auto path = std::filesystem::temp_directory_path() /
+                ("mychat_bench_gateway_e2e_" + std::to_string(ws_port) + ".json");
+    std::ofstream output(path);
+    if (!output) {
+        throw std::runtime_error("Failed to write temp Gateway config");
+    }
+    output << config.dump(2);
+    return path;
+}
+
+/// 只分配 msg_id 的消息服务替身，吞吐上限不受数据库影响。
+class InMemoryMessageClient final : public im::gateway::MessageClient {
+public:
+    im::service::message::SendResult send_text_message(
+        const im::service::message::SendRequest& request) override {
+        im::service::message::SendResult result;
+        result.ok = true;
+        result.data.msg_id = next_msg_id_.fetch_add(1, std::memory_order_relaxed);
+        result.data.sender_uid = request.sender_uid;
+        result.data.receiver_uid = request.receiver_uid;
+        result.data.content = request.content;
+        result.data.msg_type = request.msg_type;
+        result.data.status = im::service::message::MessageStatus::SENT;
+        result.data.create_time = request.now_ms;
+        return result;
+    }
+
+    std::vector<im::service::message::MessageData> get_conversation(
+        const std::string&, const std::string&, int64_t, int) override {
+        return {};
+    }
+
+    std::vector<im::service::message::MessageData> pull_offline(
+        const std::string&, int64_t, int) override {
+        return {};
+    }
+
+    bool mark_delivered(uint64_t, int64_t) override { return true; }
+    bool mark_read(uint64_t, int64_t) override { return true; }
+
+private:
+    std::atomic<uint64_t> next_msg_id_{1};
+};
+
+struct ClientIdentity {
+    std::string uid;
+    std::string device_id;
+    std::string access_token;
+};
+
+class BenchClient : public std::enable_shared_from_this<BenchClient> {
+public:
+    BenchClient(net::io_context& ioc, ssl::context& ssl_ctx, ClientIdentity self,
+                std::string receiver_uid, int inflight, const std::string& payload)
+        : strand_(net::make_strand(ioc)),
+          ws_(strand_, ssl_ctx),
+          self_(std::move(self)),
+          receiver_uid_(std::move(receiver_uid)),
+          inflight_(inflight),
+          payload_(payload) {}
+
+    void start(const tcp::endpoint& endpoint) {
+        auto self = shared_from_this();
+        net::dispatch(strand_, [self, endpoint] { self->do_connect(endpoint); });
+    }
+
+    void stop() {
+        auto self = shared_from_this();
+        net::post(strand_, [self] { self->close(); });
+    }
+
+private:
+    void do_connect(const tcp::endpoint& endpoint) {
+        auto self = shared_from_this();
+        beast::get_lowest_layer(ws_).async_connect(endpoint, [self](beast::error_code ec) {
+            if (ec) return self->fail();
+            self->ws_.next_layer().async_handshake(
+                ssl::stream_base::client, [self](beast::error_code ec) {
+                    if (ec) return self->fail();
+                    self->ws_.async_handshake(
+                        "127.0.0.1", "/?token=" + self->self_.access_token,
+                        [self](beast::error_code ec) {
+                            if (ec) return self->fail();
+                            self->on_open();
+                        });
+                });
+        });
+    }
+
+    void on_open() {
+        ws_.binary(true);
+        open_ = true;
+        g_stats.connected.fetch_add(1);
+        do_read();
+        for (int i = 0; i < inflight_; ++i) {
+            do_send();
+        }
+    }
+
+    void do_send() {
+        if (g_stop.load(std::memory_order_relaxed) || !open_) return;
+
+        const uint32_t seq = seq_++;
+        const int64_t sent_at = steady_us();
+
+        im::base::IMHeader header;
+        header.set_version("1.0");
+        header.set_seq(seq);
+        header.set_cmd_id(im::command::CMD_SEND_MESSAGE);
+        header.set_from_uid(self_.uid);
+        header.set_to_uid(receiver_uid_);
+        header.set_token(self_.access_token);
+        header.set_device_id(self_.device_id);
+        header.set_platform("web");
+        header.set_timestamp(static_cast<uint64_t>(now_ms()));
+
+        im::message::SendMessageRequest request;
+        *request.mutable_header() = header;
+        auto* body = request.mutable_body();
+        body->set_type(im::message::TEXT);
+        body->set_sender_uid(self_.uid);
+        body->set_receiver_uid(receiver_uid_);
+        body->set_content(std::string(kContentPrefix) + std::to_string(sent_at) + ":" + payload_);
+
+        std::string frame;
+        if (!im::network::ProtobufCodec::encode(header, request, frame)) {
+            g_stats.errors.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        pending_[seq] = sent_at;
+        g_stats.sent.fetch_add(1, std::memory_order_relaxed);
+
+        write_queue_.push_back(std::move(frame));
+        if (write_queue_.size() == 1) {
+            do_write();
+        }
+    }
+
+    void do_write() {
+        auto self = shared_from_this();
+        ws_.async_write(net::buffer(write_queue_.front()),
+                        [self](beast::error_code ec, std::size_t) {
+                            if (ec) return self->fail();
+                            self->write_queue_.pop_front();
+                            if (!self->write_queue_.empty()) {
+                                self->do_write();
+                            }
+                        });
+    }
+
+    void do_read() {
+        auto self = shared_from_this();
+        buffer_.clear();
+        ws_.async_read(buffer_, [self](beast::error_code ec, std::size_t) {
+            if (ec) return self->fail();
+            self->on_read();
+            self->do_read();
+        });
+    }
+
+    void on_read() {
+        const std::string data = beast::buffers_to_string(buffer_.data());
+        im::base::IMHeader header;
+        std::string type_name;
+        std::string body;
+        if (!im::network::ProtobufCodec::decodeEnvelope(data, header, type_name, body)) {
+            g_stats.errors.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        if (header.cmd_id() == im::command::CMD_PUSH_MESSAGE) {
+            on_push(body);
+            return;
+        }
+
+        auto it = pending_.find(header.seq());
+        if (it == pending_.end()) {
+            return;
+        }
+        g_stats.ack_us.record(static_cast<uint64_t>(steady_us() - it->second));
+        g_stats.acks.fetch_add(1, std::memory_order_relaxed);
+        pending_.erase(it);
+        do_send();
+    }
+
+    void on_push(const std::string& body) {
+        im::push::PushRequest push;
+        if (!push.ParseFromString(body)) {
+            g_stats.errors.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        const std::string& content = push.body().content();
+        if (content.rfind(kContentPrefix, 0) != 0) {
+            return;
+        }
+        const int64_t sent_at = std::strtoll(content.c_str() + kContentPrefix.size(), nullptr, 10);
+        g_stats.push_us.record(static_cast<uint64_t>(std::max<int64_t>(0, steady_us() - sent_at)));
+        g_stats.pushes.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void fail() {
+        if (!open_ && !closed_) {
+            g_stats.failed.fetch_add(1);
+        }
+        close();
+    }
+
+    void close() {
+        if (closed_) return;
+        closed_ = true;
+        if (open_) {
+            open_ = false;
+            g_stats.connected.fetch_sub(1);
+        }
+        beast::error_code ignored;
+        beast::get_lowest_layer(ws_).shutdown(tcp::socket::shutdown_both, ignored);
+        beast::get_lowest_layer(ws_).close(ignored);
+    }
+
+    // 以下成员只在 strand_ 上访问
+    net::strand<net::io_context::executor_type> strand_;
+    websocket::stream<beast::ssl_stream<tcp::socket>> ws_;
+    beast::flat_buffer buffer_;
+    std::deque<std::string> write_queue_;
+    std::unordered_map<uint32_t, int64_t> pending_;  // seq → 发送时刻
+    ClientIdentity self_;
+    std::string receiver_uid_;
+    int inflight_;
+    std::string payload_;
+    uint32_t seq_ = 1;
+    bool open_ = false;
+    bool closed_ = false;
+};
+
+void print_usage() {
+    std::cout << "Usage: bench_gateway_e2e [options]\n"
+              << "  --clients N             Concurrent WSS clients (default: 100)\n"
+              << "  --inflight N            Unacked messages per client (default: 1)\n"
+              << "  --duration S            Measured seconds (default: 10)\n"
+              << "  --warmup S              Unmeasured seconds before measuring (default: 2)\n"
+              << "  --client-threads N      Client IO threads (default: 2)\n"
+              << "  --payload BYTES         Message content padding (default: 64)\n"
+              << "  --ws-port P             Gateway WebSocket port (default: free port)\n"
+              << "  --http-port P           Gateway HTTP port (default: free port)\n"
+              << "  --connect-timeout S     Seconds to wait for all clients (default: 30)\n"
+              << "  --log-level LEVEL       Gateway log level (default: warn)\n"
+              << "  --csv                   Print one CSV header + row\n";
+}
+
+bool parse_args(int argc, char* argv[], BenchConfig& cfg) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--clients" && i + 1 < argc) cfg.clients = std::stoi(argv[++i]);
+        else if (arg == "--inflight" && i + 1 < argc) cfg.inflight = std::stoi(argv[++i]);
+        else if (arg == "--duration" && i + 1 < argc) cfg.duration_s = std::stoi(argv[++i]);
+        else if (arg == "--warmup" && i + 1 < argc) cfg.warmup_s = std::stoi(argv[++i]);
+        else if (arg == "--client-threads" && i + 1 < argc) cfg.client_threads = std::stoi(argv[++i]);
+        else if (arg == "--payload" && i + 1 < argc) cfg.payload_bytes = std::stoi(argv[++i]);
+        else if (arg == "--ws-port" && i + 1 < argc) cfg.ws_port = std::stoi(argv[++i]);
+        else if (arg == "--http-port" && i + 1 < argc) cfg.http_port = std::stoi(argv[++i]);
+        else if (arg == "--connect-timeout" && i + 1 < argc) cfg.connect_timeout_s = std::stoi(argv[++i]);
+        else if (arg == "--log-level" && i + 1 < argc) cfg.log_level = argv[++i];
+        else if (arg == "--csv") cfg.csv = true;
+        else {
+            print_usage();
+            return false;
+        }
+    }
+    if (cfg.clients <= 0 || cfg.inflight <= 0 || cfg.duration_s <= 0 || cfg.client_threads <= 0 ||
+        cfg.warmup_s < 0 || cfg.payload_bytes < 0) {
+        std::cerr << "clients, inflight, duration and client-threads must be positive" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+double ms(uint64_t us) { return static_cast<double>(us) / 1000.0; }
+
+void print_report(const BenchConfig& cfg, double seconds, uint64_t acks, uint64_t pushes,
+                  const HdrHistogram& ack, const HdrHistogram& push, bool syscalls_counted,
+                  uint64_t syscalls) {
+    const double msgs_per_sec = static_cast<double>(acks) / seconds;
+    const double pushes_per_sec = static_cast<double>(pushes) / seconds;
+    std::string syscalls_per_msg;
+    if (syscalls_counted && acks > 0) {
+        std::ostringstream value;
+        value << std::fixed << std::setprecision(2)
+              << static_cast<double>(syscalls) / static_cast<double>(acks);
+        syscalls_per_msg = value.str();
+    }
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    if (cfg.csv) {
+        out << "backend,clients,inflight,seconds,msgs_per_sec,pushes_per_sec,"
+               "ack_p50_ms,ack_p99_ms,ack_p999_ms,ack_max_ms,"
+               "push_p50_ms,push_p99_ms,push_p999_ms,push_max_ms,errors,syscalls_per_msg\n"
+            << im::network::IOServicePool::backend_name() << ','
+            << cfg.clients << ',' << cfg.inflight << ',' << seconds << ',' << msgs_per_sec << ','
+            << pushes_per_sec << ',' << ms(ack.value_at_percentile(50)) << ','
+            << ms(ack.value_at_percentile(99)) << ',' << ms(ack.value_at_percentile(99.9)) << ','
+            << ms(ack.max()) << ',' << ms(push.value_at_percentile(50)) << ','
+            << ms(push.value_at_percentile(99)) << ',' << ms(push.value_at_percentile(99.9))
+            << ',' << ms(push.max()) << ',' << g_stats.errors.load() << ',' << syscalls_per_msg
+            << '\n';
+    } else {
+        out << "asio backend: " << im::network::IOServicePool::backend_name() << "\n"
+            << "clients: " << cfg.clients << " | inflight/client: " << cfg.inflight
+            << " | measured: " << seconds << " s\n"
+            << "msgs/sec: " << msgs_per_sec << " | pushes/sec: " << pushes_per_sec
+            << " | errors: " << g_stats.errors.load() << "\n"
+            << "ack  (ms): p50 " << ms(ack.value_at_percentile(50)) << " | p99 "
+            << ms(ack.value_at_percentile(99)) << " | p999 " << ms(ack.value_at_percentile(99.9))
+            << " | max " << ms(ack.max()) << " | n " << ack.count() << "\n"
+            << "push (ms): p50 " << ms(push.value_at_percentile(50)) << " | p99 "
+            << ms(push.value_at_percentile(99)) << " | p999 "
+            << ms(push.value_at_percentile(99.9)) << " | max " << ms(push.max()) << " | n "
+            << push.count() << "\n"
+            << "syscalls/msg (whole process): "
+            << (syscalls_per_msg.empty() ? "n/a (needs tracefs + perf_event access)"
+                                         : syscalls_per_msg)
+            << "\n";
+    }
+    std::cout << out.str() << std::flush;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    BenchConfig cfg;
+    if (!parse_args(argc, argv, cfg)) {
+        return 1;
+    }
+    if (cfg.ws_port == 0) cfg.ws_port = find_free_port();
+    if (cfg.http_port == 0) cfg.http_port = find_free_port();
+    raise_fd_limit();
+
+    json config;
+    const auto config_path = write_temp_config(cfg.ws_port, cfg.http_port, config);
+
+    im::gateway::GatewayDependencies deps;
+    deps.connection_state_store = std::make_shared<im::gateway::InMemoryConnectionStateStore>();
+    deps.auth_mgr = std::make_shared<im::gateway::MultiPlatformAuthManager>(
+        config.value("secret_key", "default_secret_key"), config_path.string(),
+        [](const std::string&) { return false; });
+    deps.message_client = std::make_shared<InMemoryMessageClient>();
+    auto auth_mgr = deps.auth_mgr;
+
+    std::unique_ptr<im::gateway::GatewayServer> gateway;
+    try {
+        gateway = std::make_unique<im::gateway::GatewayServer>(
+            config_path.string(), config_path.string(), static_cast<uint16_t>(cfg.ws_port),
+            static_cast<uint16_t>(cfg.http_port), std::move(deps));
+        gateway->start();
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to start gateway: " << e.what() << std::endl;
+        std::filesystem::remove(config_path);
+        return 1;
+    }
+    im::utils::LogManager::SetLogLevel(cfg.log_level);
+
+    ssl::context ssl_ctx(ssl::context::tlsv12_client);
+    ssl_ctx.set_verify_mode(ssl::verify_none);
+    net::io_context ioc;
+    auto work = net::make_work_guard(ioc);
+    std::vector<std::thread> io_threads;
+    for (int i = 0; i < cfg.client_threads; ++i) {
+        io_threads.emplace_back([&ioc] { ioc.run(); });
+    }
+
+    const std::string payload(static_cast<std::size_t>(cfg.payload_bytes), 'x');
+    const tcp::endpoint endpoint(net::ip::make_address("127.0.0.1"),
+                                 static_cast<uint16_t>(cfg.ws_port));
+    std::vector<std::shared_ptr<BenchClient>> clients;
+    clients.reserve(static_cast<std::size_t>(cfg.clients));
+    for (int i = 0; i < cfg.clients; ++i) {
+        ClientIdentity identity;
+        identity.uid = "bench-e2e-" + std::to_string(i);
+        identity.device_id = "bench-e2e-device-" + std::to_string(i);
+        identity.access_token = auth_mgr->generate_access_token(
+            identity.uid, identity.uid, identity.device_id, "web", 3600);
+        const std::string receiver = "bench-e2e-" + std::to_string((i + 1) % cfg.clients);
+        clients.push_back(std::make_shared<BenchClient>(ioc, ssl_ctx, std::move(identity),
+                                                        receiver, cfg.inflight, payload));
+    }
+    for (auto& client : clients) {
+        client->start(endpoint);
+    }
+
+    const auto connect_deadline = steady_clock::now() + std::chrono::seconds(cfg.connect_timeout_s);
+    while (g_stats.connected.load() + g_stats.failed.load() < cfg.clients &&
+           steady_clock::now() < connect_deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    std::cerr << "connected " << g_stats.connected.load() << "/" << cfg.clients
+              << " (failed " << g_stats.failed.load() << ")" << std::endl;
+
+    int exit_code = 0;
+    if (g_stats.connected.load() == 0) {
+        std::cerr << "No client connected; check the gateway logs under logs/" << std::endl;
+        exit_code = 1;
+    } else {
+        std::this_thread::sleep_for(std::chrono::seconds(cfg.warmup_s));
+
+        // 丢弃预热期的样本，从此刻开始计量
+        HdrHistogram discard;
+        g_stats.ack_us.drain_into(discard);
+        g_stats.push_us.drain_into(discard);
+        const uint64_t acks_before = g_stats.acks.load();
+        const uint64_t pushes_before = g_stats.pushes.load();
+        SyscallCounter syscall_counter;
+        const bool syscalls_counted = syscall_counter.start();
+        const auto measure_start = steady_clock::now();
+
+        std::this_thread::sleep_for(std::chrono::seconds(cfg.duration_s));
+
+        HdrHistogram ack;
+        HdrHistogram push;
+        g_stats.ack_us.drain_into(ack);
+        g_stats.push_us.drain_into(push);
+        const uint64_t acks = g_stats.acks.load() - acks_before;
+        const uint64_t pushes = g_stats.pushes.load() - pushes_before;
+        const uint64_t syscalls = syscalls_counted ? syscall_counter.stop() : 0;
+        const double seconds =
+            std::chrono::duration<double>(steady_clock::now() - measure_start).count();
+        print_report(cfg, seconds, acks, pushes, ack, push, syscalls_counted, syscalls);
+    }
+
+    g_stop.store(true);
+    for (auto& client : clients) {
+        client->stop();
+    }
+    work.reset();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ioc.stop();
+    for (auto& t : io_threads) {
+        t.join();
+    }
+    clients.clear();
+
+    gateway->stop();
+    gateway.reset();
+    std::filesystem::remove(config_path);
+    return exit_code;
+}
@@ -0,0 +1,36 @@
+#!/bin/bash
+# epoll 与 io_uring 两种 Asio 后端的 bench_gateway_e2e 对比
+# 用法: test/gateway_bench/compare_io_uring.sh [--clients 10000] [其他 bench_gateway_e2e 参数]
+#
+# 分别配置 build-bench-epoll / build-bench-io_uring 两个构建目录 (io_uring 需要
+# vcpkg feature io-uring), 各跑一次并输出两行 CSV: msgs/sec, ack/push p99, syscalls/msg。
+# syscalls/msg 需要能读 tracefs 且允许 perf_event_open (root 或 perf_event_paranoid<=1)。
+
+set -euo pipefail
+ROOT_DIR="$(cd "$(dirname "$0")/../.." && pwd)"
+BENCH_ARGS=("$@")
+if [ ${#BENCH_ARGS[@]} -eq 0 ]; then
+    BENCH_ARGS=(--clients 10000 --inflight 1 --client-threads 4 --warmup 5 --duration 30 --connect-timeout 120)
+fi
+
+build() {
+    local dir="$1"
+    shift
+    cmake -S "${ROOT_DIR}" -B "${dir}" -DCMAKE_BUILD_TYPE=Release -DMYCHAT_BUILD_BENCHMARKS=ON "$@" >/dev/null
+    cmake --build "${dir}" --target bench_gateway_e2e -j"$(nproc)" >/dev/null
+}
+
+echo "=== 构建 epoll / io_uring 两个版本 ==="
+build "${ROOT_DIR}/build-bench-epoll" -DMYCHAT_ASIO_IO_URING=OFF
+build "${ROOT_DIR}/build-bench-io_uring" -DMYCHAT_ASIO_IO_URING=ON -DVCPKG_MANIFEST_FEATURES=io-uring
+
+echo "=== 运行: bench_gateway_e2e ${BENCH_ARGS[*]} --csv ==="
+header_printed=0
+for backend in epoll io_uring; do
+    output="$("${ROOT_DIR}/build-bench-${backend}/test/gateway_bench/bench_gateway_e2e" "${BENCH_ARGS[@]}" --csv)"
+    if [ ${header_printed} -eq 0 ]; then
+        echo "${output}" | head -n 1
+        header_printed=1
+    fi
+    echo "${output}" | tail -n 1
+done
@@ -0,0 +1,353 @@
+// 网关热路径微基准（Google Benchmark）。
+//
+// 覆盖的函数：
+//   - ProtobufCodec::encode / decodeEnvelope，负载 64B ~ 256KB
+//   - MessageParser::parse_websocket_message_enhanced
+//   - RouterManager::find_service / parse_http_route
+//   - MultiPlatformAuthManager::verify_access_token（免 Redis 构造，撤销检查恒为未撤销）
+//   - FanoutPolicy::select_sessions（三种策略，1~64 个会话）
+//   - WebSocketServer::get_session，1~8 线程并发
+//   - ThreadPool::Enqueue 提交并等待 future 的往返
+//
+// 全局 operator new 被替换为计数版本，每个用例额外输出 allocs/iter 和
+// alloc_bytes/iter 两个计数器。计数器是线程局部的，多线程用例由框架按线程求和后
+// 再除以总迭代次数。
+//
+// JSON 输出直接使用 Google Benchmark 自带参数：
+//   ./gateway_microbench --benchmark_out=micro.json --benchmark_out_format=json
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+
+#include <fanout_policy.hpp>
+#include <gateway/auth/multi_platform_auth.hpp>
+#include <gateway/message_processor/message_parser.hpp>
+#include <gateway/router/router_mgr.hpp>
+#include <network/protobuf_codec.hpp>
+#include <network/websocket_server.hpp>
+#include <network/websocket_session.hpp>
+#include <utils/log_manager.hpp>
+#include <utils/thread_pool.hpp>
+
+#include "../../common/proto/base.pb.h"
+#include "../../common/proto/command.pb.h"
+
+namespace {
+
+// ==================== 分配计数 ====================
+
+thread_local uint64_t t_allocs = 0;
+thread_local uint64_t t_alloc_bytes = 0;
+
+void* counted_alloc(std::size_t bytes, std::size_t alignment = 0) {
+    ++t_allocs;
+    t_alloc_bytes += bytes;
+    void* p = alignment ? std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment)
+                        : std::malloc(bytes ? bytes : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+// 记录用例开始时本线程的分配数，结束时写入计数器
+class AllocCounter {
+public:
+    AllocCounter() : allocs_(t_allocs), bytes_(t_alloc_bytes) {}
+
+    void report(benchmark::State& state) const {
+        state.counters["allocs/iter"] = benchmark::Counter(
+                static_cast<double>(t_allocs - allocs_), benchmark::Counter::kAvgIterations);
+        state.counters["alloc_bytes/iter"] = benchmark::Counter(
+                static_cast<double>(t_alloc_bytes - bytes_), benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    uint64_t allocs_;
+    uint64_t bytes_;
+};
+
+// ==================== 公共夹具 ====================
+
+const std::string& config_path() {
+    static const std::string path = std::string(MYCHAT_SOURCE_DIR) + "/config/dev.json";
+    return path;
+}
+
+std::shared_ptr<im::gateway::RouterManager> router() {
+    static auto router_mgr = std::make_shared<im::gateway::RouterManager>(config_path());
+    return router_mgr;
+}
+
+im::gateway::MultiPlatformAuthManager& auth_manager() {
+    static im::gateway::MultiPlatformAuthManager auth_mgr(
+            "microbench_secret_key", config_path(), [](const std::string&) { return false; });
+    return auth_mgr;
+}
+
+im::base::IMHeader make_header() {
+    im::base::IMHeader header;
+    header.set_version("1.0");
+    header.set_seq(1);
+    header.set_cmd_id(im::command::CMD_SEND_MESSAGE);
+    header.set_from_uid("bench-user");
+    header.set_to_uid("bench-peer");
+    header.set_token("bench-token-0123456789abcdef");
+    header.set_device_id("bench-device");
+    header.set_platform("web");
+    header.set_timestamp(1700000000000);
+    return header;
+}
+
+std::string make_frame(std::size_t payload_bytes) {
+    im::base::BaseRequest request;
+    request.set_payload(std::string(payload_bytes, 'x'));
+    std::string frame;
+    im::network::ProtobufCodec::encode(make_header(), request, frame);
+    return frame;
+}
+
+// ==================== ProtobufCodec ====================
+
+void BM_CodecEncode(benchmark::State& state) {
+    const auto header = make_header();
+    im::base::BaseRequest request;
+    request.set_payload(std::string(static_cast<std::size_t>(state.range(0)), 'x'));
+
+    AllocCounter allocs;
+    for (auto _ : state) {
+        std::string frame;
+        bool ok = im::network::ProtobufCodec::encode(header, request, frame);
+        benchmark::DoNotOptimize(ok);
+        benchmark::DoNotOptimize(frame.data());
+    }
+    allocs.report(state);
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CodecEncode)->RangeMultiplier(16)->Range(64, 256 << 10);
+
+void BM_CodecDecodeEnvelope(benchmark::State& state) {
+    const auto frame = make_frame(static_cast<std::size_t>(state.range(0)));
+
+    AllocCounter allocs;
+    for (auto _ : state) {
+        im::base::IMHeader header;
+        std::string type_name;
+        std::string payload;
+        bool ok = im::network::ProtobufCodec::decodeEnvelope(frame, header, type_name, payload);
+        benchmark::DoNotOptimize(ok);
+        benchmark::DoNotOptimize(payload.data());
+    }
+    allocs.report(state);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(frame.size()));
+}
+BENCHMARK(BM_CodecDecodeEnvelope)->RangeMultiplier(16)->Range(64, 256 << 10);
+
+// ==================== MessageParser ====================
+
+void BM_ParseWebSocketMessage(benchmark::State& state) {
+    im::gateway::MessageParser parser(router());
+    const auto frame = make_frame(static_cast<std::size_t>(state.range(0)));
+    if (!parser.parse_websocket_message_enhanced(frame, "bench-session").success) {
+        state.SkipWithError("parse_websocket_message_enhanced rejected the benchmark frame");
+        return;
+    }
+
+    AllocCounter allocs;
+    for (auto _ : state) {
+        auto result = parser.parse_websocket_message_enhanced(frame, "bench-session");
+        benchmark::DoNotOptimize(result);
+    }
+    allocs.report(state);
+}
+BENCHMARK(BM_ParseWebSocketMessage)->Arg(64)->Arg(1024)->Arg(16 << 10);
+
+// ==================== RouterManager ====================
+
+void BM_RouterFindServiceByName(benchmark::State& state) {
+    auto router_mgr = router();
+    AllocCounter allocs;
+    for (auto _ : state) {
+        auto result = router_mgr->find_service("message_service");
+        benchmark::DoNotOptimize(result);
+    }
+    allocs.report(state);
+}
+BENCHMARK(BM_RouterFindServiceByName);
+
+void BM_RouterFindServiceByCmd(benchmark::State& state) {
+    auto router_mgr = router();
+    AllocCounter allocs;
+    for (auto _ : state) {
+        auto result = router_mgr->find_service(
+                static_cast<uint32_t>(im::command::CMD_SEND_MESSAGE));
+        benchmark::DoNotOptimize(result);
+    }
+    allocs.report(state);
+}
+BENCHMARK(BM_RouterFindServiceByCmd);
+
+void BM_RouterParseHttpRoute(benchmark::State& state) {
+    auto router_mgr = router();
+    AllocCounter allocs;
+    for (auto _ : state) {
+        auto result = router_mgr->parse_http_route("POST", "/api/v1/message/send");
+        benchmark::DoNotOptimize(result);
+    }
+    allocs.report(state);
+}
+BENCHMARK(BM_RouterParseHttpRoute);
+
+// ==================== MultiPlatformAuthManager ====================
+
+void BM_VerifyAccessToken(benchmark::State& state) {
+    auto& auth_mgr = auth_manager();
+    const auto token =
+            auth_mgr.generate_access_token("bench-user", "bench-user", "bench-device", "web", 3600);
+
+    AllocCounter allocs;
+    for (auto _ : state) {
+        im::gateway::UserTokenInfo info;
+        bool ok = auth_mgr.verify_access_token(token, info);
+        benchmark::DoNotOptimize(ok);
+    }
+    allocs.report(state);
+}
+BENCHMARK(BM_VerifyAccessToken);
+
+// ==================== FanoutPolicy ====================
+
+std::vector<im::service::push::PushSessionInfo> make_push_sessions(std::size_t count) {
+    static const char* kPlatforms[] = {"web", "ios", "android", "desktop"};
+    const auto now = std::chrono::system_clock::now();
+    std::vector<im::service::push::PushSessionInfo> sessions;
+    sessions.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        sessions.push_back({"session-" + std::to_string(i), kPlatforms[i % 4],
+                            now - std::chrono::seconds(static_cast<long>(i))});
+    }
+    return sessions;
+}
+
+template <typename Policy>
+void BM_FanoutSelectSessions(benchmark::State& state, Policy policy) {
+    const auto sessions = make_push_sessions(static_cast<std::size_t>(state.range(0)));
+    AllocCounter allocs;
+    for (auto _ : state) {
+        auto selected = policy.select_sessions(sessions);
+        benchmark::DoNotOptimize(selected);
+    }
+    allocs.report(state);
+}
+BENCHMARK_CAPTURE(BM_FanoutSelectSessions, all, im::service::push::AllSessionsFanoutPolicy{})
+        ->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK_CAPTURE(BM_FanoutSelectSessions, platform_filter,
+                  im::service::push::PlatformFilterFanoutPolicy({"ios", "android"}))
+        ->RangeMultiplier(4)->Range(1, 64);
+BENCHMARK_CAPTURE(BM_FanoutSelectSessions, newest, im::service::push::NewestSessionFanoutPolicy{})
+        ->RangeMultiplier(4)->Range(1, 64);
+
+// ==================== WebSocketServer::get_session ====================
+
+// 会话只有在握手完成后才会生成 session_id，这里不走握手，注册进表的会话键为空串。
+// 并发读竞争的是 sessions_mutex_，命中/未命中各测一组即可反映锁开销。
+struct SessionTable {
+    boost::asio::io_context ioc;
+    boost::asio::ssl::context ssl_ctx{boost::asio::ssl::context::tlsv12_server};
+    std::unique_ptr<im::network::WebSocketServer> server;
+
+    SessionTable() {
+        server = std::make_unique<im::network::WebSocketServer>(
+                ioc, ssl_ctx, 0, [](im::network::SessionPtr, boost::beast::flat_buffer&&) {});
+        server->add_session(std::make_shared<im::network::WebSocketSession>(
+                boost::asio::ip::tcp::socket(ioc), ssl_ctx, server.get()));
+    }
+};
+
+SessionTable& session_table() {
+    static SessionTable table;
+    return table;
+}
+
+void BM_GetSessionHit(benchmark::State& state) {
+    auto& server = *session_table().server;
+    const std::string session_id;
+    AllocCounter allocs;
+    for (auto _ : state) {
+        auto session = server.get_session(session_id);
+        benchmark::DoNotOptimize(session);
+    }
+    allocs.report(state);
+}
+BENCHMARK(BM_GetSessionHit)->ThreadRange(1, 8)->UseRealTime();
+
+void BM_GetSessionMiss(benchmark::State& state) {
+    auto& server = *session_table().server;
+    const std::string session_id = "missing-session-" + std::to_string(state.thread_index());
+    AllocCounter allocs;
+    for (auto _ : state) {
+        auto session = server.get_session(session_id);
+        benchmark::DoNotOptimize(session);
+    }
+    allocs.report(state);
+}
+BENCHMARK(BM_GetSessionMiss)->ThreadRange(1, 8)->UseRealTime();
+
+// ==================== ThreadPool ====================
+
+void BM_ThreadPoolEnqueueRoundTrip(benchmark::State& state) {
+    auto& pool = im::utils::ThreadPool::GetInstance();
+    AllocCounter allocs;
+    for (auto _ : state) {
+        auto result = pool.Enqueue([] { return 1; }).get();
+        benchmark::DoNotOptimize(result);
+    }
+    allocs.report(state);
+}
+BENCHMARK(BM_ThreadPoolEnqueueRoundTrip)->ThreadRange(1, 4)->UseRealTime();
+
+}  // namespace
+
+void* operator new(std::size_t bytes) { return counted_alloc(bytes); }
+void* operator new[](std::size_t bytes) { return counted_alloc(bytes); }
+void* operator new(std::size_t bytes, std::align_val_t a) {
+    return counted_alloc(bytes, static_cast<std::size_t>(a));
+}
+void* operator new[](std::size_t bytes, std::align_val_t a) {
+    return counted_alloc(bytes, static_cast<std::size_t>(a));
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // 解析失败、会话增删等路径都会打日志，压测时只保留错误
+    im::utils::LogManager::SetLogLevel("error");
+    im::utils::ThreadPool::GetInstance().Init(4);
+    benchmark::AddCustomContext("allocation_counting", "global operator new, per thread");
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    im::utils::ThreadPool::GetInstance().Shutdown();
+    return 0;
+}
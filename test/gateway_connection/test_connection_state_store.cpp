@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <set>
+#include <string>
+
+#include <database/redis/redis_mgr.hpp>
+#include <gateway/connection_manager/connection_manager.hpp>
+#include <gateway/connection_manager/connection_state_store.hpp>
+
+namespace {
+
+using im::gateway::ConnectionManager;
+using im::gateway::DeviceSessionInfo;
+using im::db::RedisClient;
+using im::db::RedisConfig;
+using im::db::RedisManager;
+using im::db::redis_manager;
+using im::gateway::InMemoryConnectionStateStore;
+using im::gateway::RedisConnectionStateStore;
+
+DeviceSessionInfo make_session(const std::string& session_id,
+                               const std::string& device_id,
+                               const std::string& platform) {
+    DeviceSessionInfo info;
+    info.session_id = session_id;
+    info.device_id = device_id;
+    info.platform = platform;
+    info.connect_time = std::chrono::system_clock::now();
+    return info;
+}
+
+TEST(InMemoryConnectionStateStoreTest, TracksSessionsPerUserAndDevice) {
+    InMemoryConnectionStateStore store;
+    store.add("alice", make_session("s1", "phone", "android"));
+    store.add("alice", make_session("s2", "laptop", "web"));
+    store.add("bob", make_session("s3", "phone", "ios"));
+
+    EXPECT_EQ(store.online_count(), 2u);
+    EXPECT_EQ(store.list("alice").size(), 2u);
+
+    auto owner = store.find_owner("s2");
+    ASSERT_TRUE(owner.has_value());
+    EXPECT_EQ(owner->user_id, "alice");
+    EXPECT_EQ(owner->device_id, "laptop");
+    EXPECT_EQ(owner->platform, "web");
+
+    auto found = store.find("alice", "phone", "android");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->session_id, "s1");
+    EXPECT_FALSE(store.find("alice", "phone", "web").has_value());
+}
+
+TEST(InMemoryConnectionStateStoreTest, RemovingLastDeviceTakesUserOffline) {
+    InMemoryConnectionStateStore store;
+    EXPECT_TRUE(store.add("alice", make_session("s1", "phone", "android")));
+    EXPECT_FALSE(store.add("alice", make_session("s2", "laptop", "web")));
+
+    auto removed = store.remove("alice", "phone", "");
+    EXPECT_EQ(removed.session_id, "s1");
+    EXPECT_FALSE(removed.user_offline);
+    EXPECT_FALSE(store.find_owner("s1").has_value());
+    EXPECT_EQ(store.online_count(), 1u);
+
+    removed = store.remove("alice", "laptop", "s2");
+    EXPECT_EQ(removed.session_id, "s2");
+    EXPECT_TRUE(removed.user_offline);
+    EXPECT_EQ(store.online_count(), 0u);
+    EXPECT_TRUE(store.list("alice").empty());
+    EXPECT_TRUE(store.online_users().empty());
+}
+
+TEST(InMemoryConnectionStateStoreTest, ReplacingDeviceSessionDropsOldOwner) {
+    InMemoryConnectionStateStore store;
+    store.add("alice", make_session("s1", "phone", "android"));
+    store.add("alice", make_session("s2", "phone", "android"));
+
+    EXPECT_FALSE(store.find_owner("s1").has_value());
+    ASSERT_TRUE(store.find_owner("s2").has_value());
+    EXPECT_EQ(store.list("alice").size(), 1u);
+}
+
+TEST(InMemoryConnectionStateStoreTest, ClosingOldSessionKeepsNewerRegistration) {
+    InMemoryConnectionStateStore store;
+    store.add("alice", make_session("s1", "phone", "android"));
+    store.add("alice", make_session("s2", "phone", "android"));
+
+    // s1 closes after s2 took over the device (kick or hot restart).
+    auto removed = store.remove("alice", "phone", "s1");
+    EXPECT_TRUE(removed.session_id.empty());
+    EXPECT_FALSE(removed.user_offline);
+    auto found = store.find("alice", "phone", "android");
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->session_id, "s2");
+    EXPECT_EQ(store.online_count(), 1u);
+
+    removed = store.remove("alice", "phone", "s2");
+    EXPECT_EQ(removed.session_id, "s2");
+    EXPECT_TRUE(removed.user_offline);
+}
+
+TEST(InMemoryConnectionStateStoreTest, ConnectionManagerReadsInjectedStore) {
+    auto store = std::make_shared<InMemoryConnectionStateStore>();
+    store->add("alice", make_session("s1", "phone", "android"));
+
+    const auto config_path =
+        (std::filesystem::path(MYCHAT_SOURCE_DIR) / "config/dev.json").string();
+    ConnectionManager conn_mgr(config_path, nullptr, store);
+
+    EXPECT_EQ(conn_mgr.get_online_count(), 1u);
+    EXPECT_TRUE(conn_mgr.is_user_online_on_platform("alice", "android"));
+    EXPECT_FALSE(conn_mgr.is_user_online_on_platform("alice", "web"));
+    EXPECT_EQ(conn_mgr.get_user_sessions("alice").size(), 1u);
+
+    conn_mgr.remove_connection("alice", "phone");
+    EXPECT_EQ(conn_mgr.get_online_count(), 0u);
+}
+
+TEST(RedisConnectionStateStoreTest, PerUserKeysShareAClusterSlot) {
+    const auto sessions_key = RedisConnectionStateStore::user_sessions_key("alice");
+    EXPECT_EQ(sessions_key, "user:sessions:{alice}");
+    EXPECT_EQ(RedisClient::key_slot(sessions_key),
+              RedisClient::key_slot(RedisConnectionStateStore::user_platform_key("alice")));
+    EXPECT_EQ(RedisClient::key_slot(sessions_key), RedisClient::key_slot("alice"));
+    EXPECT_EQ(RedisConnectionStateStore::session_owner_key("s1"), "session:user:{s1}");
+}
+
+TEST(RedisConnectionStateStoreTest, OnlineSetIsShardedIntoBuckets) {
+    RedisConnectionStateStore single;
+    EXPECT_EQ(single.online_key("alice"), "online:users");
+
+    RedisConnectionStateStore sharded(16);
+    std::set<std::string> buckets;
+    for (int i = 0; i < 1000; ++i) {
+        buckets.insert(sharded.online_key("user-" + std::to_string(i)));
+    }
+    EXPECT_EQ(buckets.size(), 16u);
+    EXPECT_EQ(sharded.online_key("alice"), sharded.online_key("alice"));
+    EXPECT_EQ(buckets.count("online:users:{0}"), 1u);
+}
+
+
+// Runs against the dev Redis (db 15) when it is up; skipped otherwise.
+class RedisConnectionStateStoreLiveTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        RedisConfig config;
+        config.host = "127.0.0.1";
+        config.port = 6379;
+        config.password = "mychat-dev-pass";
+        config.db = 15;
+        config.connect_timeout = 1000;
+        config.socket_timeout = 1000;
+        redis_manager().shutdown();
+        if (!redis_manager().initialize(config)) {
+            GTEST_SKIP() << "Redis server not available";
+        }
+        Cleanup();
+    }
+
+    void TearDown() override {
+        if (redis_manager().is_healthy()) {
+            Cleanup();
+        }
+        redis_manager().shutdown();
+    }
+
+    void Cleanup() {
+        RedisManager::GetInstance().execute([&](auto& redis) {
+            redis.del(RedisConnectionStateStore::user_sessions_key(kUser));
+            redis.del(RedisConnectionStateStore::user_platform_key(kUser));
+            for (const char* sid : {"live-s1", "live-s2", "live-s3"}) {
+                redis.del(RedisConnectionStateStore::session_owner_key(sid));
+            }
+            redis.srem(store_.online_key(kUser), kUser);
+        });
+    }
+
+    bool in_online_set() {
+        return RedisManager::GetInstance().execute(
+                [&](auto& redis) { return redis.sismember(store_.online_key(kUser), kUser); });
+    }
+
+    static constexpr const char* kUser = "store-live-user";
+    RedisConnectionStateStore store_;
+};
+
+TEST_F(RedisConnectionStateStoreLiveTest, TransitionsFollowTheUsersSessionCount) {
+    EXPECT_TRUE(store_.add(kUser, make_session("live-s1", "phone", "ios")));
+    EXPECT_TRUE(in_online_set());
+    EXPECT_FALSE(store_.add(kUser, make_session("live-s2", "laptop", "web")));
+    // Re-registering a device replaces its session without a transition.
+    EXPECT_FALSE(store_.add(kUser, make_session("live-s3", "phone", "ios")));
+
+    // The replaced session closing removes nothing and is not a transition.
+    auto stale = store_.remove(kUser, "phone", "live-s1");
+    EXPECT_TRUE(stale.session_id.empty());
+    EXPECT_FALSE(stale.user_offline);
+
+    auto first = store_.remove(kUser, "phone", "live-s3");
+    EXPECT_EQ(first.session_id, "live-s3");
+    EXPECT_FALSE(first.user_offline);
+    EXPECT_TRUE(in_online_set());
+
+    auto last = store_.remove(kUser, "laptop", "live-s2");
+    EXPECT_EQ(last.session_id, "live-s2");
+    EXPECT_TRUE(last.user_offline);
+    EXPECT_FALSE(in_online_set());
+
+    // Only the removal that emptied the user reports the 1 -> 0 change.
+    auto again = store_.remove(kUser, "laptop", "live-s2");
+    EXPECT_TRUE(again.session_id.empty());
+    EXPECT_FALSE(again.user_offline);
+}
+
+}  // namespace
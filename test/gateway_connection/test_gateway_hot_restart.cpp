@@ -0,0 +1,333 @@
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/websocket.hpp>
+#include <boost/beast/websocket/ssl.hpp>
+#include <nlohmann/json.hpp>
+
+#include <database/redis/redis_mgr.hpp>
+#include <gateway/auth/multi_platform_auth.hpp>
+#include <gateway/gateway_server/gateway_server.hpp>
+
+#include "../../common/network/listener_handoff.hpp"
+
+// GatewayServer hot restart from the old process's side: a successor takes
+// the WebSocket listener over gateway.hot_restart_socket and confirms, and
+// the old gateway closes its sessions in batches over gateway.drain_window_sec
+// with a 1012 "reconnect_after_ms=N" close. Needs Redis
+// (`docker compose up -d redis`), like the other GatewayServer smoke tests.
+
+namespace {
+
+namespace beast = boost::beast;
+namespace net = boost::asio;
+namespace ssl = boost::asio::ssl;
+namespace websocket = beast::websocket;
+using json = nlohmann::json;
+using tcp = net::ip::tcp;
+using im::db::RedisConfig;
+using im::db::redis_manager;
+using im::gateway::GatewayServer;
+using im::network::ListenerHandoffClient;
+using namespace std::chrono_literals;
+
+constexpr char kSecret[] = "replace-this-dev-secret-before-production";
+constexpr char kPlatform[] = "web";
+constexpr int kDrainWindowSec = 3;
+
+int find_free_port() {
+    net::io_context ioc;
+    tcp::acceptor acceptor(ioc);
+    acceptor.open(tcp::v4());
+    acceptor.set_option(net::socket_base::reuse_address(true));
+    acceptor.bind(tcp::endpoint(net::ip::make_address("127.0.0.1"), 0));
+    const int port = acceptor.local_endpoint().port();
+    acceptor.close();
+    return port;
+}
+
+RedisConfig test_redis_config() {
+    RedisConfig config;
+    config.host = "127.0.0.1";
+    config.port = 6379;
+    config.password = "mychat-dev-pass";
+    config.db = 15;
+    config.pool_size = 4;
+    config.connect_timeout = 1000;
+    config.socket_timeout = 1000;
+    config.pool_wait_timeout = 1000;
+    return config;
+}
+
+std::filesystem::path source_path(const std::string& relative) {
+    return std::filesystem::path(MYCHAT_SOURCE_DIR) / relative;
+}
+
+std::string unique_suffix() {
+    return std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+}
+
+std::filesystem::path write_temp_config(int ws_port, int http_port,
+                                        const std::string& handoff_socket) {
+    std::ifstream input(source_path("config/dev.json"));
+    if (!input) {
+        throw std::runtime_error("Failed to open config/dev.json");
+    }
+    json config = json::parse(input);
+
+    config["gateway"]["websocket_port"] = ws_port;
+    config["gateway"]["http_port"] = http_port;
+    config["gateway"]["tcp_port"] = 0;
+    config["gateway"]["hot_restart_socket"] = handoff_socket;
+    config["gateway"]["drain_window_sec"] = kDrainWindowSec;
+    config["gateway"]["cert_file"] = source_path("test/network/test_cert.pem").string();
+    config["gateway"]["key_file"] = source_path("test/network/test_key.pem").string();
+    config["redis"]["db"] = 15;
+    config["redis"]["pool_size"] = 4;
+    config["redis"]["pool_wait_timeout"] = 1000;
+
+    auto out_path = std::filesystem::temp_directory_path() /
+        ("mychat-gateway-hot-restart-" + unique_suffix() + ".json");
+    std::ofstream output(out_path);
+    if (!output) {
+        throw std::runtime_error("Failed to write temp Gateway config");
+    }
+    output << config.dump(2);
+    return out_path;
+}
+
+bool wait_until(const std::function<bool()>& done, std::chrono::milliseconds timeout = 3s) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!done()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(5ms);
+    }
+    return true;
+}
+
+int local_port(int fd) {
+    sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    if (::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        return -1;
+    }
+    return ntohs(addr.sin_port);
+}
+
+// TLS WebSocket client that, once watching, reads on its own thread until the
+// server closes the connection and records when and how it was closed.
+class DrainWatchingClient {
+public:
+    DrainWatchingClient() : ssl_ctx_(ssl::context::tlsv12_client), ws_(ioc_, ssl_ctx_) {
+        ssl_ctx_.set_verify_mode(ssl::verify_none);
+    }
+
+    ~DrainWatchingClient() {
+        if (reader_.joinable()) {
+            reader_.join();
+        }
+    }
+
+    bool connect(int port, const std::string& token, std::string& error) {
+        try {
+            beast::get_lowest_layer(ws_).connect(
+                    tcp::endpoint(net::ip::make_address("127.0.0.1"), port));
+            ws_.next_layer().handshake(ssl::stream_base::client);
+            ws_.handshake("127.0.0.1", "/?token=" + token);
+            return true;
+        } catch (const std::exception& e) {
+            error = e.what();
+            return false;
+        }
+    }
+
+    void watch(std::chrono::seconds timeout) {
+        reader_ = std::thread([this, timeout] {
+            read_next();
+            ioc_.run_for(timeout);
+        });
+    }
+
+    bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+    // Valid once closed() is true.
+    std::chrono::steady_clock::time_point closed_at() const { return closed_at_; }
+    const websocket::close_reason& reason() const { return reason_; }
+
+private:
+    void read_next() {
+        ws_.async_read(buffer_, [this](beast::error_code ec, std::size_t) {
+            if (!ec) {
+                buffer_.consume(buffer_.size());
+                read_next();
+                return;
+            }
+            reason_ = ws_.reason();
+            closed_at_ = std::chrono::steady_clock::now();
+            closed_.store(true, std::memory_order_release);
+        });
+    }
+
+    net::io_context ioc_;
+    ssl::context ssl_ctx_;
+    websocket::stream<ssl::stream<tcp::socket>> ws_;
+    beast::flat_buffer buffer_;
+    std::thread reader_;
+    std::atomic<bool> closed_{false};
+    std::chrono::steady_clock::time_point closed_at_;
+    websocket::close_reason reason_;
+};
+
+class GatewayHotRestartTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        redis_manager().shutdown();
+        ASSERT_TRUE(redis_manager().initialize(test_redis_config()))
+            << "Start Redis with `docker compose up -d redis` before running this test.";
+
+        ws_port_ = find_free_port();
+        http_port_ = find_free_port();
+        handoff_socket_ = (std::filesystem::temp_directory_path() /
+                           ("mychat-hot-restart-" + unique_suffix() + ".sock"))
+                                  .string();
+        temp_config_ = write_temp_config(ws_port_, http_port_, handoff_socket_);
+        gateway_ = std::make_unique<GatewayServer>(
+            temp_config_.string(), temp_config_.string(), ws_port_, http_port_);
+        gateway_->set_drained_handler([this] { drained_.store(true); });
+        gateway_->start();
+        ASSERT_TRUE(wait_until([this] { return std::filesystem::exists(handoff_socket_); }))
+            << "Gateway never started waiting for a successor";
+    }
+
+    void TearDown() override {
+        if (gateway_) {
+            gateway_->stop();
+            gateway_.reset();
+        }
+        redis_manager().shutdown();
+        std::error_code ec;
+        if (!temp_config_.empty()) {
+            std::filesystem::remove(temp_config_, ec);
+        }
+        std::filesystem::remove(handoff_socket_, ec);
+    }
+
+    std::string make_access_token(const std::string& uid) {
+        im::gateway::MultiPlatformAuthManager auth_mgr(kSecret, temp_config_.string());
+        return auth_mgr.generate_access_token(uid, uid + "-account", uid + "-device", kPlatform,
+                                              3600);
+    }
+
+    int ws_port_ = 0;
+    int http_port_ = 0;
+    std::string handoff_socket_;
+    std::filesystem::path temp_config_;
+    std::unique_ptr<GatewayServer> gateway_;
+    std::atomic<bool> drained_{false};
+};
+
+}  // namespace
+
+TEST_F(GatewayHotRestartTest, SuccessorConfirmDrainsSessionsInBatchesOverTheWindow) {
+    constexpr int kClients = 6;
+    constexpr int kPerTick = kClients / kDrainWindowSec;
+    const size_t online_before = gateway_->get_online_count();
+
+    std::vector<std::unique_ptr<DrainWatchingClient>> clients;
+    for (int i = 0; i < kClients; ++i) {
+        const std::string uid = "gateway-hot-restart-" + std::to_string(i) + "-" + unique_suffix();
+        auto client = std::make_unique<DrainWatchingClient>();
+        std::string error;
+        ASSERT_TRUE(client->connect(ws_port_, make_access_token(uid), error)) << error;
+        client->watch(15s);
+        clients.push_back(std::move(client));
+    }
+    ASSERT_TRUE(wait_until(
+            [&] { return gateway_->get_online_count() == online_before + kClients; }));
+
+    // The successor gets the WebSocket listener; the TCP transport is off.
+    ListenerHandoffClient successor;
+    std::string error;
+    ASSERT_TRUE(successor.connect(handoff_socket_, error)) << error;
+    EXPECT_EQ(successor.take("tcp"), -1);
+    const int inherited = successor.take("ws");
+    ASSERT_GE(inherited, 0);
+    EXPECT_EQ(local_port(inherited), ws_port_);
+
+    // Nothing is closed until the successor confirms.
+    std::this_thread::sleep_for(200ms);
+    EXPECT_FALSE(gateway_->is_draining());
+    EXPECT_TRUE(std::none_of(clients.begin(), clients.end(),
+                             [](const auto& client) { return client->closed(); }));
+
+    ASSERT_TRUE(successor.confirm(error)) << error;
+    ASSERT_TRUE(wait_until([&] { return gateway_->is_draining(); }));
+
+    ASSERT_TRUE(wait_until(
+            [&] {
+                return std::all_of(clients.begin(), clients.end(),
+                                   [](const auto& client) { return client->closed(); });
+            },
+            std::chrono::seconds(kDrainWindowSec + 3)));
+    EXPECT_TRUE(wait_until([&] { return drained_.load(); }));
+
+    // The old gateway stopped accepting: new connections land on the successor's copy.
+    {
+        net::io_context ioc;
+        tcp::socket probe(ioc);
+        probe.connect(tcp::endpoint(net::ip::make_address("127.0.0.1"), ws_port_));
+        pollfd pfd{inherited, POLLIN, 0};
+        ASSERT_EQ(::poll(&pfd, 1, 1000), 1);
+        const int accepted = ::accept4(inherited, nullptr, nullptr, SOCK_CLOEXEC);
+        EXPECT_GE(accepted, 0);
+        if (accepted >= 0) {
+            ::close(accepted);
+        }
+    }
+
+    std::vector<std::chrono::steady_clock::time_point> closed_at;
+    for (const auto& client : clients) {
+        closed_at.push_back(client->closed_at());
+
+        const auto& reason = client->reason();
+        EXPECT_EQ(reason.code, websocket::close_code::service_restart);
+        const std::string text(reason.reason.data(), reason.reason.size());
+        const std::string prefix = "reconnect_after_ms=";
+        ASSERT_EQ(text.rfind(prefix, 0), 0u) << text;
+        const int reconnect_after = std::stoi(text.substr(prefix.size()));
+        EXPECT_GE(reconnect_after, 0);
+        EXPECT_LT(reconnect_after, 1000);
+    }
+
+    // One batch per second of the window, not everything on the first tick.
+    std::sort(closed_at.begin(), closed_at.end());
+    const auto first = closed_at.front();
+    const auto in_first_tick = std::count_if(closed_at.begin(), closed_at.end(),
+                                             [&](auto at) { return at - first < 500ms; });
+    EXPECT_EQ(in_first_tick, kPerTick);
+    EXPECT_GE(closed_at.back() - first, std::chrono::seconds(kDrainWindowSec - 1) - 300ms);
+    EXPECT_LT(closed_at.back() - first, std::chrono::seconds(kDrainWindowSec));
+
+    ::close(inherited);
+}
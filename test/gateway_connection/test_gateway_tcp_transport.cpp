@@ -0,0 +1,304 @@
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <boost/asio.hpp>
+#include <nlohmann/json.hpp>
+
+#include <database/redis/redis_mgr.hpp>
+#include <gateway/auth/multi_platform_auth.hpp>
+#include <gateway/gateway_server/gateway_server.hpp>
+#include <utils/global.hpp>
+
+#include "../../common/network/protobuf_codec.hpp"
+#include "../../common/proto/base.pb.h"
+#include "../../common/proto/command.pb.h"
+
+// GatewayServer::on_tcp_connect / authenticate_connection end to end: a raw
+// client on gateway.tcp_port sends the 5-byte-header frames a native client
+// would. Needs Redis (`docker compose up -d redis`), like the other
+// GatewayServer smoke tests.
+
+namespace {
+
+namespace net = boost::asio;
+using json = nlohmann::json;
+using tcp = net::ip::tcp;
+using im::db::RedisConfig;
+using im::db::redis_manager;
+using im::gateway::GatewayServer;
+using im::network::ProtobufCodec;
+using namespace std::chrono_literals;
+
+constexpr char kSecret[] = "replace-this-dev-secret-before-production";
+constexpr char kDevice[] = "tcp-transport-device";
+constexpr char kPlatform[] = "web";
+
+int find_free_port() {
+    net::io_context ioc;
+    tcp::acceptor acceptor(ioc);
+    acceptor.open(tcp::v4());
+    acceptor.set_option(net::socket_base::reuse_address(true));
+    acceptor.bind(tcp::endpoint(net::ip::make_address("127.0.0.1"), 0));
+    const int port = acceptor.local_endpoint().port();
+    acceptor.close();
+    return port;
+}
+
+RedisConfig test_redis_config() {
+    RedisConfig config;
+    config.host = "127.0.0.1";
+    config.port = 6379;
+    config.password = "mychat-dev-pass";
+    config.db = 15;
+    config.pool_size = 4;
+    config.connect_timeout = 1000;
+    config.socket_timeout = 1000;
+    config.pool_wait_timeout = 1000;
+    return config;
+}
+
+std::filesystem::path source_path(const std::string& relative) {
+    return std::filesystem::path(MYCHAT_SOURCE_DIR) / relative;
+}
+
+std::filesystem::path write_temp_config(int ws_port, int http_port, int tcp_port) {
+    std::ifstream input(source_path("config/dev.json"));
+    if (!input) {
+        throw std::runtime_error("Failed to open config/dev.json");
+    }
+    json config = json::parse(input);
+
+    config["gateway"]["websocket_port"] = ws_port;
+    config["gateway"]["http_port"] = http_port;
+    config["gateway"]["tcp_port"] = tcp_port;
+    config["gateway"]["tcp_tls"] = false;
+    config["gateway"]["cert_file"] = source_path("test/network/test_cert.pem").string();
+    config["gateway"]["key_file"] = source_path("test/network/test_key.pem").string();
+    config["redis"]["db"] = 15;
+    config["redis"]["pool_size"] = 4;
+    config["redis"]["pool_wait_timeout"] = 1000;
+
+    auto out_path = std::filesystem::temp_directory_path() /
+        ("mychat-gateway-tcp-" +
+         std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) +
+         ".json");
+    std::ofstream output(out_path);
+    if (!output) {
+        throw std::runtime_error("Failed to write temp Gateway config");
+    }
+    output << config.dump(2);
+    return out_path;
+}
+
+bool wait_until(const std::function<bool()>& done, std::chrono::milliseconds timeout = 3s) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!done()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(5ms);
+    }
+    return true;
+}
+
+class TcpClient {
+public:
+    explicit TcpClient(int port) : socket_(ioc_) {
+        socket_.connect(tcp::endpoint(net::ip::make_address("127.0.0.1"), port));
+        timeval tv{};
+        tv.tv_sec = 3;
+        ::setsockopt(socket_.native_handle(), SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    }
+
+    void write(HeaderMsgType type, const std::string& body) {
+        std::string frame(HEADER_SIZE, '\0');
+        const uint32_t length = htonl(static_cast<uint32_t>(body.size()));
+        std::memcpy(frame.data(), &length, sizeof(length));
+        frame[4] = static_cast<char>(type);
+        net::write(socket_, net::buffer(frame + body));
+    }
+
+    // Next NORMAL frame body; heartbeat frames from the session are skipped.
+    bool read_normal(std::string& body, boost::system::error_code& ec) {
+        for (;;) {
+            std::array<char, HEADER_SIZE> header{};
+            net::read(socket_, net::buffer(header), ec);
+            if (ec) {
+                return false;
+            }
+            uint32_t length = 0;
+            std::memcpy(&length, header.data(), sizeof(length));
+            body.resize(ntohl(length));
+            net::read(socket_, net::buffer(body), ec);
+            if (ec) {
+                return false;
+            }
+            if (static_cast<HeaderMsgType>(header[4]) == HeaderMsgType::NORMAL) {
+                return true;
+            }
+        }
+    }
+
+    bool closed_by_peer() {
+        std::string body;
+        boost::system::error_code ec;
+        if (read_normal(body, ec)) {
+            return false;
+        }
+        return ec == net::error::eof || ec == net::error::connection_reset;
+    }
+
+private:
+    net::io_context ioc_;
+    tcp::socket socket_;
+};
+
+class GatewayTcpTransportTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        redis_manager().shutdown();
+        ASSERT_TRUE(redis_manager().initialize(test_redis_config()))
+            << "Start Redis with `docker compose up -d redis` before running this test.";
+
+        ws_port_ = find_free_port();
+        http_port_ = find_free_port();
+        tcp_port_ = find_free_port();
+        temp_config_ = write_temp_config(ws_port_, http_port_, tcp_port_);
+        gateway_ = std::make_unique<GatewayServer>(
+            temp_config_.string(), temp_config_.string(), ws_port_, http_port_);
+        gateway_->start();
+        ASSERT_TRUE(wait_until([this] {
+            net::io_context ioc;
+            tcp::socket probe(ioc);
+            boost::system::error_code ec;
+            probe.connect(tcp::endpoint(net::ip::make_address("127.0.0.1"), tcp_port_), ec);
+            return !ec;
+        })) << "TCP port never started listening";
+    }
+
+    void TearDown() override {
+        if (gateway_) {
+            gateway_->stop();
+            gateway_.reset();
+        }
+        redis_manager().shutdown();
+        if (!temp_config_.empty()) {
+            std::error_code ec;
+            std::filesystem::remove(temp_config_, ec);
+        }
+    }
+
+    std::string unique_uid(const std::string& name) const {
+        return "gateway-tcp-test-" + name + "-" +
+               std::to_string(std::chrono::steady_clock::now().time_since_epoch().count());
+    }
+
+    std::string make_access_token(const std::string& uid) {
+        im::gateway::MultiPlatformAuthManager auth_mgr(kSecret, temp_config_.string());
+        return auth_mgr.generate_access_token(uid, uid + "-account", kDevice, kPlatform, 3600);
+    }
+
+    static std::string heartbeat_frame(const std::string& token, uint32_t seq) {
+        im::base::IMHeader header;
+        header.set_version("1.0");
+        header.set_seq(seq);
+        header.set_cmd_id(im::command::CMD_HEARTBEAT);
+        header.set_token(token);
+        header.set_device_id(kDevice);
+        header.set_platform(kPlatform);
+        std::string frame;
+        EXPECT_TRUE(ProtobufCodec::encode(header, im::base::BaseRequest{}, frame));
+        return frame;
+    }
+
+    int ws_port_ = 0;
+    int http_port_ = 0;
+    int tcp_port_ = 0;
+    std::filesystem::path temp_config_;
+    std::unique_ptr<GatewayServer> gateway_;
+};
+
+}  // namespace
+
+TEST_F(GatewayTcpTransportTest, AuthFrameBindsConnectionThenNormalFramesAreDispatched) {
+    const std::string uid = unique_uid("auth");
+    const std::string token = make_access_token(uid);
+    const size_t online_before = gateway_->get_online_count();
+
+    TcpClient client(tcp_port_);
+    client.write(HeaderMsgType::AUTH, token);
+    ASSERT_TRUE(wait_until([&] { return gateway_->get_online_count() == online_before + 1; }));
+
+    client.write(HeaderMsgType::NORMAL, heartbeat_frame(token, 41));
+    std::string body;
+    boost::system::error_code ec;
+    ASSERT_TRUE(client.read_normal(body, ec)) << ec.message();
+    im::base::IMHeader header;
+    im::base::BaseResponse resp;
+    ASSERT_TRUE(ProtobufCodec::decode(body, header, resp));
+    EXPECT_EQ(header.cmd_id(), static_cast<uint32_t>(im::command::CMD_HEARTBEAT));
+    EXPECT_EQ(header.seq(), 41u);
+    EXPECT_EQ(resp.error_code(), im::base::SUCCESS);
+
+    // The bound connection is reachable by user id, like a WebSocket one.
+    ASSERT_TRUE(gateway_->push_message_to_user(uid, "pushed-over-tcp"));
+    ASSERT_TRUE(client.read_normal(body, ec)) << ec.message();
+    EXPECT_EQ(body, "pushed-over-tcp");
+}
+
+TEST_F(GatewayTcpTransportTest, InvalidTokenGetsAuthFailedNoticeThenClose) {
+    const size_t online_before = gateway_->get_online_count();
+
+    TcpClient client(tcp_port_);
+    client.write(HeaderMsgType::AUTH, "not-a-valid-token");
+
+    std::string body;
+    boost::system::error_code ec;
+    ASSERT_TRUE(client.read_normal(body, ec)) << ec.message();
+    im::base::IMHeader header;
+    im::base::BaseResponse resp;
+    ASSERT_TRUE(ProtobufCodec::decode(body, header, resp));
+    EXPECT_EQ(header.cmd_id(), static_cast<uint32_t>(im::command::CMD_SERVER_NOTIFY));
+    EXPECT_EQ(header.seq(), 0u);
+    EXPECT_EQ(resp.error_code(), im::base::AUTH_FAILED);
+
+    EXPECT_TRUE(client.closed_by_peer());
+    EXPECT_EQ(gateway_->get_online_count(), online_before);
+}
+
+TEST_F(GatewayTcpTransportTest, DuplicateAuthFrameClosesAndUnbindsConnection) {
+    const std::string uid = unique_uid("dup");
+    const std::string token = make_access_token(uid);
+    const size_t online_before = gateway_->get_online_count();
+
+    TcpClient client(tcp_port_);
+    client.write(HeaderMsgType::AUTH, token);
+    ASSERT_TRUE(wait_until([&] { return gateway_->get_online_count() == online_before + 1; }));
+
+    client.write(HeaderMsgType::AUTH, token);
+    EXPECT_TRUE(client.closed_by_peer());
+    EXPECT_TRUE(wait_until([&] { return gateway_->get_online_count() == online_before; }));
+    EXPECT_FALSE(gateway_->push_message_to_user(uid, "nobody-home"));
+}
+
+TEST_F(GatewayTcpTransportTest, OversizedAuthFrameClosesBeforeAuthentication) {
+    const size_t online_before = gateway_->get_online_count();
+
+    TcpClient client(tcp_port_);
+    client.write(HeaderMsgType::AUTH, std::string(4097, 't'));
+    EXPECT_TRUE(client.closed_by_peer());
+    EXPECT_EQ(gateway_->get_online_count(), online_before);
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <common/network/client_session.hpp>
+#include <common/network/protobuf_codec.hpp>
+#include <common/proto/base.pb.h>
+#include <common/proto/command.pb.h>
+#include <gateway/ws/inline_command_handler.hpp>
+
+namespace {
+
+using im::gateway::InlineCommandHandler;
+using im::network::ClientSession;
+using im::network::FrameHeaderV2;
+using im::network::ProtobufCodec;
+using im::network::WireVersion;
+
+class RecordingSession : public ClientSession {
+public:
+    RecordingSession(WireVersion version, std::string token)
+        : ClientSession("inline-session") {
+        wire_version_ = version;
+        identity_.token = std::move(token);
+    }
+
+    void send(const std::string& message) override { sent.push_back(message); }
+    void close() override {}
+    std::size_t pending_sends() const override { return 0; }
+    std::string get_client_ip() const override { return "127.0.0.1"; }
+
+    std::vector<std::string> sent;
+};
+
+constexpr char kToken[] = "conn-token";
+constexpr char kDevice[] = "device-1";
+constexpr char kTokenId[] = "jti-1";
+
+std::shared_ptr<RecordingSession> bound_session(
+        WireVersion version,
+        std::chrono::system_clock::duration expires_in = std::chrono::minutes(5)) {
+    auto session = std::make_shared<RecordingSession>(version, kToken);
+    session->bind_identity("user-1", kDevice, "web",
+                           std::chrono::system_clock::now() + expires_in, kTokenId);
+    return session;
+}
+
+im::base::IMHeader heartbeat_header(uint32_t seq) {
+    im::base::IMHeader header;
+    header.set_version("1.0");
+    header.set_seq(seq);
+    header.set_cmd_id(im::command::CMD_HEARTBEAT);
+    header.set_token(kToken);
+    header.set_device_id(kDevice);
+    header.set_platform("web");
+    return header;
+}
+
+std::string heartbeat_v2(uint32_t seq) {
+    std::string frame;
+    EXPECT_TRUE(ProtobufCodec::encode(heartbeat_header(seq), im::base::BaseRequest{}, frame,
+                                      WireVersion::V2));
+    return frame;
+}
+
+TEST(InlineCommandHandlerTest, V2HeartbeatCopiesTemplateWithRequestSeq) {
+    InlineCommandHandler handler;
+    auto session = bound_session(WireVersion::V2);
+
+    // Two different seqs: the shared template must be patched per frame.
+    for (uint32_t seq : {0x01020304u, 7u}) {
+        ASSERT_TRUE(handler.try_handle_frame(*session, heartbeat_v2(seq)));
+
+        FrameHeaderV2 header;
+        std::string body;
+        ASSERT_TRUE(ProtobufCodec::decodeFrameV2(session->sent.back(), header, body));
+        EXPECT_EQ(header.seq, seq);
+        EXPECT_EQ(header.cmd_id, static_cast<uint32_t>(im::command::CMD_HEARTBEAT));
+
+        im::base::BaseResponse resp;
+        ASSERT_TRUE(resp.ParseFromString(body));
+        EXPECT_EQ(resp.error_code(), im::base::SUCCESS);
+    }
+    EXPECT_EQ(session->sent.size(), 2u);
+    EXPECT_EQ(handler.handled(), 2u);
+}
+
+TEST(InlineCommandHandlerTest, V2FrameOtherThanInlineCommandIsNotHandled) {
+    InlineCommandHandler handler;
+    auto session = bound_session(WireVersion::V2);
+
+    auto header = heartbeat_header(1);
+    header.set_cmd_id(im::command::CMD_SEND_MESSAGE);
+    std::string frame;
+    ASSERT_TRUE(ProtobufCodec::encode(header, im::base::BaseRequest{}, frame, WireVersion::V2));
+    EXPECT_FALSE(handler.try_handle_frame(*session, frame));
+
+    // Truncated heartbeat: body_length no longer matches.
+    std::string truncated = heartbeat_v2(1);
+    truncated.push_back('x');
+    EXPECT_FALSE(handler.try_handle_frame(*session, truncated));
+    EXPECT_TRUE(session->sent.empty());
+}
+
+TEST(InlineCommandHandlerTest, V1HeartbeatAnsweredWhenHeaderMatchesConnection) {
+    InlineCommandHandler handler;
+    auto session = bound_session(WireVersion::V1);
+
+    ASSERT_TRUE(handler.try_handle_message(*session, heartbeat_header(99)));
+    ASSERT_EQ(session->sent.size(), 1u);
+
+    im::base::IMHeader resp_header;
+    im::base::BaseResponse resp;
+    ASSERT_TRUE(ProtobufCodec::decode(session->sent.front(), resp_header, resp));
+    EXPECT_EQ(resp_header.seq(), 99u);
+    EXPECT_EQ(resp_header.cmd_id(), static_cast<uint32_t>(im::command::CMD_HEARTBEAT));
+    EXPECT_EQ(resp.error_code(), im::base::SUCCESS);
+}
+
+TEST(InlineCommandHandlerTest, V1HeartbeatWithForeignTokenOrDeviceTakesRegularPath) {
+    InlineCommandHandler handler;
+    auto session = bound_session(WireVersion::V1);
+
+    auto other_token = heartbeat_header(1);
+    other_token.set_token("another-token");
+    EXPECT_FALSE(handler.try_handle_message(*session, other_token));
+
+    auto other_device = heartbeat_header(2);
+    other_device.set_device_id("device-2");
+    EXPECT_FALSE(handler.try_handle_message(*session, other_device));
+    EXPECT_TRUE(session->sent.empty());
+}
+
+TEST(InlineCommandHandlerTest, UnboundSessionIsNotHandled) {
+    InlineCommandHandler handler;
+    RecordingSession v2(WireVersion::V2, kToken);
+    RecordingSession v1(WireVersion::V1, kToken);
+
+    EXPECT_FALSE(handler.try_handle_frame(v2, heartbeat_v2(1)));
+    EXPECT_FALSE(handler.try_handle_message(v1, heartbeat_header(1)));
+    EXPECT_EQ(handler.handled(), 0u);
+}
+
+TEST(InlineCommandHandlerTest, ExpiredIdentityIsNotHandled) {
+    InlineCommandHandler handler;
+    auto v2 = bound_session(WireVersion::V2, -std::chrono::seconds(1));
+    auto v1 = bound_session(WireVersion::V1, -std::chrono::seconds(1));
+
+    EXPECT_FALSE(handler.try_handle_frame(*v2, heartbeat_v2(1)));
+    EXPECT_FALSE(handler.try_handle_message(*v1, heartbeat_header(1)));
+    EXPECT_TRUE(v2->sent.empty());
+    EXPECT_TRUE(v1->sent.empty());
+}
+
+TEST(InlineCommandHandlerTest, RevocationRecheckHandsOneFramePerIntervalToRegularPath) {
+    InlineCommandHandler handler(std::chrono::seconds(30));
+    auto session = bound_session(WireVersion::V2);
+
+    // Binding counts as a check, so the interval starts at connect time.
+    EXPECT_TRUE(handler.try_handle_frame(*session, heartbeat_v2(1)));
+
+    // Once the interval is over, one frame goes to the regular path...
+    session->mark_revocation_checked(std::chrono::steady_clock::now() -
+                                     std::chrono::seconds(31));
+    EXPECT_FALSE(handler.try_handle_frame(*session, heartbeat_v2(2)));
+    // ...and the next interval starts from there.
+    EXPECT_TRUE(handler.try_handle_frame(*session, heartbeat_v2(3)));
+
+    auto v1 = bound_session(WireVersion::V1);
+    v1->mark_revocation_checked(std::chrono::steady_clock::now() - std::chrono::seconds(31));
+    EXPECT_FALSE(handler.try_handle_message(*v1, heartbeat_header(4)));
+    EXPECT_TRUE(handler.try_handle_message(*v1, heartbeat_header(5)));
+    EXPECT_EQ(handler.handled(), 3u);
+}
+
+TEST(InlineCommandHandlerTest, ZeroRecheckIntervalOnlyEnforcesExpiry) {
+    InlineCommandHandler handler;
+    auto session = bound_session(WireVersion::V2);
+    session->mark_revocation_checked({});
+
+    EXPECT_TRUE(handler.try_handle_frame(*session, heartbeat_v2(1)));
+}
+
+TEST(InlineCommandHandlerTest, IdentityWithoutTokenIdIsNotHandledWhenRevocationIsChecked) {
+    InlineCommandHandler handler(std::chrono::seconds(30));
+    auto session = std::make_shared<RecordingSession>(WireVersion::V2, kToken);
+    session->bind_identity("user-1", kDevice, "web",
+                           std::chrono::system_clock::now() + std::chrono::minutes(5));
+
+    EXPECT_FALSE(handler.try_handle_frame(*session, heartbeat_v2(1)));
+}
+
+}  // namespace
@@ -0,0 +1,257 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <common/network/protobuf_codec.hpp>
+#include <common/proto/command.pb.h>
+#include <common/proto/push.pb.h>
+#include <gateway/connection_manager/connection_manager.hpp>
+#include <gateway/connection_manager/connection_state_store.hpp>
+#include <gateway/push/presence_fanout.hpp>
+
+namespace {
+
+using im::gateway::ConnectionManager;
+using im::gateway::DeviceSessionInfo;
+using im::gateway::InMemoryConnectionStateStore;
+using im::gateway::PresenceFanout;
+using im::network::ClientSession;
+using im::network::ProtobufCodec;
+using im::network::SessionPtr;
+
+class RecordingSession : public ClientSession {
+public:
+    explicit RecordingSession(std::string session_id) : ClientSession(std::move(session_id)) {}
+
+    void send(const std::string& message) override { sent.push_back(message); }
+    void close() override {}
+    std::size_t pending_sends() const override { return 0; }
+    std::string get_client_ip() const override { return "127.0.0.1"; }
+
+    std::vector<std::string> sent;
+};
+
+class FakeSessionLookup : public im::network::SessionLookup {
+public:
+    std::shared_ptr<RecordingSession> open(const std::string& session_id) {
+        auto session = std::make_shared<RecordingSession>(session_id);
+        sessions_[session_id] = session;
+        return session;
+    }
+
+    SessionPtr get_session(const std::string& session_id) const override {
+        auto it = sessions_.find(session_id);
+        return it == sessions_.end() ? nullptr : it->second;
+    }
+
+    std::vector<SessionPtr> get_sessions() const override {
+        std::vector<SessionPtr> sessions;
+        for (const auto& [id, session] : sessions_) {
+            sessions.push_back(session);
+        }
+        return sessions;
+    }
+
+private:
+    std::unordered_map<std::string, std::shared_ptr<RecordingSession>> sessions_;
+};
+
+// Decodes a CMD_USER_ONLINE frame into its change list.
+std::vector<im::push::PresenceItem> decode_presence(const std::string& frame) {
+    im::base::IMHeader header;
+    im::push::PresenceNotifyRequest request;
+    EXPECT_TRUE(ProtobufCodec::decode(frame, header, request));
+    EXPECT_EQ(header.cmd_id(), static_cast<uint32_t>(im::command::CMD_USER_ONLINE));
+    return {request.items().begin(), request.items().end()};
+}
+
+DeviceSessionInfo remote_session(const std::string& session_id, const std::string& device) {
+    DeviceSessionInfo info;
+    info.session_id = session_id;
+    info.device_id = device;
+    info.platform = "web";
+    info.connect_time = std::chrono::system_clock::now();
+    return info;
+}
+
+class PresenceFanoutTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto config_path =
+            (std::filesystem::path(MYCHAT_SOURCE_DIR) / "config/dev.json").string();
+        store_ = std::make_shared<InMemoryConnectionStateStore>();
+        conn_mgr_ = std::make_unique<ConnectionManager>(config_path, &lookup_, store_);
+        // No background thread: tests drive flushes with flush_now().
+        fanout_ = std::make_unique<PresenceFanout>(
+            [this](const std::string& uid) {
+                ++friend_lookups_;
+                return friends_[uid];
+            },
+            // Stands in for PushService::push_transient: sessions come from
+            // the shared store, only the ones on this gateway can be written.
+            [this](const std::string& receiver_uid, const std::string& frame) {
+                receivers_.push_back(receiver_uid);
+                std::size_t accepted = 0;
+                for (const auto& info : conn_mgr_->get_user_sessions(receiver_uid)) {
+                    if (auto session = lookup_.get_session(info.session_id)) {
+                        session->send(frame);
+                        ++accepted;
+                    }
+                }
+                return accepted;
+            },
+            [this](const std::string& uid) { return conn_mgr_->is_user_online(uid); },
+            std::chrono::milliseconds(2000));
+        conn_mgr_->set_presence_listener(fanout_.get());
+
+        friends_["alice"] = {"bob", "carol"};
+        friends_["bob"] = {"alice"};
+        friends_["carol"] = {"alice"};
+    }
+
+    std::shared_ptr<RecordingSession> connect(const std::string& uid,
+                                              const std::string& device,
+                                              const std::string& session_id) {
+        auto session = lookup_.open(session_id);
+        EXPECT_TRUE(conn_mgr_->add_connection(uid, device, "web", session));
+        return session;
+    }
+
+    FakeSessionLookup lookup_;
+    std::shared_ptr<InMemoryConnectionStateStore> store_;
+    std::unique_ptr<ConnectionManager> conn_mgr_;
+    std::unique_ptr<PresenceFanout> fanout_;
+    std::unordered_map<std::string, std::vector<std::string>> friends_;
+    std::vector<std::string> receivers_;
+    int friend_lookups_ = 0;
+};
+
+TEST_F(PresenceFanoutTest, PushesOnlineChangeToEveryFriend) {
+    auto bob = connect("bob", "pc", "s-bob");
+    fanout_->flush_now();
+    bob->sent.clear();
+    receivers_.clear();
+    friend_lookups_ = 0;
+
+    connect("alice", "phone", "s-alice");
+    EXPECT_EQ(fanout_->flush_now(), 1u);
+    EXPECT_EQ(friend_lookups_, 1);
+
+    // Both friends go through the push path; carol has no session to take it.
+    EXPECT_EQ(std::set<std::string>(receivers_.begin(), receivers_.end()),
+              (std::set<std::string>{"bob", "carol"}));
+    ASSERT_EQ(bob->sent.size(), 1u);
+    auto changes = decode_presence(bob->sent.front());
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_EQ(changes[0].uid(), "alice");
+    EXPECT_TRUE(changes[0].online());
+    EXPECT_GT(changes[0].changed_at_ms(), 0);
+    EXPECT_EQ(fanout_->stats().frames, 1u);
+}
+
+TEST_F(PresenceFanoutTest, FriendOnAnotherGatewayIsStillAReceiver) {
+    // bob is registered by another gateway: in the store, not in our lookup.
+    store_->add("bob", remote_session("remote-bob", "pc"));
+
+    connect("alice", "phone", "s-alice");
+    EXPECT_EQ(fanout_->flush_now(), 1u);
+    EXPECT_NE(std::find(receivers_.begin(), receivers_.end(), "bob"), receivers_.end());
+}
+
+TEST_F(PresenceFanoutTest, SecondDeviceIsNotATransition) {
+    auto bob = connect("bob", "pc", "s-bob");
+    connect("alice", "phone", "s-alice-1");
+    fanout_->flush_now();
+    bob->sent.clear();
+
+    connect("alice", "laptop", "s-alice-2");
+    conn_mgr_->remove_connection("alice", "phone");
+    EXPECT_EQ(fanout_->flush_now(), 0u);
+    EXPECT_EQ(fanout_->flush_now(), 0u);
+    EXPECT_TRUE(bob->sent.empty());
+}
+
+TEST_F(PresenceFanoutTest, FlappingWithinWindowIsCoalesced) {
+    auto bob = connect("bob", "pc", "s-bob");
+    connect("alice", "phone", "s-alice-1");
+    fanout_->flush_now();
+    bob->sent.clear();
+    friend_lookups_ = 0;
+
+    // Reconnect: offline then online again before the next flush.
+    conn_mgr_->remove_connection("alice", "phone");
+    connect("alice", "phone", "s-alice-2");
+    EXPECT_EQ(fanout_->flush_now(), 0u);
+    EXPECT_EQ(friend_lookups_, 0);
+    EXPECT_TRUE(bob->sent.empty());
+    EXPECT_EQ(fanout_->stats().coalesced, 1u);
+
+    // A real departure is held back one flush, then published.
+    conn_mgr_->remove_connection("alice", "phone");
+    EXPECT_EQ(fanout_->flush_now(), 0u);
+    EXPECT_TRUE(bob->sent.empty());
+    EXPECT_EQ(fanout_->flush_now(), 1u);
+    ASSERT_EQ(bob->sent.size(), 1u);
+    auto changes = decode_presence(bob->sent.front());
+    ASSERT_EQ(changes.size(), 1u);
+    EXPECT_FALSE(changes[0].online());
+}
+
+TEST_F(PresenceFanoutTest, ReconnectThroughAnotherGatewayIsNotAnOfflineFlap) {
+    auto bob = connect("bob", "pc", "s-bob");
+    connect("alice", "phone", "s-alice");
+    fanout_->flush_now();
+    bob->sent.clear();
+
+    // Hot restart drain: this gateway closes alice, who reconnects to the new
+    // process. The new process registers her in the shared store; this
+    // gateway's listener never sees it.
+    conn_mgr_->remove_connection("alice", "phone");
+    EXPECT_EQ(fanout_->flush_now(), 0u);
+    store_->add("alice", remote_session("new-process-alice", "phone"));
+    EXPECT_EQ(fanout_->flush_now(), 0u);
+    EXPECT_EQ(fanout_->flush_now(), 0u);
+    EXPECT_TRUE(bob->sent.empty());
+    EXPECT_EQ(fanout_->stats().coalesced, 1u);
+}
+
+TEST_F(PresenceFanoutTest, ReplacedSessionClosingLateKeepsUserOnline) {
+    auto bob = connect("bob", "pc", "s-bob");
+    auto old_session = connect("alice", "phone", "s-alice-1");
+    fanout_->flush_now();
+    bob->sent.clear();
+
+    // The same device reconnects before the old connection's close lands.
+    connect("alice", "phone", "s-alice-2");
+    conn_mgr_->remove_connection(old_session);
+    EXPECT_EQ(fanout_->flush_now(), 0u);
+    EXPECT_TRUE(bob->sent.empty());
+    EXPECT_EQ(conn_mgr_->get_online_count(), 2u);
+    EXPECT_EQ(conn_mgr_->get_user_sessions("alice").size(), 1u);
+}
+
+TEST_F(PresenceFanoutTest, BatchesChangesPerReceiver) {
+    auto alice = connect("alice", "phone", "s-alice");
+    fanout_->flush_now();
+    alice->sent.clear();
+    const auto frames_before = fanout_->stats().frames;
+
+    connect("bob", "pc", "s-bob");
+    connect("carol", "pc", "s-carol");
+    EXPECT_EQ(fanout_->flush_now(), 2u);
+
+    // Both friends came online in the same window: one frame with two entries.
+    ASSERT_EQ(alice->sent.size(), 1u);
+    auto changes = decode_presence(alice->sent.front());
+    EXPECT_EQ(changes.size(), 2u);
+    EXPECT_EQ(fanout_->stats().frames - frames_before, 1u);
+}
+
+}  // namespace
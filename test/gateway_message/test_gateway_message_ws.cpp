@@ -5,6 +5,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include <nlohmann/json.hpp>
@@ -18,12 +19,16 @@
 
 #include <database/redis/redis_mgr.hpp>
 
+#include <network/protobuf_arena_pool.hpp>
 #include <gateway/http/message_client.hpp>
 #include <gateway/gateway_server/gateway_server.hpp>
+#include <gateway/push/delivery_ledger.hpp>
+#include <gateway/ws/delivery_ack_coalescer.hpp>
 #include <gateway/ws/message_ws_handler.hpp>
 #include <gateway/auth/multi_platform_auth.hpp>
 #include <gateway/connection_manager/connection_manager.hpp>
 #include <gateway/push/push_service.hpp>
+#include <offline_outbox.hpp>
 #include <push_notifier.hpp>
 #include <message_service.hpp>
 #include <message_repository.hpp>
@@ -43,6 +48,8 @@ using im::base::ErrorCode;
 using im::db::RedisConfig;
 using im::db::redis_manager;
 using im::gateway::ConnectionManager;
+using im::gateway::DeliveryAckCoalescer;
+using im::gateway::DeliveryLedger;
 using im::gateway::GatewayServer;
 using im::gateway::LocalMessageClient;
 using im::gateway::MessageWsHandler;
@@ -96,6 +103,8 @@ public:
     std::vector<PushCall> calls;
 };
 
+const std::string kAckSession = "test-ack-session";
+
 class GatewayMessageWsTest : public ::testing::Test {
 protected:
     void SetUp() override {
@@ -200,6 +209,50 @@ protected:
         return msg;
     }
 
+    // Build a UnifiedMessage carrying a CMD_MESSAGE_DELIVERED ack from
+    // kAckSession.
+    std::unique_ptr<UnifiedMessage> make_delivered_ack(const std::string& token,
+                                                       uint64_t up_to_msg_id)
+    {
+        auto msg = std::make_unique<UnifiedMessage>();
+
+        im::base::IMHeader header;
+        header.set_version("1.0");
+        header.set_seq(77);
+        header.set_cmd_id(im::command::CMD_MESSAGE_DELIVERED);
+        header.set_token(token);
+        header.set_device_id("task8-device");
+        header.set_platform("web");
+        header.set_timestamp(static_cast<uint64_t>(now_ms()));
+        msg->set_header(std::move(header));
+
+        UnifiedMessage::SessionContext ctx;
+        ctx.protocol = UnifiedMessage::Protocol::WEBSOCKET;
+        ctx.session_id = kAckSession;
+        ctx.receive_time = std::chrono::system_clock::now();
+        msg->set_session_context(std::move(ctx));
+
+        im::message::MarkMessageDeliveredRequest ack;
+        ack.set_msg_id(up_to_msg_id);
+        std::string payload;
+        ack.SerializeToString(&payload);
+        msg->set_protobuf_payload(payload);
+        msg->set_protobuf_type_name("im.message.MarkMessageDeliveredRequest");
+        return msg;
+    }
+
+    uint64_t send_direct(const std::string& sender, const std::string& receiver) {
+        im::service::message::SendRequest req;
+        req.sender_uid = sender;
+        req.receiver_uid = receiver;
+        req.content = "ack me";
+        req.msg_type = im::service::message::MessageType::TEXT;
+        req.now_ms = now_ms();
+        auto r = msg_service_->send_text_message(req);
+        EXPECT_TRUE(r.ok);
+        return r.data.msg_id;
+    }
+
     std::unique_ptr<UnifiedMessage> make_heartbeat_message(
         const std::string& token,
         const std::string& uid,
@@ -315,6 +368,93 @@ TEST_F(GatewayMessageWsTest, SendWithValidTokenPersistsAndReturnsResponse) {
     EXPECT_TRUE(found) << "Persisted message not found in DB";
 }
 
+TEST_F(GatewayMessageWsTest, SendOverV2FrameTakesReceiverFromBodyAndRepliesInV2) {
+    std::string token_user = "task8-test-v2-user";
+    std::string receiver = "task8-test-v2-rec";
+    std::string token = make_token(token_user);
+
+    // What MessageParser produces for a v2 frame: identity fields come from
+    // the connection, there is no to_uid and no type name, only a type id.
+    auto msg = std::make_unique<UnifiedMessage>();
+    im::base::IMHeader header;
+    header.set_version("2");
+    header.set_seq(43);
+    header.set_cmd_id(im::command::CMD_SEND_MESSAGE);
+    header.set_from_uid(token_user);
+    header.set_token(token);
+    header.set_device_id("task8-device");
+    header.set_platform("web");
+    msg->set_header(std::move(header));
+
+    UnifiedMessage::SessionContext ctx;
+    ctx.protocol = UnifiedMessage::Protocol::WEBSOCKET;
+    ctx.session_id = "test-ws-v2-session";
+    ctx.receive_time = std::chrono::system_clock::now();
+    ctx.wire_version = im::network::WireVersion::V2;
+    msg->set_session_context(std::move(ctx));
+
+    im::message::SendMessageRequest send_req;
+    send_req.mutable_body()->set_content("Hello v2!");
+    send_req.mutable_body()->set_receiver_uid(receiver);
+    std::string payload;
+    send_req.SerializeToString(&payload);
+    msg->set_protobuf_payload(payload);
+    msg->set_protobuf_type_id(im::network::wire_type_id_v<im::message::SendMessageRequest>);
+
+    ProcessorResult result = ws_handler_->handle_send(*msg);
+    ASSERT_EQ(result.status_code, 0) << "Error: " << result.error_message;
+
+    im::network::FrameHeaderV2 frame_header;
+    std::string body;
+    ASSERT_TRUE(ProtobufCodec::decodeFrameV2(result.protobuf_message, frame_header, body));
+    EXPECT_EQ(frame_header.seq, 43u);
+    EXPECT_EQ(frame_header.type_id,
+              im::network::wire_type_id_v<im::message::SendMessageResponse>);
+
+    im::message::SendMessageResponse resp;
+    ASSERT_TRUE(resp.ParseFromString(body));
+    EXPECT_EQ(resp.base().error_code(), im::base::SUCCESS);
+    EXPECT_EQ(resp.message().content(), "Hello v2!");
+
+    uint64_t msg_id = std::stoull(resp.message().message_id());
+    auto msgs = msg_service_->get_conversation(token_user, receiver, INT64_MAX, 10);
+    bool found = false;
+    for (const auto& m : msgs) {
+        if (m.msg_id == msg_id) {
+            EXPECT_EQ(m.receiver_uid, receiver);
+            found = true;
+            break;
+        }
+    }
+    EXPECT_TRUE(found) << "Persisted message not found in DB";
+}
+
+TEST_F(GatewayMessageWsTest, SendBuildsProtobufObjectsOnPooledRequestArena) {
+    std::string token_user = "task8-test-arena-user";
+    std::string receiver = "task8-test-arena-rec";
+    std::string token = make_token(token_user);
+
+    // Warm the pool so the next request can reuse a returned arena.
+    ws_handler_->handle_send(*make_send_message(token, token_user, receiver, "warm up"));
+    const auto before = im::network::ArenaPool::global().stats();
+
+    for (int i = 0; i < 3; ++i) {
+        auto msg = make_send_message(token, token_user, receiver, "arena " + std::to_string(i));
+        ProcessorResult result = ws_handler_->handle_send(*msg);
+        ASSERT_EQ(result.status_code, 0) << "Error: " << result.error_message;
+
+        im::base::IMHeader resp_header;
+        im::message::SendMessageResponse resp;
+        ASSERT_TRUE(ProtobufCodec::decode(result.protobuf_message, resp_header, resp));
+        EXPECT_EQ(resp.message().content(), "arena " + std::to_string(i));
+        EXPECT_EQ(resp_header.seq(), msg->get_header().seq());
+    }
+
+    const auto after = im::network::ArenaPool::global().stats();
+    EXPECT_EQ(after.acquired - before.acquired, 3u);
+    EXPECT_EQ(after.reused - before.reused, 3u);
+}
+
 TEST_F(GatewayMessageWsTest, SuccessfulSendNotifiesReceiverThroughBoundary) {
     std::string sender = "task8-test-notify-sender";
     std::string receiver = "task8-test-notify-rec";
@@ -385,6 +525,26 @@ TEST_F(GatewayMessageWsTest, InvalidTokenReturnsAuthFailed) {
     EXPECT_EQ(resp.base().error_code(), im::base::AUTH_FAILED);
 }
 
+TEST_F(GatewayMessageWsTest, InvalidTokenRejectedBeforePayloadIsChecked) {
+    // An unauthenticated frame gets AUTH_FAILED whatever its type or payload,
+    // so it learns nothing about what the wrapper would accept.
+    auto wrong_type = make_send_message("invalid-token", "any-user", "rec", "x",
+                                        "task8-device", im::command::CMD_SEND_MESSAGE,
+                                        "im.message.SomeOtherType");
+    EXPECT_EQ(ws_handler_->handle_send(*wrong_type).status_code,
+              im::base::ErrorCode::AUTH_FAILED);
+
+    auto garbage = make_send_message("invalid-token", "any-user", "rec", "x");
+    garbage->set_protobuf_payload("not-a-valid-protobuf-message");
+    ProcessorResult result = ws_handler_->handle_send(*garbage);
+    EXPECT_EQ(result.status_code, im::base::ErrorCode::AUTH_FAILED);
+
+    im::base::IMHeader resp_header;
+    im::message::SendMessageResponse resp;
+    ASSERT_TRUE(ProtobufCodec::decode(result.protobuf_message, resp_header, resp));
+    EXPECT_EQ(resp.base().error_code(), im::base::AUTH_FAILED);
+}
+
 TEST_F(GatewayMessageWsTest, DeviceIdMismatchReturnsAuthFailed) {
     std::string token_user = "task8-test-device-mismatch";
     std::string token = make_token(token_user, "token-device");
@@ -553,6 +713,87 @@ TEST_F(GatewayMessageWsTest, WrongCmdIdRejected) {
     }
 }
 
+TEST_F(GatewayMessageWsTest, TypedProcessorDecodesRequestAndEncodesResponse) {
+    int calls = 0;
+    auto processor = im::gateway::make_typed_processor<im::command::CMD_SEND_MESSAGE,
+                                                       im::message::SendMessageRequest,
+                                                       im::message::SendMessageResponse>(
+        [&calls](const UnifiedMessage&, const im::message::SendMessageRequest& req,
+                 im::message::SendMessageResponse& resp) {
+            ++calls;
+            resp.mutable_message()->set_content(req.body().content());
+            return im::gateway::HandlerStatus::ok();
+        });
+
+    // Wrong type and wrong cmd are rejected by the wrapper; the handler never runs.
+    auto wrong_type = make_send_message("t", "u", "rec", "x", "task8-device",
+                                        im::command::CMD_SEND_MESSAGE,
+                                        "im.message.SomeOtherType");
+    EXPECT_EQ(processor(*wrong_type).status_code, im::base::ErrorCode::INVALID_REQUEST);
+    auto wrong_cmd = make_send_message("t", "u", "rec", "x", "task8-device",
+                                       im::command::CMD_HEARTBEAT);
+    EXPECT_EQ(processor(*wrong_cmd).status_code, im::base::ErrorCode::INVALID_REQUEST);
+    EXPECT_EQ(calls, 0);
+
+    auto msg = make_send_message("t", "u", "rec", "typed echo");
+    ProcessorResult result = processor(*msg);
+    ASSERT_EQ(result.status_code, 0) << result.error_message;
+    EXPECT_EQ(calls, 1);
+
+    im::base::IMHeader resp_header;
+    im::message::SendMessageResponse resp;
+    ASSERT_TRUE(ProtobufCodec::decode(result.protobuf_message, resp_header, resp));
+    EXPECT_EQ(resp_header.seq(), 42u);
+    EXPECT_EQ(resp.base().error_code(), im::base::SUCCESS);
+    EXPECT_EQ(resp.message().content(), "typed echo");
+}
+
+TEST_F(GatewayMessageWsTest, AuthenticatedProcessorAuthenticatesBeforeParsing) {
+    int auth_calls = 0;
+    int calls = 0;
+    auto processor = im::gateway::make_authenticated_processor<
+        im::command::CMD_SEND_MESSAGE, im::message::SendMessageRequest,
+        im::message::SendMessageResponse, std::string>(
+        [&auth_calls](const UnifiedMessage& msg, std::string& uid) {
+            ++auth_calls;
+            if (msg.get_header().token() != "good") {
+                return im::gateway::HandlerStatus::error(im::base::ErrorCode::AUTH_FAILED,
+                                                         "bad token");
+            }
+            uid = "authed-user";
+            return im::gateway::HandlerStatus::ok();
+        },
+        [&calls](const UnifiedMessage&, const std::string& uid,
+                 const im::message::SendMessageRequest& req,
+                 im::message::SendMessageResponse& resp) {
+            ++calls;
+            resp.mutable_message()->set_content(uid + ":" + req.body().content());
+            return im::gateway::HandlerStatus::ok();
+        });
+
+    // A bad token wins over a wrong cmd id: the wrapper never gets as far as
+    // the type checks.
+    auto unauthenticated = make_send_message("bad", "u", "rec", "x", "task8-device",
+                                             im::command::CMD_HEARTBEAT);
+    EXPECT_EQ(processor(*unauthenticated).status_code, im::base::ErrorCode::AUTH_FAILED);
+    EXPECT_EQ(auth_calls, 1);
+    EXPECT_EQ(calls, 0);
+
+    auto wrong_cmd = make_send_message("good", "u", "rec", "x", "task8-device",
+                                       im::command::CMD_HEARTBEAT);
+    EXPECT_EQ(processor(*wrong_cmd).status_code, im::base::ErrorCode::INVALID_REQUEST);
+    EXPECT_EQ(calls, 0);
+
+    ProcessorResult result = processor(*make_send_message("good", "u", "rec", "hi"));
+    ASSERT_EQ(result.status_code, 0) << result.error_message;
+    EXPECT_EQ(calls, 1);
+
+    im::base::IMHeader resp_header;
+    im::message::SendMessageResponse resp;
+    ASSERT_TRUE(ProtobufCodec::decode(result.protobuf_message, resp_header, resp));
+    EXPECT_EQ(resp.message().content(), "authed-user:hi");
+}
+
 // --- Task 007: Online push-path tests ---
 
 TEST_F(GatewayMessageWsTest, NullConnMgrSkipsPushGracefully) {
@@ -610,4 +851,181 @@ TEST_F(GatewayMessageWsTest, ConnMgrWithNoSessionsStaysUndelivered) {
     }
 }
 
+TEST_F(GatewayMessageWsTest, DeliveredAckWithoutLedgerMarksOnlyThatMessage) {
+    std::string sender = "task8-test-ack-sender";
+    std::string receiver = "task8-test-ack-rec";
+    const uint64_t first = send_direct(sender, receiver);
+    const uint64_t second = send_direct(sender, receiver);
+
+    auto msg = make_delivered_ack(make_token(receiver), second);
+    ProcessorResult result = ws_handler_->handle_delivered_ack(*msg);
+
+    EXPECT_EQ(result.status_code, 0) << result.error_message;
+    EXPECT_TRUE(result.protobuf_message.empty());
+
+    auto pending = msg_service_->pull_offline(receiver, INT64_MAX, 10);
+    ASSERT_EQ(pending.size(), 1u);
+    EXPECT_EQ(pending[0].msg_id, first);
+}
+
+TEST_F(GatewayMessageWsTest, DeliveredAckCoversOnlyWhatTheSessionWasSent) {
+    std::string sender = "task8-test-ledger-sender";
+    std::string receiver = "task8-test-ledger-rec";
+    const uint64_t older = send_direct(sender, receiver);
+    const uint64_t unsent = send_direct(sender, receiver);
+    const uint64_t live = send_direct(sender, receiver);
+
+    // A live push goes out first; the catch-up frame with the older message
+    // is queued behind it, and `unsent` never reaches this session.
+    DeliveryLedger ledger;
+    ledger.record(kAckSession, {live});
+    ledger.record(kAckSession, {older});
+    ws_handler_->set_delivery_ledger(&ledger);
+
+    const std::string token = make_token(receiver);
+    auto ack_live = make_delivered_ack(token, live);
+    EXPECT_EQ(ws_handler_->handle_delivered_ack(*ack_live).status_code, 0);
+    auto pending = msg_service_->pull_offline_after(receiver, 0, 10);
+    ASSERT_EQ(pending.size(), 2u);
+    EXPECT_EQ(pending[0].msg_id, older);
+    EXPECT_EQ(pending[1].msg_id, unsent);
+
+    auto ack_older = make_delivered_ack(token, older);
+    EXPECT_EQ(ws_handler_->handle_delivered_ack(*ack_older).status_code, 0);
+    pending = msg_service_->pull_offline_after(receiver, 0, 10);
+    ASSERT_EQ(pending.size(), 1u);
+    EXPECT_EQ(pending[0].msg_id, unsent);
+
+    // An ack for something this session was never sent marks nothing.
+    auto ack_unsent = make_delivered_ack(token, unsent);
+    EXPECT_EQ(ws_handler_->handle_delivered_ack(*ack_unsent).status_code, 0);
+    EXPECT_EQ(msg_service_->pull_offline_after(receiver, 0, 10).size(), 1u);
+    ws_handler_->set_delivery_ledger(nullptr);
+}
+
+TEST_F(GatewayMessageWsTest, DeliveredAckWithoutMsgIdRejected) {
+    std::string receiver = "task8-test-ack-bad";
+    auto msg = make_delivered_ack(make_token(receiver), 0);
+
+    ProcessorResult result = ws_handler_->handle_delivered_ack(*msg);
+
+    EXPECT_EQ(result.status_code, im::base::PARAM_ERROR);
+    im::base::IMHeader resp_header;
+    im::message::MarkMessageDeliveredResponse resp;
+    ASSERT_TRUE(ProtobufCodec::decode(result.protobuf_message, resp_header, resp));
+    EXPECT_EQ(resp.base().error_code(), im::base::PARAM_ERROR);
+}
+
+TEST_F(GatewayMessageWsTest, DeliveredAcksCoalescePerUser) {
+    std::string sender = "task8-test-coalesce-sender";
+    std::string receiver = "task8-test-coalesce-rec";
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < 5; ++i) {
+        ids.push_back(send_direct(sender, receiver));
+    }
+
+    DeliveryLedger ledger;
+    ledger.record(kAckSession, {ids[0], ids[1], ids[2], ids[3]});
+    ws_handler_->set_delivery_ledger(&ledger);
+
+    int writes = 0;
+    DeliveryAckCoalescer coalescer(
+        [&](const std::string& uid, const std::vector<uint64_t>& msg_ids) {
+            ++writes;
+            msg_client_->mark_delivered_ids(uid, msg_ids, now_ms());
+        },
+        std::chrono::hours(1));
+    ws_handler_->set_delivery_ack_coalescer(&coalescer);
+
+    const std::string token = make_token(receiver);
+    for (uint64_t id : {ids[1], ids[3], ids[2]}) {
+        auto msg = make_delivered_ack(token, id);
+        EXPECT_EQ(ws_handler_->handle_delivered_ack(*msg).status_code, 0);
+    }
+    EXPECT_EQ(msg_service_->pull_offline(receiver, INT64_MAX, 10).size(), 5u);
+
+    EXPECT_EQ(coalescer.flush_now(), 1u);
+    EXPECT_EQ(writes, 1);
+    auto pending = msg_service_->pull_offline(receiver, INT64_MAX, 10);
+    ASSERT_EQ(pending.size(), 1u);
+    EXPECT_EQ(pending[0].msg_id, ids[4]);
+    // The third ack (ids[2]) was already covered by ids[3] and is dropped.
+    EXPECT_EQ(coalescer.stats().acks, 2u);
+    ws_handler_->set_delivery_ack_coalescer(nullptr);
+    ws_handler_->set_delivery_ledger(nullptr);
+}
+
+TEST_F(GatewayMessageWsTest, DeliveredAckTrimsOfflineOutbox) {
+    struct RecordingOutbox : im::service::push::OfflineOutbox {
+        bool append(const std::string&, const im::service::push::OfflineEntry&) override {
+            return true;
+        }
+        std::vector<im::service::push::OfflineEntry> peek(const std::string&, uint64_t,
+                                                          std::size_t) override {
+            return {};
+        }
+        void ack_range(const std::string& uid, uint64_t from, uint64_t to) override {
+            trims.push_back({uid, from, to});
+        }
+        std::vector<std::tuple<std::string, uint64_t, uint64_t>> trims;
+    };
+
+    std::string sender = "task8-test-trim-sender";
+    std::string receiver = "task8-test-trim-rec";
+    const uint64_t older = send_direct(sender, receiver);
+    const uint64_t live = send_direct(sender, receiver);
+
+    DeliveryLedger ledger;
+    ledger.record(kAckSession, {live});
+    ledger.record(kAckSession, {older});
+    ws_handler_->set_delivery_ledger(&ledger);
+    RecordingOutbox outbox;
+    ws_handler_->set_offline_outbox(&outbox);
+
+    const std::string token = make_token(receiver);
+    // Nothing is trimmed for an id the session was never sent.
+    auto ack_unknown = make_delivered_ack(token, live + 1000);
+    EXPECT_EQ(ws_handler_->handle_delivered_ack(*ack_unknown).status_code, 0);
+    EXPECT_TRUE(outbox.trims.empty());
+
+    // Ledger order is live first; the trim still spans lowest to highest id.
+    auto ack = make_delivered_ack(token, older);
+    EXPECT_EQ(ws_handler_->handle_delivered_ack(*ack).status_code, 0);
+    ASSERT_EQ(outbox.trims.size(), 1u);
+    EXPECT_EQ(outbox.trims[0], std::make_tuple(receiver, older, live));
+
+    ws_handler_->set_offline_outbox(nullptr);
+    ws_handler_->set_delivery_ledger(nullptr);
+}
+
+TEST(DeliveryLedgerTest, TakesThePrefixUpToTheAckedId) {
+    DeliveryLedger ledger;
+    ledger.record("s1", {30});
+    ledger.record("s1", {10, 20});
+    ledger.record("s2", {15});
+
+    EXPECT_TRUE(ledger.take_acked("s1", 15).empty());
+    EXPECT_EQ(ledger.take_acked("s1", 10), (std::vector<uint64_t>{30, 10}));
+    EXPECT_EQ(ledger.size("s1"), 1u);
+    EXPECT_TRUE(ledger.take_acked("s1", 10).empty());
+    EXPECT_EQ(ledger.size("s2"), 1u);
+
+    ledger.forget("s1");
+    EXPECT_EQ(ledger.size("s1"), 0u);
+    EXPECT_TRUE(ledger.take_acked("s1", 20).empty());
+}
+
+TEST(DeliveryLedgerTest, ForgetsTheOldestBeyondTheCap) {
+    DeliveryLedger ledger;
+    std::vector<uint64_t> ids;
+    for (uint64_t id = 1; id <= DeliveryLedger::kMaxPerSession + 2; ++id) {
+        ids.push_back(id);
+    }
+    ledger.record("s", ids);
+
+    EXPECT_EQ(ledger.size("s"), DeliveryLedger::kMaxPerSession);
+    EXPECT_TRUE(ledger.take_acked("s", 2).empty());
+    EXPECT_EQ(ledger.take_acked("s", 3), (std::vector<uint64_t>{3}));
+}
+
 } // anonymous namespace
@@ -32,6 +32,7 @@ namespace {
 
 using im::gateway::ConnectionManager;
 using im::gateway::LocalMessageClient;
+using im::gateway::RedisConnectionStateStore;
 using im::gateway::PushService;
 using im::db::RedisConfig;
 using im::db::redis_manager;
@@ -117,12 +118,13 @@ protected:
             [](auto& redis) {
                 for (int i = 0; i < 8; ++i) {
                     const std::string user = "task8-test-pool-user-" + std::to_string(i);
-                    redis.del("user:sessions:" + user);
-                    redis.del("user:platform:" + user);
+                    redis.del(RedisConnectionStateStore::user_sessions_key(user));
+                    redis.del(RedisConnectionStateStore::user_platform_key(user));
                     redis.srem("online:users", user);
                     for (int j = 0; j < 3; ++j) {
-                        redis.del("session:user:task8-test-pool-session-" +
-                                  std::to_string(i) + "-" + std::to_string(j));
+                        redis.del(RedisConnectionStateStore::session_owner_key(
+                                "task8-test-pool-session-" + std::to_string(i) + "-" +
+                                std::to_string(j)));
                     }
                 }
                 return true;
@@ -133,8 +135,8 @@ protected:
     static void SeedRedisSessions(const std::string& user, int user_index) {
         redis_manager().execute([&](auto& redis) {
             const auto now = std::chrono::system_clock::now();
-            const auto sessions_key = "user:sessions:" + user;
-            const auto devices_key = "user:platform:" + user;
+            const auto sessions_key = RedisConnectionStateStore::user_sessions_key(user);
+            const auto devices_key = RedisConnectionStateStore::user_platform_key(user);
             for (int j = 0; j < 3; ++j) {
                 im::gateway::DeviceSessionInfo info;
                 info.session_id = "task8-test-pool-session-" +
@@ -146,9 +148,10 @@ protected:
                 const auto field = info.device_id + ":" + info.platform;
                 redis.hset(sessions_key, field, info.to_json().dump());
                 redis.sadd(devices_key, field);
-                redis.hset("session:user:" + info.session_id, "user_id", user);
-                redis.hset("session:user:" + info.session_id, "device_id", info.device_id);
-                redis.hset("session:user:" + info.session_id, "platform", info.platform);
+                const auto owner_key = RedisConnectionStateStore::session_owner_key(info.session_id);
+                redis.hset(owner_key, "user_id", user);
+                redis.hset(owner_key, "device_id", info.device_id);
+                redis.hset(owner_key, "platform", info.platform);
             }
             redis.sadd("online:users", user);
             return true;
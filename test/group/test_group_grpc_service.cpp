@@ -63,6 +63,13 @@ protected:
                OR "sender_uid" IN (
                     SELECT "uid" FROM "im_users" WHERE "account" LIKE 'grpc-group-test-%'
                 ))");
+        db_->execute(R"(DELETE FROM "im_group_read_cursors"
+            WHERE "group_id" IN (
+                    SELECT "group_id" FROM "im_groups" WHERE "name" LIKE 'grpc-group-test-%'
+                )
+               OR "user_uid" IN (
+                    SELECT "uid" FROM "im_users" WHERE "account" LIKE 'grpc-group-test-%'
+                ))");
         db_->execute(R"(DELETE FROM "im_group_members"
             WHERE "group_id" IN (
                     SELECT "group_id" FROM "im_groups" WHERE "name" LIKE 'grpc-group-test-%'
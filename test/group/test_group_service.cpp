@@ -12,6 +12,7 @@
 
 #include <group_message_service.hpp>
 #include <group_service.hpp>
+#include <group_unread_cache.hpp>
 #include <user_service.hpp>
 #include <password_hasher.hpp>
 
@@ -26,6 +27,8 @@ using im::service::group::GroupResult;
 using im::service::group::GroupInfoDTO;
 using im::service::group::MemberInfoDTO;
 using im::service::group::GroupRole;
+using im::service::group::GroupUnreadCache;
+using im::service::group::GroupUnreadRow;
 using im::service::user::UserService;
 using im::service::user::PasswordHasher;
 using im::service::user::RegisterRequest;
@@ -54,6 +57,13 @@ public:
 
     void Cleanup() {
         odb::transaction t(db_->begin());
+        db_->execute(R"(DELETE FROM "im_group_read_cursors"
+            WHERE "group_id" IN (
+                    SELECT "group_id" FROM "im_groups" WHERE "name" LIKE 'group-test-%'
+                )
+               OR "user_uid" IN (
+                    SELECT "uid" FROM "im_users" WHERE "account" LIKE 'group-test-%'
+                ))");
         db_->execute(R"(DELETE FROM "im_group_members"
             WHERE "group_id" IN (
                     SELECT "group_id" FROM "im_groups" WHERE "name" LIKE 'group-test-%'
@@ -399,6 +409,13 @@ protected:
 
     void Cleanup() {
         odb::transaction t(db_->begin());
+        db_->execute(R"(DELETE FROM "im_group_read_cursors"
+            WHERE "group_id" IN (
+                    SELECT "group_id" FROM "im_groups" WHERE "name" LIKE 'gmsg-test-%'
+                )
+               OR "user_uid" IN (
+                    SELECT "uid" FROM "im_users" WHERE "account" LIKE 'gmsg-test-%'
+                ))");
         db_->execute(R"(DELETE FROM "im_group_messages"
             WHERE "group_id" IN (
                     SELECT "group_id" FROM "im_groups" WHERE "name" LIKE 'gmsg-test-%'
@@ -485,4 +502,168 @@ TEST_F(GroupMessageServiceTest, SendMessageMemberOk) {
     EXPECT_GT(result.msg_id, 0);
 }
 
+TEST_F(GroupMessageServiceTest, UnreadSummaryTracksSendsAndReadAcks) {
+    auto user_svc = std::make_shared<UserService>(db_, std::make_unique<PasswordHasher>());
+    auto group_svc = std::make_shared<GroupService>(db_, user_svc);
+    GroupMessageService svc(db_, user_svc, group_svc);
+
+    std::string owner = create_user(*user_svc, "gmsg-test-unread-owner");
+    std::string reader = create_user(*user_svc, "gmsg-test-unread-reader");
+
+    CreateGroupRequest creq;
+    creq.name = "gmsg-test-unread-group";
+    creq.creator_uid = owner;
+    creq.now_ms = kNowMs;
+    auto cres = group_svc->create_group(creq);
+    ASSERT_TRUE(cres.ok);
+
+    // History before joining does not count as unread.
+    ASSERT_TRUE(svc.send_message(cres.group_id, owner, "before join", kNowMs).ok);
+    ASSERT_TRUE(group_svc->join_group(cres.group_id, reader, kNowMs + 1).ok);
+
+    auto summary = svc.get_unread_summary(reader);
+    ASSERT_TRUE(summary.has_value());
+    ASSERT_EQ(summary->size(), 1u);
+    EXPECT_EQ((*summary)[0].group_id, cres.group_id);
+    EXPECT_EQ((*summary)[0].unread_count, 0);
+
+    auto m1 = svc.send_message(cres.group_id, owner, "one", kNowMs + 2);
+    auto m2 = svc.send_message(cres.group_id, owner, "two", kNowMs + 3);
+    ASSERT_TRUE(m1.ok);
+    ASSERT_TRUE(m2.ok);
+    ASSERT_TRUE(svc.send_message(cres.group_id, reader, "own", kNowMs + 4).ok);
+
+    // Served from the cache populated above.
+    summary = svc.get_unread_summary(reader);
+    ASSERT_TRUE(summary.has_value());
+    ASSERT_EQ(summary->size(), 1u);
+    EXPECT_EQ((*summary)[0].unread_count, 2);
+
+    // Partial ack drops the cached entry; the reload must agree.
+    ASSERT_TRUE(svc.mark_read(cres.group_id, reader, m1.msg_id, kNowMs + 5).ok);
+    summary = svc.get_unread_summary(reader);
+    ASSERT_TRUE(summary.has_value());
+    ASSERT_EQ(summary->size(), 1u);
+    EXPECT_EQ((*summary)[0].last_read_msg_id, m1.msg_id);
+    EXPECT_EQ((*summary)[0].unread_count, 1);
+
+    // An older ack never rewinds the cursor.
+    ASSERT_TRUE(svc.mark_read(cres.group_id, reader, 0, kNowMs + 6).ok);
+    GroupMessageService fresh(db_, user_svc, std::make_shared<GroupService>(db_, user_svc));
+    summary = fresh.get_unread_summary(reader);
+    ASSERT_TRUE(summary.has_value());
+    ASSERT_EQ(summary->size(), 1u);
+    EXPECT_EQ((*summary)[0].last_read_msg_id, m1.msg_id);
+    EXPECT_EQ((*summary)[0].unread_count, 1);
+
+    auto owner_summary = svc.get_unread_summary(owner);
+    ASSERT_TRUE(owner_summary.has_value());
+    ASSERT_EQ(owner_summary->size(), 1u);
+    EXPECT_EQ((*owner_summary)[0].unread_count, 1);
+}
+
+TEST_F(GroupMessageServiceTest, MarkReadRequiresMembershipAndCapsAtHead) {
+    auto user_svc = std::make_shared<UserService>(db_, std::make_unique<PasswordHasher>());
+    auto group_svc = std::make_shared<GroupService>(db_, user_svc);
+    GroupMessageService svc(db_, user_svc, group_svc);
+
+    std::string owner = create_user(*user_svc, "gmsg-test-cursor-owner");
+    std::string outsider = create_user(*user_svc, "gmsg-test-cursor-outsider");
+
+    CreateGroupRequest creq;
+    creq.name = "gmsg-test-cursor-group";
+    creq.creator_uid = owner;
+    creq.now_ms = kNowMs;
+    auto cres = group_svc->create_group(creq);
+    ASSERT_TRUE(cres.ok);
+    auto m1 = svc.send_message(cres.group_id, owner, "one", kNowMs + 1);
+    ASSERT_TRUE(m1.ok);
+
+    auto denied = svc.mark_read(cres.group_id, outsider, m1.msg_id, kNowMs + 2);
+    EXPECT_FALSE(denied.ok);
+    EXPECT_EQ(denied.error_code, "FORBIDDEN");
+    {
+        // No cursor row was created for the outsider.
+        odb::transaction t(db_->begin());
+        EXPECT_EQ(db_->execute("DELETE FROM \"im_group_read_cursors\" WHERE \"user_uid\" = '" +
+                               outsider + "'"),
+                  0u);
+        t.commit();
+    }
+
+    // An ack past the newest message stops at it.
+    ASSERT_TRUE(svc.mark_read(cres.group_id, owner, m1.msg_id + 1000, kNowMs + 3).ok);
+    auto summary = svc.get_unread_summary(owner);
+    ASSERT_TRUE(summary.has_value());
+    ASSERT_EQ(summary->size(), 1u);
+    EXPECT_EQ((*summary)[0].last_read_msg_id, m1.msg_id);
+}
+
+TEST(GroupUnreadCacheTest, FillRacingReadAckIsDropped) {
+    GroupUnreadCache cache;
+    GroupUnreadRow row;
+    row.group_id = 7;
+    row.last_msg_id = 10;
+    row.unread_count = 3;
+
+    // The ack lands between the database read and the put: the stale rows
+    // must not be cached over it.
+    auto ticket = cache.begin_fill("u1");
+    cache.on_read(7, "u1", 10);
+    cache.put("u1", {row}, ticket);
+    EXPECT_FALSE(cache.get("u1").has_value());
+
+    ticket = cache.begin_fill("u1");
+    cache.put("u1", {row}, ticket);
+    auto cached = cache.get("u1");
+    ASSERT_TRUE(cached.has_value());
+    EXPECT_EQ((*cached)[0].unread_count, 3);
+
+    // A send to the group also invalidates tickets taken before it.
+    ticket = cache.begin_fill("u2");
+    cache.on_message(7, 11, "u1", {"u1", "u2"});
+    cache.put("u2", {row}, ticket);
+    EXPECT_FALSE(cache.get("u2").has_value());
+}
+
+TEST_F(GroupMessageServiceTest, HistoryServedFromRecentWindowAfterFirstLoad) {
+    auto user_svc = std::make_shared<UserService>(db_, std::make_unique<PasswordHasher>());
+    auto group_svc = std::make_shared<GroupService>(db_, user_svc);
+    GroupMessageService svc(db_, user_svc, group_svc);
+
+    std::string owner = create_user(*user_svc, "gmsg-test-hist-owner");
+
+    CreateGroupRequest creq;
+    creq.name = "gmsg-test-hist-group";
+    creq.creator_uid = owner;
+    creq.now_ms = kNowMs;
+    auto cres = group_svc->create_group(creq);
+    ASSERT_TRUE(cres.ok);
+
+    ASSERT_TRUE(svc.send_message(cres.group_id, owner, "one", kNowMs + 1).ok);
+    ASSERT_TRUE(svc.send_message(cres.group_id, owner, "two", kNowMs + 2).ok);
+
+    auto first = svc.get_history(cres.group_id, kNowMs + 100, 10);
+    ASSERT_EQ(first.size(), 2u);
+    EXPECT_EQ(first[0].content, "two");
+    EXPECT_EQ(first[1].content, "one");
+    EXPECT_EQ(svc.history_cache_stats().hits, 0u);
+
+    // A send after the window was loaded is appended, not re-read.
+    ASSERT_TRUE(svc.send_message(cres.group_id, owner, "three", kNowMs + 3).ok);
+    auto second = svc.get_history(cres.group_id, kNowMs + 100, 2);
+    ASSERT_EQ(second.size(), 2u);
+    EXPECT_EQ(second[0].content, "three");
+    EXPECT_EQ(second[0].sender_nickname, first[0].sender_nickname);
+    EXPECT_EQ(second[1].content, "two");
+
+    auto older = svc.get_history(cres.group_id, kNowMs + 2, 10);
+    ASSERT_EQ(older.size(), 1u);
+    EXPECT_EQ(older[0].content, "one");
+
+    auto stats = svc.history_cache_stats();
+    EXPECT_EQ(stats.hits, 2u);
+    EXPECT_EQ(stats.entries, 1u);
+}
+
 } // anonymous namespace
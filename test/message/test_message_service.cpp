@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <odb/database.hxx>
 #include <odb/pgsql/database.hxx>
@@ -10,6 +12,7 @@
 #include <message.hpp>
 #include <message-odb.hxx>
 
+#include <message_partition_manager.hpp>
 #include <message_service.hpp>
 
 #include "../support/postgres_schema.hpp"
@@ -20,6 +23,8 @@ const char* kConnStr = "host=127.0.0.1 port=5432 dbname=mychat user=mychat passw
 
 constexpr int64_t kNowMs = 1718000000000;
 constexpr int64_t kLaterMs = 1718000005000;
+// 2040-03-15T00:00:00Z, a month no other test or the boot maintenance touches.
+constexpr int64_t kFarMonthMs = 2215382400000;
 
 class MessageServiceTest : public ::testing::Test {
 protected:
@@ -153,6 +158,70 @@ TEST_F(MessageServiceTest, GetConversationReturnsMessagesInOrder) {
     EXPECT_EQ(rev[2].create_time, kNowMs + 2000);
 }
 
+TEST_F(MessageServiceTest, GetConversationAppliesTimeBoundAndLimit) {
+    im::service::message::MessageService svc(db_);
+
+    for (int i = 0; i < 5; ++i) {
+        im::service::message::SendRequest req;
+        req.sender_uid = (i % 2 == 0) ? "task3-test-cvs-a" : "task3-test-cvs-b";
+        req.receiver_uid = (i % 2 == 0) ? "task3-test-cvs-b" : "task3-test-cvs-a";
+        req.content = "bounded " + std::to_string(i);
+        req.msg_type = im::service::message::MessageType::TEXT;
+        req.now_ms = kNowMs + i * 1000;
+        ASSERT_TRUE(svc.send_text_message(req).ok);
+    }
+
+    // Only rows strictly before the bound are eligible; the page is the
+    // newest `limit` of them, still returned oldest-first.
+    auto page = svc.get_conversation("task3-test-cvs-a", "task3-test-cvs-b",
+                                     kNowMs + 3000, 2);
+    ASSERT_EQ(page.size(), 2u);
+    EXPECT_EQ(page[0].create_time, kNowMs + 1000);
+    EXPECT_EQ(page[1].create_time, kNowMs + 2000);
+
+    auto bounded = svc.get_conversation("task3-test-cvs-b", "task3-test-cvs-a",
+                                        kNowMs + 3000, 50);
+    ASSERT_EQ(bounded.size(), 3u);
+    EXPECT_EQ(bounded[2].create_time, kNowMs + 2000);
+}
+
+TEST_F(MessageServiceTest, GetConversationServedFromRecentWindow) {
+    im::service::message::MessageService svc(db_);
+
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < 3; ++i) {
+        im::service::message::SendRequest req;
+        req.sender_uid = "task3-test-cache-a";
+        req.receiver_uid = "task3-test-cache-b";
+        req.content = "cached " + std::to_string(i);
+        req.msg_type = im::service::message::MessageType::TEXT;
+        req.now_ms = kNowMs + i;
+        auto r = svc.send_text_message(req);
+        ASSERT_TRUE(r.ok);
+        ids.push_back(r.data.msg_id);
+    }
+
+    auto first = svc.get_conversation("task3-test-cache-a", "task3-test-cache-b",
+                                      INT64_MAX, 50);
+    ASSERT_EQ(first.size(), 3u);
+    EXPECT_EQ(svc.history_cache_stats().misses, 1u);
+
+    // Later reads, from either side, come from the window and see status
+    // changes made through the service.
+    ASSERT_TRUE(svc.mark_delivered(ids[1], kLaterMs));
+    auto second = svc.get_conversation("task3-test-cache-b", "task3-test-cache-a",
+                                       INT64_MAX, 2);
+    ASSERT_EQ(second.size(), 2u);
+    EXPECT_EQ(second[0].msg_id, ids[1]);
+    EXPECT_EQ(second[0].status, im::service::message::MessageStatus::DELIVERED);
+    EXPECT_EQ(second[0].delivered_time, kLaterMs);
+    EXPECT_EQ(second[1].msg_id, ids[2]);
+
+    auto stats = svc.history_cache_stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+}
+
 TEST_F(MessageServiceTest, PullOfflineReturnsUndeliveredMessages) {
     im::service::message::MessageService svc(db_);
 
@@ -214,6 +283,96 @@ TEST_F(MessageServiceTest, MarkDeliveredUpdatesStatus) {
     }
 }
 
+TEST_F(MessageServiceTest, MarkDeliveredBatchSkipsAlreadyReadMessages) {
+    im::service::message::MessageService svc(db_);
+
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < 3; ++i) {
+        im::service::message::SendRequest req;
+        req.sender_uid = "task3-test-batch-a";
+        req.receiver_uid = "task3-test-batch-b";
+        req.content = "Batch delivered " + std::to_string(i);
+        req.msg_type = im::service::message::MessageType::TEXT;
+        req.now_ms = kNowMs + i;
+        auto r = svc.send_text_message(req);
+        ASSERT_TRUE(r.ok);
+        ids.push_back(r.data.msg_id);
+    }
+    ASSERT_TRUE(svc.mark_read(ids[0], kLaterMs));
+
+    EXPECT_EQ(svc.mark_delivered_batch(ids, kLaterMs), 2u);
+    EXPECT_EQ(svc.mark_delivered_batch({}, kLaterMs), 0u);
+
+    auto offline = svc.pull_offline("task3-test-batch-b", INT64_MAX, 50);
+    for (const auto& m : offline) {
+        EXPECT_EQ(std::find(ids.begin(), ids.end(), m.msg_id), ids.end());
+    }
+    auto history = svc.get_conversation("task3-test-batch-a", "task3-test-batch-b",
+                                        INT64_MAX, 10);
+    ASSERT_EQ(history.size(), 3u);
+    EXPECT_EQ(history[0].status, im::service::message::MessageStatus::READ);
+    EXPECT_EQ(history[1].status, im::service::message::MessageStatus::DELIVERED);
+    EXPECT_EQ(history[1].delivered_time, kLaterMs);
+}
+
+TEST_F(MessageServiceTest, MarkDeliveredIdsIsScopedToReceiverAndIds) {
+    im::service::message::MessageService svc(db_);
+
+    auto send = [&](const std::string& receiver, int64_t t) {
+        im::service::message::SendRequest req;
+        req.sender_uid = "task3-test-upto-a";
+        req.receiver_uid = receiver;
+        req.content = "session ack";
+        req.msg_type = im::service::message::MessageType::TEXT;
+        req.now_ms = t;
+        auto r = svc.send_text_message(req);
+        EXPECT_TRUE(r.ok);
+        return r.data.msg_id;
+    };
+    const uint64_t first = send("task3-test-upto-b", kNowMs);
+    const uint64_t other = send("task3-test-upto-c", kNowMs + 1);
+    const uint64_t second = send("task3-test-upto-b", kNowMs + 2);
+    const uint64_t third = send("task3-test-upto-b", kNowMs + 3);
+
+    // first is older than second but was not acked, other belongs to
+    // someone else: neither may be marked.
+    EXPECT_EQ(svc.mark_delivered_ids("task3-test-upto-b", {second, other, third}, kLaterMs), 2u);
+    EXPECT_EQ(svc.mark_delivered_ids("task3-test-upto-b", {second, third}, kLaterMs), 0u);
+    EXPECT_EQ(svc.mark_delivered_ids("task3-test-upto-b", {}, kLaterMs), 0u);
+
+    auto pending = svc.pull_offline_after("task3-test-upto-b", 0, 50);
+    ASSERT_EQ(pending.size(), 1u);
+    EXPECT_EQ(pending[0].msg_id, first);
+    EXPECT_EQ(svc.pull_offline_after("task3-test-upto-c", 0, 50).size(), 1u);
+}
+
+TEST_F(MessageServiceTest, PullOfflineAfterPagesForwardByMsgId) {
+    im::service::message::MessageService svc(db_);
+
+    std::vector<uint64_t> ids;
+    for (int i = 0; i < 5; ++i) {
+        im::service::message::SendRequest req;
+        req.sender_uid = "task3-test-page-a";
+        req.receiver_uid = "task3-test-page-b";
+        req.content = "page " + std::to_string(i);
+        req.msg_type = im::service::message::MessageType::TEXT;
+        req.now_ms = kNowMs + i;
+        auto r = svc.send_text_message(req);
+        ASSERT_TRUE(r.ok);
+        ids.push_back(r.data.msg_id);
+    }
+
+    auto page1 = svc.pull_offline_after("task3-test-page-b", 0, 2);
+    ASSERT_EQ(page1.size(), 2u);
+    EXPECT_EQ(page1[0].msg_id, ids[0]);
+    EXPECT_EQ(page1[1].msg_id, ids[1]);
+
+    auto page2 = svc.pull_offline_after("task3-test-page-b", page1.back().msg_id, 10);
+    ASSERT_EQ(page2.size(), 3u);
+    EXPECT_EQ(page2[0].msg_id, ids[2]);
+    EXPECT_EQ(page2[2].msg_id, ids[4]);
+}
+
 TEST_F(MessageServiceTest, MarkReadUpdatesStatus) {
     im::service::message::MessageService svc(db_);
 
@@ -243,3 +402,58 @@ TEST_F(MessageServiceTest, DeliveredAndReadMarkingRejectedForNonexistentMessage)
     marked = svc.mark_read(99999999, kLaterMs);
     EXPECT_FALSE(marked);
 }
+
+TEST_F(MessageServiceTest, RowsLandInMonthlyPartition) {
+    auto drop_far_partitions = [this] {
+        odb::transaction t(db_->begin());
+        db_->execute(R"(DROP TABLE IF EXISTS "im_messages_p204003")");
+        db_->execute(R"(DROP TABLE IF EXISTS "im_group_messages_p204003")");
+        t.commit();
+    };
+    auto rows_in = [this](const std::string& table, uint64_t msg_id) {
+        odb::transaction t(db_->begin());
+        const auto n = db_->execute("UPDATE \"" + table + "\" SET \"read_time\" = \"read_time\""
+                                    " WHERE \"msg_id\" = " + std::to_string(msg_id));
+        t.commit();
+        return n;
+    };
+    drop_far_partitions();
+
+    im::service::message::MessageService svc(db_);
+    auto send = [&](int64_t t) {
+        im::service::message::SendRequest req;
+        req.sender_uid = "task3-test-part-a";
+        req.receiver_uid = "task3-test-part-b";
+        req.content = "partitioned";
+        req.msg_type = im::service::message::MessageType::TEXT;
+        req.now_ms = t;
+        auto r = svc.send_text_message(req);
+        EXPECT_TRUE(r.ok);
+        return r.data.msg_id;
+    };
+
+    // No partition covers the month yet: the row falls into the default one.
+    const uint64_t early = send(kFarMonthMs);
+    EXPECT_EQ(rows_in("im_messages_default", early), 1u);
+
+    // Creating the month moves the row out of the default partition, and
+    // later writes go straight to the monthly one.
+    im::service::message::MessagePartitionManager partitions(db_);
+    auto ensured = partitions.ensure_upcoming(kFarMonthMs, 0);
+    ASSERT_TRUE(ensured.ok);
+    EXPECT_GE(ensured.created, 1);
+    EXPECT_EQ(rows_in("im_messages_default", early), 0u);
+    EXPECT_EQ(rows_in("im_messages_p204003", early), 1u);
+
+    const uint64_t late = send(kFarMonthMs + 1000);
+    EXPECT_EQ(rows_in("im_messages_p204003", late), 1u);
+    EXPECT_EQ(rows_in("im_messages_default", late), 0u);
+
+    // A second run finds the month already there.
+    ensured = partitions.ensure_upcoming(kFarMonthMs, 0);
+    ASSERT_TRUE(ensured.ok);
+    EXPECT_EQ(ensured.created, 0);
+
+    Cleanup();
+    drop_far_partitions();
+}
@@ -0,0 +1,342 @@
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../common/network/listener_handoff.hpp"
+
+// ListenerHandoffServer / ListenerHandoffClient over a real Unix socket: the
+// successor gets a working copy of the listening socket, and the old process
+// only stops once the successor confirms.
+
+namespace {
+
+using im::network::HandoffListener;
+using im::network::ListenerHandoffClient;
+using im::network::ListenerHandoffServer;
+using namespace std::chrono_literals;
+
+bool wait_until(const std::function<bool()>& done, std::chrono::milliseconds timeout = 3s) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!done()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(2ms);
+    }
+    return true;
+}
+
+std::string temp_socket_path() {
+    static std::atomic<int> counter{0};
+    return (std::filesystem::temp_directory_path() /
+            ("mychat-handoff-" + std::to_string(::getpid()) + "-" +
+             std::to_string(counter.fetch_add(1)) + ".sock"))
+            .string();
+}
+
+int local_port(int fd) {
+    sockaddr_in addr{};
+    socklen_t len = sizeof(addr);
+    if (::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        return -1;
+    }
+    return ntohs(addr.sin_port);
+}
+
+// A TCP listener on 127.0.0.1 with a kernel-chosen port, standing in for the
+// gateway's WebSocket acceptor.
+class TcpListener {
+public:
+    TcpListener() {
+        fd_ = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (::bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            ::listen(fd_, 16) != 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+    ~TcpListener() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    int fd() const { return fd_; }
+    int port() const { return local_port(fd_); }
+
+private:
+    int fd_ = -1;
+};
+
+int connect_tcp(int port) {
+    const int fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// Accepts one connection on fd, or returns -1 after the timeout.
+int accept_within(int fd, std::chrono::milliseconds timeout) {
+    pollfd pfd{fd, POLLIN, 0};
+    if (::poll(&pfd, 1, static_cast<int>(timeout.count())) != 1) {
+        return -1;
+    }
+    return ::accept4(fd, nullptr, nullptr, SOCK_CLOEXEC);
+}
+
+// Speaks the handoff wire format by hand so the client can be fed messages
+// ListenerHandoffServer would never send.
+class RawHandoffPeer {
+public:
+    RawHandoffPeer(std::string path, std::string names, int fd_to_send)
+        : path_(std::move(path)) {
+        listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        std::memcpy(addr.sun_path, path_.c_str(), path_.size() + 1);
+        ::unlink(path_.c_str());
+        EXPECT_EQ(::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+        EXPECT_EQ(::listen(listen_fd_, 1), 0);
+
+        thread_ = std::thread([this, names = std::move(names), fd_to_send] {
+            const int conn = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+            if (conn < 0) {
+                return;
+            }
+            alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+            std::string body = names;
+            iovec iov{body.data(), body.size()};
+            msghdr msg{};
+            msg.msg_iov = &iov;
+            msg.msg_iovlen = 1;
+            if (fd_to_send >= 0) {
+                msg.msg_control = control;
+                msg.msg_controllen = sizeof(control);
+                cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+                cmsg->cmsg_level = SOL_SOCKET;
+                cmsg->cmsg_type = SCM_RIGHTS;
+                cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+                std::memcpy(CMSG_DATA(cmsg), &fd_to_send, sizeof(int));
+            }
+            (void)::sendmsg(conn, &msg, MSG_NOSIGNAL);
+            // Hold the connection until the client has read the message.
+            char byte = 0;
+            (void)::read(conn, &byte, 1);
+            ::close(conn);
+        });
+    }
+
+    ~RawHandoffPeer() {
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        ::close(listen_fd_);
+        ::unlink(path_.c_str());
+    }
+
+private:
+    std::string path_;
+    int listen_fd_ = -1;
+    std::thread thread_;
+};
+
+class ListenerHandoffTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_GE(listener_.fd(), 0);
+        path_ = temp_socket_path();
+    }
+
+    void TearDown() override {
+        std::error_code ec;
+        std::filesystem::remove(path_, ec);
+    }
+
+    void start(ListenerHandoffServer& server) {
+        std::string error;
+        ASSERT_TRUE(server.start(
+                [this] { return std::vector<HandoffListener>{{"ws", listener_.fd()}}; },
+                [this] { handed_off_calls_.fetch_add(1); }, error))
+                << error;
+    }
+
+    TcpListener listener_;
+    std::string path_;
+    std::atomic<int> handed_off_calls_{0};
+};
+
+}  // namespace
+
+TEST_F(ListenerHandoffTest, SuccessorAcceptsOnHandedOffSocketAndConfirmStopsOldProcess) {
+    ListenerHandoffServer server(path_);
+    start(server);
+
+    ListenerHandoffClient client;
+    std::string error;
+    ASSERT_TRUE(client.connect(path_, error)) << error;
+    EXPECT_TRUE(error.empty());
+    EXPECT_EQ(client.take("tcp"), -1);
+
+    const int inherited = client.take("ws");
+    ASSERT_GE(inherited, 0);
+    EXPECT_NE(inherited, listener_.fd());
+    EXPECT_EQ(local_port(inherited), listener_.port());
+    EXPECT_EQ(client.take("ws"), -1) << "take() hands each fd out once";
+
+    // Same listening socket: a connection to the old port is accepted on the
+    // successor's copy without re-binding.
+    const int peer = connect_tcp(listener_.port());
+    ASSERT_GE(peer, 0);
+    const int accepted = accept_within(inherited, 1s);
+    EXPECT_GE(accepted, 0);
+
+    // Until the successor confirms, the old process keeps serving.
+    std::this_thread::sleep_for(50ms);
+    EXPECT_FALSE(server.handed_off());
+    EXPECT_EQ(handed_off_calls_.load(), 0);
+
+    ASSERT_TRUE(client.confirm(error)) << error;
+    // handed_off() flips just before the callback runs on the handoff thread.
+    EXPECT_TRUE(wait_until([&] { return handed_off_calls_.load() == 1; }));
+    EXPECT_TRUE(server.handed_off());
+
+    // After a handoff the path is left for the successor to re-create.
+    server.stop();
+    EXPECT_TRUE(std::filesystem::exists(path_));
+
+    if (accepted >= 0) {
+        ::close(accepted);
+    }
+    ::close(peer);
+    ::close(inherited);
+}
+
+TEST_F(ListenerHandoffTest, ConfirmTimeoutLetsTheNextSuccessorTakeOver) {
+    ListenerHandoffServer server(path_, 1s);
+    start(server);
+
+    std::string error;
+    {
+        ListenerHandoffClient slow;
+        ASSERT_TRUE(slow.connect(path_, error)) << error;
+        std::this_thread::sleep_for(1500ms);
+        EXPECT_FALSE(server.handed_off());
+
+        // The timed-out attempt is dead: confirming it no longer hands off.
+        slow.confirm(error);
+        std::this_thread::sleep_for(100ms);
+        EXPECT_FALSE(server.handed_off());
+    }
+
+    ListenerHandoffClient next;
+    ASSERT_TRUE(next.connect(path_, error)) << error;
+    ASSERT_TRUE(next.confirm(error)) << error;
+    EXPECT_TRUE(wait_until([&] { return handed_off_calls_.load() == 1; }));
+    EXPECT_TRUE(server.handed_off());
+}
+
+TEST_F(ListenerHandoffTest, SuccessorExitingBeforeConfirmKeepsOldProcessServing) {
+    // Default two-minute confirm timeout: the disconnect alone must end the attempt.
+    ListenerHandoffServer server(path_);
+    start(server);
+
+    std::string error;
+    {
+        ListenerHandoffClient crashed;
+        ASSERT_TRUE(crashed.connect(path_, error)) << error;
+        const int inherited = crashed.take("ws");
+        ASSERT_GE(inherited, 0);
+        ::close(inherited);
+    }
+
+    std::this_thread::sleep_for(100ms);
+    EXPECT_FALSE(server.handed_off());
+    EXPECT_EQ(handed_off_calls_.load(), 0);
+
+    // The old listener is untouched and the handoff socket serves again.
+    const int peer = connect_tcp(listener_.port());
+    ASSERT_GE(peer, 0);
+    const int accepted = accept_within(listener_.fd(), 1s);
+    EXPECT_GE(accepted, 0);
+
+    ListenerHandoffClient retry;
+    ASSERT_TRUE(retry.connect(path_, error)) << error;
+    ASSERT_TRUE(retry.confirm(error)) << error;
+    EXPECT_TRUE(wait_until([&] { return server.handed_off(); }));
+
+    if (accepted >= 0) {
+        ::close(accepted);
+    }
+    ::close(peer);
+}
+
+TEST_F(ListenerHandoffTest, StopWithoutHandoffRemovesThePath) {
+    ListenerHandoffServer server(path_);
+    start(server);
+    ASSERT_TRUE(std::filesystem::exists(path_));
+
+    server.stop();
+    EXPECT_FALSE(std::filesystem::exists(path_));
+    EXPECT_FALSE(server.handed_off());
+
+    ListenerHandoffClient client;
+    std::string error;
+    EXPECT_FALSE(client.connect(path_, error));
+    EXPECT_TRUE(error.empty()) << error;
+}
+
+TEST_F(ListenerHandoffTest, NoOldProcessMeansFreshStart) {
+    ListenerHandoffClient client;
+    std::string error;
+    EXPECT_FALSE(client.connect(path_, error));
+    EXPECT_TRUE(error.empty()) << error;
+    EXPECT_FALSE(client.connected());
+    EXPECT_EQ(client.take("ws"), -1);
+
+    EXPECT_FALSE(client.confirm(error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST_F(ListenerHandoffTest, NamesWithoutDescriptorsAreMalformed) {
+    RawHandoffPeer peer(path_, "ws\n", -1);
+
+    ListenerHandoffClient client;
+    std::string error;
+    EXPECT_FALSE(client.connect(path_, error));
+    EXPECT_EQ(error, "malformed listener handoff");
+    EXPECT_FALSE(client.connected());
+}
+
+TEST_F(ListenerHandoffTest, DescriptorWithoutTerminatedNameIsMalformed) {
+    RawHandoffPeer peer(path_, "ws", listener_.fd());
+
+    ListenerHandoffClient client;
+    std::string error;
+    EXPECT_FALSE(client.connect(path_, error));
+    EXPECT_EQ(error, "malformed listener handoff");
+    EXPECT_FALSE(client.connected());
+    EXPECT_EQ(client.take("ws"), -1);
+}
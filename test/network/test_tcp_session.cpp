@@ -0,0 +1,505 @@
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+
+#include "../../common/network/tcp_server.hpp"
+#include "../../common/network/tcp_session.hpp"
+
+namespace {
+
+namespace net = boost::asio;
+namespace ssl = boost::asio::ssl;
+using tcp = net::ip::tcp;
+using im::network::TCPServer;
+using im::network::TCPSession;
+using namespace std::chrono_literals;
+
+constexpr std::size_t kMaxTokenLength = 4096;
+
+std::string frame(HeaderMsgType type, const std::string& body) {
+    std::string out(HEADER_SIZE, '\0');
+    const uint32_t length = htonl(static_cast<uint32_t>(body.size()));
+    std::memcpy(out.data(), &length, sizeof(length));
+    out[4] = static_cast<char>(type);
+    return out + body;
+}
+
+bool wait_until(const std::function<bool()>& done, std::chrono::milliseconds timeout = 3s) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!done()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(2ms);
+    }
+    return true;
+}
+
+struct Frame {
+    HeaderMsgType type;
+    std::string body;
+};
+
+// Blocking client on its own io_context; reads time out instead of hanging
+// the test when the server misbehaves.
+template <typename Stream>
+class FrameClient {
+public:
+    explicit FrameClient(Stream& stream) : stream_(stream) {}
+
+    void write(HeaderMsgType type, const std::string& body) {
+        net::write(stream_, net::buffer(frame(type, body)));
+    }
+
+    void write_raw(const std::string& bytes) { net::write(stream_, net::buffer(bytes)); }
+
+    bool read(Frame& out, boost::system::error_code& ec) {
+        std::array<char, HEADER_SIZE> header{};
+        net::read(stream_, net::buffer(header), ec);
+        if (ec) {
+            return false;
+        }
+        uint32_t length = 0;
+        std::memcpy(&length, header.data(), sizeof(length));
+        out.type = static_cast<HeaderMsgType>(header[4]);
+        out.body.resize(ntohl(length));
+        net::read(stream_, net::buffer(out.body), ec);
+        return !ec;
+    }
+
+    // True when the server closed the connection without sending a frame.
+    bool closed_by_peer() {
+        Frame unexpected;
+        boost::system::error_code ec;
+        if (read(unexpected, ec)) {
+            return false;
+        }
+        return ec == net::error::eof || ec == net::error::connection_reset ||
+               ec == ssl::error::stream_truncated;
+    }
+
+private:
+    Stream& stream_;
+};
+
+void set_receive_timeout(tcp::socket& socket, std::chrono::seconds timeout) {
+    timeval tv{};
+    tv.tv_sec = static_cast<time_t>(timeout.count());
+    ::setsockopt(socket.native_handle(), SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+}
+
+class TcpSessionTest : public ::testing::Test {
+protected:
+    void SetUp() override { start_server(nullptr); }
+
+    void TearDown() override {
+        server_->stop();
+        work_.reset();
+        ioc_.stop();
+        if (io_thread_.joinable()) {
+            io_thread_.join();
+        }
+    }
+
+    void start_server(ssl::context* ssl_ctx) {
+        tcp::acceptor acceptor(ioc_, tcp::endpoint(net::ip::make_address("127.0.0.1"), 0));
+        port_ = acceptor.local_endpoint().port();
+        server_ = std::make_unique<TCPServer>(ioc_, std::move(acceptor), ssl_ctx);
+
+        // Same wiring as GatewayServer::on_tcp_connect: handlers hold weak refs.
+        server_->set_connection_handler([this](TCPSession::Ptr session) {
+            std::weak_ptr<TCPSession> weak = session;
+            session->set_message_handler([this, weak](const std::string& body) {
+                record("msg:" + body);
+            });
+            session->set_auth_handler([this, weak] {
+                if (auto s = weak.lock()) {
+                    record("auth:" + s->get_token());
+                }
+            });
+            std::lock_guard<std::mutex> lock(mutex_);
+            sessions_.push_back(session);
+        });
+        server_->set_disconnect_handler([this](TCPSession::Ptr session) {
+            record("closed:" + session->get_session_id());
+        });
+        server_->start();
+        io_thread_ = std::thread([this] { ioc_.run(); });
+    }
+
+    tcp::socket connect() {
+        tcp::socket socket(client_ioc_);
+        socket.connect(tcp::endpoint(net::ip::make_address("127.0.0.1"), port_));
+        set_receive_timeout(socket, 3s);
+        return socket;
+    }
+
+    TCPSession::Ptr wait_for_session(std::size_t index = 0) {
+        TCPSession::Ptr session;
+        wait_until([&] {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (sessions_.size() > index) {
+                session = sessions_[index];
+            }
+            return session != nullptr;
+        });
+        return session;
+    }
+
+    void record(std::string event) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        events_.push_back(std::move(event));
+    }
+
+    std::vector<std::string> events() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return events_;
+    }
+
+    std::size_t event_count() { return events().size(); }
+
+    net::io_context ioc_;
+    net::executor_work_guard<net::io_context::executor_type> work_ = net::make_work_guard(ioc_);
+    net::io_context client_ioc_;
+    std::unique_ptr<TCPServer> server_;
+    std::thread io_thread_;
+    unsigned short port_ = 0;
+
+    std::mutex mutex_;
+    std::vector<TCPSession::Ptr> sessions_;
+    std::vector<std::string> events_;
+};
+
+// --- AUTH frame ---
+
+TEST_F(TcpSessionTest, AuthThenNormalFramesAreDispatchedInOrder) {
+    auto socket = connect();
+    FrameClient client(socket);
+    // One write: the session must split the frames itself.
+    client.write_raw(frame(HeaderMsgType::AUTH, "token-1") + frame(HeaderMsgType::NORMAL, "a") +
+                     frame(HeaderMsgType::NORMAL, std::string(70000, 'b')));
+
+    ASSERT_TRUE(wait_until([&] { return event_count() == 3; }));
+    auto got = events();
+    EXPECT_EQ(got[0], "auth:token-1");
+    EXPECT_EQ(got[1], "msg:a");
+    EXPECT_EQ(got[2], "msg:" + std::string(70000, 'b'));
+
+    auto session = wait_for_session();
+    ASSERT_NE(session, nullptr);
+    EXPECT_EQ(session->get_token(), "token-1");
+    EXPECT_EQ(server_->get_session(session->get_session_id()), session);
+}
+
+TEST_F(TcpSessionTest, NormalFrameBeforeAuthIsDispatchedWithoutToken) {
+    auto socket = connect();
+    FrameClient client(socket);
+    client.write(HeaderMsgType::NORMAL, "early");
+
+    ASSERT_TRUE(wait_until([&] { return event_count() == 1; }));
+    EXPECT_EQ(events()[0], "msg:early");
+    EXPECT_TRUE(wait_for_session()->get_token().empty());
+}
+
+TEST_F(TcpSessionTest, DuplicateAuthClosesConnection) {
+    auto socket = connect();
+    FrameClient client(socket);
+    client.write(HeaderMsgType::AUTH, "token-1");
+    client.write(HeaderMsgType::AUTH, "token-2");
+
+    EXPECT_TRUE(client.closed_by_peer());
+    ASSERT_TRUE(wait_until([&] { return event_count() == 2; }));
+    EXPECT_EQ(server_->get_session_count(), 0u);
+    auto got = events();
+    EXPECT_EQ(got[0], "auth:token-1");
+    EXPECT_EQ(got[1].rfind("closed:", 0), 0u);
+    EXPECT_EQ(wait_for_session()->get_token(), "token-1");
+}
+
+TEST_F(TcpSessionTest, OversizedOrEmptyAuthClosesConnection) {
+    for (const std::string& token : {std::string(kMaxTokenLength + 1, 't'), std::string()}) {
+        auto socket = connect();
+        FrameClient client(socket);
+        // Only the header is sent: the length alone must be enough to reject.
+        client.write_raw(frame(HeaderMsgType::AUTH, token).substr(0, HEADER_SIZE));
+        EXPECT_TRUE(client.closed_by_peer()) << token.size() << " bytes";
+    }
+
+    ASSERT_TRUE(wait_until([&] { return server_->get_session_count() == 0; }));
+    for (const auto& event : events()) {
+        EXPECT_EQ(event.rfind("auth:", 0), std::string::npos) << event;
+    }
+}
+
+TEST_F(TcpSessionTest, AuthAtMaxTokenLengthIsAccepted) {
+    auto socket = connect();
+    FrameClient client(socket);
+    client.write(HeaderMsgType::AUTH, std::string(kMaxTokenLength, 't'));
+
+    ASSERT_TRUE(wait_until([&] { return event_count() == 1; }));
+    EXPECT_EQ(events()[0], "auth:" + std::string(kMaxTokenLength, 't'));
+    EXPECT_EQ(server_->get_session_count(), 1u);
+}
+
+TEST_F(TcpSessionTest, UnknownFrameTypeClosesConnection) {
+    auto socket = connect();
+    FrameClient client(socket);
+    client.write(HeaderMsgType::UNKNOWN, "x");
+
+    EXPECT_TRUE(client.closed_by_peer());
+    EXPECT_TRUE(wait_until([&] { return server_->get_session_count() == 0; }));
+}
+
+// --- heartbeat and send queue ---
+
+TEST_F(TcpSessionTest, PingIsAnsweredBetweenQueuedSendsWithoutCorruptingFrames) {
+    auto socket = connect();
+    FrameClient client(socket);
+    auto session = wait_for_session();
+    ASSERT_NE(session, nullptr);
+
+    constexpr int kMessages = 64;
+    const std::string payload(64 * 1024, 'p');
+    // Queue sends and PINGs from both sides at once; the PONGs go through the
+    // same queue and must land between whole frames.
+    std::thread sender([&] {
+        for (int i = 0; i < kMessages; ++i) {
+            session->send(std::to_string(i) + ":" + payload);
+        }
+    });
+    for (int i = 0; i < 8; ++i) {
+        client.write(HeaderMsgType::PING, "");
+    }
+    sender.join();
+
+    int next = 0;
+    int pongs = 0;
+    while (next < kMessages || pongs < 8) {
+        Frame got;
+        boost::system::error_code ec;
+        ASSERT_TRUE(client.read(got, ec)) << ec.message() << " after " << next << " messages";
+        if (got.type == HeaderMsgType::PONG) {
+            EXPECT_TRUE(got.body.empty());
+            ++pongs;
+            continue;
+        }
+        ASSERT_EQ(got.type, HeaderMsgType::NORMAL);
+        ASSERT_EQ(got.body, std::to_string(next) + ":" + payload);
+        ++next;
+    }
+    EXPECT_EQ(pongs, 8);
+    // Heartbeat frames are never counted as pending sends.
+    EXPECT_TRUE(wait_until([&] { return session->pending_sends() == 0; }));
+}
+
+TEST_F(TcpSessionTest, PongFromClientKeepsConnectionOpen) {
+    auto socket = connect();
+    FrameClient client(socket);
+    client.write(HeaderMsgType::PONG, "");
+    client.write(HeaderMsgType::NORMAL, "after-pong");
+
+    ASSERT_TRUE(wait_until([&] { return event_count() == 1; }));
+    EXPECT_EQ(events()[0], "msg:after-pong");
+    EXPECT_EQ(server_->get_session_count(), 1u);
+}
+
+// --- pending_sends accounting ---
+
+TEST_F(TcpSessionTest, PendingSendsCountsQueuedFramesAndDropsToZeroOnClose) {
+    auto socket = connect();
+    auto session = wait_for_session();
+    ASSERT_NE(session, nullptr);
+
+    // The client never reads, so the socket buffers fill and frames stay queued.
+    const std::string payload(1024 * 1024, 'q');
+    constexpr std::size_t kMessages = 64;
+    for (std::size_t i = 0; i < kMessages; ++i) {
+        session->send(payload);
+    }
+    // Counted as soon as send() returns; the first few may already be written.
+    EXPECT_LE(session->pending_sends(), kMessages);
+    ASSERT_TRUE(wait_until([&] {
+        // Stable for a while: the write side is blocked on the peer.
+        const auto before = session->pending_sends();
+        std::this_thread::sleep_for(50ms);
+        return before > 0 && session->pending_sends() == before;
+    }));
+    EXPECT_GT(session->pending_sends(), 0u);
+
+    session->close();
+    ASSERT_TRUE(wait_until([&] { return session->pending_sends() == 0; }));
+    EXPECT_TRUE(wait_until([&] { return server_->get_session_count() == 0; }));
+
+    // Sends after close are dropped without leaking the count.
+    session->send("late");
+    session->send("later");
+    std::this_thread::sleep_for(20ms);
+    EXPECT_EQ(session->pending_sends(), 0u);
+}
+
+TEST_F(TcpSessionTest, PendingSendsDropToZeroWhenPeerDisconnects) {
+    auto socket = connect();
+    auto session = wait_for_session();
+    ASSERT_NE(session, nullptr);
+
+    for (int i = 0; i < 32; ++i) {
+        session->send(std::string(1024 * 1024, 'd'));
+    }
+    socket.close();
+
+    EXPECT_TRUE(wait_until([&] { return session->pending_sends() == 0; }));
+    EXPECT_TRUE(wait_until([&] { return server_->get_session_count() == 0; }));
+}
+
+TEST_F(TcpSessionTest, WhenWritableFiresAfterQueueDrainsAndFailsOnClose) {
+    auto socket = connect();
+    FrameClient client(socket);
+    auto session = wait_for_session();
+    ASSERT_NE(session, nullptr);
+
+    for (int i = 0; i < 4; ++i) {
+        session->send("w");
+    }
+    std::mutex m;
+    std::condition_variable cv;
+    int result = -1;
+    // Window 1: fires once nothing is pending.
+    session->when_writable(1, [&](bool ok) {
+        std::lock_guard<std::mutex> lock(m);
+        result = ok ? 1 : 0;
+        cv.notify_one();
+    });
+    for (int i = 0; i < 4; ++i) {
+        Frame got;
+        boost::system::error_code ec;
+        ASSERT_TRUE(client.read(got, ec)) << ec.message();
+    }
+    {
+        std::unique_lock<std::mutex> lock(m);
+        ASSERT_TRUE(cv.wait_for(lock, 3s, [&] { return result != -1; }));
+        EXPECT_EQ(result, 1);
+    }
+
+    session->close();
+    ASSERT_TRUE(wait_until([&] { return server_->get_session_count() == 0; }));
+    result = -1;
+    session->when_writable(1, [&](bool ok) {
+        std::lock_guard<std::mutex> lock(m);
+        result = ok ? 1 : 0;
+        cv.notify_one();
+    });
+    std::unique_lock<std::mutex> lock(m);
+    ASSERT_TRUE(cv.wait_for(lock, 3s, [&] { return result != -1; }));
+    EXPECT_EQ(result, 0);
+}
+
+// --- TCPServer ---
+
+TEST_F(TcpSessionTest, ServerTracksSessionsAndReportsEachDisconnectOnce) {
+    auto first = connect();
+    auto second = connect();
+    auto a = wait_for_session(0);
+    auto b = wait_for_session(1);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    EXPECT_NE(a->get_session_id(), b->get_session_id());
+    EXPECT_EQ(server_->get_session_count(), 2u);
+    EXPECT_EQ(server_->get_sessions().size(), 2u);
+
+    first.close();
+    ASSERT_TRUE(wait_until([&] { return server_->get_session_count() == 1; }));
+    EXPECT_EQ(server_->get_session(a->get_session_id()), nullptr);
+    EXPECT_EQ(server_->get_session(b->get_session_id()), b);
+
+    // A second close of the same session does not report it again.
+    a->close();
+    std::this_thread::sleep_for(20ms);
+    auto got = events();
+    ASSERT_EQ(got.size(), 1u);
+    EXPECT_EQ(got[0], "closed:" + a->get_session_id());
+}
+
+TEST_F(TcpSessionTest, StopClosesEverySession) {
+    auto first = connect();
+    auto second = connect();
+    ASSERT_TRUE(wait_until([&] { return server_->get_session_count() == 2; }));
+
+    server_->stop();
+    EXPECT_EQ(server_->get_session_count(), 0u);
+    EXPECT_TRUE(FrameClient(first).closed_by_peer());
+    EXPECT_TRUE(FrameClient(second).closed_by_peer());
+}
+
+TEST_F(TcpSessionTest, StopAcceptingKeepsEstablishedSessions) {
+    auto socket = connect();
+    FrameClient client(socket);
+    auto session = wait_for_session();
+    ASSERT_NE(session, nullptr);
+
+    server_->stop_accepting();
+    ASSERT_TRUE(wait_until([&] {
+        tcp::socket probe(client_ioc_);
+        boost::system::error_code ec;
+        probe.connect(tcp::endpoint(net::ip::make_address("127.0.0.1"), port_), ec);
+        return static_cast<bool>(ec);
+    }));
+
+    session->send("still-open");
+    Frame got;
+    boost::system::error_code ec;
+    ASSERT_TRUE(client.read(got, ec)) << ec.message();
+    EXPECT_EQ(got.body, "still-open");
+}
+
+// --- TLS ---
+
+class TcpTlsSessionTest : public TcpSessionTest {
+protected:
+    void SetUp() override {
+        server_ctx_.use_certificate_chain_file(std::string(TEST_CERT_DIR) + "/test_cert.pem");
+        server_ctx_.use_private_key_file(std::string(TEST_CERT_DIR) + "/test_key.pem",
+                                         ssl::context::pem);
+        client_ctx_.set_verify_mode(ssl::verify_none);
+        start_server(&server_ctx_);
+    }
+
+    ssl::context server_ctx_{ssl::context::tls_server};
+    ssl::context client_ctx_{ssl::context::tls_client};
+};
+
+TEST_F(TcpTlsSessionTest, AuthThenNormalOverTlsAndPingIsAnswered) {
+    ssl::stream<tcp::socket> stream(connect(), client_ctx_);
+    stream.handshake(ssl::stream_base::client);
+    FrameClient client(stream);
+    client.write(HeaderMsgType::AUTH, "tls-token");
+    client.write(HeaderMsgType::NORMAL, "hello");
+    client.write(HeaderMsgType::PING, "");
+
+    Frame got;
+    boost::system::error_code ec;
+    ASSERT_TRUE(client.read(got, ec)) << ec.message();
+    EXPECT_EQ(got.type, HeaderMsgType::PONG);
+    ASSERT_TRUE(wait_until([&] { return event_count() == 2; }));
+    EXPECT_EQ(events()[0], "auth:tls-token");
+    EXPECT_EQ(events()[1], "msg:hello");
+
+    client.write(HeaderMsgType::AUTH, "again");
+    EXPECT_TRUE(client.closed_by_peer());
+}
+
+}  // namespace
@@ -0,0 +1,300 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <boost/asio/ssl.hpp>
+#include <openssl/bio.h>
+#include <openssl/ssl.h>
+#include <unistd.h>
+
+#include "../../common/network/tls_session_resumption.hpp"
+
+namespace {
+
+namespace fs = std::filesystem;
+using im::network::TlsSessionOptions;
+using im::network::TlsTicketKeyRing;
+using Clock = std::chrono::steady_clock;
+
+constexpr auto kRotation = std::chrono::seconds(60);
+
+std::string key_bytes(char name, char fill) {
+    std::string key(TlsTicketKeyRing::kFileKeySize, fill);
+    std::memset(key.data(), name, TlsTicketKeyRing::kNameSize);
+    return key;
+}
+
+std::string name_of(char name) { return std::string(TlsTicketKeyRing::kNameSize, name); }
+
+std::string name_of(const TlsTicketKeyRing::Key& key) {
+    return std::string(reinterpret_cast<const char*>(key.name.data()), key.name.size());
+}
+
+class TicketKeyFile {
+public:
+    TicketKeyFile()
+        : path_(fs::temp_directory_path() /
+                ("im_ticket_keys_" + std::to_string(::getpid()) + "_" +
+                 std::to_string(counter_++) + ".key")) {}
+    ~TicketKeyFile() {
+        std::error_code ec;
+        fs::remove(path_, ec);
+    }
+
+    // Rewrites the file and moves its mtime forward, so a reload sees a change
+    // even within the filesystem's timestamp granularity.
+    void write(const std::string& content) {
+        std::ofstream(path_, std::ios::binary | std::ios::trunc) << content;
+        fs::last_write_time(path_, fs::file_time_type::clock::now() +
+                                           std::chrono::seconds(++generation_));
+    }
+
+    std::string path() const { return path_.string(); }
+
+private:
+    static inline int counter_ = 0;
+    fs::path path_;
+    int generation_ = 0;
+};
+
+TlsSessionOptions options_with_file(const std::string& path) {
+    TlsSessionOptions options;
+    options.ticket_key_file = path;
+    options.ticket_key_rotation_sec = static_cast<uint32_t>(kRotation.count());
+    return options;
+}
+
+// --- key file loading ---
+
+TEST(TlsTicketKeyRingTest, MalformedKeyFileIsRejected) {
+    TicketKeyFile file;
+
+    EXPECT_THROW(TlsTicketKeyRing{options_with_file(file.path())}, std::runtime_error)
+            << "missing file";
+
+    for (const std::string& content :
+         {std::string(), std::string(TlsTicketKeyRing::kFileKeySize - 1, 'k'),
+          key_bytes('a', '1') + "x"}) {
+        file.write(content);
+        EXPECT_THROW(TlsTicketKeyRing{options_with_file(file.path())}, std::runtime_error)
+                << content.size() << " bytes";
+    }
+}
+
+TEST(TlsTicketKeyRingTest, KeyFileFirstKeyEncryptsOthersOnlyDecrypt) {
+    TicketKeyFile file;
+    file.write(key_bytes('a', '1') + key_bytes('b', '2'));
+    TlsTicketKeyRing ring(options_with_file(file.path()));
+
+    auto key = ring.encryption_key();
+    EXPECT_EQ(name_of(key), name_of('a'));
+    EXPECT_EQ(key.hmac_secret[0], '1');
+
+    TlsTicketKeyRing::Key found;
+    bool is_current = true;
+    ASSERT_TRUE(ring.find_decryption_key(
+            reinterpret_cast<const unsigned char*>(name_of('b').data()), found, is_current));
+    EXPECT_FALSE(is_current);
+    EXPECT_FALSE(ring.find_decryption_key(
+            reinterpret_cast<const unsigned char*>(name_of('z').data()), found, is_current));
+}
+
+TEST(TlsTicketKeyRingTest, MalformedReloadKeepsPreviousKeys) {
+    TicketKeyFile file;
+    file.write(key_bytes('a', '1'));
+    TlsTicketKeyRing ring(options_with_file(file.path()));
+
+    file.write("truncated");
+    auto key = ring.encryption_key(Clock::now() + kRotation + std::chrono::seconds(1));
+    EXPECT_EQ(name_of(key), name_of('a'));
+    EXPECT_EQ(ring.rotations(), 0u);
+}
+
+// --- rotation timing ---
+
+TEST(TlsTicketKeyRingTest, InProcessKeyRotatesOnlyWhenDue) {
+    TlsSessionOptions options;
+    options.ticket_key_rotation_sec = static_cast<uint32_t>(kRotation.count());
+    options.session_timeout_sec = 2 * static_cast<uint32_t>(kRotation.count());
+    TlsTicketKeyRing ring(options);
+
+    const auto start = Clock::now();
+    const auto first = ring.encryption_key(start);
+    EXPECT_EQ(name_of(ring.encryption_key(start + kRotation - std::chrono::seconds(1))),
+              name_of(first));
+    EXPECT_EQ(ring.rotations(), 0u);
+
+    auto now = start + kRotation + std::chrono::seconds(1);
+    const auto second = ring.encryption_key(now);
+    EXPECT_NE(name_of(second), name_of(first));
+    EXPECT_EQ(ring.rotations(), 1u);
+
+    // The next rotation is counted from the one that just happened.
+    EXPECT_EQ(name_of(ring.encryption_key(now + kRotation - std::chrono::seconds(1))),
+              name_of(second));
+    EXPECT_EQ(ring.rotations(), 1u);
+
+    // The previous key still decrypts, but is no longer current.
+    TlsTicketKeyRing::Key found;
+    bool is_current = true;
+    ASSERT_TRUE(ring.find_decryption_key(first.name.data(), found, is_current));
+    EXPECT_FALSE(is_current);
+
+    // session_timeout = 2 rotations: current + 2 old keys are kept, the
+    // third rotation drops the first key.
+    for (int i = 0; i < 2; ++i) {
+        now += kRotation + std::chrono::seconds(1);
+        ring.encryption_key(now);
+        EXPECT_EQ(ring.find_decryption_key(first.name.data(), found, is_current), i == 0);
+    }
+    EXPECT_EQ(ring.rotations(), 3u);
+}
+
+TEST(TlsTicketKeyRingTest, KeyFileReloadsOnlyWhenChangedAndDue) {
+    TicketKeyFile file;
+    file.write(key_bytes('a', '1'));
+    TlsTicketKeyRing ring(options_with_file(file.path()));
+
+    const auto start = Clock::now();
+    file.write(key_bytes('b', '2') + key_bytes('a', '1'));
+    EXPECT_EQ(name_of(ring.encryption_key(start)), name_of('a')) << "not due yet";
+
+    auto now = start + kRotation + std::chrono::seconds(1);
+    EXPECT_EQ(name_of(ring.encryption_key(now)), name_of('b'));
+    EXPECT_EQ(ring.rotations(), 1u);
+
+    // Unchanged file: nothing to reload when the next period comes due.
+    now += kRotation + std::chrono::seconds(1);
+    ring.encryption_key(now);
+    EXPECT_EQ(ring.rotations(), 1u);
+}
+
+// --- resumption through OpenSSL ---
+
+struct SslFree {
+    void operator()(SSL* ssl) const { SSL_free(ssl); }
+    void operator()(SSL_CTX* ctx) const { SSL_CTX_free(ctx); }
+    void operator()(SSL_SESSION* session) const { SSL_SESSION_free(session); }
+};
+using SslPtr = std::unique_ptr<SSL, SslFree>;
+using SslCtxPtr = std::unique_ptr<SSL_CTX, SslFree>;
+using SessionPtr = std::unique_ptr<SSL_SESSION, SslFree>;
+
+std::string ticket_key_name(const SSL_SESSION* session) {
+    const unsigned char* ticket = nullptr;
+    size_t length = 0;
+    SSL_SESSION_get0_ticket(session, &ticket, &length);
+    if (length < TlsTicketKeyRing::kNameSize) {
+        return {};
+    }
+    return std::string(reinterpret_cast<const char*>(ticket), TlsTicketKeyRing::kNameSize);
+}
+
+class TicketResumptionTest : public ::testing::TestWithParam<int> {
+protected:
+    void SetUp() override {
+        server_ctx_.use_certificate_chain_file(std::string(TEST_CERT_DIR) + "/test_cert.pem");
+        server_ctx_.use_private_key_file(std::string(TEST_CERT_DIR) + "/test_key.pem",
+                                         boost::asio::ssl::context::pem);
+        TlsSessionOptions options;
+        options.session_cache = false;  // resumption can only come from the ticket
+        options.ticket_key_rotation_sec = static_cast<uint32_t>(kRotation.count());
+        ring_ = im::network::configure_tls_session_resumption(server_ctx_, options);
+        ASSERT_NE(ring_, nullptr);
+
+        client_ctx_.reset(SSL_CTX_new(TLS_client_method()));
+        SSL_CTX_set_min_proto_version(client_ctx_.get(), GetParam());
+        SSL_CTX_set_max_proto_version(client_ctx_.get(), GetParam());
+        SSL_CTX_set_verify(client_ctx_.get(), SSL_VERIFY_NONE, nullptr);
+    }
+
+    // Full handshake over an in-memory BIO pair, then one record from server
+    // to client so TLS 1.3 post-handshake tickets are processed. Returns the
+    // client's session with its latest ticket.
+    SessionPtr connect(SSL_SESSION* resume, bool& reused) {
+        SslPtr client(SSL_new(client_ctx_.get()));
+        SslPtr server(SSL_new(server_ctx_.native_handle()));
+        BIO* client_bio = nullptr;
+        BIO* server_bio = nullptr;
+        EXPECT_EQ(BIO_new_bio_pair(&client_bio, 0, &server_bio, 0), 1);
+        SSL_set_bio(client.get(), client_bio, client_bio);
+        SSL_set_bio(server.get(), server_bio, server_bio);
+        SSL_set_connect_state(client.get());
+        SSL_set_accept_state(server.get());
+        if (resume) {
+            SSL_set_session(client.get(), resume);
+        }
+
+        bool client_done = false;
+        bool server_done = false;
+        for (int i = 0; i < 32 && !(client_done && server_done); ++i) {
+            client_done = client_done || SSL_do_handshake(client.get()) == 1;
+            server_done = server_done || SSL_do_handshake(server.get()) == 1;
+        }
+        EXPECT_TRUE(client_done && server_done) << "handshake did not complete";
+
+        EXPECT_EQ(SSL_write(server.get(), "x", 1), 1);
+        char byte = 0;
+        EXPECT_EQ(SSL_read(client.get(), &byte, 1), 1);
+
+        reused = SSL_session_reused(client.get()) == 1;
+        // Without close_notify OpenSSL marks the session not resumable on free.
+        SSL_shutdown(client.get());
+        return SessionPtr(SSL_get1_session(client.get()));
+    }
+
+    boost::asio::ssl::context server_ctx_{boost::asio::ssl::context::tls_server};
+    std::unique_ptr<TlsTicketKeyRing> ring_;
+    SslCtxPtr client_ctx_;
+};
+
+TEST_P(TicketResumptionTest, TicketFromPreviousKeyResumesAndIsReissued) {
+    bool reused = true;
+    SessionPtr first = connect(nullptr, reused);
+    ASSERT_NE(first, nullptr);
+    EXPECT_FALSE(reused);
+    const std::string old_name = name_of(ring_->encryption_key());
+    EXPECT_EQ(ticket_key_name(first.get()), old_name);
+
+    // Rotate: the first ticket is now under a decrypt-only key.
+    const std::string new_name =
+            name_of(ring_->encryption_key(Clock::now() + kRotation + std::chrono::seconds(1)));
+    ASSERT_NE(new_name, old_name);
+
+    SessionPtr second = connect(first.get(), reused);
+    ASSERT_NE(second, nullptr);
+    EXPECT_TRUE(reused);
+    EXPECT_EQ(ticket_key_name(second.get()), new_name) << "ticket should be re-issued";
+}
+
+TEST_P(TicketResumptionTest, TicketFromDroppedKeyFallsBackToFullHandshake) {
+    bool reused = true;
+    SessionPtr first = connect(nullptr, reused);
+    ASSERT_NE(first, nullptr);
+
+    // Default session_timeout (1h) with a 60s rotation keeps 61 keys; rotate
+    // past all of them.
+    auto now = Clock::now();
+    for (int i = 0; i < 62; ++i) {
+        now += kRotation + std::chrono::seconds(1);
+        ring_->encryption_key(now);
+    }
+
+    connect(first.get(), reused);
+    EXPECT_FALSE(reused);
+}
+
+INSTANTIATE_TEST_SUITE_P(TlsVersions, TicketResumptionTest,
+                         ::testing::Values(TLS1_2_VERSION, TLS1_3_VERSION),
+                         [](const auto& info) {
+                             return info.param == TLS1_2_VERSION ? std::string("TLS12")
+                                                                 : std::string("TLS13");
+                         });
+
+} // anonymous namespace
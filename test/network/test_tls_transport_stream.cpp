@@ -0,0 +1,446 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <boost/beast/core.hpp>
+#include <boost/beast/websocket.hpp>
+#include <openssl/ssl.h>
+
+#include "../../common/network/pooled_flat_buffer.hpp"
+#include "../../common/network/tls_transport_stream.hpp"
+
+namespace {
+
+namespace net = boost::asio;
+namespace ssl = boost::asio::ssl;
+namespace websocket = boost::beast::websocket;
+using boost::beast::error_code;
+using im::network::KtlsResult;
+using im::network::PooledFlatBuffer;
+using im::network::TlsTransportStream;
+using tcp = net::ip::tcp;
+
+std::string pattern(std::size_t size, char seed = 0) {
+    std::string data(size, '\0');
+    for (std::size_t i = 0; i < size; ++i) {
+        data[i] = static_cast<char>(seed + i * 131 + (i >> 8));
+    }
+    return data;
+}
+
+// A connected loopback pair of TlsTransportStreams on one io_context, with
+// the TLS version pinned by the test parameter.
+class TlsTransportStreamTest : public ::testing::TestWithParam<int> {
+protected:
+    void SetUp() override {
+        server_ctx_.use_certificate_chain_file(std::string(TEST_CERT_DIR) + "/test_cert.pem");
+        server_ctx_.use_private_key_file(std::string(TEST_CERT_DIR) + "/test_key.pem",
+                                         ssl::context::pem);
+        for (auto* ctx : {&server_ctx_, &client_ctx_}) {
+            SSL_CTX_set_min_proto_version(ctx->native_handle(), GetParam());
+            SSL_CTX_set_max_proto_version(ctx->native_handle(), GetParam());
+        }
+        client_ctx_.set_verify_mode(ssl::verify_none);
+
+        auto [server_socket, client_socket] = connected_sockets();
+        server_.emplace(std::move(server_socket), server_ctx_);
+        client_.emplace(std::move(client_socket), client_ctx_);
+    }
+
+    std::pair<tcp::socket, tcp::socket> connected_sockets() {
+        tcp::acceptor acceptor(io_, {net::ip::address_v4::loopback(), 0});
+        tcp::socket client(io_);
+        client.connect(acceptor.local_endpoint());
+        tcp::socket server = acceptor.accept();
+        return {std::move(server), std::move(client)};
+    }
+
+    void handshake(TlsTransportStream& server, TlsTransportStream& client) {
+        std::optional<error_code> server_ec;
+        std::optional<error_code> client_ec;
+        server.async_handshake(ssl::stream_base::server,
+                               [&](error_code ec) { server_ec = ec; });
+        client.async_handshake(ssl::stream_base::client,
+                               [&](error_code ec) { client_ec = ec; });
+        run_until([&] { return server_ec && client_ec; });
+        ASSERT_TRUE(server_ec && client_ec) << "handshake did not complete";
+        ASSERT_FALSE(*server_ec) << server_ec->message();
+        ASSERT_FALSE(*client_ec) << client_ec->message();
+        EXPECT_EQ(SSL_version(server.native_handle()), GetParam());
+    }
+
+    void handshake() { handshake(*server_, *client_); }
+
+    template <class Done>
+    void run_until(Done done, std::chrono::seconds limit = std::chrono::seconds(10)) {
+        const auto deadline = std::chrono::steady_clock::now() + limit;
+        io_.restart();
+        while (!done() && std::chrono::steady_clock::now() < deadline) {
+            if (io_.run_one_for(std::chrono::milliseconds(50)) == 0) {
+                io_.restart();
+            }
+        }
+    }
+
+    // Writes payload from one side and reads exactly its size on the other.
+    std::string round_trip(TlsTransportStream& from, TlsTransportStream& to,
+                           const std::string& payload) {
+        std::string received(payload.size(), '\0');
+        std::optional<error_code> write_ec;
+        std::optional<error_code> read_ec;
+        net::async_write(from, net::buffer(payload),
+                         [&](error_code ec, std::size_t) { write_ec = ec; });
+        net::async_read(to, net::buffer(received),
+                        [&](error_code ec, std::size_t) { read_ec = ec; });
+        run_until([&] { return write_ec && read_ec; });
+        EXPECT_TRUE(write_ec && read_ec) << "round trip of " << payload.size() << " bytes stalled";
+        EXPECT_FALSE(write_ec.value_or(error_code{})) << write_ec->message();
+        EXPECT_FALSE(read_ec.value_or(error_code{})) << read_ec->message();
+        return received;
+    }
+
+    net::io_context io_;
+    ssl::context server_ctx_{ssl::context::tls_server};
+    ssl::context client_ctx_{ssl::context::tls_client};
+    std::optional<TlsTransportStream> server_;
+    std::optional<TlsTransportStream> client_;
+};
+
+TEST_P(TlsTransportStreamTest, HandshakeNegotiatesPinnedVersion) {
+    handshake();
+    EXPECT_FALSE(server_->plain());
+    EXPECT_FALSE(server_->ktls());
+    EXPECT_TRUE(server_->socket().native_non_blocking());
+}
+
+TEST_P(TlsTransportStreamTest, FramesAroundTheRecordSizeAndMultiMegabyte) {
+    handshake();
+    for (std::size_t size : {std::size_t{0}, std::size_t{1}, std::size_t{16 * 1024 - 1},
+                             std::size_t{16 * 1024}, std::size_t{16 * 1024 + 1},
+                             std::size_t{3 * 1024 * 1024 + 7}}) {
+        const std::string payload = pattern(size, static_cast<char>(size));
+        EXPECT_EQ(round_trip(*server_, *client_, payload), payload) << size << " bytes s->c";
+        EXPECT_EQ(round_trip(*client_, *server_, payload), payload) << size << " bytes c->s";
+    }
+}
+
+TEST_P(TlsTransportStreamTest, PipelinedWritesArriveInOrder) {
+    handshake();
+
+    // Each write starts from the previous one's completion, without waiting
+    // for the reader; the reader drains everything in one go.
+    std::vector<std::string> frames;
+    std::string expected;
+    for (std::size_t size : {100u, 16u * 1024u + 1u, 0u, 64u * 1024u, 7u}) {
+        frames.push_back(pattern(size, static_cast<char>(frames.size())));
+        expected += frames.back();
+    }
+
+    std::size_t written = 0;
+    std::optional<error_code> write_ec;
+    std::function<void()> write_next = [&] {
+        if (written == frames.size()) {
+            write_ec = error_code{};
+            return;
+        }
+        net::async_write(*server_, net::buffer(frames[written]),
+                         [&](error_code ec, std::size_t) {
+                             ++written;
+                             if (ec) {
+                                 write_ec = ec;
+                                 return;
+                             }
+                             write_next();
+                         });
+    };
+    write_next();
+
+    std::string received(expected.size(), '\0');
+    std::optional<error_code> read_ec;
+    net::async_read(*client_, net::buffer(received),
+                    [&](error_code ec, std::size_t) { read_ec = ec; });
+
+    run_until([&] { return write_ec && read_ec; });
+    ASSERT_TRUE(write_ec && read_ec);
+    EXPECT_FALSE(*write_ec);
+    EXPECT_FALSE(*read_ec);
+    EXPECT_EQ(received, expected);
+}
+
+TEST_P(TlsTransportStreamTest, ReadWaitsForWantReadUntilPeerWrites) {
+    handshake();
+
+    char buffer[64];
+    std::optional<error_code> read_ec;
+    std::size_t read_bytes = 0;
+    client_->async_read_some(net::buffer(buffer), [&](error_code ec, std::size_t n) {
+        read_ec = ec;
+        read_bytes = n;
+    });
+
+    // Nothing to read: the op parks on async_wait(wait_read).
+    run_until([&] { return read_ec.has_value(); }, std::chrono::seconds(1));
+    EXPECT_FALSE(read_ec.has_value());
+
+    const std::string payload = "late";
+    net::async_write(*server_, net::buffer(payload), [](error_code, std::size_t) {});
+    run_until([&] { return read_ec.has_value(); });
+    ASSERT_TRUE(read_ec.has_value());
+    EXPECT_FALSE(*read_ec);
+    EXPECT_EQ(std::string(buffer, read_bytes), payload);
+}
+
+TEST_P(TlsTransportStreamTest, WriteWaitsForWantWriteUntilPeerDrains) {
+    handshake();
+
+    // More than loopback's socket buffers hold, so the write parks on
+    // async_wait(wait_write) until the peer starts reading.
+    const std::string payload = pattern(32 * 1024 * 1024);
+    std::optional<error_code> write_ec;
+    net::async_write(*server_, net::buffer(payload),
+                     [&](error_code ec, std::size_t) { write_ec = ec; });
+    run_until([&] { return write_ec.has_value(); }, std::chrono::seconds(1));
+    EXPECT_FALSE(write_ec.has_value()) << "32 MB should not fit in the socket buffers";
+
+    std::string received(payload.size(), '\0');
+    std::optional<error_code> read_ec;
+    net::async_read(*client_, net::buffer(received),
+                    [&](error_code ec, std::size_t) { read_ec = ec; });
+    run_until([&] { return write_ec && read_ec; });
+    ASSERT_TRUE(write_ec && read_ec);
+    EXPECT_FALSE(*write_ec);
+    EXPECT_FALSE(*read_ec);
+    EXPECT_EQ(received, payload);
+}
+
+TEST_P(TlsTransportStreamTest, WriteSomeReturnsPartialCount) {
+    handshake();
+
+    // SSL_MODE_ENABLE_PARTIAL_WRITE: one write_some covers at most what
+    // fits before the socket would block, never the whole multi-MB buffer.
+    const std::string payload = pattern(4 * 1024 * 1024);
+    std::optional<error_code> write_ec;
+    std::size_t written = 0;
+    server_->async_write_some(net::buffer(payload), [&](error_code ec, std::size_t n) {
+        write_ec = ec;
+        written = n;
+    });
+    run_until([&] { return write_ec.has_value(); });
+    ASSERT_TRUE(write_ec.has_value());
+    EXPECT_FALSE(*write_ec);
+    EXPECT_GT(written, 0u);
+    EXPECT_LT(written, payload.size());
+
+    std::string received(written, '\0');
+    std::optional<error_code> read_ec;
+    net::async_read(*client_, net::buffer(received),
+                    [&](error_code ec, std::size_t) { read_ec = ec; });
+    run_until([&] { return read_ec.has_value(); });
+    EXPECT_EQ(received, payload.substr(0, written));
+}
+
+TEST_P(TlsTransportStreamTest, ZeroLengthReadAndWriteCompleteImmediately) {
+    handshake();
+
+    std::optional<error_code> read_ec;
+    std::optional<error_code> write_ec;
+    std::size_t read_bytes = 1;
+    std::size_t write_bytes = 1;
+    client_->async_read_some(net::mutable_buffer(), [&](error_code ec, std::size_t n) {
+        read_ec = ec;
+        read_bytes = n;
+    });
+    server_->async_write_some(net::const_buffer(), [&](error_code ec, std::size_t n) {
+        write_ec = ec;
+        write_bytes = n;
+    });
+    // Completions are posted, never invoked from the initiating call.
+    EXPECT_FALSE(read_ec.has_value());
+    EXPECT_FALSE(write_ec.has_value());
+
+    run_until([&] { return read_ec && write_ec; });
+    ASSERT_TRUE(read_ec && write_ec);
+    EXPECT_FALSE(*read_ec);
+    EXPECT_FALSE(*write_ec);
+    EXPECT_EQ(read_bytes, 0u);
+    EXPECT_EQ(write_bytes, 0u);
+}
+
+TEST_P(TlsTransportStreamTest, CloseNotifyReadsAsEof) {
+    handshake();
+
+    error_code ec;
+    server_->shutdown(ec);
+    EXPECT_FALSE(ec) << ec.message();
+
+    char byte = 0;
+    std::optional<error_code> read_ec;
+    client_->async_read_some(net::buffer(&byte, 1),
+                             [&](error_code e, std::size_t) { read_ec = e; });
+    run_until([&] { return read_ec.has_value(); });
+    ASSERT_TRUE(read_ec.has_value());
+    EXPECT_EQ(*read_ec, net::error::eof);
+}
+
+TEST_P(TlsTransportStreamTest, TcpCloseWithoutCloseNotifyIsTruncation) {
+    handshake();
+    server_->socket().close();
+
+    char byte = 0;
+    std::optional<error_code> read_ec;
+    client_->async_read_some(net::buffer(&byte, 1),
+                             [&](error_code e, std::size_t) { read_ec = e; });
+    run_until([&] { return read_ec.has_value(); });
+    ASSERT_TRUE(read_ec.has_value());
+    EXPECT_EQ(*read_ec, ssl::error::stream_truncated) << read_ec->message();
+}
+
+TEST_P(TlsTransportStreamTest, TeardownSendsCloseNotifyAndClosesSocket) {
+    handshake();
+
+    error_code ec;
+    im::network::teardown(boost::beast::role_type::server, *server_, ec);
+    EXPECT_FALSE(server_->socket().is_open());
+
+    char byte = 0;
+    std::optional<error_code> read_ec;
+    client_->async_read_some(net::buffer(&byte, 1),
+                             [&](error_code e, std::size_t) { read_ec = e; });
+    run_until([&] { return read_ec.has_value(); });
+    ASSERT_TRUE(read_ec.has_value());
+    EXPECT_EQ(*read_ec, net::error::eof);
+}
+
+TEST_P(TlsTransportStreamTest, KtlsSwitchKeepsTheStreamUsable) {
+    handshake();
+
+    std::string reason;
+    const KtlsResult result = server_->enable_ktls(reason);
+    ASSERT_NE(result, KtlsResult::Broken) << reason;
+    EXPECT_EQ(server_->ktls(), result == KtlsResult::Enabled);
+    if (GetParam() == TLS1_3_VERSION) {
+        EXPECT_EQ(result, KtlsResult::Fallback) << "kTLS is only set up for TLS 1.2";
+    }
+
+    // Either way the peer (user-space TLS) must not notice the switch.
+    for (std::size_t size : {std::size_t{1}, std::size_t{16 * 1024 + 1},
+                             std::size_t{1024 * 1024}}) {
+        const std::string payload = pattern(size);
+        EXPECT_EQ(round_trip(*server_, *client_, payload), payload) << size << " bytes s->c";
+        EXPECT_EQ(round_trip(*client_, *server_, payload), payload) << size << " bytes c->s";
+    }
+
+    error_code ec;
+    server_->shutdown(ec);
+    char byte = 0;
+    std::optional<error_code> read_ec;
+    client_->async_read_some(net::buffer(&byte, 1),
+                             [&](error_code e, std::size_t) { read_ec = e; });
+    run_until([&] { return read_ec.has_value(); });
+    ASSERT_TRUE(read_ec.has_value());
+    EXPECT_EQ(*read_ec, net::error::eof) << reason;
+    if (result != KtlsResult::Enabled) {
+        GTEST_LOG_(INFO) << "kTLS not available here, checked the fallback: " << reason;
+    }
+}
+
+TEST_P(TlsTransportStreamTest, PlainStreamSkipsTls) {
+    auto [server_socket, client_socket] = connected_sockets();
+    TlsTransportStream server(std::move(server_socket));
+    TlsTransportStream client(std::move(client_socket));
+    EXPECT_TRUE(server.plain());
+
+    error_code ec;
+    server.shutdown(ec);
+    EXPECT_FALSE(ec);
+
+    const std::string payload = pattern(20000);
+    EXPECT_EQ(round_trip(server, client, payload), payload);
+}
+
+// --- WebSocket over the stream, reading into PooledFlatBuffer ---
+
+TEST_P(TlsTransportStreamTest, WebSocketFramesIntoPooledBufferReleasedOnDrain) {
+    auto [server_socket, client_socket] = connected_sockets();
+    websocket::stream<TlsTransportStream> server(std::move(server_socket), server_ctx_);
+    websocket::stream<TlsTransportStream> client(std::move(client_socket), client_ctx_);
+    handshake(server.next_layer(), client.next_layer());
+    server.read_message_max(8 * 1024 * 1024);
+
+    std::optional<error_code> accept_ec;
+    std::optional<error_code> upgrade_ec;
+    server.async_accept([&](error_code ec) { accept_ec = ec; });
+    client.async_handshake("localhost", "/", [&](error_code ec) { upgrade_ec = ec; });
+    run_until([&] { return accept_ec && upgrade_ec; });
+    ASSERT_TRUE(accept_ec && upgrade_ec);
+    ASSERT_FALSE(*accept_ec) << accept_ec->message();
+    ASSERT_FALSE(*upgrade_ec) << upgrade_ec->message();
+    client.binary(true);
+
+    std::vector<std::string> frames;
+    for (std::size_t size : {std::size_t{0}, std::size_t{16 * 1024 - 1}, std::size_t{16 * 1024},
+                             std::size_t{16 * 1024 + 1}, std::size_t{2 * 1024 * 1024}}) {
+        frames.push_back(pattern(size, static_cast<char>(frames.size())));
+    }
+
+    // Client pipelines every frame; the server reads them back one at a time.
+    std::size_t written = 0;
+    std::function<void()> write_next = [&] {
+        if (written == frames.size()) {
+            return;
+        }
+        client.async_write(net::buffer(frames[written]), [&](error_code ec, std::size_t) {
+            ASSERT_FALSE(ec) << ec.message();
+            ++written;
+            write_next();
+        });
+    };
+    write_next();
+
+    PooledFlatBuffer buffer;
+    for (const auto& frame : frames) {
+        EXPECT_FALSE(buffer.borrowed()) << "idle between frames";
+        std::optional<error_code> read_ec;
+        server.async_read(buffer, [&](error_code ec, std::size_t) { read_ec = ec; });
+        run_until([&] { return read_ec.has_value(); });
+        ASSERT_TRUE(read_ec.has_value());
+        ASSERT_FALSE(*read_ec) << read_ec->message();
+
+        EXPECT_EQ(boost::beast::buffers_to_string(buffer.data()), frame);
+        if (!frame.empty()) {
+            EXPECT_TRUE(buffer.borrowed());
+        }
+        buffer.consume(buffer.size());
+        EXPECT_FALSE(buffer.borrowed()) << "drained buffer goes back to the pool";
+    }
+    EXPECT_EQ(written, frames.size());
+
+    // Close handshake runs through async_teardown: close_notify, then TCP.
+    std::optional<error_code> close_ec;
+    std::optional<error_code> peer_ec;
+    server.async_close(websocket::close_code::normal, [&](error_code ec) { close_ec = ec; });
+    client.async_read(buffer, [&](error_code ec, std::size_t) { peer_ec = ec; });
+    run_until([&] { return close_ec && peer_ec; });
+    ASSERT_TRUE(close_ec && peer_ec);
+    EXPECT_FALSE(*close_ec) << close_ec->message();
+    EXPECT_EQ(*peer_ec, websocket::error::closed);
+    buffer.release();
+}
+
+INSTANTIATE_TEST_SUITE_P(TlsVersions, TlsTransportStreamTest,
+                         ::testing::Values(TLS1_2_VERSION, TLS1_3_VERSION),
+                         [](const auto& info) {
+                             return info.param == TLS1_2_VERSION ? std::string("TLS12")
+                                                                 : std::string("TLS13");
+                         });
+
+} // anonymous namespace
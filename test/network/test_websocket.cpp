@@ -2,12 +2,15 @@
 #include <boost/asio.hpp>
 #include <boost/asio/ssl.hpp>
 #include <boost/beast.hpp>
+#include <boost/beast/ssl.hpp>
 #include <thread>
 #include <chrono>
 #include <memory>
 #include <filesystem>
 #include <atomic>
 #include <condition_variable>
+#include <cstring>
+#include <vector>
 
 #include "../../common/network/websocket_server.hpp"
 #include "../../common/network/websocket_session.hpp"
@@ -43,9 +46,9 @@ protected:
         
         // 创建自签名证书用于测试 (简化版本，实际使用时应该使用真实证书)
         try {
-            // 使用绝对路径确保能找到证书文件
-            ssl_ctx_->use_certificate_chain_file("/home/myself/workspace/MyChat/test/network/test_cert.pem");
-            ssl_ctx_->use_private_key_file("/home/myself/workspace/MyChat/test/network/test_key.pem", ssl::context::pem);
+            // 证书目录由 CMake 传入
+            ssl_ctx_->use_certificate_chain_file(std::string(TEST_CERT_DIR) + "/test_cert.pem");
+            ssl_ctx_->use_private_key_file(std::string(TEST_CERT_DIR) + "/test_key.pem", ssl::context::pem);
         } catch (const std::exception& e) {
             // 如果证书文件不存在，创建一个最小的SSL上下文用于测试
             // 注意：这种情况下某些需要真实SSL连接的测试可能会失败
@@ -64,6 +67,8 @@ protected:
 
     void StartIOContext() {
         ioc_thread_ = std::thread([this]() {
+            // 服务器在线程启动后才投递 accept，没有 work guard 时 run() 会立刻返回
+            auto work = net::make_work_guard(ioc_);
             ioc_.run();
         });
         std::this_thread::sleep_for(10ms); // 让IO上下文启动
@@ -77,6 +82,13 @@ protected:
         ioc_.restart(); // 重置以便下次使用
     }
 
+    // 会话只保存回调的指针，由测试夹具持有
+    const SessionHandlers* handlers_for(MessageHandler handler) {
+        handlers_.push_back(std::make_unique<SessionHandlers>());
+        handlers_.back()->on_message = std::move(handler);
+        return handlers_.back().get();
+    }
+
 protected:
     net::io_context ioc_;
     std::unique_ptr<ssl::context> ssl_ctx_;
@@ -85,6 +97,7 @@ protected:
     std::atomic<int> error_count_{0};
     std::mutex test_mutex_;
     std::condition_variable test_cv_;
+    std::vector<std::unique_ptr<SessionHandlers>> handlers_;
 };
 
 // Mock message handler for testing
@@ -226,9 +239,9 @@ TEST_F(WebSocketServerTest, SessionManagement) {
     tcp::socket socket2(ioc_);
     
     auto session1 = std::make_shared<WebSocketSession>(
-        std::move(socket1), *ssl_ctx_, &server, message_handler_);
+        std::move(socket1), *ssl_ctx_, &server, handlers_for(message_handler_));
     auto session2 = std::make_shared<WebSocketSession>(
-        std::move(socket2), *ssl_ctx_, &server, message_handler_);
+        std::move(socket2), *ssl_ctx_, &server, handlers_for(message_handler_));
     
     // 注意：由于session ID在握手完成前为空，添加空ID的会话到map中
     // 会导致键为空字符串，多个会话会互相覆盖
@@ -258,7 +271,7 @@ TEST_F(WebSocketServerTest, RemoveSessionById) {
     
     tcp::socket socket(ioc_);
     auto session = std::make_shared<WebSocketSession>(
-        std::move(socket), *ssl_ctx_, &server, message_handler_);
+        std::move(socket), *ssl_ctx_, &server, handlers_for(message_handler_));
     
     server.add_session(session);
     EXPECT_EQ(server.get_session_count(), 1);
@@ -276,7 +289,7 @@ TEST_F(WebSocketServerTest, BroadcastMessage) {
     // 创建模拟会话
     tcp::socket socket(ioc_);
     auto session = std::make_shared<WebSocketSession>(
-        std::move(socket), *ssl_ctx_, &server, message_handler_);
+        std::move(socket), *ssl_ctx_, &server, handlers_for(message_handler_));
     
     server.add_session(session);
     
@@ -328,7 +341,7 @@ TEST_F(WebSocketSessionTest, Construction) {
     
     EXPECT_NO_THROW({
         auto session = std::make_shared<WebSocketSession>(
-            std::move(socket), *ssl_ctx_, server_.get(), MockMessageHandler::handler);
+            std::move(socket), *ssl_ctx_, server_.get(), handlers_for(MockMessageHandler::handler));
         
         EXPECT_NE(session.get(), nullptr);
         EXPECT_EQ(session->get_server(), server_.get());
@@ -455,7 +468,7 @@ TEST_F(WebSocketIntegrationTest, ServerSessionIntegration) {
     // 创建会话并添加到服务器
     tcp::socket socket(ioc_);
     auto session = std::make_shared<WebSocketSession>(
-        std::move(socket), *ssl_ctx_, server_.get(), message_handler_);
+        std::move(socket), *ssl_ctx_, server_.get(), handlers_for(message_handler_));
     
     EXPECT_EQ(server_->get_session_count(), 0);
     
@@ -482,7 +495,7 @@ TEST_F(WebSocketIntegrationTest, MultipleSessionsManagement) {
     for (int i = 0; i < session_count; ++i) {
         tcp::socket socket(ioc_);
         auto session = std::make_shared<WebSocketSession>(
-            std::move(socket), *ssl_ctx_, server_.get(), message_handler_);
+            std::move(socket), *ssl_ctx_, server_.get(), handlers_for(message_handler_));
         sessions.push_back(session);
         server_->add_session(session);
     }
@@ -517,7 +530,7 @@ TEST_F(WebSocketIntegrationTest, ThreadSafety) {
             for (int i = 0; i < operations_per_thread; ++i) {
                 tcp::socket socket(ioc_);
                 auto session = std::make_shared<WebSocketSession>(
-                    std::move(socket), *ssl_ctx_, server_.get(), message_handler_);
+                    std::move(socket), *ssl_ctx_, server_.get(), handlers_for(message_handler_));
                 
                 server_->add_session(session);
                 std::this_thread::sleep_for(1ms);
@@ -552,7 +565,7 @@ TEST_F(WebSocketIntegrationTest, StressTestManySessions) {
     for (int i = 0; i < large_session_count; ++i) {
         tcp::socket socket(ioc_);
         auto session = std::make_shared<WebSocketSession>(
-            std::move(socket), *ssl_ctx_, server_.get(), message_handler_);
+            std::move(socket), *ssl_ctx_, server_.get(), handlers_for(message_handler_));
         sessions.push_back(session);
         server_->add_session(session);
     }
@@ -1041,4 +1054,178 @@ TEST_F(WebSocketRealConnectionTest, DISABLED_MultipleConnectionsUniqueSessionIds
     }
     
     StopIOContext();
-}
\ No newline at end of file
+}
+
+// 准入控制：令牌桶补充、Drop 与 Defer 的区分
+class WebSocketAdmissionTest : public WebSocketTest {
+protected:
+    using Admission = WebSocketServer::Admission;
+
+    void SetUp() override {
+        WebSocketTest::SetUp();
+        tcp::acceptor acceptor(ioc_, tcp::endpoint(net::ip::make_address_v4("127.0.0.1"), 0));
+        port_ = acceptor.local_endpoint().port();
+        server_ = std::make_unique<WebSocketServer>(*ssl_ctx_, std::move(acceptor),
+                                                    MockMessageHandler::handler);
+    }
+
+    void TearDown() override {
+        if (server_) {
+            server_->stop();
+        }
+        WebSocketTest::TearDown();
+    }
+
+    using ClientStream = websocket::stream<beast::ssl_stream<tcp::socket>>;
+
+    // 同步客户端：TCP + TLS + WebSocket 握手，各步骤的错误码写入 ec
+    std::unique_ptr<ClientStream> connect_client(net::io_context& client_ioc,
+                                                 ssl::context& client_ctx,
+                                                 beast::error_code& ec) {
+        auto ws = std::make_unique<ClientStream>(client_ioc, client_ctx);
+        beast::get_lowest_layer(*ws).connect(
+                tcp::endpoint(net::ip::make_address_v4("127.0.0.1"), port_), ec);
+        if (!ec) {
+            ws->next_layer().handshake(ssl::stream_base::client, ec);
+        }
+        if (!ec) {
+            ws->handshake("127.0.0.1", "/", ec);
+        }
+        return ws;
+    }
+
+    unsigned short port_ = 0;
+    std::unique_ptr<WebSocketServer> server_;
+};
+
+TEST_F(WebSocketAdmissionTest, UnlimitedAdmitsEverything) {
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(server_->admit(), Admission::Admit);
+    }
+}
+
+TEST_F(WebSocketAdmissionTest, TokenBucketRefillsAtConfiguredRate) {
+    WebSocketAdmissionLimits limits;
+    limits.max_accepts_per_sec = 2;
+    server_->set_admission_limits(limits);
+
+    // 桶容量为一秒的配额，起始即满
+    const auto t0 = std::chrono::steady_clock::now();
+    EXPECT_EQ(server_->admit(t0), Admission::Admit);
+    EXPECT_EQ(server_->admit(t0), Admission::Admit);
+    EXPECT_EQ(server_->admit(t0), Admission::Defer);
+
+    // 2/s：250ms 只补半个令牌，500ms 补满一个
+    EXPECT_EQ(server_->admit(t0 + 250ms), Admission::Defer);
+    EXPECT_EQ(server_->admit(t0 + 500ms), Admission::Admit);
+    EXPECT_EQ(server_->admit(t0 + 500ms), Admission::Defer);
+
+    // 空闲再久也不超过桶容量
+    const auto t1 = t0 + 10s;
+    EXPECT_EQ(server_->admit(t1), Admission::Admit);
+    EXPECT_EQ(server_->admit(t1), Admission::Admit);
+    EXPECT_EQ(server_->admit(t1), Admission::Defer);
+}
+
+TEST_F(WebSocketAdmissionTest, PendingHandshakeLimitDropsWithoutSpendingTokens) {
+    WebSocketAdmissionLimits limits;
+    limits.max_accepts_per_sec = 1;
+    limits.max_pending_handshakes = 1;
+    server_->set_admission_limits(limits);
+
+    const auto t0 = std::chrono::steady_clock::now();
+    server_->record_handshake_started();
+    EXPECT_EQ(server_->admit(t0), Admission::Drop);
+    EXPECT_EQ(server_->admit(t0), Admission::Drop);
+
+    // 握手数降下来后，令牌仍在：先 Admit，桶空后 Defer
+    server_->record_handshake_finished();
+    EXPECT_EQ(server_->admit(t0), Admission::Admit);
+    EXPECT_EQ(server_->admit(t0), Admission::Defer);
+}
+
+TEST_F(WebSocketAdmissionTest, DeferredConnectionClosedWithTryAgainLater) {
+    WebSocketAdmissionLimits limits;
+    limits.max_accepts_per_sec = 1;
+    limits.retry_after_min = 100ms;
+    limits.retry_after_max = 200ms;
+    server_->set_admission_limits(limits);
+    ASSERT_EQ(server_->admit(), Admission::Admit);  // 用掉唯一的令牌
+
+    StartIOContext();
+    server_->start();
+
+    net::io_context client_ioc;
+    ssl::context client_ctx(ssl::context::tlsv12_client);
+    client_ctx.set_verify_mode(ssl::verify_none);
+    beast::error_code ec;
+    auto ws = connect_client(client_ioc, client_ctx, ec);
+    ASSERT_FALSE(ec) << ec.message();
+
+    beast::flat_buffer buffer;
+    ws->read(buffer, ec);
+    EXPECT_EQ(ec, websocket::error::closed);
+    EXPECT_EQ(ws->reason().code, websocket::close_code::try_again_later);
+    const std::string reason(ws->reason().reason.c_str());
+    ASSERT_EQ(reason.rfind("retry_after_ms=", 0), 0u) << reason;
+    const int retry_after = std::stoi(reason.substr(std::strlen("retry_after_ms=")));
+    EXPECT_GE(retry_after, 100);
+    EXPECT_LE(retry_after, 200);
+
+    const auto stats = server_->get_stats();
+    EXPECT_EQ(stats.deferred, 1u);
+    EXPECT_EQ(stats.admitted, 0u);
+    EXPECT_EQ(server_->get_session_count(), 0u);
+    StopIOContext();
+}
+
+TEST_F(WebSocketAdmissionTest, DeferredCloseTimesOutWhenPeerNeverAnswers) {
+    WebSocketAdmissionLimits limits;
+    limits.max_accepts_per_sec = 1;
+    server_->set_admission_limits(limits);
+    ASSERT_EQ(server_->admit(), Admission::Admit);
+
+    StartIOContext();
+    server_->start();
+
+    net::io_context client_ioc;
+    ssl::context client_ctx(ssl::context::tlsv12_client);
+    client_ctx.set_verify_mode(ssl::verify_none);
+    beast::error_code ec;
+    auto ws = connect_client(client_ioc, client_ctx, ec);
+    ASSERT_FALSE(ec) << ec.message();
+
+    // 只读 TLS 层，不回关闭帧：服务端在关闭超时后自行断开
+    const auto start = std::chrono::steady_clock::now();
+    char scratch[256];
+    while (!ec) {
+        ws->next_layer().read_some(net::buffer(scratch), ec);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, 1s);
+    EXPECT_LT(elapsed, 5s);
+    StopIOContext();
+}
+
+TEST_F(WebSocketAdmissionTest, DroppedConnectionClosedBeforeTls) {
+    WebSocketAdmissionLimits limits;
+    limits.max_pending_handshakes = 1;
+    server_->set_admission_limits(limits);
+    server_->record_handshake_started();
+
+    StartIOContext();
+    server_->start();
+
+    net::io_context client_ioc;
+    ssl::context client_ctx(ssl::context::tlsv12_client);
+    client_ctx.set_verify_mode(ssl::verify_none);
+    beast::error_code ec;
+    connect_client(client_ioc, client_ctx, ec);
+    EXPECT_TRUE(ec) << "TLS handshake should fail on a dropped connection";
+
+    const auto stats = server_->get_stats();
+    EXPECT_EQ(stats.dropped, 1u);
+    EXPECT_EQ(stats.deferred, 0u);
+    EXPECT_EQ(stats.admitted, 0u);
+    StopIOContext();
+}
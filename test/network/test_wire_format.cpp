@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+
+#include "../../common/network/wire_format.hpp"
+
+namespace {
+
+using im::network::kWireV2Subprotocol;
+using im::network::offers_subprotocol;
+
+TEST(WireFormatTest, SubprotocolMatchesWholeListItems) {
+    EXPECT_TRUE(offers_subprotocol("im.v2", kWireV2Subprotocol));
+    EXPECT_TRUE(offers_subprotocol("chat, im.v2", kWireV2Subprotocol));
+    EXPECT_TRUE(offers_subprotocol(" im.v2 ,chat", kWireV2Subprotocol));
+    EXPECT_TRUE(offers_subprotocol("chat,\tim.v2\t", kWireV2Subprotocol));
+}
+
+TEST(WireFormatTest, SubprotocolRejectsSubstrings) {
+    EXPECT_FALSE(offers_subprotocol("", kWireV2Subprotocol));
+    EXPECT_FALSE(offers_subprotocol(" , ,", kWireV2Subprotocol));
+    EXPECT_FALSE(offers_subprotocol("im.v20", kWireV2Subprotocol));
+    EXPECT_FALSE(offers_subprotocol("x-im.v2", kWireV2Subprotocol));
+    EXPECT_FALSE(offers_subprotocol("chat, im.v2.beta", kWireV2Subprotocol));
+    EXPECT_FALSE(offers_subprotocol("im.v 2", kWireV2Subprotocol));
+}
+
+} // anonymous namespace
@@ -45,8 +45,16 @@ public:
         return accepted;
     }
 
+    bool send_messages(const std::string& session_id,
+                       const std::string& payload,
+                       const std::vector<uint64_t>& msg_ids) override {
+        sent_msg_ids.push_back(msg_ids);
+        return send_payload(session_id, payload);
+    }
+
     bool accepted = true;
     bool throw_on_call = false;
+    std::vector<std::vector<uint64_t>> sent_msg_ids;
     std::vector<std::string> sent_session_ids;
     std::vector<std::string> sent_payloads;
 };
@@ -129,6 +137,7 @@ TEST(GatewayPushDeliveryServiceTest, SendSessionPayloadDelegatesAndReturnsAccept
     im::push::SendSessionPayloadRequest request;
     request.set_session_id("session-2");
     request.set_payload("encoded");
+    request.add_msg_ids(41);
     im::push::SendSessionPayloadResponse response;
 
     auto status = service.SendSessionPayload(nullptr, &request, &response);
@@ -139,6 +148,7 @@ TEST(GatewayPushDeliveryServiceTest, SendSessionPayloadDelegatesAndReturnsAccept
     ASSERT_EQ(sender.sent_session_ids.size(), 1u);
     EXPECT_EQ(sender.sent_session_ids[0], "session-2");
     EXPECT_EQ(sender.sent_payloads[0], "encoded");
+    EXPECT_EQ(sender.sent_msg_ids[0], (std::vector<uint64_t>{41}));
 }
 
 TEST(GatewayPushDeliveryServiceTest, SendSessionPayloadRejectsMissingPayload) {
@@ -1,12 +1,17 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 
+#include <offline_outbox.hpp>
 #include <push_runtime.hpp>
 
 #include "../../common/network/protobuf_codec.hpp"
@@ -18,6 +23,8 @@ namespace {
 
 using json = nlohmann::json;
 using im::network::ProtobufCodec;
+using im::service::push::OfflineEntry;
+using im::service::push::OfflineOutbox;
 using im::service::push::PlatformFilterFanoutPolicy;
 using im::service::push::PushContext;
 using im::service::push::PushDeliveryMarker;
@@ -46,9 +53,35 @@ public:
         return send_success;
     }
 
+    bool send_messages(const std::string& session_id,
+                       const std::string& payload,
+                       const std::vector<uint64_t>& msg_ids) override {
+        sent_msg_ids.push_back(msg_ids);
+        return send_payload(session_id, payload);
+    }
+
+    std::size_t pending_payloads(const std::string& /*session_id*/) override {
+        return pending;
+    }
+
+    void when_writable(const std::string& session_id,
+                       std::size_t window,
+                       std::function<void(bool)> resume) override {
+        if (!park_writers) {
+            PushPayloadSender::when_writable(session_id, window, std::move(resume));
+            return;
+        }
+        parked = std::move(resume);
+    }
+
     bool send_success = true;
+    std::size_t pending = 0;
+    // When set, a full window parks the drain until the test calls parked.
+    bool park_writers = false;
+    std::function<void(bool)> parked;
     std::vector<std::string> sent_sessions;
     std::vector<std::string> sent_payloads;
+    std::vector<std::vector<uint64_t>> sent_msg_ids;
 };
 
 class FakeDeliveryMarker : public PushDeliveryMarker {
@@ -60,11 +93,56 @@ public:
         return true;
     }
 
+    std::size_t mark_delivered_batch(const std::vector<uint64_t>& msg_ids,
+                                     int64_t delivered_time) override {
+        ++batch_calls;
+        return PushDeliveryMarker::mark_delivered_batch(msg_ids, delivered_time);
+    }
+
+    int batch_calls = 0;
     bool marked = false;
     uint64_t marked_msg_id = 0;
     int64_t marked_time = 0;
 };
 
+class FakeOutbox : public OfflineOutbox {
+public:
+    bool append(const std::string& receiver_uid, const OfflineEntry& entry) override {
+        queues[receiver_uid][entry.msg_id] = entry;
+        return true;
+    }
+
+    std::vector<OfflineEntry> peek(const std::string& receiver_uid,
+                                   uint64_t after_msg_id,
+                                   std::size_t limit) override {
+        std::vector<OfflineEntry> out;
+        auto& queue = queues[receiver_uid];
+        for (auto it = queue.upper_bound(after_msg_id);
+             it != queue.end() && out.size() < limit; ++it) {
+            out.push_back(it->second);
+        }
+        return out;
+    }
+
+    void ack_range(const std::string& receiver_uid,
+                   uint64_t from_msg_id,
+                   uint64_t to_msg_id) override {
+        auto& queue = queues[receiver_uid];
+        queue.erase(queue.lower_bound(from_msg_id), queue.upper_bound(to_msg_id));
+    }
+
+    std::map<std::string, std::map<uint64_t, OfflineEntry>> queues;
+};
+
+std::size_t drain(PushRuntime& runtime,
+                  const std::string& receiver_uid,
+                  const std::string& session_id) {
+    std::size_t pushed = 0;
+    runtime.drain_offline(receiver_uid, session_id, 1000,
+                          [&pushed](std::size_t count) { pushed = count; });
+    return pushed;
+}
+
 PushSessionInfo make_session(const std::string& session_id,
                              const std::string& platform,
                              std::chrono::system_clock::time_point connect_time) {
@@ -171,4 +249,224 @@ TEST(PushRuntimeTest, NullDependenciesReturnSilently) {
     EXPECT_NO_THROW(runtime.notify_user("receiver-4", 1003, "content"));
 }
 
+TEST(PushRuntimeTest, UndeliveredDirectMessageGoesToOfflineOutbox) {
+    FakeSessionProvider provider;
+    FakePayloadSender sender;
+    FakeDeliveryMarker marker;
+    PushRuntime runtime(&provider, &sender, &marker);
+    auto outbox = std::make_shared<FakeOutbox>();
+    runtime.set_offline_outbox(outbox);
+
+    PushContext direct;
+    direct.sender_uid = "sender-1";
+    direct.conversation_type = "direct";
+    runtime.notify_user("receiver-5", 2001, "offline hello", direct);
+
+    PushContext group;
+    group.conversation_type = "group";
+    group.conversation_id = "7";
+    runtime.notify_user("receiver-5", 2002, "group hello", group);
+
+    ASSERT_EQ(outbox->queues["receiver-5"].size(), 1u);
+    const auto& entry = outbox->queues["receiver-5"].at(2001);
+    EXPECT_EQ(entry.content, "offline hello");
+    EXPECT_EQ(entry.context.sender_uid, "sender-1");
+    EXPECT_FALSE(marker.marked);
+}
+
+TEST(PushRuntimeTest, DrainOfflineSendsOneBatchFrameAndMarksInBulk) {
+    FakeSessionProvider provider;
+    FakePayloadSender sender;
+    FakeDeliveryMarker marker;
+    PushRuntime runtime(&provider, &sender, &marker);
+    auto outbox = std::make_shared<FakeOutbox>();
+    runtime.set_offline_outbox(outbox);
+    for (uint64_t id : {3003u, 3001u, 3002u}) {
+        PushContext context;
+        context.sender_uid = "sender-" + std::to_string(id);
+        outbox->append("receiver-6", OfflineEntry{id, "m" + std::to_string(id), context});
+    }
+
+    EXPECT_EQ(drain(runtime, "receiver-6", "sess-6"), 3u);
+
+    ASSERT_EQ(sender.sent_payloads.size(), 1u);
+    EXPECT_EQ(sender.sent_sessions[0], "sess-6");
+    im::base::IMHeader header;
+    im::push::PushBatchRequest batch;
+    ASSERT_TRUE(ProtobufCodec::decode(sender.sent_payloads[0], header, batch));
+    EXPECT_EQ(header.cmd_id(), im::command::CMD_PUSH_BATCH_MESSAGE);
+    EXPECT_EQ(batch.type(), im::push::PUSH_OFFLINE);
+
+    ASSERT_EQ(batch.items_size(), 3);
+    EXPECT_EQ(batch.items(0).msg_id(), 3001u);
+    EXPECT_EQ(batch.items(0).content(), "m3001");
+    EXPECT_EQ(batch.items(0).sender_uid(), "sender-3001");
+    EXPECT_EQ(batch.items(2).msg_id(), 3003u);
+    EXPECT_EQ(sender.sent_msg_ids[0], (std::vector<uint64_t>{3001, 3002, 3003}));
+
+    EXPECT_EQ(marker.batch_calls, 1);
+    EXPECT_EQ(marker.marked_msg_id, 3003u);
+    EXPECT_TRUE(outbox->queues["receiver-6"].empty());
+}
+
+TEST(PushRuntimeTest, DrainOfflineSplitsFramesByContentSize) {
+    FakeSessionProvider provider;
+    FakePayloadSender sender;
+    FakeDeliveryMarker marker;
+    PushRuntime runtime(&provider, &sender, &marker);
+    auto outbox = std::make_shared<FakeOutbox>();
+    runtime.set_offline_outbox(outbox);
+    const std::string big(PushRuntime::kBatchBytes / 2, 'x');
+    for (uint64_t id = 5001; id <= 5004; ++id) {
+        outbox->append("receiver-8", OfflineEntry{id, big, {}});
+    }
+
+    EXPECT_EQ(drain(runtime, "receiver-8", "sess-8"), 4u);
+
+    EXPECT_EQ(sender.sent_payloads.size(), 2u);
+    EXPECT_EQ(marker.batch_calls, 2);
+    EXPECT_TRUE(outbox->queues["receiver-8"].empty());
+}
+
+TEST(PushRuntimeTest, DrainOfflineFallsThroughToPendingSource) {
+    FakeSessionProvider provider;
+    FakePayloadSender sender;
+    FakeDeliveryMarker marker;
+    PushRuntime runtime(&provider, &sender, &marker);
+    auto outbox = std::make_shared<FakeOutbox>();
+    auto pending = std::make_shared<FakeOutbox>();
+    runtime.set_offline_outbox(outbox);
+    runtime.set_pending_source(pending);
+    outbox->append("receiver-9", OfflineEntry{6002, "queued", {}});
+    pending->append("receiver-9", OfflineEntry{6001, "only in store", {}});
+
+    EXPECT_EQ(drain(runtime, "receiver-9", "sess-9"), 2u);
+
+    EXPECT_EQ(sender.sent_payloads.size(), 2u);
+    EXPECT_TRUE(outbox->queues["receiver-9"].empty());
+    EXPECT_TRUE(pending->queues["receiver-9"].empty());
+}
+
+TEST(PushRuntimeTest, DrainOfflineKeepsEntriesWhenSendFails) {
+    FakeSessionProvider provider;
+    FakePayloadSender sender;
+    FakeDeliveryMarker marker;
+    PushRuntime runtime(&provider, &sender, &marker);
+    auto outbox = std::make_shared<FakeOutbox>();
+    runtime.set_offline_outbox(outbox);
+    outbox->append("receiver-7", OfflineEntry{4001, "a", {}});
+    outbox->append("receiver-7", OfflineEntry{4002, "b", {}});
+    sender.send_success = false;
+
+    EXPECT_EQ(drain(runtime, "receiver-7", "sess-7"), 0u);
+
+    EXPECT_EQ(sender.sent_payloads.size(), 1u);
+    EXPECT_FALSE(marker.marked);
+    EXPECT_EQ(outbox->queues["receiver-7"].size(), 2u);
+}
+
+TEST(PushRuntimeTest, DrainOfflineStopsWhileSessionQueueIsFull) {
+    FakeSessionProvider provider;
+    FakePayloadSender sender;
+    FakeDeliveryMarker marker;
+    PushRuntime runtime(&provider, &sender, &marker);
+    auto outbox = std::make_shared<FakeOutbox>();
+    runtime.set_offline_outbox(outbox);
+    outbox->append("receiver-10", OfflineEntry{7001, "a", {}});
+    sender.pending = PushRuntime::kSendWindow;
+
+    EXPECT_EQ(drain(runtime, "receiver-10", "sess-10"), 0u);
+
+    EXPECT_TRUE(sender.sent_payloads.empty());
+    EXPECT_EQ(outbox->queues["receiver-10"].size(), 1u);
+}
+
+TEST(PushRuntimeTest, DrainOfflineResumesWhenSessionDrains) {
+    FakeSessionProvider provider;
+    FakePayloadSender sender;
+    FakeDeliveryMarker marker;
+    PushRuntime runtime(&provider, &sender, &marker);
+    auto outbox = std::make_shared<FakeOutbox>();
+    runtime.set_offline_outbox(outbox);
+    outbox->append("receiver-12", OfflineEntry{9001, "a", {}});
+    outbox->append("receiver-12", OfflineEntry{9002, "b", {}});
+    sender.pending = PushRuntime::kSendWindow;
+    sender.park_writers = true;
+
+    std::size_t pushed = 0;
+    bool done = false;
+    runtime.drain_offline("receiver-12", "sess-12", 1000, [&](std::size_t count) {
+        pushed = count;
+        done = true;
+    });
+
+    EXPECT_FALSE(done);
+    EXPECT_TRUE(sender.sent_payloads.empty());
+    ASSERT_TRUE(sender.parked);
+
+    sender.pending = 0;
+    auto resume = std::move(sender.parked);
+    resume(true);
+
+    EXPECT_TRUE(done);
+    EXPECT_EQ(pushed, 2u);
+    EXPECT_EQ(sender.sent_payloads.size(), 1u);
+    EXPECT_TRUE(outbox->queues["receiver-12"].empty());
+}
+
+TEST(PushRuntimeTest, DrainOfflineStopsWhenSessionClosesWhileParked) {
+    FakeSessionProvider provider;
+    FakePayloadSender sender;
+    FakeDeliveryMarker marker;
+    PushRuntime runtime(&provider, &sender, &marker);
+    auto outbox = std::make_shared<FakeOutbox>();
+    runtime.set_offline_outbox(outbox);
+    outbox->append("receiver-13", OfflineEntry{9101, "a", {}});
+    sender.pending = PushRuntime::kSendWindow;
+    sender.park_writers = true;
+
+    bool done = false;
+    runtime.drain_offline("receiver-13", "sess-13", 1000,
+                          [&done](std::size_t) { done = true; });
+    ASSERT_TRUE(sender.parked);
+    auto resume = std::move(sender.parked);
+    resume(false);
+
+    EXPECT_TRUE(done);
+    EXPECT_TRUE(sender.sent_payloads.empty());
+    EXPECT_EQ(outbox->queues["receiver-13"].size(), 1u);
+}
+
+TEST(PushRuntimeTest, RequireClientAckLeavesDeliveredStateToClient) {
+    FakeSessionProvider provider;
+    FakePayloadSender sender;
+    FakeDeliveryMarker marker;
+    PushRuntime runtime(&provider, &sender, &marker);
+    runtime.set_require_client_ack(true);
+    provider.sessions = {
+        make_session("sess-11", "web", std::chrono::system_clock::now()),
+    };
+
+    runtime.notify_user("receiver-11", 8001, "live");
+
+    auto outbox = std::make_shared<FakeOutbox>();
+    auto pending = std::make_shared<FakeOutbox>();
+    runtime.set_offline_outbox(outbox);
+    runtime.set_pending_source(pending);
+    // Without a delivered mark the store still lists what the outbox pushed.
+    outbox->append("receiver-11", OfflineEntry{8002, "queued", {}});
+    pending->append("receiver-11", OfflineEntry{8002, "queued", {}});
+    pending->append("receiver-11", OfflineEntry{8003, "store only", {}});
+
+    EXPECT_EQ(drain(runtime, "receiver-11", "sess-11"), 2u);
+
+    EXPECT_EQ(sender.sent_payloads.size(), 3u);
+    EXPECT_FALSE(marker.marked);
+    EXPECT_EQ(marker.batch_calls, 0);
+    // Queued is not received: the outbox keeps 8002 until the client acks it.
+    ASSERT_EQ(outbox->queues["receiver-11"].size(), 1u);
+    EXPECT_EQ(outbox->queues["receiver-11"].begin()->first, 8002u);
+    EXPECT_EQ(pending->queues["receiver-11"].size(), 2u);
+}
+
 } // anonymous namespace
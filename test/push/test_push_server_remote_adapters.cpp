@@ -134,6 +134,19 @@ TEST(PushServerRemoteAdaptersTest, PayloadSenderSendsExpectedRequest) {
     ASSERT_EQ(fake->send_requests.size(), 1u);
     EXPECT_EQ(fake->send_requests[0].session_id(), "session-2");
     EXPECT_EQ(fake->send_requests[0].payload(), "payload");
+    EXPECT_EQ(fake->send_requests[0].msg_ids_size(), 0);
+}
+
+TEST(PushServerRemoteAdaptersTest, PayloadSenderForwardsMessageIds) {
+    auto fake = std::make_shared<FakeGatewayDeliveryRpcClient>();
+    RemoteGatewayPushPayloadSender sender(fake);
+
+    EXPECT_TRUE(sender.send_messages("session-5", "batch", {7, 8}));
+
+    ASSERT_EQ(fake->send_requests.size(), 1u);
+    ASSERT_EQ(fake->send_requests[0].msg_ids_size(), 2);
+    EXPECT_EQ(fake->send_requests[0].msg_ids(0), 7u);
+    EXPECT_EQ(fake->send_requests[0].msg_ids(1), 8u);
 }
 
 TEST(PushServerRemoteAdaptersTest, PayloadSenderReturnsFalseWhenGatewayRejects) {
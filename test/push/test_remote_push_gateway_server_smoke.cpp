@@ -314,15 +314,17 @@ protected:
         const auto created_user_ids = created_user_ids_;
         redis_manager().execute([created_user_ids](auto& redis) {
             redis.del("online:users");
-            for (const auto& key : redis.keys(std::string("user:sessions:") + kTestUidPrefix + "*")) {
+            for (const auto& key :
+                 redis.keys(std::string("user:sessions:{") + kTestUidPrefix + "*")) {
                 redis.del(key);
             }
-            for (const auto& key : redis.keys(std::string("user:platform:") + kTestUidPrefix + "*")) {
+            for (const auto& key :
+                 redis.keys(std::string("user:platform:{") + kTestUidPrefix + "*")) {
                 redis.del(key);
             }
             for (const auto& uid : created_user_ids) {
-                redis.del(std::string("user:sessions:") + uid);
-                redis.del(std::string("user:platform:") + uid);
+                redis.del(im::gateway::RedisConnectionStateStore::user_sessions_key(uid));
+                redis.del(im::gateway::RedisConnectionStateStore::user_platform_key(uid));
             }
             for (const auto& key : redis.keys("session:user:*")) {
                 auto uid = redis.hget(key, "user_id");
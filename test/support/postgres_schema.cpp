@@ -1,10 +1,36 @@
 #include "postgres_schema.hpp"
 
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
 #include <odb/database.hxx>
 #include <odb/transaction.hxx>
 
 namespace im::test {
 
+namespace {
+
+std::string read_migration(const std::string& name) {
+#ifdef MYCHAT_SOURCE_DIR
+    const std::filesystem::path root(MYCHAT_SOURCE_DIR);
+#else
+    // CMake compiles sources by absolute path; this file is test/support/.
+    const auto root = std::filesystem::path(__FILE__).parent_path().parent_path().parent_path();
+#endif
+    std::ifstream input(root / "db" / "migrations" / name);
+    if (!input) {
+        throw std::runtime_error("Failed to open migration " + name);
+    }
+    std::ostringstream sql;
+    sql << input.rdbuf();
+    return sql.str();
+}
+
+} // namespace
+
 void EnsureCoreSchema(odb::database& db) {
     odb::transaction t(db.begin());
 
@@ -40,6 +66,14 @@ void EnsureCoreSchema(odb::database& db) {
             "read_time" BIGINT NOT NULL
         )
     )");
+    db.execute(R"(
+        CREATE INDEX IF NOT EXISTS "im_messages_pair_time_i"
+            ON "im_messages" ("sender_uid", "receiver_uid", "create_time")
+    )");
+    db.execute(R"(
+        CREATE INDEX IF NOT EXISTS "im_messages_receiver_status_time_i"
+            ON "im_messages" ("receiver_uid", "status", "create_time")
+    )");
 
     db.execute(R"(
         CREATE TABLE IF NOT EXISTS "im_friends" (
@@ -54,6 +88,10 @@ void EnsureCoreSchema(odb::database& db) {
         CREATE UNIQUE INDEX IF NOT EXISTS "im_friends_pair_i"
             ON "im_friends" ("requester_uid", "target_uid")
     )");
+    db.execute(R"(
+        CREATE INDEX IF NOT EXISTS "im_friends_target_status_i"
+            ON "im_friends" ("target_uid", "status")
+    )");
 
     db.execute(R"(
         CREATE TABLE IF NOT EXISTS "im_groups" (
@@ -76,6 +114,10 @@ void EnsureCoreSchema(odb::database& db) {
         CREATE UNIQUE INDEX IF NOT EXISTS "im_group_members_pair_i"
             ON "im_group_members" ("group_id", "user_uid")
     )");
+    db.execute(R"(
+        CREATE INDEX IF NOT EXISTS "im_group_members_user_i"
+            ON "im_group_members" ("user_uid")
+    )");
 
     db.execute(R"(
         CREATE TABLE IF NOT EXISTS "im_group_messages" (
@@ -86,8 +128,38 @@ void EnsureCoreSchema(odb::database& db) {
             "created_at" BIGINT NOT NULL
         )
     )");
+    db.execute(R"(
+        CREATE INDEX IF NOT EXISTS "im_group_messages_group_id_i"
+            ON "im_group_messages" ("group_id", "id") INCLUDE ("sender_uid")
+    )");
+    db.execute(R"(
+        CREATE INDEX IF NOT EXISTS "im_group_messages_group_time_i"
+            ON "im_group_messages" ("group_id", "created_at")
+    )");
+
+    db.execute(R"(
+        CREATE TABLE IF NOT EXISTS "im_group_read_cursors" (
+            "group_id" BIGINT NOT NULL,
+            "user_uid" TEXT NOT NULL,
+            "last_read_msg_id" BIGINT NOT NULL DEFAULT 0,
+            "updated_at" BIGINT NOT NULL DEFAULT 0,
+            PRIMARY KEY ("group_id", "user_uid")
+        )
+    )");
+    db.execute(R"(
+        CREATE INDEX IF NOT EXISTS "im_group_read_cursors_user_i"
+            ON "im_group_read_cursors" ("user_uid")
+    )");
 
     t.commit();
+
+    // The message tables run partitioned, as in production. 004 is a no-op on
+    // tables that are already partitioned; the advisory lock keeps test
+    // binaries started in parallel from converting the same table twice.
+    odb::transaction partitioning(db.begin());
+    db.execute("SELECT pg_advisory_xact_lock(4004)");
+    db.execute(read_migration("004_message_partitioning.sql"));
+    partitioning.commit();
 }
 
 } // namespace im::test
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "../../common/utils/slab_allocator.hpp"
+
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace im::utils;
+
+TEST(SlabAllocatorTest, BlockSizeCoversRequestAndIsAligned) {
+    for (std::size_t bytes = 1; bytes <= SlabAllocator::kMaxSmallSize; ++bytes) {
+        const std::size_t block = SlabAllocator::block_size(bytes);
+        EXPECT_GE(block, bytes);
+        EXPECT_EQ(block % SlabAllocator::kAlignment, 0u);
+        // 最坏情况不超过 25% 的内部碎片（小于 128 字节按 16 字节取整）
+        EXPECT_LE(block, std::max<std::size_t>(bytes + 15, bytes + bytes / 4));
+    }
+    EXPECT_EQ(SlabAllocator::block_size(SlabAllocator::kMaxSmallSize + 1),
+              SlabAllocator::kMaxSmallSize + 1);
+}
+
+TEST(SlabAllocatorTest, FreedBlockIsReusedOnSameThread) {
+    void* first = SlabAllocator::allocate(100);
+    SlabAllocator::deallocate(first, 100);
+    void* second = SlabAllocator::allocate(100);
+    EXPECT_EQ(first, second);
+    SlabAllocator::deallocate(second, 100);
+}
+
+TEST(SlabAllocatorTest, CrossThreadFreesReturnToCentralInBatches) {
+    constexpr int kBlocks = 10000;
+    std::vector<void*> blocks;
+    for (int i = 0; i < kBlocks; ++i) {
+        void* p = SlabAllocator::allocate(64);
+        std::memset(p, 0xAB, 64);
+        blocks.push_back(p);
+    }
+
+    const auto before = SlabAllocator::stats();
+    std::thread([&] {
+        for (void* p : blocks) {
+            SlabAllocator::deallocate(p, 64);
+        }
+    }).join();
+    const auto after = SlabAllocator::stats();
+
+    // 每批 64 块归还一次，线程退出时剩余部分再归还一次
+    const uint64_t releases = after.central_releases - before.central_releases;
+    EXPECT_GT(releases, 0u);
+    EXPECT_LE(releases, kBlocks / 64 + 2);
+}
+
+TEST(SlabAllocatorTest, LargeRequestsBypassSlabs) {
+    const auto before = SlabAllocator::stats();
+    void* p = SlabAllocator::allocate(SlabAllocator::kMaxSmallSize * 2);
+    std::memset(p, 0, SlabAllocator::kMaxSmallSize * 2);
+    SlabAllocator::deallocate(p, SlabAllocator::kMaxSmallSize * 2);
+    EXPECT_EQ(SlabAllocator::stats().large_allocations, before.large_allocations + 1);
+}
+
+TEST(SlabAllocatorTest, MemoryResourceBacksPmrContainers) {
+    std::pmr::vector<std::pmr::string> strings(slab_memory_resource());
+    for (int i = 0; i < 1000; ++i) {
+        strings.emplace_back("message body that does not fit in SSO #" + std::to_string(i));
+    }
+    EXPECT_EQ(strings.back(), "message body that does not fit in SSO #999");
+    EXPECT_TRUE(slab_memory_resource()->is_equal(*slab_memory_resource()));
+}
+
+TEST(SlabAllocatorTest, StlAllocatorWorksWithDequeAndAllocateShared) {
+    std::deque<std::string, SlabStlAllocator<std::string>> queue;
+    for (int i = 0; i < 2000; ++i) {
+        queue.emplace_back(std::to_string(i));
+    }
+    EXPECT_EQ(queue.front(), "0");
+    EXPECT_EQ(queue.back(), "1999");
+
+    auto shared = std::allocate_shared<std::vector<int>>(SlabStlAllocator<std::vector<int>>(), 16, 7);
+    EXPECT_EQ(shared->size(), 16u);
+    EXPECT_EQ((*shared)[15], 7);
+}
+
+struct SlabObject : SlabAllocated {
+    char data[200];
+};
+
+TEST(SlabAllocatorTest, ClassOperatorNewUsesSlab) {
+    auto first = std::make_unique<SlabObject>();
+    SlabObject* raw = first.get();
+    first.reset();
+    auto second = std::make_unique<SlabObject>();
+    EXPECT_EQ(second.get(), raw);
+}